@@ -0,0 +1,423 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/cloudwatch-logging/CloudWatchLogsLogSystem.h>
+#include <aws/logs/CloudWatchLogsClient.h>
+#include <aws/logs/model/CreateLogGroupRequest.h>
+#include <aws/logs/model/CreateLogStreamRequest.h>
+#include <aws/logs/model/DescribeLogStreamsRequest.h>
+#include <aws/logs/model/PutLogEventsRequest.h>
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/AWSLogging.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+using namespace Aws::CloudWatchLogs;
+
+namespace {
+
+static const char* ALLOCATION_TAG = "CloudWatchLogsLogSystemTests";
+static const char* LOG_GROUP_NAME = "logGroup";
+static const char* LOG_STREAM_NAME = "logStream";
+
+static CloudWatchLogsError MakeError(CloudWatchLogsErrors errorType, const char* exceptionName, bool retryable)
+{
+    return CloudWatchLogsError(Aws::Client::AWSError<CloudWatchLogsErrors>(errorType, exceptionName, "Mocked error.", retryable));
+}
+
+/**
+ * Log stream that doesn't exist until it is created, and checks the sequence tokens of the events put to it.
+ * Other writers putting events to the stream, and outages, are simulated by the test.
+ */
+class MockCloudWatchLogsClient : public CloudWatchLogsClient
+{
+public:
+    MockCloudWatchLogsClient() : CloudWatchLogsClient(Aws::Auth::AWSCredentials("accessKeyId", "secretKey")),
+        m_logGroupExists(false), m_logStreamExists(false), m_available(true), m_sequenceNumber(0), m_describeLogStreamsCalls(0)
+    {
+    }
+
+    Model::PutLogEventsOutcome PutLogEvents(const Model::PutLogEventsRequest& request) const override
+    {
+        // Logged from the logging thread, it must not end up in the log stream.
+        AWS_LOGSTREAM_INFO(ALLOCATION_TAG, "Putting " << request.GetLogEvents().size() << " log events.");
+
+        std::lock_guard<std::mutex> locker(m_mutex);
+        EXPECT_EQ(LOG_GROUP_NAME, request.GetLogGroupName());
+        EXPECT_EQ(LOG_STREAM_NAME, request.GetLogStreamName());
+        if (!m_available)
+        {
+            return MakeError(CloudWatchLogsErrors::SERVICE_UNAVAILABLE, "ServiceUnavailableException", true);
+        }
+        if (!m_logStreamExists)
+        {
+            return MakeError(CloudWatchLogsErrors::RESOURCE_NOT_FOUND, "ResourceNotFoundException", false);
+        }
+        if (request.GetSequenceToken() != GetUploadSequenceToken())
+        {
+            return MakeError(CloudWatchLogsErrors::INVALID_SEQUENCE_TOKEN, "InvalidSequenceTokenException", false);
+        }
+
+        m_batches.push_back(request.GetLogEvents());
+        ++m_sequenceNumber;
+        Model::PutLogEventsResult result;
+        result.SetNextSequenceToken(GetUploadSequenceToken());
+        return result;
+    }
+
+    Model::DescribeLogStreamsOutcome DescribeLogStreams(const Model::DescribeLogStreamsRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        EXPECT_EQ(LOG_GROUP_NAME, request.GetLogGroupName());
+        EXPECT_EQ(LOG_STREAM_NAME, request.GetLogStreamNamePrefix());
+        ++m_describeLogStreamsCalls;
+
+        Model::DescribeLogStreamsResult result;
+        Model::LogStream logStream;
+        logStream.SetLogStreamName(LOG_STREAM_NAME);
+        logStream.SetUploadSequenceToken(GetUploadSequenceToken());
+        result.AddLogStreams(logStream);
+        // Another stream matching the prefix.
+        logStream.SetLogStreamName(Aws::String(LOG_STREAM_NAME) + "-other");
+        logStream.SetUploadSequenceToken("0");
+        result.AddLogStreams(logStream);
+        return result;
+    }
+
+    Model::CreateLogGroupOutcome CreateLogGroup(const Model::CreateLogGroupRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        EXPECT_EQ(LOG_GROUP_NAME, request.GetLogGroupName());
+        m_logGroupExists = true;
+        return Aws::NoResult();
+    }
+
+    Model::CreateLogStreamOutcome CreateLogStream(const Model::CreateLogStreamRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        EXPECT_EQ(LOG_GROUP_NAME, request.GetLogGroupName());
+        EXPECT_EQ(LOG_STREAM_NAME, request.GetLogStreamName());
+        if (!m_logGroupExists)
+        {
+            return MakeError(CloudWatchLogsErrors::RESOURCE_NOT_FOUND, "ResourceNotFoundException", false);
+        }
+        m_logStreamExists = true;
+        return Aws::NoResult();
+    }
+
+    // Another writer puts events to the stream, moving its sequence token on.
+    void PutEventsFromOtherWriter()
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_logGroupExists = true;
+        m_logStreamExists = true;
+        ++m_sequenceNumber;
+    }
+
+    void SetAvailable(bool available)
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_available = available;
+    }
+
+    bool LogStreamExists() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_logStreamExists;
+    }
+
+    int GetDescribeLogStreamsCalls() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_describeLogStreamsCalls;
+    }
+
+    Aws::Vector<Aws::Vector<Model::InputLogEvent>> GetBatches() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_batches;
+    }
+
+    Aws::Vector<Model::InputLogEvent> GetEvents() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        Aws::Vector<Model::InputLogEvent> events;
+        for (const auto& batch : m_batches)
+        {
+            events.insert(events.end(), batch.begin(), batch.end());
+        }
+        return events;
+    }
+
+private:
+    // A new stream has no sequence token until events are put to it.
+    Aws::String GetUploadSequenceToken() const
+    {
+        return m_sequenceNumber == 0 ? "" : StringUtils::to_string(m_sequenceNumber);
+    }
+
+    mutable std::mutex m_mutex;
+    mutable bool m_logGroupExists;
+    mutable bool m_logStreamExists;
+    bool m_available;
+    mutable long long m_sequenceNumber;
+    mutable int m_describeLogStreamsCalls;
+    mutable Aws::Vector<Aws::Vector<Model::InputLogEvent>> m_batches;
+};
+
+class CloudWatchLogsLogSystemTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_client = Aws::MakeShared<MockCloudWatchLogsClient>(ALLOCATION_TAG);
+        m_configuration.cloudWatchLogsClient = m_client;
+        m_configuration.logGroupName = LOG_GROUP_NAME;
+        m_configuration.logStreamName = LOG_STREAM_NAME;
+    }
+
+    void TearDown() override
+    {
+        if (!m_configuration.spillFilePath.empty())
+        {
+            Aws::FileSystem::RemoveFileIfExists(m_configuration.spillFilePath.c_str());
+        }
+        m_configuration.cloudWatchLogsClient = nullptr;
+        m_client = nullptr;
+    }
+
+    static void LogStatements(LogSystemInterface& logSystem, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            Aws::OStringStream message;
+            message << "statement " << i;
+            logSystem.LogStream(LogLevel::Info, ALLOCATION_TAG, message);
+        }
+    }
+
+    // Checks that the events hold the statements logged by LogStatements, in order.
+    static void VerifyStatements(const Aws::Vector<Model::InputLogEvent>& events, int count)
+    {
+        ASSERT_EQ(static_cast<size_t>(count), events.size());
+        for (int i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(0u, events[i].GetMessage().find("[INFO] "));
+            Aws::String statement = "statement " + StringUtils::to_string(i);
+            ASSERT_EQ(events[i].GetMessage().size() - statement.size(), events[i].GetMessage().rfind(statement));
+        }
+    }
+
+    std::shared_ptr<MockCloudWatchLogsClient> m_client;
+    CloudWatchLogsLogSystemConfiguration m_configuration;
+};
+
+} // anonymous namespace
+
+TEST_F(CloudWatchLogsLogSystemTest, TestFlushCreatesLogStreamAndPutsStatements)
+{
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 3);
+    logSystem.Flush();
+
+    ASSERT_TRUE(m_client->LogStreamExists());
+    auto batches = m_client->GetBatches();
+    ASSERT_EQ(1u, batches.size());
+    VerifyStatements(batches[0], 3);
+    ASSERT_NE(Aws::String::npos, batches[0][0].GetMessage().find(Aws::String(" ") + ALLOCATION_TAG + " ["));
+    for (size_t i = 1; i < batches[0].size(); ++i)
+    {
+        ASSERT_LE(batches[0][i - 1].GetTimestamp(), batches[0][i].GetTimestamp());
+    }
+    ASSERT_EQ(3u, logSystem.GetSentEventCount());
+    ASSERT_EQ(0u, logSystem.GetRejectedEventCount());
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestBatchesAreSplitAtCountLimit)
+{
+    m_configuration.maxBatchCount = 10;
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 25);
+    logSystem.Flush();
+
+    auto batches = m_client->GetBatches();
+    ASSERT_EQ(3u, batches.size());
+    ASSERT_EQ(10u, batches[0].size());
+    ASSERT_EQ(10u, batches[1].size());
+    ASSERT_EQ(5u, batches[2].size());
+    VerifyStatements(m_client->GetEvents(), 25);
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestBatchesAreSplitAtSizeLimit)
+{
+    m_configuration.maxBatchSize = 1000;
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 50);
+    logSystem.Flush();
+
+    auto batches = m_client->GetBatches();
+    ASSERT_LT(1u, batches.size());
+    for (const auto& batch : batches)
+    {
+        size_t batchSize = 0;
+        for (const auto& event : batch)
+        {
+            batchSize += event.GetMessage().size() + 26;
+        }
+        ASSERT_GE(1000u, batchSize);
+    }
+    VerifyStatements(m_client->GetEvents(), 50);
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestStatementsLargerThanAnEventAreTruncated)
+{
+    m_configuration.threadBufferSize = 1024 * 1024;
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    Aws::OStringStream message;
+    message << Aws::String(300 * 1024, 'a');
+    logSystem.LogStream(LogLevel::Info, ALLOCATION_TAG, message);
+    logSystem.Flush();
+
+    auto events = m_client->GetEvents();
+    ASSERT_EQ(1u, events.size());
+    ASSERT_EQ(256u * 1024 - 26, events[0].GetMessage().size());
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestStatementsAreSentAfterMaxBufferedTime)
+{
+    m_configuration.maxBufferedTimeMs = 500;
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_TRUE(m_client->GetBatches().empty());
+
+    for (int i = 0; i < 100 && m_client->GetBatches().empty(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    VerifyStatements(m_client->GetEvents(), 1);
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestSequenceTokenIsRefreshedAfterOtherWriters)
+{
+    m_client->PutEventsFromOtherWriter();
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 2);
+    logSystem.Flush();
+    ASSERT_EQ(1, m_client->GetDescribeLogStreamsCalls());
+    ASSERT_EQ(1u, m_client->GetBatches().size());
+
+    // The token returned by the last call is used as long as nobody else puts events.
+    LogStatements(logSystem, 2);
+    logSystem.Flush();
+    ASSERT_EQ(1, m_client->GetDescribeLogStreamsCalls());
+
+    m_client->PutEventsFromOtherWriter();
+    LogStatements(logSystem, 2);
+    logSystem.Flush();
+    ASSERT_EQ(2, m_client->GetDescribeLogStreamsCalls());
+    ASSERT_EQ(3u, m_client->GetBatches().size());
+    ASSERT_EQ(6u, logSystem.GetSentEventCount());
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestStatementsAreKeptWhileServiceIsUnavailable)
+{
+    m_client->SetAvailable(false);
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 3);
+    logSystem.Flush();
+    ASSERT_TRUE(m_client->GetBatches().empty());
+    ASSERT_EQ(0u, logSystem.GetSentEventCount());
+
+    m_client->SetAvailable(true);
+    logSystem.Flush();
+    VerifyStatements(m_client->GetEvents(), 3);
+    ASSERT_EQ(3u, logSystem.GetSentEventCount());
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestStatementsAreSpilledToDiskUnderBackpressure)
+{
+    m_configuration.maxBufferedSize = 2000;
+    m_configuration.spillFilePath = Aws::FileSystem::CreateTempFilePath();
+    m_client->SetAvailable(false);
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 100);
+    logSystem.Flush();
+    ASSERT_TRUE(m_client->GetBatches().empty());
+    ASSERT_LT(0u, logSystem.GetSpilledEventCount());
+    ASSERT_EQ(0u, logSystem.GetDroppedEventCount());
+
+    m_client->SetAvailable(true);
+    logSystem.Flush();
+    VerifyStatements(m_client->GetEvents(), 100);
+    ASSERT_EQ(100u, logSystem.GetSentEventCount());
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestStatementsAreDroppedAndReportedWithoutSpillFile)
+{
+    m_configuration.maxBufferedSize = 2000;
+    m_client->SetAvailable(false);
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    LogStatements(logSystem, 100);
+    logSystem.Flush();
+    uint64_t dropped = logSystem.GetDroppedEventCount();
+    ASSERT_LT(0u, dropped);
+    ASSERT_GT(100u, dropped);
+
+    m_client->SetAvailable(true);
+    logSystem.Flush();
+    VerifyStatements(m_client->GetEvents(), static_cast<int>(100 - dropped));
+
+    // The number of dropped statements is reported along with the next statement.
+    LogStatements(logSystem, 1);
+    logSystem.Flush();
+    auto events = m_client->GetEvents();
+    ASSERT_EQ(102 - dropped, events.size());
+    ASSERT_NE(Aws::String::npos, events[events.size() - 2].GetMessage().find(StringUtils::to_string(dropped) + " log statements were dropped"));
+    ASSERT_EQ(102 - dropped, logSystem.GetSentEventCount());
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestSpilledStatementsAreSentByNextLogSystem)
+{
+    m_configuration.spillFilePath = Aws::FileSystem::CreateTempFilePath();
+    m_client->SetAvailable(false);
+    {
+        CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+        LogStatements(logSystem, 5);
+    }
+    ASSERT_TRUE(m_client->GetBatches().empty());
+
+    m_client->SetAvailable(true);
+    CloudWatchLogsLogSystem logSystem(LogLevel::Info, m_configuration);
+    logSystem.Flush();
+    VerifyStatements(m_client->GetEvents(), 5);
+}
+
+TEST_F(CloudWatchLogsLogSystemTest, TestStatementsLoggedWhileSendingAreDropped)
+{
+    auto logSystem = Aws::MakeShared<CloudWatchLogsLogSystem>(ALLOCATION_TAG, LogLevel::Info, m_configuration);
+    PushLogger(logSystem);
+    LogStatements(*logSystem, 1);
+    logSystem->Flush();
+    LogStatements(*logSystem, 1);
+    logSystem->Flush();
+    PopLogger();
+
+    // The client logs every call, from the logging thread.
+    auto events = m_client->GetEvents();
+    ASSERT_EQ(2u, events.size());
+    for (const auto& event : events)
+    {
+        ASSERT_EQ(Aws::String::npos, event.GetMessage().find("Putting"));
+    }
+}
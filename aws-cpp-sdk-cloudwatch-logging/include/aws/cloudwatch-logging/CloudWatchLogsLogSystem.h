@@ -0,0 +1,159 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/cloudwatch-logging/CloudWatchLogging_EXPORTS.h>
+#include <aws/core/utils/logging/RingBufferLogSystem.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <atomic>
+#include <memory>
+
+namespace Aws
+{
+    namespace CloudWatchLogs
+    {
+        class CloudWatchLogsClient;
+    }
+
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Configuration for use with CloudWatchLogsLogSystem. The data here will be copied directly to CloudWatchLogsLogSystem.
+             */
+            struct CloudWatchLogsLogSystemConfiguration
+            {
+                CloudWatchLogsLogSystemConfiguration() : threadBufferSize(RingBufferLogSystem::DEFAULT_THREAD_BUFFER_SIZE), createLogStream(true),
+                    maxBufferedTimeMs(5000), maxBatchSize(1048576), maxBatchCount(10000), maxBufferedSize(16 * 1024 * 1024),
+                    maxSpillFileSize(256 * 1024 * 1024)
+                {
+                }
+
+                /**
+                 * Client to use for the PutLogEvents calls. You are responsible for setting this.
+                 * The calls are made from the logging thread, the statements the client logs itself are dropped.
+                 */
+                std::shared_ptr<Aws::CloudWatchLogs::CloudWatchLogsClient> cloudWatchLogsClient;
+                /**
+                 * Log group and log stream the statements are sent to. You are responsible for setting these.
+                 */
+                Aws::String logGroupName;
+                Aws::String logStreamName;
+                /**
+                 * Size in bytes of the buffer of each thread logging, statements are dropped while it is full.
+                 */
+                size_t threadBufferSize;
+                /**
+                 * When true, the log group and log stream are created if they don't exist. Enabled by default.
+                 */
+                bool createLogStream;
+                /**
+                 * Maximum time in ms a statement is buffered, to be sent with others, before it is sent. Defaults to 5 seconds.
+                 */
+                long maxBufferedTimeMs;
+                /**
+                 * Maximum size in bytes and number of events of a PutLogEvents call, defaults to the service limits of 1 MB and 10000 events.
+                 * The size of an event is the size of its message plus 26 bytes. Buffered statements are sent as soon as they reach either limit.
+                 */
+                size_t maxBatchSize;
+                size_t maxBatchCount;
+                /**
+                 * Size in bytes of the statements buffered in memory, while CloudWatch Logs can't keep up or can't be reached, beyond which
+                 * statements are spilled to spillFilePath. Defaults to 16 MB.
+                 */
+                size_t maxBufferedSize;
+                /**
+                 * File statements are spilled to, and read back from once the buffered statements were sent. Statements are dropped instead
+                 * when it is empty, the default, or the file reached maxSpillFileSize bytes, 256 MB by default. Statements left in the file
+                 * when the log system is destroyed are sent by the next log system spilling to the same file.
+                 */
+                Aws::String spillFilePath;
+                size_t maxSpillFileSize;
+            };
+
+            /**
+             * Logger sending the statements to a log stream of CloudWatch Logs, one event per statement, formatted as by DefaultLogSystem.
+             * Each thread logs to a ring buffer of its own without taking a lock or blocking on the service, see RingBufferLogSystem.
+             * The logging thread packs the statements into PutLogEvents calls, once maxBatchSize or maxBatchCount is reached, or the oldest
+             * statement was buffered for maxBufferedTimeMs, keeping track of the sequence token of the stream. Statements that can't be
+             * sent are kept in memory, then spilled to disk or dropped, and sent again after a backoff.
+             *
+             * Flush sends all the buffered statements, the destructor flushes one last time. Shut the log system down before calling
+             * Aws::ShutdownAPI, which cleans up the HTTP client the last PutLogEvents calls need.
+             */
+            class AWS_CLOUDWATCH_LOGGING_API CloudWatchLogsLogSystem : public RingBufferLogSystem
+            {
+            public:
+                using Base = RingBufferLogSystem;
+
+                CloudWatchLogsLogSystem(LogLevel logLevel, const CloudWatchLogsLogSystemConfiguration& configuration);
+                virtual ~CloudWatchLogsLogSystem();
+
+                /**
+                 * Number of events CloudWatch Logs accepted so far.
+                 */
+                uint64_t GetSentEventCount() const { return m_sentEvents.load(); }
+                /**
+                 * Number of events CloudWatch Logs rejected, as too old or too new, or in a call that failed with a non retryable error.
+                 */
+                uint64_t GetRejectedEventCount() const { return m_rejectedEvents.load(); }
+                /**
+                 * Number of statements written to the spill file so far.
+                 */
+                uint64_t GetSpilledEventCount() const { return m_spilledEvents.load(); }
+                /**
+                 * Number of statements dropped because neither the memory buffer nor the spill file had room for them, on top of
+                 * GetDroppedStatementCount.
+                 */
+                uint64_t GetDroppedEventCount() const { return m_droppedEvents.load(); }
+
+            protected:
+                void WriteStatements(const Aws::String& text, const Aws::Vector<FormattedStatement>& statements, bool flush) override;
+
+            private:
+                struct BufferedEvent
+                {
+                    int64_t timestampMillis;
+                    Aws::String message;
+                };
+
+                void AddEvent(int64_t timestampMillis, Aws::String&& message);
+                void SpillEvent(const BufferedEvent& event);
+                void ReadSpilledEvents();
+                bool IsBatchDue(int64_t nowMs, bool flush) const;
+                bool SendBatch(int64_t nowMs);
+                void PopEvents(size_t count, size_t size);
+                bool RefreshSequenceToken();
+                bool CreateLogStream();
+
+                CloudWatchLogsLogSystemConfiguration m_configuration;
+
+                // Only used by the logging thread.
+                Aws::Deque<BufferedEvent> m_events;
+                // Size of the buffered events as counted by PutLogEvents.
+                size_t m_bufferedSize;
+                Aws::String m_sequenceToken;
+                int64_t m_nextAttemptMs;
+                long m_backoffMs;
+                std::shared_ptr<Aws::OFStream> m_spillFile;
+                // Events are read back from m_spillReadOffset, the file holds events not sent yet while it is smaller than m_spillFileSize.
+                uint64_t m_spillFileSize;
+                uint64_t m_spillReadOffset;
+                uint64_t m_unreportedDroppedEvents;
+
+                std::atomic<uint64_t> m_sentEvents;
+                std::atomic<uint64_t> m_rejectedEvents;
+                std::atomic<uint64_t> m_spilledEvents;
+                std::atomic<uint64_t> m_droppedEvents;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,392 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/cloudwatch-logging/CloudWatchLogsLogSystem.h>
+#include <aws/logs/CloudWatchLogsClient.h>
+#include <aws/logs/model/CreateLogGroupRequest.h>
+#include <aws/logs/model/CreateLogStreamRequest.h>
+#include <aws/logs/model/DescribeLogStreamsRequest.h>
+#include <aws/logs/model/PutLogEventsRequest.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <fstream>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+using namespace Aws::CloudWatchLogs;
+
+static const char* CLOUDWATCH_LOGS_LOG_SYSTEM_TAG = "CloudWatchLogsLogSystem";
+// PutLogEvents counts 26 bytes on top of the message of each event.
+static const size_t EVENT_OVERHEAD = 26;
+static const size_t MAX_EVENT_SIZE = 256 * 1024;
+static const size_t MAX_BATCH_SIZE = 1048576;
+static const size_t MAX_BATCH_COUNT = 10000;
+// The events of a PutLogEvents call can't span more than 24 hours.
+static const int64_t MAX_BATCH_SPAN_MS = 24 * 60 * 60 * 1000;
+static const long MIN_BACKOFF_MS = 1000;
+static const long MAX_BACKOFF_MS = 60000;
+// Enough to create a missing log stream, then pick up its sequence token.
+static const int MAX_PUT_ATTEMPTS = 3;
+
+CloudWatchLogsLogSystem::CloudWatchLogsLogSystem(LogLevel logLevel, const CloudWatchLogsLogSystemConfiguration& configuration) :
+    Base(logLevel, configuration.threadBufferSize),
+    m_configuration(configuration),
+    m_bufferedSize(0),
+    m_nextAttemptMs(0),
+    m_backoffMs(0),
+    m_spillFileSize(0),
+    m_spillReadOffset(0),
+    m_unreportedDroppedEvents(0),
+    m_sentEvents(0),
+    m_rejectedEvents(0),
+    m_spilledEvents(0),
+    m_droppedEvents(0)
+{
+    m_configuration.maxBatchSize = (std::min)(m_configuration.maxBatchSize, MAX_BATCH_SIZE);
+    m_configuration.maxBatchCount = (std::max)((std::min)(m_configuration.maxBatchCount, MAX_BATCH_COUNT), static_cast<size_t>(1));
+
+    if (!m_configuration.spillFilePath.empty())
+    {
+        // Picks up the events a previous log system left in the file.
+        Aws::IFStream existingFile(m_configuration.spillFilePath.c_str(), std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+        if (existingFile.good())
+        {
+            std::streamoff size = existingFile.tellg();
+            m_spillFileSize = size > 0 ? static_cast<uint64_t>(size) : 0;
+        }
+        m_spillFile = Aws::MakeShared<Aws::OFStream>(CLOUDWATCH_LOGS_LOG_SYSTEM_TAG, m_configuration.spillFilePath.c_str(),
+            std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+    }
+
+    StartLogging();
+}
+
+CloudWatchLogsLogSystem::~CloudWatchLogsLogSystem()
+{
+    StopLogging();
+
+    // The events that couldn't be sent are left for the next log system spilling to the same file.
+    if (m_spillFile)
+    {
+        for (const auto& event : m_events)
+        {
+            SpillEvent(event);
+        }
+    }
+}
+
+void CloudWatchLogsLogSystem::WriteStatements(const Aws::String& text, const Aws::Vector<FormattedStatement>& statements, bool flush)
+{
+    // Spilled events are older than the new ones, they are read back first.
+    ReadSpilledEvents();
+    for (const auto& statement : statements)
+    {
+        AddEvent(statement.timestampMillis, text.substr(statement.offset, statement.length));
+    }
+
+    int64_t nowMs = DateTime::CurrentTimeMillis();
+    // Failed calls are retried after a backoff, or on the next flush.
+    if (!flush && nowMs < m_nextAttemptMs)
+    {
+        return;
+    }
+
+    while (IsBatchDue(nowMs, flush) && SendBatch(nowMs))
+    {
+        ReadSpilledEvents();
+    }
+}
+
+void CloudWatchLogsLogSystem::AddEvent(int64_t timestampMillis, Aws::String&& message)
+{
+    if (message.size() > MAX_EVENT_SIZE - EVENT_OVERHEAD)
+    {
+        // Truncated on a UTF-8 character boundary, CloudWatch Logs rejects invalid UTF-8.
+        size_t length = MAX_EVENT_SIZE - EVENT_OVERHEAD;
+        while (length > 0 && (static_cast<unsigned char>(message[length]) & 0xC0) == 0x80)
+        {
+            --length;
+        }
+        message.resize(length);
+    }
+
+    BufferedEvent event = { timestampMillis, std::move(message) };
+    size_t size = event.message.size() + EVENT_OVERHEAD;
+    // Once events were spilled, the newer ones follow them in the file until it was read back, to keep them in order.
+    if (m_spillReadOffset < m_spillFileSize || m_bufferedSize + size > m_configuration.maxBufferedSize)
+    {
+        SpillEvent(event);
+        return;
+    }
+
+    if (m_unreportedDroppedEvents > 0)
+    {
+        BufferedEvent warning = { timestampMillis, "[WARN] " + DateTime(timestampMillis).ToGmtString("%Y-%m-%d %H:%M:%S") + " " +
+            CLOUDWATCH_LOGS_LOG_SYSTEM_TAG + " " + StringUtils::to_string(m_unreportedDroppedEvents) +
+            " log statements were dropped because CloudWatch Logs could not keep up with them." };
+        m_unreportedDroppedEvents = 0;
+        m_bufferedSize += warning.message.size() + EVENT_OVERHEAD;
+        m_events.push_back(std::move(warning));
+    }
+
+    m_bufferedSize += size;
+    m_events.push_back(std::move(event));
+}
+
+void CloudWatchLogsLogSystem::SpillEvent(const BufferedEvent& event)
+{
+    uint32_t length = static_cast<uint32_t>(event.message.size());
+    uint64_t recordSize = sizeof(event.timestampMillis) + sizeof(length) + length;
+    if (!m_spillFile || !m_spillFile->good() || m_spillFileSize + recordSize > m_configuration.maxSpillFileSize)
+    {
+        m_droppedEvents++;
+        m_unreportedDroppedEvents++;
+        return;
+    }
+
+    m_spillFile->write(reinterpret_cast<const char*>(&event.timestampMillis), sizeof(event.timestampMillis));
+    m_spillFile->write(reinterpret_cast<const char*>(&length), sizeof(length));
+    m_spillFile->write(event.message.data(), static_cast<std::streamsize>(length));
+    m_spillFileSize += recordSize;
+    m_spilledEvents++;
+}
+
+void CloudWatchLogsLogSystem::ReadSpilledEvents()
+{
+    if (m_spillReadOffset >= m_spillFileSize)
+    {
+        return;
+    }
+
+    m_spillFile->flush();
+    Aws::IFStream spillFile(m_configuration.spillFilePath.c_str(), std::ios_base::in | std::ios_base::binary);
+    spillFile.seekg(static_cast<std::streamoff>(m_spillReadOffset));
+    // Leaves half of the memory buffer to the events logged in the meantime.
+    while (m_spillReadOffset < m_spillFileSize && m_bufferedSize < m_configuration.maxBufferedSize / 2)
+    {
+        BufferedEvent event;
+        uint32_t length = 0;
+        spillFile.read(reinterpret_cast<char*>(&event.timestampMillis), sizeof(event.timestampMillis));
+        spillFile.read(reinterpret_cast<char*>(&length), sizeof(length));
+        if (spillFile.good())
+        {
+            event.message.resize(length);
+            spillFile.read(&event.message[0], static_cast<std::streamsize>(length));
+        }
+        if (!spillFile.good())
+        {
+            // The last event was cut short, e.g. when the process crashed while writing it.
+            AWS_LOGSTREAM_ERROR(CLOUDWATCH_LOGS_LOG_SYSTEM_TAG, "Failed to read spill file " << m_configuration.spillFilePath
+                << " at offset " << m_spillReadOffset << ", skipping the rest of the file.");
+            m_spillReadOffset = m_spillFileSize;
+            break;
+        }
+
+        m_spillReadOffset += sizeof(event.timestampMillis) + sizeof(length) + length;
+        m_bufferedSize += length + EVENT_OVERHEAD;
+        m_events.push_back(std::move(event));
+    }
+
+    if (m_spillReadOffset >= m_spillFileSize)
+    {
+        // Every spilled event was read back, the file starts over.
+        m_spillFile.reset();
+        m_spillFile = Aws::MakeShared<Aws::OFStream>(CLOUDWATCH_LOGS_LOG_SYSTEM_TAG, m_configuration.spillFilePath.c_str(),
+            std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        m_spillFileSize = 0;
+        m_spillReadOffset = 0;
+    }
+}
+
+bool CloudWatchLogsLogSystem::IsBatchDue(int64_t nowMs, bool flush) const
+{
+    if (m_events.empty())
+    {
+        return false;
+    }
+
+    return flush || m_bufferedSize >= m_configuration.maxBatchSize || m_events.size() >= m_configuration.maxBatchCount ||
+        m_events.front().timestampMillis + m_configuration.maxBufferedTimeMs <= nowMs || m_spillReadOffset < m_spillFileSize;
+}
+
+bool CloudWatchLogsLogSystem::SendBatch(int64_t nowMs)
+{
+    Aws::Vector<Model::InputLogEvent> logEvents;
+    size_t batchSize = 0;
+    int64_t firstTimestamp = m_events.front().timestampMillis;
+    int64_t lastTimestamp = firstTimestamp;
+    for (const auto& event : m_events)
+    {
+        size_t eventSize = event.message.size() + EVENT_OVERHEAD;
+        int64_t batchFirstTimestamp = (std::min)(firstTimestamp, event.timestampMillis);
+        int64_t batchLastTimestamp = (std::max)(lastTimestamp, event.timestampMillis);
+        if (!logEvents.empty() && (logEvents.size() >= m_configuration.maxBatchCount || batchSize + eventSize > m_configuration.maxBatchSize ||
+            batchLastTimestamp - batchFirstTimestamp > MAX_BATCH_SPAN_MS))
+        {
+            break;
+        }
+
+        firstTimestamp = batchFirstTimestamp;
+        lastTimestamp = batchLastTimestamp;
+        batchSize += eventSize;
+        Model::InputLogEvent logEvent;
+        logEvent.SetTimestamp(event.timestampMillis);
+        logEvent.SetMessage(event.message);
+        logEvents.push_back(std::move(logEvent));
+    }
+
+    // The statements written out together are ordered by time, but a statement can be written out after statements logged later than it.
+    std::stable_sort(logEvents.begin(), logEvents.end(),
+        [](const Model::InputLogEvent& left, const Model::InputLogEvent& right) { return left.GetTimestamp() < right.GetTimestamp(); });
+    size_t count = logEvents.size();
+
+    for (int attempt = 1; ; ++attempt)
+    {
+        Model::PutLogEventsRequest request;
+        request.SetLogGroupName(m_configuration.logGroupName);
+        request.SetLogStreamName(m_configuration.logStreamName);
+        request.SetLogEvents(logEvents);
+        if (!m_sequenceToken.empty())
+        {
+            request.SetSequenceToken(m_sequenceToken);
+        }
+
+        auto outcome = m_configuration.cloudWatchLogsClient->PutLogEvents(request);
+        if (outcome.IsSuccess())
+        {
+            const auto& result = outcome.GetResult();
+            m_sequenceToken = result.GetNextSequenceToken();
+
+            // Events are rejected by ranges of the batch, ordered by time: the oldest ones as too old or expired, the newest ones as too new.
+            const auto& rejectedInfo = result.GetRejectedLogEventsInfo();
+            size_t rejected = 0;
+            if (rejectedInfo.TooOldLogEventEndIndexHasBeenSet() || rejectedInfo.ExpiredLogEventEndIndexHasBeenSet())
+            {
+                rejected = static_cast<size_t>((std::max)(rejectedInfo.GetTooOldLogEventEndIndex(), rejectedInfo.GetExpiredLogEventEndIndex()));
+            }
+            if (rejectedInfo.TooNewLogEventStartIndexHasBeenSet())
+            {
+                rejected += count - (std::min)(static_cast<size_t>(rejectedInfo.GetTooNewLogEventStartIndex()), count);
+            }
+            rejected = (std::min)(rejected, count);
+
+            m_sentEvents += count - rejected;
+            m_rejectedEvents += rejected;
+            m_backoffMs = 0;
+            PopEvents(count, batchSize);
+            return true;
+        }
+
+        const auto& error = outcome.GetError();
+        bool canRetryNow = attempt < MAX_PUT_ATTEMPTS;
+        switch (error.GetErrorType())
+        {
+            case CloudWatchLogsErrors::INVALID_SEQUENCE_TOKEN:
+                // Another writer put events in the stream, or the token was lost with a previous response.
+                if (canRetryNow && RefreshSequenceToken())
+                {
+                    continue;
+                }
+                break;
+            case CloudWatchLogsErrors::DATA_ALREADY_ACCEPTED:
+                // An earlier attempt went through, but its response was lost.
+                RefreshSequenceToken();
+                m_sentEvents += count;
+                m_backoffMs = 0;
+                PopEvents(count, batchSize);
+                return true;
+            case CloudWatchLogsErrors::RESOURCE_NOT_FOUND:
+                if (canRetryNow && m_configuration.createLogStream && CreateLogStream())
+                {
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+
+        AWS_LOGSTREAM_ERROR(CLOUDWATCH_LOGS_LOG_SYSTEM_TAG, "Failed to put " << count << " log events to log stream "
+            << m_configuration.logGroupName << "/" << m_configuration.logStreamName << ": " << error.GetExceptionName() << " " << error.GetMessage());
+
+        bool retryable = error.ShouldRetry() || error.GetErrorType() == CloudWatchLogsErrors::INVALID_SEQUENCE_TOKEN ||
+            (error.GetErrorType() == CloudWatchLogsErrors::RESOURCE_NOT_FOUND && m_configuration.createLogStream);
+        if (!retryable)
+        {
+            // Sending these events again would fail the same way, e.g. without permission to put events to the stream.
+            m_rejectedEvents += count;
+            PopEvents(count, batchSize);
+        }
+
+        m_backoffMs = m_backoffMs == 0 ? MIN_BACKOFF_MS : (std::min)(m_backoffMs * 2, MAX_BACKOFF_MS);
+        m_nextAttemptMs = nowMs + m_backoffMs;
+        return false;
+    }
+}
+
+void CloudWatchLogsLogSystem::PopEvents(size_t count, size_t size)
+{
+    m_events.erase(m_events.begin(), m_events.begin() + static_cast<std::ptrdiff_t>(count));
+    m_bufferedSize -= size;
+}
+
+bool CloudWatchLogsLogSystem::RefreshSequenceToken()
+{
+    Model::DescribeLogStreamsRequest request;
+    request.SetLogGroupName(m_configuration.logGroupName);
+    request.SetLogStreamNamePrefix(m_configuration.logStreamName);
+    auto outcome = m_configuration.cloudWatchLogsClient->DescribeLogStreams(request);
+    if (!outcome.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(CLOUDWATCH_LOGS_LOG_SYSTEM_TAG, "Failed to describe log stream " << m_configuration.logGroupName << "/"
+            << m_configuration.logStreamName << ": " << outcome.GetError().GetExceptionName() << " " << outcome.GetError().GetMessage());
+        return false;
+    }
+
+    // Streams are ordered by name, the one named as the prefix comes first.
+    for (const auto& logStream : outcome.GetResult().GetLogStreams())
+    {
+        if (logStream.GetLogStreamName() == m_configuration.logStreamName)
+        {
+            m_sequenceToken = logStream.GetUploadSequenceToken();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CloudWatchLogsLogSystem::CreateLogStream()
+{
+    Model::CreateLogStreamRequest request;
+    request.SetLogGroupName(m_configuration.logGroupName);
+    request.SetLogStreamName(m_configuration.logStreamName);
+    auto outcome = m_configuration.cloudWatchLogsClient->CreateLogStream(request);
+    if (!outcome.IsSuccess() && outcome.GetError().GetErrorType() == CloudWatchLogsErrors::RESOURCE_NOT_FOUND)
+    {
+        Model::CreateLogGroupRequest groupRequest;
+        groupRequest.SetLogGroupName(m_configuration.logGroupName);
+        auto groupOutcome = m_configuration.cloudWatchLogsClient->CreateLogGroup(groupRequest);
+        if (!groupOutcome.IsSuccess() && groupOutcome.GetError().GetErrorType() != CloudWatchLogsErrors::RESOURCE_ALREADY_EXISTS)
+        {
+            AWS_LOGSTREAM_ERROR(CLOUDWATCH_LOGS_LOG_SYSTEM_TAG, "Failed to create log group " << m_configuration.logGroupName << ": "
+                << groupOutcome.GetError().GetExceptionName() << " " << groupOutcome.GetError().GetMessage());
+            return false;
+        }
+        outcome = m_configuration.cloudWatchLogsClient->CreateLogStream(request);
+    }
+
+    if (!outcome.IsSuccess() && outcome.GetError().GetErrorType() != CloudWatchLogsErrors::RESOURCE_ALREADY_EXISTS)
+    {
+        AWS_LOGSTREAM_ERROR(CLOUDWATCH_LOGS_LOG_SYSTEM_TAG, "Failed to create log stream " << m_configuration.logGroupName << "/"
+            << m_configuration.logStreamName << ": " << outcome.GetError().GetExceptionName() << " " << outcome.GetError().GetMessage());
+        return false;
+    }
+
+    // A new stream takes its first events without a token, an existing one answers with the expected token.
+    m_sequenceToken.clear();
+    return true;
+}
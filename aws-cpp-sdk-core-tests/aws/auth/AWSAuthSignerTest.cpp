@@ -13,7 +13,12 @@
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/platform/Platform.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/testing/MemoryTesting.h>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <iostream>
+#include <thread>
 
 using namespace Aws::Client;
 using namespace Aws::Utils;
@@ -40,6 +45,18 @@ private:
     DateTime m_signingTimeStamp;
 };
 
+class MutableCredentialsProvider : public Aws::Auth::AWSCredentialsProvider
+{
+public:
+    MutableCredentialsProvider(const Aws::Auth::AWSCredentials& credentials) : m_credentials(credentials) {}
+
+    Aws::Auth::AWSCredentials GetAWSCredentials() override { return m_credentials; }
+    void SetAWSCredentials(const Aws::Auth::AWSCredentials& credentials) { m_credentials = credentials; }
+
+private:
+    Aws::Auth::AWSCredentials m_credentials;
+};
+
 static DateTime ParseTestFileDateTime(const char* dateStr)
 {
     Aws::StringStream ss;
@@ -447,3 +464,142 @@ TEST(AWSAuthV4SignerTest, PostXWWWFormURLEncoded)
 {
     RunV4TestCase("post-x-www-form-urlencoded");
 }
+
+static Aws::String SignVanillaRequest(TestableAuthv4Signer& signer, const DateTime& timestamp, const char* region, const char* serviceName)
+{
+    auto request = Standard::StandardHttpRequest("http://example.amazonaws.com/", Aws::Http::HttpMethod::HTTP_GET);
+    signer.SetSigningTimestamp(timestamp);
+    EXPECT_TRUE(signer.SignRequest(request, region, serviceName, false));
+    return request.GetAwsAuthorization();
+}
+
+static Aws::String SignVanillaRequestWithNewSigner(const std::shared_ptr<Aws::Auth::AWSCredentialsProvider>& credProvider,
+    const DateTime& timestamp, const char* region, const char* serviceName)
+{
+    TestableAuthv4Signer signer(credProvider, serviceName, region, AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    return SignVanillaRequest(signer, timestamp, region, serviceName);
+}
+
+TEST(AWSAuthV4SignerTest, DerivedKeyCacheIsKeyedByRegionServiceDateAndSecret)
+{
+    auto credProvider = Aws::MakeShared<MutableCredentialsProvider>(ALLOC_TAG, Aws::Auth::AWSCredentials("AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"));
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    DateTime firstDay = ParseTestFileDateTime("20150830T123600Z");
+    DateTime secondDay = ParseTestFileDateTime("20150831T123600Z");
+
+    // Alternating region and service overrides must each use their own derived key.
+    const char* regions[] = { "us-east-1", "us-west-2", "us-east-1", "eu-west-1", "us-west-2" };
+    const char* services[] = { "service", "service", "otherservice", "service", "otherservice" };
+    for (size_t i = 0; i < sizeof(regions) / sizeof(regions[0]); ++i)
+    {
+        ASSERT_EQ(SignVanillaRequestWithNewSigner(credProvider, firstDay, regions[i], services[i]),
+            SignVanillaRequest(signer, firstDay, regions[i], services[i]));
+    }
+
+    auto firstDaySignature = SignVanillaRequest(signer, firstDay, "us-east-1", "service");
+    auto secondDaySignature = SignVanillaRequest(signer, secondDay, "us-east-1", "service");
+    ASSERT_NE(firstDaySignature, secondDaySignature);
+    ASSERT_EQ(SignVanillaRequestWithNewSigner(credProvider, secondDay, "us-east-1", "service"), secondDaySignature);
+
+    credProvider->SetAWSCredentials(Aws::Auth::AWSCredentials("AKIDEXAMPLE", "rotatedSecretKeyEXAMPLEKEY"));
+    auto rotatedSignature = SignVanillaRequest(signer, secondDay, "us-east-1", "service");
+    ASSERT_NE(secondDaySignature, rotatedSignature);
+    ASSERT_EQ(SignVanillaRequestWithNewSigner(credProvider, secondDay, "us-east-1", "service"), rotatedSignature);
+}
+
+TEST(AWSAuthV4SignerTest, ConcurrentSignaturesDontShareDigests)
+{
+    auto credProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    signer.SetSigningTimestamp(ParseTestFileDateTime("20150830T123600Z"));
+
+    const int threadsCount = 8;
+    const int iterations = 200;
+    auto sign = [&signer](int thread)
+    {
+        auto request = Standard::StandardHttpRequest("http://example.amazonaws.com/thread" + StringUtils::to_string(thread), Aws::Http::HttpMethod::HTTP_GET);
+        EXPECT_TRUE(signer.SignRequest(request));
+        return request.GetAwsAuthorization();
+    };
+    Aws::Vector<Aws::String> expectedSignatures;
+    for (int thread = 0; thread < threadsCount; ++thread)
+    {
+        expectedSignatures.push_back(sign(thread));
+    }
+
+    // The canonical requests of the threads are hashed at the same time, each must get the signature of its own.
+    std::atomic<int> mismatches(0);
+    Aws::Vector<std::thread> threads;
+    for (int thread = 0; thread < threadsCount; ++thread)
+    {
+        threads.emplace_back([&, thread]
+        {
+            for (int i = 0; i < iterations; ++i)
+            {
+                if (sign(thread) != expectedSignatures[thread])
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(0, mismatches.load());
+}
+
+static uint64_t GetTotalAllocationCount()
+{
+#ifdef USE_AWS_MEMORY_MANAGEMENT
+    // RunTests installs an ExactTestMemorySystem for the whole run.
+    auto memorySystem = static_cast<BaseTestMemorySystem*>(Aws::Utils::Memory::GetMemorySystem());
+    return memorySystem ? memorySystem->GetTotalAllocationCount() : 0;
+#else
+    return 0;
+#endif
+}
+
+// Not a correctness test, run it with --gtest_also_run_disabled_tests to report the cost of signing the test suite requests.
+// The signatures are still checked while doing so.
+TEST(AWSAuthV4SignerTest, DISABLED_SigningMicroBenchmark)
+{
+    const char* testCases[] = { "get-vanilla", "get-vanilla-query-order-key-case", "get-header-value-trim", "post-vanilla", "post-x-www-form-urlencoded" };
+    const int iterations = 200;
+    auto credProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+
+    for (const char* testCase : testCases)
+    {
+        DateTime timestampForSigner;
+        auto request = GetHttpRequestFromTestCase(testCase, timestampForSigner, Scheme::HTTP);
+        Aws::FStream signatureFile(MakeSigV4ResourceFilePath(testCase, "authz").c_str(), std::ios::in);
+        ASSERT_TRUE(signatureFile.good());
+        Aws::String expectedSignature;
+        std::getline(signatureFile, expectedSignature);
+        signer.SetSigningTimestamp(timestampForSigner);
+
+        uint64_t allocationsBefore = GetTotalAllocationCount();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            // Signing adds the authorization header, which would otherwise be signed on the next pass.
+            request.DeleteHeader(AUTHORIZATION_HEADER);
+            ASSERT_TRUE(signer.SignRequest(request));
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        uint64_t allocations = GetTotalAllocationCount() - allocationsBefore;
+        ASSERT_STREQ(expectedSignature.c_str(), request.GetAwsAuthorization().c_str());
+
+        std::cout << testCase << ": " << elapsed.count() / iterations << " ns/op, ";
+        if (allocationsBefore > 0)
+        {
+            std::cout << allocations / iterations << " allocations/op" << std::endl;
+        }
+        else
+        {
+            std::cout << "allocations/op n/a (no test memory system)" << std::endl;
+        }
+    }
+}
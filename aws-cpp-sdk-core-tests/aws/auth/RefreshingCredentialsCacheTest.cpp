@@ -0,0 +1,215 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/RefreshingCredentialsCache.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+static const char ALLOCATION_TAG[] = "RefreshingCredentialsCacheTest";
+static const long ONE_HOUR_MS = 60 * 60 * 1000;
+
+static AWSCredentials MakeCredentials(const char* accessKeyId, int64_t expiresInMs)
+{
+    return AWSCredentials(accessKeyId, "secretKey", "sessionToken", DateTime(DateTime::CurrentTimeMillis() + expiresInMs));
+}
+
+TEST(RefreshingCredentialsCacheTest, TestCredentialsAreLoadedOnceAndCached)
+{
+    std::atomic<int> loads(0);
+    RefreshingCredentialsCache cache(ALLOCATION_TAG, [&](AWSCredentials& credentials)
+    {
+        ++loads;
+        credentials = MakeCredentials("accessKeyId", ONE_HOUR_MS);
+        return true;
+    }, ONE_HOUR_MS);
+
+    auto snapshot = cache.GetSnapshot();
+    ASSERT_NE(nullptr, snapshot);
+    ASSERT_EQ("accessKeyId", snapshot->GetAWSAccessKeyId());
+    ASSERT_EQ("accessKeyId", cache.GetCredentials().GetAWSAccessKeyId());
+    // The same immutable snapshot is handed out until the credentials are refreshed.
+    ASSERT_EQ(snapshot, cache.GetSnapshot());
+    ASSERT_EQ(1, loads.load());
+
+    ASSERT_TRUE(cache.Refresh());
+    ASSERT_EQ(2, loads.load());
+    ASSERT_NE(snapshot, cache.GetSnapshot());
+}
+
+TEST(RefreshingCredentialsCacheTest, TestConcurrentCallersLoadOnce)
+{
+    std::atomic<int> loads(0);
+    RefreshingCredentialsCache cache(ALLOCATION_TAG, [&](AWSCredentials& credentials)
+    {
+        ++loads;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        credentials = MakeCredentials("accessKeyId", ONE_HOUR_MS);
+        return true;
+    }, ONE_HOUR_MS);
+
+    Aws::Vector<std::thread> callers;
+    std::atomic<int> emptyCredentials(0);
+    for (int i = 0; i < 8; ++i)
+    {
+        callers.emplace_back([&]
+        {
+            if (cache.GetCredentials().IsEmpty())
+            {
+                ++emptyCredentials;
+            }
+        });
+    }
+    for (auto& caller : callers)
+    {
+        caller.join();
+    }
+
+    ASSERT_EQ(1, loads.load());
+    ASSERT_EQ(0, emptyCredentials.load());
+}
+
+TEST(RefreshingCredentialsCacheTest, TestCredentialsAreRefreshedInTheBackgroundBeforeExpiring)
+{
+    std::atomic<int> loads(0);
+    RefreshingCredentialsCache cache(ALLOCATION_TAG, [&](AWSCredentials& credentials)
+    {
+        // The first credentials expire within the prefetch window, the next ones don't.
+        credentials = ++loads == 1 ? MakeCredentials("expiringSoon", 60 * 1000) : MakeCredentials("refreshed", ONE_HOUR_MS);
+        return true;
+    }, ONE_HOUR_MS);
+
+    ASSERT_EQ("expiringSoon", cache.GetCredentials().GetAWSAccessKeyId());
+
+    AWSCredentials credentials;
+    for (int i = 0; i < 50 && credentials.GetAWSAccessKeyId() != "refreshed"; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        credentials = cache.GetCredentials();
+    }
+    ASSERT_EQ("refreshed", credentials.GetAWSAccessKeyId());
+    ASSERT_EQ(2, loads.load());
+}
+
+TEST(RefreshingCredentialsCacheTest, TestValidCredentialsAreServedWhileRefreshFails)
+{
+    std::atomic<int> loads(0);
+    std::atomic<bool> failing(false);
+    RefreshingCredentialsCache cache(ALLOCATION_TAG, [&](AWSCredentials& credentials)
+    {
+        ++loads;
+        if (failing)
+        {
+            return false;
+        }
+        credentials = MakeCredentials("accessKeyId", ONE_HOUR_MS);
+        return true;
+    }, 10 /*refreshRateMs*/);
+
+    ASSERT_EQ("accessKeyId", cache.GetCredentials().GetAWSAccessKeyId());
+    failing = true;
+    ASSERT_FALSE(cache.Refresh());
+    int failedLoads = loads.load();
+
+    // Once loads fail the refresh thread backs off for seconds rather than retrying at the refresh rate,
+    // it only completes the wait it was already in.
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_EQ("accessKeyId", cache.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_LE(loads.load(), failedLoads + 1);
+}
+
+TEST(RefreshingCredentialsCacheTest, TestExpiredCredentialsAreLoadedByCaller)
+{
+    std::atomic<int> loads(0);
+    RefreshingCredentialsCache cache(ALLOCATION_TAG, [&](AWSCredentials& credentials)
+    {
+        if (++loads == 1)
+        {
+            credentials = MakeCredentials("expired", -1000);
+        }
+        else
+        {
+            credentials = MakeCredentials("valid", ONE_HOUR_MS);
+        }
+        return true;
+    }, ONE_HOUR_MS);
+
+    // Whatever was loaded is returned, but expired credentials are loaded again by the next caller rather than waiting on the refresh thread.
+    ASSERT_EQ("expired", cache.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("valid", cache.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(2, loads.load());
+}
+
+TEST(RefreshingCredentialsCacheTest, TestNoCredentialsWhenLoadingFails)
+{
+    RefreshingCredentialsCache cache(ALLOCATION_TAG, [](AWSCredentials&) { return false; }, ONE_HOUR_MS);
+
+    ASSERT_EQ(nullptr, cache.GetSnapshot());
+    ASSERT_TRUE(cache.GetCredentials().IsEmpty());
+}
+
+TEST(RefreshingCredentialsCacheTest, TestRefreshStopsWhileCredentialsAreNotRead)
+{
+    std::atomic<int> loads(0);
+    RefreshingCredentialsCache cache(ALLOCATION_TAG, [&](AWSCredentials& credentials)
+    {
+        ++loads;
+        credentials = MakeCredentials("accessKeyId", ONE_HOUR_MS);
+        return true;
+    }, 10 /*refreshRateMs*/, DEFAULT_CREDENTIALS_PREFETCH_WINDOW_MS, 100 /*idleTimeoutMs*/);
+
+    ASSERT_EQ("accessKeyId", cache.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_TRUE(cache.IsRefreshingInTheBackground());
+    for (int i = 0; i < 50 && cache.IsRefreshingInTheBackground(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_FALSE(cache.IsRefreshingInTheBackground());
+    int idleLoads = loads.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(idleLoads, loads.load());
+
+    // The next read serves the cached credentials and starts refreshing them again.
+    ASSERT_EQ("accessKeyId", cache.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_TRUE(cache.IsRefreshingInTheBackground());
+}
+
+TEST(RefreshingCredentialsCacheTest, TestCleanupStopsTheRefreshOfAllCaches)
+{
+    std::atomic<int> loads(0);
+    auto loader = [&](AWSCredentials& credentials)
+    {
+        ++loads;
+        credentials = MakeCredentials("accessKeyId", ONE_HOUR_MS);
+        return true;
+    };
+    RefreshingCredentialsCache first(ALLOCATION_TAG, loader, 10 /*refreshRateMs*/);
+    RefreshingCredentialsCache second(ALLOCATION_TAG, loader, 10 /*refreshRateMs*/);
+    first.GetCredentials();
+    second.GetCredentials();
+    ASSERT_TRUE(first.IsRefreshingInTheBackground());
+    ASSERT_TRUE(second.IsRefreshingInTheBackground());
+
+    CleanupRefreshingCredentialsCaches();
+    ASSERT_FALSE(first.IsRefreshingInTheBackground());
+    ASSERT_FALSE(second.IsRefreshingInTheBackground());
+
+    // Until the refresh is enabled again, the credentials are still served but no thread is started.
+    ASSERT_EQ("accessKeyId", first.GetCredentials().GetAWSAccessKeyId());
+    int stoppedLoads = loads.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(first.IsRefreshingInTheBackground());
+    ASSERT_EQ(stoppedLoads, loads.load());
+
+    InitRefreshingCredentialsCaches();
+    first.GetCredentials();
+    ASSERT_TRUE(first.IsRefreshingInTheBackground());
+}
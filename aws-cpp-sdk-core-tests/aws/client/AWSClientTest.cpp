@@ -12,13 +12,20 @@
 #include <aws/core/Globals.h>
 #include <aws/testing/mocks/http/MockHttpClient.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/client/RequestCompression.h>
+#include <aws/core/AmazonSerializableWebServiceRequest.h>
 #include <aws/testing/mocks/aws/client/MockAWSClient.h>
 #include <aws/testing/platform/PlatformTesting.h>
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <algorithm>
+#include <condition_variable>
 #include <fstream>
+#include <future>
 #include <thread>
 
 using namespace Aws;
@@ -42,6 +49,11 @@ public:
     {
     }
 
+    AccessViolatingAWSClient(const ClientConfiguration& configuration) : AWSClient(
+        configuration, std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>(), nullptr)
+    {
+    }
+
     void InvokeBuildHttpRequest(const AmazonWebServiceRequest& request,
         const std::shared_ptr<HttpRequest>& httpRequest) const
     {
@@ -65,6 +77,11 @@ protected:
     Aws::UniquePtr<MockAWSClient> client;
 
     void SetUp()
+    {
+        SetUpClient(Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG));
+    }
+
+    void SetUpClient(const std::shared_ptr<MockHttpClient>& httpClient)
     {
         ClientConfiguration config;
         config.scheme = Scheme::HTTP;
@@ -73,7 +90,7 @@ protected:
         auto countedRetryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
         config.retryStrategy = std::static_pointer_cast<DefaultRetryStrategy>(countedRetryStrategy);
 
-        mockHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+        mockHttpClient = httpClient;
         mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
         mockHttpClientFactory->SetClient(mockHttpClient);
         SetHttpClientFactory(mockHttpClientFactory);
@@ -344,6 +361,315 @@ TEST_F(AWSClientTestSuite, TestRetryURIs)
     ASSERT_EQ(uri, requests[1].GetUri());
 }
 
+// Counts the bytes read out of the body, to tell how many times it has been hashed.
+class CountingStringBuf : public std::stringbuf
+{
+public:
+    CountingStringBuf(const std::string& content) : std::stringbuf(content), m_bytesRead(0) {}
+
+    size_t GetBytesRead() const { return m_bytesRead; }
+
+protected:
+    std::streamsize xsgetn(char* s, std::streamsize n) override
+    {
+        std::streamsize read = std::stringbuf::xsgetn(s, n);
+        m_bytesRead += static_cast<size_t>(read);
+        return read;
+    }
+
+private:
+    size_t m_bytesRead;
+};
+
+TEST_F(AWSClientTestSuite, TestRetryReusesMarshalledRequest)
+{
+    HeaderValueCollection responseHeaders;
+    responseHeaders.emplace("Date", (DateTime::Now() + std::chrono::hours(1)).ToGmtString(DateFormat::RFC822)); // server is ahead of us by 1 hour
+    QueueMockResponse(HttpResponseCode::INTERNAL_SERVER_ERROR, responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+    const std::string payload = "Some payload that is hashed once for the md5, and once for the signature.";
+    CountingStringBuf bodyBuf(payload);
+    AmazonWebServiceRequestMock request;
+    request.SetBody(Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, &bodyBuf));
+    request.SetComputeContentMd5(true);
+    request.SetHeaders(HeaderValueCollection{std::make_pair("x-amz-custom", "value")});
+    auto outcome = client->MakeRequest(request);
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1, client->GetRequestAttemptedRetries());
+
+    const auto& requests = mockHttpClient->GetAllRequestsMade();
+    ASSERT_EQ(2u, requests.size());
+    for (const char* header : { CONTENT_LENGTH_HEADER, CONTENT_MD5_HEADER, "x-amz-content-sha256", "x-amz-custom", HOST_HEADER })
+    {
+        ASSERT_FALSE(requests[0].GetHeaderValue(header).empty());
+        ASSERT_EQ(requests[0].GetHeaderValue(header), requests[1].GetHeaderValue(header));
+    }
+    ASSERT_EQ(requests[0].GetUri(), requests[1].GetUri());
+
+    // The retry is signed again, without signing the authorization header of the first attempt.
+    ASSERT_NE(requests[0].GetAwsAuthorization(), requests[1].GetAwsAuthorization());
+    ASSERT_EQ(Aws::String::npos, requests[1].GetAwsAuthorization().find("authorization"));
+    ASSERT_STREQ("2", ExtractFromRequestInfo(requests[1].GetHeaderValue(SDK_REQUEST_HEADER), "attempt").c_str());
+
+    // The body was only read to compute the md5 and the payload hash of the first attempt.
+    ASSERT_EQ(2 * payload.size(), bodyBuf.GetBytesRead());
+}
+
+// Reads the whole body of each request it's given, as a real http client sends it.
+class BodyReadingMockHttpClient : public MockHttpClient
+{
+public:
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        Aws::StringStream body;
+        if (request->GetContentBody())
+        {
+            body << request->GetContentBody()->rdbuf();
+        }
+        m_bodiesSent.push_back(body.str());
+        return MockHttpClient::MakeRequest(request, readLimiter, writeLimiter);
+    }
+
+    const Aws::Vector<Aws::String>& GetAllBodiesSent() const { return m_bodiesSent; }
+
+private:
+    mutable Aws::Vector<Aws::String> m_bodiesSent;
+};
+
+class AWSClientBodyReadingTestSuite : public AWSClientTestSuite
+{
+protected:
+    std::shared_ptr<BodyReadingMockHttpClient> bodyReadingHttpClient;
+
+    void SetUp()
+    {
+        bodyReadingHttpClient = Aws::MakeShared<BodyReadingMockHttpClient>(ALLOCATION_TAG);
+        SetUpClient(bodyReadingHttpClient);
+    }
+
+    void TearDown()
+    {
+        bodyReadingHttpClient = nullptr;
+        AWSClientTestSuite::TearDown();
+    }
+};
+
+// GetBody serializes the payload into a new stream on every call.
+class AmazonSerializableWebServiceRequestMock : public AmazonSerializableWebServiceRequest
+{
+public:
+    AmazonSerializableWebServiceRequestMock(const Aws::String& payload) : m_payload(payload) { }
+    Aws::String SerializePayload() const override { return m_payload; }
+    Aws::Http::HeaderValueCollection GetHeaders() const override { return Aws::Http::HeaderValueCollection(); }
+    virtual const char* GetServiceRequestName() const override { return "AmazonSerializableWebServiceRequestMock"; }
+
+private:
+    Aws::String m_payload;
+};
+
+TEST_F(AWSClientBodyReadingTestSuite, TestRetrySendsSerializedPayloadAgain)
+{
+    HeaderValueCollection responseHeaders;
+    responseHeaders.emplace("Date", (DateTime::Now() + std::chrono::hours(1)).ToGmtString(DateFormat::RFC822)); // server is ahead of us by 1 hour
+    QueueMockResponse(HttpResponseCode::INTERNAL_SERVER_ERROR, responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+    const Aws::String payload = "{\"Key\":\"A serialized payload sent on every attempt\"}";
+    AmazonSerializableWebServiceRequestMock request(payload);
+    auto outcome = client->MakeRequest(request);
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1, client->GetRequestAttemptedRetries());
+
+    const auto& bodies = bodyReadingHttpClient->GetAllBodiesSent();
+    ASSERT_EQ(2u, bodies.size());
+    ASSERT_EQ(payload, bodies[0]);
+    ASSERT_EQ(payload, bodies[1]);
+}
+
+// Sends each request from a thread of its own and calls back from there, as the event loop of an asynchronous http client does.
+class AsyncMockHttpClient : public MockHttpClient
+{
+public:
+    ~AsyncMockHttpClient()
+    {
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    bool SupportsAsyncRequests() const override { return true; }
+
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+        const HttpResponseReceivedHandler& handler,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_threads.emplace_back([this, request, handler, readLimiter, writeLimiter]()
+        {
+            auto response = MakeRequest(request, readLimiter, writeLimiter);
+            {
+                std::lock_guard<std::mutex> threadIdsLocker(m_lock);
+                m_threadIds.push_back(std::this_thread::get_id());
+            }
+            handler(request, response);
+        });
+    }
+
+    // Keeps the callback until the test calls it, as if the event loop was still waiting for the delay to elapse.
+    void ScheduleAfter(std::chrono::milliseconds delay, const std::function<void()>& callback) override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_scheduledDelays.push_back(delay);
+        m_scheduledCallbacks.push_back(callback);
+        m_scheduledSignal.notify_all();
+    }
+
+    Aws::Vector<std::thread::id> GetThreadIds() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_threadIds;
+    }
+
+    Aws::Vector<std::chrono::milliseconds> GetScheduledDelays() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_scheduledDelays;
+    }
+
+    // Waits for the next callback passed to ScheduleAfter, returns an empty function if none comes within a few seconds.
+    std::function<void()> WaitForScheduledCallback()
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        if (!m_scheduledSignal.wait_for(locker, std::chrono::seconds(5), [this] { return !m_scheduledCallbacks.empty(); }))
+        {
+            return nullptr;
+        }
+        auto callback = m_scheduledCallbacks.front();
+        m_scheduledCallbacks.erase(m_scheduledCallbacks.begin());
+        return callback;
+    }
+
+private:
+    mutable std::mutex m_lock;
+    mutable Aws::Vector<std::thread> m_threads;
+    mutable Aws::Vector<std::thread::id> m_threadIds;
+    std::condition_variable m_scheduledSignal;
+    Aws::Vector<std::chrono::milliseconds> m_scheduledDelays;
+    Aws::Vector<std::function<void()>> m_scheduledCallbacks;
+};
+
+class AWSClientAsyncTestSuite : public AWSClientTestSuite
+{
+protected:
+    std::shared_ptr<AsyncMockHttpClient> asyncHttpClient;
+
+    void SetUp()
+    {
+        asyncHttpClient = Aws::MakeShared<AsyncMockHttpClient>(ALLOCATION_TAG);
+        SetUpClient(asyncHttpClient);
+    }
+
+    void TearDown()
+    {
+        asyncHttpClient = nullptr;
+        AWSClientTestSuite::TearDown();
+    }
+};
+
+TEST_F(AWSClientAsyncTestSuite, TestAsyncRequestIsRetriedAndCompletedOnExecutor)
+{
+    HeaderValueCollection responseHeaders;
+    responseHeaders.emplace("Date", (DateTime::Now() + std::chrono::hours(1)).ToGmtString(DateFormat::RFC822)); // server is ahead of us by 1 hour
+    QueueMockResponse(HttpResponseCode::INTERNAL_SERVER_ERROR, responseHeaders);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    std::promise<std::thread::id> handlerThread;
+    std::promise<HttpResponseOutcome> outcomePromise;
+    client->MakeRequestAsync(Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG), executor, [&](HttpResponseOutcome&& outcome)
+    {
+        handlerThread.set_value(std::this_thread::get_id());
+        outcomePromise.set_value(std::move(outcome));
+    });
+    auto outcome = outcomePromise.get_future().get();
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1, client->GetRequestAttemptedRetries());
+
+    // Both attempts went through MakeRequestAsync, the outcome was handed over from the event loop to the executor.
+    auto threadIds = asyncHttpClient->GetThreadIds();
+    ASSERT_EQ(2u, threadIds.size());
+    auto handlerThreadId = handlerThread.get_future().get();
+    ASSERT_NE(std::this_thread::get_id(), handlerThreadId);
+    ASSERT_TRUE(std::find(threadIds.begin(), threadIds.end(), handlerThreadId) == threadIds.end());
+    ASSERT_EQ(2u, asyncHttpClient->GetAllRequestsMade().size());
+}
+
+// MockAWSClient never builds retryable errors, this one retries them anyway.
+class RetryAnyErrorStrategy : public CountedRetryStrategy
+{
+public:
+    bool ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override
+    {
+        return CountedRetryStrategy::ShouldRetry(AWSError<CoreErrors>(error.GetErrorType(), true/*retryable*/), attemptedRetries);
+    }
+};
+
+TEST_F(AWSClientAsyncTestSuite, TestAsyncRetryDelayDoesNotBlockTheExecutor)
+{
+    ClientConfiguration config;
+    config.scheme = Scheme::HTTP;
+    config.retryStrategy = Aws::MakeShared<RetryAnyErrorStrategy>(ALLOCATION_TAG);
+    MockAWSClient retryingClient(config);
+
+    QueueMockResponse(HttpResponseCode::INTERNAL_SERVER_ERROR, HeaderValueCollection());
+    QueueMockResponse(HttpResponseCode::INTERNAL_SERVER_ERROR, HeaderValueCollection());
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    std::promise<HttpResponseOutcome> outcomePromise;
+    retryingClient.MakeRequestAsync(Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG), executor, [&](HttpResponseOutcome&& outcome)
+    {
+        outcomePromise.set_value(std::move(outcome));
+    });
+
+    // The first retry is immediate, the second one waits on the http client rather than on the only executor thread.
+    auto retry = asyncHttpClient->WaitForScheduledCallback();
+    ASSERT_TRUE(retry);
+    std::promise<void> executorIsFree;
+    executor->Submit([&executorIsFree] { executorIsFree.set_value(); });
+    ASSERT_EQ(std::future_status::ready, executorIsFree.get_future().wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ(2u, asyncHttpClient->GetAllRequestsMade().size());
+
+    retry();
+    auto outcome = outcomePromise.get_future().get();
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(2, retryingClient.GetRequestAttemptedRetries());
+    ASSERT_EQ(3u, asyncHttpClient->GetAllRequestsMade().size());
+    auto delays = asyncHttpClient->GetScheduledDelays();
+    ASSERT_EQ(1u, delays.size());
+    ASSERT_EQ(std::chrono::milliseconds(50), delays[0]);
+}
+
+TEST_F(AWSClientTestSuite, TestAsyncRequestRunsOnExecutorWithBlockingHttpClient)
+{
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    std::promise<HttpResponseOutcome> outcomePromise;
+    client->MakeRequestAsync(Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG), executor, [&](HttpResponseOutcome&& outcome)
+    {
+        outcomePromise.set_value(std::move(outcome));
+    });
+    auto outcome = outcomePromise.get_future().get();
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
 TEST_F(AWSClientTestSuite, TestStandardRetryStrategy)
 {
     ClientConfiguration config;
@@ -499,6 +825,149 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
     ASSERT_EQ(contentLengthExpected.str(), finalHeaders[Http::CONTENT_LENGTH_HEADER]);
 }
 
+class CompressedAmazonWebServiceRequestMock : public AmazonWebServiceRequestMock
+{
+public:
+    CompressionAlgorithm GetDefaultRequestCompressionAlgorithm() const override { return CompressionAlgorithm::GZIP; }
+};
+
+static std::shared_ptr<Aws::StringStream> MakeCompressibleBody(size_t size)
+{
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    for (size_t i = 0; i < size; ++i)
+    {
+        *body << static_cast<char>('a' + (i / 7) % 26);
+    }
+    return body;
+}
+
+TEST(AWSClientTest, TestBuildHttpRequestWithCompressedBody)
+{
+    if (!RequestCompression::IsAlgorithmAvailable(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    CompressedAmazonWebServiceRequestMock amazonWebServiceRequest;
+    ASSERT_EQ(CompressionAlgorithm::GZIP, amazonWebServiceRequest.GetRequestCompressionAlgorithm());
+    auto body = MakeCompressibleBody(64 * 1024);
+    amazonWebServiceRequest.SetBody(body);
+
+    ClientConfiguration config;
+    config.requestCompressionConfig.requestMinCompressionSizeBytes = 1024;
+    AccessViolatingAWSClient awsClient(config);
+
+    URI uri("http://www.uri.com");
+    auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_POST);
+    awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+
+    ASSERT_EQ("gzip", httpRequest->GetHeaderValue(Http::CONTENT_ENCODING_HEADER));
+    ASSERT_TRUE(httpRequest->HasHeader(Http::CONTENT_LENGTH_HEADER));
+    auto compressedBody = httpRequest->GetContentBody();
+    ASSERT_NE(body, compressedBody);
+    Aws::StringStream compressedContent;
+    compressedContent << compressedBody->rdbuf();
+    ASSERT_LT(compressedContent.str().size(), body->str().size());
+    ASSERT_EQ(Utils::StringUtils::to_string(compressedContent.str().size()), httpRequest->GetHeaderValue(Http::CONTENT_LENGTH_HEADER));
+    ASSERT_EQ('\x1f', compressedContent.str()[0]);
+    ASSERT_EQ('\x8b', compressedContent.str()[1]);
+
+    // An encoding set by the caller is kept, gzip is applied after it.
+    HeaderValueCollection headerValues;
+    headerValues[Http::CONTENT_ENCODING_HEADER] = "custom";
+    amazonWebServiceRequest.SetHeaders(headerValues);
+    httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_POST);
+    awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+    ASSERT_EQ("custom,gzip", httpRequest->GetHeaderValue(Http::CONTENT_ENCODING_HEADER));
+}
+
+// Compressed as it is sent, with transfer-encoding:chunked.
+class ChunkedCompressedAmazonWebServiceRequestMock : public CompressedAmazonWebServiceRequestMock
+{
+public:
+    bool IsStreaming() const override { return true; }
+    bool IsChunked() const override { return true; }
+};
+
+TEST_F(AWSClientBodyReadingTestSuite, TestRetrySendsCompressedBodyAgain)
+{
+    if (!RequestCompression::IsAlgorithmAvailable(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    auto body = MakeCompressibleBody(64 * 1024);
+    CompressedAmazonWebServiceRequestMock compressedRequest;
+    compressedRequest.SetBody(body);
+    ChunkedCompressedAmazonWebServiceRequestMock chunkedRequest;
+    chunkedRequest.SetBody(body);
+
+    // The server is an hour further ahead of us on each request, for the first attempt to fail with a clock skew.
+    int hoursAhead = 0;
+    for (const AmazonWebServiceRequest* request : { static_cast<const AmazonWebServiceRequest*>(&compressedRequest),
+        static_cast<const AmazonWebServiceRequest*>(&chunkedRequest) })
+    {
+        size_t bodiesSentBefore = bodyReadingHttpClient->GetAllBodiesSent().size();
+        HeaderValueCollection responseHeaders;
+        responseHeaders.emplace("Date", (DateTime::Now() + std::chrono::hours(++hoursAhead)).ToGmtString(DateFormat::RFC822));
+        QueueMockResponse(HttpResponseCode::INTERNAL_SERVER_ERROR, responseHeaders);
+        QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+
+        auto outcome = client->MakeRequest(*request);
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ(1, client->GetRequestAttemptedRetries());
+        ASSERT_EQ("gzip", bodyReadingHttpClient->GetMostRecentHttpRequest().GetHeaderValue(Http::CONTENT_ENCODING_HEADER));
+
+        // The retry sends the whole compressed body again, not what the first attempt left of it.
+        const auto& bodies = bodyReadingHttpClient->GetAllBodiesSent();
+        ASSERT_EQ(2u + bodiesSentBefore, bodies.size());
+        ASSERT_LT(0u, bodies[bodiesSentBefore].size());
+        ASSERT_LT(bodies[bodiesSentBefore].size(), body->str().size());
+        ASSERT_EQ('\x1f', bodies[bodiesSentBefore][0]);
+        ASSERT_EQ('\x8b', bodies[bodiesSentBefore][1]);
+        ASSERT_EQ(bodies[bodiesSentBefore], bodies[bodiesSentBefore + 1]);
+    }
+}
+
+TEST(AWSClientTest, TestBuildHttpRequestWithUncompressedBody)
+{
+    ClientConfiguration config;
+    config.requestCompressionConfig.requestMinCompressionSizeBytes = 1024;
+    AccessViolatingAWSClient awsClient(config);
+    URI uri("http://www.uri.com");
+
+    // Bodies below the threshold are sent as is.
+    CompressedAmazonWebServiceRequestMock smallRequest;
+    auto smallBody = MakeCompressibleBody(512);
+    smallRequest.SetBody(smallBody);
+    auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_POST);
+    awsClient.InvokeBuildHttpRequest(smallRequest, httpRequest);
+    ASSERT_FALSE(httpRequest->HasHeader(Http::CONTENT_ENCODING_HEADER));
+    ASSERT_EQ(smallBody, httpRequest->GetContentBody());
+    ASSERT_EQ("512", httpRequest->GetHeaderValue(Http::CONTENT_LENGTH_HEADER));
+
+    // So are the bodies of requests that opted out.
+    CompressedAmazonWebServiceRequestMock optedOutRequest;
+    optedOutRequest.SetRequestCompressionAlgorithm(CompressionAlgorithm::NONE);
+    auto largeBody = MakeCompressibleBody(4096);
+    optedOutRequest.SetBody(largeBody);
+    httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_POST);
+    awsClient.InvokeBuildHttpRequest(optedOutRequest, httpRequest);
+    ASSERT_FALSE(httpRequest->HasHeader(Http::CONTENT_ENCODING_HEADER));
+    ASSERT_EQ(largeBody, httpRequest->GetContentBody());
+
+    // And all bodies when the client disabled compression.
+    config.requestCompressionConfig.enableRequestCompression = false;
+    AccessViolatingAWSClient disabledClient(config);
+    CompressedAmazonWebServiceRequestMock largeRequest;
+    largeRequest.SetBody(largeBody);
+    httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_POST);
+    disabledClient.InvokeBuildHttpRequest(largeRequest, httpRequest);
+    ASSERT_FALSE(httpRequest->HasHeader(Http::CONTENT_ENCODING_HEADER));
+    ASSERT_EQ(largeBody, httpRequest->GetContentBody());
+    ASSERT_EQ("4096", httpRequest->GetHeaderValue(Http::CONTENT_LENGTH_HEADER));
+}
+
 TEST(AWSClientTest, TestHostHeaderWithNonStandardHttpPort)
 {
     Standard::StandardHttpRequest r1("http://example.amazonaws.com:8080", HttpMethod::HTTP_GET);
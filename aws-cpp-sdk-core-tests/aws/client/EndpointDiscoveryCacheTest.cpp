@@ -0,0 +1,165 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/EndpointDiscoveryCache.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Client;
+
+static const char ALLOCATION_TAG[] = "EndpointDiscoveryCacheTest";
+
+TEST(EndpointDiscoveryCacheTest, TestConcurrentMissesShareOneDiscovery)
+{
+    EndpointDiscoveryCache cache;
+    std::atomic<int> discoveries(0);
+    auto discover = [&discoveries](Aws::String& endpoint, std::chrono::milliseconds& cachePeriod)
+    {
+        discoveries++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        endpoint = "https://discovered.example.com";
+        cachePeriod = std::chrono::minutes(10);
+        return true;
+    };
+
+    Aws::Vector<std::thread> threads;
+    Aws::Vector<std::shared_ptr<const Aws::Http::URI>> endpoints(16);
+    for (size_t i = 0; i < endpoints.size(); ++i)
+    {
+        threads.emplace_back([&, i]() { endpoints[i] = cache.GetEndpoint("Shared", discover); });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(1, discoveries.load());
+    for (const auto& endpoint : endpoints)
+    {
+        ASSERT_TRUE(endpoint);
+        ASSERT_EQ(endpoints[0], endpoint);
+        ASSERT_STREQ("discovered.example.com", endpoint->GetAuthority().c_str());
+    }
+
+    // Hits return the parsed endpoint without discovering again.
+    ASSERT_EQ(endpoints[0], cache.GetEndpoint("Shared", discover));
+    ASSERT_EQ(1, discoveries.load());
+}
+
+TEST(EndpointDiscoveryCacheTest, TestFailedDiscoveryIsNotCached)
+{
+    EndpointDiscoveryCache cache;
+    int discoveries = 0;
+    bool succeed = false;
+    auto discover = [&](Aws::String& endpoint, std::chrono::milliseconds& cachePeriod)
+    {
+        discoveries++;
+        endpoint = "https://discovered.example.com";
+        cachePeriod = std::chrono::minutes(10);
+        return succeed;
+    };
+
+    ASSERT_FALSE(cache.GetEndpoint("Shared", discover));
+    succeed = true;
+    ASSERT_TRUE(cache.GetEndpoint("Shared", discover));
+    ASSERT_EQ(2, discoveries);
+}
+
+TEST(EndpointDiscoveryCacheTest, TestKeysAreCachedSeparately)
+{
+    EndpointDiscoveryCache cache;
+    auto discoverFor = [](const char* host)
+    {
+        return [host](Aws::String& endpoint, std::chrono::milliseconds& cachePeriod)
+        {
+            endpoint = Aws::String("https://") + host;
+            cachePeriod = std::chrono::minutes(10);
+            return true;
+        };
+    };
+
+    ASSERT_STREQ("first.example.com", cache.GetEndpoint("First", discoverFor("first.example.com"))->GetAuthority().c_str());
+    ASSERT_STREQ("second.example.com", cache.GetEndpoint("Second", discoverFor("second.example.com"))->GetAuthority().c_str());
+    ASSERT_STREQ("first.example.com", cache.GetEndpoint("First", discoverFor("other.example.com"))->GetAuthority().c_str());
+}
+
+TEST(EndpointDiscoveryCacheTest, TestEntriesAreRefreshedInTheBackground)
+{
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(ALLOCATION_TAG);
+    EndpointDiscoveryCache cache;
+    cache.SetExecutor(executor);
+
+    std::atomic<int> discoveries(0);
+    auto discover = [&discoveries](Aws::String& endpoint, std::chrono::milliseconds& cachePeriod)
+    {
+        int discovery = ++discoveries;
+        if (discovery > 1)
+        {
+            // Lookups must not wait on the refresh.
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+        endpoint = discovery == 1 ? "https://first.example.com" : "https://refreshed.example.com";
+        cachePeriod = std::chrono::milliseconds(2000);
+        return true;
+    };
+
+    auto first = cache.GetEndpoint("Shared", discover);
+    ASSERT_STREQ("first.example.com", first->GetAuthority().c_str());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1600));
+    ASSERT_EQ(first, cache.GetEndpoint("Shared", discover));
+    ASSERT_EQ(first, cache.GetEndpoint("Shared", discover));
+
+    std::shared_ptr<const Aws::Http::URI> refreshed;
+    for (int i = 0; i < 100; ++i)
+    {
+        refreshed = cache.GetEndpoint("Shared", discover);
+        if (refreshed != first)
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_STREQ("refreshed.example.com", refreshed->GetAuthority().c_str());
+    ASSERT_EQ(2, discoveries.load());
+}
+
+TEST(EndpointDiscoveryCacheTest, TestFailedRefreshesBackOff)
+{
+    EndpointDiscoveryCache cache;
+
+    std::atomic<int> discoveries(0);
+    auto discover = [&discoveries](Aws::String& endpoint, std::chrono::milliseconds& cachePeriod)
+    {
+        if (++discoveries > 1)
+        {
+            return false;
+        }
+        endpoint = "https://first.example.com";
+        cachePeriod = std::chrono::milliseconds(800);
+        return true;
+    };
+
+    auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(800);
+    auto first = cache.GetEndpoint("Shared", discover);
+    ASSERT_STREQ("first.example.com", first->GetAuthority().c_str());
+
+    // Looks up every millisecond from the first refresh until shortly before the entry expires.
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    while (std::chrono::steady_clock::now() < expiry - std::chrono::milliseconds(50))
+    {
+        ASSERT_EQ(first, cache.GetEndpoint("Shared", discover));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Each failure halves the time left before expiry instead of letting the next lookup retry right away.
+    ASSERT_LT(1, discoveries.load());
+    ASSERT_GT(10, discoveries.load());
+}
@@ -0,0 +1,226 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/Paginator.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Client;
+
+static const char ALLOCATION_TAG[] = "PaginatorTest";
+
+namespace
+{
+    struct ListRequest
+    {
+        int partition;
+        int page;
+    };
+
+    struct ListResult
+    {
+        int partition;
+        int page;
+        bool isTruncated;
+    };
+
+    typedef Paginator<ListRequest, ListResult, AWSError<CoreErrors>> ListPaginator;
+
+    /**
+     * Lists pageCount pages per partition, failing on failPage of partition 0 if it is set.
+     */
+    struct FakeService
+    {
+        FakeService(int pages, std::chrono::milliseconds delay) : pageCount(pages), latency(delay), failPage(-1), fetches(0), inFlight(0), maxInFlight(0) {}
+
+        ListPaginator::FetchPageFunction Fetch()
+        {
+            return [this](const ListRequest& request) -> ListPaginator::OutcomeType
+            {
+                fetches++;
+                int current = ++inFlight;
+                int observed = maxInFlight.load();
+                while (current > observed && !maxInFlight.compare_exchange_weak(observed, current));
+                std::this_thread::sleep_for(latency);
+                inFlight--;
+                if (request.partition == 0 && request.page == failPage)
+                {
+                    return AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, "InternalFailure", "Failed", false);
+                }
+                ListResult result = { request.partition, request.page, request.page + 1 < pageCount };
+                return result;
+            };
+        }
+
+        static ListPaginator::NextPageFunction Next()
+        {
+            return [](const ListResult& result, ListRequest& request)
+            {
+                request.page = result.page + 1;
+                return result.isTruncated;
+            };
+        }
+
+        int pageCount;
+        std::chrono::milliseconds latency;
+        int failPage;
+        std::atomic<int> fetches;
+        std::atomic<int> inFlight;
+        std::atomic<int> maxInFlight;
+    };
+}
+
+TEST(PaginatorTest, TestPagesAreFetchedLazilyWithoutExecutor)
+{
+    FakeService service(3, std::chrono::milliseconds(0));
+    ListRequest request = { 0, 0 };
+    ListPaginator paginator(request, service.Fetch(), FakeService::Next(), nullptr);
+    ASSERT_EQ(0, service.fetches.load());
+
+    int expectedPage = 0;
+    for (const auto& page : paginator)
+    {
+        ASSERT_TRUE(page.IsSuccess());
+        ASSERT_EQ(expectedPage, page.GetResult().page);
+        ASSERT_EQ(expectedPage + 1, service.fetches.load());
+        expectedPage++;
+    }
+    ASSERT_EQ(3, expectedPage);
+    ASSERT_EQ(3, service.fetches.load());
+}
+
+TEST(PaginatorTest, TestNextPageIsPrefetchedWhileTheCurrentOneIsProcessed)
+{
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(ALLOCATION_TAG);
+    FakeService service(5, std::chrono::milliseconds(100));
+    ListRequest request = { 0, 0 };
+
+    auto start = std::chrono::steady_clock::now();
+    int pages = 0;
+    {
+        ListPaginator paginator(request, service.Fetch(), FakeService::Next(), executor, 1);
+        for (const auto& page : paginator)
+        {
+            ASSERT_TRUE(page.IsSuccess());
+            ASSERT_EQ(pages++, page.GetResult().page);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            // The depth bounds how far the fetches run ahead: the page being processed, one waiting and one in flight.
+            ASSERT_LE(service.fetches.load(), pages + 2);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    ASSERT_EQ(5, pages);
+    // Fetching and processing 5 pages one after the other takes 1000ms, overlapped it takes about 600ms.
+    ASSERT_LT(elapsed.count(), 900);
+}
+
+TEST(PaginatorTest, TestPartitionsAreFetchedConcurrentlyAndIteratedInOrder)
+{
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(ALLOCATION_TAG);
+    FakeService service(2, std::chrono::milliseconds(100));
+    Aws::Vector<ListRequest> requests;
+    for (int partition = 0; partition < 4; ++partition)
+    {
+        ListRequest request = { partition, 0 };
+        requests.push_back(request);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ListPaginator paginator(requests, service.Fetch(), FakeService::Next(), executor, 2);
+    Aws::Vector<std::pair<int, int>> pages;
+    for (const auto& page : paginator)
+    {
+        ASSERT_TRUE(page.IsSuccess());
+        pages.emplace_back(page.GetResult().partition, page.GetResult().page);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    ASSERT_EQ(8u, pages.size());
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+        ASSERT_EQ(static_cast<int>(i / 2), pages[i].first);
+        ASSERT_EQ(static_cast<int>(i % 2), pages[i].second);
+    }
+    // One partition after the other would take 800ms.
+    ASSERT_LT(elapsed.count(), 600);
+}
+
+TEST(PaginatorTest, TestPartitionsInFlightAreCapped)
+{
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(ALLOCATION_TAG);
+    FakeService service(2, std::chrono::milliseconds(20));
+    Aws::Vector<ListRequest> requests;
+    for (int partition = 0; partition < 6; ++partition)
+    {
+        ListRequest request = { partition, 0 };
+        requests.push_back(request);
+    }
+
+    ListPaginator paginator(requests, service.Fetch(), FakeService::Next(), executor, 2, 2);
+    Aws::Vector<std::pair<int, int>> pages;
+    for (const auto& page : paginator)
+    {
+        ASSERT_TRUE(page.IsSuccess());
+        pages.emplace_back(page.GetResult().partition, page.GetResult().page);
+    }
+
+    ASSERT_EQ(12u, pages.size());
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+        ASSERT_EQ(static_cast<int>(i / 2), pages[i].first);
+        ASSERT_EQ(static_cast<int>(i % 2), pages[i].second);
+    }
+    ASSERT_LE(service.maxInFlight.load(), 2);
+}
+
+TEST(PaginatorTest, TestErrorIsTheLastPage)
+{
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(ALLOCATION_TAG);
+    FakeService service(5, std::chrono::milliseconds(0));
+    service.failPage = 1;
+    Aws::Vector<ListRequest> requests;
+    for (int partition = 0; partition < 2; ++partition)
+    {
+        ListRequest request = { partition, 0 };
+        requests.push_back(request);
+    }
+
+    ListPaginator paginator(requests, service.Fetch(), FakeService::Next(), executor);
+    Aws::Vector<bool> outcomes;
+    for (const auto& page : paginator)
+    {
+        outcomes.push_back(page.IsSuccess());
+    }
+
+    ASSERT_EQ(2u, outcomes.size());
+    ASSERT_TRUE(outcomes[0]);
+    ASSERT_FALSE(outcomes[1]);
+}
+
+TEST(PaginatorTest, TestDestructionWaitsForFetchesInFlight)
+{
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(ALLOCATION_TAG);
+    auto service = Aws::MakeShared<FakeService>(ALLOCATION_TAG, 100, std::chrono::milliseconds(50));
+    {
+        ListRequest request = { 0, 0 };
+        ListPaginator paginator(request, service->Fetch(), FakeService::Next(), executor, 4);
+        auto page = paginator.begin();
+        ASSERT_TRUE(page->IsSuccess());
+    }
+    int fetches = service->fetches.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    // Nothing runs after the paginator is gone, so the service could safely be destroyed.
+    ASSERT_EQ(fetches, service->fetches.load());
+    ASSERT_LE(fetches, 6);
+}
@@ -0,0 +1,98 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/RequestCompression.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Client;
+
+static const char ALLOCATION_TAG[] = "RequestCompressionTest";
+
+namespace
+{
+    std::shared_ptr<Aws::IOStream> MakeBody(size_t size)
+    {
+        auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        for (size_t i = 0; i < size; ++i)
+        {
+            *body << static_cast<char>('a' + (i / 7) % 26);
+        }
+        return body;
+    }
+
+    Aws::String ReadAll(Aws::IOStream& stream)
+    {
+        Aws::StringStream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+}
+
+TEST(RequestCompressionTest, TestContentEncodings)
+{
+    ASSERT_STREQ("gzip", RequestCompression::GetContentEncoding(CompressionAlgorithm::GZIP));
+    ASSERT_STREQ("zstd", RequestCompression::GetContentEncoding(CompressionAlgorithm::ZSTD));
+    ASSERT_STREQ("", RequestCompression::GetContentEncoding(CompressionAlgorithm::NONE));
+    ASSERT_FALSE(RequestCompression::IsAlgorithmAvailable(CompressionAlgorithm::NONE));
+    ASSERT_EQ(nullptr, RequestCompression::Compress(CompressionAlgorithm::NONE, MakeBody(16)));
+    ASSERT_EQ(nullptr, RequestCompression::CreateCompressingStream(CompressionAlgorithm::NONE, MakeBody(16)));
+}
+
+TEST(RequestCompressionTest, TestGzipCompress)
+{
+    if (!RequestCompression::IsAlgorithmAvailable(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    auto body = MakeBody(200000);
+    auto compressed = RequestCompression::Compress(CompressionAlgorithm::GZIP, body);
+    ASSERT_NE(nullptr, compressed);
+
+    Aws::String content = ReadAll(*compressed);
+    ASSERT_GT(content.size(), 2u);
+    ASSERT_LT(content.size(), 200000u / 10);
+    ASSERT_EQ('\x1f', content[0]);
+    ASSERT_EQ('\x8b', content[1]);
+}
+
+TEST(RequestCompressionTest, TestCompressingStreamMatchesCompress)
+{
+    if (!RequestCompression::IsAlgorithmAvailable(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    auto body = MakeBody(300000);
+    Aws::String expected = ReadAll(*RequestCompression::Compress(CompressionAlgorithm::GZIP, body));
+
+    // Compress read the body to its end, the compressing stream starts it over.
+    auto compressing = RequestCompression::CreateCompressingStream(CompressionAlgorithm::GZIP, body);
+    ASSERT_NE(nullptr, compressing);
+    ASSERT_EQ(expected, ReadAll(*compressing));
+
+    // Rewinding, as a retry does, compresses the body again from its start.
+    compressing->clear();
+    compressing->seekg(0, compressing->beg);
+    ASSERT_TRUE(compressing->good());
+    ASSERT_EQ(0, static_cast<long long>(compressing->tellg()));
+    ASSERT_EQ(expected, ReadAll(*compressing));
+}
+
+TEST(RequestCompressionTest, TestCompressEmptyBody)
+{
+    if (!RequestCompression::IsAlgorithmAvailable(CompressionAlgorithm::GZIP))
+    {
+        return;
+    }
+
+    auto compressed = RequestCompression::Compress(CompressionAlgorithm::GZIP, MakeBody(0));
+    ASSERT_NE(nullptr, compressed);
+    // An empty body still compresses to a gzip header and trailer.
+    ASSERT_FALSE(ReadAll(*compressed).empty());
+}
@@ -8,6 +8,7 @@
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/CoreErrors.h>
 #include <aws/core/client/RetryStrategy.h>
+#include <aws/core/client/AdaptiveRetryStrategy.h>
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/standard/StandardHttpRequest.h>
@@ -15,6 +16,8 @@
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/Outcome.h>
 
+#include <cmath>
+
 using namespace Aws::Client;
 using namespace Aws::Http;
 using namespace Aws::Utils::Threading;
@@ -122,3 +125,186 @@ TEST(RetryStrategyTest, TestStandardRetryStrategy)
     retryStrategy.RequestBookkeeping(httpResponse, requestTimeoutError);
     ASSERT_EQ(500, retryStrategy.GetRetryQuotaContainer()->GetRetryQuota());
 }
+
+class ManualClock
+{
+public:
+    ManualClock() : m_millis(1600000000000) {}
+
+    RetryTokenBucket::Clock GetClock() { return [this] { return Aws::Utils::DateTime(m_millis); }; }
+    void AdvanceMillis(int64_t millis) { m_millis += millis; }
+
+private:
+    int64_t m_millis;
+};
+
+// Reports one response every 100ms, so the measured send rate settles around 10 requests per second.
+static void SendAtTenRequestsPerSecond(RetryTokenBucket& tokenBucket, ManualClock& clock, int requests)
+{
+    for (int i = 0; i < requests; ++i)
+    {
+        clock.AdvanceMillis(100);
+        ASSERT_TRUE(tokenBucket.Acquire(1, true/*fastFail*/) || !tokenBucket.IsEnabled());
+        tokenBucket.UpdateClientSendingRate(false);
+    }
+}
+
+TEST(RetryStrategyTest, TestRetryTokenBucketOnlyLimitsAfterThrottling)
+{
+    ManualClock clock;
+    RetryTokenBucket tokenBucket(clock.GetClock());
+
+    SendAtTenRequestsPerSecond(tokenBucket, clock, 30);
+    ASSERT_FALSE(tokenBucket.IsEnabled());
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(tokenBucket.Acquire(1, true/*fastFail*/));
+    }
+    ASSERT_NEAR(10.0, tokenBucket.GetMeasuredTxRate(), 1.0);
+
+    tokenBucket.UpdateClientSendingRate(true);
+    ASSERT_TRUE(tokenBucket.IsEnabled());
+    // The fill rate drops to 70% of the send rate at which we got throttled.
+    ASSERT_NEAR(7.0, tokenBucket.GetFillRate(), 1.0);
+
+    // Capacity is capped to one second worth of tokens, the rest have to be waited for.
+    clock.AdvanceMillis(2000);
+    int acquired = 0;
+    while (tokenBucket.Acquire(1, true/*fastFail*/))
+    {
+        ++acquired;
+    }
+    ASSERT_EQ(static_cast<int>(tokenBucket.GetFillRate()), acquired);
+    clock.AdvanceMillis(static_cast<int64_t>(1000 / tokenBucket.GetFillRate()) + 1);
+    ASSERT_TRUE(tokenBucket.Acquire(1, true/*fastFail*/));
+}
+
+TEST(RetryStrategyTest, TestRetryTokenBucketRecoversAlongCubicCurve)
+{
+    ManualClock clock;
+    RetryTokenBucket tokenBucket(clock.GetClock());
+
+    SendAtTenRequestsPerSecond(tokenBucket, clock, 30);
+    tokenBucket.UpdateClientSendingRate(true);
+    double throttledRate = tokenBucket.GetFillRate();
+
+    // Successful responses grow the rate back, slowly while close to the rate that got throttled.
+    SendAtTenRequestsPerSecond(tokenBucket, clock, 10);
+    double recoveringRate = tokenBucket.GetFillRate();
+    ASSERT_GT(recoveringRate, throttledRate);
+    ASSERT_LT(recoveringRate, 10.0);
+
+    SendAtTenRequestsPerSecond(tokenBucket, clock, 30);
+    ASSERT_GT(tokenBucket.GetFillRate(), recoveringRate);
+
+    // Getting throttled again cuts the rate down again.
+    double rateBeforeThrottling = tokenBucket.GetFillRate();
+    tokenBucket.UpdateClientSendingRate(true);
+    ASSERT_LT(tokenBucket.GetFillRate(), rateBeforeThrottling);
+}
+
+TEST(RetryStrategyTest, TestAdaptiveRetryStrategy)
+{
+    ManualClock clock;
+    auto tokenBucket = Aws::MakeShared<RetryTokenBucket>(ALLOCATION_TAG, clock.GetClock());
+    AdaptiveRetryStrategy retryStrategy(tokenBucket, Aws::MakeShared<DefaultRetryQuotaContainer>(ALLOCATION_TAG));
+    ASSERT_EQ(3, retryStrategy.GetMaxAttempts());
+
+    std::shared_ptr<HttpRequest> httpRequest = CreateHttpRequest(URI("http://www.uri.com"), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    std::shared_ptr<HttpResponse> httpResponse = Aws::MakeShared<Standard::StandardHttpResponse>(ALLOCATION_TAG, httpRequest);
+    for (int i = 0; i < 10; ++i)
+    {
+        clock.AdvanceMillis(100);
+        retryStrategy.GetSendToken();
+        retryStrategy.RequestBookkeeping(HttpResponseOutcome(httpResponse));
+    }
+    ASSERT_FALSE(tokenBucket->IsEnabled());
+
+    // Errors that are not throttling don't slow the client down.
+    retryStrategy.RequestBookkeeping(HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true)));
+    ASSERT_FALSE(tokenBucket->IsEnabled());
+
+    AWSError<CoreErrors> throttlingError(CoreErrors::THROTTLING, true);
+    ASSERT_TRUE(retryStrategy.ShouldRetry(throttlingError, 0));
+    retryStrategy.RequestBookkeeping(HttpResponseOutcome(throttlingError));
+    ASSERT_TRUE(tokenBucket->IsEnabled());
+
+    while (retryStrategy.HasSendToken());
+    ASSERT_FALSE(retryStrategy.HasSendToken());
+    clock.AdvanceMillis(2000);
+    ASSERT_TRUE(retryStrategy.HasSendToken());
+
+    // Asynchronous requests take the token on credit and are told how long to wait for the refill, instead of waiting for it.
+    while (retryStrategy.HasSendToken());
+    long waitMillis = retryStrategy.GetSendTokenWithoutWaiting();
+    ASSERT_GT(waitMillis, 0);
+    ASSERT_LE(waitMillis, static_cast<long>(std::ceil(1000 / tokenBucket->GetFillRate())));
+    ASSERT_GT(retryStrategy.GetSendTokenWithoutWaiting(), waitMillis);
+    clock.AdvanceMillis(2000);
+    ASSERT_EQ(0, retryStrategy.GetSendTokenWithoutWaiting());
+}
+
+TEST(RetryStrategyTest, TestAdaptiveRetryStrategySharesTokenBucketPerService)
+{
+    auto dynamoDBStrategy = Aws::MakeShared<AdaptiveRetryStrategy>(ALLOCATION_TAG, "DynamoDB");
+    auto otherDynamoDBStrategy = Aws::MakeShared<AdaptiveRetryStrategy>(ALLOCATION_TAG, "DynamoDB");
+    AdaptiveRetryStrategy kinesisStrategy("Kinesis");
+    AdaptiveRetryStrategy unnamedStrategy;
+
+    ASSERT_EQ(dynamoDBStrategy->GetRetryTokenBucket(), otherDynamoDBStrategy->GetRetryTokenBucket());
+    ASSERT_NE(dynamoDBStrategy->GetRetryTokenBucket(), kinesisStrategy.GetRetryTokenBucket());
+    ASSERT_NE(dynamoDBStrategy->GetRetryTokenBucket(), unnamedStrategy.GetRetryTokenBucket());
+
+    // The bucket lives as long as one of the strategies sharing it.
+    auto tokenBucket = dynamoDBStrategy->GetRetryTokenBucket().get();
+    dynamoDBStrategy = nullptr;
+    ASSERT_EQ(tokenBucket, otherDynamoDBStrategy->GetRetryTokenBucket().get());
+}
+
+TEST(RetryStrategyTest, TestAdaptiveRetryStrategyIsSharedPerServiceAndRegion)
+{
+    // As set on ClientConfiguration by retry_mode=adaptive, each client replaces it with the strategy of its service and region.
+    AdaptiveRetryStrategy configuredStrategy(5);
+    auto dynamoDBStrategy = configuredStrategy.GetStrategyForClient("DynamoDB", "us-east-1");
+    ASSERT_NE(nullptr, dynamoDBStrategy);
+    ASSERT_EQ(5, dynamoDBStrategy->GetMaxAttempts());
+    ASSERT_EQ(dynamoDBStrategy, configuredStrategy.GetStrategyForClient("DynamoDB", "us-east-1"));
+    ASSERT_EQ(dynamoDBStrategy, AdaptiveRetryStrategy::GetSharedStrategy("DynamoDB", "us-east-1", 5));
+    ASSERT_EQ(dynamoDBStrategy, dynamoDBStrategy->GetStrategyForClient("DynamoDB", "us-east-1"));
+
+    auto otherRegionStrategy = configuredStrategy.GetStrategyForClient("DynamoDB", "us-west-2");
+    auto otherServiceStrategy = dynamoDBStrategy->GetStrategyForClient("Kinesis", "us-east-1");
+    ASSERT_NE(dynamoDBStrategy, otherRegionStrategy);
+    ASSERT_NE(dynamoDBStrategy, otherServiceStrategy);
+    ASSERT_EQ(otherServiceStrategy, AdaptiveRetryStrategy::GetSharedStrategy("Kinesis", "us-east-1", 5));
+
+    // Whatever their maximum number of attempts, the strategies of a service and region throttle together.
+    auto moreAttemptsStrategy = AdaptiveRetryStrategy::GetSharedStrategy("DynamoDB", "us-east-1", 10);
+    ASSERT_NE(dynamoDBStrategy, moreAttemptsStrategy);
+    ASSERT_EQ(AdaptiveRetryStrategy::GetSharedStrategy("DynamoDB", "us-east-1", 5)->GetRetryTokenBucket(), moreAttemptsStrategy->GetRetryTokenBucket());
+
+    // Strategies given a service name or a token bucket are used as is.
+    ASSERT_EQ(nullptr, AdaptiveRetryStrategy("DynamoDB").GetStrategyForClient("DynamoDB", "us-east-1"));
+    ASSERT_EQ(nullptr, StandardRetryStrategy().GetStrategyForClient("DynamoDB", "us-east-1"));
+
+    // The shared strategy is freed with the last client using it.
+    std::weak_ptr<RetryStrategy> releasedStrategy = dynamoDBStrategy;
+    dynamoDBStrategy = nullptr;
+    ASSERT_TRUE(releasedStrategy.expired());
+    ASSERT_NE(nullptr, configuredStrategy.GetStrategyForClient("DynamoDB", "us-east-1"));
+}
+
+TEST(RetryStrategyTest, TestThrottlingErrors)
+{
+    ASSERT_TRUE(AdaptiveRetryStrategy::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::THROTTLING, true)));
+    ASSERT_TRUE(AdaptiveRetryStrategy::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::SLOW_DOWN, true)));
+    ASSERT_TRUE(AdaptiveRetryStrategy::IsThrottlingError(
+        AWSError<CoreErrors>(CoreErrors::UNKNOWN, "ProvisionedThroughputExceededException", "", true)));
+
+    AWSError<CoreErrors> tooManyRequests(CoreErrors::UNKNOWN, true);
+    tooManyRequests.SetResponseCode(HttpResponseCode::TOO_MANY_REQUESTS);
+    ASSERT_TRUE(AdaptiveRetryStrategy::IsThrottlingError(tooManyRequests));
+
+    ASSERT_FALSE(AdaptiveRetryStrategy::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true)));
+    ASSERT_FALSE(AdaptiveRetryStrategy::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, "InternalFailure", "", true)));
+}
@@ -0,0 +1,271 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#if ENABLE_CURL_CLIENT
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/curl/CurlHandlePool.h>
+#include <aws/core/utils/StringUtils.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Http;
+
+static const unsigned long NO_IDLE_TIMEOUT = 0;
+
+static CurlHandlePoolHostMetrics GetHostMetrics(const CurlHandlePool& pool, const Aws::String& endpoint)
+{
+    for (const auto& metrics : pool.GetPoolMetrics())
+    {
+        if (metrics.endpoint == endpoint)
+        {
+            return metrics;
+        }
+    }
+    return CurlHandlePoolHostMetrics();
+}
+
+TEST(CurlHandlePoolTest, TestHandleIsReusedForSameEndpoint)
+{
+    CurlHandlePool pool(4, 0, 1000, true, 30000, 3000, 1, NO_IDLE_TIMEOUT);
+    URI uri("https://bucket.s3.amazonaws.com/key");
+
+    CURL* first = pool.AcquireCurlHandle(uri);
+    ASSERT_NE(nullptr, first);
+    pool.ReleaseCurlHandle(first);
+
+    CURL* second = pool.AcquireCurlHandle(URI("https://bucket.s3.amazonaws.com/otherKey"));
+    ASSERT_EQ(first, second);
+    pool.ReleaseCurlHandle(second);
+
+    auto metrics = GetHostMetrics(pool, "https://bucket.s3.amazonaws.com:443");
+    ASSERT_EQ(1u, metrics.handlesCreated);
+    ASSERT_EQ(1u, metrics.handlesReused);
+    ASSERT_EQ(1u, metrics.idleHandles);
+    ASSERT_EQ(0u, metrics.leasedHandles);
+}
+
+TEST(CurlHandlePoolTest, TestIdleHandlesAreReusedLastInFirstOut)
+{
+    CurlHandlePool pool(4, 0, 1000, true, 30000, 3000, 1, NO_IDLE_TIMEOUT);
+    URI uri("https://sqs.us-east-1.amazonaws.com");
+
+    CURL* first = pool.AcquireCurlHandle(uri);
+    CURL* second = pool.AcquireCurlHandle(uri);
+    ASSERT_NE(first, second);
+    pool.ReleaseCurlHandle(first);
+    pool.ReleaseCurlHandle(second);
+
+    CURL* reused = pool.AcquireCurlHandle(uri);
+    ASSERT_EQ(second, reused);
+    pool.ReleaseCurlHandle(reused);
+}
+
+TEST(CurlHandlePoolTest, TestHandlesAreNotSharedAcrossEndpoints)
+{
+    CurlHandlePool pool(4, 0, 1000, true, 30000, 3000, 1, NO_IDLE_TIMEOUT);
+
+    CURL* httpsHandle = pool.AcquireCurlHandle(URI("https://bucket.s3.amazonaws.com"));
+    pool.ReleaseCurlHandle(httpsHandle);
+
+    CURL* httpHandle = pool.AcquireCurlHandle(URI("http://bucket.s3.amazonaws.com"));
+    ASSERT_NE(httpsHandle, httpHandle);
+    CURL* otherHostHandle = pool.AcquireCurlHandle(URI("https://otherbucket.s3.amazonaws.com"));
+    ASSERT_NE(httpsHandle, otherHostHandle);
+    pool.ReleaseCurlHandle(httpHandle);
+    pool.ReleaseCurlHandle(otherHostHandle);
+
+    ASSERT_EQ(3u, pool.GetPoolMetrics().size());
+    ASSERT_EQ(1u, GetHostMetrics(pool, "https://bucket.s3.amazonaws.com:443").idleHandles);
+    ASSERT_EQ(1u, GetHostMetrics(pool, "http://bucket.s3.amazonaws.com:80").idleHandles);
+    ASSERT_EQ(1u, GetHostMetrics(pool, "https://otherbucket.s3.amazonaws.com:443").idleHandles);
+}
+
+TEST(CurlHandlePoolTest, TestFullPoolEvictsIdleHandleOfOtherEndpoint)
+{
+    CurlHandlePool pool(1, 0, 1000, true, 30000, 3000, 1, NO_IDLE_TIMEOUT);
+
+    CURL* handle = pool.AcquireCurlHandle(URI("https://first.amazonaws.com"));
+    pool.ReleaseCurlHandle(handle);
+    handle = pool.AcquireCurlHandle(URI("https://second.amazonaws.com"));
+    ASSERT_NE(nullptr, handle);
+    pool.ReleaseCurlHandle(handle);
+
+    auto firstMetrics = GetHostMetrics(pool, "https://first.amazonaws.com:443");
+    ASSERT_EQ(0u, firstMetrics.idleHandles);
+    ASSERT_EQ(1u, firstMetrics.handlesEvicted);
+    ASSERT_EQ(1u, GetHostMetrics(pool, "https://second.amazonaws.com:443").idleHandles);
+}
+
+TEST(CurlHandlePoolTest, TestIdleHandlesAreEvictedAfterTimeout)
+{
+    CurlHandlePool pool(4, 0, 1000, true, 30000, 3000, 1, 10);
+    URI uri("https://bucket.s3.amazonaws.com");
+
+    CURL* first = pool.AcquireCurlHandle(uri);
+    CURL* second = pool.AcquireCurlHandle(uri);
+    pool.ReleaseCurlHandle(first);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    pool.ReleaseCurlHandle(second);
+
+    ASSERT_EQ(1u, pool.EvictIdleCurlHandles());
+    auto metrics = GetHostMetrics(pool, "https://bucket.s3.amazonaws.com:443");
+    ASSERT_EQ(1u, metrics.idleHandles);
+    ASSERT_EQ(1u, metrics.handlesEvicted);
+
+    ASSERT_EQ(second, pool.AcquireCurlHandle(uri));
+    pool.ReleaseCurlHandle(second);
+}
+
+TEST(CurlHandlePoolTest, TestUnusedEndpointsAreRemoved)
+{
+    CurlHandlePool pool(4, 0, 1000, true, 30000, 3000, 1, 10);
+    URI firstUri("https://first.amazonaws.com");
+
+    pool.ReleaseCurlHandle(pool.AcquireCurlHandle(firstUri));
+    CURL* leased = pool.AcquireCurlHandle(URI("https://second.amazonaws.com"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The endpoint with a leased handle is kept, however long ago it was acquired from.
+    ASSERT_EQ(1u, pool.EvictIdleCurlHandles());
+    auto metrics = pool.GetPoolMetrics();
+    ASSERT_EQ(1u, metrics.size());
+    ASSERT_EQ("https://second.amazonaws.com:443", metrics[0].endpoint);
+
+    pool.ReleaseCurlHandle(leased);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(1u, pool.EvictIdleCurlHandles());
+    ASSERT_TRUE(pool.GetPoolMetrics().empty());
+
+    CURL* handle = pool.AcquireCurlHandle(firstUri);
+    ASSERT_NE(nullptr, handle);
+    pool.ReleaseCurlHandle(handle);
+    ASSERT_EQ(1u, GetHostMetrics(pool, "https://first.amazonaws.com:443").handlesCreated);
+}
+
+TEST(CurlHandlePoolTest, TestDestroyedHandleFreesRoomInPool)
+{
+    CurlHandlePool pool(1, 0, 1000, true, 30000, 3000, 1, NO_IDLE_TIMEOUT);
+    URI uri("https://bucket.s3.amazonaws.com");
+
+    CURL* handle = pool.AcquireCurlHandle(uri);
+    pool.DestroyCurlHandle(handle);
+
+    handle = pool.AcquireCurlHandle(uri);
+    ASSERT_NE(nullptr, handle);
+    pool.ReleaseCurlHandle(handle);
+    auto metrics = GetHostMetrics(pool, "https://bucket.s3.amazonaws.com:443");
+    ASSERT_EQ(2u, metrics.handlesCreated);
+    ASSERT_EQ(0u, metrics.leasedHandles);
+}
+
+TEST(CurlHandlePoolTest, TestWaiterTakesTheRoomOfHandleReleasedForOtherEndpoint)
+{
+    CurlHandlePool pool(1, 0, 1000, true, 30000, 3000, 1, NO_IDLE_TIMEOUT);
+    CURL* otherHandle = pool.AcquireCurlHandle(URI("https://other.amazonaws.com"));
+
+    std::atomic<bool> acquired(false);
+    std::thread waiter([&]
+    {
+        CURL* handle = pool.AcquireCurlHandle(URI("https://bucket.s3.amazonaws.com"));
+        acquired = true;
+        pool.ReleaseCurlHandle(handle);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(acquired.load());
+
+    // The released handle can't be reused for the waiter's endpoint, it is evicted to make room instead.
+    pool.ReleaseCurlHandle(otherHandle);
+    waiter.join();
+    ASSERT_TRUE(acquired.load());
+    ASSERT_EQ(1u, GetHostMetrics(pool, "https://other.amazonaws.com:443").handlesEvicted);
+}
+
+TEST(CurlHandlePoolTest, TestConcurrentAcquireNeverExceedsMaxSize)
+{
+    const unsigned maxSize = 4;
+    const int threadsCount = 16;
+    const int iterations = 500;
+    CurlHandlePool pool(maxSize, 0, 1000, true, 30000, 3000, 1, NO_IDLE_TIMEOUT);
+    const char* endpoints[] = { "https://a.amazonaws.com", "https://b.amazonaws.com", "https://c.amazonaws.com" };
+
+    std::atomic<unsigned> leased(0);
+    std::atomic<unsigned> maxLeased(0);
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < threadsCount; ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            for (int j = 0; j < iterations; ++j)
+            {
+                CURL* handle = pool.AcquireCurlHandle(URI(endpoints[(i + j) % 3]));
+                unsigned current = ++leased;
+                unsigned observed = maxLeased.load();
+                while (current > observed && !maxLeased.compare_exchange_weak(observed, current));
+                --leased;
+                pool.ReleaseCurlHandle(handle);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_LE(maxLeased.load(), maxSize);
+    size_t idleHandles = 0;
+    for (const auto& metrics : pool.GetPoolMetrics())
+    {
+        ASSERT_EQ(0u, metrics.leasedHandles);
+        idleHandles += metrics.idleHandles;
+    }
+    ASSERT_LE(idleHandles, maxSize);
+}
+
+TEST(CurlHandlePoolTest, TestConcurrentAcquireWhileEndpointsAreRemoved)
+{
+    const int threadsCount = 8;
+    const int iterations = 500;
+    // Idle handles and unused endpoints are swept every millisecond, while the threads keep acquiring from them.
+    CurlHandlePool pool(4, 0, 1000, true, 30000, 3000, 1, 1);
+
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < threadsCount; ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            for (int j = 0; j < iterations; ++j)
+            {
+                Aws::String endpoint = "https://host" + Aws::Utils::StringUtils::to_string((i + j) % 16) + ".amazonaws.com";
+                CURL* handle = pool.AcquireCurlHandle(URI(endpoint));
+                ASSERT_NE(nullptr, handle);
+                if (j % 7 == 0)
+                {
+                    pool.DestroyCurlHandle(handle);
+                }
+                else
+                {
+                    pool.ReleaseCurlHandle(handle);
+                }
+                if (j % 50 == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& metrics : pool.GetPoolMetrics())
+    {
+        ASSERT_EQ(0u, metrics.leasedHandles);
+    }
+}
+
+#endif // ENABLE_CURL_CLIENT
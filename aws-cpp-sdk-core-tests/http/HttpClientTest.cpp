@@ -13,6 +13,10 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <future>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace Aws::Http;
 using namespace Aws::Utils;
@@ -80,6 +84,90 @@ TEST(HttpClientTest, TestRandomURLMultiThreaded)
     }
     ASSERT_FALSE(hasPendingTasks);
 }
+
+TEST(HttpClientTest, TestRandomURLWithCurlMultiClient)
+{
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    auto httpClient = CreateHttpClient(config);
+    makeRandomHttpRequest(httpClient);
+}
+
+TEST(HttpClientTest, TestRandomURLAsyncWithCurlMultiClient)
+{
+    const int requestCount = 50;
+    const int timeoutSecs = 5;
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    auto httpClient = CreateHttpClient(config);
+
+    std::mutex completedLock;
+    std::condition_variable completedSignal;
+    int completedCount = 0;
+    int unexpectedResponses = 0;
+    for (int i = 0; i < requestCount; ++i)
+    {
+        auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+                                         HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        httpClient->MakeRequestAsync(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+        {
+            std::lock_guard<std::mutex> locker(completedLock);
+            bool expected = response && (response->HasClientError() ?
+                response->GetClientErrorType() == CoreErrors::NETWORK_CONNECTION : response->GetResponseCode() == HttpResponseCode::FORBIDDEN);
+            if (!expected)
+            {
+                ++unexpectedResponses;
+            }
+            ++completedCount;
+            completedSignal.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> locker(completedLock);
+    ASSERT_TRUE(completedSignal.wait_for(locker, std::chrono::seconds(timeoutSecs), [&] { return completedCount == requestCount; }));
+    ASSERT_EQ(0, unexpectedResponses);
+}
+
+TEST(HttpClientTest, TestScheduleAfterWithCurlMultiClient)
+{
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    auto httpClient = CreateHttpClient(config);
+
+    std::mutex calledLock;
+    std::condition_variable calledSignal;
+    std::vector<int> calledOrder;
+    std::vector<std::thread::id> calledThreads;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration longestElapsed(0);
+    for (int delayMs : {200, 50, 0})
+    {
+        httpClient->ScheduleAfter(std::chrono::milliseconds(delayMs), [&, delayMs]()
+        {
+            std::lock_guard<std::mutex> locker(calledLock);
+            calledOrder.push_back(delayMs);
+            calledThreads.push_back(std::this_thread::get_id());
+            longestElapsed = std::chrono::steady_clock::now() - start;
+            calledSignal.notify_one();
+        });
+    }
+
+    {
+        // The callbacks run by deadline on the event loop, without blocking the thread scheduling them.
+        std::unique_lock<std::mutex> locker(calledLock);
+        ASSERT_TRUE(calledSignal.wait_for(locker, std::chrono::seconds(5), [&] { return calledOrder.size() == 3; }));
+        ASSERT_EQ(std::vector<int>({0, 50, 200}), calledOrder);
+        ASSERT_NE(std::this_thread::get_id(), calledThreads[0]);
+        ASSERT_EQ(calledThreads[0], calledThreads[2]);
+        ASSERT_GE(longestElapsed, std::chrono::milliseconds(200));
+    }
+
+    // Disabling request processing calls the callbacks still waiting right away.
+    std::promise<void> calledEarly;
+    httpClient->ScheduleAfter(std::chrono::seconds(60), [&calledEarly]() { calledEarly.set_value(); });
+    httpClient->DisableRequestProcessing();
+    ASSERT_EQ(std::future_status::ready, calledEarly.get_future().wait_for(std::chrono::seconds(5)));
+}
 #endif // ENABLE_CURL_CLIENT
 
 // Test Http Client timeout
@@ -0,0 +1,159 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/HttpHeaders.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char ALLOCATION_TAG[] = "HttpHeadersTest";
+
+TEST(HttpHeadersTest, TestLookupIsCaseInsensitive)
+{
+    HttpHeaders headers;
+    headers.Set("Content-Type", "application/json");
+    headers.Set("X-Amz-Meta-Owner", "  someone \r\n");
+
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_TRUE(headers.Has("content-type"));
+    ASSERT_TRUE(headers.Has("CONTENT-TYPE"));
+    ASSERT_EQ("application/json", *headers.Find("Content-type"));
+    ASSERT_EQ("someone", *headers.Find("x-amz-meta-owner"));
+    ASSERT_EQ(nullptr, headers.Find("content-length"));
+    ASSERT_EQ(nullptr, headers.Find("x-amz-meta"));
+
+    headers.Set("CONTENT-TYPE", "text/plain");
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_EQ("text/plain", *headers.Find("content-type"));
+
+    ASSERT_TRUE(headers.Erase("Content-Type"));
+    ASSERT_FALSE(headers.Erase("content-type"));
+    ASSERT_EQ(1u, headers.size());
+}
+
+TEST(HttpHeadersTest, TestHeadersAreSortedAndLowerCased)
+{
+    HttpHeaders headers;
+    headers.Set("X-Amz-Date", "20201231T000000Z");
+    headers.Set("Host", "example.amazonaws.com");
+    headers.Set("X-Amz-Meta-B", "b");
+    headers.Set("x-amz-meta-a", "a");
+    headers.Set("Authorization", "AWS4-HMAC-SHA256");
+
+    const char* expectedNames[] = { "authorization", "host", "x-amz-date", "x-amz-meta-a", "x-amz-meta-b" };
+    size_t index = 0;
+    for (const auto& header : headers)
+    {
+        ASSERT_STREQ(expectedNames[index++], header.GetName());
+        ASSERT_EQ(strlen(header.GetName()), header.GetNameLength());
+    }
+    ASSERT_EQ(5u, index);
+
+    // Well known names point to the same static string whatever their case, others are copied.
+    ASSERT_EQ(HttpHeaders::GetKnownHeaderName("host", 4), (headers.begin() + 1)->GetName());
+    ASSERT_EQ(nullptr, HttpHeaders::GetKnownHeaderName("x-amz-meta-a", 12));
+
+    HeaderValueCollection collection = headers.ToCollection();
+    ASSERT_EQ(5u, collection.size());
+    ASSERT_EQ("a", collection["x-amz-meta-a"]);
+    ASSERT_EQ("20201231T000000Z", collection["x-amz-date"]);
+
+    index = 0;
+    headers.Visit([&](const char* name, size_t nameLength, const Aws::String& value)
+    {
+        ASSERT_EQ(Aws::String(expectedNames[index++]), Aws::String(name, nameLength));
+        ASSERT_EQ(collection[name], value);
+    });
+    ASSERT_EQ(5u, index);
+}
+
+TEST(HttpHeadersTest, TestKnownHeaderNames)
+{
+    const char* names[] = { DATE_HEADER, AWS_DATE_HEADER, AWS_SECURITY_TOKEN, ACCEPT_HEADER, ACCEPT_CHAR_SET_HEADER, ACCEPT_ENCODING_HEADER,
+        AUTHORIZATION_HEADER, COOKIE_HEADER, CONTENT_LENGTH_HEADER, CONTENT_TYPE_HEADER, CONTENT_ENCODING_HEADER, TRANSFER_ENCODING_HEADER,
+        USER_AGENT_HEADER, VIA_HEADER, HOST_HEADER, AMZ_TARGET_HEADER, X_AMZ_EXPIRES_HEADER, CONTENT_MD5_HEADER, API_VERSION_HEADER,
+        SDK_INVOCATION_ID_HEADER, SDK_REQUEST_HEADER, "x-amz-content-sha256", "X-Amzn-RequestId", "x-amz-request-id", "ETag" };
+    for (const char* name : names)
+    {
+        const char* knownName = HttpHeaders::GetKnownHeaderName(name, strlen(name));
+        ASSERT_NE(nullptr, knownName) << name;
+        ASSERT_STREQ(Aws::Utils::StringUtils::ToLower(name).c_str(), knownName);
+    }
+    ASSERT_EQ(nullptr, HttpHeaders::GetKnownHeaderName("x-amz", 5));
+    ASSERT_EQ(nullptr, HttpHeaders::GetKnownHeaderName("hostname", 8));
+}
+
+TEST(HttpHeadersTest, TestSetWithValueOfAnotherHeader)
+{
+    HttpHeaders headers;
+    headers.Set("b", "value");
+    // Inserting "a" before "b" moves it, the value must have been copied first.
+    headers.Set("a", *headers.Find("b"));
+    ASSERT_EQ("value", *headers.Find("a"));
+    ASSERT_EQ("value", *headers.Find("b"));
+
+    headers.Set("", "ignored");
+    headers.Set("   ", "ignored");
+    ASSERT_EQ(2u, headers.size());
+}
+
+TEST(HttpHeadersTest, TestStandardHttpRequestHeaders)
+{
+    StandardHttpRequest request(URI("http://example.amazonaws.com"), HttpMethod::HTTP_GET);
+    request.SetHeaderValue("Content-Length", " 42 ");
+    request.SetHeaderValue(Aws::String("X-Amz-Meta-Key"), "value");
+
+    ASSERT_TRUE(request.HasHeader(CONTENT_LENGTH_HEADER));
+    ASSERT_TRUE(request.HasHeader("x-amz-meta-key"));
+    ASSERT_EQ("42", request.GetHeaderValue("content-length"));
+    ASSERT_EQ("example.amazonaws.com", request.GetHeaderValue(HOST_HEADER));
+
+    HeaderValueCollection headers = request.GetHeaders();
+    ASSERT_EQ(3u, headers.size());
+    ASSERT_EQ("value", headers["x-amz-meta-key"]);
+
+    size_t visited = 0;
+    request.VisitHeaders([&](const char* name, size_t nameLength, const Aws::String& value)
+    {
+        ASSERT_EQ(headers[Aws::String(name, nameLength)], value);
+        ++visited;
+    });
+    ASSERT_EQ(3u, visited);
+    ASSERT_EQ(static_cast<int64_t>(strlen("content-length42hostexample.amazonaws.comx-amz-meta-keyvalue")), request.GetSize());
+
+    request.DeleteHeader("CONTENT-LENGTH");
+    ASSERT_FALSE(request.HasHeader(CONTENT_LENGTH_HEADER));
+}
+
+TEST(HttpHeadersTest, TestStandardHttpResponseHeaderSlices)
+{
+    auto request = Aws::MakeShared<StandardHttpRequest>(ALLOCATION_TAG, URI("http://example.amazonaws.com"), HttpMethod::HTTP_GET);
+    request->SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    StandardHttpResponse response(request);
+
+    // Header lines as curl hands them out: not null terminated and ending with CRLF.
+    const char headerLines[] = "x-amz-request-id: ABCDEF\r\nContent-Type:text/xml\r\nX-Amz-Meta-Empty:\r\n";
+    const char* line = headerLines;
+    for (size_t lineLength : { strlen("x-amz-request-id: ABCDEF\r\n"), strlen("Content-Type:text/xml\r\n"), strlen("X-Amz-Meta-Empty:\r\n") })
+    {
+        const char* separator = static_cast<const char*>(memchr(line, ':', lineLength));
+        ASSERT_NE(nullptr, separator);
+        static_cast<HttpResponse&>(response).AddHeader(line, separator - line, separator + 1, line + lineLength - (separator + 1));
+        line += lineLength;
+    }
+
+    ASSERT_EQ("ABCDEF", response.GetHeader("X-Amz-Request-Id"));
+    ASSERT_EQ("text/xml", response.GetContentType());
+    ASSERT_TRUE(response.HasHeader("x-amz-meta-empty"));
+    ASSERT_EQ("", response.GetHeader("x-amz-meta-empty"));
+    ASSERT_FALSE(response.HasHeader("etag"));
+    ASSERT_EQ("", response.GetHeader("etag"));
+    ASSERT_EQ(3u, response.GetHeaders().size());
+}
@@ -58,6 +58,34 @@ TEST(FileTest, TempFile)
     ASSERT_FALSE(testIn.good());
 }
 
+TEST(FileTest, MappedFile)
+{
+    TempFile tempFile(std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    Aws::String content(100000, 'a');
+    content[99999] = 'z';
+    tempFile << content;
+    tempFile.close();
+
+    Aws::FileSystem::MappedFile mappedFile(tempFile.GetFileName());
+    ASSERT_TRUE(mappedFile.IsMapped());
+    ASSERT_EQ(content.size(), mappedFile.GetSize());
+    ASSERT_EQ(content, Aws::String(reinterpret_cast<const char*>(mappedFile.GetData()), static_cast<size_t>(mappedFile.GetSize())));
+
+    Aws::FileSystem::MappedFile missingFile("boogieMan");
+    ASSERT_FALSE(missingFile.IsMapped());
+    ASSERT_EQ(nullptr, missingFile.GetData());
+}
+
+TEST(FileTest, EmptyFileIsNotMapped)
+{
+    TempFile tempFile(std::ios_base::out | std::ios_base::trunc);
+    tempFile.close();
+
+    Aws::FileSystem::MappedFile mappedFile(tempFile.GetFileName());
+    ASSERT_FALSE(mappedFile.IsMapped());
+    ASSERT_EQ(0u, mappedFile.GetSize());
+}
+
 class DirectoryTreeTest : public ::testing::Test
 {
 public:
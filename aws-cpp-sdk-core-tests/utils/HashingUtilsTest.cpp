@@ -6,11 +6,21 @@
 #include <aws/external/gtest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
 
 using namespace Aws::Utils;
 
+static const char ALLOCATION_TAG[] = "HashingUtilsTest";
+
 TEST(HashingUtilsTest, TestBase64Encoding)
 {
     //these are the standard testing vectors from RFC 4648
@@ -311,3 +321,148 @@ TEST(HashingUtilsTest, TestMD5FromStream)
     TestMD5FromStream( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "V+30oivjyVWsSdouIQe2eg==" );
 }
 
+static void UpdateInPieces(Crypto::Hash& hash, const Aws::String& value)
+{
+    // Uneven pieces, so that digests spanning several updates are exercised.
+    size_t offset = 0;
+    for (size_t pieceSize = 1; offset < value.size(); pieceSize += 3)
+    {
+        size_t length = std::min(pieceSize, value.size() - offset);
+        hash.Update(reinterpret_cast<unsigned char*>(const_cast<char*>(value.c_str())) + offset, length);
+        offset += length;
+    }
+}
+
+TEST(HashingUtilsTest, TestIncrementalHashesMatchCalculate)
+{
+    const Aws::String value = "12345678901234567890123456789012345678901234567890123456789012345678901234567890";
+
+    Crypto::MD5 md5;
+    UpdateInPieces(md5, value);
+    ASSERT_STREQ("V+30oivjyVWsSdouIQe2eg==", HashingUtils::Base64Encode(md5.GetHash().GetResult()).c_str());
+    // GetHash starts a new digest.
+    ASSERT_STREQ("1B2M2Y8AsgTpgAmY7PhCfg==", HashingUtils::Base64Encode(md5.GetHash().GetResult()).c_str());
+
+    Crypto::Sha256 sha256;
+    UpdateInPieces(sha256, "abc");
+    ASSERT_STREQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", HashingUtils::HexEncode(sha256.GetHash().GetResult()).c_str());
+    UpdateInPieces(sha256, value);
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256(value)), HashingUtils::HexEncode(sha256.GetHash().GetResult()));
+}
+
+TEST(HashingUtilsTest, TestCRC32C)
+{
+    Crypto::CRC32C crc;
+    ASSERT_STREQ("00000000", HashingUtils::HexEncode(crc.Calculate("").GetResult()).c_str());
+    ASSERT_STREQ("e3069283", HashingUtils::HexEncode(crc.Calculate("123456789").GetResult()).c_str());
+
+    Aws::StringStream stream("123456789");
+    ASSERT_STREQ("e3069283", HashingUtils::HexEncode(crc.Calculate(stream).GetResult()).c_str());
+
+    UpdateInPieces(crc, "123456789");
+    ASSERT_STREQ("e3069283", HashingUtils::HexEncode(crc.GetHash().GetResult()).c_str());
+    ASSERT_STREQ("00000000", HashingUtils::HexEncode(crc.GetHash().GetResult()).c_str());
+}
+
+TEST(HashingUtilsTest, TestCalculateHashesInOnePass)
+{
+    // Larger than the internal buffer, so that the stream is read in several chunks.
+    Aws::String value(3 * Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE + 17, 'x');
+    for (size_t i = 0; i < value.size(); ++i)
+    {
+        value[i] = static_cast<char>('a' + i % 26);
+    }
+    Aws::StringStream stream(value);
+    stream.seekg(5);
+
+    Aws::Vector<std::shared_ptr<Crypto::Hash>> hashes = {
+        Aws::MakeShared<Crypto::MD5>(ALLOCATION_TAG), Aws::MakeShared<Crypto::Sha256>(ALLOCATION_TAG), Aws::MakeShared<Crypto::CRC32C>(ALLOCATION_TAG) };
+    auto digests = HashingUtils::CalculateHashes(stream, hashes);
+
+    ASSERT_EQ(3u, digests.size());
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateMD5(value)), HashingUtils::HexEncode(digests[0]));
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256(value)), HashingUtils::HexEncode(digests[1]));
+    ASSERT_EQ(HashingUtils::HexEncode(Crypto::CRC32C().Calculate(value).GetResult()), HashingUtils::HexEncode(digests[2]));
+    // The stream is left where it was.
+    ASSERT_EQ(5, stream.tellg());
+}
+
+class CalculateOnlyHash : public Crypto::Hash
+{
+public:
+    Crypto::HashResult Calculate(const Aws::String& str) override { return HashingUtils::CalculateMD5(str); }
+    Crypto::HashResult Calculate(Aws::IStream&) override { return Crypto::HashResult(); }
+};
+
+TEST(HashingUtilsTest, TestCalculateHashesWithoutIncrementalHash)
+{
+    Crypto::MD5 md5;
+    // A digest finished before any Update is the digest of no data.
+    ASSERT_STREQ("1B2M2Y8AsgTpgAmY7PhCfg==", HashingUtils::Base64Encode(md5.GetHash().GetResult()).c_str());
+
+    CalculateOnlyHash calculateOnly;
+    ASSERT_FALSE(calculateOnly.GetHash().IsSuccess());
+
+    Aws::StringStream stream("123456789");
+    Aws::Vector<std::shared_ptr<Crypto::Hash>> hashes = {
+        Aws::MakeShared<Crypto::MD5>(ALLOCATION_TAG), Aws::MakeShared<CalculateOnlyHash>(ALLOCATION_TAG) };
+    ASSERT_TRUE(HashingUtils::CalculateHashes(stream, hashes).empty());
+    // The MD5 digest was finished anyway, so the hash can be reused.
+    ASSERT_STREQ("1B2M2Y8AsgTpgAmY7PhCfg==", HashingUtils::Base64Encode(hashes[0]->GetHash().GetResult()).c_str());
+}
+
+TEST(HashingUtilsTest, TestCRC32AndCRC32C)
+{
+    ASSERT_STREQ("00000000", HashingUtils::HexEncode(HashingUtils::CalculateCRC32("")).c_str());
+    ASSERT_STREQ("cbf43926", HashingUtils::HexEncode(HashingUtils::CalculateCRC32("123456789")).c_str());
+    ASSERT_STREQ("e3069283", HashingUtils::HexEncode(HashingUtils::CalculateCRC32C("123456789")).c_str());
+
+    Aws::StringStream stream("123456789");
+    ASSERT_STREQ("cbf43926", HashingUtils::HexEncode(HashingUtils::CalculateCRC32(stream)).c_str());
+    ASSERT_STREQ("e3069283", HashingUtils::HexEncode(HashingUtils::CalculateCRC32C(stream)).c_str());
+}
+
+TEST(HashingUtilsTest, TestCombineCRCs)
+{
+    Aws::String value(100000, 'x');
+    for (size_t i = 0; i < value.size(); ++i)
+    {
+        value[i] = static_cast<char>(i * 31 % 251);
+    }
+
+    for (size_t split : {size_t(0), size_t(1), size_t(4096), size_t(65537), value.size()})
+    {
+        Aws::String first = value.substr(0, split);
+        Aws::String second = value.substr(split);
+
+        auto crc32 = HashingUtils::CombineCRC32(HashingUtils::CalculateCRC32(first), HashingUtils::CalculateCRC32(second), second.size());
+        ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateCRC32(value)), HashingUtils::HexEncode(crc32));
+
+        auto crc32c = HashingUtils::CombineCRC32C(HashingUtils::CalculateCRC32C(first), HashingUtils::CalculateCRC32C(second), second.size());
+        ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateCRC32C(value)), HashingUtils::HexEncode(crc32c));
+    }
+}
+
+static void MeasureThroughput(const char* name, Crypto::Hash& hash, Aws::String& data)
+{
+    auto start = std::chrono::steady_clock::now();
+    hash.Update(reinterpret_cast<unsigned char*>(&data[0]), data.size());
+    ASSERT_TRUE(hash.GetHash().IsSuccess());
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << data.size() / elapsed.count() / (1024 * 1024 * 1024) << " GB/s" << std::endl;
+}
+
+// Not a correctness test, run it with --gtest_also_run_disabled_tests to compare the checksums with the platform crypto hashes.
+TEST(HashingUtilsTest, DISABLED_BenchmarkChecksumsAndHashes)
+{
+    Aws::String data(256 * 1024 * 1024, 'x');
+
+    Crypto::CRC32 crc32;
+    MeasureThroughput("CRC32", crc32, data);
+    Crypto::CRC32C crc32c;
+    MeasureThroughput("CRC32C", crc32c, data);
+    Crypto::MD5 md5;
+    MeasureThroughput("MD5", md5, data);
+    Crypto::Sha256 sha256;
+    MeasureThroughput("SHA256", sha256, data);
+}
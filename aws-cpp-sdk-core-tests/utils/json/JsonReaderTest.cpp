@@ -0,0 +1,305 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <chrono>
+#include <climits>
+#include <iostream>
+
+using namespace Aws::Utils::Json;
+
+namespace
+{
+    // Shaped like the code generated for a service result, to check the reader supports that access pattern.
+    struct Item
+    {
+        Item() : m_size(0), m_sizeHasBeenSet(false), m_nameHasBeenSet(false) {}
+        Item(JsonReader& reader) : Item() { *this = reader; }
+
+        Item& operator=(JsonReader& reader)
+        {
+            if (reader.StartObject())
+            {
+                while (reader.NextMember())
+                {
+                    if (reader.KeyEquals("Name"))
+                    {
+                        m_name = reader.ReadString();
+                        m_nameHasBeenSet = true;
+                    }
+                    else if (reader.KeyEquals("Size"))
+                    {
+                        m_size = reader.ReadInt64();
+                        m_sizeHasBeenSet = true;
+                    }
+                    else if (reader.KeyEquals("Tags"))
+                    {
+                        if (reader.StartObject())
+                        {
+                            while (reader.NextMember())
+                            {
+                                Aws::String key = reader.GetKey();
+                                m_tags[key] = reader.ReadString();
+                            }
+                        }
+                    }
+                }
+            }
+            return *this;
+        }
+
+        Aws::String m_name;
+        long long m_size;
+        Aws::Map<Aws::String, Aws::String> m_tags;
+        bool m_sizeHasBeenSet;
+        bool m_nameHasBeenSet;
+    };
+
+    struct ListItemsResult
+    {
+        ListItemsResult(JsonReader reader)
+        {
+            if (reader.StartObject())
+            {
+                while (reader.NextMember())
+                {
+                    if (reader.KeyEquals("Items"))
+                    {
+                        if (reader.StartArray())
+                        {
+                            while (reader.NextElement())
+                            {
+                                m_items.push_back(reader);
+                            }
+                        }
+                    }
+                    else if (reader.KeyEquals("NextToken"))
+                    {
+                        m_nextToken = reader.ReadString();
+                    }
+                }
+            }
+        }
+
+        Aws::Vector<Item> m_items;
+        Aws::String m_nextToken;
+    };
+
+    const char LIST_ITEMS_RESPONSE[] =
+        "{\"Unknown\": {\"Nested\": [1, 2, {\"a\": null}]}, \"Items\": ["
+        "{\"Name\": \"first\", \"Size\": 12345678901, \"Tags\": {\"k1\": \"v1\", \"k\\\"2\": \"v2\"}},"
+        "{\"Name\": \"second\", \"Size\": null, \"Ignored\": true}"
+        "], \"NextToken\": \"abc\"}";
+}
+
+TEST(JsonReaderTest, TestReadsGeneratedModelShape)
+{
+    Aws::String text(LIST_ITEMS_RESPONSE);
+    JsonReader reader(text.c_str(), text.size());
+    ASSERT_TRUE(reader.Validate());
+
+    ListItemsResult result(reader);
+    ASSERT_EQ(2u, result.m_items.size());
+    ASSERT_STREQ("first", result.m_items[0].m_name.c_str());
+    ASSERT_EQ(12345678901LL, result.m_items[0].m_size);
+    ASSERT_EQ(2u, result.m_items[0].m_tags.size());
+    ASSERT_STREQ("v2", result.m_items[0].m_tags["k\"2"].c_str());
+    ASSERT_STREQ("second", result.m_items[1].m_name.c_str());
+    ASSERT_FALSE(result.m_items[1].m_sizeHasBeenSet);
+    ASSERT_STREQ("abc", result.m_nextToken.c_str());
+}
+
+TEST(JsonReaderTest, TestReadsScalars)
+{
+    JsonReader reader(Aws::String("[\"text\", -12, 3.5e2, 2147483648, true, false, null, 9007199254740993]"));
+    ASSERT_TRUE(reader.StartArray());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(JsonTokenType::String, reader.Peek());
+    ASSERT_STREQ("text", reader.ReadString().c_str());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(-12, reader.ReadInteger());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_DOUBLE_EQ(350.0, reader.ReadDouble());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(INT_MAX, reader.ReadInteger());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_TRUE(reader.ReadBool());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_FALSE(reader.ReadBool());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(JsonTokenType::Null, reader.Peek());
+    reader.SkipValue();
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(9007199254740993LL, reader.ReadInt64());
+    ASSERT_FALSE(reader.NextElement());
+    ASSERT_EQ(JsonTokenType::End, reader.Peek());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, TestDecodesEscapeSequences)
+{
+    JsonReader reader(Aws::String("{\"k\\u00e9y\": \"a\\\"b\\\\c\\/d\\n\\t\\u20AC\\ud83d\\ude00\"}"));
+    ASSERT_TRUE(reader.StartObject());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_TRUE(reader.KeyEquals("k\xC3\xA9y"));
+    ASSERT_STREQ("a\"b\\c/d\n\t\xE2\x82\xAC\xF0\x9F\x98\x80", reader.ReadString().c_str());
+    ASSERT_FALSE(reader.NextMember());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, TestWrongTypesReturnDefaultsAndSkipValue)
+{
+    JsonReader reader(Aws::String("{\"a\": {\"x\": [1, 2]}, \"b\": \"str\", \"c\": [true], \"d\": 5}"));
+    ASSERT_TRUE(reader.StartObject());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_STREQ("", reader.ReadString().c_str());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_EQ(0, reader.ReadInteger());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_FALSE(reader.StartObject());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_TRUE(reader.KeyEquals("d"));
+    ASSERT_EQ(5, reader.ReadInteger());
+    ASSERT_FALSE(reader.NextMember());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, TestUnreadValuesAreSkipped)
+{
+    JsonReader reader(Aws::String("{\"skipped\": {\"deep\": [[{}], \"}\"]}, \"wanted\": 1}"));
+    ASSERT_TRUE(reader.StartObject());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_TRUE(reader.KeyEquals("skipped"));
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_TRUE(reader.KeyEquals("wanted"));
+    ASSERT_EQ(1, reader.ReadInteger());
+    ASSERT_FALSE(reader.NextMember());
+}
+
+TEST(JsonReaderTest, TestCopiesContinueIndependently)
+{
+    JsonReader reader(Aws::String("[1, 2]"));
+    ASSERT_TRUE(reader.StartArray());
+    ASSERT_TRUE(reader.NextElement());
+    JsonReader copy(reader);
+    ASSERT_EQ(1, reader.ReadInteger());
+    ASSERT_EQ(1, copy.ReadInteger());
+    ASSERT_TRUE(copy.NextElement());
+    ASSERT_EQ(2, copy.ReadInteger());
+    ASSERT_TRUE(reader.NextElement());
+    ASSERT_EQ(2, reader.ReadInteger());
+}
+
+TEST(JsonReaderTest, TestReadValueBuildsDom)
+{
+    JsonReader reader(Aws::String("{\"doc\": {\"a\": [1, \"b\"]}, \"after\": true}"));
+    ASSERT_TRUE(reader.StartObject());
+    ASSERT_TRUE(reader.NextMember());
+    JsonValue document = reader.ReadValue();
+    ASSERT_TRUE(document.WasParseSuccessful());
+    ASSERT_STREQ("b", document.View().GetArray("a")[1].AsString().c_str());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_TRUE(reader.ReadBool());
+}
+
+TEST(JsonReaderTest, TestReadsFromStream)
+{
+    Aws::StringStream ss;
+    ss << LIST_ITEMS_RESPONSE;
+    JsonReader reader(ss);
+    ASSERT_TRUE(reader.Validate());
+    ListItemsResult result(reader);
+    ASSERT_EQ(2u, result.m_items.size());
+}
+
+TEST(JsonReaderTest, TestValidateRejectsMalformedText)
+{
+    const char* malformed[] = {
+        "", "{", "{\"a\" 1}", "{\"a\": 1,}", "[1 2]", "01", "1.", "-", "tru", "\"unterminated", "\"bad \\x escape\"",
+        "\"ctrl \x01\"", "{} {}", "[\"\\ud83d\"]"
+    };
+
+    for (auto text : malformed)
+    {
+        JsonReader reader{Aws::String(text)};
+        ASSERT_FALSE(reader.Validate()) << text;
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+    }
+
+    Aws::String deep(2000, '[');
+    deep.append(2000, ']');
+    JsonReader deepReader(std::move(deep));
+    ASSERT_FALSE(deepReader.Validate());
+}
+
+TEST(JsonReaderTest, TestErrorsStopIteration)
+{
+    JsonReader reader(Aws::String("{\"a\": 1 \"b\": 2}"));
+    ASSERT_TRUE(reader.StartObject());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_EQ(1, reader.ReadInteger());
+    ASSERT_FALSE(reader.NextMember());
+    ASSERT_FALSE(reader.WasParseSuccessful());
+    ASSERT_EQ(JsonTokenType::Error, reader.Peek());
+}
+
+// Not a correctness test, run it with --gtest_also_run_disabled_tests to compare JsonReader with JsonValue.
+TEST(JsonReaderTest, DISABLED_ReaderVersusDomMicroBenchmark)
+{
+    Aws::StringStream ss;
+    ss << "{\"Items\": [";
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        ss << (i ? "," : "") << "{\"Name\": \"item-" << i << "\", \"Size\": " << i * 1000 << ", \"Tags\": {\"owner\": \"team\"}}";
+    }
+    ss << "], \"NextToken\": \"token\"}";
+    const Aws::String text = ss.str();
+
+    static const size_t ITERATIONS = 20;
+    size_t domItems = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i)
+    {
+        // Same work as the code generated for JsonValue results.
+        JsonValue value(text);
+        auto items = value.View().GetArray("Items");
+        Aws::Vector<Item> result;
+        for (size_t j = 0; j < items.GetLength(); ++j)
+        {
+            Item item;
+            item.m_name = items[j].GetString("Name");
+            item.m_size = items[j].GetInt64("Size");
+            for (auto& tag : items[j].GetObject("Tags").GetAllObjects())
+            {
+                item.m_tags[tag.first] = tag.second.AsString();
+            }
+            result.push_back(item);
+        }
+        domItems += result.size();
+    }
+    auto domElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    size_t readerItems = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i)
+    {
+        JsonReader reader(text.c_str(), text.size());
+        reader.Validate();
+        ListItemsResult result(reader);
+        readerItems += result.m_items.size();
+    }
+    auto readerElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    ASSERT_EQ(domItems, readerItems);
+    std::cout << "JsonValue: " << domElapsed.count() / ITERATIONS << " us/document, JsonReader: "
+              << readerElapsed.count() / ITERATIONS << " us/document" << std::endl;
+}
@@ -7,11 +7,15 @@
 
 #include <aws/external/gtest.h>
 
+#include <aws/core/utils/logging/BinaryLogSystem.h>
 #include <aws/core/utils/logging/DefaultLogSystem.h>
+#include <aws/core/utils/logging/RingBufferLogSystem.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/StringUtils.h>
 
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 using namespace Aws::Utils;
@@ -89,12 +93,13 @@ void VerifyAllLogsAtOrBelow(LogLevel logLevel, const Aws::String& tag, const Aws
     }
 }
 
+template<typename LogSystemT = DefaultLogSystem>
 void DoLogTest(LogLevel logLevel, const char *testTag)
 {
     auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
 
     {
-        ScopedLogger loggingScope(Aws::MakeShared<DefaultLogSystem>(AllocationTag, logLevel, ss));
+        ScopedLogger loggingScope(Aws::MakeShared<LogSystemT>(AllocationTag, logLevel, ss));
 
         LogAllPossibilities(testTag);
     }
@@ -132,3 +137,210 @@ TEST(LoggingTest, testTraceLogLevel)
 {
     DoLogTest(LogLevel::Trace, "LoggingTest_testTraceLogLevel");    
 }
+
+TEST(LoggingTest, testRingBufferFatalLogLevel)
+{
+    DoLogTest<RingBufferLogSystem>(LogLevel::Fatal, "LoggingTest_testRingBufferFatalLogLevel");
+}
+
+TEST(LoggingTest, testRingBufferInfoLogLevel)
+{
+    DoLogTest<RingBufferLogSystem>(LogLevel::Info, "LoggingTest_testRingBufferInfoLogLevel");
+}
+
+TEST(LoggingTest, testRingBufferTraceLogLevel)
+{
+    DoLogTest<RingBufferLogSystem>(LogLevel::Trace, "LoggingTest_testRingBufferTraceLogLevel");
+}
+
+TEST(LoggingTest, testRingBufferFlushWritesStatementsOfAllThreads)
+{
+    static const int THREAD_COUNT = 4;
+    static const int STATEMENTS_PER_THREAD = 200;
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    RingBufferLogSystem logSystem(LogLevel::Trace, ss);
+
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([&logSystem, i]()
+        {
+            for (int j = 0; j < STATEMENTS_PER_THREAD; ++j)
+            {
+                Aws::OStringStream message;
+                message << "thread " << i << " statement " << j;
+                logSystem.LogStream(LogLevel::Debug, "RingBufferTest", message);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    logSystem.Flush();
+
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+    // The default buffers are much larger than what each thread logs here.
+    ASSERT_EQ(0u, logSystem.GetDroppedStatementCount());
+    ASSERT_EQ(static_cast<size_t>(THREAD_COUNT * STATEMENTS_PER_THREAD), loggedStatements.size());
+    Aws::Vector<int> nextStatement(THREAD_COUNT, 0);
+    for (const auto& statement : loggedStatements)
+    {
+        ASSERT_EQ(0u, statement.find("[DEBUG] "));
+        ASSERT_NE(Aws::String::npos, statement.find(" RingBufferTest ["));
+        int thread = 0, index = 0;
+        ASSERT_EQ(2, sscanf(statement.c_str() + statement.find("thread "), "thread %d statement %d", &thread, &index));
+        // The statements of a thread keep their order.
+        ASSERT_LE(nextStatement[thread], index);
+        nextStatement[thread] = index + 1;
+    }
+}
+
+namespace
+{
+    /**
+     * Blocks the first write until Release is called.
+     */
+    class BlockingStreamBuf : public std::stringbuf
+    {
+    public:
+        BlockingStreamBuf() : m_writing(false), m_released(false) {}
+
+        void WaitUntilWriting()
+        {
+            std::unique_lock<std::mutex> locker(m_mutex);
+            m_signal.wait(locker, [this]() { return m_writing; });
+        }
+
+        void Release()
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_released = true;
+            m_signal.notify_all();
+        }
+
+    protected:
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            std::unique_lock<std::mutex> locker(m_mutex);
+            m_writing = true;
+            m_signal.notify_all();
+            m_signal.wait(locker, [this]() { return m_released; });
+            return std::stringbuf::xsputn(s, n);
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_signal;
+        bool m_writing;
+        bool m_released;
+    };
+}
+
+TEST(LoggingTest, testRingBufferDropsAndCountsStatementsWhenFull)
+{
+    BlockingStreamBuf streamBuf;
+    auto stream = Aws::MakeShared<Aws::IOStream>(AllocationTag, &streamBuf);
+    {
+        RingBufferLogSystem logSystem(LogLevel::Trace, stream, 1024);
+        logSystem.Log(LogLevel::Info, "RingBufferTest", "first statement");
+        std::thread flusher([&logSystem]() { logSystem.Flush(); });
+        // The logging thread is now stuck writing out the first statement, the buffer fills up.
+        streamBuf.WaitUntilWriting();
+        for (int i = 0; i < 100; ++i)
+        {
+            logSystem.Log(LogLevel::Info, "RingBufferTest", "statement %d", i);
+        }
+        ASSERT_GT(logSystem.GetDroppedStatementCount(), 0u);
+        ASSERT_LT(logSystem.GetDroppedStatementCount(), 100u);
+
+        streamBuf.Release();
+        flusher.join();
+        logSystem.Flush();
+
+        Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(streamBuf.str());
+        ASSERT_EQ(101 - logSystem.GetDroppedStatementCount() + 1, loggedStatements.size());
+        ASSERT_NE(Aws::String::npos, loggedStatements[0].find("first statement"));
+        Aws::String droppedNote = StringUtils::to_string(logSystem.GetDroppedStatementCount()) + " log statements of this thread were dropped";
+        ASSERT_NE(Aws::String::npos, loggedStatements.back().find(droppedNote));
+        ASSERT_EQ(0u, loggedStatements.back().find("[WARN] "));
+    }
+}
+
+static size_t CountOccurrences(const Aws::String& text, const Aws::String& pattern)
+{
+    size_t count = 0;
+    for (size_t position = text.find(pattern); position != Aws::String::npos; position = text.find(pattern, position + pattern.size()))
+    {
+        ++count;
+    }
+    return count;
+}
+
+TEST(LoggingTest, testBinaryLogSystemWritesTagsAndFormatsOnce)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        BinaryLogSystem logSystem(LogLevel::Trace, ss);
+        for (int i = 0; i < 100; ++i)
+        {
+            logSystem.Log(LogLevel::Info, "BinaryLogTest", "statement %d of %s, %.2f%%", i, "the binary log test", 0.5);
+        }
+        logSystem.Flush();
+    }
+
+    Aws::String log = ss->str();
+    ASSERT_EQ(0u, log.find("AWSBLOG1"));
+    ASSERT_EQ(1u, CountOccurrences(log, "BinaryLogTest"));
+    ASSERT_EQ(1u, CountOccurrences(log, "statement %d of %s, %.2f%%"));
+    ASSERT_EQ(100u, CountOccurrences(log, "the binary log test"));
+    // Nothing was formatted.
+    ASSERT_EQ(Aws::String::npos, log.find("statement 1 of"));
+}
+
+TEST(LoggingTest, testBinaryLogSystemLogLevel)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        ScopedLogger loggingScope(Aws::MakeShared<BinaryLogSystem>(AllocationTag, LogLevel::Info, ss));
+        LogAllPossibilities("LoggingTest_testBinaryLogSystemLogLevel");
+    }
+
+    Aws::String log = ss->str();
+    ASSERT_NE(Aws::String::npos, log.find("test info level"));
+    ASSERT_NE(Aws::String::npos, log.find("test info stream level"));
+    ASSERT_EQ(Aws::String::npos, log.find("test debug level"));
+    ASSERT_EQ(Aws::String::npos, log.find("test debug stream level"));
+}
+
+// Statements more verbose than the threshold are compiled out, whatever the level of the log system.
+#undef AWS_LOG_LEVEL_THRESHOLD
+#define AWS_LOG_LEVEL_THRESHOLD 3
+
+static int CountEvaluation(int& evaluations)
+{
+    return ++evaluations;
+}
+
+TEST(LoggingTest, testStatementsAboveThresholdAreCompiledOut)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    int evaluations = 0;
+    {
+        ScopedLogger loggingScope(Aws::MakeShared<DefaultLogSystem>(AllocationTag, LogLevel::Trace, ss));
+        AWS_LOG_WARN("LoggingTest_testStatementsAboveThresholdAreCompiledOut", "test warn level %d", CountEvaluation(evaluations));
+        AWS_LOGSTREAM_WARN("LoggingTest_testStatementsAboveThresholdAreCompiledOut", "test warn stream level " << CountEvaluation(evaluations));
+        AWS_LOG_INFO("LoggingTest_testStatementsAboveThresholdAreCompiledOut", "test info level %d", CountEvaluation(evaluations));
+        AWS_LOGSTREAM_DEBUG("LoggingTest_testStatementsAboveThresholdAreCompiledOut", "test debug stream level " << CountEvaluation(evaluations));
+        AWS_LOG(LogLevel::Trace, "LoggingTest_testStatementsAboveThresholdAreCompiledOut", "test trace level %d", CountEvaluation(evaluations));
+    }
+
+    ASSERT_EQ(2, evaluations);
+    Aws::Vector<Aws::String> loggedStatements = StringUtils::SplitOnLine(ss->str());
+    ASSERT_EQ(2u, loggedStatements.size());
+    ASSERT_NE(Aws::String::npos, loggedStatements[0].find("test warn level 1"));
+    ASSERT_NE(Aws::String::npos, loggedStatements[1].find("test warn stream level 2"));
+}
+
+#undef AWS_LOG_LEVEL_THRESHOLD
+#define AWS_LOG_LEVEL_THRESHOLD 6
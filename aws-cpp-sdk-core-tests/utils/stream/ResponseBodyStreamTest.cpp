@@ -0,0 +1,198 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/stream/ResponseBodyStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <condition_variable>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char ALLOCATION_TAG[] = "ResponseBodyStreamTest";
+
+TEST(ResponseBodyStreamTest, TestWriteThenRead)
+{
+    ResponseBodyStream stream;
+    ASSERT_EQ(0, stream.tellp());
+
+    Aws::String body;
+    for (int i = 0; i < 1000; ++i)
+    {
+        body += "chunk" + Aws::String(1, static_cast<char>('a' + i % 26));
+    }
+    // Written in pieces, through both put paths, so that the buffer grows a few times.
+    stream.write(body.c_str(), 100);
+    for (size_t i = 100; i < 200; ++i)
+    {
+        stream.put(body[i]);
+    }
+    stream << body.substr(200);
+
+    ASSERT_EQ(static_cast<std::streamoff>(body.size()), static_cast<std::streamoff>(stream.tellp()));
+    ASSERT_EQ(body.size(), stream.GetBuffer().GetLength());
+    ASSERT_STREQ(body.c_str(), stream.GetBuffer().GetData());
+
+    Aws::String read((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(body, read);
+    ASSERT_EQ(0u, stream.GetBuffer().GetUnreadLength());
+
+    stream.clear();
+    stream.seekg(5);
+    char buffer[4] = {};
+    stream.read(buffer, 3);
+    ASSERT_STREQ("ach", buffer);
+    ASSERT_EQ(8, stream.tellg());
+    ASSERT_EQ(body.size() - 8, stream.GetBuffer().GetUnreadLength());
+    ASSERT_STREQ(body.c_str() + 8, stream.GetBuffer().GetUnreadData());
+
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(static_cast<std::streamoff>(body.size()), static_cast<std::streamoff>(stream.tellg()));
+    stream.seekg(1, std::ios_base::end);
+    ASSERT_TRUE(stream.fail());
+}
+
+TEST(ResponseBodyStreamTest, TestReserveAvoidsGrowing)
+{
+    ResponseBodyStream stream;
+    ResponseBodyStream::ReserveIfBuffered(stream, 10000);
+    size_t capacity = stream.GetBuffer().GetCapacity();
+    ASSERT_GE(capacity, 10000u);
+
+    Aws::String body(10000, 'x');
+    stream.write(body.c_str(), 5000);
+    stream.write(body.c_str() + 5000, 5000);
+    ASSERT_EQ(capacity, stream.GetBuffer().GetCapacity());
+    ASSERT_EQ(body.size(), stream.GetBuffer().GetLength());
+
+    // Other streams are left alone.
+    Aws::StringStream stringStream;
+    ASSERT_EQ(nullptr, ResponseBodyStream::FromStream(stringStream));
+    ResponseBodyStream::ReserveIfBuffered(stringStream, 10000);
+    ASSERT_EQ(&stream, ResponseBodyStream::FromStream(stream));
+}
+
+TEST(ResponseBodyStreamTest, TestBuffersArePooledPerThread)
+{
+    const char* pooledBuffer = nullptr;
+    {
+        ResponseStream response(PooledResponseStreamFactoryMethod);
+        ResponseBodyStream::ReserveIfBuffered(response.GetUnderlyingStream(), 4096);
+        response.GetUnderlyingStream() << "first body";
+        pooledBuffer = ResponseBodyStream::FromStream(response.GetUnderlyingStream())->GetBuffer().GetData();
+    }
+
+    // The next stream created on this thread gets the storage of the previous one, cleared.
+    ResponseStream response(DefaultResponseStreamFactoryMethod);
+    ResponseBodyStream* bodyStream = ResponseBodyStream::FromStream(response.GetUnderlyingStream());
+    ASSERT_NE(nullptr, bodyStream);
+    ASSERT_FALSE(bodyStream->IsOwnedByCaller());
+    ASSERT_EQ(0u, bodyStream->GetBuffer().GetLength());
+    ASSERT_GE(bodyStream->GetBuffer().GetCapacity(), 4096u);
+    response.GetUnderlyingStream() << "second body";
+    ASSERT_EQ(pooledBuffer, bodyStream->GetBuffer().GetData());
+    ASSERT_STREQ("second body", bodyStream->GetBuffer().GetData());
+}
+
+TEST(ResponseBodyStreamTest, TestCleanupFreesTheBuffersPooledByAllThreads)
+{
+    std::mutex lock;
+    std::condition_variable signal;
+    bool pooled = false;
+    bool cleanedUp = false;
+    size_t capacityAfterCleanup = 1;
+    size_t capacityAfterRelease = 1;
+
+    // The worker thread is still alive when the pools are cleaned up, as the threads of an executor would be.
+    std::thread worker([&]()
+    {
+        {
+            ResponseStream response(PooledResponseStreamFactoryMethod);
+            ResponseBodyStream::ReserveIfBuffered(response.GetUnderlyingStream(), 4096);
+        }
+        std::unique_lock<std::mutex> locker(lock);
+        pooled = true;
+        signal.notify_all();
+        signal.wait(locker, [&]() { return cleanedUp; });
+
+        {
+            ResponseStream response(PooledResponseStreamFactoryMethod);
+            capacityAfterCleanup = ResponseBodyStream::FromStream(response.GetUnderlyingStream())->GetBuffer().GetCapacity();
+            ResponseBodyStream::ReserveIfBuffered(response.GetUnderlyingStream(), 4096);
+        }
+        // Streams destroyed until pooling is resumed free their buffers.
+        ResponseStream response(PooledResponseStreamFactoryMethod);
+        capacityAfterRelease = ResponseBodyStream::FromStream(response.GetUnderlyingStream())->GetBuffer().GetCapacity();
+    });
+
+    {
+        std::unique_lock<std::mutex> locker(lock);
+        signal.wait(locker, [&]() { return pooled; });
+        CleanupResponseBufferPools();
+        cleanedUp = true;
+        signal.notify_all();
+    }
+    worker.join();
+    InitResponseBufferPools();
+
+    ASSERT_EQ(0u, capacityAfterCleanup);
+    ASSERT_EQ(0u, capacityAfterRelease);
+}
+
+TEST(ResponseBodyStreamTest, TestSinkIsReusedAcrossResponses)
+{
+    ResponseBodySink sink(1024);
+    auto factory = sink.GetFactory();
+    const char* storage = sink.GetBuffer().GetData();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ResponseStream response(factory);
+        ASSERT_EQ(&sink, &response.GetUnderlyingStream());
+        ASSERT_EQ(0, response.GetUnderlyingStream().tellp());
+
+        response.GetUnderlyingStream() << "{\"call\":" << i << "}";
+        Aws::String body((std::istreambuf_iterator<char>(response.GetUnderlyingStream())), std::istreambuf_iterator<char>());
+        ASSERT_EQ("{\"call\":" + Aws::String(1, static_cast<char>('0' + i)) + "}", body);
+        // Reading to the end sets eof, the factory clears it for the next response.
+        response.GetUnderlyingStream().get();
+        ASSERT_TRUE(response.GetUnderlyingStream().eof());
+    }
+
+    // Released responses leave the sink and its storage to the caller.
+    ASSERT_EQ(storage, sink.GetBuffer().GetData());
+    ASSERT_GE(sink.GetBuffer().GetCapacity(), 1024u);
+}
+
+TEST(ResponseBodyStreamTest, TestParsersReadBodyInPlace)
+{
+    auto jsonStream = Aws::MakeShared<ResponseBodyStream>(ALLOCATION_TAG);
+    *jsonStream << "{\"TableName\":\"table\",\"Count\":3}";
+    Json::JsonValue json(*jsonStream);
+    ASSERT_TRUE(json.WasParseSuccessful());
+    ASSERT_EQ("table", json.View().GetString("TableName"));
+    ASSERT_EQ(3, json.View().GetInteger("Count"));
+    ASSERT_EQ(0u, jsonStream->GetBuffer().GetUnreadLength());
+
+    ResponseBodyStream invalidJsonStream;
+    invalidJsonStream << "{\"TableName\":";
+    Json::JsonValue invalidJson(invalidJsonStream);
+    ASSERT_FALSE(invalidJson.WasParseSuccessful());
+
+    ResponseBodyStream xmlStream;
+    xmlStream << "<?xml version=\"1.0\"?><Result><Key>object</Key></Result>";
+    Xml::XmlDocument xml = Xml::XmlDocument::CreateFromXmlStream(xmlStream);
+    ASSERT_TRUE(xml.WasParseSuccessful());
+    ASSERT_EQ("object", xml.GetRootElement().FirstChild("Key").GetText());
+    ASSERT_EQ(0u, xmlStream.GetBuffer().GetUnreadLength());
+}
@@ -0,0 +1,205 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/threading/TaskFunction.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <condition_variable>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    // Blocks until count tasks called Done.
+    class CompletionLatch
+    {
+    public:
+        CompletionLatch(size_t count) : m_remaining(count) {}
+
+        void Done()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            if (--m_remaining == 0)
+            {
+                m_signal.notify_all();
+            }
+        }
+
+        bool Wait(std::chrono::milliseconds timeout)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            return m_signal.wait_for(locker, timeout, [this] { return m_remaining == 0; });
+        }
+
+    private:
+        size_t m_remaining;
+        std::mutex m_lock;
+        std::condition_variable m_signal;
+    };
+}
+
+TEST(TaskFunctionTest, StoresSmallCallablesInline)
+{
+    int calls = 0;
+    TaskFunction small([&calls] { calls++; });
+    ASSERT_TRUE(small.IsInline());
+
+    char largeCapture[256] = {};
+    TaskFunction large([&calls, largeCapture] { calls += 1 + largeCapture[0]; });
+    ASSERT_FALSE(large.IsInline());
+
+    TaskFunction moved(std::move(large));
+    ASSERT_FALSE(static_cast<bool>(large));
+    small();
+    moved();
+    ASSERT_EQ(2, calls);
+}
+
+TEST(TaskFunctionTest, AcceptsMoveOnlyCallables)
+{
+    auto value = Aws::MakeUnique<int>("TaskFunctionTest", 42);
+    int result = 0;
+    struct MoveOnlyTask
+    {
+        Aws::UniquePtr<int> value;
+        int* result;
+        void operator()() { *result = *value; }
+    };
+    MoveOnlyTask moveOnlyTask{ std::move(value), &result };
+
+    TaskFunction task(std::move(moveOnlyTask));
+    TaskFunction assigned;
+    assigned = std::move(task);
+    assigned();
+    ASSERT_EQ(42, result);
+}
+
+TEST(WorkStealingThreadExecutorTest, RunsAllSubmittedTasks)
+{
+    static const size_t TASK_COUNT = 10000;
+    std::atomic<size_t> sum(0);
+    CompletionLatch latch(TASK_COUNT);
+    {
+        WorkStealingThreadExecutor executor(4);
+        for (size_t i = 0; i < TASK_COUNT; ++i)
+        {
+            ASSERT_TRUE(executor.Submit([&sum, &latch, i] { sum += i; latch.Done(); }));
+        }
+        ASSERT_TRUE(latch.Wait(std::chrono::seconds(30)));
+    }
+    ASSERT_EQ(TASK_COUNT * (TASK_COUNT - 1) / 2, sum.load());
+}
+
+TEST(WorkStealingThreadExecutorTest, IdleWorkersStealFromBusyOnes)
+{
+    static const size_t WORKER_COUNT = 4;
+    Semaphore blockFirstTask(0, 1);
+    CompletionLatch latch(WORKER_COUNT * 4);
+    WorkStealingThreadExecutor executor(WORKER_COUNT);
+
+    // The first task blocks its worker, the tasks queued behind it on the same deque can only run if they get stolen.
+    std::atomic<bool> firstTaskStarted(false);
+    executor.Submit([&] {
+        firstTaskStarted = true;
+        executor.Submit([&latch] { latch.Done(); });
+        executor.Submit([&latch] { latch.Done(); });
+        blockFirstTask.WaitOne();
+    });
+
+    for (size_t i = 0; i < WORKER_COUNT * 4 - 2; ++i)
+    {
+        executor.Submit([&latch] { latch.Done(); });
+    }
+    ASSERT_TRUE(latch.Wait(std::chrono::seconds(30)));
+    ASSERT_TRUE(firstTaskStarted.load());
+    blockFirstTask.Release();
+}
+
+TEST(WorkStealingThreadExecutorTest, RejectsTasksWhenFullWithRejectPolicy)
+{
+    Semaphore blockWorker(0, 1);
+    Semaphore workerStarted(0, 1);
+    WorkStealingThreadExecutor executor(1, OverflowPolicy::REJECT_IMMEDIATELY);
+    ASSERT_TRUE(executor.Submit([&] { workerStarted.Release(); blockWorker.WaitOne(); }));
+    workerStarted.WaitOne();
+
+    ASSERT_TRUE(executor.Submit([] {}));
+    ASSERT_FALSE(executor.Submit([] {}));
+    blockWorker.Release();
+}
+
+TEST(WorkStealingThreadExecutorTest, SubmitsMoveOnlyTasksToAnyExecutor)
+{
+    struct MoveOnlyTask
+    {
+        Aws::UniquePtr<int> value;
+        Semaphore* done;
+        std::atomic<int>* result;
+        void operator()() { *result = *value; done->Release(); }
+    };
+
+    WorkStealingThreadExecutor workStealingExecutor(2);
+    PooledThreadExecutor pooledExecutor(2);
+    Executor* executors[] = { &workStealingExecutor, &pooledExecutor };
+    for (auto executor : executors)
+    {
+        Semaphore done(0, 1);
+        std::atomic<int> result(0);
+        MoveOnlyTask task{ Aws::MakeUnique<int>("WorkStealingThreadExecutorTest", 7), &done, &result };
+        ASSERT_TRUE(executor->Submit(TaskFunction(std::move(task))));
+        done.WaitOne();
+        ASSERT_EQ(7, result.load());
+    }
+}
+
+TEST(WorkStealingThreadExecutorTest, PinsWorkersToCpus)
+{
+    CompletionLatch latch(64);
+    WorkStealingThreadExecutor executor(2, OverflowPolicy::QUEUE_TASKS_EVENLY_ACCROSS_THREADS, true /*pinWorkersToCpus*/);
+    for (size_t i = 0; i < 64; ++i)
+    {
+        executor.Submit([&latch] { latch.Done(); });
+    }
+    ASSERT_TRUE(latch.Wait(std::chrono::seconds(30)));
+}
+
+template<typename EXECUTOR_TYPE>
+static double MeasureTasksPerSecond(size_t threadCount, size_t taskCount)
+{
+    CompletionLatch latch(taskCount);
+    std::atomic<size_t> counter(0);
+    EXECUTOR_TYPE executor(threadCount);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < taskCount; ++i)
+    {
+        executor.Submit([&counter, &latch] { counter++; latch.Done(); });
+    }
+    EXPECT_TRUE(latch.Wait(std::chrono::seconds(60)));
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(taskCount, counter.load());
+    return taskCount * 1000000.0 / (std::max)(elapsed.count(), static_cast<std::chrono::microseconds::rep>(1));
+}
+
+// Not a correctness test, run it with --gtest_also_run_disabled_tests to compare the executors.
+TEST(WorkStealingThreadExecutorTest, DISABLED_ThroughputMicroBenchmark)
+{
+    static const size_t TASK_COUNT = 20000;
+    static const size_t THREAD_COUNTS[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+    for (size_t threadCount : THREAD_COUNTS)
+    {
+        double pooled = MeasureTasksPerSecond<PooledThreadExecutor>(threadCount, TASK_COUNT);
+        double workStealing = MeasureTasksPerSecond<WorkStealingThreadExecutor>(threadCount, TASK_COUNT);
+        std::cout << "threads: " << threadCount << ", PooledThreadExecutor: " << static_cast<size_t>(pooled)
+                  << " tasks/s, WorkStealingThreadExecutor: " << static_cast<size_t>(workStealing) << " tasks/s" << std::endl;
+    }
+}
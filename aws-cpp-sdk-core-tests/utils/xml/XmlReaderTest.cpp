@@ -0,0 +1,360 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <chrono>
+#include <iostream>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Xml;
+
+namespace
+{
+    // Shaped like the code generated for a service result, to check the reader supports that access pattern.
+    struct Item
+    {
+        Item() : m_size(0), m_sizeHasBeenSet(false), m_nameHasBeenSet(false) {}
+        Item(XmlReader& reader) : Item() { *this = reader; }
+
+        Item& operator=(XmlReader& reader)
+        {
+            m_id = reader.GetAttribute("id");
+            if (reader.StartElement())
+            {
+                while (reader.NextChild())
+                {
+                    if (reader.NameEquals("Name"))
+                    {
+                        m_name = reader.ReadText();
+                        m_nameHasBeenSet = true;
+                    }
+                    else if (reader.NameEquals("Size"))
+                    {
+                        m_size = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+                        m_sizeHasBeenSet = true;
+                    }
+                    else if (reader.NameEquals("Tags") && reader.StartElement())
+                    {
+                        while (reader.NextChild())
+                        {
+                            if (reader.NameEquals("entry") && reader.StartElement())
+                            {
+                                Aws::String key;
+                                Aws::String value;
+                                while (reader.NextChild())
+                                {
+                                    if (reader.NameEquals("key"))
+                                    {
+                                        key = reader.ReadText();
+                                    }
+                                    else if (reader.NameEquals("value"))
+                                    {
+                                        value = reader.ReadText();
+                                    }
+                                }
+                                m_tags[key] = value;
+                            }
+                        }
+                    }
+                }
+            }
+            return *this;
+        }
+
+        Aws::String m_id;
+        Aws::String m_name;
+        long long m_size;
+        Aws::Map<Aws::String, Aws::String> m_tags;
+        bool m_sizeHasBeenSet;
+        bool m_nameHasBeenSet;
+    };
+
+    struct ListItemsResult
+    {
+        ListItemsResult(XmlReader& reader)
+        {
+            if (reader.NextChild() && reader.StartElement())
+            {
+                while (reader.NextChild())
+                {
+                    if (reader.NameEquals("ListItemsResult") && reader.StartElement())
+                    {
+                        while (reader.NextChild())
+                        {
+                            if (reader.NameEquals("Items") && reader.StartElement())
+                            {
+                                while (reader.NextChild())
+                                {
+                                    if (reader.NameEquals("member"))
+                                    {
+                                        m_items.push_back(Item(reader));
+                                    }
+                                }
+                            }
+                            else if (reader.NameEquals("NextToken"))
+                            {
+                                m_nextToken = reader.ReadText();
+                            }
+                        }
+                    }
+                    else if (reader.NameEquals("ResponseMetadata") && reader.StartElement())
+                    {
+                        while (reader.NextChild())
+                        {
+                            if (reader.NameEquals("RequestId"))
+                            {
+                                m_requestId = reader.ReadText();
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        Aws::Vector<Item> m_items;
+        Aws::String m_nextToken;
+        Aws::String m_requestId;
+    };
+}
+
+TEST(XmlReaderTest, TestReadsGeneratedModelShape)
+{
+    const char* text =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ListItemsResponse xmlns=\"https://example.amazonaws.com/doc/2020-01-01/\">\n"
+        "  <ListItemsResult>\n"
+        "    <Items>\n"
+        "      <member id=\"first\"><Name>alpha</Name><Size>10</Size><Unknown><Nested>x</Nested></Unknown>\n"
+        "        <Tags><entry><key>owner</key><value>team</value></entry><entry><value>a &amp; b</value><key>cost</key></entry></Tags>\n"
+        "      </member>\n"
+        "      <!-- a comment -->\n"
+        "      <member id='second'><Size> 20 </Size><Name/></member>\n"
+        "    </Items>\n"
+        "    <NextToken>token</NextToken>\n"
+        "  </ListItemsResult>\n"
+        "  <ResponseMetadata><RequestId>request-id</RequestId></ResponseMetadata>\n"
+        "</ListItemsResponse>\n";
+
+    XmlReader reader(text, strlen(text));
+    ASSERT_TRUE(reader.Validate());
+    ListItemsResult result(reader);
+    ASSERT_TRUE(reader.WasParseSuccessful());
+
+    ASSERT_EQ(2u, result.m_items.size());
+    ASSERT_STREQ("first", result.m_items[0].m_id.c_str());
+    ASSERT_STREQ("alpha", result.m_items[0].m_name.c_str());
+    ASSERT_EQ(10, result.m_items[0].m_size);
+    ASSERT_EQ(2u, result.m_items[0].m_tags.size());
+    ASSERT_STREQ("team", result.m_items[0].m_tags["owner"].c_str());
+    ASSERT_STREQ("a & b", result.m_items[0].m_tags["cost"].c_str());
+
+    ASSERT_STREQ("second", result.m_items[1].m_id.c_str());
+    ASSERT_EQ(20, result.m_items[1].m_size);
+    ASSERT_TRUE(result.m_items[1].m_nameHasBeenSet);
+    ASSERT_STREQ("", result.m_items[1].m_name.c_str());
+
+    ASSERT_STREQ("token", result.m_nextToken.c_str());
+    ASSERT_STREQ("request-id", result.m_requestId.c_str());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestDecodesTextAndAttributes)
+{
+    const char* text = "<Root a=\"x &lt; y\" b='&#65;&#x42;'>one &quot;two&quot; &apos;three&apos; &#x20AC; &bogus; &amp;amp;"
+                       "<![CDATA[<raw & text>]]>\r\nend</Root>";
+    XmlReader reader(text, strlen(text));
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.NameEquals("Root"));
+    ASSERT_STREQ("Root", reader.GetName().c_str());
+    ASSERT_STREQ("x < y", reader.GetAttribute("a").c_str());
+    ASSERT_STREQ("AB", reader.GetAttribute("b").c_str());
+    ASSERT_STREQ("", reader.GetAttribute("c").c_str());
+    ASSERT_STREQ("one \"two\" 'three' \xE2\x82\xAC &bogus; &amp;<raw & text>\nend", reader.ReadText().c_str());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestReadTextSkipsNestedElements)
+{
+    const char* text = "<Root>before<Child>inner<Grandchild>deep</Grandchild></Child>after</Root>";
+    XmlReader reader(text, strlen(text));
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_STREQ("beforeafter", reader.ReadText().c_str());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestUnreadElementsAreSkipped)
+{
+    const char* text = "<Root><Skipped><Deep><Deeper/></Deep></Skipped><Empty/><Kept>value</Kept></Root>";
+    XmlReader reader(text, strlen(text));
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.StartElement());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.NameEquals("Skipped"));
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.NameEquals("Empty"));
+    ASSERT_TRUE(reader.StartElement());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.NameEquals("Kept"));
+    ASSERT_STREQ("value", reader.ReadText().c_str());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestCopiesContinueIndependently)
+{
+    XmlReader reader(Aws::String("<Root><First>1</First><Second>2</Second></Root>"));
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.StartElement());
+    ASSERT_TRUE(reader.NextChild());
+
+    XmlReader copy(reader);
+    ASSERT_STREQ("1", reader.ReadText().c_str());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_STREQ("2", reader.ReadText().c_str());
+
+    ASSERT_TRUE(copy.NameEquals("First"));
+    ASSERT_TRUE(copy.NextChild());
+    ASSERT_TRUE(copy.NameEquals("Second"));
+}
+
+TEST(XmlReaderTest, TestReadsFromStream)
+{
+    Aws::StringStream ss;
+    ss << "<Root><Value>streamed</Value></Root>";
+    XmlReader reader(ss);
+    ASSERT_TRUE(reader.Validate());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.StartElement());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_STREQ("streamed", reader.ReadText().c_str());
+}
+
+TEST(XmlReaderTest, TestValidateRejectsMalformedText)
+{
+    const char* malformed[] = {
+        "",
+        "   ",
+        "<Root>",
+        "<Root></Other>",
+        "<Root><Child></Root>",
+        "<Root></Root><Second/>",
+        "<Root attr=\"unterminated></Root>",
+        "<Root><!-- unterminated </Root>",
+        "<Root><![CDATA[ unterminated </Root>",
+        "</Root>",
+        "<>text</>"
+    };
+    for (const char* text : malformed)
+    {
+        XmlReader reader(text, strlen(text));
+        ASSERT_FALSE(reader.Validate()) << text;
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+    }
+
+    const char* wellFormed[] = {
+        "<Root/>",
+        "\xEF\xBB\xBF<?xml version=\"1.0\"?><!DOCTYPE Root [<!ENTITY e \"x\">]><!-- comment --><Root a=\"1\"><ns:Child b='>'/></Root>\n"
+    };
+    for (const char* text : wellFormed)
+    {
+        XmlReader reader(text, strlen(text));
+        ASSERT_TRUE(reader.Validate()) << reader.GetErrorMessage();
+    }
+}
+
+TEST(XmlReaderTest, TestErrorsStopIteration)
+{
+    const char* text = "<Root><First>1</First><Second></Root>";
+    XmlReader reader(text, strlen(text));
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.StartElement());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_STREQ("1", reader.ReadText().c_str());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_FALSE(reader.WasParseSuccessful());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_FALSE(reader.StartElement());
+}
+
+TEST(XmlReaderTest, TestEmptyReader)
+{
+    XmlReader reader;
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_FALSE(reader.StartElement());
+    ASSERT_TRUE(reader.ReadText().empty());
+    ASSERT_FALSE(reader.Validate());
+}
+
+// Not a correctness test, run it with --gtest_also_run_disabled_tests to compare XmlReader with XmlDocument.
+TEST(XmlReaderTest, DISABLED_ReaderVersusDomMicroBenchmark)
+{
+    Aws::StringStream ss;
+    ss << "<ListItemsResponse><ListItemsResult><Items>";
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        ss << "<member id=\"" << i << "\"><Name>item-" << i << "</Name><Size>" << i * 1000
+           << "</Size><Tags><entry><key>owner</key><value>team</value></entry></Tags></member>";
+    }
+    ss << "</Items><NextToken>token</NextToken></ListItemsResult>"
+       << "<ResponseMetadata><RequestId>request-id</RequestId></ResponseMetadata></ListItemsResponse>";
+    const Aws::String text = ss.str();
+
+    static const size_t ITERATIONS = 20;
+    size_t domItems = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i)
+    {
+        // Same work as the code generated for XmlDocument results.
+        XmlDocument document = XmlDocument::CreateFromXmlString(text);
+        XmlNode resultNode = document.GetRootElement().FirstChild("ListItemsResult");
+        Aws::Vector<Item> result;
+        XmlNode member = resultNode.FirstChild("Items").FirstChild("member");
+        while (!member.IsNull())
+        {
+            Item item;
+            item.m_id = member.GetAttributeValue("id");
+            item.m_name = DecodeEscapedXmlText(member.FirstChild("Name").GetText());
+            item.m_size = StringUtils::ConvertToInt64(StringUtils::Trim(member.FirstChild("Size").GetText().c_str()).c_str());
+            XmlNode entry = member.FirstChild("Tags").FirstChild("entry");
+            while (!entry.IsNull())
+            {
+                item.m_tags[entry.FirstChild("key").GetText()] = entry.FirstChild("value").GetText();
+                entry = entry.NextNode("entry");
+            }
+            result.push_back(item);
+            member = member.NextNode("member");
+        }
+        domItems += result.size();
+    }
+    auto domElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    size_t readerItems = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i)
+    {
+        XmlReader reader(text.c_str(), text.size());
+        reader.Validate();
+        ListItemsResult result(reader);
+        readerItems += result.m_items.size();
+    }
+    auto readerElapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    ASSERT_EQ(domItems, readerItems);
+    std::cout << "XmlDocument: " << domElapsed.count() / ITERATIONS << " us/document, XmlReader: "
+              << readerElapsed.count() / ITERATIONS << " us/document" << std::endl;
+}
@@ -14,6 +14,7 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/RequestCompression.h>
 
 namespace Aws
 {
@@ -150,6 +151,27 @@ namespace Aws
          */
         inline virtual bool ShouldComputeContentMd5() const { return false; }
 
+        /**
+         * Algorithm the body of this request is compressed with, when the client configuration enables request compression and the body
+         * is large enough: the one set with SetRequestCompressionAlgorithm, otherwise the default of the operation.
+         */
+        Aws::Client::CompressionAlgorithm GetRequestCompressionAlgorithm() const
+        {
+            return m_requestCompressionAlgorithmHasBeenSet ? m_requestCompressionAlgorithm : GetDefaultRequestCompressionAlgorithm();
+        }
+        /**
+         * Opt this request in, or out with NONE, of compressing its body. Only use an algorithm the service accepts for the operation.
+         */
+        void SetRequestCompressionAlgorithm(Aws::Client::CompressionAlgorithm algorithm)
+        {
+            m_requestCompressionAlgorithm = algorithm;
+            m_requestCompressionAlgorithmHasBeenSet = true;
+        }
+        /**
+         * Defaults to NONE, operations accepting compressed bodies override this to return the algorithm they accept.
+         */
+        virtual Aws::Client::CompressionAlgorithm GetDefaultRequestCompressionAlgorithm() const { return Aws::Client::CompressionAlgorithm::NONE; }
+
         virtual const char* GetServiceRequestName() const = 0;
 
     protected:
@@ -167,6 +189,8 @@ namespace Aws
         Aws::Http::ContinueRequestHandler m_continueRequest;
         RequestSignedHandler m_onRequestSigned;
         RequestRetryHandler m_requestRetryHandler;
+        Aws::Client::CompressionAlgorithm m_requestCompressionAlgorithm;
+        bool m_requestCompressionAlgorithmHasBeenSet;
     };
 
 } // namespace Aws
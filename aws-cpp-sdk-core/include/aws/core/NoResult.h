@@ -6,6 +6,8 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 namespace Aws
 {
@@ -27,6 +29,8 @@ public:
     NoResult() {};
     NoResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>&) {};
     NoResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>&) {};
+    NoResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonReader>&) {};
+    NoResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlReader>&) {};
 };
 
 } // namespace Aws
@@ -10,6 +10,7 @@
 #include <aws/core/Region.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/threading/ReaderWriterLock.h>
@@ -117,6 +118,12 @@ namespace Aws
              */
             virtual bool SignEventMessage(Aws::Utils::Event::Message&, Aws::String& /* priorSignature */) const { return false; }
 
+            /**
+             * Returns true if signing request, with the same signBody, hashes its body with sha256.
+             * The client then computes that hash in the same pass over the body as its other digests, and passes it on with HttpRequest::SetPayloadHash.
+             */
+            virtual bool ShouldSignPayload(const Aws::Http::HttpRequest& /* request */, bool /* signBody */) const { return false; }
+
             /**
              * Takes a request and signs the URI based on the HttpMethod, URI and other info from the request.
              * The URI can then be used in a normal HTTP call until expiration.
@@ -243,6 +250,11 @@ namespace Aws
              */
             bool SignRequest(Aws::Http::HttpRequest& request, const char* region, const char* serviceName, bool signBody) const override;
 
+            /**
+             * The body is signed if the payload signing policy or signBody asks for it, and always over plain http.
+             */
+            bool ShouldSignPayload(const Aws::Http::HttpRequest& request, bool signBody) const override;
+
             /**
             * Takes a request and signs the URI based on the HttpMethod, URI and other info from the request.
             * the region the signer was initialized with will be used for the signature.
@@ -296,6 +308,22 @@ namespace Aws
             Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey,
                     const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
 
+            /**
+             * Signing key derived for one region and service, for m_currentSecretKey and m_currentDateStr.
+             */
+            struct DerivedKey
+            {
+                Aws::String region;
+                Aws::String serviceName;
+                Aws::Utils::ByteBuffer key;
+            };
+
+            // Must be called with m_partialSignatureLock held.
+            const Aws::Utils::ByteBuffer* FindDerivedKey(const Aws::String& secretKey,
+                    const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
+            // Must be called with m_partialSignatureLock held as a writer.
+            const Aws::Utils::ByteBuffer* CacheDerivedKey(const Aws::String& secretKey,
+                    const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
 
             std::shared_ptr<Auth::AWSCredentialsProvider> m_credentialsProvider;
             const Aws::String m_serviceName;
@@ -308,7 +336,9 @@ namespace Aws
             //these next four fields are ONLY for caching purposes and do not change
             //the logical state of the signer. They are marked mutable so the
             //interface can remain const.
-            mutable Aws::Utils::ByteBuffer m_partialSignature;
+            //Derived keys are kept per region and service so signer overrides for other regions don't evict each other,
+            //all of them are dropped when the secret key or the date changes.
+            mutable Aws::Vector<DerivedKey> m_derivedKeys;
             mutable Aws::String m_currentDateStr;
             mutable Aws::String m_currentSecretKey;
             mutable Utils::Threading::ReaderWriterLock m_partialSignatureLock;
@@ -14,6 +14,7 @@
 #include <aws/core/utils/threading/ReaderWriterLock.h>
 #include <aws/core/internal/AWSHttpResourceClient.h>
 #include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/auth/RefreshingCredentialsCache.h>
 #include <aws/core/config/AWSProfileConfigLoader.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <memory>
@@ -191,7 +192,8 @@ namespace Aws
 
         /**
         * Credentials provider implementation that loads credentials from the Amazon
-        * EC2 Instance Metadata Service.
+        * EC2 Instance Metadata Service. The credentials are refreshed in the background, GetAWSCredentials only waits on the
+        * metadata service the first time, or if the background refresh failed until the credentials expired.
         */
         class AWS_CORE_API InstanceProfileCredentialsProvider : public AWSCredentialsProvider
         {
@@ -217,15 +219,18 @@ namespace Aws
             void Reload() override;
 
         private:
-            void RefreshIfExpired();
+            bool LoadCredentials(AWSCredentials& credentials);
 
             std::shared_ptr<Aws::Config::AWSProfileConfigLoader> m_ec2MetadataConfigLoader;
             long m_loadFrequencyMs;
+            // Declared last so that its refresh thread stops before the members it loads with are destroyed.
+            RefreshingCredentialsCache m_credentialsCache;
         };
 
         /**
         * ECS credentials provider implementation that loads credentials from the Amazon
-        * ECS metadata service or an arbitrary endpoint.
+        * ECS metadata service or an arbitrary endpoint. The credentials are refreshed in the background before they expire,
+        * GetAWSCredentials only waits on the endpoint the first time, or if the background refresh failed until they expired.
         */
         class AWS_CORE_API TaskRoleCredentialsProvider : public AWSCredentialsProvider
         {
@@ -262,13 +267,13 @@ namespace Aws
         protected:
             void Reload() override;
         private:
-            bool ExpiresSoon() const;
-            void RefreshIfExpired();
+            bool LoadCredentials(AWSCredentials& credentials);
 
         private:
             std::shared_ptr<Aws::Internal::ECSCredentialsClient> m_ecsCredentialsClient;
             long m_loadFrequencyMs;
-            Aws::Auth::AWSCredentials m_credentials;
+            // Declared last so that its refresh thread stops before the members it loads with are destroyed.
+            RefreshingCredentialsCache m_credentialsCache;
         };
 
         /**
@@ -0,0 +1,140 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/auth/AWSCredentials.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        /**
+         * Credentials expiring within this many milliseconds are refreshed ahead by default.
+         */
+        constexpr long DEFAULT_CREDENTIALS_PREFETCH_WINDOW_MS = 1000 * 60 * 5;
+
+        /**
+         * The background refresh stops by default once the credentials weren't read for this many milliseconds.
+         */
+        constexpr long DEFAULT_CREDENTIALS_REFRESH_IDLE_TIMEOUT_MS = 1000 * 60 * 10;
+
+        /**
+         * Lets the caches refresh their credentials in the background, called by Aws::InitAPI.
+         */
+        AWS_CORE_API void InitRefreshingCredentialsCaches();
+
+        /**
+         * Stops the background refresh of all the caches, waiting for the loads in progress, called by Aws::ShutdownAPI
+         * before the HTTP clients are cleaned up.
+         */
+        AWS_CORE_API void CleanupRefreshingCredentialsCaches();
+
+        /**
+         * Cache of expiring credentials fetched over the network, for providers whose GetAWSCredentials is called on every signed request.
+         * The credentials are published as immutable snapshots: reading them only loads a shared pointer, it never waits on a load.
+         * A background thread, started by the first load, fetches new credentials before the current ones expire or are due
+         * for refresh. While those loads fail the current credentials keep being served, retrying with backoff, as long as they are valid.
+         * Callers only load credentials themselves, one at a time, when there are none yet or the cached ones expired.
+         *
+         * The thread stops once the credentials weren't read for the idle timeout, and starts again on the next read.
+         * Aws::ShutdownAPI stops the threads of all the caches before cleaning up the HTTP clients they load with,
+         * the credentials are then only loaded by the callers until Aws::InitAPI is called again.
+         */
+        class AWS_CORE_API RefreshingCredentialsCache
+        {
+        public:
+            /**
+             * Fetches credentials into credentials, returns false if it failed. Only ever called by one thread at a time.
+             */
+            typedef std::function<bool(AWSCredentials& credentials)> CredentialsLoader;
+
+            /**
+             * @param logTag Tag of the owning provider, used to log and allocate.
+             * @param loader Fetches the credentials, it must stay valid until the cache is destroyed.
+             * @param refreshRateMs Credentials are refreshed at least this often, whatever their expiration.
+             * @param prefetchWindowMs Credentials are refreshed when they expire within this many milliseconds.
+             * @param idleTimeoutMs The background refresh stops when the credentials weren't read for this many milliseconds.
+             */
+            RefreshingCredentialsCache(const char* logTag, const CredentialsLoader& loader, long refreshRateMs,
+                long prefetchWindowMs = DEFAULT_CREDENTIALS_PREFETCH_WINDOW_MS, long idleTimeoutMs = DEFAULT_CREDENTIALS_REFRESH_IDLE_TIMEOUT_MS);
+
+            /**
+             * Stops the background refresh, waiting for a load in progress to finish.
+             */
+            ~RefreshingCredentialsCache();
+
+            /**
+             * Returns the current credentials, or empty credentials if none could be loaded.
+             */
+            AWSCredentials GetCredentials();
+
+            /**
+             * Returns the current credentials snapshot, or nullptr if none could be loaded.
+             */
+            std::shared_ptr<const AWSCredentials> GetSnapshot();
+
+            /**
+             * Loads new credentials on the calling thread, returns false if that failed and the current ones were kept.
+             */
+            bool Refresh();
+
+            /**
+             * Returns true while the background refresh thread is running.
+             */
+            bool IsRefreshingInTheBackground() const { return m_refreshThreadStarted.load(); }
+
+        private:
+            friend void CleanupRefreshingCredentialsCaches();
+
+            RefreshingCredentialsCache(const RefreshingCredentialsCache&) = delete;
+            RefreshingCredentialsCache& operator=(const RefreshingCredentialsCache&) = delete;
+
+            bool IsUsable(const AWSCredentials& credentials) const;
+            bool Load(uint64_t observedGeneration);
+            long long GetNextRefreshDelayMs();
+            void StartRefreshThread();
+            void StopRefreshThread();
+            void RefreshThread();
+            void Register();
+            void Unregister();
+
+            const char* m_logTag;
+            CredentialsLoader m_loader;
+            long m_refreshRateMs;
+            long m_prefetchWindowMs;
+            long m_idleTimeoutMs;
+
+            // Only read and replaced with std::atomic_load and std::atomic_store.
+            std::shared_ptr<const AWSCredentials> m_snapshot;
+            // Incremented by every load, lets callers that waited on a load skip theirs.
+            std::atomic<uint64_t> m_generation;
+            // Time of the last read, the refresh thread stops when it is older than the idle timeout.
+            std::atomic<int64_t> m_lastReadMs;
+
+            // Serializes loads, guards the load statistics below.
+            std::mutex m_loadMutex;
+            int m_consecutiveFailures;
+
+            std::mutex m_refreshMutex;
+            std::condition_variable m_refreshSignal;
+            bool m_stopRefreshing;
+            std::atomic<bool> m_refreshThreadStarted;
+            std::thread m_refreshThread;
+
+            // Links of the list of all the caches, guarded by the lock of the list.
+            RefreshingCredentialsCache* m_previousCache;
+            RefreshingCredentialsCache* m_nextCache;
+        };
+    } // namespace Auth
+} // namespace Aws
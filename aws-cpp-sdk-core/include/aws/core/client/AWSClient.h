@@ -7,6 +7,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RequestCompression.h>
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/AmazonWebServiceResult.h>
@@ -14,6 +15,7 @@
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 struct aws_array_list;
 
@@ -27,11 +29,13 @@ namespace Aws
         namespace Xml
         {
             class XmlDocument;
+            class XmlReader;
         } // namespace Xml
 
         namespace Json
         {
             class JsonValue;
+            class JsonReader;
         } // namespace Json
 
         namespace RateLimits
@@ -39,6 +43,11 @@ namespace Aws
             class RateLimiterInterface;
         } // namespace RateLimits
 
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+
         namespace Crypto
         {
             class MD5;
@@ -173,6 +182,8 @@ namespace Aws
             /**
              * Calls AttemptOneRequest until it either, succeeds, runs out of retries from the retry strategy,
              * or encounters and error that is not retryable.
+             * The Http Request is built once and sent again on retries with only its signature and retry headers refreshed,
+             * unless the request has a retry handler, which may modify the request between attempts.
              */
             HttpResponseOutcome AttemptExhaustively(const Aws::Http::URI& uri,
                     const Aws::AmazonWebServiceRequest& request,
@@ -195,6 +206,27 @@ namespace Aws
                     const char* signerRegionOverride = nullptr,
                     const char* signerServiceNameOverride = nullptr) const;
 
+            /**
+             * Same as AttemptExhaustively, but returns right away and calls handler with the outcome once the request succeeded or
+             * ran out of retries. The request is built and signed on the calling thread, then sent with HttpClient::MakeRequestAsync,
+             * no thread waits for the transfers: the responses are handled, the requests retried and handler called on executor.
+             * When the http client doesn't support asynchronous requests, AttemptExhaustively runs on executor instead.
+             */
+            void AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                    const std::function<void(HttpResponseOutcome&&)>& handler,
+                    Http::HttpMethod httpMethod,
+                    const char* signerName,
+                    const char* signerRegionOverride = nullptr,
+                    const char* signerServiceNameOverride = nullptr) const;
+
+            /**
+             * Returns true if the http client supports asynchronous requests, in which case service clients send their
+             * asynchronous operations with AttemptExhaustivelyAsync instead of running the synchronous ones on their executor.
+             */
+            bool SupportsAsyncRequests() const;
+
             /**
              * Build an Http Request from the AmazonWebServiceRequest object. Signs the request, sends it accross the wire
              * then reports the http response.
@@ -229,6 +261,18 @@ namespace Aws
                     const char* signerRegionOverride = nullptr,
                     const char* signerServiceNameOverride = nullptr) const;
 
+            /**
+             * Same as MakeRequestWithUnparsedResponse, but returns right away and calls handler with the outcome, see AttemptExhaustivelyAsync.
+             */
+            void MakeRequestWithUnparsedResponseAsync(const Aws::Http::URI& uri,
+                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                    const std::function<void(StreamOutcome&&)>& handler,
+                    Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                    const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                    const char* signerRegionOverride = nullptr,
+                    const char* signerServiceNameOverride = nullptr) const;
+
             /**
              * This is used for structureless response payloads (file streams, binary data etc...). It calls AttemptExhaustively, but upon
              * return transfers ownership of the underlying stream for the http response to the caller.
@@ -285,14 +329,73 @@ namespace Aws
             std::shared_ptr<Aws::Http::HttpResponse> MakeHttpRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
             Aws::String m_region;
         private:
+            /**
+             * What is kept from one attempt to send a request to the next, see AttemptExhaustively.
+             */
+            struct RequestAttempts;
+
+            /**
+             * Creates the http request of the first attempt. Returns false, with the error in the outcome of attempts, if the uri is invalid.
+             */
+            bool StartRequestAttempts(RequestAttempts& attempts) const;
+            /**
+             * Builds the http request unless it is reused from the previous attempt, then signs it.
+             * Returns false, with the error in the outcome of attempts, if it couldn't be signed.
+             */
+            bool PrepareRequestAttempt(RequestAttempts& attempts) const;
+            /**
+             * Reports the outcome of an attempt. Returns true if the request should be sent again, after sleeping for sleepMillis.
+             */
+            bool CompleteRequestAttempt(RequestAttempts& attempts, long& sleepMillis) const;
+            /**
+             * Resets or recreates the http request for the next attempt.
+             */
+            void PrepareRequestRetry(RequestAttempts& attempts) const;
+            /**
+             * Gets a send token from the retry strategy, then sends the attempt. Waiting for the token, like waiting before a retry,
+             * is done with HttpClient::ScheduleAfter rather than by blocking the executor.
+             */
+            void MakeRequestAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const;
+            void SendRequestAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const;
+            void CompleteRequestAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const;
+            void RunRequestAttemptTaskAfter(const std::shared_ptr<RequestAttempts>& attempts, long delayMillis, const std::function<void()>& task) const;
+            /**
+             * Computes the digests of the body and builds httpRequest from request.
+             */
+            void PrepareHttpRequest(const std::shared_ptr<Http::HttpRequest>& httpRequest,
+                    const Aws::AmazonWebServiceRequest& request,
+                    const char* signerName) const;
+            bool SignHttpRequest(const std::shared_ptr<Http::HttpRequest>& httpRequest,
+                    const Aws::AmazonWebServiceRequest& request,
+                    const char* signerName,
+                    const char* signerRegionOverride,
+                    const char* signerServiceNameOverride) const;
+            HttpResponseOutcome BuildHttpResponseOutcome(const std::shared_ptr<Aws::Http::HttpResponse>& httpResponse) const;
             /**
              * Try to adjust signer's clock
              * return true if signer's clock is adjusted, false otherwise.
              */
             bool AdjustClockSkew(HttpResponseOutcome& outcome, const char* signerName) const;
+            /**
+             * Signs an Http Request already built by BuildHttpRequest, sends it accross the wire then reports the http response.
+             */
+            HttpResponseOutcome SignAndMakeRequest(const std::shared_ptr<Http::HttpRequest>& httpRequest,
+                    const Aws::AmazonWebServiceRequest& request,
+                    const char* signerName,
+                    const char* signerRegionOverride,
+                    const char* signerServiceNameOverride) const;
             void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HeaderValueCollection& headerValues) const;
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const std::shared_ptr<Aws::IOStream>& body,
                                          bool needsContentMd5 = false, bool isChunked = false) const;
+            /**
+             * Sets the Content-MD5 header and the payload hash of httpRequest, reading body once for both instead of once for each.
+             */
+            void AddContentMd5AndPayloadHash(Aws::Http::HttpRequest& httpRequest, Aws::IOStream& body) const;
+            /**
+             * Returns body compressed with algorithm, as it is read if isChunked, or body itself if it is too small to compress.
+             */
+            std::shared_ptr<Aws::IOStream> CompressContentBody(Aws::Http::HttpRequest& httpRequest, const std::shared_ptr<Aws::IOStream>& body,
+                                                               CompressionAlgorithm algorithm, bool isChunked) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
             void InitializeGlobalStatics();
             std::shared_ptr<Aws::Http::HttpRequest> ConvertToRequestForPresigning(const Aws::AmazonWebServiceRequest& request, Aws::Http::URI& uri,
@@ -310,9 +413,11 @@ namespace Aws
             long m_requestTimeoutMs;
             bool m_enableClockSkewAdjustment;
             Aws::String m_serviceName;
+            RequestCompressionConfig m_requestCompressionConfig;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
+        typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonReader>, AWSError<CoreErrors>> JsonReaderOutcome;
         AWS_CORE_API Aws::String GetAuthorizationHeader(const Aws::Http::HttpRequest& httpRequest);
 
         /**
@@ -359,6 +464,18 @@ namespace Aws
                 const char* signerRegionOverride = nullptr,
                 const char* signerServiceNameOverride = nullptr) const;
 
+            /**
+             * Same as MakeRequest, but returns right away and calls handler with the outcome, see AttemptExhaustivelyAsync.
+             */
+            void MakeRequestAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                const std::function<void(JsonOutcome&&)>& handler,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                const char* signerRegionOverride = nullptr,
+                const char* signerServiceNameOverride = nullptr) const;
+
             /**
              * Returns a Json document or an error from the request. Does some marshalling json and raw streams,
              * then just calls AttemptExhaustively.
@@ -375,10 +492,45 @@ namespace Aws
                 const char* signerRegionOverride = nullptr,
                 const char* signerServiceNameOverride = nullptr) const;
 
+            /**
+             * Same as MakeRequest, but returns a pull parser over the response body instead of a parsed Json document,
+             * letting results deserialize themselves without building the document first.
+             * The body is validated before returning, so a malformed response is still reported as an error.
+             */
+            JsonReaderOutcome MakeRequestWithJsonReader(const Aws::Http::URI& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                const char* signerRegionOverride = nullptr,
+                const char* signerServiceNameOverride = nullptr) const;
+
+            /**
+             * Same as MakeRequestWithJsonReader, but returns right away and calls handler with the outcome, see AttemptExhaustivelyAsync.
+             */
+            void MakeRequestWithJsonReaderAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                const std::function<void(JsonReaderOutcome&&)>& handler,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                const char* signerRegionOverride = nullptr,
+                const char* signerServiceNameOverride = nullptr) const;
+
+            /**
+             * Same as MakeRequest, but returns a pull parser over the response body instead of a parsed Json document.
+             */
+            JsonReaderOutcome MakeRequestWithJsonReader(const Aws::Http::URI& uri,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                const char* requestName = "",
+                const char* signerRegionOverride = nullptr,
+                const char* signerServiceNameOverride = nullptr) const;
+
             JsonOutcome MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
+        typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlReader>, AWSError<CoreErrors>> XmlReaderOutcome;
 
         /**
         *  AWSClient that handles marshalling xml response bodies. You would inherit from this class
@@ -436,6 +588,40 @@ namespace Aws
                 const char* signerRegionOverride = nullptr,
                 const char* signerServiceNameOverride = nullptr) const;
 
+            /**
+             * Same as MakeRequest, but returns a pull parser over the response body instead of a parsed xml document,
+             * letting results deserialize themselves without building the document first.
+             * The body is validated before returning, so a malformed response is still reported as an error.
+             */
+            XmlReaderOutcome MakeRequestWithXmlReader(const Aws::Http::URI& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                const char* signerRegionOverride = nullptr,
+                const char* signerServiceNameOverride = nullptr) const;
+
+            /**
+             * Same as MakeRequestWithXmlReader, but returns right away and calls handler with the outcome, see AttemptExhaustivelyAsync.
+             */
+            void MakeRequestWithXmlReaderAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                const std::function<void(XmlReaderOutcome&&)>& handler,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                const char* signerRegionOverride = nullptr,
+                const char* signerServiceNameOverride = nullptr) const;
+
+            /**
+             * Same as MakeRequest, but returns a pull parser over the response body instead of a parsed xml document.
+             */
+            XmlReaderOutcome MakeRequestWithXmlReader(const Aws::Http::URI& uri,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                const char* requestName = "",
+                const char* signerRegionOverride = nullptr,
+                const char* signerServiceNameOverride = nullptr) const;
+
             /**
             * This is used for event stream response.
             */
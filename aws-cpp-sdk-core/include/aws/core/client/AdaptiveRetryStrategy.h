@@ -0,0 +1,143 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Client side rate limiter used by the adaptive retry mode.
+         * Sending a request costs a token, tokens are refilled at a rate derived from the measured send rate of the client:
+         * throttling responses cut the fill rate down, successful responses grow it back along a CUBIC curve
+         * centered on the rate at which the last throttling happened.
+         * The bucket does not limit anything until the first throttling response is received.
+         */
+        class AWS_CORE_API RetryTokenBucket
+        {
+        public:
+            /**
+             * Returns the current time, override it to control the time seen by the bucket in tests.
+             */
+            typedef std::function<Aws::Utils::DateTime()> Clock;
+
+            RetryTokenBucket();
+            RetryTokenBucket(const Clock& clock);
+            virtual ~RetryTokenBucket() = default;
+
+            /**
+             * Takes amount tokens from the bucket, blocks until they are refilled unless fastFail is set,
+             * in which case it returns false without taking anything.
+             */
+            bool Acquire(double amount = 1, bool fastFail = false);
+
+            /**
+             * Takes amount tokens from the bucket without blocking, on credit if they are not refilled yet.
+             * Returns the number of milliseconds to wait before sending, for the refill to pay the credit back.
+             */
+            long AcquireWithoutWaiting(double amount = 1);
+
+            /**
+             * Updates the measured send rate and the fill rate of the bucket with the result of a request.
+             */
+            void UpdateClientSendingRate(bool isThrottlingResponse);
+
+            bool IsEnabled() const;
+            double GetFillRate() const;
+            double GetMeasuredTxRate() const;
+            double GetCurrentCapacity() const;
+
+        protected:
+            virtual double CUBICSuccess(double timestamp) const;
+            virtual double CUBICThrottle(double rateToUse) const;
+
+        private:
+            double GetCurrentTimeInSeconds() const;
+            void Refill(double timestamp);
+            void UpdateRate(double newRps, double timestamp);
+            void UpdateMeasuredRate(double timestamp);
+            void CalculateTimeWindow();
+
+            Clock m_clock;
+            mutable std::mutex m_lock;
+
+            double m_fillRate;
+            double m_maxCapacity;
+            double m_currentCapacity;
+            double m_lastTimestamp;
+            double m_measuredTxRate;
+            double m_lastTxRateBucket;
+            size_t m_requestCount;
+            bool m_enabled;
+            double m_lastMaxRate;
+            double m_lastThrottleTime;
+            double m_timeWindow;
+        };
+
+        /**
+         * Standard retry mode with client side rate limiting: GetSendToken takes a token out of a RetryTokenBucket before every attempt,
+         * so a client that keeps getting throttled slows itself down instead of spending its retry quota.
+         * Strategies constructed with the same service name share their bucket, and so their view of the service's send rate,
+         * across every client of that service in the process.
+         * A strategy constructed with neither, which is what retry_mode=adaptive sets on ClientConfiguration, is replaced in each
+         * client by the strategy GetSharedStrategy returns for the service and region of the client.
+         */
+        class AWS_CORE_API AdaptiveRetryStrategy : public StandardRetryStrategy
+        {
+        public:
+            AdaptiveRetryStrategy(long maxAttempts = 3);
+            AdaptiveRetryStrategy(const Aws::String& serviceName, long maxAttempts = 3);
+            AdaptiveRetryStrategy(std::shared_ptr<RetryTokenBucket> retryTokenBucket, std::shared_ptr<RetryQuotaContainer> retryQuotaContainer,
+                long maxAttempts = 3);
+            ~AdaptiveRetryStrategy();
+
+            virtual void GetSendToken() override;
+            virtual long GetSendTokenWithoutWaiting() override;
+
+            /**
+             * Non blocking version of GetSendToken, returns false when the client should hold off sending.
+             */
+            bool HasSendToken();
+
+            virtual void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome) override;
+            virtual void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError) override;
+
+            virtual std::shared_ptr<RetryStrategy> GetStrategyForClient(const Aws::String& serviceName, const Aws::String& region) const override;
+
+            /**
+             * Returns the strategy shared by the clients of serviceName in region, created on first use and freed with the last client using it.
+             * The strategies of a service and region share their token bucket whatever their maximum number of attempts.
+             */
+            static std::shared_ptr<AdaptiveRetryStrategy> GetSharedStrategy(const Aws::String& serviceName, const Aws::String& region,
+                long maxAttempts = 3);
+
+            const std::shared_ptr<RetryTokenBucket>& GetRetryTokenBucket() const { return m_retryTokenBucket; }
+
+            /**
+             * Returns true if the error is the service asking the client to slow down.
+             */
+            static bool IsThrottlingError(const AWSError<CoreErrors>& error);
+
+        protected:
+            std::shared_ptr<RetryTokenBucket> m_retryTokenBucket;
+
+        private:
+            Aws::String m_serviceName;
+            // Key of the strategy in the shared strategies if it was created by GetSharedStrategy.
+            Aws::String m_sharedStrategyKey;
+            // True if GetStrategyForClient returns the shared strategy of the client's service and region.
+            bool m_sharedPerClientService;
+        };
+    } // namespace Client
+} // namespace Aws
@@ -10,6 +10,7 @@
 #include <aws/core/Region.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/client/RequestCompression.h>
 #include <memory>
 
 namespace Aws
@@ -111,8 +112,16 @@ namespace Aws
              * Default 1 byte/second. Only for CURL client currently.
              */
             unsigned long lowSpeedLimit;
+            /**
+             * Time in milliseconds an idle connection is kept in the connection pool before it is closed. Default 60 seconds.
+             * Set to 0 to keep idle connections until the pool needs room for another endpoint. Only for CURL client currently.
+             */
+            unsigned long idleConnectionTimeoutMs;
             /**
              * Strategy to use in case of failed requests. Default is DefaultRetryStrategy (e.g. exponential backoff)
+             * retry_mode "standard" and "adaptive" (AWS_RETRY_MODE or config file) select StandardRetryStrategy and AdaptiveRetryStrategy.
+             * The clients constructed with the adaptive strategy created here replace it with the strategy shared by every client
+             * of their service and region, see AdaptiveRetryStrategy::GetSharedStrategy.
              */
             std::shared_ptr<RetryStrategy> retryStrategy;
             /**
@@ -245,6 +254,10 @@ namespace Aws
              */
             Aws::String profileName;
 
+            /**
+             * Settings of the compression of request bodies, for the operations accepting compressed bodies.
+             */
+            RequestCompressionConfig requestCompressionConfig;
         };
 
     } // namespace Client
@@ -0,0 +1,113 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/URI.h>
+#include <aws/core/utils/ConcurrentCache.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+    } // namespace Utils
+
+    namespace Client
+    {
+        /**
+         * Discovers the endpoint for a cache key. On success, sets endpoint to the full endpoint, scheme included,
+         * and cachePeriod to how long it may be used, then returns true.
+         */
+        typedef std::function<bool(Aws::String& endpoint, std::chrono::milliseconds& cachePeriod)> DiscoverEndpointFunction;
+
+        /**
+         * Endpoints discovered by a client with endpoint discovery enabled.
+         * Concurrent lookups missing the same key wait on a single discovery instead of each calling the service.
+         * Once three quarters of the cache period of an entry have elapsed, it is refreshed in the background
+         * while lookups keep returning the current endpoint. After a failed refresh, the next one is delayed
+         * exponentially, staying before the expiry of the entry.
+         */
+        class AWS_CORE_API EndpointDiscoveryCache
+        {
+        public:
+            explicit EndpointDiscoveryCache(size_t maxSize = 1000);
+
+            /**
+             * Waits for the background refreshes in flight, as they call back into the client owning the cache.
+             */
+            ~EndpointDiscoveryCache();
+
+            EndpointDiscoveryCache(const EndpointDiscoveryCache&) = delete;
+            EndpointDiscoveryCache& operator=(const EndpointDiscoveryCache&) = delete;
+
+            /**
+             * Executor running the background refreshes. Without one, an entry is refreshed by the lookup finding it due.
+             */
+            void SetExecutor(const std::shared_ptr<Aws::Utils::Threading::Executor>& executor);
+
+            /**
+             * Returns the endpoint cached for key, discovering it first if needed, or nullptr if the discovery failed.
+             * A cached endpoint is returned as is, without parsing or allocating.
+             * discover may also run later on the executor to refresh the entry, so it must not refer to the caller's stack.
+             */
+            std::shared_ptr<const Aws::Http::URI> GetEndpoint(const Aws::String& key, const DiscoverEndpointFunction& discover);
+
+        private:
+            struct Entry
+            {
+                std::shared_ptr<const Aws::Http::URI> endpoint;
+                int64_t expiresAtMs;
+                // Read by every lookup, written by the refresh holding refreshing.
+                std::atomic<int64_t> refreshAtMs;
+                std::atomic<bool> refreshing;
+                // Only accessed by the refresh holding refreshing.
+                unsigned failedRefreshes;
+            };
+
+            /**
+             * Discovery in flight for a key, shared with the lookups waiting on it.
+             */
+            struct Discovery
+            {
+                Discovery() : done(false) {}
+
+                bool done;
+                std::shared_ptr<const Aws::Http::URI> endpoint;
+            };
+
+            std::shared_ptr<const Aws::Http::URI> DiscoverOnce(const Aws::String& key, const DiscoverEndpointFunction& discover);
+            std::shared_ptr<const Aws::Http::URI> DiscoverAndStore(const Aws::String& key, const DiscoverEndpointFunction& discover);
+            void Refresh(const Aws::String& key, const DiscoverEndpointFunction& discover, const std::shared_ptr<Entry>& entry);
+            static int64_t NextRefreshAfterFailure(Entry& entry);
+
+            Aws::Utils::ConcurrentCache<Aws::String, std::shared_ptr<Entry>> m_entries;
+
+            std::mutex m_discoveryLock;
+            std::condition_variable m_discoveryFinished;
+            Aws::Map<Aws::String, std::shared_ptr<Discovery>> m_discoveries;
+
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+            std::mutex m_refreshLock;
+            std::condition_variable m_refreshFinished;
+            size_t m_pendingRefreshes;
+            bool m_shuttingDown;
+        };
+    } // namespace Client
+} // namespace Aws
@@ -0,0 +1,301 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Lazy range over the pages of a paginated operation, e.g. ListObjectsV2, usually returned by a client rather than built directly.
+         * Iterating it sends the requests one page at a time, with up to prefetchDepth pages requested on the executor ahead of the page
+         * the caller is on, so the next page is usually on its way while the current one is processed.
+         *
+         * A paginator built from several requests, e.g. listing disjoint key prefixes, iterates the pages of each request in turn while
+         * fetching up to maxPartitionsInFlight of them concurrently, the next one starting as the caller moves past the pages of one.
+         * An unsuccessful outcome is the last page iterated.
+         *
+         * The range is single pass and must not outlive the client whose operation it calls. Destroying it waits for the requests in flight.
+         */
+        template<typename RequestT, typename ResultT, typename ErrorT>
+        class Paginator
+        {
+        public:
+            typedef Aws::Utils::Outcome<ResultT, ErrorT> OutcomeType;
+            /**
+             * Sends request and returns the outcome, usually a call to the operation of the client.
+             */
+            typedef std::function<OutcomeType(const RequestT& request)> FetchPageFunction;
+            /**
+             * Updates request, the one that returned result, to request the next page and returns true, or returns false after the last page.
+             */
+            typedef std::function<bool(const ResultT& result, RequestT& request)> NextPageFunction;
+
+            static const size_t DEFAULT_MAX_PARTITIONS_IN_FLIGHT = 8;
+
+            /**
+             * Input iterator over the pages. Incrementing it waits for the next page if it has not arrived yet.
+             */
+            class Iterator
+            {
+            public:
+                typedef std::input_iterator_tag iterator_category;
+                typedef OutcomeType value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const OutcomeType* pointer;
+                typedef const OutcomeType& reference;
+
+                Iterator() : m_paginator(nullptr) {}
+                explicit Iterator(Paginator* paginator) : m_paginator(paginator) {}
+
+                const OutcomeType& operator*() const { return m_paginator->m_currentPage; }
+                const OutcomeType* operator->() const { return &m_paginator->m_currentPage; }
+
+                Iterator& operator++()
+                {
+                    if (!m_paginator->NextPage())
+                    {
+                        m_paginator = nullptr;
+                    }
+                    return *this;
+                }
+
+                bool operator==(const Iterator& other) const { return m_paginator == other.m_paginator; }
+                bool operator!=(const Iterator& other) const { return m_paginator != other.m_paginator; }
+
+            private:
+                Paginator* m_paginator;
+            };
+
+            Paginator(const RequestT& request, const FetchPageFunction& fetchPage, const NextPageFunction& nextPage,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor, size_t prefetchDepth = 1) :
+                Paginator(Aws::Vector<RequestT>(1, request), fetchPage, nextPage, executor, prefetchDepth, 1)
+            {
+            }
+
+            Paginator(const Aws::Vector<RequestT>& requests, const FetchPageFunction& fetchPage, const NextPageFunction& nextPage,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor, size_t prefetchDepth = 1,
+                size_t maxPartitionsInFlight = DEFAULT_MAX_PARTITIONS_IN_FLIGHT) :
+                m_state(Aws::MakeShared<State>("Paginator", requests, fetchPage, nextPage, executor, prefetchDepth, maxPartitionsInFlight)),
+                m_partition(0),
+                m_started(false),
+                m_finished(false)
+            {
+            }
+
+            Paginator(Paginator&&) = default;
+            Paginator& operator=(Paginator&&) = default;
+            Paginator(const Paginator&) = delete;
+            Paginator& operator=(const Paginator&) = delete;
+
+            ~Paginator()
+            {
+                if (!m_state)
+                {
+                    return;
+                }
+
+                std::unique_lock<std::mutex> lock(m_state->lock);
+                m_state->cancelled = true;
+                m_state->changed.wait(lock, [this]
+                {
+                    for (const auto& partition : m_state->partitions)
+                    {
+                        if (partition.fetching) return false;
+                    }
+                    return true;
+                });
+            }
+
+            /**
+             * Starts fetching and waits for the first page. Can only be called once.
+             */
+            Iterator begin()
+            {
+                if (m_started)
+                {
+                    return end();
+                }
+
+                m_started = true;
+                for (size_t i = 0; i < m_state->partitions.size() && i < m_state->maxPartitionsInFlight; ++i)
+                {
+                    StartFetching(i, false);
+                }
+                return NextPage() ? Iterator(this) : end();
+            }
+
+            Iterator end() { return Iterator(); }
+
+        private:
+            struct Partition
+            {
+                explicit Partition(const RequestT& request) : nextRequest(request), hasNextPage(true), fetching(false) {}
+
+                RequestT nextRequest;
+                Aws::Deque<OutcomeType> pages;
+                bool hasNextPage;
+                bool fetching;
+            };
+
+            /**
+             * Shared with the fetches running on the executor.
+             */
+            struct State
+            {
+                State(const Aws::Vector<RequestT>& requests, const FetchPageFunction& fetch, const NextPageFunction& next,
+                    const std::shared_ptr<Aws::Utils::Threading::Executor>& exec, size_t depth, size_t maxInFlight) :
+                    fetchPage(fetch), nextPage(next), executor(exec), prefetchDepth(depth > 0 ? depth : 1),
+                    maxPartitionsInFlight(maxInFlight > 0 ? maxInFlight : 1), cancelled(false)
+                {
+                    for (const auto& request : requests)
+                    {
+                        partitions.emplace_back(request);
+                    }
+                }
+
+                FetchPageFunction fetchPage;
+                NextPageFunction nextPage;
+                std::shared_ptr<Aws::Utils::Threading::Executor> executor;
+                size_t prefetchDepth;
+                // Only the partitions from the one being iterated to maxPartitionsInFlight - 1 after it are fetched.
+                size_t maxPartitionsInFlight;
+
+                std::mutex lock;
+                std::condition_variable changed;
+                Aws::Vector<Partition> partitions;
+                bool cancelled;
+            };
+
+            /**
+             * Fetches pages of a partition until prefetchDepth of them are waiting, or only one without an executor.
+             */
+            static void FetchPages(const std::shared_ptr<State>& state, size_t index, bool singlePage)
+            {
+                std::unique_lock<std::mutex> lock(state->lock);
+                Partition& partition = state->partitions[index];
+                while (!state->cancelled && partition.hasNextPage && partition.pages.size() < state->prefetchDepth)
+                {
+                    RequestT request = partition.nextRequest;
+                    lock.unlock();
+                    OutcomeType page = state->fetchPage(request);
+                    bool hasNextPage = page.IsSuccess() && state->nextPage(page.GetResult(), request);
+                    lock.lock();
+
+                    partition.nextRequest = std::move(request);
+                    partition.hasNextPage = hasNextPage;
+                    partition.pages.push_back(std::move(page));
+                    state->changed.notify_all();
+                    if (singlePage)
+                    {
+                        break;
+                    }
+                }
+                partition.fetching = false;
+                state->changed.notify_all();
+            }
+
+            /**
+             * Starts fetching pages of a partition on the executor. Without one, fetches a single page inline if waitingForPage is true,
+             * so that pages are requested only when the caller needs them.
+             */
+            void StartFetching(size_t index, bool waitingForPage)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_state->lock);
+                    Partition& partition = m_state->partitions[index];
+                    if (partition.fetching || !partition.hasNextPage || partition.pages.size() >= m_state->prefetchDepth || m_state->cancelled)
+                    {
+                        return;
+                    }
+                    partition.fetching = true;
+                }
+
+                auto state = m_state;
+                if (!state->executor || !state->executor->Submit([state, index]() { FetchPages(state, index, false); }))
+                {
+                    if (waitingForPage)
+                    {
+                        FetchPages(state, index, true);
+                    }
+                    else
+                    {
+                        std::lock_guard<std::mutex> lock(m_state->lock);
+                        m_state->partitions[index].fetching = false;
+                    }
+                }
+            }
+
+            bool NextPage()
+            {
+                if (m_finished)
+                {
+                    return false;
+                }
+
+                while (m_partition < m_state->partitions.size())
+                {
+                    StartFetching(m_partition, true);
+
+                    std::unique_lock<std::mutex> lock(m_state->lock);
+                    Partition& partition = m_state->partitions[m_partition];
+                    m_state->changed.wait(lock, [&partition] { return !partition.pages.empty() || !partition.fetching; });
+                    if (!partition.pages.empty())
+                    {
+                        m_currentPage = std::move(partition.pages.front());
+                        partition.pages.pop_front();
+                        if (!m_currentPage.IsSuccess())
+                        {
+                            // Nothing is iterated after an error, stops the fetches of the other partitions too.
+                            m_state->cancelled = true;
+                            m_finished = true;
+                        }
+                        lock.unlock();
+                        if (!m_finished)
+                        {
+                            StartFetching(m_partition, false);
+                        }
+                        return true;
+                    }
+
+                    if (!partition.hasNextPage)
+                    {
+                        ++m_partition;
+                        lock.unlock();
+                        size_t nextInFlight = m_partition + m_state->maxPartitionsInFlight - 1;
+                        if (nextInFlight < m_state->partitions.size())
+                        {
+                            StartFetching(nextInFlight, false);
+                        }
+                    }
+                }
+
+                m_finished = true;
+                return false;
+            }
+
+            std::shared_ptr<State> m_state;
+            size_t m_partition;
+            bool m_started;
+            // Set once an error has been returned or all the pages have, later increments then end the iteration.
+            bool m_finished;
+            OutcomeType m_currentPage;
+        };
+    } // namespace Client
+} // namespace Aws
@@ -0,0 +1,90 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <memory>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Content encodings the body of a request can be compressed with.
+         */
+        enum class CompressionAlgorithm
+        {
+            NONE,
+            GZIP,
+            ZSTD
+        };
+
+        /**
+         * Client wide settings of request compression. Only the bodies of the operations that accept compressed bodies, or of the requests
+         * the caller opted in with AmazonWebServiceRequest::SetRequestCompressionAlgorithm, are ever compressed.
+         */
+        struct AWS_CORE_API RequestCompressionConfig
+        {
+            RequestCompressionConfig() :
+                enableRequestCompression(true),
+                requestMinCompressionSizeBytes(10240),
+                compressionLevel(-1)
+            {
+            }
+
+            /**
+             * Set to false to never compress request bodies. Defaults to true.
+             */
+            bool enableRequestCompression;
+
+            /**
+             * Bodies smaller than this many bytes are sent as is since compressing them saves less than it costs. Defaults to 10KB.
+             * Bodies whose size can't be known ahead, e.g. read from a pipe, are always compressed.
+             */
+            size_t requestMinCompressionSizeBytes;
+
+            /**
+             * Level of compression, 1 for the fastest up to 9 for gzip and 19 for zstd. Defaults to -1, the default level of the algorithm.
+             */
+            int compressionLevel;
+        };
+
+        /**
+         * Compression of request bodies, as they are read, so that the uncompressed body is never copied.
+         * The algorithms are only available if the SDK was built with them, see ENABLE_ZLIB_REQUEST_COMPRESSION and ENABLE_ZSTD_REQUEST_COMPRESSION.
+         */
+        class AWS_CORE_API RequestCompression
+        {
+        public:
+            /**
+             * True if the SDK was built with algorithm.
+             */
+            static bool IsAlgorithmAvailable(CompressionAlgorithm algorithm);
+
+            /**
+             * Value of the Content-Encoding header of a body compressed with algorithm, e.g. "gzip".
+             */
+            static const char* GetContentEncoding(CompressionAlgorithm algorithm);
+
+            /**
+             * Returns a stream compressing source from its start as it is read, without knowing the compressed size ahead: use it with
+             * transfer-encoding:chunked. The stream can only be rewound to its start, which starts the compression over.
+             * Returns nullptr if algorithm is not available.
+             */
+            static std::shared_ptr<Aws::IOStream> CreateCompressingStream(CompressionAlgorithm algorithm, const std::shared_ptr<Aws::IOStream>& source,
+                int compressionLevel = -1);
+
+            /**
+             * Compresses source from its start into a new seekable stream holding only the compressed bytes.
+             * Returns nullptr if algorithm is not available or compression failed.
+             */
+            static std::shared_ptr<Aws::IOStream> Compress(CompressionAlgorithm algorithm, const std::shared_ptr<Aws::IOStream>& source,
+                int compressionLevel = -1);
+        };
+    } // namespace Client
+} // namespace Aws
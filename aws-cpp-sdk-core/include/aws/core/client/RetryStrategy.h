@@ -7,6 +7,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
 #include <memory>
 
 namespace Aws
@@ -58,11 +59,23 @@ namespace Aws
              */
             virtual void GetSendToken() {}
 
+            /**
+             * Retrieves a send token without blocking, returns the number of milliseconds to wait before sending.
+             * Used by asynchronous requests, the default implementation calls GetSendToken and returns 0.
+             */
+            virtual long GetSendTokenWithoutWaiting() { GetSendToken(); return 0; }
+
             /**
              * Update status, like the information of retry quota when receiving a response.
              */
             virtual void RequestBookkeeping(const HttpResponseOutcome& /* httpResponseOutcome */) {}
             virtual void RequestBookkeeping(const HttpResponseOutcome& /* httpResponseOutcome */, const AWSError<CoreErrors>& /* lastError */) {}
+
+            /**
+             * Returns the strategy a client of serviceName in region uses in place of this one, or nullptr to use this one.
+             * Lets the strategy set on a ClientConfiguration be shared by all the clients of the same service and region.
+             */
+            virtual std::shared_ptr<RetryStrategy> GetStrategyForClient(const Aws::String& /* serviceName */, const Aws::String& /* region */) const { return nullptr; }
         };
 
         /**
@@ -11,6 +11,7 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <functional>
 
 namespace Aws
 {
@@ -27,6 +28,11 @@ namespace Aws
         class HttpRequest;
         class HttpResponse;
 
+        /**
+         * Invoked once an asynchronously issued http request completes, either with a response from the server or with a client error.
+         */
+        typedef std::function<void(const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)> HttpResponseReceivedHandler;
+
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
           */
@@ -43,15 +49,38 @@ namespace Aws
                 Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
                 Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const = 0;
 
+            /**
+             * Takes an http request, makes it, and calls handler with the newly allocated HttpResponse when the request completes.
+             * Event driven implementations call handler from their event loop thread, so handler should not block.
+             * The default implementation makes the request synchronously on the calling thread.
+             */
+            virtual void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                const HttpResponseReceivedHandler& handler,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+
             /**
              * If yes, the http client supports transfer-encoding:chunked.
              */
             virtual bool SupportsChunkedTransferEncoding() const { return true; }
 
+            /**
+             * If yes, MakeRequestAsync returns without waiting for the request to complete, see AWSClient::AttemptExhaustivelyAsync.
+             */
+            virtual bool SupportsAsyncRequests() const { return false; }
+
+            /**
+             * Calls callback once delay has elapsed, or as soon as request processing is disabled.
+             * Lets asynchronous requests wait before their next attempt without blocking a thread: event driven implementations
+             * call it from their event loop thread, so it should not block. The default implementation sleeps the calling thread
+             * with RetryRequestSleep, then calls it.
+             */
+            virtual void ScheduleAfter(std::chrono::milliseconds delay, const std::function<void()>& callback);
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
-            void DisableRequestProcessing();
+            virtual void DisableRequestProcessing();
             /**
              * Enables/ReEnables request processing.
              */
@@ -0,0 +1,109 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <functional>
+#include <cstring>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Called with the lower cased name and the value of each header, in the order of their names.
+         * Both are only valid during the call.
+         */
+        typedef std::function<void(const char* name, size_t nameLength, const Aws::String& value)> HeaderVisitor;
+
+        /**
+         * Flat storage of the headers of a request or response: a single vector of name and value pairs kept sorted by name.
+         * Names are stored lower cased, the names of well known headers point to static strings rather than being copied.
+         * Lookups compare names case insensitively in place, without lower casing a copy of them.
+         */
+        class AWS_CORE_API HttpHeaders
+        {
+        public:
+            /**
+             * A header, valid until the headers are modified.
+             */
+            class AWS_CORE_API Header
+            {
+            public:
+                Header() : m_knownName(nullptr), m_nameLength(0) {}
+
+                /**
+                 * Lower cased name of the header.
+                 */
+                inline const char* GetName() const { return m_knownName ? m_knownName : m_name.c_str(); }
+                inline size_t GetNameLength() const { return m_nameLength; }
+                inline const Aws::String& GetValue() const { return m_value; }
+
+            private:
+                friend class HttpHeaders;
+
+                const char* m_knownName;
+                size_t m_nameLength;
+                Aws::String m_name;
+                Aws::String m_value;
+            };
+
+            typedef Aws::Vector<Header>::const_iterator const_iterator;
+
+            HttpHeaders();
+
+            /**
+             * Returns the value of the header with name, compared case insensitively, or nullptr if there is none.
+             */
+            const Aws::String* Find(const char* name, size_t nameLength) const;
+            inline const Aws::String* Find(const char* name) const { return Find(name, strlen(name)); }
+            inline bool Has(const char* name) const { return Find(name) != nullptr; }
+
+            /**
+             * Sets the header with name to value, replacing the value it had. Leading and trailing whitespace is trimmed from both,
+             * so they can be sliced straight out of a header line. Headers without a name are ignored.
+             */
+            void Set(const char* name, size_t nameLength, const char* value, size_t valueLength);
+            inline void Set(const char* name, const Aws::String& value) { Set(name, strlen(name), value.c_str(), value.size()); }
+
+            /**
+             * Removes the header with name, returns false if there was none.
+             */
+            bool Erase(const char* name);
+
+            inline void clear() { m_headers.clear(); }
+            inline size_t size() const { return m_headers.size(); }
+            inline bool empty() const { return m_headers.empty(); }
+            inline const_iterator begin() const { return m_headers.begin(); }
+            inline const_iterator end() const { return m_headers.end(); }
+
+            /**
+             * Calls visitor with each header, in the order of their names.
+             */
+            void Visit(const HeaderVisitor& visitor) const;
+
+            /**
+             * Copies the headers into a HeaderValueCollection.
+             */
+            HeaderValueCollection ToCollection() const;
+
+            /**
+             * Returns the static lower cased name of a well known header matching name case insensitively, or nullptr.
+             */
+            static const char* GetKnownHeaderName(const char* name, size_t nameLength);
+
+        private:
+            Aws::Vector<Header>::iterator LowerBound(const char* name, size_t nameLength);
+            Aws::Vector<Header>::const_iterator LowerBound(const char* name, size_t nameLength) const;
+
+            Aws::Vector<Header> m_headers;
+        };
+    } // namespace Http
+} // namespace Aws
@@ -9,6 +9,7 @@
 
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/HttpHeaders.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
@@ -31,6 +32,7 @@ namespace Aws
         extern AWS_CORE_API const char COOKIE_HEADER[];
         extern AWS_CORE_API const char CONTENT_LENGTH_HEADER[];
         extern AWS_CORE_API const char CONTENT_TYPE_HEADER[];
+        extern AWS_CORE_API const char CONTENT_ENCODING_HEADER[];
         extern AWS_CORE_API const char TRANSFER_ENCODING_HEADER[];
         extern AWS_CORE_API const char USER_AGENT_HEADER[];
         extern AWS_CORE_API const char VIA_HEADER[];
@@ -78,6 +80,17 @@ namespace Aws
              * Get All headers for this request.
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Calls visitor with each header of this request, in the order of their names, without copying them.
+             * The default implementation visits a copy from GetHeaders().
+             */
+            virtual void VisitHeaders(const HeaderVisitor& visitor) const
+            {
+                for (const auto& header : GetHeaders())
+                {
+                    visitor(header.first.c_str(), header.first.size(), header.second);
+                }
+            }
             /**
              * Get the value for a Header based on its name. (in default StandardHttpRequest implementation, an empty string will be returned if headerName doesn't exist)
              */
@@ -523,6 +536,16 @@ namespace Aws
             Aws::String GetResolvedRemoteHost() const { return m_resolvedRemoteHost; }
             void SetResolvedRemoteHost(const Aws::String& ip) { m_resolvedRemoteHost = ip; }
 
+            /**
+             * Gets the hex encoded sha256 of the content body computed by the signer, or an empty string if the body hasn't been hashed yet.
+             * It is kept on the request so that signing it again on retries doesn't hash the body again.
+             */
+            inline const Aws::String& GetPayloadHash() const { return m_payloadHash; }
+            /**
+             * Sets the hex encoded sha256 of the content body. Must be reset when the content body changes.
+             */
+            inline void SetPayloadHash(const Aws::String& payloadHash) { m_payloadHash = payloadHash; }
+
             bool IsEventStreamRequest() { return m_isEvenStreamRequest; }
             void SetEventStreamRequest(bool eventStreamRequest) { m_isEvenStreamRequest = eventStreamRequest; }
         private:
@@ -535,6 +558,7 @@ namespace Aws
             Aws::String m_signingRegion;
             Aws::String m_signingAccessKey;
             Aws::String m_resolvedRemoteHost;
+            Aws::String m_payloadHash;
             Aws::Monitoring::HttpClientMetricsCollection m_httpRequestMetrics;
         };
 
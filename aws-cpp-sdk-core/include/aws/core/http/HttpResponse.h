@@ -8,6 +8,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/client/CoreErrors.h>
@@ -156,6 +157,17 @@ namespace Aws
              * Get the headers from this response
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Calls visitor with each header of this response, in the order of their names, without copying them.
+             * The default implementation visits a copy from GetHeaders().
+             */
+            virtual void VisitHeaders(const HeaderVisitor& visitor) const
+            {
+                for (const auto& header : GetHeaders())
+                {
+                    visitor(header.first.c_str(), header.first.size(), header.second);
+                }
+            }
             /**
              * Returns true if the response contains a header by headerName
              */
@@ -189,6 +201,14 @@ namespace Aws
              * Adds a header to the http response object.
              */
             virtual void AddHeader(const Aws::String&, const Aws::String&) = 0;
+            /**
+             * Adds a header whose name and value are sliced out of a header line, the whitespace around them is ignored.
+             * Neither needs to be null terminated.
+             */
+            virtual void AddHeader(const char* name, size_t nameLength, const char* value, size_t valueLength)
+            {
+                AddHeader(Utils::StringUtils::Trim(Aws::String(name, nameLength).c_str()), Utils::StringUtils::Trim(Aws::String(value, valueLength).c_str()));
+            }
             /**
              * Sets the content type header on the http response object.
              */
@@ -38,7 +38,8 @@ namespace Aws
             DEFAULT_CLIENT = 0,
             CURL_CLIENT,
             WIN_INET_CLIENT,
-            WIN_HTTP_CLIENT
+            WIN_HTTP_CLIENT,
+            CURL_MULTI_CLIENT
         };
 
         namespace HttpMethodMapper
@@ -0,0 +1,147 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/URI.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <curl/curl.h>
+
+namespace Aws
+{
+namespace Http
+{
+
+struct CurlHandleHostPool;
+
+/**
+ * Timeouts and keep alive settings of the curl handles, the same for the handles of CurlHandlePool and CurlMultiHttpClient.
+ * Times are in milliseconds, curl only gets the low speed time and the keep alive interval in seconds.
+ */
+struct AWS_CORE_API CurlHandleOptions
+{
+    CurlHandleOptions(long httpRequestTimeout = 0, long connectTimeout = 1000, bool tcpKeepAlive = true, unsigned long tcpKeepAliveIntervalMs = 30000,
+                      long lowSpeedTime = 3000, unsigned long lowSpeedLimit = 1);
+
+    /**
+     * Sets the options on a new handle, or on a handle that was just reset with curl_easy_reset.
+     */
+    void ApplyTo(CURL* handle) const;
+
+    unsigned long httpRequestTimeout;
+    unsigned long connectTimeout;
+    bool enableTcpKeepAlive;
+    unsigned long tcpKeepAliveIntervalMs;
+    unsigned long lowSpeedTime;
+    unsigned long lowSpeedLimit;
+};
+
+/**
+ * Point in time statistics for the handles pooled for one endpoint.
+ */
+struct AWS_CORE_API CurlHandlePoolHostMetrics
+{
+    CurlHandlePoolHostMetrics() : idleHandles(0), leasedHandles(0), handlesCreated(0), handlesReused(0), handlesEvicted(0) {}
+
+    // scheme://authority:port
+    Aws::String endpoint;
+    size_t idleHandles;
+    size_t leasedHandles;
+    size_t handlesCreated;
+    size_t handlesReused;
+    // Closed because they were idle for too long or because another endpoint needed the room.
+    size_t handlesEvicted;
+};
+
+/**
+ * Connection pool manager for Curl, sharded by endpoint (scheme, host and port) so that a handle, and the TCP/TLS
+ * connection it caches, is only ever reused for the endpoint it was opened against.
+ *
+ * Idle handles of each endpoint are kept in per core lock-free LIFO free lists, the most recently released handle is
+ * handed out first to keep connections warm. Acquiring and releasing a handle only blocks when maxSize handles are leased.
+ * When the pool is full and the requested endpoint has no idle handle, the idle handle of another endpoint is closed to
+ * make room. Handles idle for longer than idleTimeoutMs are closed by a sweep piggybacked on AcquireCurlHandle, which also
+ * drops the endpoints that have no handle left and were not acquired from for idleTimeoutMs.
+ *
+ * The pool stores its bookkeeping in CURLOPT_PRIVATE, which must not be overridden on the handles it hands out.
+ */
+class AWS_CORE_API CurlHandlePool
+{
+public:
+    CurlHandlePool(unsigned maxSize = 50, long httpRequestTimeout = 0, long connectTimeout = 1000, bool tcpKeepAlive = true,
+                   unsigned long tcpKeepAliveIntervalMs = 30000, long lowSpeedTime = 3000, unsigned long lowSpeedLimit = 1,
+                   unsigned long idleTimeoutMs = 60000);
+    ~CurlHandlePool();
+
+    /**
+     * Returns a handle for the endpoint of uri, blocks while maxSize handles are leased.
+     * Returns nullptr if curl failed to allocate a new handle.
+     */
+    CURL* AcquireCurlHandle(const URI& uri);
+    /**
+     * Returns a handle to the free list of its endpoint for reuse. It is imperative that this is called
+     * after you are finished with the handle.
+     */
+    void ReleaseCurlHandle(CURL* handle);
+    /**
+     * When the handle has bad DNS entries, problematic live connections, we need to destroy the handle instead of releasing it.
+     */
+    void DestroyCurlHandle(CURL* handle);
+
+    /**
+     * Closes every handle that has been idle for longer than the idle timeout, then drops the endpoints left without handles
+     * that were not acquired from during the idle timeout. Returns the number of closed handles.
+     */
+    size_t EvictIdleCurlHandles();
+
+    Aws::Vector<CurlHandlePoolHostMetrics> GetPoolMetrics() const;
+
+private:
+    CurlHandlePool(const CurlHandlePool&) = delete;
+    const CurlHandlePool& operator = (const CurlHandlePool&) = delete;
+    CurlHandlePool(const CurlHandlePool&&) = delete;
+    const CurlHandlePool& operator = (const CurlHandlePool&&) = delete;
+
+    CurlHandleHostPool* GetOrCreateHostPool(const URI& uri);
+    CURL* AcquireCurlHandle(CurlHandleHostPool* hostPool);
+    void RemoveUnusedHostPools(int64_t unusedSinceMs);
+    CURL* CreateCurlHandle(CurlHandleHostPool* hostPool);
+    void CloseIdleCurlHandle(CurlHandleHostPool* hostPool, uint32_t slotIndex);
+    bool TryReserveHandle();
+    bool EvictIdleHandleOfOtherHost(const CurlHandleHostPool* hostPool);
+    void EvictIdleCurlHandlesIfDue();
+    void WaitForAvailableHandle(uint64_t observedHandleEvents);
+    void NotifyWaiters(bool notifyAll = false);
+    void SetDefaultOptionsOnHandle(CURL* handle, void* slot);
+
+    // Keyed by scheme://authority:port. Looked up under the reader lock, endpoints are only added and removed under the writer lock.
+    Aws::UnorderedMap<Aws::String, CurlHandleHostPool*> m_hostPools;
+    mutable Aws::Utils::Threading::ReaderWriterLock m_hostPoolsLock;
+    std::atomic<unsigned> m_handlesCount;
+    std::atomic<int64_t> m_nextEvictionMs;
+    unsigned m_shardsCount;
+
+    std::mutex m_waitersLock;
+    std::condition_variable m_handleAvailableSignal;
+    std::atomic<unsigned> m_waitersCount;
+    // Incremented whenever a handle is released, destroyed or evicted. Waiters sleep until it moves past the value they saw
+    // before their last attempt, rather than on a count of handles they may not be able to take.
+    std::atomic<uint64_t> m_handleEvents;
+
+    unsigned m_maxPoolSize;
+    CurlHandleOptions m_handleOptions;
+    unsigned long m_idleTimeoutMs;
+};
+
+} // namespace Http
+} // namespace Aws
@@ -8,7 +8,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpClient.h>
-#include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/http/curl/CurlHandlePool.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <atomic>
@@ -22,6 +22,48 @@ namespace Standard
     class StandardHttpResponse;
 }
 
+class CurlHttpClient;
+
+/**
+ * State shared with the curl write and header callbacks for the duration of a single transfer.
+ */
+struct CurlWriteCallbackContext
+{
+    CurlWriteCallbackContext(const CurlHttpClient* client,
+                             HttpRequest* request,
+                             HttpResponse* response,
+                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
+        m_client(client),
+        m_request(request),
+        m_response(response),
+        m_rateLimiter(rateLimiter),
+        m_numBytesResponseReceived(0)
+    {}
+
+    const CurlHttpClient* m_client;
+    HttpRequest* m_request;
+    HttpResponse* m_response;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    int64_t m_numBytesResponseReceived;
+};
+
+/**
+ * State shared with the curl read and seek callbacks for the duration of a single transfer.
+ */
+struct CurlReadCallbackContext
+{
+    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
+        m_client(client),
+        m_rateLimiter(limiter),
+        m_request(request)
+    {}
+
+    const CurlHttpClient* m_client;
+    CURL* m_curlHandle;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    HttpRequest* m_request;
+};
+
 //Curl implementation of an http client. Right now it is only synchronous.
 class AWS_CORE_API CurlHttpClient: public HttpClient
 {
@@ -40,6 +82,11 @@ public:
     static void InitGlobalState();
     static void CleanupGlobalState();
 
+    /**
+     * Statistics of the connection pool, one entry per endpoint this client has connected to.
+     */
+    Aws::Vector<CurlHandlePoolHostMetrics> GetConnectionPoolMetrics() const { return m_curlHandlePool.GetPoolMetrics(); }
+
 protected:
     /**
      * Override any configuration on CURL handle for each request before sending.
@@ -47,8 +94,27 @@ protected:
      */
     virtual void OverrideOptionsOnConnectionHandle(CURL*) const {}
 
+    /**
+     * Builds the curl header list for request. The caller owns the returned list and must free it with curl_slist_free_all
+     * once the transfer using it has completed.
+     */
+    struct curl_slist* CreateCurlHeaderList(const HttpRequest& request) const;
+
+    /**
+     * Sets url, method, headers, callbacks, TLS and proxy options for request on connectionHandle.
+     * The contexts and the header list must outlive the transfer.
+     */
+    void SetOptionsOnConnectionHandle(CURL* connectionHandle, const std::shared_ptr<HttpRequest>& request, const Aws::String& url,
+        struct curl_slist* headers, CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const;
+
+    /**
+     * Translates the result of a finished transfer on connectionHandle into response, and records the transfer metrics on request.
+     */
+    void ProcessTransferResult(CURL* connectionHandle, CURLcode curlResponseCode, const std::shared_ptr<HttpRequest>& request,
+        const std::shared_ptr<HttpResponse>& response, const CurlWriteCallbackContext& writeContext) const;
+
 private:
-    mutable CurlHandleContainer m_curlHandleContainer;
+    mutable CurlHandlePool m_curlHandlePool;
     bool m_isUsingProxy;
     Aws::String m_proxyUserName;
     Aws::String m_proxyPassword;
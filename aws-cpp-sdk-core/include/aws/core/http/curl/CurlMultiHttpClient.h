@@ -0,0 +1,119 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSMultiMap.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+namespace Http
+{
+
+struct CurlMultiTransfer;
+
+/**
+ * Event driven Curl implementation of an http client.
+ * All transfers are multiplexed on a single curl multi handle which is driven by a dedicated event loop thread
+ * (epoll and curl_multi_socket_action on Linux, curl_multi_wait elsewhere), so the number of requests in flight is not bound
+ * to the number of threads issuing them. Use MakeRequestAsync to issue requests without blocking the calling thread,
+ * MakeRequest still blocks the caller until its transfer completes.
+ * maxConnections from the client configuration caps the number of open connections, requests beyond that are queued by curl.
+ *
+ * Completion handlers, callbacks passed to ScheduleAfter and curl callbacks (including rate limiters and data sent/received handlers)
+ * run on the event loop thread, they must not block or issue synchronous requests on the same client.
+ */
+class AWS_CORE_API CurlMultiHttpClient : public CurlHttpClient
+{
+public:
+
+    using Base = CurlHttpClient;
+
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    ~CurlMultiHttpClient();
+
+    //Queues the request on the event loop and blocks until it completes.
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    //Queues the request on the event loop and returns immediately, handler is called from the event loop thread.
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+        const HttpResponseReceivedHandler& handler,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    bool SupportsAsyncRequests() const override { return true; }
+
+    //Calls callback from the event loop thread once delay has elapsed, or right away if the event loop is not running.
+    void ScheduleAfter(std::chrono::milliseconds delay, const std::function<void()>& callback) override;
+
+    //Also calls the callbacks waiting on ScheduleAfter.
+    void DisableRequestProcessing() override;
+
+    /**
+     * Number of transfers queued or currently running on the event loop.
+     */
+    size_t GetInFlightRequestsCount() const { return m_inFlightRequests.load(); }
+
+private:
+    CurlMultiHttpClient(const CurlMultiHttpClient&) = delete;
+    CurlMultiHttpClient& operator=(const CurlMultiHttpClient&) = delete;
+
+    void SubmitTransfer(CurlMultiTransfer* transfer) const;
+    void WakeUpEventLoop() const;
+    void EventLoop();
+    void WaitForEvents();
+    void StartPendingTransfers();
+    void ProcessCompletedTransfers();
+    //Sets deadline to when the first callback passed to ScheduleAfter is due, returns false if there is none.
+    bool GetNextTimerDeadline(std::chrono::steady_clock::time_point& deadline) const;
+    void RunDueTimers(bool runAll);
+    void CompleteTransfer(CurlMultiTransfer* transfer, CURLcode curlResponseCode);
+    void FailTransfer(CurlMultiTransfer* transfer, Aws::Client::CoreErrors errorType, const char* message) const;
+    void FinishTransfer(CurlMultiTransfer* transfer) const;
+    void AbortAllTransfers();
+    CURL* AcquireEasyHandle();
+
+    static int SocketCallback(CURL* easyHandle, curl_socket_t socket, int what, void* userp, void* socketp);
+    static int TimerCallback(CURLM* multiHandle, long timeoutMs, void* userp);
+
+    CURLM* m_multiHandle;
+    int m_epollFd;
+    int m_wakeUpFd;
+    bool m_hasTimeout;
+    std::chrono::steady_clock::time_point m_timeoutDeadline;
+
+    // Transfers handed over by caller threads, guarded by m_pendingTransfersLock.
+    mutable std::mutex m_pendingTransfersLock;
+    mutable Aws::Queue<CurlMultiTransfer*> m_pendingTransfers;
+    mutable std::atomic<size_t> m_inFlightRequests;
+    // Callbacks passed to ScheduleAfter by their deadline, guarded by m_pendingTransfersLock.
+    Aws::MultiMap<std::chrono::steady_clock::time_point, std::function<void()>> m_timers;
+
+    // Only touched from the event loop thread.
+    Aws::Vector<CURL*> m_idleEasyHandles;
+    Aws::Set<CurlMultiTransfer*> m_runningTransfers;
+
+    std::atomic<bool> m_continueEventLoop;
+    std::thread m_eventLoopThread;
+
+    unsigned m_maxConnections;
+    CurlHandleOptions m_handleOptions;
+};
+
+} // namespace Http
+} // namespace Aws
@@ -7,7 +7,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpRequest.h>
-#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/http/HttpHeaders.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -32,6 +32,10 @@ namespace Aws
                  * Get All headers for this request.
                  */
                 virtual HeaderValueCollection GetHeaders() const override;
+                /**
+                 * Calls visitor with each header of this request, in the order of their names, without copying them.
+                 */
+                virtual void VisitHeaders(const HeaderVisitor& visitor) const override { headerMap.Visit(visitor); }
                 /**
                  * Get the value for a Header based on its name.
                  * This function doesn't check the existence of headerName.
@@ -53,7 +57,7 @@ namespace Aws
                 /**                 
                  * Adds a content body stream to the request. This stream will be used to send the body to the endpoint.
                  */               
-                virtual inline void AddContentBody(const std::shared_ptr<Aws::IOStream>& strContent) override { bodyStream = strContent; }
+                virtual inline void AddContentBody(const std::shared_ptr<Aws::IOStream>& strContent) override { bodyStream = strContent; SetPayloadHash({}); }
                 /**
                  * Gets the content body stream that will be used for this request.
                  */
@@ -76,7 +80,7 @@ namespace Aws
                 virtual void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) override;
 
             private:
-                HeaderValueCollection headerMap;
+                HttpHeaders headerMap;
                 std::shared_ptr<Aws::IOStream> bodyStream;
                 Aws::IOStreamFactory m_responseStreamFactory;
                 Aws::String m_emptyHeader;
@@ -8,7 +8,7 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/http/HttpResponse.h>
-#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/http/HttpHeaders.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -38,6 +38,10 @@ namespace Aws
                  * Get the headers from this response
                  */
                 HeaderValueCollection GetHeaders() const;
+                /**
+                 * Calls visitor with each header of this response, in the order of their names, without copying them.
+                 */
+                void VisitHeaders(const HeaderVisitor& visitor) const override { headerMap.Visit(visitor); }
                 /**
                  * Returns true if the response contains a header by headerName
                  */
@@ -59,11 +63,15 @@ namespace Aws
                  * Adds a header to the http response object.
                  */
                 void AddHeader(const Aws::String&, const Aws::String&);
+                /**
+                 * Adds a header sliced out of a header line, copying only the value and the names of headers that aren't well known.
+                 */
+                void AddHeader(const char* name, size_t nameLength, const char* value, size_t valueLength) override;
 
             private:
                 StandardHttpResponse(const StandardHttpResponse&);
 
-                Aws::Map<Aws::String, Aws::String> headerMap;
+                HttpHeaders headerMap;
                 Utils::Stream::ResponseStream bodyStream;
             };
 
@@ -222,5 +222,40 @@ namespace FileSystem
         Aws::UniquePtr<Directory> m_dir;
     };
 
+    /**
+     * Read-only memory mapping of a whole file, unmapped on destruction. Reading the mapping reads the file through the page cache without copying it.
+     * The file must not be truncated while it is mapped, reading pages past its new end would crash the process.
+     */
+    class AWS_CORE_API MappedFile
+    {
+    public:
+        /**
+         * Maps the file at path. Check IsMapped(): empty files, files that can't be opened and files larger than the address space are not mapped.
+         */
+        MappedFile(const Aws::String& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool IsMapped() const { return m_data != nullptr; }
+
+        /**
+         * First byte of the file, or nullptr if it is not mapped.
+         */
+        const unsigned char* GetData() const { return m_data; }
+
+        /**
+         * Size in bytes of the file when it was mapped.
+         */
+        uint64_t GetSize() const { return m_size; }
+
+    private:
+        const unsigned char* m_data;
+        uint64_t m_size;
+        // The file mapping handle on Windows, unused on other platforms.
+        void* m_mappingHandle;
+    };
+
 } // namespace FileSystem
 } // namespace Aws
@@ -10,11 +10,18 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <memory>
 
 namespace Aws
 {
     namespace Utils
     {
+        namespace Crypto
+        {
+            class Hash;
+        } // namespace Crypto
 
         /**
         * Generic utils for hashing strings
@@ -77,6 +84,45 @@ namespace Aws
             */
             static ByteBuffer CalculateMD5(Aws::IOStream& stream);
 
+            /**
+            * Calculates a CRC32 checksum (big endian, not hex encoded)
+            */
+            static ByteBuffer CalculateCRC32(const Aws::String& str);
+
+            /**
+            * Calculates a CRC32 checksum on a stream (the entire stream is read, big endian, not hex encoded.)
+            */
+            static ByteBuffer CalculateCRC32(Aws::IOStream& stream);
+
+            /**
+            * Calculates a CRC32C checksum (big endian, not hex encoded)
+            */
+            static ByteBuffer CalculateCRC32C(const Aws::String& str);
+
+            /**
+            * Calculates a CRC32C checksum on a stream (the entire stream is read, big endian, not hex encoded.)
+            */
+            static ByteBuffer CalculateCRC32C(Aws::IOStream& stream);
+
+            /**
+            * Returns the CRC32 checksum of two consecutive blocks of data from the checksum of each, given the length of the second one.
+            * Lets parts of a multipart transfer be checksummed in parallel, and the checksum of the whole object be derived from theirs.
+            */
+            static ByteBuffer CombineCRC32(const ByteBuffer& first, const ByteBuffer& second, uint64_t secondLength);
+
+            /**
+            * Same as CombineCRC32, for CRC32C checksums.
+            */
+            static ByteBuffer CombineCRC32C(const ByteBuffer& first, const ByteBuffer& second, uint64_t secondLength);
+
+            /**
+            * Calculates the digest of each of hashes on a stream, reading the stream only once (the entire stream is read).
+            * Returns the digests in the order of hashes, or an empty vector if the stream could not be read to its end
+            * or one of the hashes does not support Update and GetHash.
+            * The hashes must not have a digest in progress.
+            */
+            static Aws::Vector<ByteBuffer> CalculateHashes(Aws::IStream& stream, const Aws::Vector<std::shared_ptr<Crypto::Hash>>& hashes);
+
             static int HashString(const char* strToHash);
 
         };
@@ -26,19 +26,19 @@ namespace Aws
         {
         public:
 
-            Outcome() : success(false)
+            Outcome() : result(), error(), success(false)
             {
             }
-            Outcome(const R& r) : result(r), success(true)
+            Outcome(const R& r) : result(r), error(), success(true)
             {
             }
-            Outcome(const E& e) : error(e), success(false)
+            Outcome(const E& e) : result(), error(e), success(false)
             {
             }
-            Outcome(R&& r) : result(std::forward<R>(r)), success(true)
+            Outcome(R&& r) : result(std::forward<R>(r)), error(), success(true)
             {
             }
-            Outcome(E&& e) : error(std::forward<E>(e)), success(false)
+            Outcome(E&& e) : result(), error(std::forward<E>(e)), success(false)
             {
             }
             Outcome(const Outcome& o) :
@@ -74,6 +74,7 @@ namespace Aws
                                                           !std::is_convertible<ET, E>::value, int> = 0>
             Outcome(Outcome<RT, ET>&& o) :
                 result(std::move(o.result)),
+                error(),
                 success(o.success)
             {
                 assert(o.success);
@@ -83,6 +84,7 @@ namespace Aws
             template<typename RT, typename ET, enable_if_t<!std::is_convertible<RT, R>::value &&
                                                             std::is_convertible<ET, E>::value, int> = 0>
             Outcome(Outcome<RT, ET>&& o) :
+                result(),
                 error(std::move(o.error)),
                 success(o.success)
             {
@@ -90,7 +92,7 @@ namespace Aws
             }
 
             template<typename ET, enable_if_t<std::is_convertible<ET, E>::value, int> = 0>
-            Outcome(ET&& e) : error(std::forward<ET>(e)), success(false)
+            Outcome(ET&& e) : result(), error(std::forward<ET>(e)), success(false)
             {
             }
 
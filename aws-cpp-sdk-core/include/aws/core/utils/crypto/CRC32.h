@@ -0,0 +1,79 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/crypto/Hash.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * CRC32 checksum (the polynomial of zlib and gzip), computed by aws-checksums with the CRC instructions of the CPU when it has them.
+             * The result is the 4 byte checksum in big endian order, the form S3 expects base64 encoded.
+             */
+            class AWS_CORE_API CRC32 : public Hash
+            {
+            public:
+
+                CRC32();
+                virtual ~CRC32() = default;
+
+                /**
+                * Calculates a CRC32 checksum
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates a CRC32 checksum on a stream (the entire stream is read)
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+
+                uint32_t m_runningCrc;
+            };
+
+            /**
+             * CRC32C (Castagnoli) checksum, computed the same way and returned in the same form as CRC32.
+             */
+            class AWS_CORE_API CRC32C : public Hash
+            {
+            public:
+
+                CRC32C();
+                virtual ~CRC32C() = default;
+
+                /**
+                * Calculates a CRC32C checksum
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates a CRC32C checksum on a stream (the entire stream is read)
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+
+                uint32_t m_runningCrc;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
@@ -36,6 +36,19 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) = 0;
 
+                /**
+                * Adds bufferSize bytes of buffer to the digest in progress, which the first call after construction or GetHash starts.
+                * Unlike Calculate, the digest in progress is state of the instance, so it must not be updated from several threads at once.
+                * Does nothing by default, for hashes that only implement Calculate.
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize);
+
+                /**
+                * Finishes the digest in progress and returns it. The next call to Update starts a new one.
+                * Returns a failed HashResult by default, for hashes that only implement Calculate.
+                */
+                virtual HashResult GetHash();
+
                 // when hashing streams, this is the size of our internal buffer we read the stream into
                 static const uint32_t INTERNAL_HASH_STREAM_BUFFER_SIZE = 8192;
             };
@@ -55,6 +55,10 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
             private:
 
                 std::shared_ptr<Hash> m_hashImpl;
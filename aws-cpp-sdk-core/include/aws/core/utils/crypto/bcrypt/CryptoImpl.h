@@ -68,6 +68,14 @@ namespace Aws
                  * Calculates a Hash on the stream without loading the entire stream into memory at once.
                  */
                 HashResult Calculate(Aws::IStream& stream);
+                /**
+                 * Adds bufferSize bytes of buffer to the digest in progress, starting one if needed.
+                 */
+                void Update(unsigned char* buffer, size_t bufferSize);
+                /**
+                 * Finishes the digest in progress and returns it.
+                 */
+                HashResult GetHash();
 
             private:
 
@@ -84,6 +92,10 @@ namespace Aws
                 DWORD m_hashObjectLength;
                 PBYTE m_hashObject;
 
+                //digest in progress for Update and GetHash. BCrypt allocates its hash object, since m_hashObject is reused by every Calculate.
+                BCRYPT_HASH_HANDLE m_incrementalHashHandle;
+                bool m_incrementalHashFailed;
+
                 //I'm 99% sure the algorithm handle for windows is not thread safe, but I can't
                 //prove or disprove that theory. Therefore, we have to lock to be safe.
                 std::mutex m_algorithmMutex;
@@ -110,6 +122,10 @@ namespace Aws
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
             private:
                 BCryptHashImpl m_impl;
             };
@@ -135,6 +151,10 @@ namespace Aws
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
             private:
                 BCryptHashImpl m_impl;
             };
@@ -59,28 +59,45 @@ namespace Aws
             {
             public:
 
-                MD5OpenSSLImpl()
-                { }
+                MD5OpenSSLImpl();
 
-                virtual ~MD5OpenSSLImpl() = default;
+                virtual ~MD5OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                void Init();
+
+                // Digest in progress for Update and GetHash, created by the first Update. Calculate uses its own.
+                EVP_MD_CTX* m_ctx;
             };
 
             class Sha256OpenSSLImpl : public Hash
             {
             public:
-                Sha256OpenSSLImpl()
-                { }
+                Sha256OpenSSLImpl();
 
-                virtual ~Sha256OpenSSLImpl() = default;
+                virtual ~Sha256OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                void Init();
+
+                // Digest in progress for Update and GetHash, created by the first Update. Calculate uses its own.
+                EVP_MD_CTX* m_ctx;
             };
 
             class Sha256HMACOpenSSLImpl : public HMAC
@@ -0,0 +1,164 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            class JsonValue;
+
+            enum class JsonTokenType
+            {
+                StartObject,
+                EndObject,
+                StartArray,
+                EndArray,
+                String,
+                Number,
+                Bool,
+                Null,
+                End,
+                Error
+            };
+
+            /**
+             * Pull parser reading JSON text in place, without building a DOM.
+             * Values are consumed in document order: open a container with StartObject or StartArray, iterate it with NextMember or NextElement,
+             * and read each value with one of the Read functions, SkipValue or a nested Start call. A value left unread is skipped by the next iteration.
+             * Reading a value as the wrong type skips it and returns the same default as the matching JsonView getter would.
+             * Copies of a reader share the text and continue independently from the position of the original.
+             *
+             * Strings are decoded only when read and keys without escape sequences are compared in place, so the only allocations are the
+             * Aws::String values returned to the caller.
+             */
+            class AWS_CORE_API JsonReader
+            {
+            public:
+                /**
+                 * Reader over an empty text.
+                 */
+                JsonReader();
+
+                /**
+                 * Reads the text in [data, data + length), which must outlive the reader and its copies.
+                 */
+                JsonReader(const char* data, size_t length);
+
+                /**
+                 * Reads the whole input stream into a buffer owned by the reader.
+                 */
+                JsonReader(Aws::IStream& istream);
+
+                /**
+                 * Takes ownership of the text.
+                 */
+                JsonReader(Aws::String&& text);
+
+                /**
+                 * Type of the next token, without consuming it.
+                 */
+                JsonTokenType Peek();
+
+                /**
+                 * Consumes the opening brace of an object and returns true.
+                 * Returns false, consuming the value, if the next value is not an object.
+                 */
+                bool StartObject();
+
+                /**
+                 * Moves to the next member of the current object and returns true, the key is then available through GetKey and KeyEquals
+                 * and the reader is positioned on its value. Members with a null value are skipped, like JsonView::ValueExists does.
+                 * Returns false after consuming the closing brace, or on a parse error.
+                 */
+                bool NextMember();
+
+                /**
+                 * Consumes the opening bracket of an array and returns true.
+                 * Returns false, consuming the value, if the next value is not an array.
+                 */
+                bool StartArray();
+
+                /**
+                 * Moves to the next element of the current array and returns true.
+                 * Returns false after consuming the closing bracket, or on a parse error.
+                 */
+                bool NextElement();
+
+                /**
+                 * Key of the current member. The pointer is valid until the next call to NextMember.
+                 */
+                const char* GetKeyData() const { return m_keyInScratch ? m_keyScratch.c_str() : m_keyData; }
+                size_t GetKeyLength() const { return m_keyLength; }
+                Aws::String GetKey() const { return Aws::String(GetKeyData(), m_keyLength); }
+                bool KeyEquals(const char* key) const;
+
+                Aws::String ReadString();
+                bool ReadBool();
+                int ReadInteger();
+                int64_t ReadInt64();
+                double ReadDouble();
+
+                /**
+                 * Parses the next value into a DOM, for values whose shape is not known in advance.
+                 */
+                JsonValue ReadValue();
+
+                /**
+                 * Consumes the next value, nested containers included.
+                 */
+                void SkipValue();
+
+                /**
+                 * Checks the whole text is a single, well formed JSON value without decoding anything, and rewinds.
+                 */
+                bool Validate();
+
+                bool WasParseSuccessful() const { return m_errorMessage.empty(); }
+                const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                void SkipWhitespace();
+                bool NextEntry(char closing);
+                bool ScanString(const char*& end, bool& hasEscapes);
+                bool DecodeString(const char* begin, const char* end, Aws::String& decoded);
+                bool ScanNumber(const char*& end);
+                bool ReadNumberToken(double& value, int64_t& integerValue, bool& isInteger);
+                bool ExpectLiteral(const char* literal, size_t length);
+                bool SkipValueInternal(size_t depth);
+                void SetError(const char* message);
+
+                std::shared_ptr<const Aws::String> m_ownedText;
+                const char* m_begin;
+                const char* m_position;
+                const char* m_end;
+
+                const char* m_keyData;
+                size_t m_keyLength;
+                // Keys with escape sequences are decoded here, keeping the copies of a reader independent.
+                Aws::String m_keyScratch;
+                bool m_keyInScratch;
+
+                // True right after a container is opened, when no separator precedes the first member or element.
+                bool m_atContainerStart;
+                // True when NextMember or NextElement returned a value that has not been consumed yet.
+                bool m_valuePending;
+                Aws::String m_errorMessage;
+            };
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
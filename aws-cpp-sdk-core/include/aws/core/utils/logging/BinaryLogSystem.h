@@ -0,0 +1,109 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <thread>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Logger writing a compact binary log rather than text, for statements logged at a rate where formatting them costs too much.
+             * The first statement with a given tag or printf style format string writes it out once along with an id, later statements only record
+             * their level, timestamp, thread, tag and format ids and their raw arguments: nothing is formatted on the logging thread.
+             * Statements logged with LogStream are recorded as the "%s" format with the streamed message as argument.
+             *
+             * scripts/decode_binary_log.py turns the log into the lines DefaultLogSystem would have written, with threads shown as a hash of their id.
+             * A background thread writes the records out in batches.
+             */
+            class AWS_CORE_API BinaryLogSystem : public LogSystemInterface
+            {
+            public:
+                using Base = LogSystemInterface;
+
+                /**
+                 * Initialize the logging system to write to the supplied binary output. Creates logging thread on construction.
+                 */
+                BinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile);
+                /**
+                 * Initialize the logging system to write to a computed file path filenamePrefix + "timestamp.binlog". Creates logging thread
+                 * on construction. The file is not rolled since its records refer to the tags and formats written at its start.
+                 */
+                BinaryLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix);
+
+                virtual ~BinaryLogSystem();
+
+                /**
+                 * Gets the currently configured log level.
+                 */
+                virtual LogLevel GetLogLevel(void) const override { return m_logLevel; }
+                /**
+                 * Set a new log level. This has the immediate effect of changing the log output to the new level.
+                 */
+                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); }
+
+                /**
+                 * Records the format string and the arguments it consumes, without formatting them.
+                 */
+                virtual void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override;
+
+                /**
+                 * Records the stream as the argument of the "%s" format.
+                 */
+                virtual void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream) override;
+
+                /**
+                 * Writes out the records buffered so far and waits until they are written.
+                 * This method is thread-safe.
+                 */
+                void Flush() override;
+
+            private:
+                BinaryLogSystem(const BinaryLogSystem& rhs) = delete;
+                BinaryLogSystem& operator =(const BinaryLogSystem& rhs) = delete;
+
+                void AppendStatement(LogLevel logLevel, const char* tag, const char* formatStr, va_list args);
+                uint32_t InternString(const char* text);
+                void LogThread(std::shared_ptr<Aws::OStream> logFile);
+
+                std::atomic<LogLevel> m_logLevel;
+
+                // Guards everything below but the logging thread.
+                std::mutex m_logMutex;
+                std::condition_variable m_signal;
+                Aws::String m_pendingRecords;
+                // Tags and formats written out so far, indexed by id.
+                Aws::Vector<Aws::String> m_strings;
+                Aws::Map<Aws::String, uint32_t> m_idsByText;
+                // Statements almost always pass string literals, looking them up by address saves comparing them with all the others.
+                Aws::UnorderedMap<const char*, uint32_t> m_idsByAddress;
+                bool m_stopLogging;
+                uint64_t m_flushesRequested;
+                uint64_t m_flushesCompleted;
+
+                std::thread m_loggingThread;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -17,6 +17,17 @@
 //  (1) Can be compiled out completely, so you don't even have to pay the cost to check the log level (which will be a virtual function call and a std::atomic<> read) if you don't want any AWS logging
 //  (2) If you use logging and the log statement doesn't pass the conditional log filter level, not only do you not pay the cost of building the log string, you don't pay the cost for allocating or
 //      getting any of the values used in building the log string, as they're in a scope (if-statement) that never gets entered.
+//  (3) Statements more verbose than AWS_LOG_LEVEL_THRESHOLD, the int value of a LogLevel set with the AWS_LOG_LEVEL_THRESHOLD CMake variable, are compiled out
+//      of release builds while logging stays available: they are still type checked, so variables only used in them don't trigger warnings, but their
+//      condition is a constant false and the optimizer drops them.
+
+#ifndef AWS_LOG_LEVEL_THRESHOLD
+    #define AWS_LOG_LEVEL_THRESHOLD 6 // LogLevel::Trace
+#endif
+
+// The log system for statements of level, a constant nullptr for levels above AWS_LOG_LEVEL_THRESHOLD.
+#define AWS_LOG_SYSTEM_FOR_LEVEL(level) \
+    (static_cast<int>(level) <= AWS_LOG_LEVEL_THRESHOLD ? Aws::Utils::Logging::GetLogSystem() : nullptr)
 
 #ifdef DISABLE_AWS_LOGGING
 
@@ -51,7 +62,7 @@
 
     #define AWS_LOG(level, tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(level); \
             if ( logSystem && logSystem->GetLogLevel() >= level ) \
             { \
                 logSystem->Log(level, tag, __VA_ARGS__); \
@@ -60,7 +71,7 @@
 
     #define AWS_LOG_FATAL(tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Fatal); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Fatal ) \
             { \
                 logSystem->Log(Aws::Utils::Logging::LogLevel::Fatal, tag, __VA_ARGS__); \
@@ -69,7 +80,7 @@
 
     #define AWS_LOG_ERROR(tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Error); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Error ) \
             { \
                 logSystem->Log(Aws::Utils::Logging::LogLevel::Error, tag, __VA_ARGS__); \
@@ -78,7 +89,7 @@
 
     #define AWS_LOG_WARN(tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Warn); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Warn ) \
             { \
                 logSystem->Log(Aws::Utils::Logging::LogLevel::Warn, tag, __VA_ARGS__); \
@@ -87,7 +98,7 @@
 
     #define AWS_LOG_INFO(tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Info); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Info ) \
             { \
                 logSystem->Log(Aws::Utils::Logging::LogLevel::Info, tag, __VA_ARGS__); \
@@ -96,7 +107,7 @@
 
     #define AWS_LOG_DEBUG(tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Debug); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Debug ) \
             { \
                 logSystem->Log(Aws::Utils::Logging::LogLevel::Debug, tag, __VA_ARGS__); \
@@ -105,7 +116,7 @@
 
     #define AWS_LOG_TRACE(tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Trace); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Trace ) \
             { \
                 logSystem->Log(Aws::Utils::Logging::LogLevel::Trace, tag, __VA_ARGS__); \
@@ -114,18 +125,18 @@
 
     #define AWS_LOGSTREAM(level, tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(level); \
             if ( logSystem && logSystem->GetLogLevel() >= level ) \
             { \
                 Aws::OStringStream logStream; \
                 logStream << streamExpression; \
-                logSystem->LogStream( logLevel, tag, logStream ); \
+                logSystem->LogStream( level, tag, logStream ); \
             } \
         }
 
     #define AWS_LOGSTREAM_FATAL(tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Fatal); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Fatal ) \
             { \
                 Aws::OStringStream logStream; \
@@ -136,7 +147,7 @@
 
     #define AWS_LOGSTREAM_ERROR(tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Error); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Error ) \
             { \
                 Aws::OStringStream logStream; \
@@ -147,7 +158,7 @@
 
     #define AWS_LOGSTREAM_WARN(tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Warn); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Warn ) \
             { \
                 Aws::OStringStream logStream; \
@@ -158,7 +169,7 @@
 
     #define AWS_LOGSTREAM_INFO(tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Info); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Info ) \
             { \
                 Aws::OStringStream logStream; \
@@ -169,7 +180,7 @@
 
     #define AWS_LOGSTREAM_DEBUG(tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Debug); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Debug ) \
             { \
                 Aws::OStringStream logStream; \
@@ -180,7 +191,7 @@
 
     #define AWS_LOGSTREAM_TRACE(tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+            Aws::Utils::Logging::LogSystemInterface* logSystem = AWS_LOG_SYSTEM_FOR_LEVEL(Aws::Utils::Logging::LogLevel::Trace); \
             if ( logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Trace ) \
             { \
                 Aws::OStringStream logStream; \
@@ -0,0 +1,162 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <thread>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            class ThreadLogBuffer;
+
+            /**
+             * Logger for high volume logging, e.g. at Debug or Trace level, writing the same lines as DefaultLogSystem.
+             * Each logging thread copies its statements into a ring buffer of its own without taking a lock or allocating. A background thread
+             * formats the level, timestamp and thread id of the statements of all the threads and writes them out in batches, ordered by time.
+             * A statement that does not fit in the buffer of its thread is dropped rather than blocking the thread, the number of dropped
+             * statements is logged once there is room again.
+             */
+            class AWS_CORE_API RingBufferLogSystem : public LogSystemInterface
+            {
+            public:
+                using Base = LogSystemInterface;
+
+                static const size_t DEFAULT_THREAD_BUFFER_SIZE = 64 * 1024;
+
+                /**
+                 * Initialize the logging system to write to the supplied logfile output. Each thread logging gets a buffer of threadBufferSize bytes.
+                 * Creates logging thread on construction.
+                 */
+                RingBufferLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t threadBufferSize = DEFAULT_THREAD_BUFFER_SIZE);
+                /**
+                 * Initialize the logging system to write to a computed file path filenamePrefix + "timestamp.log", rolled every hour.
+                 * Each thread logging gets a buffer of threadBufferSize bytes. Creates logging thread on construction.
+                 */
+                RingBufferLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t threadBufferSize = DEFAULT_THREAD_BUFFER_SIZE);
+
+                virtual ~RingBufferLogSystem();
+
+                /**
+                 * Gets the currently configured log level.
+                 */
+                virtual LogLevel GetLogLevel(void) const override { return m_logLevel; }
+                /**
+                 * Set a new log level. This has the immediate effect of changing the log output to the new level.
+                 */
+                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); }
+
+                /**
+                 * Does a printf style output to the buffer of the calling thread. Don't use this, it's unsafe. See LogStream
+                 */
+                virtual void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override;
+
+                /**
+                 * Writes the stream to the buffer of the calling thread.
+                 */
+                virtual void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream) override;
+
+                /**
+                 * Writes out the statements buffered so far by all the threads and waits until they are written.
+                 * This method is thread-safe.
+                 */
+                void Flush() override;
+
+                /**
+                 * Number of statements dropped so far because the buffer of their thread was full.
+                 */
+                uint64_t GetDroppedStatementCount() const { return m_droppedStatements.load(); }
+
+            protected:
+                /**
+                 * Position of a formatted statement in the text passed to WriteStatements.
+                 */
+                struct FormattedStatement
+                {
+                    int64_t timestampMillis;
+                    size_t offset;
+                    // Length of the line, without its trailing newline.
+                    size_t length;
+                };
+
+                /**
+                 * For log systems writing the statements somewhere else than a file, by overriding WriteStatements.
+                 * The logging thread is not created until StartLogging is called, at the end of the constructor of the derived class.
+                 */
+                RingBufferLogSystem(LogLevel logLevel, size_t threadBufferSize);
+
+                void StartLogging();
+                /**
+                 * Writes out the buffered statements one last time and joins the logging thread. Derived classes overriding WriteStatements
+                 * call this in their destructor, before the state WriteStatements uses is destroyed.
+                 */
+                void StopLogging();
+
+                /**
+                 * Called by the logging thread on each pass, every 100ms or sooner, with the statements buffered since the last pass.
+                 * text holds the statements formatted as lines, ordered by time, and may be empty. flush is true when Flush was called,
+                 * or the log system is stopping. Statements logged from the logging thread itself are dropped, so that writing them out
+                 * does not log more statements without end. Writes text to the log file by default.
+                 */
+                virtual void WriteStatements(const Aws::String& text, const Aws::Vector<FormattedStatement>& statements, bool flush);
+
+            private:
+                RingBufferLogSystem(const RingBufferLogSystem& rhs) = delete;
+                RingBufferLogSystem& operator =(const RingBufferLogSystem& rhs) = delete;
+
+                void Append(LogLevel logLevel, const char* tag, const char* message, size_t messageLength);
+                ThreadLogBuffer* GetThreadBuffer();
+                void LogThread();
+                void WriteBufferedStatements(bool flush);
+                void AppendPrefix(int32_t logLevel, int64_t timestampMillis);
+                void AppendThreadId(const Aws::String& threadIdText);
+
+                std::atomic<LogLevel> m_logLevel;
+                const size_t m_threadBufferSize;
+                // Tells this log system apart from one that used to live at the same address in the buffer cache of a thread.
+                const uint64_t m_id;
+                std::atomic<uint64_t> m_droppedStatements;
+
+                std::mutex m_threadBuffersMutex;
+                Aws::Vector<std::shared_ptr<ThreadLogBuffer>> m_threadBuffers;
+
+                std::mutex m_signalMutex;
+                std::condition_variable m_signal;
+                std::atomic<bool> m_wakeRequested;
+                bool m_stopLogging;
+                uint64_t m_flushesRequested;
+                uint64_t m_flushesCompleted;
+
+                // Only used by the logging thread.
+                std::shared_ptr<Aws::OStream> m_logFile;
+                Aws::String m_filenamePrefix;
+                bool m_rollLog;
+                int32_t m_lastRolledHour;
+                Aws::String m_writeBuffer;
+                Aws::Vector<FormattedStatement> m_formattedStatements;
+                int64_t m_timestampSecond;
+                Aws::String m_timestampSecondText;
+
+                std::thread m_loggingThread;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
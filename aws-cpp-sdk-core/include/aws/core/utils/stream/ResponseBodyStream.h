@@ -0,0 +1,171 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <streambuf>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * Stream buffer a response body is written to and then read back from, stored in a single contiguous allocation.
+             * The allocation can be reserved up front, grows by doubling otherwise, and is kept when the buffer is reset,
+             * so that it can be reused for the next body.
+             */
+            class AWS_CORE_API ResponseBodyStreamBuf : public std::streambuf
+            {
+            public:
+                ResponseBodyStreamBuf();
+                ~ResponseBodyStreamBuf();
+
+                ResponseBodyStreamBuf(const ResponseBodyStreamBuf&) = delete;
+                ResponseBodyStreamBuf& operator=(const ResponseBodyStreamBuf&) = delete;
+
+                ResponseBodyStreamBuf(ResponseBodyStreamBuf&&) = delete;
+                ResponseBodyStreamBuf& operator=(ResponseBodyStreamBuf&&) = delete;
+
+                /**
+                 * Makes room for a body of length bytes without further allocations.
+                 */
+                void Reserve(size_t length);
+
+                /**
+                 * Drops the body written so far, keeping the allocation.
+                 */
+                void Reset();
+
+                /**
+                 * Returns the body written so far, followed by a null terminator. Valid until the buffer is written to.
+                 */
+                const char* GetData();
+                size_t GetLength() const;
+
+                /**
+                 * Returns the part of the body that wasn't read yet, followed by a null terminator. Valid until the buffer is written to.
+                 */
+                const char* GetUnreadData();
+                size_t GetUnreadLength() const;
+
+                /**
+                 * Number of bytes that can be written without allocating.
+                 */
+                size_t GetCapacity() const;
+
+                /**
+                 * Replaces the allocation with buffer, of size bytes allocated with Aws::Malloc, dropping the body written so far.
+                 * Returns the previous allocation and its size, or nullptr, for the caller to free or reuse.
+                 */
+                char* SwapBuffer(char* buffer, size_t size, size_t& previousSize);
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+                int_type overflow(int_type c = traits_type::eof()) override;
+                int_type underflow() override;
+                std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+            private:
+                char* GetEnd() const;
+                void SetAreas(size_t getPosition, size_t putPosition, size_t end);
+                void Grow(size_t minLength);
+
+                char* m_buffer;
+                // Allocated size, one byte larger than the capacity to always leave room for the null terminator.
+                size_t m_allocatedSize;
+                // End of the body, the put pointer can be moved before it by seeking.
+                char* m_end;
+            };
+
+            /**
+             * Stream used for response bodies by default. Its storage comes from a free list of the thread creating it,
+             * and goes back to the free list of the thread destroying it, so that small bodies are written without allocating.
+             * HTTP clients reserve it from the Content-Length of the response, and the JSON and XML parsers read it in place.
+             */
+            class AWS_CORE_API ResponseBodyStream : public Aws::IOStream
+            {
+            public:
+                ResponseBodyStream();
+                virtual ~ResponseBodyStream();
+
+                ResponseBodyStream(const ResponseBodyStream&) = delete;
+                ResponseBodyStream& operator=(const ResponseBodyStream&) = delete;
+
+                inline ResponseBodyStreamBuf& GetBuffer() { return m_buffer; }
+
+                /**
+                 * Whether the stream is owned by the caller of the service rather than by the response it is the body of.
+                 */
+                inline bool IsOwnedByCaller() const { return m_ownedByCaller; }
+
+                /**
+                 * Returns stream as a ResponseBodyStream, or nullptr if it is another kind of stream. Doesn't rely on RTTI.
+                 */
+                static ResponseBodyStream* FromStream(std::ios_base& stream);
+
+                /**
+                 * Reserves room for a body of length bytes if stream is a ResponseBodyStream, does nothing otherwise.
+                 * Very large lengths are only partially reserved, the rest is allocated as the body is received.
+                 */
+                static void ReserveIfBuffered(std::ios_base& stream, uint64_t length);
+
+            protected:
+                ResponseBodyStream(size_t capacity, bool ownedByCaller);
+
+            private:
+                void Register();
+
+                ResponseBodyStreamBuf m_buffer;
+                bool m_ownedByCaller;
+            };
+
+            /**
+             * Response body stream owned by the caller and reused across calls, for a single call at a time.
+             * Pass GetFactory() to SetResponseStreamFactory of the requests: the sink is cleared when a response starts
+             * and keeps its allocation, so once it has grown to the size of the bodies, calls don't allocate for them.
+             * The body of a result only stays valid until the sink is used for the next call or destroyed.
+             */
+            class AWS_CORE_API ResponseBodySink : public ResponseBodyStream
+            {
+            public:
+                /**
+                 * @param capacity Number of bytes allocated up front.
+                 */
+                explicit ResponseBodySink(size_t capacity);
+
+                /**
+                 * Returns a factory handing out this sink, cleared. The sink must outlive the requests it is set on.
+                 */
+                Aws::IOStreamFactory GetFactory();
+            };
+
+            /**
+             * Factory of the ResponseBodyStreams used for response bodies by default.
+             */
+            AWS_CORE_API Aws::IOStream* PooledResponseStreamFactoryMethod();
+
+            /**
+             * Lets the threads keep the buffers of the ResponseBodyStreams they destroy, called by Aws::InitAPI.
+             */
+            AWS_CORE_API void InitResponseBufferPools();
+
+            /**
+             * Frees the buffers kept by all the threads and stops keeping them, called by Aws::ShutdownAPI
+             * before the memory system they were allocated from is shut down.
+             */
+            AWS_CORE_API void CleanupResponseBufferPools();
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
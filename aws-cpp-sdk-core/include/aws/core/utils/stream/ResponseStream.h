@@ -17,6 +17,7 @@ namespace Aws
         {
             /**
              * Encapsulates and manages ownership of custom response streams. This is a move only type.
+             * Streams owned by the caller, such as a ResponseBodySink, are not deleted.
              */
             class AWS_CORE_API ResponseStream
             {
@@ -67,6 +68,10 @@ namespace Aws
                 virtual ~DefaultUnderlyingStream();
             };
 
+            /**
+             * Creates the streams response bodies are written to unless the request sets another factory: ResponseBodyStreams,
+             * whose storage is pooled per thread.
+             */
             AWS_CORE_API Aws::IOStream* DefaultResponseStreamFactoryMethod();
 
         } //namespace Stream
@@ -10,6 +10,8 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/threading/TaskFunction.h>
+#include <condition_variable>
 #include <functional>
 #include <future>
 #include <mutex>
@@ -38,15 +40,41 @@ namespace Aws
                 template<class Fn, class ... Args>
                 bool Submit(Fn&& fn, Args&& ... args)
                 {
-                    std::function<void()> callable{ std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...) };
+                    auto bound = std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...);
+                    if (AcceptsTaskFunctions())
+                    {
+                        return SubmitTask(TaskFunction(std::move(bound)));
+                    }
+
+                    std::function<void()> callable{ std::move(bound) };
                     return SubmitToThread(std::move(callable));
                 }
 
+                /**
+                 * Submits a move only task. Executors not queueing TaskFunctions get it wrapped in a shared, copyable std::function.
+                 */
+                bool Submit(TaskFunction&& task)
+                {
+                    if (AcceptsTaskFunctions())
+                    {
+                        return SubmitTask(std::move(task));
+                    }
+
+                    auto sharedTask = Aws::MakeShared<TaskFunction>(TASK_FUNCTION_TAG, std::move(task));
+                    return SubmitToThread([sharedTask]() { (*sharedTask)(); });
+                }
+
             protected:
                 /**
                 * To implement your own executor implementation, then simply subclass Executor and implement this method.
                 */
                 virtual bool SubmitToThread(std::function<void()>&&) = 0;
+
+                /**
+                 * Executors queueing TaskFunctions return true and implement SubmitTask, Submit then skips the std::function wrapping.
+                 */
+                virtual bool AcceptsTaskFunctions() const { return false; }
+                virtual bool SubmitTask(TaskFunction&&) { return false; }
             };
 
 
@@ -113,6 +141,51 @@ namespace Aws
                 friend class ThreadTask;
             };
 
+            /**
+            * Thread pool executor where every worker has its own task deque. Tasks submitted from a worker go to its own deque,
+            * other submissions are spread round robin, and idle workers steal from the back of the other deques.
+            * Tasks are stored as TaskFunctions so small ones are queued without allocation.
+            * When pinWorkersToCpus is set, worker i is bound to CPU i modulo the number of CPUs, this is only supported on Linux.
+            * Tasks still queued on destruction are discarded, like PooledThreadExecutor does.
+            */
+            class AWS_CORE_API WorkStealingThreadExecutor : public Executor
+            {
+            public:
+                WorkStealingThreadExecutor(size_t poolSize, OverflowPolicy overflowPolicy = OverflowPolicy::QUEUE_TASKS_EVENLY_ACCROSS_THREADS,
+                                           bool pinWorkersToCpus = false);
+                ~WorkStealingThreadExecutor();
+
+                /**
+                * Rule of 5 stuff.
+                * Don't copy or move
+                */
+                WorkStealingThreadExecutor(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor& operator =(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor(WorkStealingThreadExecutor&&) = delete;
+                WorkStealingThreadExecutor& operator =(WorkStealingThreadExecutor&&) = delete;
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+                bool AcceptsTaskFunctions() const override { return true; }
+                bool SubmitTask(TaskFunction&&) override;
+
+            private:
+                struct Worker;
+
+                void WorkerMain(size_t index);
+                bool PopTask(size_t index, TaskFunction& task);
+
+                Aws::Vector<Worker*> m_workers;
+                std::atomic<size_t> m_nextWorker;
+                std::atomic<size_t> m_queuedTasks;
+                std::atomic<size_t> m_sleepingWorkers;
+                std::atomic<bool> m_continue;
+                std::mutex m_sleepLock;
+                std::condition_variable m_sleepSignal;
+                OverflowPolicy m_overflowPolicy;
+                bool m_pinWorkersToCpus;
+            };
+
 
         } // namespace Threading
     } // namespace Utils
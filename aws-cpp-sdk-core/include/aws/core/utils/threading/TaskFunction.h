@@ -0,0 +1,177 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            static const char TASK_FUNCTION_TAG[] = "TaskFunction";
+
+            /**
+             * Move only, type erased void() callable for executor queues.
+             * Callables of up to INLINE_CAPACITY bytes are stored inside the object, larger ones take a single allocation from the SDK's memory system.
+             * Unlike std::function, the callable does not need to be copyable.
+             */
+            class TaskFunction
+            {
+            public:
+                static const size_t INLINE_CAPACITY = 8 * sizeof(void*);
+
+                TaskFunction() : m_invoke(nullptr), m_manage(nullptr), m_inline(false) {}
+
+                template<typename Fn, typename = typename std::enable_if<!std::is_same<typename std::decay<Fn>::type, TaskFunction>::value>::type>
+                TaskFunction(Fn&& fn) : m_invoke(nullptr), m_manage(nullptr), m_inline(false)
+                {
+                    typedef typename std::decay<Fn>::type Callable;
+                    Store<Callable>(std::forward<Fn>(fn), std::integral_constant<bool, FitsInline<Callable>::value>());
+                }
+
+                TaskFunction(TaskFunction&& other) : m_invoke(other.m_invoke), m_manage(other.m_manage), m_inline(other.m_inline)
+                {
+                    if (m_manage)
+                    {
+                        m_manage(Operation::Move, &other.m_storage, &m_storage);
+                        other.m_invoke = nullptr;
+                        other.m_manage = nullptr;
+                    }
+                }
+
+                TaskFunction& operator=(TaskFunction&& other)
+                {
+                    if (this != &other)
+                    {
+                        Reset();
+                        if (other.m_manage)
+                        {
+                            other.m_manage(Operation::Move, &other.m_storage, &m_storage);
+                            m_invoke = other.m_invoke;
+                            m_manage = other.m_manage;
+                            m_inline = other.m_inline;
+                            other.m_invoke = nullptr;
+                            other.m_manage = nullptr;
+                        }
+                    }
+                    return *this;
+                }
+
+                TaskFunction(const TaskFunction&) = delete;
+                TaskFunction& operator=(const TaskFunction&) = delete;
+
+                ~TaskFunction() { Reset(); }
+
+                void operator()() { m_invoke(&m_storage); }
+
+                explicit operator bool() const { return m_invoke != nullptr; }
+
+                /**
+                 * Destroys the stored callable, releasing whatever it captured.
+                 */
+                void Reset()
+                {
+                    if (m_manage)
+                    {
+                        m_manage(Operation::Destroy, &m_storage, nullptr);
+                        m_invoke = nullptr;
+                        m_manage = nullptr;
+                    }
+                }
+
+                /**
+                 * Returns true if the callable is stored inside the object, without allocation.
+                 */
+                bool IsInline() const { return m_manage != nullptr && m_inline; }
+
+            private:
+                enum class Operation
+                {
+                    Move,
+                    Destroy
+                };
+
+                typedef void (*InvokeFunction)(void* storage);
+                typedef void (*ManageFunction)(Operation operation, void* source, void* destination);
+                typedef typename std::aligned_storage<INLINE_CAPACITY, alignof(std::max_align_t)>::type Storage;
+
+                template<typename Callable>
+                struct FitsInline
+                {
+                    static const bool value = sizeof(Callable) <= INLINE_CAPACITY && alignof(Callable) <= alignof(std::max_align_t) &&
+                                              std::is_nothrow_move_constructible<Callable>::value;
+                };
+
+                template<typename Callable>
+                static void InvokeInline(void* storage)
+                {
+                    (*static_cast<Callable*>(storage))();
+                }
+
+                template<typename Callable>
+                static void ManageInline(Operation operation, void* source, void* destination)
+                {
+                    Callable* callable = static_cast<Callable*>(source);
+                    if (operation == Operation::Move)
+                    {
+                        new (destination) Callable(std::move(*callable));
+                    }
+                    callable->~Callable();
+                }
+
+                template<typename Callable>
+                static void InvokeAllocated(void* storage)
+                {
+                    (**static_cast<Callable**>(storage))();
+                }
+
+                template<typename Callable>
+                static void ManageAllocated(Operation operation, void* source, void* destination)
+                {
+                    Callable** callable = static_cast<Callable**>(source);
+                    if (operation == Operation::Move)
+                    {
+                        *static_cast<Callable**>(destination) = *callable;
+                    }
+                    else
+                    {
+                        Aws::Delete(*callable);
+                    }
+                }
+
+                template<typename Callable, typename Fn>
+                void Store(Fn&& fn, std::true_type /*fitsInline*/)
+                {
+                    new (&m_storage) Callable(std::forward<Fn>(fn));
+                    m_invoke = &InvokeInline<Callable>;
+                    m_manage = &ManageInline<Callable>;
+                    m_inline = true;
+                }
+
+                template<typename Callable, typename Fn>
+                void Store(Fn&& fn, std::false_type /*fitsInline*/)
+                {
+                    *reinterpret_cast<Callable**>(&m_storage) = Aws::New<Callable>(TASK_FUNCTION_TAG, std::forward<Fn>(fn));
+                    m_invoke = &InvokeAllocated<Callable>;
+                    m_manage = &ManageAllocated<Callable>;
+                    m_inline = false;
+                }
+
+                Storage m_storage;
+                InvokeFunction m_invoke;
+                ManageFunction m_manage;
+                bool m_inline;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
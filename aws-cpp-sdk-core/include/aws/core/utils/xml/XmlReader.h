@@ -0,0 +1,137 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Xml
+        {
+            /**
+             * Pull parser reading XML text in place, without building a DOM.
+             * Elements are consumed in document order: NextChild moves to the next child element of the current element, the document
+             * itself at first, so the first call returns the root element. The element it returns can be read with ReadText, entered with
+             * StartElement to iterate its own children, or skipped with SkipElement. An element left unread is skipped by the next call to NextChild.
+             * Copies of a reader share the text and continue independently from the position of the original.
+             *
+             * Names and attributes are compared in place and text is decoded only when read, so the only allocations are the
+             * Aws::String values returned to the caller.
+             */
+            class AWS_CORE_API XmlReader
+            {
+            public:
+                /**
+                 * Reader over an empty text.
+                 */
+                XmlReader();
+
+                /**
+                 * Reads the text in [data, data + length), which must outlive the reader and its copies.
+                 */
+                XmlReader(const char* data, size_t length);
+
+                /**
+                 * Reads the whole input stream into a buffer owned by the reader.
+                 */
+                XmlReader(Aws::IStream& istream);
+
+                /**
+                 * Takes ownership of the text.
+                 */
+                XmlReader(Aws::String&& text);
+
+                /**
+                 * Moves to the next child element of the current element and returns true, its name and attributes are then available
+                 * through GetName, NameEquals and GetAttribute. Text, comments and processing instructions between elements are skipped.
+                 * Returns false after consuming the end tag of the current element, at the end of the document, or on a parse error.
+                 */
+                bool NextChild();
+
+                /**
+                 * Makes the element returned by NextChild the current element, so that NextChild iterates its children, and returns true.
+                 * Returns false if there is no such element or on a parse error.
+                 */
+                bool StartElement();
+
+                /**
+                 * Name of the element returned by NextChild, namespace prefix included. The pointer is valid as long as the text.
+                 */
+                const char* GetNameData() const { return m_nameData; }
+                size_t GetNameLength() const { return m_nameLength; }
+                Aws::String GetName() const { return Aws::String(m_nameData, m_nameLength); }
+                bool NameEquals(const char* name) const;
+
+                /**
+                 * Decoded value of an attribute of the element returned by NextChild, or an empty string if it has no such attribute.
+                 */
+                Aws::String GetAttribute(const char* name) const;
+
+                /**
+                 * Consumes the element returned by NextChild and returns its decoded text, CDATA sections included.
+                 * Text of nested elements is skipped, like XmlNode::GetText would return their markup.
+                 */
+                Aws::String ReadText();
+
+                /**
+                 * Consumes the element returned by NextChild, nested elements included.
+                 */
+                void SkipElement();
+
+                /**
+                 * Checks the whole text is a single, well formed XML document without decoding anything, and rewinds.
+                 */
+                bool Validate();
+
+                bool WasParseSuccessful() const { return m_errorMessage.empty(); }
+                const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                struct OpenElement
+                {
+                    const char* nameData;
+                    size_t nameLength;
+                    bool empty;
+                };
+
+                bool NextChildInternal(Aws::String* text);
+                bool ReadStartTag();
+                bool ReadEndTag();
+                bool SkipPast(const char* terminator, size_t length);
+                bool SkipDoctype();
+                void AppendText(const char* begin, const char* end, Aws::String& text) const;
+                const char* ScanName(const char* position) const;
+                void SetError(const char* message);
+
+                std::shared_ptr<const Aws::String> m_ownedText;
+                const char* m_begin;
+                const char* m_position;
+                const char* m_end;
+
+                const char* m_nameData;
+                size_t m_nameLength;
+                const char* m_attributesBegin;
+                const char* m_attributesEnd;
+
+                // True when NextChild returned an element whose content has not been consumed yet.
+                bool m_elementPending;
+                // True when that element is written as an empty element tag, <name/>, and has no content or end tag.
+                bool m_pendingIsEmpty;
+                Aws::Vector<OpenElement> m_openElements;
+                Aws::String m_errorMessage;
+            };
+        } // namespace Xml
+    } // namespace Utils
+} // namespace Aws
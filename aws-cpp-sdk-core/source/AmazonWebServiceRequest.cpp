@@ -14,7 +14,9 @@ AmazonWebServiceRequest::AmazonWebServiceRequest() :
     m_onDataSent(nullptr),
     m_continueRequest(nullptr),
     m_onRequestSigned(nullptr),
-    m_requestRetryHandler(nullptr)
+    m_requestRetryHandler(nullptr),
+    m_requestCompressionAlgorithm(Aws::Client::CompressionAlgorithm::NONE),
+    m_requestCompressionAlgorithmHasBeenSet(false)
 {
 }
 
@@ -5,6 +5,7 @@
 #include <aws/core/Version.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Aws.h>
+#include <aws/core/auth/RefreshingCredentialsCache.h>
 #include <aws/core/client/CoreErrors.h>
 #include <aws/core/utils/logging/AWSLogging.h>
 #include <aws/core/utils/logging/DefaultLogSystem.h>
@@ -14,6 +15,7 @@
 #include <aws/core/net/Net.h>
 #include <aws/core/config/AWSProfileConfigLoader.h>
 #include <aws/core/internal/AWSHttpResourceClient.h>
+#include <aws/core/utils/stream/ResponseBodyStream.h>
 
 namespace Aws
 {
@@ -27,6 +29,7 @@ namespace Aws
             Aws::Utils::Memory::InitializeAWSMemorySystem(*options.memoryManagementOptions.memoryManager);
         }
 #endif // USE_AWS_MEMORY_MANAGEMENT
+        Aws::Utils::Stream::InitResponseBufferPools();
         Aws::Client::CoreErrorsMapper::InitCoreErrorsMapper();
         if(options.loggingOptions.logLevel != Aws::Utils::Logging::LogLevel::Off)
         {
@@ -104,10 +107,12 @@ namespace Aws
         Aws::Net::InitNetwork();
         Aws::Internal::InitEC2MetadataClient();
         Aws::Monitoring::InitMonitoring(options.monitoringOptions.customizedMonitoringFactory_create_fn);
+        Aws::Auth::InitRefreshingCredentialsCaches();
     }
 
     void ShutdownAPI(const SDKOptions& options)
     {
+        Aws::Auth::CleanupRefreshingCredentialsCaches();
         Aws::Monitoring::CleanupMonitoring();
         Aws::Internal::CleanupEC2MetadataClient();
         Aws::Net::CleanupNetwork();
@@ -123,6 +128,7 @@ namespace Aws
         }
 
         Aws::Client::CoreErrorsMapper::CleanupCoreErrorsMapper();
+        Aws::Utils::Stream::CleanupResponseBufferPools();
 
 #ifdef USE_AWS_MEMORY_MANAGEMENT
         if(options.memoryManagementOptions.memoryManager)
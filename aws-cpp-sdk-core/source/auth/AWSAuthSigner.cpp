@@ -52,6 +52,7 @@ static const char* USER_AGENT = "user-agent";
 static const char* SIGNING_KEY = "AWS4";
 static const char* SIMPLE_DATE_FORMAT_STR = "%Y%m%d";
 static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+static const size_t MAX_DERIVED_KEYS_CACHE_SIZE = 32;
 
 static const char v4LogTag[] = "AWSAuthV4Signer";
 static const char v4StreamingLogTag[] = "AWSAuthEventStreamV4Signer";
@@ -69,79 +70,261 @@ namespace Aws
     }
 }
 
-static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool urlEscapePath)
+/**
+ * Append only buffer for the pieces of a canonical request. It lives on the stack and only spills over to the heap
+ * for requests that outgrow it, so canonicalizing a typical request doesn't allocate.
+ */
+template<size_t CAPACITY>
+class CanonicalBuffer
 {
-    request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
+public:
+    CanonicalBuffer() : m_length(0), m_spilled(false) {}
 
-    URI uriCpy = request.GetUri();
-    // Many AWS services do not decode the URL before calculating SignatureV4 on their end.
-    // This results in the signature getting calculated with a double encoded URL.
-    // That means we have to double encode it here for the signature to match on the service side.
-    if(urlEscapePath)
+    void Append(const char* data, size_t length)
     {
-        // RFC3986 is how we encode the URL before sending it on the wire.
-        auto rfc3986EncodedPath = URI::URLEncodePathRFC3986(uriCpy.GetPath());
-        uriCpy.SetPath(rfc3986EncodedPath);
-        // However, SignatureV4 uses this URL encoding scheme
-        signingStringStream << NEWLINE << uriCpy.GetURLEncodedPath() << NEWLINE;
+        if (!m_spilled && m_length + length <= CAPACITY)
+        {
+            if (length > 0)
+            {
+                memcpy(m_buffer + m_length, data, length);
+                m_length += length;
+            }
+            return;
+        }
+
+        if (!m_spilled)
+        {
+            m_overflow.reserve(2 * (m_length + length));
+            m_overflow.assign(m_buffer, m_length);
+            m_spilled = true;
+        }
+        m_overflow.append(data, length);
     }
-    else
+
+    void Append(const char* str) { Append(str, strlen(str)); }
+    void Append(const Aws::String& str) { Append(str.c_str(), str.size()); }
+    void Append(char c) { Append(&c, 1); }
+
+    template<size_t OTHER_CAPACITY>
+    void Append(const CanonicalBuffer<OTHER_CAPACITY>& other) { Append(other.GetData(), other.GetLength()); }
+
+    const char* GetData() const { return m_spilled ? m_overflow.c_str() : m_buffer; }
+    size_t GetLength() const { return m_spilled ? m_overflow.size() : m_length; }
+    Aws::String ToString() const { return Aws::String(GetData(), GetLength()); }
+
+private:
+    char m_buffer[CAPACITY];
+    size_t m_length;
+    bool m_spilled;
+    Aws::String m_overflow;
+};
+
+static const size_t CANONICAL_REQUEST_BUFFER_SIZE = 4096;
+static const size_t CANONICAL_HEADERS_BUFFER_SIZE = 2048;
+static const size_t SIGNED_HEADERS_BUFFER_SIZE = 512;
+static const size_t STRING_TO_SIGN_BUFFER_SIZE = 256;
+
+// Same definition of white space as StringUtils::Trim, so signatures don't change.
+static bool IsSpace(int ch)
+{
+    if (ch < -1 || ch > 255)
     {
-        // For the services that DO decode the URL first; we don't need to double encode it.
-        uriCpy.SetPath(uriCpy.GetURLEncodedPath());
-        signingStringStream << NEWLINE << uriCpy.GetPath() << NEWLINE;
+        return false;
     }
 
-    if (request.GetQueryString().find('=') != std::string::npos)
+    return ::isspace(ch) != 0;
+}
+
+static void TrimRange(const char*& begin, const char*& end)
+{
+    while (begin < end && IsSpace(*begin))
     {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
+        ++begin;
     }
-    else if (request.GetQueryString().size() > 1)
+    while (end > begin && IsSpace(*(end - 1)))
     {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
+        --end;
     }
-    else
+}
+
+// Appends [begin, end) with runs of spaces collapsed into a single one.
+template<size_t CAPACITY>
+static void AppendCollapsingSpaces(CanonicalBuffer<CAPACITY>& out, const char* begin, const char* end)
+{
+    while (begin < end)
     {
-        signingStringStream << NEWLINE;
+        const char* space = static_cast<const char*>(memchr(begin, ' ', end - begin));
+        if (!space)
+        {
+            out.Append(begin, end - begin);
+            return;
+        }
+        out.Append(begin, space - begin + 1);
+        begin = space + 1;
+        while (begin < end && *begin == ' ')
+        {
+            ++begin;
+        }
     }
-
-    return signingStringStream.str();
 }
 
-static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollection&& headers)
+/**
+ * Writes the canonical form of a header value: trimmed, multi line values joined on "," with every line but the first trimmed,
+ * duplicate spaces collapsed to one.
+ */
+template<size_t CAPACITY>
+static void AppendCanonicalHeaderValue(CanonicalBuffer<CAPACITY>& out, const Aws::String& value)
 {
-    Http::HeaderValueCollection canonicalHeaders;
-    for (const auto& header : headers)
-    {
-        auto trimmedHeaderName = StringUtils::Trim(header.first.c_str());
-        auto trimmedHeaderValue = StringUtils::Trim(header.second.c_str());
+    const char* begin = value.c_str();
+    const char* end = begin + value.size();
+    TrimRange(begin, end);
 
-        //multiline gets converted to line1,line2,etc...
-        auto headerMultiLine = StringUtils::SplitOnLine(trimmedHeaderValue);
-        Aws::String headerValue = headerMultiLine.size() == 0 ? "" : headerMultiLine[0];
+    bool firstLine = true;
+    for (const char* lineBegin = begin; lineBegin < end;)
+    {
+        const char* lineEnd = static_cast<const char*>(memchr(lineBegin, '\n', end - lineBegin));
+        if (!lineEnd)
+        {
+            lineEnd = end;
+        }
 
-        if (headerMultiLine.size() > 1)
+        // empty lines are dropped altogether.
+        if (lineEnd > lineBegin)
         {
-            for(size_t i = 1; i < headerMultiLine.size(); ++i)
+            const char* segmentBegin = lineBegin;
+            const char* segmentEnd = lineEnd;
+            if (!firstLine)
             {
-                headerValue += ",";
-                headerValue += StringUtils::Trim(headerMultiLine[i].c_str());
+                TrimRange(segmentBegin, segmentEnd);
+                out.Append(',');
             }
+            AppendCollapsingSpaces(out, segmentBegin, segmentEnd);
+            firstLine = false;
         }
+        lineBegin = lineEnd + 1;
+    }
+}
 
-        //duplicate spaces need to be converted to one.
-        Aws::String::iterator new_end =
-            std::unique(headerValue.begin(), headerValue.end(),
-                [=](char lhs, char rhs) { return (lhs == rhs) && (lhs == ' '); }
-        );
-        headerValue.erase(new_end, headerValue.end());
+template<typename HeaderNames>
+static bool IsUnsignedHeader(const HeaderNames& unsignedHeaders, const char* name, size_t length)
+{
+    for (const auto& unsignedHeader : unsignedHeaders)
+    {
+        if (unsignedHeader.size() == length && std::equal(name, name + length, unsignedHeader.c_str(),
+            [](char lhs, char rhs) { return ::tolower(static_cast<unsigned char>(lhs)) == ::tolower(static_cast<unsigned char>(rhs)); }))
+        {
+            return true;
+        }
+    }
+    return false;
+}
 
-        canonicalHeaders[trimmedHeaderName] = headerValue;
+/**
+ * Writes the canonical headers block (name:value lines) and the signed headers list (name;name) of the request.
+ * The request visits its headers lower cased and sorted, without copying them.
+ */
+template<typename HeaderNames, size_t HEADERS_CAPACITY, size_t SIGNED_HEADERS_CAPACITY>
+static void CanonicalizeHeaders(const HttpRequest& request, const HeaderNames& unsignedHeaders,
+    CanonicalBuffer<HEADERS_CAPACITY>& canonicalHeaders, CanonicalBuffer<SIGNED_HEADERS_CAPACITY>& signedHeaders)
+{
+    request.VisitHeaders([&](const char* name, size_t nameLength, const Aws::String& value)
+    {
+        const char* nameBegin = name;
+        const char* nameEnd = nameBegin + nameLength;
+        TrimRange(nameBegin, nameEnd);
+        size_t trimmedNameLength = nameEnd - nameBegin;
+        if (IsUnsignedHeader(unsignedHeaders, nameBegin, trimmedNameLength))
+        {
+            return;
+        }
+
+        canonicalHeaders.Append(nameBegin, trimmedNameLength);
+        canonicalHeaders.Append(':');
+        AppendCanonicalHeaderValue(canonicalHeaders, value);
+        canonicalHeaders.Append(NEWLINE);
+
+        if (signedHeaders.GetLength() > 0)
+        {
+            signedHeaders.Append(';');
+        }
+        signedHeaders.Append(nameBegin, trimmedNameLength);
+    });
+}
+
+/**
+ * Writes the method, path and query string lines of the canonical request.
+ */
+template<size_t CAPACITY>
+static void AppendCanonicalRequestLines(CanonicalBuffer<CAPACITY>& out, HttpRequest& request, bool urlEscapePath)
+{
+    request.CanonicalizeRequest();
+    out.Append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()));
+    out.Append(NEWLINE);
+
+    // Only used to normalize the path, so the rest of the request uri isn't copied.
+    URI pathUri;
+    // Many AWS services do not decode the URL before calculating SignatureV4 on their end.
+    // This results in the signature getting calculated with a double encoded URL.
+    // That means we have to double encode it here for the signature to match on the service side.
+    if(urlEscapePath)
+    {
+        // RFC3986 is how we encode the URL before sending it on the wire.
+        pathUri.SetPath(URI::URLEncodePathRFC3986(request.GetUri().GetPath()));
+        // However, SignatureV4 uses this URL encoding scheme
+        out.Append(pathUri.GetURLEncodedPath());
     }
+    else
+    {
+        // For the services that DO decode the URL first; we don't need to double encode it.
+        pathUri.SetPath(request.GetUri().GetURLEncodedPath());
+        out.Append(pathUri.GetPath());
+    }
+    out.Append(NEWLINE);
 
-    return canonicalHeaders;
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.size() > 1)
+    {
+        out.Append(queryString.c_str() + 1, queryString.size() - 1);
+        if (queryString.find('=') == Aws::String::npos)
+        {
+            out.Append(EQ);
+        }
+    }
+    out.Append(NEWLINE);
+}
+
+/**
+ * Hashes the canonical request straight out of its buffer, returns the hex encoded digest or an empty string on failure.
+ * Uses a Sha256 of its own, the digest in progress of the signer's would be shared by the threads signing concurrently.
+ */
+template<size_t CAPACITY>
+static Aws::String HashCanonicalRequest(const CanonicalBuffer<CAPACITY>& canonicalRequest)
+{
+    Aws::Utils::Crypto::Sha256 hash;
+    hash.Update(reinterpret_cast<unsigned char*>(const_cast<char*>(canonicalRequest.GetData())), canonicalRequest.GetLength());
+    auto hashResult = hash.GetHash();
+    if (!hashResult.IsSuccess())
+    {
+        // Custom implementations may only support Calculate.
+        hashResult = hash.Calculate(Aws::String(canonicalRequest.GetData(), canonicalRequest.GetLength()));
+        if (!hashResult.IsSuccess())
+        {
+            return {};
+        }
+    }
+    return HashingUtils::HexEncode(hashResult.GetResult());
+}
+
+static Aws::String BuildAuthorizationString(const Aws::String& accessKeyId, const Aws::String& simpleDate, const Aws::String& region,
+    const Aws::String& serviceName, const char* signedHeaders, size_t signedHeadersLength, const Aws::String& signature)
+{
+    Aws::String authorization;
+    authorization.reserve(256 + signedHeadersLength);
+    authorization.append(AWS_HMAC_SHA256).append(" ").append(CREDENTIAL).append(EQ).append(accessKeyId).append("/").append(simpleDate)
+        .append("/").append(region).append("/").append(serviceName).append("/").append(AWS4_REQUEST).append(", ")
+        .append(SIGNED_HEADERS).append(EQ).append(signedHeaders, signedHeadersLength).append(", ")
+        .append(SIGNATURE).append(EQ).append(signature);
+    return authorization;
 }
 
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
@@ -157,7 +340,8 @@ AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvi
     m_urlEscapePath(urlEscapePath)
 {
     //go ahead and warm up the signing cache.
-    ComputeHash(credentialsProvider->GetAWSCredentials().GetAWSSecretKey(), DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR), region, m_serviceName);
+    Utils::Threading::WriterLockGuard guard(m_partialSignatureLock);
+    CacheDerivedKey(credentialsProvider->GetAWSCredentials().GetAWSSecretKey(), DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR), region, m_serviceName);
 }
 
 AWSAuthV4Signer::~AWSAuthV4Signer()
@@ -187,21 +371,7 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, const char* r
     }
 
     Aws::String payloadHash(UNSIGNED_PAYLOAD);
-    switch(m_payloadSigningPolicy)
-    {
-        case PayloadSigningPolicy::Always:
-            signBody = true;
-            break;
-        case PayloadSigningPolicy::Never:
-            signBody = false;
-            break;
-        case PayloadSigningPolicy::RequestDependent:
-            // respect the request setting
-        default:
-            break;
-    }
-
-    if(signBody || request.GetUri().GetScheme() != Http::Scheme::HTTPS)
+    if(ShouldSignPayload(request, signBody))
     {
         payloadHash = ComputePayloadHash(request);
         if (payloadHash.empty())
@@ -225,54 +395,34 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, const char* r
     Aws::String dateHeaderValue = now.ToGmtString(DateFormat::ISO_8601_BASIC);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();
-    }
-
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
+    CanonicalBuffer<CANONICAL_HEADERS_BUFFER_SIZE> canonicalHeaders;
+    CanonicalBuffer<SIGNED_HEADERS_BUFFER_SIZE> signedHeaders;
+    CanonicalizeHeaders(request, m_unsignedHeaders, canonicalHeaders, signedHeaders);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeaders.ToString());
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeaders.ToString());
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
+    CanonicalBuffer<CANONICAL_REQUEST_BUFFER_SIZE> canonicalRequest;
+    AppendCanonicalRequestLines(canonicalRequest, request, m_urlEscapePath);
 
     //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(payloadHash);
+    canonicalRequest.Append(canonicalHeaders);
+    canonicalRequest.Append(NEWLINE);
+    canonicalRequest.Append(signedHeaders);
+    canonicalRequest.Append(NEWLINE);
+    canonicalRequest.Append(payloadHash);
 
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequest.ToString());
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
-    if (!hashResult.IsSuccess())
+    Aws::String canonicalRequestHash = HashCanonicalRequest(canonicalRequest);
+    if (canonicalRequestHash.empty())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string");
-        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequest.ToString() << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String canonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
     Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
 
     Aws::String signingRegion = region ? region : m_region;
@@ -280,12 +430,8 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, const char* r
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, canonicalRequestHash, signingRegion, signingServiceName);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate, signingRegion, signingServiceName);
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << signingRegion << "/" << signingServiceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
-
-    auto awsAuthString = ss.str();
+    auto awsAuthString = BuildAuthorizationString(credentials.GetAWSAccessKeyId(), simpleDate, signingRegion, signingServiceName,
+        signedHeaders.GetData(), signedHeaders.GetLength(), finalSignature);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
@@ -327,28 +473,12 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
     Aws::String dateQueryValue = now.ToGmtString(DateFormat::ISO_8601_BASIC);
     request.AddQueryStringParameter(Http::AWS_DATE_HEADER, dateQueryValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue(signedHeadersStream.str());
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();
-    }
+    CanonicalBuffer<CANONICAL_HEADERS_BUFFER_SIZE> canonicalHeaders;
+    CanonicalBuffer<SIGNED_HEADERS_BUFFER_SIZE> signedHeaders;
+    CanonicalizeHeaders(request, m_unsignedHeaders, canonicalHeaders, signedHeaders);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeaders.ToString());
 
+    Aws::String signedHeadersValue = signedHeaders.ToString();
     request.AddQueryStringParameter(X_AMZ_SIGNED_HEADERS, signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value: " << signedHeadersValue);
 
@@ -367,35 +497,33 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
     request.SetSigningRegion(signingRegion);
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
+    CanonicalBuffer<CANONICAL_REQUEST_BUFFER_SIZE> canonicalRequest;
+    AppendCanonicalRequestLines(canonicalRequest, request, m_urlEscapePath);
 
     //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
+    canonicalRequest.Append(canonicalHeaders);
+    canonicalRequest.Append(NEWLINE);
+    canonicalRequest.Append(signedHeaders);
+    canonicalRequest.Append(NEWLINE);
     if (ServiceRequireUnsignedPayload(signingServiceName))
     {
-        canonicalRequestString.append(UNSIGNED_PAYLOAD);
+        canonicalRequest.Append(UNSIGNED_PAYLOAD);
     }
     else
     {
-        canonicalRequestString.append(EMPTY_STRING_SHA256);
+        canonicalRequest.Append(EMPTY_STRING_SHA256);
     }
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequest.ToString());
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
-    if (!hashResult.IsSuccess())
+    Aws::String canonicalRequestHash = HashCanonicalRequest(canonicalRequest);
+    if (canonicalRequestHash.empty())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string");
-        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequest.ToString() << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    auto canonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
-
     auto stringToSign = GenerateStringToSign(dateQueryValue, simpleDate, canonicalRequestHash, signingRegion, signingServiceName);
     auto finalSigningHash = GenerateSignature(credentials, stringToSign, simpleDate, signingRegion, signingServiceName);
     if (finalSigningHash.empty())
@@ -423,8 +551,67 @@ bool AWSAuthV4Signer::ServiceRequireUnsignedPayload(const Aws::String& serviceNa
 Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials, const Aws::String& stringToSign,
         const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const
 {
-    auto key = ComputeHash(credentials.GetAWSSecretKey(), simpleDate, region, serviceName);
-    return GenerateSignature(stringToSign, key);
+    Utils::Threading::ReaderLockGuard guard(m_partialSignatureLock);
+    const auto& secretKey = credentials.GetAWSSecretKey();
+    const ByteBuffer* key = FindDerivedKey(secretKey, simpleDate, region, serviceName);
+    if (!key)
+    {
+        guard.UpgradeToWriterLock();
+        // double-checked lock to prevent deriving the same key twice
+        key = FindDerivedKey(secretKey, simpleDate, region, serviceName);
+        if (!key)
+        {
+            key = CacheDerivedKey(secretKey, simpleDate, region, serviceName);
+        }
+    }
+
+    if (!key)
+    {
+        return {};
+    }
+    return GenerateSignature(stringToSign, *key);
+}
+
+const ByteBuffer* AWSAuthV4Signer::FindDerivedKey(const Aws::String& secretKey,
+        const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const
+{
+    if (simpleDate != m_currentDateStr || secretKey != m_currentSecretKey)
+    {
+        return nullptr;
+    }
+
+    for (const auto& derivedKey : m_derivedKeys)
+    {
+        if (derivedKey.region == region && derivedKey.serviceName == serviceName)
+        {
+            return &derivedKey.key;
+        }
+    }
+    return nullptr;
+}
+
+const ByteBuffer* AWSAuthV4Signer::CacheDerivedKey(const Aws::String& secretKey,
+        const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const
+{
+    auto key = ComputeHash(secretKey, simpleDate, region, serviceName);
+    if (key.GetLength() == 0)
+    {
+        return nullptr;
+    }
+
+    if (simpleDate != m_currentDateStr || secretKey != m_currentSecretKey || m_derivedKeys.size() >= MAX_DERIVED_KEYS_CACHE_SIZE)
+    {
+        m_derivedKeys.clear();
+        m_currentDateStr = simpleDate;
+        m_currentSecretKey = secretKey;
+    }
+
+    DerivedKey derivedKey;
+    derivedKey.region = region;
+    derivedKey.serviceName = serviceName;
+    derivedKey.key = std::move(key);
+    m_derivedKeys.push_back(std::move(derivedKey));
+    return &m_derivedKeys.back().key;
 }
 
 Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign, const ByteBuffer& key) const
@@ -450,6 +637,25 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign,
     return finalSigningHash;
 }
 
+bool AWSAuthV4Signer::ShouldSignPayload(const Aws::Http::HttpRequest& request, bool signBody) const
+{
+    switch(m_payloadSigningPolicy)
+    {
+        case PayloadSigningPolicy::Always:
+            signBody = true;
+            break;
+        case PayloadSigningPolicy::Never:
+            signBody = false;
+            break;
+        case PayloadSigningPolicy::RequestDependent:
+            // respect the request setting
+        default:
+            break;
+    }
+
+    return signBody || request.GetUri().GetScheme() != Http::Scheme::HTTPS;
+}
+
 Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request) const
 {
     if (!request.GetContentBody())
@@ -458,6 +664,12 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
         return EMPTY_STRING_SHA256;
     }
 
+    if (!request.GetPayloadHash().empty())
+    {
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "Using sha256 " << request.GetPayloadHash() << " computed for payload by a previous signing.");
+        return request.GetPayloadHash();
+    }
+
     //compute hash on payload if it exists.
     auto hashResult =  m_hash->Calculate(*request.GetContentBody());
 
@@ -477,6 +689,7 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
 
     Aws::String payloadHash(HashingUtils::HexEncode(sha256Digest));
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Calculated sha256 " << payloadHash << " for payload.");
+    request.SetPayloadHash(payloadHash);
     return payloadHash;
 }
 
@@ -484,12 +697,12 @@ Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue,
         const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << region << "/"
-        << serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
+    Aws::String stringToSign;
+    stringToSign.reserve(STRING_TO_SIGN_BUFFER_SIZE);
+    stringToSign.append(AWS_HMAC_SHA256).append(NEWLINE).append(dateValue).append(NEWLINE).append(simpleDate).append("/").append(region)
+        .append("/").append(serviceName).append("/").append(AWS4_REQUEST).append(NEWLINE).append(canonicalRequestHash);
 
-    return ss.str();
+    return stringToSign;
 }
 
 Aws::Utils::ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey,
@@ -566,54 +779,34 @@ bool AWSAuthEventStreamV4Signer::SignRequest(Aws::Http::HttpRequest& request, co
     Aws::String dateHeaderValue = now.ToGmtString(DateFormat::ISO_8601_BASIC);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();
-    }
-
-    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Signed Headers value:" << signedHeadersValue);
+    CanonicalBuffer<CANONICAL_HEADERS_BUFFER_SIZE> canonicalHeaders;
+    CanonicalBuffer<SIGNED_HEADERS_BUFFER_SIZE> signedHeaders;
+    CanonicalizeHeaders(request, m_unsignedHeaders, canonicalHeaders, signedHeaders);
+    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Header String: " << canonicalHeaders.ToString());
+    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Signed Headers value:" << signedHeaders.ToString());
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, true/* m_urlEscapePath */);
+    CanonicalBuffer<CANONICAL_REQUEST_BUFFER_SIZE> canonicalRequest;
+    AppendCanonicalRequestLines(canonicalRequest, request, true/* m_urlEscapePath */);
 
     //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(EVENT_STREAM_CONTENT_SHA256);
+    canonicalRequest.Append(canonicalHeaders);
+    canonicalRequest.Append(NEWLINE);
+    canonicalRequest.Append(signedHeaders);
+    canonicalRequest.Append(NEWLINE);
+    canonicalRequest.Append(EVENT_STREAM_CONTENT_SHA256);
 
-    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Request String: " << canonicalRequestString);
+    AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Canonical Request String: " << canonicalRequest.ToString());
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash.Calculate(canonicalRequestString);
-    if (!hashResult.IsSuccess())
+    Aws::String canonicalRequestHash = HashCanonicalRequest(canonicalRequest);
+    if (canonicalRequestHash.empty())
     {
         AWS_LOGSTREAM_ERROR(v4StreamingLogTag, "Failed to hash (sha256) request string");
-        AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "The request string is: \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "The request string is: \"" << canonicalRequest.ToString() << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String canonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
     Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
 
     Aws::String signingRegion = region ? region : m_region;
@@ -621,12 +814,8 @@ bool AWSAuthEventStreamV4Signer::SignRequest(Aws::Http::HttpRequest& request, co
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, canonicalRequestHash, signingRegion, signingServiceName);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate, signingRegion, signingServiceName);
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << signingRegion << "/" << signingServiceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << HashingUtils::HexEncode(finalSignature);
-
-    auto awsAuthString = ss.str();
+    auto awsAuthString = BuildAuthorizationString(credentials.GetAWSAccessKeyId(), simpleDate, signingRegion, signingServiceName,
+        signedHeaders.GetData(), signedHeaders.GetLength(), HashingUtils::HexEncode(finalSignature));
     AWS_LOGSTREAM_DEBUG(v4StreamingLogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
@@ -756,12 +945,12 @@ Aws::String AWSAuthEventStreamV4Signer::GenerateStringToSign(const Aws::String&
         const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << region << "/"
-        << serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
+    Aws::String stringToSign;
+    stringToSign.reserve(STRING_TO_SIGN_BUFFER_SIZE);
+    stringToSign.append(AWS_HMAC_SHA256).append(NEWLINE).append(dateValue).append(NEWLINE).append(simpleDate).append("/").append(region)
+        .append("/").append(serviceName).append("/").append(AWS4_REQUEST).append(NEWLINE).append(canonicalRequestHash);
 
-    return ss.str();
+    return stringToSign;
 }
 
 Aws::Utils::ByteBuffer AWSAuthEventStreamV4Signer::ComputeHash(const Aws::String& secretKey,
@@ -48,8 +48,6 @@ static const char DEFAULT_CREDENTIALS_FILE[] = "credentials";
 extern const char DEFAULT_CONFIG_FILE[] = "config";
 
 
-static const int EXPIRATION_GRACE_PERIOD = 5 * 1000;
-
 void AWSCredentialsProvider::Reload()
 {
     m_lastLoadedMs = DateTime::Now().Millis();
@@ -221,7 +219,8 @@ static const char* INSTANCE_LOG_TAG = "InstanceProfileCredentialsProvider";
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
     m_ec2MetadataConfigLoader(Aws::MakeShared<Aws::Config::EC2InstanceProfileConfigLoader>(INSTANCE_LOG_TAG)),
-    m_loadFrequencyMs(refreshRateMs)
+    m_loadFrequencyMs(refreshRateMs),
+    m_credentialsCache(INSTANCE_LOG_TAG, [this](AWSCredentials& credentials) { return LoadCredentials(credentials); }, refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with default EC2MetadataClient and refresh rate " << refreshRateMs);
 }
@@ -229,7 +228,8 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refr
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std::shared_ptr<Aws::Config::EC2InstanceProfileConfigLoader>& loader, long refreshRateMs) :
     m_ec2MetadataConfigLoader(loader),
-    m_loadFrequencyMs(refreshRateMs)
+    m_loadFrequencyMs(refreshRateMs),
+    m_credentialsCache(INSTANCE_LOG_TAG, [this](AWSCredentials& credentials) { return LoadCredentials(credentials); }, refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with injected EC2MetadataClient and refresh rate " << refreshRateMs);
 }
@@ -237,54 +237,46 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std
 
 AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    ReaderLockGuard guard(m_reloadLock);
-    auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
-
-    if(profileIter != m_ec2MetadataConfigLoader->GetProfiles().end())
-    {
-        return profileIter->second.GetCredentials();
-    }
-
-    return AWSCredentials();
+    return m_credentialsCache.GetCredentials();
 }
 
 void InstanceProfileCredentialsProvider::Reload()
 {
-    AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Credentials have expired attempting to repull from EC2 Metadata Service.");
-    m_ec2MetadataConfigLoader->Load();
-    AWSCredentialsProvider::Reload();
+    m_credentialsCache.Refresh();
 }
 
-void InstanceProfileCredentialsProvider::RefreshIfExpired()
+bool InstanceProfileCredentialsProvider::LoadCredentials(AWSCredentials& credentials)
 {
-    AWS_LOGSTREAM_DEBUG(INSTANCE_LOG_TAG, "Checking if latest credential pull has expired.");
-    ReaderLockGuard guard(m_reloadLock);
-    if (!IsTimeToRefresh(m_loadFrequencyMs))
+    AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Credentials are due for refresh, attempting to repull from EC2 Metadata Service.");
+    if (!m_ec2MetadataConfigLoader->Load())
     {
-        return;
+        return false;
     }
+    AWSCredentialsProvider::Reload();
 
-    guard.UpgradeToWriterLock();
-    if (!IsTimeToRefresh(m_loadFrequencyMs)) // double-checked lock to avoid refreshing twice
+    auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
+    if (profileIter == m_ec2MetadataConfigLoader->GetProfiles().end() || profileIter->second.GetCredentials().IsEmpty())
     {
-        return;
+        return false;
     }
-    Reload();
+    credentials = profileIter->second.GetCredentials();
+    return true;
 }
 
 static const char TASK_ROLE_LOG_TAG[] = "TaskRoleCredentialsProvider";
 
 TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* URI, long refreshRateMs) :
     m_ecsCredentialsClient(Aws::MakeShared<Aws::Internal::ECSCredentialsClient>(TASK_ROLE_LOG_TAG, URI)),
-    m_loadFrequencyMs(refreshRateMs)
+    m_loadFrequencyMs(refreshRateMs),
+    m_credentialsCache(TASK_ROLE_LOG_TAG, [this](AWSCredentials& credentials) { return LoadCredentials(credentials); }, refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
 }
 
 TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, const char* token, long refreshRateMs) :
     m_ecsCredentialsClient(Aws::MakeShared<Aws::Internal::ECSCredentialsClient>(TASK_ROLE_LOG_TAG, ""/*resourcePath*/, endpoint, token)),
-    m_loadFrequencyMs(refreshRateMs)
+    m_loadFrequencyMs(refreshRateMs),
+    m_credentialsCache(TASK_ROLE_LOG_TAG, [this](AWSCredentials& credentials) { return LoadCredentials(credentials); }, refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
 }
@@ -292,35 +284,34 @@ TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, c
 TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(
         const std::shared_ptr<Aws::Internal::ECSCredentialsClient>& client, long refreshRateMs) :
     m_ecsCredentialsClient(client),
-    m_loadFrequencyMs(refreshRateMs)
+    m_loadFrequencyMs(refreshRateMs),
+    m_credentialsCache(TASK_ROLE_LOG_TAG, [this](AWSCredentials& credentials) { return LoadCredentials(credentials); }, refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
 }
 
 AWSCredentials TaskRoleCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    ReaderLockGuard guard(m_reloadLock);
-    return m_credentials;
+    return m_credentialsCache.GetCredentials();
 }
 
-bool TaskRoleCredentialsProvider::ExpiresSoon() const
+void TaskRoleCredentialsProvider::Reload()
 {
-    return ((m_credentials.GetExpiration() - Aws::Utils::DateTime::Now()).count() < EXPIRATION_GRACE_PERIOD);
+    m_credentialsCache.Refresh();
 }
 
-void TaskRoleCredentialsProvider::Reload()
+bool TaskRoleCredentialsProvider::LoadCredentials(AWSCredentials& credentials)
 {
-    AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Credentials have expired or will expire, attempting to repull from ECS IAM Service.");
+    AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Credentials are due for refresh or will expire, attempting to repull from ECS IAM Service.");
 
     auto credentialsStr = m_ecsCredentialsClient->GetECSCredentials();
-    if (credentialsStr.empty()) return;
+    if (credentialsStr.empty()) return false;
 
     Json::JsonValue credentialsDoc(credentialsStr);
     if (!credentialsDoc.WasParseSuccessful())
     {
         AWS_LOGSTREAM_ERROR(TASK_ROLE_LOG_TAG, "Failed to parse output from ECSCredentialService.");
-        return;
+        return false;
     }
 
     Aws::String accessKey, secretKey, token;
@@ -330,30 +321,12 @@ void TaskRoleCredentialsProvider::Reload()
     token = credentialsView.GetString("Token");
     AWS_LOGSTREAM_DEBUG(TASK_ROLE_LOG_TAG, "Successfully pulled credentials from metadata service with access key " << accessKey);
 
-    m_credentials.SetAWSAccessKeyId(accessKey);
-    m_credentials.SetAWSSecretKey(secretKey);
-    m_credentials.SetSessionToken(token);
-    m_credentials.SetExpiration(Aws::Utils::DateTime(credentialsView.GetString("Expiration"), DateFormat::ISO_8601));
+    credentials.SetAWSAccessKeyId(accessKey);
+    credentials.SetAWSSecretKey(secretKey);
+    credentials.SetSessionToken(token);
+    credentials.SetExpiration(Aws::Utils::DateTime(credentialsView.GetString("Expiration"), DateFormat::ISO_8601));
     AWSCredentialsProvider::Reload();
-}
-
-void TaskRoleCredentialsProvider::RefreshIfExpired()
-{
-    AWS_LOGSTREAM_DEBUG(TASK_ROLE_LOG_TAG, "Checking if latest credential pull has expired.");
-    ReaderLockGuard guard(m_reloadLock);
-    if (!m_credentials.IsEmpty() && !IsTimeToRefresh(m_loadFrequencyMs) && !ExpiresSoon())
-    {
-        return;
-    }
-
-    guard.UpgradeToWriterLock();
-
-    if (!m_credentials.IsEmpty() && !IsTimeToRefresh(m_loadFrequencyMs) && !ExpiresSoon())
-    {
-        return;
-    }
-
-    Reload();
+    return !credentials.IsEmpty();
 }
 
 static const char PROCESS_LOG_TAG[] = "ProcessCredentialsProvider";
@@ -0,0 +1,246 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/auth/RefreshingCredentialsCache.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+// Credentials expiring sooner than this are not handed out, they could expire before the request using them is received.
+static const long long EXPIRATION_GRACE_PERIOD_MS = 5 * 1000;
+// Floors of the delay between background loads, so that a tiny refresh rate or credentials loaded already inside
+// the prefetch window don't keep the refresh thread calling the credentials endpoint in a loop.
+static const long long MIN_REFRESH_INTERVAL_MS = 10;
+static const long long MIN_PREFETCH_INTERVAL_MS = 1000;
+// Backoff of the background loads retried after a failure.
+static const long long MIN_RETRY_DELAY_MS = 1000;
+static const long long MAX_RETRY_DELAY_MS = 60 * 1000;
+
+// Both trivially destructible, so that caches destroyed after the static objects can still unlink themselves.
+static std::mutex s_cachesLock;
+static RefreshingCredentialsCache* s_caches = nullptr;
+// Cleared between Aws::ShutdownAPI and the next Aws::InitAPI, no refresh thread is started meanwhile.
+static std::atomic<bool> s_backgroundRefreshEnabled(true);
+
+RefreshingCredentialsCache::RefreshingCredentialsCache(const char* logTag, const CredentialsLoader& loader, long refreshRateMs,
+    long prefetchWindowMs, long idleTimeoutMs) :
+    m_logTag(logTag),
+    m_loader(loader),
+    m_refreshRateMs(refreshRateMs),
+    m_prefetchWindowMs(prefetchWindowMs),
+    m_idleTimeoutMs(idleTimeoutMs),
+    m_generation(0),
+    m_lastReadMs(DateTime::CurrentTimeMillis()),
+    m_consecutiveFailures(0),
+    m_stopRefreshing(false),
+    m_refreshThreadStarted(false),
+    m_previousCache(nullptr),
+    m_nextCache(nullptr)
+{
+    Register();
+}
+
+RefreshingCredentialsCache::~RefreshingCredentialsCache()
+{
+    // Unlinked first, so that CleanupRefreshingCredentialsCaches doesn't stop the thread at the same time.
+    Unregister();
+    StopRefreshThread();
+}
+
+void RefreshingCredentialsCache::Register()
+{
+    std::lock_guard<std::mutex> locker(s_cachesLock);
+    m_nextCache = s_caches;
+    if (s_caches)
+    {
+        s_caches->m_previousCache = this;
+    }
+    s_caches = this;
+}
+
+void RefreshingCredentialsCache::Unregister()
+{
+    std::lock_guard<std::mutex> locker(s_cachesLock);
+    if (m_previousCache)
+    {
+        m_previousCache->m_nextCache = m_nextCache;
+    }
+    else
+    {
+        s_caches = m_nextCache;
+    }
+    if (m_nextCache)
+    {
+        m_nextCache->m_previousCache = m_previousCache;
+    }
+}
+
+AWSCredentials RefreshingCredentialsCache::GetCredentials()
+{
+    auto snapshot = GetSnapshot();
+    return snapshot ? *snapshot : AWSCredentials();
+}
+
+std::shared_ptr<const AWSCredentials> RefreshingCredentialsCache::GetSnapshot()
+{
+    m_lastReadMs = DateTime::CurrentTimeMillis();
+    uint64_t generation = m_generation.load();
+    auto snapshot = std::atomic_load(&m_snapshot);
+    if (snapshot && IsUsable(*snapshot))
+    {
+        // The refresh thread may have stopped while the credentials weren't read.
+        StartRefreshThread();
+        return snapshot;
+    }
+
+    // There are no credentials yet, or the background refresh couldn't renew them before they expired.
+    AWS_LOGSTREAM_DEBUG(m_logTag, "No valid cached credentials, loading them on the calling thread.");
+    Load(generation);
+    StartRefreshThread();
+    return std::atomic_load(&m_snapshot);
+}
+
+bool RefreshingCredentialsCache::Refresh()
+{
+    return Load(m_generation.load());
+}
+
+bool RefreshingCredentialsCache::IsUsable(const AWSCredentials& credentials) const
+{
+    return !credentials.IsEmpty() &&
+        credentials.GetExpiration().Millis() - DateTime::Now().Millis() > EXPIRATION_GRACE_PERIOD_MS;
+}
+
+bool RefreshingCredentialsCache::Load(uint64_t observedGeneration)
+{
+    std::lock_guard<std::mutex> locker(m_loadMutex);
+    if (m_generation.load() != observedGeneration)
+    {
+        // Another thread loaded the credentials while this one waited for it, use what it loaded.
+        return m_consecutiveFailures == 0;
+    }
+
+    AWSCredentials credentials;
+    bool loaded = m_loader(credentials);
+    if (loaded)
+    {
+        std::atomic_store(&m_snapshot, std::shared_ptr<const AWSCredentials>(Aws::MakeShared<AWSCredentials>(m_logTag, std::move(credentials))));
+        m_consecutiveFailures = 0;
+    }
+    else
+    {
+        ++m_consecutiveFailures;
+        AWS_LOGSTREAM_WARN(m_logTag, "Failed to load credentials " << m_consecutiveFailures << " times in a row, "
+            << (std::atomic_load(&m_snapshot) ? "keeping the current ones." : "no credentials are available."));
+    }
+    ++m_generation;
+    return loaded;
+}
+
+long long RefreshingCredentialsCache::GetNextRefreshDelayMs()
+{
+    std::lock_guard<std::mutex> locker(m_loadMutex);
+    if (m_consecutiveFailures > 0)
+    {
+        return (std::min)(MAX_RETRY_DELAY_MS, MIN_RETRY_DELAY_MS << (std::min)(m_consecutiveFailures - 1, 6));
+    }
+
+    long long delayMs = m_refreshRateMs;
+    auto snapshot = std::atomic_load(&m_snapshot);
+    if (snapshot)
+    {
+        long long untilPrefetchMs = snapshot->GetExpiration().Millis() - m_prefetchWindowMs - DateTime::Now().Millis();
+        if (untilPrefetchMs < delayMs)
+        {
+            delayMs = (std::max)(untilPrefetchMs, (std::min)(delayMs, MIN_PREFETCH_INTERVAL_MS));
+        }
+    }
+    return (std::max)(delayMs, MIN_REFRESH_INTERVAL_MS);
+}
+
+void RefreshingCredentialsCache::StartRefreshThread()
+{
+    if (m_refreshThreadStarted.load() || !s_backgroundRefreshEnabled.load())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_refreshMutex);
+    // Checked under the lock, so that a thread started while the refresh is being disabled is stopped by StopRefreshThread.
+    if (!m_refreshThreadStarted.load() && !m_stopRefreshing && s_backgroundRefreshEnabled.load())
+    {
+        if (m_refreshThread.joinable())
+        {
+            // The previous thread stopped after the credentials weren't read, it released the lock and is done.
+            m_refreshThread.join();
+        }
+        m_refreshThread = std::thread(&RefreshingCredentialsCache::RefreshThread, this);
+        m_refreshThreadStarted = true;
+    }
+}
+
+void RefreshingCredentialsCache::StopRefreshThread()
+{
+    std::thread refreshThread;
+    {
+        std::lock_guard<std::mutex> locker(m_refreshMutex);
+        m_stopRefreshing = true;
+        refreshThread = std::move(m_refreshThread);
+    }
+    m_refreshSignal.notify_one();
+    if (refreshThread.joinable())
+    {
+        refreshThread.join();
+    }
+
+    std::lock_guard<std::mutex> locker(m_refreshMutex);
+    m_stopRefreshing = false;
+    m_refreshThreadStarted = false;
+}
+
+void RefreshingCredentialsCache::RefreshThread()
+{
+    std::unique_lock<std::mutex> locker(m_refreshMutex);
+    while (!m_stopRefreshing)
+    {
+        long long delayMs = GetNextRefreshDelayMs();
+        if (m_refreshSignal.wait_for(locker, std::chrono::milliseconds(delayMs), [this] { return m_stopRefreshing; }))
+        {
+            break;
+        }
+
+        if (DateTime::CurrentTimeMillis() - m_lastReadMs.load() > m_idleTimeoutMs)
+        {
+            AWS_LOGSTREAM_DEBUG(m_logTag, "Credentials weren't read for " << m_idleTimeoutMs << " ms, stopping the background refresh.");
+            m_refreshThreadStarted = false;
+            break;
+        }
+
+        locker.unlock();
+        AWS_LOGSTREAM_DEBUG(m_logTag, "Refreshing credentials in the background.");
+        Load(m_generation.load());
+        locker.lock();
+    }
+}
+
+void Aws::Auth::InitRefreshingCredentialsCaches()
+{
+    s_backgroundRefreshEnabled = true;
+}
+
+void Aws::Auth::CleanupRefreshingCredentialsCaches()
+{
+    s_backgroundRefreshEnabled = false;
+    std::lock_guard<std::mutex> locker(s_cachesLock);
+    for (RefreshingCredentialsCache* cache = s_caches; cache; cache = cache->m_nextCache)
+    {
+        cache->StopRefreshThread();
+    }
+}
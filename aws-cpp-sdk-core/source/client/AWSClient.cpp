@@ -11,6 +11,7 @@
 #include <aws/core/client/AWSErrorMarshaller.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RequestCompression.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
@@ -19,9 +20,11 @@
 #include <aws/core/http/URI.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Globals.h>
@@ -31,6 +34,7 @@
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/utils/event/EventStream.h>
 #include <aws/core/utils/UUID.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/core/monitoring/MonitoringManager.h>
 #include <aws/core/Region.h>
 #include <aws/core/utils/DNS.h>
@@ -107,7 +111,8 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_customizedUserAgent(!m_userAgent.empty()),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
     m_requestTimeoutMs(configuration.requestTimeoutMs),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_requestCompressionConfig(configuration.requestCompressionConfig)
 {
     SetServiceClientName("AWSBaseClient");
 }
@@ -126,7 +131,8 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_customizedUserAgent(!m_userAgent.empty()),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
     m_requestTimeoutMs(configuration.requestTimeoutMs),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_requestCompressionConfig(configuration.requestCompressionConfig)
 {
     SetServiceClientName("AWSBaseClient");
 }
@@ -134,6 +140,14 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
 void AWSClient::SetServiceClientName(const Aws::String& name)
 {
     m_serviceName = name;
+    if (m_retryStrategy)
+    {
+        auto clientRetryStrategy = m_retryStrategy->GetStrategyForClient(m_serviceName, m_region);
+        if (clientRetryStrategy)
+        {
+            m_retryStrategy = clientRetryStrategy;
+        }
+    }
     if (!m_customizedUserAgent)
     {
         Aws::StringStream ss;
@@ -213,6 +227,85 @@ bool AWSClient::AdjustClockSkew(HttpResponseOutcome& outcome, const char* signer
     return false;
 }
 
+// Drops what the previous attempt left on a request that is about to be sent again: its signature, the metrics of the transfer
+// and the position in its body, and points it to authority. The rest of the marshalled request, including the content length,
+// md5 and payload hash, is kept. The body is rewound here rather than through the service request, whose GetBody may build
+// a new stream on every call, serializable requests do, and compressed bodies wrap the request's stream anyway.
+static void ResetHttpRequestForRetry(HttpRequest& httpRequest, const Aws::String& authority)
+{
+    const auto& body = httpRequest.GetContentBody();
+    if (body)
+    {
+        body->clear();
+        body->seekg(0);
+    }
+    httpRequest.DeleteHeader(Http::AUTHORIZATION_HEADER);
+    httpRequest.DeleteHeader(Http::AWS_SECURITY_TOKEN);
+    httpRequest.SetRequestMetrics(Aws::Monitoring::HttpClientMetricsCollection());
+
+    URI& uri = httpRequest.GetUri();
+    if (uri.GetAuthority() != authority)
+    {
+        // The host header only carries the port when it isn't the default one for the scheme.
+        bool hostHasPort = httpRequest.HasHeader(Http::HOST_HEADER) && httpRequest.GetHeaderValue(Http::HOST_HEADER) != uri.GetAuthority();
+        uri.SetAuthority(authority);
+        if (hostHasPort)
+        {
+            Aws::StringStream host;
+            host << authority << ":" << uri.GetPort();
+            httpRequest.SetHeaderValue(Http::HOST_HEADER, host.str());
+        }
+        else
+        {
+            httpRequest.SetHeaderValue(Http::HOST_HEADER, authority);
+        }
+    }
+}
+
+struct AWSClient::RequestAttempts
+{
+    RequestAttempts(const Aws::Http::URI& uri, const Aws::AmazonWebServiceRequest& request, HttpMethod method, const char* signerName,
+        const char* signerRegionOverride, const char* signerServiceNameOverride) :
+        uri(uri), request(request), method(method), signerName(signerName),
+        signerRegion(signerRegionOverride ? signerRegionOverride : ""), hasSignerRegion(signerRegionOverride != nullptr),
+        signerServiceName(signerServiceNameOverride ? signerServiceNameOverride : ""), hasSignerServiceName(signerServiceNameOverride != nullptr),
+        clockSkew(0), retries(0), reuseHttpRequest(false)
+    {
+        requestInfo.attempt = 1;
+        requestInfo.maxAttempts = 0;
+    }
+
+    const char* GetSignerRegion() const { return hasSignerRegion ? signerRegion.c_str() : nullptr; }
+    const char* GetSignerServiceName() const { return hasSignerServiceName ? signerServiceName.c_str() : nullptr; }
+
+    // The overrides are copied, asynchronous attempts outlive the strings they were given.
+    Aws::Http::URI uri;
+    const Aws::AmazonWebServiceRequest& request;
+    HttpMethod method;
+    Aws::String signerName;
+    Aws::String signerRegion;
+    bool hasSignerRegion;
+    Aws::String signerServiceName;
+    bool hasSignerServiceName;
+
+    std::shared_ptr<HttpRequest> httpRequest;
+    HttpResponseOutcome outcome;
+    AWSError<CoreErrors> lastError;
+    Aws::Monitoring::CoreMetricsCollection coreMetrics;
+    Aws::Vector<void*> contexts;
+    Aws::String invocationId;
+    RequestInfo requestInfo;
+    DateTime serverTime;
+    std::chrono::milliseconds clockSkew;
+    long retries;
+    bool reuseHttpRequest;
+
+    // Only set by AttemptExhaustivelyAsync, sharedRequest keeps request alive. The executor is only kept while the attempts run on it.
+    std::shared_ptr<const Aws::AmazonWebServiceRequest> sharedRequest;
+    std::shared_ptr<Aws::Utils::Threading::Executor> executor;
+    std::function<void(HttpResponseOutcome&&)> handler;
+};
+
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
     const Aws::AmazonWebServiceRequest& request,
     HttpMethod method,
@@ -220,122 +313,274 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
     const char* signerRegionOverride,
     const char* signerServiceNameOverride) const
 {
-    if (!Aws::Utils::IsValidHost(uri.GetAuthority()))
+    RequestAttempts attempts(uri, request, method, signerName, signerRegionOverride, signerServiceNameOverride);
+    if (!StartRequestAttempts(attempts))
     {
-        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::VALIDATION, "", "Invalid DNS Label found in URI host", false/*retryable*/));
+        return std::move(attempts.outcome);
     }
-    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
-    HttpResponseOutcome outcome;
-    AWSError<CoreErrors> lastError;
-    Aws::Monitoring::CoreMetricsCollection coreMetrics;
-    auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest);
-    const char* signerRegion = signerRegionOverride;
-    Aws::String regionFromResponse;
 
-    Aws::String invocationId = UUID::RandomUUID();
-    RequestInfo requestInfo;
-    requestInfo.attempt = 1;
-    requestInfo.maxAttempts = 0;
-    httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, invocationId);
-    httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, requestInfo);
-
-    for (long retries = 0;; retries++)
+    for (;;)
     {
         m_retryStrategy->GetSendToken();
-        httpRequest->SetEventStreamRequest(request.IsEventStreamRequest());
-
-        outcome = AttemptOneRequest(httpRequest, request, signerName, signerRegion, signerServiceNameOverride);
-        if (retries == 0)
+        if (PrepareRequestAttempt(attempts))
         {
-            m_retryStrategy->RequestBookkeeping(outcome);
+            attempts.outcome = BuildHttpResponseOutcome(m_httpClient->MakeRequest(attempts.httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
         }
-        else
+
+        long sleepMillis = 0;
+        if (!CompleteRequestAttempt(attempts, sleepMillis))
         {
-            m_retryStrategy->RequestBookkeeping(outcome, lastError);
+            break;
         }
-        coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
-        if (outcome.IsSuccess())
+        if (sleepMillis > 0)
         {
-            Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome, coreMetrics, contexts);
-            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
-            break;
+            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
         }
-        lastError = outcome.GetError();
-
-        DateTime serverTime = GetServerTimeFromError(outcome.GetError());
-        auto clockSkew = DateTime::Diff(serverTime, DateTime::Now());
+        PrepareRequestRetry(attempts);
+    }
+    Aws::Monitoring::OnFinish(this->GetServiceClientName(), request.GetServiceRequestName(), attempts.httpRequest, attempts.contexts);
+    return std::move(attempts.outcome);
+}
 
-        Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome, coreMetrics, contexts);
+void AWSClient::AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const std::function<void(HttpResponseOutcome&&)>& handler,
+    HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    auto attempts = Aws::MakeShared<RequestAttempts>(AWS_CLIENT_LOG_TAG, uri, *request, method, signerName, signerRegionOverride, signerServiceNameOverride);
+    attempts->sharedRequest = request;
+    attempts->handler = handler;
 
-        if (!m_httpClient->IsRequestProcessingEnabled())
+    if (!SupportsAsyncRequests())
+    {
+        executor->Submit([this, attempts]()
         {
-            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
-            break;
-        }
+            attempts->handler(AttemptExhaustively(attempts->uri, attempts->request, attempts->method, attempts->signerName.c_str(),
+                attempts->GetSignerRegion(), attempts->GetSignerServiceName()));
+        });
+        return;
+    }
 
-        // Adjust region
-        bool retryWithCorrectRegion = false;
-        HttpResponseCode httpResponseCode = outcome.GetError().GetResponseCode();
-        if (httpResponseCode == HttpResponseCode::MOVED_PERMANENTLY ||  // 301
-            httpResponseCode == HttpResponseCode::TEMPORARY_REDIRECT || // 307
-            httpResponseCode == HttpResponseCode::BAD_REQUEST ||        // 400
-            httpResponseCode == HttpResponseCode::FORBIDDEN)            // 403
-        {
-            regionFromResponse = GetErrorMarshaller()->ExtractRegion(outcome.GetError());
-            if (m_region == Aws::Region::AWS_GLOBAL && !regionFromResponse.empty() && regionFromResponse != signerRegion)
-            {
-                signerRegion = regionFromResponse.c_str();
-                retryWithCorrectRegion = true;
-            }
-        }
+    if (!StartRequestAttempts(*attempts))
+    {
+        executor->Submit([attempts]() { attempts->handler(std::move(attempts->outcome)); });
+        return;
+    }
+    attempts->executor = executor;
+    MakeRequestAttemptAsync(attempts);
+}
 
-        long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
-        //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
-        //sleep if clock skew and region was NOT the problem. AdjustClockSkew may update error inside outcome.
-        bool shouldSleep = !AdjustClockSkew(outcome, signerName) && !retryWithCorrectRegion;
+void AWSClient::MakeRequestAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const
+{
+    long sendDelayMillis = m_retryStrategy->GetSendTokenWithoutWaiting();
+    if (sendDelayMillis > 0)
+    {
+        // Client side rate limiting, the attempt is sent once the token is refilled rather than waiting for it on the executor.
+        RunRequestAttemptTaskAfter(attempts, sendDelayMillis, [this, attempts]() { SendRequestAttemptAsync(attempts); });
+        return;
+    }
+    SendRequestAttemptAsync(attempts);
+}
 
-        if (!retryWithCorrectRegion && !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
-        {
-            break;
-        }
+void AWSClient::SendRequestAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const
+{
+    if (!PrepareRequestAttempt(*attempts))
+    {
+        attempts->executor->Submit([this, attempts]() { CompleteRequestAttemptAsync(attempts); });
+        return;
+    }
 
-        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
-        if(request.GetBody())
+    // The http client calls back from its event loop, which must not block, everything else is done on the executor.
+    m_httpClient->MakeRequestAsync(attempts->httpRequest,
+        [this, attempts](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& httpResponse)
         {
-            request.GetBody()->clear();
-            request.GetBody()->seekg(0);
-        }
+            attempts->executor->Submit([this, attempts, httpResponse]()
+            {
+                attempts->outcome = BuildHttpResponseOutcome(httpResponse);
+                CompleteRequestAttemptAsync(attempts);
+            });
+        },
+        m_readRateLimiter.get(), m_writeRateLimiter.get());
+}
 
-        if (request.GetRequestRetryHandler())
+void AWSClient::CompleteRequestAttemptAsync(const std::shared_ptr<RequestAttempts>& attempts) const
+{
+    long sleepMillis = 0;
+    if (!CompleteRequestAttempt(*attempts, sleepMillis))
+    {
+        Aws::Monitoring::OnFinish(this->GetServiceClientName(), attempts->request.GetServiceRequestName(), attempts->httpRequest, attempts->contexts);
+        // Whoever gets the outcome may release the executor, this task must not hold the last reference to it.
+        attempts->executor = nullptr;
+        attempts->handler(std::move(attempts->outcome));
+        return;
+    }
+    if (sleepMillis > 0)
+    {
+        RunRequestAttemptTaskAfter(attempts, sleepMillis, [this, attempts]()
         {
-            request.GetRequestRetryHandler()(request);
-        }
+            PrepareRequestRetry(*attempts);
+            MakeRequestAttemptAsync(attempts);
+        });
+        return;
+    }
+    PrepareRequestRetry(*attempts);
+    MakeRequestAttemptAsync(attempts);
+}
 
-        if (shouldSleep)
+void AWSClient::RunRequestAttemptTaskAfter(const std::shared_ptr<RequestAttempts>& attempts, long delayMillis, const std::function<void()>& task) const
+{
+    // The http client calls back from its event loop once the delay has elapsed, the task is handed over to the executor from there.
+    m_httpClient->ScheduleAfter(std::chrono::milliseconds(delayMillis), [attempts, task]()
+    {
+        attempts->executor->Submit(task);
+    });
+}
+
+bool AWSClient::SupportsAsyncRequests() const
+{
+    return m_httpClient->SupportsAsyncRequests();
+}
+
+bool AWSClient::StartRequestAttempts(RequestAttempts& attempts) const
+{
+    if (!Aws::Utils::IsValidHost(attempts.uri.GetAuthority()))
+    {
+        attempts.outcome = HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::VALIDATION, "", "Invalid DNS Label found in URI host", false/*retryable*/));
+        return false;
+    }
+    attempts.httpRequest = CreateHttpRequest(attempts.uri, attempts.method, attempts.request.GetResponseStreamFactory());
+    attempts.contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), attempts.request.GetServiceRequestName(), attempts.httpRequest);
+
+    attempts.invocationId = UUID::RandomUUID();
+    attempts.httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, attempts.invocationId);
+    attempts.httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, attempts.requestInfo);
+    return true;
+}
+
+bool AWSClient::PrepareRequestAttempt(RequestAttempts& attempts) const
+{
+    attempts.httpRequest->SetEventStreamRequest(attempts.request.IsEventStreamRequest());
+    if (!attempts.reuseHttpRequest)
+    {
+        PrepareHttpRequest(attempts.httpRequest, attempts.request, attempts.signerName.c_str());
+    }
+    if (!SignHttpRequest(attempts.httpRequest, attempts.request, attempts.signerName.c_str(), attempts.GetSignerRegion(), attempts.GetSignerServiceName()))
+    {
+        attempts.outcome = HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
+        return false;
+    }
+    return true;
+}
+
+bool AWSClient::CompleteRequestAttempt(RequestAttempts& attempts, long& sleepMillis) const
+{
+    const Aws::AmazonWebServiceRequest& request = attempts.request;
+    HttpResponseOutcome& outcome = attempts.outcome;
+    if (attempts.retries == 0)
+    {
+        m_retryStrategy->RequestBookkeeping(outcome);
+    }
+    else
+    {
+        m_retryStrategy->RequestBookkeeping(outcome, attempts.lastError);
+    }
+    attempts.coreMetrics.httpClientMetrics = attempts.httpRequest->GetRequestMetrics();
+    if (outcome.IsSuccess())
+    {
+        Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), request.GetServiceRequestName(), attempts.httpRequest, outcome, attempts.coreMetrics, attempts.contexts);
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
+        return false;
+    }
+    attempts.lastError = outcome.GetError();
+
+    attempts.serverTime = GetServerTimeFromError(outcome.GetError());
+    attempts.clockSkew = DateTime::Diff(attempts.serverTime, DateTime::Now());
+
+    Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), request.GetServiceRequestName(), attempts.httpRequest, outcome, attempts.coreMetrics, attempts.contexts);
+
+    if (!m_httpClient->IsRequestProcessingEnabled())
+    {
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
+        return false;
+    }
+
+    // Adjust region
+    bool retryWithCorrectRegion = false;
+    HttpResponseCode httpResponseCode = outcome.GetError().GetResponseCode();
+    if (httpResponseCode == HttpResponseCode::MOVED_PERMANENTLY ||  // 301
+        httpResponseCode == HttpResponseCode::TEMPORARY_REDIRECT || // 307
+        httpResponseCode == HttpResponseCode::BAD_REQUEST ||        // 400
+        httpResponseCode == HttpResponseCode::FORBIDDEN)            // 403
+    {
+        Aws::String regionFromResponse = GetErrorMarshaller()->ExtractRegion(outcome.GetError());
+        if (m_region == Aws::Region::AWS_GLOBAL && !regionFromResponse.empty() && (!attempts.hasSignerRegion || regionFromResponse != attempts.signerRegion))
         {
-            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            attempts.signerRegion = regionFromResponse;
+            attempts.hasSignerRegion = true;
+            retryWithCorrectRegion = true;
         }
+    }
 
-        Aws::Http::URI newUri = uri;
-        Aws::String newEndpoint = GetErrorMarshaller()->ExtractEndpoint(outcome.GetError());
+    long delayMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), attempts.retries);
+    //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
+    //sleep if clock skew and region was NOT the problem. AdjustClockSkew may update error inside outcome.
+    bool shouldSleep = !AdjustClockSkew(outcome, attempts.signerName.c_str()) && !retryWithCorrectRegion;
+
+    if (!retryWithCorrectRegion && !m_retryStrategy->ShouldRetry(outcome.GetError(), attempts.retries))
+    {
+        return false;
+    }
+
+    AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << delayMillis << " ms before attempting again.");
+    if(request.GetBody())
+    {
+        request.GetBody()->clear();
+        request.GetBody()->seekg(0);
+    }
+
+    if (request.GetRequestRetryHandler())
+    {
+        request.GetRequestRetryHandler()(request);
+    }
+
+    sleepMillis = shouldSleep ? delayMillis : 0;
+    return true;
+}
+
+void AWSClient::PrepareRequestRetry(RequestAttempts& attempts) const
+{
+    const Aws::AmazonWebServiceRequest& request = attempts.request;
+    Aws::String newEndpoint = GetErrorMarshaller()->ExtractEndpoint(attempts.outcome.GetError());
+    // The retry handler may change the request, in which case it has to be built again.
+    attempts.reuseHttpRequest = !request.GetRequestRetryHandler();
+    if (attempts.reuseHttpRequest)
+    {
+        ResetHttpRequestForRetry(*attempts.httpRequest, newEndpoint.empty() ? attempts.uri.GetAuthority() : newEndpoint);
+    }
+    else
+    {
+        Aws::Http::URI newUri = attempts.uri;
         if (!newEndpoint.empty())
         {
             newUri.SetAuthority(newEndpoint);
         }
-        httpRequest = CreateHttpRequest(newUri, method, request.GetResponseStreamFactory());
+        attempts.httpRequest = CreateHttpRequest(newUri, attempts.method, request.GetResponseStreamFactory());
+    }
 
-        httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, invocationId);
-        if (serverTime.WasParseSuccessful() && serverTime != DateTime())
-        {
-            requestInfo.ttl = DateTime::Now() + clockSkew + std::chrono::milliseconds(m_requestTimeoutMs);
-        }
-        requestInfo.attempt ++;
-        requestInfo.maxAttempts = m_retryStrategy->GetMaxAttempts();
-        httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, requestInfo);
-        Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, contexts);
+    attempts.httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, attempts.invocationId);
+    if (attempts.serverTime.WasParseSuccessful() && attempts.serverTime != DateTime())
+    {
+        attempts.requestInfo.ttl = DateTime::Now() + attempts.clockSkew + std::chrono::milliseconds(m_requestTimeoutMs);
     }
-    Aws::Monitoring::OnFinish(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, contexts);
-    return outcome;
+    attempts.requestInfo.attempt ++;
+    attempts.requestInfo.maxAttempts = m_retryStrategy->GetMaxAttempts();
+    attempts.httpRequest->SetHeaderValue(Http::SDK_REQUEST_HEADER, attempts.requestInfo);
+    attempts.retries++;
+    Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), request.GetServiceRequestName(), attempts.httpRequest, attempts.contexts);
 }
 
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
@@ -430,13 +675,8 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
         }
 
-        Aws::Http::URI newUri = uri;
         Aws::String newEndpoint = GetErrorMarshaller()->ExtractEndpoint(outcome.GetError());
-        if (!newEndpoint.empty())
-        {
-            newUri.SetAuthority(newEndpoint);
-        }
-        httpRequest = CreateHttpRequest(newUri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        ResetHttpRequestForRetry(*httpRequest, newEndpoint.empty() ? uri.GetAuthority() : newEndpoint);
 
         httpRequest->SetHeaderValue(Http::SDK_INVOCATION_ID_HEADER, invocationId);
         if (serverTime.WasParseSuccessful() && serverTime != DateTime())
@@ -464,12 +704,49 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest, const Aws::AmazonWebServiceRequest& request,
     const char* signerName, const char* signerRegionOverride, const char* signerServiceNameOverride) const
 {
+    PrepareHttpRequest(httpRequest, request, signerName);
+    return SignAndMakeRequest(httpRequest, request, signerName, signerRegionOverride, signerServiceNameOverride);
+}
+
+void AWSClient::PrepareHttpRequest(const std::shared_ptr<HttpRequest>& httpRequest, const Aws::AmazonWebServiceRequest& request, const char* signerName) const
+{
+    // When both the Content-MD5 header and the signature need a digest of a streamed body, compute them together
+    // so that BuildHttpRequest and the signer find them already set. Other bodies are small and serialized by GetBody.
+    // A body about to be compressed is digested after compression instead.
+    if (request.IsStreaming() && request.ShouldComputeContentMd5() && !request.IsEventStreamRequest() &&
+        (request.GetRequestCompressionAlgorithm() == CompressionAlgorithm::NONE || !m_requestCompressionConfig.enableRequestCompression) &&
+        !httpRequest->HasHeader(Http::CONTENT_MD5_HEADER) && httpRequest->GetPayloadHash().empty() &&
+        GetSignerByName(signerName)->ShouldSignPayload(*httpRequest, request.SignBody()))
+    {
+        auto body = request.GetBody();
+        if (body)
+        {
+            AddContentMd5AndPayloadHash(*httpRequest, *body);
+        }
+    }
+
     BuildHttpRequest(request, httpRequest);
+}
+
+HttpResponseOutcome AWSClient::SignAndMakeRequest(const std::shared_ptr<HttpRequest>& httpRequest, const Aws::AmazonWebServiceRequest& request,
+    const char* signerName, const char* signerRegionOverride, const char* signerServiceNameOverride) const
+{
+    if (!SignHttpRequest(httpRequest, request, signerName, signerRegionOverride, signerServiceNameOverride))
+    {
+        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
+    }
+
+    return BuildHttpResponseOutcome(m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+}
+
+bool AWSClient::SignHttpRequest(const std::shared_ptr<HttpRequest>& httpRequest, const Aws::AmazonWebServiceRequest& request,
+    const char* signerName, const char* signerRegionOverride, const char* signerServiceNameOverride) const
+{
     auto signer = GetSignerByName(signerName);
     if (!signer->SignRequest(*httpRequest, signerRegionOverride, signerServiceNameOverride, request.SignBody()))
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
-        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
+        return false;
     }
 
     if (request.GetRequestSignedHandler())
@@ -478,9 +755,11 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
-    std::shared_ptr<HttpResponse> httpResponse(
-        m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    return true;
+}
 
+HttpResponseOutcome AWSClient::BuildHttpResponseOutcome(const std::shared_ptr<HttpResponse>& httpResponse) const
+{
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
@@ -490,7 +769,7 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
 
-    return HttpResponseOutcome(std::move(httpResponse));
+    return HttpResponseOutcome(httpResponse);
 }
 
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
@@ -524,14 +803,8 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
     return HttpResponseOutcome(std::move(httpResponse));
 }
 
-StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method,
-    const char* signerName,
-    const char* signerRegionOverride,
-    const char* signerServiceNameOverride) const
+static StreamOutcome BuildStreamOutcome(HttpResponseOutcome&& httpResponseOutcome)
 {
-    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, request, method, signerName, signerRegionOverride, signerServiceNameOverride);
     if (httpResponseOutcome.IsSuccess())
     {
         return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
@@ -542,6 +815,30 @@ StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& u
     return StreamOutcome(std::move(httpResponseOutcome));
 }
 
+StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    return BuildStreamOutcome(AttemptExhaustively(uri, request, method, signerName, signerRegionOverride, signerServiceNameOverride));
+}
+
+void AWSClient::MakeRequestWithUnparsedResponseAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const std::function<void(StreamOutcome&&)>& handler,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    AttemptExhaustivelyAsync(uri, request, executor,
+        [handler](HttpResponseOutcome&& httpResponseOutcome) { handler(BuildStreamOutcome(std::move(httpResponseOutcome))); },
+        method, signerName, signerRegionOverride, signerServiceNameOverride);
+}
+
 StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& uri,
     Http::HttpMethod method,
     const char* signerName,
@@ -694,7 +991,9 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     }
     else
     {
-        AddContentBodyToRequest(httpRequest, request.GetBody(), request.ShouldComputeContentMd5(), request.IsStreaming() && request.IsChunked() && m_httpClient->SupportsChunkedTransferEncoding());
+        bool isChunked = request.IsStreaming() && request.IsChunked() && m_httpClient->SupportsChunkedTransferEncoding();
+        auto body = CompressContentBody(*httpRequest, request.GetBody(), request.GetRequestCompressionAlgorithm(), isChunked);
+        AddContentBodyToRequest(httpRequest, body, request.ShouldComputeContentMd5(), isChunked);
     }
 
     // Pass along handlers for processing data sent/received in bytes
@@ -705,6 +1004,79 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
 
+std::shared_ptr<Aws::IOStream> AWSClient::CompressContentBody(HttpRequest& httpRequest, const std::shared_ptr<Aws::IOStream>& body,
+    CompressionAlgorithm algorithm, bool isChunked) const
+{
+    if (!body || algorithm == CompressionAlgorithm::NONE || !m_requestCompressionConfig.enableRequestCompression)
+    {
+        return body;
+    }
+
+    if (!RequestCompression::IsAlgorithmAvailable(algorithm))
+    {
+        AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "The SDK was built without " << RequestCompression::GetContentEncoding(algorithm)
+            << " request compression, sending the body uncompressed");
+        return body;
+    }
+
+    // The size of a body that can't seek, e.g. read from a pipe, is unknown: it's compressed whatever its size.
+    long long bodySize = -1;
+    if (httpRequest.HasHeader(Http::CONTENT_LENGTH_HEADER))
+    {
+        bodySize = StringUtils::ConvertToInt64(httpRequest.GetContentLength().c_str());
+    }
+    else if (body->seekg(0, body->end))
+    {
+        bodySize = static_cast<long long>(body->tellg());
+        body->seekg(0, body->beg);
+    }
+    body->clear();
+
+    if (bodySize >= 0 && static_cast<unsigned long long>(bodySize) < m_requestCompressionConfig.requestMinCompressionSizeBytes)
+    {
+        return body;
+    }
+
+    // A chunked body is compressed as it is sent, others are compressed ahead so that their compressed size can be set as content-length.
+    auto compressedBody = isChunked ?
+        RequestCompression::CreateCompressingStream(algorithm, body, m_requestCompressionConfig.compressionLevel) :
+        RequestCompression::Compress(algorithm, body, m_requestCompressionConfig.compressionLevel);
+    if (!compressedBody)
+    {
+        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Failed to compress the request body, sending it uncompressed");
+        body->clear();
+        body->seekg(0, body->beg);
+        return body;
+    }
+
+    Aws::String contentEncoding = RequestCompression::GetContentEncoding(algorithm);
+    if (httpRequest.HasHeader(Http::CONTENT_ENCODING_HEADER) && !httpRequest.GetHeaderValue(Http::CONTENT_ENCODING_HEADER).empty())
+    {
+        // Encodings are listed in the order they were applied, the one set by the caller came first.
+        contentEncoding = httpRequest.GetHeaderValue(Http::CONTENT_ENCODING_HEADER) + "," + contentEncoding;
+    }
+    httpRequest.SetHeaderValue(Http::CONTENT_ENCODING_HEADER, contentEncoding);
+    httpRequest.DeleteHeader(Http::CONTENT_LENGTH_HEADER);
+    AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Compressed the request body of " << bodySize << " bytes with " << contentEncoding);
+    return compressedBody;
+}
+
+void AWSClient::AddContentMd5AndPayloadHash(HttpRequest& httpRequest, Aws::IOStream& body) const
+{
+    AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Computing content-md5 and the payload sha256 in a single pass over the body");
+    Aws::Vector<std::shared_ptr<Aws::Utils::Crypto::Hash>> hashes = {
+        Aws::Utils::Crypto::CreateMD5Implementation(), Aws::Utils::Crypto::CreateSha256Implementation() };
+    auto digests = HashingUtils::CalculateHashes(body, hashes);
+    if (digests.empty() || digests[0].GetLength() == 0 || digests[1].GetLength() == 0)
+    {
+        // Leave both to be computed separately.
+        return;
+    }
+
+    httpRequest.SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(digests[0]));
+    httpRequest.SetPayloadHash(HashingUtils::HexEncode(digests[1]));
+}
+
 void AWSClient::AddCommonHeaders(HttpRequest& httpRequest) const
 {
     httpRequest.SetUserAgent(m_userAgent);
@@ -872,14 +1244,8 @@ AWSJsonClient::AWSJsonClient(const Aws::Client::ClientConfiguration& configurati
 }
 
 
-JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method,
-    const char* signerName,
-    const char* signerRegionOverride,
-    const char* signerServiceNameOverride) const
+static JsonOutcome BuildJsonOutcome(HttpResponseOutcome&& httpOutcome)
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride, signerServiceNameOverride));
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(std::move(httpOutcome));
@@ -895,6 +1261,30 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
         return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
 }
 
+JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    return BuildJsonOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride, signerServiceNameOverride));
+}
+
+void AWSJsonClient::MakeRequestAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const std::function<void(JsonOutcome&&)>& handler,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, executor,
+        [handler](HttpResponseOutcome&& httpOutcome) { handler(BuildJsonOutcome(std::move(httpOutcome))); },
+        method, signerName, signerRegionOverride, signerServiceNameOverride);
+}
+
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     Http::HttpMethod method,
     const char* signerName,
@@ -925,6 +1315,63 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
 }
 
+static JsonReaderOutcome BuildJsonReaderOutcome(HttpResponseOutcome&& httpOutcome)
+{
+    if (!httpOutcome.IsSuccess())
+    {
+        return JsonReaderOutcome(std::move(httpOutcome));
+    }
+
+    if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+    {
+        JsonReader reader(httpOutcome.GetResult()->GetResponseBody());
+        if (!reader.Validate())
+        {
+            return JsonReaderOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", reader.GetErrorMessage(), false));
+        }
+
+        return JsonReaderOutcome(AmazonWebServiceResult<JsonReader>(std::move(reader),
+            httpOutcome.GetResult()->GetHeaders(),
+            httpOutcome.GetResult()->GetResponseCode()));
+    }
+
+    return JsonReaderOutcome(AmazonWebServiceResult<JsonReader>(JsonReader(), httpOutcome.GetResult()->GetHeaders()));
+}
+
+JsonReaderOutcome AWSJsonClient::MakeRequestWithJsonReader(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    return BuildJsonReaderOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride, signerServiceNameOverride));
+}
+
+void AWSJsonClient::MakeRequestWithJsonReaderAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const std::function<void(JsonReaderOutcome&&)>& handler,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, executor,
+        [handler](HttpResponseOutcome&& httpOutcome) { handler(BuildJsonReaderOutcome(std::move(httpOutcome))); },
+        method, signerName, signerRegionOverride, signerServiceNameOverride);
+}
+
+JsonReaderOutcome AWSJsonClient::MakeRequestWithJsonReader(const Aws::Http::URI& uri,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* requestName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    return BuildJsonReaderOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride, signerServiceNameOverride));
+}
+
 JsonOutcome AWSJsonClient::MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const
 {
     // request is assumed to be signed
@@ -1058,6 +1505,63 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
     return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
 }
 
+static XmlReaderOutcome BuildXmlReaderOutcome(HttpResponseOutcome&& httpOutcome)
+{
+    if (!httpOutcome.IsSuccess())
+    {
+        return XmlReaderOutcome(std::move(httpOutcome));
+    }
+
+    if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+    {
+        XmlReader reader(httpOutcome.GetResult()->GetResponseBody());
+        if (!reader.Validate())
+        {
+            AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Xml parsing for error failed with message " << reader.GetErrorMessage().c_str());
+            return XmlReaderOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", reader.GetErrorMessage(), false));
+        }
+
+        return XmlReaderOutcome(AmazonWebServiceResult<XmlReader>(std::move(reader),
+            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
+    }
+
+    return XmlReaderOutcome(AmazonWebServiceResult<XmlReader>(XmlReader(), httpOutcome.GetResult()->GetHeaders()));
+}
+
+XmlReaderOutcome AWSXMLClient::MakeRequestWithXmlReader(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    return BuildXmlReaderOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName, signerRegionOverride, signerServiceNameOverride));
+}
+
+void AWSXMLClient::MakeRequestWithXmlReaderAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    const std::function<void(XmlReaderOutcome&&)>& handler,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, executor,
+        [handler](HttpResponseOutcome&& httpOutcome) { handler(BuildXmlReaderOutcome(std::move(httpOutcome))); },
+        method, signerName, signerRegionOverride, signerServiceNameOverride);
+}
+
+XmlReaderOutcome AWSXMLClient::MakeRequestWithXmlReader(const Aws::Http::URI& uri,
+    Http::HttpMethod method,
+    const char* signerName,
+    const char* requestName,
+    const char* signerRegionOverride,
+    const char* signerServiceNameOverride) const
+{
+    return BuildXmlReaderOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName, signerRegionOverride, signerServiceNameOverride));
+}
+
 AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::HttpResponse>& httpResponse) const
 {
     AWSError<CoreErrors> error;
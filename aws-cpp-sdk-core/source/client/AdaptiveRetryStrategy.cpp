@@ -0,0 +1,400 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/AdaptiveRetryStrategy.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+using namespace Aws::Utils;
+
+namespace Aws
+{
+    namespace Client
+    {
+        static const char ADAPTIVE_RETRY_STRATEGY_TAG[] = "AdaptiveRetryStrategy";
+
+        static const double MIN_FILL_RATE = 0.5;
+        static const double MIN_CAPACITY = 1;
+        // Weight of the latest measurement in the smoothed send rate.
+        static const double SMOOTH = 0.8;
+        // How much the send rate is cut by a throttling response.
+        static const double BETA = 0.7;
+        static const double SCALE_CONSTANT = 0.4;
+
+        static const char* THROTTLING_EXCEPTION_NAMES[] =
+        {
+            "Throttling",
+            "ThrottlingException",
+            "ThrottledException",
+            "RequestThrottledException",
+            "TooManyRequestsException",
+            "ProvisionedThroughputExceededException",
+            "TransactionInProgressException",
+            "RequestLimitExceeded",
+            "BandwidthLimitExceeded",
+            "LimitExceededException",
+            "RequestThrottled",
+            "SlowDown",
+            "PriorRequestNotComplete",
+            "EC2ThrottledException"
+        };
+
+        /**
+         * Instances shared by key, created on first use and freed with the last of their users.
+         * Constant initialized, so that it can be used by the strategies constructed during static initialization.
+         */
+        template<typename T>
+        class SharedInstances
+        {
+        public:
+            constexpr SharedInstances() : m_instances(nullptr) {}
+
+            template<typename Factory>
+            std::shared_ptr<T> Get(const Aws::String& key, const Factory& create)
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (!m_instances)
+                {
+                    m_instances = Aws::New<InstanceMap>(ADAPTIVE_RETRY_STRATEGY_TAG);
+                }
+
+                auto& sharedInstance = (*m_instances)[key];
+                auto instance = sharedInstance.lock();
+                if (!instance)
+                {
+                    instance = create();
+                    sharedInstance = instance;
+                }
+                return instance;
+            }
+
+            /**
+             * Called by the instances as they are destroyed, forgets key unless it was shared again meanwhile.
+             */
+            void Release(const Aws::String& key)
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (!m_instances)
+                {
+                    return;
+                }
+
+                auto iter = m_instances->find(key);
+                if (iter != m_instances->end() && iter->second.expired())
+                {
+                    m_instances->erase(iter);
+                }
+                if (m_instances->empty())
+                {
+                    Aws::Delete(m_instances);
+                    m_instances = nullptr;
+                }
+            }
+
+        private:
+            typedef Aws::Map<Aws::String, std::weak_ptr<T>> InstanceMap;
+
+            std::mutex m_lock;
+            InstanceMap* m_instances;
+        };
+
+        // Token buckets shared by the strategies of each service.
+        static SharedInstances<RetryTokenBucket> s_sharedTokenBuckets;
+        // Strategies shared by the clients of each service and region.
+        static SharedInstances<AdaptiveRetryStrategy> s_sharedStrategies;
+
+        RetryTokenBucket::RetryTokenBucket() : RetryTokenBucket([] { return DateTime::Now(); })
+        {}
+
+        RetryTokenBucket::RetryTokenBucket(const Clock& clock) :
+            m_clock(clock),
+            m_fillRate(0),
+            m_maxCapacity(0),
+            m_currentCapacity(0),
+            m_lastTimestamp(0),
+            m_measuredTxRate(0),
+            m_lastTxRateBucket(std::floor(GetCurrentTimeInSeconds())),
+            m_requestCount(0),
+            m_enabled(false),
+            m_lastMaxRate(0),
+            m_lastThrottleTime(GetCurrentTimeInSeconds()),
+            m_timeWindow(0)
+        {}
+
+        bool RetryTokenBucket::Acquire(double amount, bool fastFail)
+        {
+            if (fastFail)
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (!m_enabled)
+                {
+                    return true;
+                }
+
+                Refill(GetCurrentTimeInSeconds());
+                if (amount > m_currentCapacity)
+                {
+                    return false;
+                }
+                m_currentCapacity -= amount;
+                return true;
+            }
+
+            long waitMillis = AcquireWithoutWaiting(amount);
+            if (waitMillis > 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(waitMillis));
+            }
+            return true;
+        }
+
+        long RetryTokenBucket::AcquireWithoutWaiting(double amount)
+        {
+            double waitSeconds = 0;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (!m_enabled)
+                {
+                    return 0;
+                }
+
+                Refill(GetCurrentTimeInSeconds());
+                if (amount > m_currentCapacity)
+                {
+                    // Take the missing tokens on credit, the refill pays them back while the caller waits,
+                    // callers arriving meanwhile queue up behind the debt.
+                    waitSeconds = (amount - m_currentCapacity) / m_fillRate;
+                }
+                m_currentCapacity -= amount;
+            }
+
+            if (waitSeconds <= 0)
+            {
+                return 0;
+            }
+            AWS_LOGSTREAM_DEBUG(ADAPTIVE_RETRY_STRATEGY_TAG, "Client side rate limiting, waiting " << waitSeconds << " seconds for send token.");
+            return static_cast<long>(std::ceil(waitSeconds * 1000));
+        }
+
+        void RetryTokenBucket::UpdateClientSendingRate(bool isThrottlingResponse)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            double timestamp = GetCurrentTimeInSeconds();
+            UpdateMeasuredRate(timestamp);
+
+            double calculatedRate;
+            if (isThrottlingResponse)
+            {
+                double rateToUse = m_enabled ? (std::min)(m_measuredTxRate, m_fillRate) : m_measuredTxRate;
+                m_lastMaxRate = rateToUse;
+                CalculateTimeWindow();
+                m_lastThrottleTime = timestamp;
+                calculatedRate = CUBICThrottle(rateToUse);
+                m_enabled = true;
+            }
+            else
+            {
+                CalculateTimeWindow();
+                calculatedRate = CUBICSuccess(timestamp);
+            }
+
+            UpdateRate((std::min)(calculatedRate, 2 * m_measuredTxRate), timestamp);
+        }
+
+        bool RetryTokenBucket::IsEnabled() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_enabled;
+        }
+
+        double RetryTokenBucket::GetFillRate() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_fillRate;
+        }
+
+        double RetryTokenBucket::GetMeasuredTxRate() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_measuredTxRate;
+        }
+
+        double RetryTokenBucket::GetCurrentCapacity() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_currentCapacity;
+        }
+
+        double RetryTokenBucket::CUBICSuccess(double timestamp) const
+        {
+            double dt = timestamp - m_lastThrottleTime;
+            return SCALE_CONSTANT * std::pow(dt - m_timeWindow, 3) + m_lastMaxRate;
+        }
+
+        double RetryTokenBucket::CUBICThrottle(double rateToUse) const
+        {
+            return rateToUse * BETA;
+        }
+
+        double RetryTokenBucket::GetCurrentTimeInSeconds() const
+        {
+            return m_clock().Millis() / 1000.0;
+        }
+
+        void RetryTokenBucket::Refill(double timestamp)
+        {
+            if (m_lastTimestamp == 0)
+            {
+                m_lastTimestamp = timestamp;
+                return;
+            }
+
+            double fillAmount = (timestamp - m_lastTimestamp) * m_fillRate;
+            m_currentCapacity = (std::min)(m_maxCapacity, m_currentCapacity + fillAmount);
+            m_lastTimestamp = timestamp;
+        }
+
+        void RetryTokenBucket::UpdateRate(double newRps, double timestamp)
+        {
+            Refill(timestamp);
+            m_fillRate = (std::max)(newRps, MIN_FILL_RATE);
+            m_maxCapacity = (std::max)(newRps, MIN_CAPACITY);
+            m_currentCapacity = (std::min)(m_currentCapacity, m_maxCapacity);
+        }
+
+        void RetryTokenBucket::UpdateMeasuredRate(double timestamp)
+        {
+            // Requests are counted in half second buckets.
+            double timeBucket = std::floor(timestamp * 2) / 2;
+            m_requestCount++;
+            if (timeBucket > m_lastTxRateBucket)
+            {
+                double currentRate = m_requestCount / (timeBucket - m_lastTxRateBucket);
+                m_measuredTxRate = (currentRate * SMOOTH) + (m_measuredTxRate * (1 - SMOOTH));
+                m_requestCount = 0;
+                m_lastTxRateBucket = timeBucket;
+            }
+        }
+
+        void RetryTokenBucket::CalculateTimeWindow()
+        {
+            // Time it takes the CUBIC curve to climb back to the rate at which the last throttling happened.
+            m_timeWindow = std::cbrt((m_lastMaxRate * (1 - BETA)) / SCALE_CONSTANT);
+        }
+
+        AdaptiveRetryStrategy::AdaptiveRetryStrategy(long maxAttempts) :
+            StandardRetryStrategy(maxAttempts),
+            m_retryTokenBucket(Aws::MakeShared<RetryTokenBucket>(ADAPTIVE_RETRY_STRATEGY_TAG)),
+            m_sharedPerClientService(true)
+        {}
+
+        AdaptiveRetryStrategy::AdaptiveRetryStrategy(const Aws::String& serviceName, long maxAttempts) :
+            StandardRetryStrategy(maxAttempts),
+            m_retryTokenBucket(s_sharedTokenBuckets.Get(serviceName, [] { return Aws::MakeShared<RetryTokenBucket>(ADAPTIVE_RETRY_STRATEGY_TAG); })),
+            m_serviceName(serviceName),
+            m_sharedPerClientService(false)
+        {}
+
+        AdaptiveRetryStrategy::AdaptiveRetryStrategy(std::shared_ptr<RetryTokenBucket> retryTokenBucket,
+            std::shared_ptr<RetryQuotaContainer> retryQuotaContainer, long maxAttempts) :
+            StandardRetryStrategy(retryQuotaContainer, maxAttempts),
+            m_retryTokenBucket(retryTokenBucket),
+            m_sharedPerClientService(false)
+        {}
+
+        AdaptiveRetryStrategy::~AdaptiveRetryStrategy()
+        {
+            if (!m_serviceName.empty())
+            {
+                m_retryTokenBucket = nullptr;
+                s_sharedTokenBuckets.Release(m_serviceName);
+            }
+            if (!m_sharedStrategyKey.empty())
+            {
+                s_sharedStrategies.Release(m_sharedStrategyKey);
+            }
+        }
+
+        std::shared_ptr<RetryStrategy> AdaptiveRetryStrategy::GetStrategyForClient(const Aws::String& serviceName, const Aws::String& region) const
+        {
+            if (!m_sharedPerClientService)
+            {
+                return nullptr;
+            }
+            return GetSharedStrategy(serviceName, region, GetMaxAttempts());
+        }
+
+        std::shared_ptr<AdaptiveRetryStrategy> AdaptiveRetryStrategy::GetSharedStrategy(const Aws::String& serviceName, const Aws::String& region,
+            long maxAttempts)
+        {
+            Aws::String tokenBucketKey = serviceName + "/" + region;
+            Aws::String strategyKey = tokenBucketKey + "/" + StringUtils::to_string(maxAttempts);
+            return s_sharedStrategies.Get(strategyKey, [&]
+            {
+                auto strategy = Aws::MakeShared<AdaptiveRetryStrategy>(ADAPTIVE_RETRY_STRATEGY_TAG, tokenBucketKey, maxAttempts);
+                strategy->m_sharedStrategyKey = strategyKey;
+                // A client of another service that is handed this strategy gets the strategy of its own service instead.
+                strategy->m_sharedPerClientService = true;
+                return strategy;
+            });
+        }
+
+        void AdaptiveRetryStrategy::GetSendToken()
+        {
+            m_retryTokenBucket->Acquire();
+        }
+
+        long AdaptiveRetryStrategy::GetSendTokenWithoutWaiting()
+        {
+            return m_retryTokenBucket->AcquireWithoutWaiting();
+        }
+
+        bool AdaptiveRetryStrategy::HasSendToken()
+        {
+            return m_retryTokenBucket->Acquire(1, true/*fastFail*/);
+        }
+
+        void AdaptiveRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome)
+        {
+            m_retryTokenBucket->UpdateClientSendingRate(!httpResponseOutcome.IsSuccess() && IsThrottlingError(httpResponseOutcome.GetError()));
+            StandardRetryStrategy::RequestBookkeeping(httpResponseOutcome);
+        }
+
+        void AdaptiveRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError)
+        {
+            m_retryTokenBucket->UpdateClientSendingRate(!httpResponseOutcome.IsSuccess() && IsThrottlingError(httpResponseOutcome.GetError()));
+            StandardRetryStrategy::RequestBookkeeping(httpResponseOutcome, lastError);
+        }
+
+        bool AdaptiveRetryStrategy::IsThrottlingError(const AWSError<CoreErrors>& error)
+        {
+            if (error.GetErrorType() == CoreErrors::THROTTLING || error.GetErrorType() == CoreErrors::SLOW_DOWN ||
+                error.GetResponseCode() == Http::HttpResponseCode::TOO_MANY_REQUESTS)
+            {
+                return true;
+            }
+
+            for (const char* exceptionName : THROTTLING_EXCEPTION_NAMES)
+            {
+                if (error.GetExceptionName() == exceptionName)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace Client
+} // namespace Aws
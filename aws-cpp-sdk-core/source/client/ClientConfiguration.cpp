@@ -5,6 +5,7 @@
 
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/AdaptiveRetryStrategy.h>
 #include <aws/core/client/DefaultRetryStrategy.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/platform/OSVersionInfo.h>
@@ -45,6 +46,7 @@ ClientConfiguration::ClientConfiguration() :
     enableTcpKeepAlive(true),
     tcpKeepAliveIntervalMs(30000),
     lowSpeedLimit(1),
+    idleConnectionTimeoutMs(60000),
     proxyScheme(Aws::Http::Scheme::HTTP),
     proxyPort(0),
     executor(Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(CLIENT_CONFIG_TAG)),
@@ -100,6 +102,17 @@ ClientConfiguration::ClientConfiguration() :
             retryStrategy = Aws::MakeShared<StandardRetryStrategy>(CLIENT_CONFIG_TAG, maxAttempts);
         }
     }
+    else if (retryMode == "adaptive")
+    {
+        if (maxAttempts < 0)
+        {
+            retryStrategy = Aws::MakeShared<AdaptiveRetryStrategy>(CLIENT_CONFIG_TAG);
+        }
+        else
+        {
+            retryStrategy = Aws::MakeShared<AdaptiveRetryStrategy>(CLIENT_CONFIG_TAG, maxAttempts);
+        }
+    }
     else
     {
         retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(CLIENT_CONFIG_TAG);
@@ -0,0 +1,159 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/EndpointDiscoveryCache.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+using namespace Aws::Utils;
+
+static const char ENDPOINT_DISCOVERY_CACHE_TAG[] = "EndpointDiscoveryCache";
+static const int64_t REFRESH_BACKOFF_BASE_MS = 1000;
+static const unsigned REFRESH_BACKOFF_MAX_DOUBLINGS = 10;
+
+EndpointDiscoveryCache::EndpointDiscoveryCache(size_t maxSize) :
+    m_entries(maxSize),
+    m_pendingRefreshes(0),
+    m_shuttingDown(false)
+{
+}
+
+EndpointDiscoveryCache::~EndpointDiscoveryCache()
+{
+    std::unique_lock<std::mutex> lock(m_refreshLock);
+    m_shuttingDown = true;
+    m_refreshFinished.wait(lock, [this] { return m_pendingRefreshes == 0; });
+}
+
+void EndpointDiscoveryCache::SetExecutor(const std::shared_ptr<Threading::Executor>& executor)
+{
+    std::lock_guard<std::mutex> lock(m_refreshLock);
+    m_executor = executor;
+}
+
+std::shared_ptr<const Aws::Http::URI> EndpointDiscoveryCache::GetEndpoint(const Aws::String& key, const DiscoverEndpointFunction& discover)
+{
+    std::shared_ptr<Entry> entry;
+    if (!m_entries.Get(key, entry))
+    {
+        return DiscoverOnce(key, discover);
+    }
+
+    if (DateTime::Now().Millis() >= entry->refreshAtMs.load() && !entry->refreshing.exchange(true))
+    {
+        Refresh(key, discover, entry);
+    }
+    return entry->endpoint;
+}
+
+std::shared_ptr<const Aws::Http::URI> EndpointDiscoveryCache::DiscoverOnce(const Aws::String& key, const DiscoverEndpointFunction& discover)
+{
+    std::shared_ptr<Discovery> discovery;
+    {
+        std::unique_lock<std::mutex> lock(m_discoveryLock);
+        auto discoveryIter = m_discoveries.find(key);
+        if (discoveryIter != m_discoveries.end())
+        {
+            discovery = discoveryIter->second;
+            m_discoveryFinished.wait(lock, [&discovery] { return discovery->done; });
+            return discovery->endpoint;
+        }
+
+        // A discovery may have stored the entry and finished between the cache miss and taking the lock.
+        std::shared_ptr<Entry> entry;
+        if (m_entries.Get(key, entry))
+        {
+            return entry->endpoint;
+        }
+
+        discovery = Aws::MakeShared<Discovery>(ENDPOINT_DISCOVERY_CACHE_TAG);
+        m_discoveries[key] = discovery;
+    }
+
+    auto endpoint = DiscoverAndStore(key, discover);
+    {
+        std::lock_guard<std::mutex> lock(m_discoveryLock);
+        discovery->endpoint = endpoint;
+        discovery->done = true;
+        m_discoveries.erase(key);
+    }
+    m_discoveryFinished.notify_all();
+    return endpoint;
+}
+
+std::shared_ptr<const Aws::Http::URI> EndpointDiscoveryCache::DiscoverAndStore(const Aws::String& key, const DiscoverEndpointFunction& discover)
+{
+    Aws::String address;
+    std::chrono::milliseconds cachePeriod(0);
+    if (!discover(address, cachePeriod))
+    {
+        return nullptr;
+    }
+
+    auto entry = Aws::MakeShared<Entry>(ENDPOINT_DISCOVERY_CACHE_TAG);
+    entry->endpoint = Aws::MakeShared<Aws::Http::URI>(ENDPOINT_DISCOVERY_CACHE_TAG, address);
+    const int64_t nowMs = DateTime::Now().Millis();
+    entry->expiresAtMs = nowMs + static_cast<int64_t>(cachePeriod.count());
+    entry->refreshAtMs = nowMs + static_cast<int64_t>(cachePeriod.count()) * 3 / 4;
+    entry->refreshing = false;
+    entry->failedRefreshes = 0;
+    m_entries.Put(key, entry, cachePeriod);
+    return entry->endpoint;
+}
+
+int64_t EndpointDiscoveryCache::NextRefreshAfterFailure(Entry& entry)
+{
+    const unsigned doublings = (std::min)(entry.failedRefreshes, REFRESH_BACKOFF_MAX_DOUBLINGS);
+    ++entry.failedRefreshes;
+
+    const int64_t nowMs = DateTime::Now().Millis();
+    const int64_t backoffMs = REFRESH_BACKOFF_BASE_MS << doublings;
+    if (nowMs + backoffMs < entry.expiresAtMs)
+    {
+        return nowMs + backoffMs;
+    }
+    // Halves the time left, so the entry still gets a few tries before it expires.
+    return nowMs + (std::max)(entry.expiresAtMs - nowMs, static_cast<int64_t>(0)) / 2;
+}
+
+void EndpointDiscoveryCache::Refresh(const Aws::String& key, const DiscoverEndpointFunction& discover, const std::shared_ptr<Entry>& entry)
+{
+    std::shared_ptr<Threading::Executor> executor;
+    {
+        std::lock_guard<std::mutex> lock(m_refreshLock);
+        if (m_shuttingDown)
+        {
+            return;
+        }
+        executor = m_executor;
+        ++m_pendingRefreshes;
+    }
+
+    AWS_LOGSTREAM_TRACE(ENDPOINT_DISCOVERY_CACHE_TAG, "Refreshing endpoint for key: " << key);
+    auto refresh = [this, key, discover, entry]()
+    {
+        if (!DiscoverAndStore(key, discover))
+        {
+            AWS_LOGSTREAM_WARN(ENDPOINT_DISCOVERY_CACHE_TAG, "Failed to refresh endpoint for key: " << key << ", keeping the current one until it expires.");
+            // Delays the next try, then lets a later lookup make it.
+            entry->refreshAtMs = NextRefreshAfterFailure(*entry);
+            entry->refreshing = false;
+        }
+
+        // Notified under the lock, the destructor may return as soon as it is released.
+        std::lock_guard<std::mutex> lock(m_refreshLock);
+        --m_pendingRefreshes;
+        m_refreshFinished.notify_all();
+    };
+
+    if (!executor || !executor->Submit(refresh))
+    {
+        refresh();
+    }
+}
@@ -0,0 +1,416 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/RequestCompression.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <streambuf>
+
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+#include <zlib.h>
+#endif
+
+#ifdef ENABLED_ZSTD_REQUEST_COMPRESSION
+#include <zstd.h>
+#endif
+
+using namespace Aws::Client;
+using namespace Aws::Utils;
+
+static const char REQUEST_COMPRESSION_LOG_TAG[] = "RequestCompression";
+// Size of the chunks of the source read at a time, and of the compressed chunks handed to the reader.
+static const size_t COMPRESSION_BUFFER_SIZE = 64 * 1024;
+
+namespace
+{
+    struct CompressionBuffers
+    {
+        const char* input;
+        size_t inputLength;
+        char* output;
+        size_t outputLength;
+    };
+
+    enum class CompressionStatus
+    {
+        Failed,
+        InProgress,
+        Done
+    };
+
+    /**
+     * Streaming compressor of one algorithm, compressing one body at a time.
+     */
+    class Compressor
+    {
+    public:
+        virtual ~Compressor() = default;
+
+        /**
+         * Compresses as much of the input as fits in the output and advances both. finish is true when the input holds the end of the body.
+         */
+        virtual CompressionStatus Compress(CompressionBuffers& buffers, bool finish) = 0;
+
+        /**
+         * Starts compressing a new body.
+         */
+        virtual bool Reset() = 0;
+    };
+
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+    class GzipCompressor : public Compressor
+    {
+    public:
+        GzipCompressor(int compressionLevel) : m_initialized(false)
+        {
+            memset(&m_stream, 0, sizeof(m_stream));
+            // 16 more window bits than the default writes a gzip header and trailer around the deflate stream.
+            m_initialized = deflateInit2(&m_stream, compressionLevel < 0 ? Z_DEFAULT_COMPRESSION : (std::min)(compressionLevel, 9),
+                Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        }
+
+        ~GzipCompressor()
+        {
+            if (m_initialized)
+            {
+                deflateEnd(&m_stream);
+            }
+        }
+
+        bool IsInitialized() const { return m_initialized; }
+
+        CompressionStatus Compress(CompressionBuffers& buffers, bool finish) override
+        {
+            m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(buffers.input));
+            m_stream.avail_in = static_cast<uInt>(buffers.inputLength);
+            m_stream.next_out = reinterpret_cast<Bytef*>(buffers.output);
+            m_stream.avail_out = static_cast<uInt>(buffers.outputLength);
+
+            int result = deflate(&m_stream, finish ? Z_FINISH : Z_NO_FLUSH);
+
+            buffers.input += buffers.inputLength - m_stream.avail_in;
+            buffers.inputLength = m_stream.avail_in;
+            buffers.output += buffers.outputLength - m_stream.avail_out;
+            buffers.outputLength = m_stream.avail_out;
+
+            switch (result)
+            {
+                case Z_STREAM_END:
+                    return CompressionStatus::Done;
+                case Z_OK:
+                case Z_BUF_ERROR:
+                    return CompressionStatus::InProgress;
+                default:
+                    AWS_LOGSTREAM_ERROR(REQUEST_COMPRESSION_LOG_TAG, "zlib failed to compress the request body with error " << result);
+                    return CompressionStatus::Failed;
+            }
+        }
+
+        bool Reset() override
+        {
+            return deflateReset(&m_stream) == Z_OK;
+        }
+
+    private:
+        z_stream m_stream;
+        bool m_initialized;
+    };
+#endif // ENABLED_ZLIB_REQUEST_COMPRESSION
+
+#ifdef ENABLED_ZSTD_REQUEST_COMPRESSION
+    class ZstdCompressor : public Compressor
+    {
+    public:
+        ZstdCompressor(int compressionLevel) : m_context(ZSTD_createCCtx())
+        {
+            if (m_context)
+            {
+                ZSTD_CCtx_setParameter(m_context, ZSTD_c_compressionLevel, compressionLevel < 0 ? ZSTD_CLEVEL_DEFAULT : compressionLevel);
+            }
+        }
+
+        ~ZstdCompressor()
+        {
+            ZSTD_freeCCtx(m_context);
+        }
+
+        bool IsInitialized() const { return m_context != nullptr; }
+
+        CompressionStatus Compress(CompressionBuffers& buffers, bool finish) override
+        {
+            ZSTD_inBuffer input = { buffers.input, buffers.inputLength, 0 };
+            ZSTD_outBuffer output = { buffers.output, buffers.outputLength, 0 };
+
+            size_t remaining = ZSTD_compressStream2(m_context, &output, &input, finish ? ZSTD_e_end : ZSTD_e_continue);
+
+            buffers.input += input.pos;
+            buffers.inputLength -= input.pos;
+            buffers.output += output.pos;
+            buffers.outputLength -= output.pos;
+
+            if (ZSTD_isError(remaining))
+            {
+                AWS_LOGSTREAM_ERROR(REQUEST_COMPRESSION_LOG_TAG, "zstd failed to compress the request body: " << ZSTD_getErrorName(remaining));
+                return CompressionStatus::Failed;
+            }
+            return finish && remaining == 0 ? CompressionStatus::Done : CompressionStatus::InProgress;
+        }
+
+        bool Reset() override
+        {
+            return !ZSTD_isError(ZSTD_CCtx_reset(m_context, ZSTD_reset_session_only));
+        }
+
+    private:
+        ZSTD_CCtx* m_context;
+    };
+#endif // ENABLED_ZSTD_REQUEST_COMPRESSION
+
+    Aws::UniquePtr<Compressor> CreateCompressor(CompressionAlgorithm algorithm, int compressionLevel)
+    {
+        AWS_UNREFERENCED_PARAM(compressionLevel);
+        switch (algorithm)
+        {
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+            case CompressionAlgorithm::GZIP:
+            {
+                auto compressor = Aws::MakeUnique<GzipCompressor>(REQUEST_COMPRESSION_LOG_TAG, compressionLevel);
+                if (compressor->IsInitialized())
+                {
+                    return Aws::UniquePtr<Compressor>(std::move(compressor));
+                }
+                return nullptr;
+            }
+#endif
+#ifdef ENABLED_ZSTD_REQUEST_COMPRESSION
+            case CompressionAlgorithm::ZSTD:
+            {
+                auto compressor = Aws::MakeUnique<ZstdCompressor>(REQUEST_COMPRESSION_LOG_TAG, compressionLevel);
+                if (compressor->IsInitialized())
+                {
+                    return Aws::UniquePtr<Compressor>(std::move(compressor));
+                }
+                return nullptr;
+            }
+#endif
+            default:
+                return nullptr;
+        }
+    }
+
+    /**
+     * Read only stream buffer compressing the source in fixed size chunks as it is read. Can only seek to its start, to compress again.
+     */
+    class CompressionStreamBuf : public std::streambuf
+    {
+    public:
+        CompressionStreamBuf(Aws::UniquePtr<Compressor>&& compressor, const std::shared_ptr<Aws::IOStream>& source) :
+            m_compressor(std::move(compressor)),
+            m_source(source),
+            m_input(COMPRESSION_BUFFER_SIZE),
+            m_output(COMPRESSION_BUFFER_SIZE),
+            m_inputPosition(0),
+            m_inputLength(0),
+            m_sourceEnded(false),
+            m_done(false),
+            m_failed(false),
+            m_position(0)
+        {
+            // A source that can't seek, e.g. a pipe, is compressed from where it is.
+            m_source->clear();
+            m_source->seekg(0, std::ios_base::beg);
+            m_source->clear();
+        }
+
+        bool Failed() const { return m_failed; }
+
+    protected:
+        int_type underflow() override
+        {
+            if (gptr() < egptr())
+            {
+                return traits_type::to_int_type(*gptr());
+            }
+
+            m_position += egptr() - eback();
+            setg(nullptr, nullptr, nullptr);
+
+            while (!m_done && !m_failed)
+            {
+                if (m_inputPosition == m_inputLength && !m_sourceEnded)
+                {
+                    m_source->read(m_input.GetUnderlyingData(), COMPRESSION_BUFFER_SIZE);
+                    m_inputPosition = 0;
+                    m_inputLength = static_cast<size_t>(m_source->gcount());
+                    if (m_source->bad())
+                    {
+                        AWS_LOGSTREAM_ERROR(REQUEST_COMPRESSION_LOG_TAG, "Failed to read the request body to compress");
+                        m_failed = true;
+                        break;
+                    }
+                    m_sourceEnded = m_source->eof();
+                }
+
+                CompressionBuffers buffers = { m_input.GetUnderlyingData() + m_inputPosition, m_inputLength - m_inputPosition,
+                    m_output.GetUnderlyingData(), COMPRESSION_BUFFER_SIZE };
+                // Once the source has ended all of the remaining input is passed in.
+                CompressionStatus status = m_compressor->Compress(buffers, m_sourceEnded);
+                size_t consumed = (m_inputLength - m_inputPosition) - buffers.inputLength;
+                size_t produced = COMPRESSION_BUFFER_SIZE - buffers.outputLength;
+                m_inputPosition += consumed;
+
+                m_done = status == CompressionStatus::Done;
+                m_failed = status == CompressionStatus::Failed || (!m_done && consumed == 0 && produced == 0 && m_sourceEnded);
+                if (produced > 0)
+                {
+                    setg(m_output.GetUnderlyingData(), m_output.GetUnderlyingData(), m_output.GetUnderlyingData() + produced);
+                    return traits_type::to_int_type(*gptr());
+                }
+            }
+
+            return traits_type::eof();
+        }
+
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override
+        {
+            if (which & std::ios_base::in)
+            {
+                if (dir == std::ios_base::cur && off == 0)
+                {
+                    return pos_type(static_cast<off_type>(m_position + (gptr() - eback())));
+                }
+                if (dir == std::ios_base::beg && off == 0 && Rewind())
+                {
+                    return pos_type(0);
+                }
+            }
+            return pos_type(off_type(-1));
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override
+        {
+            return seekoff(off_type(pos), std::ios_base::beg, which);
+        }
+
+    private:
+        bool Rewind()
+        {
+            m_source->clear();
+            if (!m_source->seekg(0, std::ios_base::beg) || !m_compressor->Reset())
+            {
+                m_failed = true;
+                return false;
+            }
+
+            m_inputPosition = 0;
+            m_inputLength = 0;
+            m_sourceEnded = false;
+            m_done = false;
+            m_failed = false;
+            m_position = 0;
+            setg(nullptr, nullptr, nullptr);
+            return true;
+        }
+
+        Aws::UniquePtr<Compressor> m_compressor;
+        std::shared_ptr<Aws::IOStream> m_source;
+        Array<char> m_input;
+        Array<char> m_output;
+        size_t m_inputPosition;
+        size_t m_inputLength;
+        bool m_sourceEnded;
+        bool m_done;
+        bool m_failed;
+        // Compressed bytes handed out before the current get area.
+        size_t m_position;
+    };
+
+    class CompressingStream : public Aws::IOStream
+    {
+    public:
+        CompressingStream(Aws::UniquePtr<Compressor>&& compressor, const std::shared_ptr<Aws::IOStream>& source) :
+            Aws::IOStream(nullptr),
+            m_buffer(std::move(compressor), source)
+        {
+            rdbuf(&m_buffer);
+        }
+
+        bool Failed() const { return m_buffer.Failed(); }
+
+    private:
+        CompressionStreamBuf m_buffer;
+    };
+} // namespace
+
+bool RequestCompression::IsAlgorithmAvailable(CompressionAlgorithm algorithm)
+{
+    switch (algorithm)
+    {
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+        case CompressionAlgorithm::GZIP:
+            return true;
+#endif
+#ifdef ENABLED_ZSTD_REQUEST_COMPRESSION
+        case CompressionAlgorithm::ZSTD:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* RequestCompression::GetContentEncoding(CompressionAlgorithm algorithm)
+{
+    switch (algorithm)
+    {
+        case CompressionAlgorithm::GZIP:
+            return "gzip";
+        case CompressionAlgorithm::ZSTD:
+            return "zstd";
+        default:
+            return "";
+    }
+}
+
+std::shared_ptr<Aws::IOStream> RequestCompression::CreateCompressingStream(CompressionAlgorithm algorithm, const std::shared_ptr<Aws::IOStream>& source,
+    int compressionLevel)
+{
+    auto compressor = CreateCompressor(algorithm, compressionLevel);
+    if (!compressor || !source)
+    {
+        return nullptr;
+    }
+    return Aws::MakeShared<CompressingStream>(REQUEST_COMPRESSION_LOG_TAG, std::move(compressor), source);
+}
+
+std::shared_ptr<Aws::IOStream> RequestCompression::Compress(CompressionAlgorithm algorithm, const std::shared_ptr<Aws::IOStream>& source,
+    int compressionLevel)
+{
+    auto compressor = CreateCompressor(algorithm, compressionLevel);
+    if (!compressor || !source)
+    {
+        return nullptr;
+    }
+
+    CompressingStream compressing(std::move(compressor), source);
+    auto compressed = Aws::MakeShared<Aws::StringStream>(REQUEST_COMPRESSION_LOG_TAG);
+    Array<char> chunk(COMPRESSION_BUFFER_SIZE);
+    while (compressing.read(chunk.GetUnderlyingData(), COMPRESSION_BUFFER_SIZE) || compressing.gcount() > 0)
+    {
+        compressed->write(chunk.GetUnderlyingData(), compressing.gcount());
+    }
+
+    if (compressing.Failed())
+    {
+        return nullptr;
+    }
+    return compressed;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
 
 using namespace Aws;
 using namespace Aws::Http;
@@ -16,6 +17,27 @@ HttpClient::HttpClient() :
 {
 }
 
+void HttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+    const HttpResponseReceivedHandler& handler,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+    Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    auto response = MakeRequest(request, readLimiter, writeLimiter);
+    if (handler)
+    {
+        handler(request, response);
+    }
+}
+
+void HttpClient::ScheduleAfter(std::chrono::milliseconds delay, const std::function<void()>& callback)
+{
+    RetryRequestSleep(delay);
+    if (callback)
+    {
+        callback();
+    }
+}
+
 void HttpClient::DisableRequestProcessing() 
 { 
     m_disableRequestProcessing = true;
@@ -7,6 +7,7 @@
 
 #if ENABLE_CURL_CLIENT
 #include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
 #include <signal.h>
 
 #elif ENABLE_WINDOWS_CLIENT
@@ -94,6 +95,11 @@ namespace Aws
                 }
 #endif // ENABLE_WINDOWS_IXML_HTTP_REQUEST_2_CLIENT
 #elif ENABLE_CURL_CLIENT
+                if (clientConfiguration.httpLibOverride == TransferLibType::CURL_MULTI_CLIENT)
+                {
+                    AWS_LOGSTREAM_INFO(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, "Creating event driven curl multi http client.");
+                    return Aws::MakeShared<CurlMultiHttpClient>(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, clientConfiguration);
+                }
                 return Aws::MakeShared<CurlHttpClient>(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, clientConfiguration);
 #else
                 // When neither of these clients is enabled, gcc gives a warning (converted
@@ -0,0 +1,205 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/http/HttpHeaders.h>
+
+#include <algorithm>
+
+using namespace Aws::Http;
+
+// Requests rarely carry more headers than this, reserving them up front saves growing the vector while the request is built.
+static const size_t RESERVED_HEADER_COUNT = 16;
+
+// Names of the headers set on most requests or returned on most responses, lower cased and sorted.
+static const char* const KNOWN_HEADER_NAMES[] =
+{
+    "accept",
+    "accept-charset",
+    "accept-encoding",
+    "amz-sdk-invocation-id",
+    "amz-sdk-request",
+    "authorization",
+    "connection",
+    "content-encoding",
+    "content-length",
+    "content-md5",
+    "content-range",
+    "content-type",
+    "cookie",
+    "date",
+    "etag",
+    "expect",
+    "host",
+    "keep-alive",
+    "last-modified",
+    "server",
+    "transfer-encoding",
+    "user-agent",
+    "via",
+    "x-amz-api-version",
+    "x-amz-content-sha256",
+    "x-amz-crc32",
+    "x-amz-date",
+    "x-amz-expires",
+    "x-amz-id-2",
+    "x-amz-request-id",
+    "x-amz-security-token",
+    "x-amz-target",
+    "x-amz-version-id",
+    "x-amzn-errortype",
+    "x-amzn-requestid",
+    "x-amzn-trace-id"
+};
+
+static inline unsigned char ToLowerAscii(char c)
+{
+    return static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+}
+
+static inline bool IsHeaderWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static void TrimRange(const char*& begin, const char*& end)
+{
+    while (begin < end && IsHeaderWhitespace(*begin))
+    {
+        ++begin;
+    }
+    while (end > begin && IsHeaderWhitespace(*(end - 1)))
+    {
+        --end;
+    }
+}
+
+/**
+ * Orders name, compared case insensitively, against a lower cased header name: the same order as the lower cased names themselves.
+ */
+static int CompareHeaderName(const char* name, size_t nameLength, const char* lowerName, size_t lowerNameLength)
+{
+    size_t length = (std::min)(nameLength, lowerNameLength);
+    for (size_t i = 0; i < length; ++i)
+    {
+        unsigned char c = ToLowerAscii(name[i]);
+        unsigned char lower = static_cast<unsigned char>(lowerName[i]);
+        if (c != lower)
+        {
+            return c < lower ? -1 : 1;
+        }
+    }
+    return nameLength == lowerNameLength ? 0 : (nameLength < lowerNameLength ? -1 : 1);
+}
+
+HttpHeaders::HttpHeaders()
+{
+    m_headers.reserve(RESERVED_HEADER_COUNT);
+}
+
+const char* HttpHeaders::GetKnownHeaderName(const char* name, size_t nameLength)
+{
+    const char* const* first = std::begin(KNOWN_HEADER_NAMES);
+    const char* const* last = std::end(KNOWN_HEADER_NAMES);
+    auto known = std::lower_bound(first, last, name, [nameLength](const char* knownName, const char* value)
+    {
+        return CompareHeaderName(value, nameLength, knownName, strlen(knownName)) > 0;
+    });
+    if (known != last && CompareHeaderName(name, nameLength, *known, strlen(*known)) == 0)
+    {
+        return *known;
+    }
+    return nullptr;
+}
+
+Aws::Vector<HttpHeaders::Header>::iterator HttpHeaders::LowerBound(const char* name, size_t nameLength)
+{
+    return std::lower_bound(m_headers.begin(), m_headers.end(), name, [nameLength](const Header& header, const char* value)
+    {
+        return CompareHeaderName(value, nameLength, header.GetName(), header.GetNameLength()) > 0;
+    });
+}
+
+Aws::Vector<HttpHeaders::Header>::const_iterator HttpHeaders::LowerBound(const char* name, size_t nameLength) const
+{
+    return std::lower_bound(m_headers.begin(), m_headers.end(), name, [nameLength](const Header& header, const char* value)
+    {
+        return CompareHeaderName(value, nameLength, header.GetName(), header.GetNameLength()) > 0;
+    });
+}
+
+const Aws::String* HttpHeaders::Find(const char* name, size_t nameLength) const
+{
+    auto header = LowerBound(name, nameLength);
+    if (header != m_headers.end() && CompareHeaderName(name, nameLength, header->GetName(), header->GetNameLength()) == 0)
+    {
+        return &header->m_value;
+    }
+    return nullptr;
+}
+
+void HttpHeaders::Set(const char* name, size_t nameLength, const char* value, size_t valueLength)
+{
+    const char* nameEnd = name + nameLength;
+    TrimRange(name, nameEnd);
+    nameLength = nameEnd - name;
+    if (nameLength == 0)
+    {
+        return;
+    }
+
+    const char* valueEnd = value + valueLength;
+    TrimRange(value, valueEnd);
+    valueLength = valueEnd - value;
+
+    auto position = LowerBound(name, nameLength);
+    if (position != m_headers.end() && CompareHeaderName(name, nameLength, position->GetName(), position->GetNameLength()) == 0)
+    {
+        position->m_value.assign(value, valueLength);
+        return;
+    }
+
+    // The value is copied before inserting since it may point into the value of another header, which the insertion moves.
+    Header header;
+    header.m_nameLength = nameLength;
+    header.m_knownName = GetKnownHeaderName(name, nameLength);
+    if (!header.m_knownName)
+    {
+        header.m_name.resize(nameLength);
+        std::transform(name, nameEnd, header.m_name.begin(), [](char c) { return static_cast<char>(ToLowerAscii(c)); });
+    }
+    header.m_value.assign(value, valueLength);
+    m_headers.insert(position, std::move(header));
+}
+
+bool HttpHeaders::Erase(const char* name)
+{
+    size_t nameLength = strlen(name);
+    auto header = LowerBound(name, nameLength);
+    if (header != m_headers.end() && CompareHeaderName(name, nameLength, header->GetName(), header->GetNameLength()) == 0)
+    {
+        m_headers.erase(header);
+        return true;
+    }
+    return false;
+}
+
+void HttpHeaders::Visit(const HeaderVisitor& visitor) const
+{
+    for (const auto& header : m_headers)
+    {
+        visitor(header.GetName(), header.GetNameLength(), header.m_value);
+    }
+}
+
+HeaderValueCollection HttpHeaders::ToCollection() const
+{
+    HeaderValueCollection headers;
+    for (const auto& header : m_headers)
+    {
+        // Already sorted, every header goes at the end of the map.
+        headers.emplace_hint(headers.end(), Aws::String(header.GetName(), header.GetNameLength()), header.m_value);
+    }
+    return headers;
+}
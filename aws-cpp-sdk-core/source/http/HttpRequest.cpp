@@ -21,6 +21,7 @@ const char AWS_AUTHORIZATION_HEADER[] = "authorization";
 const char COOKIE_HEADER[] = "cookie";
 const char CONTENT_LENGTH_HEADER[] = "content-length";
 const char CONTENT_TYPE_HEADER[] = "content-type";
+const char CONTENT_ENCODING_HEADER[] = "content-encoding";
 const char TRANSFER_ENCODING_HEADER[] = "transfer-encoding";
 const char USER_AGENT_HEADER[] = "user-agent";
 const char VIA_HEADER[] = "via";
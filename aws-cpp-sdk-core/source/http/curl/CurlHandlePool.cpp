@@ -0,0 +1,590 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/http/curl/CurlHandlePool.h>
+#include <aws/core/http/Scheme.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+using namespace Aws::Utils::Logging;
+using namespace Aws::Utils::Threading;
+using namespace Aws::Http;
+
+static const char* CURL_HANDLE_POOL_TAG = "CurlHandlePool";
+static const uint32_t EMPTY_SLOT_INDEX = 0xFFFFFFFF;
+static const unsigned MAX_SHARDS_COUNT = 16;
+static const size_t CACHE_LINE_SIZE = 64;
+
+static int64_t NowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+namespace Aws
+{
+namespace Http
+{
+    /**
+     * A pooled handle, slots are owned by the endpoint they were created for and recycled once their handle is closed.
+     */
+    struct CurlHandleSlot
+    {
+        CurlHandleSlot() : handle(nullptr), hostPool(nullptr), index(0), next(EMPTY_SLOT_INDEX), lastReleasedMs(0) {}
+
+        CURL* handle;
+        CurlHandleHostPool* hostPool;
+        uint32_t index;
+        // Only meaningful while the slot is linked in a SlotStack.
+        std::atomic<uint32_t> next;
+        int64_t lastReleasedMs;
+    };
+
+    /**
+     * Lock-free (Treiber) stack of slot indices. The head packs a modification counter with the index
+     * so a head that was popped and pushed back in between is not mistaken for an unchanged one.
+     */
+    class SlotStack
+    {
+    public:
+        SlotStack() : m_head(Pack(0, EMPTY_SLOT_INDEX)) {}
+
+        void Push(CurlHandleSlot* slots, uint32_t index)
+        {
+            uint64_t head = m_head.load(std::memory_order_relaxed);
+            do
+            {
+                slots[index].next.store(Index(head), std::memory_order_relaxed);
+            } while (!m_head.compare_exchange_weak(head, Pack(Tag(head) + 1, index), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        uint32_t Pop(CurlHandleSlot* slots)
+        {
+            uint64_t head = m_head.load(std::memory_order_acquire);
+            while (Index(head) != EMPTY_SLOT_INDEX)
+            {
+                uint32_t next = slots[Index(head)].next.load(std::memory_order_relaxed);
+                if (m_head.compare_exchange_weak(head, Pack(Tag(head) + 1, next), std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    return Index(head);
+                }
+            }
+            return EMPTY_SLOT_INDEX;
+        }
+
+        // Detaches the whole stack, the returned chain is then exclusively owned by the caller.
+        uint32_t PopAll()
+        {
+            uint64_t head = m_head.load(std::memory_order_acquire);
+            while (Index(head) != EMPTY_SLOT_INDEX &&
+                !m_head.compare_exchange_weak(head, Pack(Tag(head) + 1, EMPTY_SLOT_INDEX), std::memory_order_acquire, std::memory_order_acquire));
+            return Index(head);
+        }
+
+    private:
+        static uint64_t Pack(uint32_t tag, uint32_t index) { return (static_cast<uint64_t>(tag) << 32) | index; }
+        static uint32_t Tag(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+        static uint32_t Index(uint64_t head) { return static_cast<uint32_t>(head); }
+
+        std::atomic<uint64_t> m_head;
+    };
+
+    struct CurlHandleShard
+    {
+        SlotStack idleSlots;
+        // Keeps the heads of neighbouring shards on separate cache lines.
+        char padding[CACHE_LINE_SIZE - sizeof(SlotStack)];
+    };
+
+    struct CurlHandleHostPool
+    {
+        CurlHandleHostPool(const URI& uri, const Aws::String& endpoint, unsigned capacity, unsigned shardsCount) :
+            endpoint(endpoint), authority(uri.GetAuthority()),
+            slots(capacity), idleShards(shardsCount), nextUnusedSlot(0),
+            idleHandles(0), leasedHandles(0), handlesCreated(0), handlesReused(0), handlesEvicted(0),
+            acquirers(0), lastAcquiredMs(NowMs())
+        {
+            for (uint32_t i = 0; i < capacity; ++i)
+            {
+                slots[i].hostPool = this;
+                slots[i].index = i;
+            }
+        }
+
+        uint32_t PopIdleSlot(unsigned preferredShard)
+        {
+            for (size_t i = 0; i < idleShards.size(); ++i)
+            {
+                uint32_t slotIndex = idleShards[(preferredShard + i) % idleShards.size()].idleSlots.Pop(slots.data());
+                if (slotIndex != EMPTY_SLOT_INDEX)
+                {
+                    return slotIndex;
+                }
+            }
+            return EMPTY_SLOT_INDEX;
+        }
+
+        // scheme://authority:port, the key of the endpoint in CurlHandlePool::m_hostPools.
+        Aws::String endpoint;
+        Aws::String authority;
+
+        Aws::Vector<CurlHandleSlot> slots;
+        Aws::Vector<CurlHandleShard> idleShards;
+        SlotStack freeSlots;
+        std::atomic<uint32_t> nextUnusedSlot;
+
+        std::atomic<size_t> idleHandles;
+        std::atomic<size_t> leasedHandles;
+        std::atomic<size_t> handlesCreated;
+        std::atomic<size_t> handlesReused;
+        std::atomic<size_t> handlesEvicted;
+
+        // Threads between the lookup of the endpoint and the end of AcquireCurlHandle, the endpoint is kept while there are any.
+        std::atomic<size_t> acquirers;
+        std::atomic<int64_t> lastAcquiredMs;
+
+        // Nothing uses the endpoint anymore, only called under the writer lock so no thread can start acquiring from it meanwhile.
+        bool IsUnusedSince(int64_t unusedSinceMs) const
+        {
+            return acquirers == 0 && leasedHandles == 0 && idleHandles == 0 && lastAcquiredMs <= unusedSinceMs;
+        }
+    };
+} // namespace Http
+} // namespace Aws
+
+static Aws::String GetEndpoint(const URI& uri)
+{
+    return Aws::String(SchemeMapper::ToString(uri.GetScheme())) + "://" + uri.GetAuthority() + ":" + Aws::Utils::StringUtils::to_string(uri.GetPort());
+}
+
+static unsigned GetShardIndex(unsigned shardsCount)
+{
+    return static_cast<unsigned>(std::hash<std::thread::id>()(std::this_thread::get_id()) % shardsCount);
+}
+
+CurlHandleOptions::CurlHandleOptions(long httpRequestTimeout, long connectTimeout, bool tcpKeepAlive, unsigned long tcpKeepAliveIntervalMs,
+                                     long lowSpeedTime, unsigned long lowSpeedLimit) :
+    httpRequestTimeout(httpRequestTimeout), connectTimeout(connectTimeout), enableTcpKeepAlive(tcpKeepAlive),
+    tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), lowSpeedTime(lowSpeedTime), lowSpeedLimit(lowSpeedLimit)
+{
+}
+
+void CurlHandleOptions::ApplyTo(CURL* handle) const
+{
+    //for timeouts to work in a multi-threaded context,
+    //always turn signals off. This also forces dns queries to
+    //not be included in the timeout calculations.
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, httpRequestTimeout);
+    curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, connectTimeout);
+    curl_easy_setopt(handle, CURLOPT_LOW_SPEED_LIMIT, lowSpeedLimit);
+    curl_easy_setopt(handle, CURLOPT_LOW_SPEED_TIME, lowSpeedTime < 1000 ? (lowSpeedTime == 0 ? 0 : 1) : lowSpeedTime / 1000);
+    curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, enableTcpKeepAlive ? 1L : 0L);
+    curl_easy_setopt(handle, CURLOPT_TCP_KEEPINTVL, tcpKeepAliveIntervalMs / 1000);
+    curl_easy_setopt(handle, CURLOPT_TCP_KEEPIDLE, tcpKeepAliveIntervalMs / 1000);
+#ifdef CURL_HAS_H2
+    curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
+#endif
+}
+
+CurlHandlePool::CurlHandlePool(unsigned maxSize, long httpRequestTimeout, long connectTimeout, bool enableTcpKeepAlive,
+                               unsigned long tcpKeepAliveIntervalMs, long lowSpeedTime, unsigned long lowSpeedLimit, unsigned long idleTimeoutMs) :
+    m_handlesCount(0), m_nextEvictionMs(0), m_shardsCount(1), m_waitersCount(0), m_handleEvents(0),
+    m_maxPoolSize(maxSize), m_handleOptions(httpRequestTimeout, connectTimeout, enableTcpKeepAlive, tcpKeepAliveIntervalMs, lowSpeedTime, lowSpeedLimit),
+    m_idleTimeoutMs(idleTimeoutMs)
+{
+    unsigned cores = std::thread::hardware_concurrency();
+    m_shardsCount = (std::max)(1u, (std::min)((std::min)(cores, MAX_SHARDS_COUNT), m_maxPoolSize));
+    m_nextEvictionMs = NowMs() + static_cast<int64_t>(m_idleTimeoutMs);
+    AWS_LOGSTREAM_INFO(CURL_HANDLE_POOL_TAG, "Initializing CurlHandlePool with size " << maxSize << " and " << m_shardsCount << " shards per endpoint.");
+}
+
+CurlHandlePool::~CurlHandlePool()
+{
+    AWS_LOGSTREAM_INFO(CURL_HANDLE_POOL_TAG, "Cleaning up CurlHandlePool.");
+    for (auto& entry : m_hostPools)
+    {
+        CurlHandleHostPool* hostPool = entry.second;
+        if (hostPool->leasedHandles > 0)
+        {
+            AWS_LOGSTREAM_ERROR(CURL_HANDLE_POOL_TAG, hostPool->leasedHandles.load() << " handles are still leased for " << hostPool->authority
+                << " while the pool is destroyed.");
+        }
+        for (auto& shard : hostPool->idleShards)
+        {
+            for (uint32_t slotIndex = shard.idleSlots.PopAll(); slotIndex != EMPTY_SLOT_INDEX; slotIndex = hostPool->slots[slotIndex].next)
+            {
+                AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Cleaning up " << hostPool->slots[slotIndex].handle);
+                curl_easy_cleanup(hostPool->slots[slotIndex].handle);
+            }
+        }
+        Aws::Delete(hostPool);
+    }
+    m_hostPools.clear();
+}
+
+CURL* CurlHandlePool::AcquireCurlHandle(const URI& uri)
+{
+    CurlHandleHostPool* hostPool = GetOrCreateHostPool(uri);
+    EvictIdleCurlHandlesIfDue();
+
+    CURL* handle = AcquireCurlHandle(hostPool);
+    hostPool->lastAcquiredMs = NowMs();
+    --hostPool->acquirers;
+    return handle;
+}
+
+CURL* CurlHandlePool::AcquireCurlHandle(CurlHandleHostPool* hostPool)
+{
+    unsigned shard = GetShardIndex(m_shardsCount);
+    for (;;)
+    {
+        // Read before looking for a handle, so that one released meanwhile keeps this thread from going to sleep.
+        uint64_t handleEvents = m_handleEvents.load();
+        uint32_t slotIndex = hostPool->PopIdleSlot(shard);
+        if (slotIndex != EMPTY_SLOT_INDEX)
+        {
+            ++hostPool->leasedHandles;
+            --hostPool->idleHandles;
+            ++hostPool->handlesReused;
+            CURL* handle = hostPool->slots[slotIndex].handle;
+            AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Reusing connection handle " << handle << " for " << hostPool->authority);
+            return handle;
+        }
+
+        if (TryReserveHandle())
+        {
+            return CreateCurlHandle(hostPool);
+        }
+
+        if (EvictIdleHandleOfOtherHost(hostPool))
+        {
+            continue;
+        }
+
+        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Pool is at max size " << m_maxPoolSize << ", waiting for a connection to be released.");
+        WaitForAvailableHandle(handleEvents);
+    }
+}
+
+void CurlHandlePool::ReleaseCurlHandle(CURL* handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    char* privateData = nullptr;
+    curl_easy_getinfo(handle, CURLINFO_PRIVATE, &privateData);
+    CurlHandleSlot* slot = reinterpret_cast<CurlHandleSlot*>(privateData);
+    if (!slot || slot->handle != handle)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_HANDLE_POOL_TAG, "Released handle " << handle << " does not belong to the pool, cleaning it up.");
+        curl_easy_cleanup(handle);
+        return;
+    }
+
+    curl_easy_reset(handle);
+    SetDefaultOptionsOnHandle(handle, slot);
+    slot->lastReleasedMs = NowMs();
+
+    CurlHandleHostPool* hostPool = slot->hostPool;
+    // Counted before the push so the counters never go below the number of poppable handles,
+    // and before the handle stops being leased so the endpoint is never seen without handles meanwhile.
+    ++hostPool->idleHandles;
+    --hostPool->leasedHandles;
+    hostPool->idleShards[GetShardIndex(m_shardsCount)].idleSlots.Push(hostPool->slots.data(), slot->index);
+    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Releasing curl handle " << handle);
+
+    NotifyWaiters();
+}
+
+void CurlHandlePool::DestroyCurlHandle(CURL* handle)
+{
+    if (!handle)
+    {
+        return;
+    }
+
+    char* privateData = nullptr;
+    curl_easy_getinfo(handle, CURLINFO_PRIVATE, &privateData);
+    CurlHandleSlot* slot = reinterpret_cast<CurlHandleSlot*>(privateData);
+    curl_easy_cleanup(handle);
+    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Destroy curl handle: " << handle);
+    if (!slot || slot->handle != handle)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_HANDLE_POOL_TAG, "Destroyed handle " << handle << " does not belong to the pool.");
+        return;
+    }
+
+    CurlHandleHostPool* hostPool = slot->hostPool;
+    slot->handle = nullptr;
+    hostPool->freeSlots.Push(hostPool->slots.data(), slot->index);
+    // Last access to the endpoint, it may be removed as soon as it has no handle left.
+    --hostPool->leasedHandles;
+    --m_handlesCount;
+
+    NotifyWaiters();
+}
+
+size_t CurlHandlePool::EvictIdleCurlHandles()
+{
+    if (m_idleTimeoutMs == 0)
+    {
+        return 0;
+    }
+
+    int64_t evictBeforeMs = NowMs() - static_cast<int64_t>(m_idleTimeoutMs);
+    size_t evictedCount = 0;
+    size_t detachedTotal = 0;
+    bool hasUnusedHostPools = false;
+    Aws::Vector<uint32_t> keptSlots;
+    ReaderLockGuard guard(m_hostPoolsLock);
+    for (auto& entry : m_hostPools)
+    {
+        CurlHandleHostPool* hostPool = entry.second;
+        for (auto& shard : hostPool->idleShards)
+        {
+            keptSlots.clear();
+            uint32_t slotIndex = shard.idleSlots.PopAll();
+            // The detached handles can't be acquired, they stop counting as idle until they are pushed back.
+            size_t detachedCount = 0;
+            for (uint32_t index = slotIndex; index != EMPTY_SLOT_INDEX; index = hostPool->slots[index].next)
+            {
+                ++detachedCount;
+            }
+            hostPool->idleHandles -= detachedCount;
+            detachedTotal += detachedCount;
+
+            while (slotIndex != EMPTY_SLOT_INDEX)
+            {
+                uint32_t nextIndex = hostPool->slots[slotIndex].next;
+                if (hostPool->slots[slotIndex].lastReleasedMs <= evictBeforeMs)
+                {
+                    CloseIdleCurlHandle(hostPool, slotIndex);
+                    ++evictedCount;
+                }
+                else
+                {
+                    keptSlots.push_back(slotIndex);
+                }
+                slotIndex = nextIndex;
+            }
+
+            // Pushed back bottom first so the most recently released handle stays on top.
+            hostPool->idleHandles += keptSlots.size();
+            for (auto it = keptSlots.rbegin(); it != keptSlots.rend(); ++it)
+            {
+                shard.idleSlots.Push(hostPool->slots.data(), *it);
+            }
+        }
+        hasUnusedHostPools = hasUnusedHostPools || hostPool->IsUnusedSince(evictBeforeMs);
+    }
+
+    if (evictedCount > 0)
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Evicted " << evictedCount << " idle connection handles.");
+    }
+    if (detachedTotal > 0)
+    {
+        // Waiters that missed the detached handles may now reuse the kept ones, or take the room of the evicted ones.
+        NotifyWaiters(true /*notifyAll*/);
+    }
+    if (hasUnusedHostPools)
+    {
+        guard.UpgradeToWriterLock();
+        RemoveUnusedHostPools(evictBeforeMs);
+    }
+    return evictedCount;
+}
+
+Aws::Vector<CurlHandlePoolHostMetrics> CurlHandlePool::GetPoolMetrics() const
+{
+    Aws::Vector<CurlHandlePoolHostMetrics> metrics;
+    ReaderLockGuard guard(m_hostPoolsLock);
+    for (const auto& entry : m_hostPools)
+    {
+        const CurlHandleHostPool* hostPool = entry.second;
+        CurlHandlePoolHostMetrics hostMetrics;
+        hostMetrics.endpoint = hostPool->endpoint;
+        hostMetrics.idleHandles = hostPool->idleHandles;
+        hostMetrics.leasedHandles = hostPool->leasedHandles;
+        hostMetrics.handlesCreated = hostPool->handlesCreated;
+        hostMetrics.handlesReused = hostPool->handlesReused;
+        hostMetrics.handlesEvicted = hostPool->handlesEvicted;
+        metrics.push_back(hostMetrics);
+    }
+    return metrics;
+}
+
+CurlHandleHostPool* CurlHandlePool::GetOrCreateHostPool(const URI& uri)
+{
+    Aws::String endpoint = GetEndpoint(uri);
+    {
+        ReaderLockGuard guard(m_hostPoolsLock);
+        auto found = m_hostPools.find(endpoint);
+        if (found != m_hostPools.end())
+        {
+            ++found->second->acquirers;
+            return found->second;
+        }
+    }
+
+    // Another thread may have added the endpoint since the lookup.
+    WriterLockGuard guard(m_hostPoolsLock);
+    CurlHandleHostPool*& hostPool = m_hostPools[endpoint];
+    if (!hostPool)
+    {
+        hostPool = Aws::New<CurlHandleHostPool>(CURL_HANDLE_POOL_TAG, uri, endpoint, m_maxPoolSize, m_shardsCount);
+        AWS_LOGSTREAM_INFO(CURL_HANDLE_POOL_TAG, "Created connection pool for " << endpoint);
+    }
+    ++hostPool->acquirers;
+    return hostPool;
+}
+
+void CurlHandlePool::RemoveUnusedHostPools(int64_t unusedSinceMs)
+{
+    for (auto it = m_hostPools.begin(); it != m_hostPools.end();)
+    {
+        if (it->second->IsUnusedSince(unusedSinceMs))
+        {
+            AWS_LOGSTREAM_INFO(CURL_HANDLE_POOL_TAG, "Removing unused connection pool for " << it->first);
+            Aws::Delete(it->second);
+            it = m_hostPools.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+CURL* CurlHandlePool::CreateCurlHandle(CurlHandleHostPool* hostPool)
+{
+    CURL* handle = curl_easy_init();
+    if (!handle)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_HANDLE_POOL_TAG, "curl_easy_init failed to allocate.");
+        --m_handlesCount;
+        NotifyWaiters();
+        return nullptr;
+    }
+
+    // The reservation caps the live handles of an endpoint to its number of slots, so one is always available.
+    uint32_t slotIndex = hostPool->freeSlots.Pop(hostPool->slots.data());
+    if (slotIndex == EMPTY_SLOT_INDEX)
+    {
+        slotIndex = hostPool->nextUnusedSlot++;
+    }
+
+    CurlHandleSlot& slot = hostPool->slots[slotIndex];
+    slot.handle = handle;
+    SetDefaultOptionsOnHandle(handle, &slot);
+    ++hostPool->leasedHandles;
+    ++hostPool->handlesCreated;
+    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Created connection handle " << handle << " for " << hostPool->authority);
+    return handle;
+}
+
+void CurlHandlePool::CloseIdleCurlHandle(CurlHandleHostPool* hostPool, uint32_t slotIndex)
+{
+    CurlHandleSlot& slot = hostPool->slots[slotIndex];
+    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_POOL_TAG, "Closing idle connection handle " << slot.handle << " for " << hostPool->authority);
+    curl_easy_cleanup(slot.handle);
+    slot.handle = nullptr;
+    ++hostPool->handlesEvicted;
+    hostPool->freeSlots.Push(hostPool->slots.data(), slotIndex);
+    --m_handlesCount;
+}
+
+bool CurlHandlePool::TryReserveHandle()
+{
+    unsigned handlesCount = m_handlesCount.load();
+    while (handlesCount < m_maxPoolSize)
+    {
+        if (m_handlesCount.compare_exchange_weak(handlesCount, handlesCount + 1))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CurlHandlePool::EvictIdleHandleOfOtherHost(const CurlHandleHostPool* hostPool)
+{
+    unsigned shard = GetShardIndex(m_shardsCount);
+    ReaderLockGuard guard(m_hostPoolsLock);
+    for (auto& entry : m_hostPools)
+    {
+        CurlHandleHostPool* otherHostPool = entry.second;
+        if (otherHostPool == hostPool)
+        {
+            continue;
+        }
+
+        uint32_t slotIndex = otherHostPool->PopIdleSlot(shard);
+        if (slotIndex != EMPTY_SLOT_INDEX)
+        {
+            --otherHostPool->idleHandles;
+            CloseIdleCurlHandle(otherHostPool, slotIndex);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CurlHandlePool::EvictIdleCurlHandlesIfDue()
+{
+    if (m_idleTimeoutMs == 0)
+    {
+        return;
+    }
+
+    int64_t nowMs = NowMs();
+    int64_t nextEvictionMs = m_nextEvictionMs.load(std::memory_order_relaxed);
+    // Only the thread that moves the deadline forward runs the sweep.
+    if (nowMs >= nextEvictionMs &&
+        m_nextEvictionMs.compare_exchange_strong(nextEvictionMs, nowMs + (std::max)(static_cast<int64_t>(m_idleTimeoutMs / 2), int64_t(1))))
+    {
+        EvictIdleCurlHandles();
+    }
+}
+
+void CurlHandlePool::WaitForAvailableHandle(uint64_t observedHandleEvents)
+{
+    std::unique_lock<std::mutex> locker(m_waitersLock);
+    ++m_waitersCount;
+    // Re-checked after registering as a waiter, a handle released in between would otherwise never signal us.
+    m_handleAvailableSignal.wait(locker, [this, observedHandleEvents] { return m_handleEvents.load() != observedHandleEvents; });
+    --m_waitersCount;
+}
+
+void CurlHandlePool::NotifyWaiters(bool notifyAll)
+{
+    ++m_handleEvents;
+    if (m_waitersCount.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_waitersLock);
+        if (notifyAll)
+        {
+            m_handleAvailableSignal.notify_all();
+        }
+        else
+        {
+            m_handleAvailableSignal.notify_one();
+        }
+    }
+}
+
+void CurlHandlePool::SetDefaultOptionsOnHandle(CURL* handle, void* slot)
+{
+    m_handleOptions.ApplyTo(handle);
+    curl_easy_setopt(handle, CURLOPT_PRIVATE, slot);
+}
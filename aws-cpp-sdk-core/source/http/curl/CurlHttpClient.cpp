@@ -9,9 +9,12 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/stream/ResponseBodyStream.h>
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
 #include <cassert>
+#include <cctype>
+#include <cstring>
 #include <algorithm>
 
 
@@ -120,40 +123,6 @@ static char* strdup_callback(const char* str)
 
 #endif
 
-struct CurlWriteCallbackContext
-{
-    CurlWriteCallbackContext(const CurlHttpClient* client,
-                             HttpRequest* request,
-                             HttpResponse* response,
-                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
-        m_client(client),
-        m_request(request),
-        m_response(response),
-        m_rateLimiter(rateLimiter),
-        m_numBytesResponseReceived(0)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-    HttpResponse* m_response;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-    int64_t m_numBytesResponseReceived;
-};
-
-struct CurlReadCallbackContext
-{
-    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
-        m_client(client),
-        m_rateLimiter(limiter),
-        m_request(request)
-    {}
-
-    const CurlHttpClient* m_client;
-    CURL* m_curlHandle;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-    HttpRequest* m_request;
-};
-
 static const char* CURL_HTTP_CLIENT_TAG = "CurlHttpClient";
 
 static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
@@ -175,6 +144,16 @@ static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
             context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
         }
 
+        if (context->m_numBytesResponseReceived == 0 && response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+        {
+            // Sizes the body once, rather than growing it chunk by chunk.
+            long long contentLength = StringUtils::ConvertToInt64(response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER).c_str());
+            if (contentLength > 0)
+            {
+                Aws::Utils::Stream::ResponseBodyStream::ReserveIfBuffered(response->GetResponseBody(), static_cast<uint64_t>(contentLength));
+            }
+        }
+
         response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
         if (context->m_request->IsEventStreamRequest())
         {
@@ -197,18 +176,29 @@ static size_t WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
     if (ptr)
     {
+        const size_t length = size * nmemb;
         CurlWriteCallbackContext* context = reinterpret_cast<CurlWriteCallbackContext*>(userdata);
-        AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, ptr);
+        AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, Aws::String(ptr, length));
         HttpResponse* response = context->m_response;
-        Aws::String headerLine(ptr);
-        Aws::Vector<Aws::String> keyValuePair = StringUtils::Split(headerLine, ':', 2);
 
-        if (keyValuePair.size() == 2)
+        // The header line isn't null terminated, its name and value are sliced out of curl's buffer and only copied once stored.
+        const char* separator = static_cast<const char*>(memchr(ptr, ':', length));
+        if (separator)
+        {
+            response->AddHeader(ptr, separator - ptr, separator + 1, ptr + length - (separator + 1));
+        }
+        else if (length >= 12 && strncmp(ptr, "HTTP/", 5) == 0)
         {
-            response->AddHeader(StringUtils::Trim(keyValuePair[0].c_str()), StringUtils::Trim(keyValuePair[1].c_str()));
+            // The status line, e.g. "HTTP/1.1 200 OK". Setting the code before the body arrives lets the data received handlers
+            // tell an error body apart, it is set again once the transfer completes.
+            const char* code = static_cast<const char*>(memchr(ptr, ' ', length));
+            if (code && ptr + length - code > 3 && isdigit(static_cast<unsigned char>(code[1])) && isdigit(static_cast<unsigned char>(code[2])) && isdigit(static_cast<unsigned char>(code[3])))
+            {
+                response->SetResponseCode(static_cast<HttpResponseCode>((code[1] - '0') * 100 + (code[2] - '0') * 10 + (code[3] - '0')));
+            }
         }
 
-        return size * nmemb;
+        return length;
     }
     return 0;
 }
@@ -441,8 +431,8 @@ int CurlDebugCallback(CURL *handle, curl_infotype type, char *data, size_t size,
 
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     Base(),
-    m_curlHandleContainer(clientConfig.maxConnections, clientConfig.httpRequestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.enableTcpKeepAlive,
-                          clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit),
+    m_curlHandlePool(clientConfig.maxConnections, clientConfig.httpRequestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.enableTcpKeepAlive,
+                     clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit, clientConfig.idleConnectionTimeoutMs),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyScheme(SchemeMapper::ToString(clientConfig.proxyScheme)), m_proxyHost(clientConfig.proxyHost),
     m_proxySSLCertPath(clientConfig.proxySSLCertPath), m_proxySSLCertType(clientConfig.proxySSLCertType),
@@ -475,37 +465,78 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
     std::shared_ptr<HttpResponse> response = Aws::MakeShared<StandardHttpResponse>(CURL_HTTP_CLIENT_TAG, request);
 
     AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Making request to " << url);
-    struct curl_slist* headers = NULL;
 
     if (writeLimiter != nullptr)
     {
         writeLimiter->ApplyAndPayForCost(request->GetSize());
     }
 
-    Aws::StringStream headerStream;
-    HeaderValueCollection requestHeaders = request->GetHeaders();
+    struct curl_slist* headers = CreateCurlHeaderList(*request);
+
+    CURL* connectionHandle = m_curlHandlePool.AcquireCurlHandle(uri);
+
+    if (connectionHandle)
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
+
+        CurlWriteCallbackContext writeContext(this, request.get(), response.get(), readLimiter);
+        CurlReadCallbackContext readContext(this, request.get(), writeLimiter);
+
+        SetOptionsOnConnectionHandle(connectionHandle, request, url, headers, writeContext, readContext);
+
+        OverrideOptionsOnConnectionHandle(connectionHandle);
+        Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
+        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+        ProcessTransferResult(connectionHandle, curlResponseCode, request, response, writeContext);
+
+        if (curlResponseCode != CURLE_OK)
+        {
+            m_curlHandlePool.DestroyCurlHandle(connectionHandle);
+        }
+        else
+        {
+            m_curlHandlePool.ReleaseCurlHandle(connectionHandle);
+        }
+        //go ahead and flush the response body stream
+        response->GetResponseBody().flush();
+        request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - startTransmissionTime).count());
+    }
+
+    if (headers)
+    {
+        curl_slist_free_all(headers);
+    }
+
+    return response;
+}
+
+struct curl_slist* CurlHttpClient::CreateCurlHeaderList(const HttpRequest& request) const
+{
+    struct curl_slist* headers = NULL;
+
+    Aws::String headerString;
 
     AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Including headers:");
-    for (auto& requestHeader : requestHeaders)
+    request.VisitHeaders([&](const char* name, size_t nameLength, const Aws::String& value)
     {
-        headerStream.str("");
-        headerStream << requestHeader.first << ": " << requestHeader.second;
-        Aws::String headerString = headerStream.str();
+        headerString.assign(name, nameLength);
+        headerString.append(": ");
+        headerString.append(value);
         AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, headerString);
         headers = curl_slist_append(headers, headerString.c_str());
-    }
+    });
 
-    if (!request->HasHeader(Http::TRANSFER_ENCODING_HEADER))
+    if (!request.HasHeader(Http::TRANSFER_ENCODING_HEADER))
     {
         headers = curl_slist_append(headers, "transfer-encoding:");
     }
 
-    if (!request->HasHeader(Http::CONTENT_LENGTH_HEADER))
+    if (!request.HasHeader(Http::CONTENT_LENGTH_HEADER))
     {
         headers = curl_slist_append(headers, "content-length:");
     }
 
-    if (!request->HasHeader(Http::CONTENT_TYPE_HEADER))
+    if (!request.HasHeader(Http::CONTENT_TYPE_HEADER))
     {
         headers = curl_slist_append(headers, "content-type:");
     }
@@ -516,217 +547,196 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
         headers = curl_slist_append(headers, "Expect:");
     }
 
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    return headers;
+}
 
-    if (connectionHandle)
+void CurlHttpClient::SetOptionsOnConnectionHandle(CURL* connectionHandle, const std::shared_ptr<HttpRequest>& request, const Aws::String& url,
+    struct curl_slist* headers, CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const
+{
+    if (headers)
     {
-        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
-
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
-
-        CurlWriteCallbackContext writeContext(this, request.get(), response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, request.get(), writeLimiter);
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        SetOptCodeForHttpMethod(connectionHandle, request);
+    SetOptCodeForHttpMethod(connectionHandle, request);
 
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, &writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, WriteData);
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, &writeContext);
 
-        //we only want to override the default path if someone has explicitly told us to.
-        if(!m_caPath.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
-        }
-        if(!m_caFile.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
-        }
+    //we only want to override the default path if someone has explicitly told us to.
+    if(!m_caPath.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+    }
+    if(!m_caFile.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
+    }
 
-	// only set by android test builds because the emulator is missing a cert needed for aws services
+// only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
-	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
+    curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
 
-        if (m_enableHttpClientTrace)
+    if (m_enableHttpClientTrace)
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Activating CURL traces");
+        curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
+        curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
+    }
+
+    if (m_isUsingProxy)
+    {
+        Aws::StringStream ss;
+        ss << m_proxyScheme << "://" << m_proxyHost;
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        if (!m_proxyUserName.empty() || !m_proxyPassword.empty())
         {
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Activating CURL traces");
-            curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
-            curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
         }
-
-        if (m_isUsingProxy)
+#ifdef CURL_HAS_TLS_PROXY
+        if (!m_proxySSLCertPath.empty())
         {
-            Aws::StringStream ss;
-            ss << m_proxyScheme << "://" << m_proxyHost;
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            if (!m_proxyUserName.empty() || !m_proxyPassword.empty())
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERT, m_proxySSLCertPath.c_str());
+            if (!m_proxySSLCertType.empty())
             {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERTTYPE, m_proxySSLCertType.c_str());
             }
-#ifdef CURL_HAS_TLS_PROXY
-            if (!m_proxySSLCertPath.empty())
+        }
+        if (!m_proxySSLKeyPath.empty())
+        {
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEY, m_proxySSLKeyPath.c_str());
+            if (!m_proxySSLKeyType.empty())
             {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERT, m_proxySSLCertPath.c_str());
-                if (!m_proxySSLCertType.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERTTYPE, m_proxySSLCertType.c_str());
-                }
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEYTYPE, m_proxySSLKeyType.c_str());
             }
-            if (!m_proxySSLKeyPath.empty())
+            if (!m_proxyKeyPasswd.empty())
             {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEY, m_proxySSLKeyPath.c_str());
-                if (!m_proxySSLKeyType.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEYTYPE, m_proxySSLKeyType.c_str());
-                }
-                if (!m_proxyKeyPasswd.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_KEYPASSWD, m_proxyKeyPasswd.c_str());
-                }
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_KEYPASSWD, m_proxyKeyPasswd.c_str());
             }
-#endif //CURL_HAS_TLS_PROXY
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
         }
+#endif //CURL_HAS_TLS_PROXY
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
+    }
 
-        if (request->GetContentBody())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, SeekBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
-        }
+    if (request->GetContentBody())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, ReadBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
+        curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, SeekBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
+    }
+}
 
-        OverrideOptionsOnConnectionHandle(connectionHandle);
-        Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
-        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
-        bool shouldContinueRequest = ContinueRequest(*request);
-        if (curlResponseCode != CURLE_OK && shouldContinueRequest)
-        {
-            response->SetClientErrorType(CoreErrors::NETWORK_CONNECTION);
-            Aws::StringStream ss;
-            ss << "curlCode: " << curlResponseCode << ", " << curl_easy_strerror(curlResponseCode);
-            response->SetClientErrorMessage(ss.str());
-            AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
-                    << " - " << curl_easy_strerror(curlResponseCode));
-        }
-        else if(!shouldContinueRequest)
+void CurlHttpClient::ProcessTransferResult(CURL* connectionHandle, CURLcode curlResponseCode, const std::shared_ptr<HttpRequest>& request,
+    const std::shared_ptr<HttpResponse>& response, const CurlWriteCallbackContext& writeContext) const
+{
+    bool shouldContinueRequest = ContinueRequest(*request);
+    if (curlResponseCode != CURLE_OK && shouldContinueRequest)
+    {
+        response->SetClientErrorType(CoreErrors::NETWORK_CONNECTION);
+        Aws::StringStream ss;
+        ss << "curlCode: " << curlResponseCode << ", " << curl_easy_strerror(curlResponseCode);
+        response->SetClientErrorMessage(ss.str());
+        AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
+                << " - " << curl_easy_strerror(curlResponseCode));
+    }
+    else if(!shouldContinueRequest)
+    {
+        response->SetClientErrorType(CoreErrors::USER_CANCELLED);
+        response->SetClientErrorMessage("Request cancelled by user's continuation handler");
+    }
+    else
+    {
+        long responseCode;
+        curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+        response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
+
+        char* contentType = nullptr;
+        curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+        if (contentType)
         {
-            response->SetClientErrorType(CoreErrors::USER_CANCELLED);
-            response->SetClientErrorMessage("Request cancelled by user's continuation handler");
+            response->SetContentType(contentType);
+            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
         }
-        else
-        {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
-            {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
-            }
 
-            if (request->GetMethod() != HttpMethod::HTTP_HEAD &&
-                writeContext.m_client->IsRequestProcessingEnabled() &&
-                response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+        if (request->GetMethod() != HttpMethod::HTTP_HEAD &&
+            writeContext.m_client->IsRequestProcessingEnabled() &&
+            response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+        {
+            const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
+            int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
+            if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
             {
-                const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
-                int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
-                if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
-                {
-                    response->SetClientErrorType(CoreErrors::NETWORK_CONNECTION);
-                    response->SetClientErrorMessage("Response body length doesn't match the content-length header.");
-                    AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
-                }
+                response->SetClientErrorType(CoreErrors::NETWORK_CONNECTION);
+                response->SetClientErrorMessage("Response body length doesn't match the content-length header.");
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
             }
-
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
-        }
-
-        double timep;
-        CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
-        if (ret == CURLE_OK)
-        {
-            request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
         }
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency
-        if (ret == CURLE_OK)
-        {
-            request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
-        }
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
+    }
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
-        if (ret == CURLE_OK)
-        {
-            request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
-        }
+    double timep;
+    CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
+    if (ret == CURLE_OK)
+    {
+        request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
+    }
 
-        const char* ip = nullptr;
-        auto curlGetInfoResult = curl_easy_getinfo(connectionHandle, CURLINFO_PRIMARY_IP, &ip); // Get the IP address of the remote endpoint
-        if (curlGetInfoResult == CURLE_OK && ip)
-        {
-            request->SetResolvedRemoteHost(ip);
-        }
-        if (curlResponseCode != CURLE_OK)
-        {
-            m_curlHandleContainer.DestroyCurlHandle(connectionHandle);
-        }
-        else
-        {
-            m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
-        }
-        //go ahead and flush the response body stream
-        response->GetResponseBody().flush();
-        request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - startTransmissionTime).count());
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency
+    if (ret == CURLE_OK)
+    {
+        request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
     }
 
-    if (headers)
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
+    if (ret == CURLE_OK)
     {
-        curl_slist_free_all(headers);
+        request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
     }
 
-    return response;
+    const char* ip = nullptr;
+    auto curlGetInfoResult = curl_easy_getinfo(connectionHandle, CURLINFO_PRIMARY_IP, &ip); // Get the IP address of the remote endpoint
+    if (curlGetInfoResult == CURLE_OK && ip)
+    {
+        request->SetResolvedRemoteHost(ip);
+    }
 }
@@ -0,0 +1,623 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/monitoring/HttpClientMetrics.h>
+
+#include <algorithm>
+#include <future>
+#include <cassert>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+using namespace Aws::Monitoring;
+
+static const char* CURL_MULTI_HTTP_CLIENT_TAG = "CurlMultiHttpClient";
+#if defined(__linux__)
+static const int MAX_EVENTS_PER_WAIT = 64;
+#else
+// Without an explicit wake up mechanism, bounds the delay before newly queued transfers are picked up.
+static const int MAX_WAIT_TIME_MS = 100;
+#endif
+
+namespace Aws
+{
+namespace Http
+{
+    /**
+     * Everything a single transfer needs while it is owned by the event loop.
+     */
+    struct CurlMultiTransfer
+    {
+        CurlMultiTransfer(const CurlHttpClient* client,
+                          const std::shared_ptr<HttpRequest>& request,
+                          const std::shared_ptr<HttpResponse>& response,
+                          const HttpResponseReceivedHandler& handler,
+                          Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                          Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) :
+            m_request(request),
+            m_response(response),
+            m_handler(handler),
+            m_writeContext(client, request.get(), response.get(), readLimiter),
+            m_readContext(client, request.get(), writeLimiter),
+            m_url(request->GetUri().GetURIString()),
+            m_headers(nullptr),
+            m_handle(nullptr)
+        {}
+
+        std::shared_ptr<HttpRequest> m_request;
+        std::shared_ptr<HttpResponse> m_response;
+        HttpResponseReceivedHandler m_handler;
+        CurlWriteCallbackContext m_writeContext;
+        CurlReadCallbackContext m_readContext;
+        Aws::String m_url;
+        struct curl_slist* m_headers;
+        CURL* m_handle;
+        Aws::Utils::DateTime m_startTransmissionTime;
+    };
+} // namespace Http
+} // namespace Aws
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(clientConfig),
+    m_multiHandle(nullptr),
+    m_epollFd(-1),
+    m_wakeUpFd(-1),
+    m_hasTimeout(false),
+    m_inFlightRequests(0),
+    m_continueEventLoop(false),
+    m_maxConnections(clientConfig.maxConnections),
+    m_handleOptions(clientConfig.httpRequestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.enableTcpKeepAlive,
+        clientConfig.tcpKeepAliveIntervalMs, clientConfig.requestTimeoutMs, clientConfig.lowSpeedLimit)
+{
+    m_multiHandle = curl_multi_init();
+    if (!m_multiHandle)
+    {
+        AWS_LOGSTREAM_FATAL(CURL_MULTI_HTTP_CLIENT_TAG, "curl_multi_init failed to allocate, no requests will be made.");
+        return;
+    }
+
+    curl_multi_setopt(m_multiHandle, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(m_maxConnections));
+#ifdef CURL_HAS_H2
+    curl_multi_setopt(m_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+
+#if defined(__linux__)
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeUpFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_epollFd < 0 || m_wakeUpFd < 0)
+    {
+        AWS_LOGSTREAM_FATAL(CURL_MULTI_HTTP_CLIENT_TAG, "Failed to create the event loop descriptors, errno: " << errno);
+        return;
+    }
+
+    epoll_event wakeUpEvent = {};
+    wakeUpEvent.events = EPOLLIN;
+    wakeUpEvent.data.fd = m_wakeUpFd;
+    epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeUpFd, &wakeUpEvent);
+
+    curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETFUNCTION, SocketCallback);
+    curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETDATA, this);
+    curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERFUNCTION, TimerCallback);
+    curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERDATA, this);
+#endif
+
+    AWS_LOGSTREAM_INFO(CURL_MULTI_HTTP_CLIENT_TAG, "Starting event loop with max connections " << m_maxConnections);
+    m_continueEventLoop = true;
+    m_eventLoopThread = std::thread(&CurlMultiHttpClient::EventLoop, this);
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_pendingTransfersLock);
+        m_continueEventLoop = false;
+    }
+    WakeUpEventLoop();
+    if (m_eventLoopThread.joinable())
+    {
+        m_eventLoopThread.join();
+    }
+
+    for (CURL* handle : m_idleEasyHandles)
+    {
+        curl_easy_cleanup(handle);
+    }
+    m_idleEasyHandles.clear();
+
+    if (m_multiHandle)
+    {
+        curl_multi_cleanup(m_multiHandle);
+    }
+
+#if defined(__linux__)
+    if (m_wakeUpFd >= 0)
+    {
+        close(m_wakeUpFd);
+    }
+    if (m_epollFd >= 0)
+    {
+        close(m_epollFd);
+    }
+#endif
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(const std::shared_ptr<HttpRequest>& request,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+    Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    if (std::this_thread::get_id() == m_eventLoopThread.get_id())
+    {
+        AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "Synchronous requests can't be made from the event loop thread, use MakeRequestAsync instead.");
+        assert(false);
+        std::shared_ptr<HttpResponse> response = Aws::MakeShared<StandardHttpResponse>(CURL_MULTI_HTTP_CLIENT_TAG, request);
+        response->SetClientErrorType(CoreErrors::INVALID_PARAMETER_COMBINATION);
+        response->SetClientErrorMessage("Synchronous request made from the http client event loop thread.");
+        return response;
+    }
+
+    std::promise<std::shared_ptr<HttpResponse>> responsePromise;
+    auto responseFuture = responsePromise.get_future();
+    MakeRequestAsync(request, [&responsePromise](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+    {
+        responsePromise.set_value(response);
+    }, readLimiter, writeLimiter);
+
+    return responseFuture.get();
+}
+
+void CurlMultiHttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+    const HttpResponseReceivedHandler& handler,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+    Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    std::shared_ptr<HttpResponse> response = Aws::MakeShared<StandardHttpResponse>(CURL_MULTI_HTTP_CLIENT_TAG, request);
+    CurlMultiTransfer* transfer = Aws::New<CurlMultiTransfer>(CURL_MULTI_HTTP_CLIENT_TAG, this, request, response, handler, readLimiter, writeLimiter);
+
+    AWS_LOGSTREAM_TRACE(CURL_MULTI_HTTP_CLIENT_TAG, "Queueing request to " << transfer->m_url);
+
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request->GetSize());
+    }
+
+    transfer->m_headers = CreateCurlHeaderList(*request);
+    SubmitTransfer(transfer);
+}
+
+void CurlMultiHttpClient::SubmitTransfer(CurlMultiTransfer* transfer) const
+{
+    ++m_inFlightRequests;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingTransfersLock);
+        if (m_continueEventLoop)
+        {
+            m_pendingTransfers.push(transfer);
+            transfer = nullptr;
+        }
+    }
+
+    if (transfer)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "Event loop is not running, failing request to " << transfer->m_url);
+        FailTransfer(transfer, CoreErrors::NETWORK_CONNECTION, "Http client event loop is not running.");
+        return;
+    }
+
+    WakeUpEventLoop();
+}
+
+void CurlMultiHttpClient::ScheduleAfter(std::chrono::milliseconds delay, const std::function<void()>& callback)
+{
+    if (!callback)
+    {
+        return;
+    }
+
+    bool scheduled = false;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingTransfersLock);
+        if (m_continueEventLoop && IsRequestProcessingEnabled())
+        {
+            m_timers.emplace(std::chrono::steady_clock::now() + delay, callback);
+            scheduled = true;
+        }
+    }
+
+    if (!scheduled)
+    {
+        callback();
+        return;
+    }
+    WakeUpEventLoop();
+}
+
+void CurlMultiHttpClient::DisableRequestProcessing()
+{
+    Base::DisableRequestProcessing();
+    WakeUpEventLoop();
+}
+
+void CurlMultiHttpClient::WakeUpEventLoop() const
+{
+#if defined(__linux__)
+    if (m_wakeUpFd >= 0)
+    {
+        uint64_t value = 1;
+        // The counter saturating only means a wake up is already pending.
+        ssize_t written = write(m_wakeUpFd, &value, sizeof(value));
+        AWS_UNREFERENCED_PARAM(written);
+    }
+#endif
+}
+
+void CurlMultiHttpClient::EventLoop()
+{
+    AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Event loop started.");
+    while (m_continueEventLoop)
+    {
+        StartPendingTransfers();
+        WaitForEvents();
+        ProcessCompletedTransfers();
+        RunDueTimers(!IsRequestProcessingEnabled());
+    }
+    AbortAllTransfers();
+    RunDueTimers(true);
+    AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Event loop stopped.");
+}
+
+#if defined(__linux__)
+void CurlMultiHttpClient::WaitForEvents()
+{
+    bool hasDeadline = m_hasTimeout;
+    std::chrono::steady_clock::time_point deadline = m_timeoutDeadline;
+    std::chrono::steady_clock::time_point timerDeadline;
+    if (GetNextTimerDeadline(timerDeadline) && (!hasDeadline || timerDeadline < deadline))
+    {
+        hasDeadline = true;
+        deadline = timerDeadline;
+    }
+
+    int timeoutMs = -1;
+    if (hasDeadline)
+    {
+        auto now = std::chrono::steady_clock::now();
+        timeoutMs = now >= deadline ? 0 :
+            static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) + 1;
+    }
+
+    epoll_event events[MAX_EVENTS_PER_WAIT];
+    int eventsCount = epoll_wait(m_epollFd, events, MAX_EVENTS_PER_WAIT, timeoutMs);
+    if (eventsCount < 0 && errno != EINTR)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "epoll_wait failed with errno: " << errno);
+    }
+
+    int runningHandles = 0;
+    for (int i = 0; i < eventsCount; ++i)
+    {
+        if (events[i].data.fd == m_wakeUpFd)
+        {
+            uint64_t value = 0;
+            while (read(m_wakeUpFd, &value, sizeof(value)) > 0);
+            continue;
+        }
+
+        int flags = 0;
+        if (events[i].events & EPOLLIN)
+        {
+            flags |= CURL_CSELECT_IN;
+        }
+        if (events[i].events & EPOLLOUT)
+        {
+            flags |= CURL_CSELECT_OUT;
+        }
+        if (events[i].events & (EPOLLERR | EPOLLHUP))
+        {
+            flags |= CURL_CSELECT_ERR;
+        }
+        curl_multi_socket_action(m_multiHandle, events[i].data.fd, flags, &runningHandles);
+    }
+
+    // Serviced separately from the wait result, busy sockets must not starve curl's timers.
+    if (m_hasTimeout && std::chrono::steady_clock::now() >= m_timeoutDeadline)
+    {
+        m_hasTimeout = false;
+        curl_multi_socket_action(m_multiHandle, CURL_SOCKET_TIMEOUT, 0, &runningHandles);
+    }
+}
+
+int CurlMultiHttpClient::SocketCallback(CURL* easyHandle, curl_socket_t socket, int what, void* userp, void* socketp)
+{
+    AWS_UNREFERENCED_PARAM(easyHandle);
+    CurlMultiHttpClient* client = static_cast<CurlMultiHttpClient*>(userp);
+
+    if (what == CURL_POLL_REMOVE)
+    {
+        // The socket may already be closed, in which case epoll has dropped it on its own.
+        epoll_ctl(client->m_epollFd, EPOLL_CTL_DEL, socket, nullptr);
+        curl_multi_assign(client->m_multiHandle, socket, nullptr);
+        return 0;
+    }
+
+    epoll_event socketEvent = {};
+    socketEvent.data.fd = socket;
+    uint32_t events = 0;
+    if (what & CURL_POLL_IN)
+    {
+        events |= static_cast<uint32_t>(EPOLLIN);
+    }
+    if (what & CURL_POLL_OUT)
+    {
+        events |= static_cast<uint32_t>(EPOLLOUT);
+    }
+    socketEvent.events = events;
+
+    // socketp is only set once the socket has been registered with epoll.
+    if (epoll_ctl(client->m_epollFd, socketp ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, socket, &socketEvent) != 0)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "Failed to watch socket " << socket << ", errno: " << errno);
+        return -1;
+    }
+    if (!socketp)
+    {
+        curl_multi_assign(client->m_multiHandle, socket, client);
+    }
+    return 0;
+}
+
+int CurlMultiHttpClient::TimerCallback(CURLM* multiHandle, long timeoutMs, void* userp)
+{
+    AWS_UNREFERENCED_PARAM(multiHandle);
+    CurlMultiHttpClient* client = static_cast<CurlMultiHttpClient*>(userp);
+    if (timeoutMs < 0)
+    {
+        client->m_hasTimeout = false;
+    }
+    else
+    {
+        client->m_hasTimeout = true;
+        client->m_timeoutDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    }
+    return 0;
+}
+#else
+void CurlMultiHttpClient::WaitForEvents()
+{
+    int timeoutMs = MAX_WAIT_TIME_MS;
+    std::chrono::steady_clock::time_point timerDeadline;
+    if (GetNextTimerDeadline(timerDeadline))
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto timerMs = now >= timerDeadline ? 0 :
+            static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(timerDeadline - now).count()) + 1;
+        timeoutMs = (std::min)(timeoutMs, timerMs);
+    }
+
+    int runningHandles = 0;
+    curl_multi_perform(m_multiHandle, &runningHandles);
+    int numFds = 0;
+    curl_multi_wait(m_multiHandle, nullptr, 0, timeoutMs, &numFds);
+    curl_multi_perform(m_multiHandle, &runningHandles);
+}
+
+int CurlMultiHttpClient::SocketCallback(CURL*, curl_socket_t, int, void*, void*)
+{
+    return 0;
+}
+
+int CurlMultiHttpClient::TimerCallback(CURLM*, long, void*)
+{
+    return 0;
+}
+#endif
+
+void CurlMultiHttpClient::StartPendingTransfers()
+{
+    Aws::Queue<CurlMultiTransfer*> transfers;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingTransfersLock);
+        transfers.swap(m_pendingTransfers);
+    }
+
+    while (!transfers.empty())
+    {
+        CurlMultiTransfer* transfer = transfers.front();
+        transfers.pop();
+
+        CURL* connectionHandle = m_multiHandle ? AcquireEasyHandle() : nullptr;
+        if (!connectionHandle)
+        {
+            FailTransfer(transfer, CoreErrors::NETWORK_CONNECTION, "Failed to allocate a curl handle for the request.");
+            continue;
+        }
+
+        AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Starting transfer to " << transfer->m_url << " on handle " << connectionHandle);
+        transfer->m_handle = connectionHandle;
+        SetOptionsOnConnectionHandle(connectionHandle, transfer->m_request, transfer->m_url, transfer->m_headers,
+            transfer->m_writeContext, transfer->m_readContext);
+        curl_easy_setopt(connectionHandle, CURLOPT_PRIVATE, transfer);
+        OverrideOptionsOnConnectionHandle(connectionHandle);
+
+        transfer->m_startTransmissionTime = DateTime::Now();
+        CURLMcode multiCode = curl_multi_add_handle(m_multiHandle, connectionHandle);
+        if (multiCode != CURLM_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "curl_multi_add_handle returned error code " << multiCode
+                << " - " << curl_multi_strerror(multiCode));
+            curl_easy_cleanup(connectionHandle);
+            transfer->m_handle = nullptr;
+            FailTransfer(transfer, CoreErrors::NETWORK_CONNECTION, curl_multi_strerror(multiCode));
+            continue;
+        }
+        m_runningTransfers.insert(transfer);
+    }
+}
+
+void CurlMultiHttpClient::ProcessCompletedTransfers()
+{
+    int messagesLeft = 0;
+    while (CURLMsg* message = curl_multi_info_read(m_multiHandle, &messagesLeft))
+    {
+        if (message->msg != CURLMSG_DONE)
+        {
+            continue;
+        }
+
+        // message is invalidated by curl_multi_remove_handle.
+        CURL* connectionHandle = message->easy_handle;
+        CURLcode curlResponseCode = message->data.result;
+
+        char* privateData = nullptr;
+        curl_easy_getinfo(connectionHandle, CURLINFO_PRIVATE, &privateData);
+        curl_multi_remove_handle(m_multiHandle, connectionHandle);
+
+        CompleteTransfer(reinterpret_cast<CurlMultiTransfer*>(privateData), curlResponseCode);
+    }
+}
+
+bool CurlMultiHttpClient::GetNextTimerDeadline(std::chrono::steady_clock::time_point& deadline) const
+{
+    std::lock_guard<std::mutex> locker(m_pendingTransfersLock);
+    if (m_timers.empty())
+    {
+        return false;
+    }
+    deadline = m_timers.begin()->first;
+    return true;
+}
+
+void CurlMultiHttpClient::RunDueTimers(bool runAll)
+{
+    Aws::Vector<std::function<void()>> dueCallbacks;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingTransfersLock);
+        auto dueEnd = runAll ? m_timers.end() : m_timers.upper_bound(std::chrono::steady_clock::now());
+        for (auto timerIter = m_timers.begin(); timerIter != dueEnd; ++timerIter)
+        {
+            dueCallbacks.push_back(std::move(timerIter->second));
+        }
+        m_timers.erase(m_timers.begin(), dueEnd);
+    }
+
+    // Called without the lock, they usually submit a request or schedule another callback.
+    for (auto& callback : dueCallbacks)
+    {
+        callback();
+    }
+}
+
+void CurlMultiHttpClient::CompleteTransfer(CurlMultiTransfer* transfer, CURLcode curlResponseCode)
+{
+    m_runningTransfers.erase(transfer);
+
+    CURL* connectionHandle = transfer->m_handle;
+    ProcessTransferResult(connectionHandle, curlResponseCode, transfer->m_request, transfer->m_response, transfer->m_writeContext);
+
+    // The multi handle owns the connection cache, idle easy handles are only kept to avoid reallocating them.
+    if (curlResponseCode == CURLE_OK && m_idleEasyHandles.size() < m_maxConnections)
+    {
+        curl_easy_reset(connectionHandle);
+        m_handleOptions.ApplyTo(connectionHandle);
+        m_idleEasyHandles.push_back(connectionHandle);
+    }
+    else
+    {
+        curl_easy_cleanup(connectionHandle);
+    }
+    transfer->m_handle = nullptr;
+
+    //go ahead and flush the response body stream
+    transfer->m_response->GetResponseBody().flush();
+    transfer->m_request->AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency),
+        (DateTime::Now() - transfer->m_startTransmissionTime).count());
+
+    FinishTransfer(transfer);
+}
+
+void CurlMultiHttpClient::FailTransfer(CurlMultiTransfer* transfer, CoreErrors errorType, const char* message) const
+{
+    transfer->m_response->SetClientErrorType(errorType);
+    transfer->m_response->SetClientErrorMessage(message);
+    FinishTransfer(transfer);
+}
+
+void CurlMultiHttpClient::FinishTransfer(CurlMultiTransfer* transfer) const
+{
+    if (transfer->m_headers)
+    {
+        curl_slist_free_all(transfer->m_headers);
+    }
+
+    std::shared_ptr<HttpRequest> request = std::move(transfer->m_request);
+    std::shared_ptr<HttpResponse> response = std::move(transfer->m_response);
+    HttpResponseReceivedHandler handler = std::move(transfer->m_handler);
+    Aws::Delete(transfer);
+    --m_inFlightRequests;
+
+    if (handler)
+    {
+        handler(request, response);
+    }
+}
+
+void CurlMultiHttpClient::AbortAllTransfers()
+{
+    for (CurlMultiTransfer* transfer : m_runningTransfers)
+    {
+        curl_multi_remove_handle(m_multiHandle, transfer->m_handle);
+        curl_easy_cleanup(transfer->m_handle);
+        transfer->m_handle = nullptr;
+        FailTransfer(transfer, CoreErrors::USER_CANCELLED, "Http client was shut down before the request completed.");
+    }
+    m_runningTransfers.clear();
+
+    Aws::Queue<CurlMultiTransfer*> transfers;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingTransfersLock);
+        transfers.swap(m_pendingTransfers);
+    }
+    while (!transfers.empty())
+    {
+        FailTransfer(transfers.front(), CoreErrors::USER_CANCELLED, "Http client was shut down before the request started.");
+        transfers.pop();
+    }
+}
+
+CURL* CurlMultiHttpClient::AcquireEasyHandle()
+{
+    if (!m_idleEasyHandles.empty())
+    {
+        CURL* connectionHandle = m_idleEasyHandles.back();
+        m_idleEasyHandles.pop_back();
+        return connectionHandle;
+    }
+
+    CURL* connectionHandle = curl_easy_init();
+    if (connectionHandle)
+    {
+        m_handleOptions.ApplyTo(connectionHandle);
+    }
+    else
+    {
+        AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "curl_easy_init failed to allocate.");
+    }
+    return connectionHandle;
+}
@@ -47,48 +47,41 @@ StandardHttpRequest::StandardHttpRequest(const URI& uri, HttpMethod method) :
 
 HeaderValueCollection StandardHttpRequest::GetHeaders() const
 {
-    HeaderValueCollection headers;
-
-    for (HeaderValueCollection::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
-    {
-        headers.emplace(HeaderValuePair(iter->first, iter->second));
-    }
-
-    return headers;
+    return headerMap.ToCollection();
 }
 
 const Aws::String& StandardHttpRequest::GetHeaderValue(const char* headerName) const
 {
-    auto iter = headerMap.find(headerName);
-    assert (iter != headerMap.end());
-    return iter->second;
+    const Aws::String* headerValue = headerMap.Find(headerName);
+    assert (headerValue);
+    return headerValue ? *headerValue : m_emptyHeader;
 }
 
 void StandardHttpRequest::SetHeaderValue(const char* headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName)] = StringUtils::Trim(headerValue.c_str());
+    headerMap.Set(headerName, headerValue);
 }
 
 void StandardHttpRequest::SetHeaderValue(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = StringUtils::Trim(headerValue.c_str());
+    headerMap.Set(headerName.c_str(), headerName.size(), headerValue.c_str(), headerValue.size());
 }
 
 void StandardHttpRequest::DeleteHeader(const char* headerName)
 {
-    headerMap.erase(StringUtils::ToLower(headerName));
+    headerMap.Erase(headerName);
 }
 
 bool StandardHttpRequest::HasHeader(const char* headerName) const
 {
-    return headerMap.find(StringUtils::ToLower(headerName)) != headerMap.end();
+    return headerMap.Has(headerName);
 }
 
 int64_t StandardHttpRequest::GetSize() const
 {
     int64_t size = 0;
 
-    std::for_each(headerMap.cbegin(), headerMap.cend(), [&](const HeaderValueCollection::value_type& kvPair){ size += kvPair.first.length(); size += kvPair.second.length(); });
+    std::for_each(headerMap.begin(), headerMap.end(), [&](const HttpHeaders::Header& header){ size += header.GetNameLength(); size += header.GetValue().length(); });
 
     return size;
 }
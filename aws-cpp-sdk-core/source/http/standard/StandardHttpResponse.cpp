@@ -17,30 +17,27 @@ using namespace Aws::Utils;
 
 HeaderValueCollection StandardHttpResponse::GetHeaders() const
 {
-    HeaderValueCollection headerValueCollection;
-
-    for (Aws::Map<Aws::String, Aws::String>::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
-    {
-        headerValueCollection.emplace(HeaderValuePair(iter->first, iter->second));
-    }
-
-    return headerValueCollection;
+    return headerMap.ToCollection();
 }
 
 bool StandardHttpResponse::HasHeader(const char* headerName) const
 {
-    return headerMap.find(StringUtils::ToLower(headerName)) != headerMap.end();
+    return headerMap.Has(headerName);
 }
 
 const Aws::String& StandardHttpResponse::GetHeader(const Aws::String& headerName) const
 {
-    Aws::Map<Aws::String, Aws::String>::const_iterator foundValue = headerMap.find(StringUtils::ToLower(headerName.c_str()));
-    return foundValue->second;
+    static const Aws::String emptyHeader;
+    const Aws::String* headerValue = headerMap.Find(headerName.c_str(), headerName.size());
+    return headerValue ? *headerValue : emptyHeader;
 }
 
 void StandardHttpResponse::AddHeader(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = headerValue;
+    headerMap.Set(headerName.c_str(), headerName.size(), headerValue.c_str(), headerValue.size());
 }
 
-
+void StandardHttpResponse::AddHeader(const char* headerName, size_t headerNameLength, const char* headerValue, size_t headerValueLength)
+{
+    headerMap.Set(headerName, headerNameLength, headerValue, headerValueLength);
+}
@@ -10,6 +10,8 @@
 
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <cerrno>
 #include <dirent.h>
 #include <cassert>
@@ -242,6 +244,43 @@ Aws::UniquePtr<Directory> OpenDirectory(const Aws::String& path, const Aws::Stri
     return Aws::MakeUnique<AndroidDirectory>(FILE_SYSTEM_UTILS_LOG_TAG, path, relativePath);
 }
 
+MappedFile::MappedFile(const Aws::String& path) : m_data(nullptr), m_size(0), m_mappingHandle(nullptr)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not open " << path << " to map it, error code: " << errno);
+        return;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0 && static_cast<uint64_t>(fileStat.st_size) <= SIZE_MAX)
+    {
+        void* data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            m_data = static_cast<const unsigned char*>(data);
+            m_size = static_cast<uint64_t>(fileStat.st_size);
+            // Parts of the file are usually read once, front to back.
+            madvise(data, static_cast<size_t>(m_size), MADV_SEQUENTIAL);
+        }
+        else
+        {
+            AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not map " << path << ", error code: " << errno);
+        }
+    }
+    // The mapping holds its own reference to the file.
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        munmap(const_cast<unsigned char*>(m_data), static_cast<size_t>(m_size));
+    }
+}
+
 } // namespace FileSystem
 } // namespace Aws
 
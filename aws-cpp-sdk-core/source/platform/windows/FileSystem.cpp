@@ -332,5 +332,47 @@ Aws::UniquePtr<Directory> OpenDirectory(const Aws::String& path, const Aws::Stri
     return Aws::MakeUnique<User32Directory>(FILE_SYSTEM_UTILS_LOG_TAG, path, relativePath);
 }
 
+MappedFile::MappedFile(const Aws::String& path) : m_data(nullptr), m_size(0), m_mappingHandle(nullptr)
+{
+    HANDLE file = CreateFileW(ToLongPath(StringUtils::ToWString(path.c_str())).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not open " << path << " to map it, error code: " << GetLastError());
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 && static_cast<uint64_t>(fileSize.QuadPart) <= SIZE_MAX)
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (data)
+        {
+            m_data = static_cast<const unsigned char*>(data);
+            m_size = static_cast<uint64_t>(fileSize.QuadPart);
+            m_mappingHandle = mapping;
+        }
+        else
+        {
+            AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Could not map " << path << ", error code: " << GetLastError());
+            if (mapping)
+            {
+                CloseHandle(mapping);
+            }
+        }
+    }
+    // The mapping holds its own reference to the file.
+    CloseHandle(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mappingHandle);
+    }
+}
+
 } // namespace FileSystem
 } // namespace Aws
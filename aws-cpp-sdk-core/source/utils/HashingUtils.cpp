@@ -10,6 +10,7 @@
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 #include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/CRC32.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/memory/stl/AWSList.h>
@@ -221,6 +222,186 @@ ByteBuffer HashingUtils::CalculateMD5(Aws::IOStream& stream)
     return hash.Calculate(stream).GetResult();
 }
 
+ByteBuffer HashingUtils::CalculateCRC32(const Aws::String& str)
+{
+    CRC32 hash;
+    return hash.Calculate(str).GetResult();
+}
+
+ByteBuffer HashingUtils::CalculateCRC32(Aws::IOStream& stream)
+{
+    CRC32 hash;
+    return hash.Calculate(stream).GetResult();
+}
+
+ByteBuffer HashingUtils::CalculateCRC32C(const Aws::String& str)
+{
+    CRC32C hash;
+    return hash.Calculate(str).GetResult();
+}
+
+ByteBuffer HashingUtils::CalculateCRC32C(Aws::IOStream& stream)
+{
+    CRC32C hash;
+    return hash.Calculate(stream).GetResult();
+}
+
+/**
+ * These functions are only used by HashingUtils::CombineCRC32() and CombineCRC32C() in this cpp file.
+ * Appending n zero bits to the data is a linear operation on its crc, a 32x32 matrix over GF(2), the matrix for 2^k zero
+ * bytes is the square of the one for 2^(k-1), and appending the second block xors its crc in. This is the method of zlib's crc32_combine.
+ */
+static uint32_t GF2MatrixTimes(const uint32_t* matrix, uint32_t vector)
+{
+    uint32_t sum = 0;
+    for (; vector; vector >>= 1, ++matrix)
+    {
+        if (vector & 1)
+        {
+            sum ^= *matrix;
+        }
+    }
+    return sum;
+}
+
+static void GF2MatrixSquare(uint32_t* square, const uint32_t* matrix)
+{
+    for (int n = 0; n < 32; ++n)
+    {
+        square[n] = GF2MatrixTimes(matrix, matrix[n]);
+    }
+}
+
+static uint32_t CombineCRC(uint32_t reversedPolynomial, uint32_t first, uint32_t second, uint64_t secondLength)
+{
+    if (secondLength == 0)
+    {
+        return first;
+    }
+
+    uint32_t even[32];
+    uint32_t odd[32];
+
+    // Operator for one zero bit.
+    odd[0] = reversedPolynomial;
+    uint32_t row = 1;
+    for (int n = 1; n < 32; ++n)
+    {
+        odd[n] = row;
+        row <<= 1;
+    }
+
+    // Operators for two and four zero bits.
+    GF2MatrixSquare(even, odd);
+    GF2MatrixSquare(odd, even);
+
+    // Applies secondLength zero bytes to first, the first squaring gives the operator for one zero byte.
+    do
+    {
+        GF2MatrixSquare(even, odd);
+        if (secondLength & 1)
+        {
+            first = GF2MatrixTimes(even, first);
+        }
+        secondLength >>= 1;
+        if (secondLength == 0)
+        {
+            break;
+        }
+
+        GF2MatrixSquare(odd, even);
+        if (secondLength & 1)
+        {
+            first = GF2MatrixTimes(odd, first);
+        }
+        secondLength >>= 1;
+    } while (secondLength != 0);
+
+    return first ^ second;
+}
+
+static uint32_t FromBigEndianBytes(const ByteBuffer& buffer)
+{
+    if (buffer.GetLength() != 4)
+    {
+        return 0;
+    }
+    return (static_cast<uint32_t>(buffer[0]) << 24) | (static_cast<uint32_t>(buffer[1]) << 16) |
+        (static_cast<uint32_t>(buffer[2]) << 8) | static_cast<uint32_t>(buffer[3]);
+}
+
+static ByteBuffer ToBigEndianBytes(uint32_t crc)
+{
+    ByteBuffer result(4);
+    result[0] = static_cast<unsigned char>(crc >> 24);
+    result[1] = static_cast<unsigned char>(crc >> 16);
+    result[2] = static_cast<unsigned char>(crc >> 8);
+    result[3] = static_cast<unsigned char>(crc);
+    return result;
+}
+
+ByteBuffer HashingUtils::CombineCRC32(const ByteBuffer& first, const ByteBuffer& second, uint64_t secondLength)
+{
+    return ToBigEndianBytes(CombineCRC(0xEDB88320, FromBigEndianBytes(first), FromBigEndianBytes(second), secondLength));
+}
+
+ByteBuffer HashingUtils::CombineCRC32C(const ByteBuffer& first, const ByteBuffer& second, uint64_t secondLength)
+{
+    return ToBigEndianBytes(CombineCRC(0x82F63B78, FromBigEndianBytes(first), FromBigEndianBytes(second), secondLength));
+}
+
+Aws::Vector<ByteBuffer> HashingUtils::CalculateHashes(Aws::IStream& stream, const Aws::Vector<std::shared_ptr<Hash>>& hashes)
+{
+    auto currentPos = stream.tellg();
+    if (currentPos == -1)
+    {
+        currentPos = 0;
+        stream.clear();
+    }
+    stream.seekg(0, stream.beg);
+
+    unsigned char streamBuffer[Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+    while (stream.good())
+    {
+        stream.read(reinterpret_cast<char*>(streamBuffer), Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+        auto bytesRead = stream.gcount();
+
+        if (bytesRead > 0)
+        {
+            for (const auto& hash : hashes)
+            {
+                hash->Update(streamBuffer, static_cast<size_t>(bytesRead));
+            }
+        }
+    }
+
+    bool readToEnd = stream.eof();
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    Aws::Vector<ByteBuffer> digests;
+    digests.reserve(hashes.size());
+    bool hashed = true;
+    for (const auto& hash : hashes)
+    {
+        // Finish every digest even on failure, so that the hashes can be reused.
+        auto digest = hash->GetHash();
+        hashed = hashed && digest.IsSuccess();
+        digests.push_back(digest.GetResultWithOwnership());
+    }
+    if (!readToEnd)
+    {
+        AWS_LOGSTREAM_ERROR("HashingUtils", "Failed to read the stream to its end while hashing it.");
+        return {};
+    }
+    if (!hashed)
+    {
+        AWS_LOGSTREAM_ERROR("HashingUtils", "Failed to hash the stream incrementally.");
+        return {};
+    }
+    return digests;
+}
+
 int HashingUtils::HashString(const char* strToHash)
 {
     if (!strToHash)
@@ -0,0 +1,127 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/checksums/crc.h>
+
+#include <climits>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+typedef uint32_t (*CRCFunction)(const uint8_t* input, int length, uint32_t previousCrc);
+
+// aws-checksums takes an int length.
+static uint32_t UpdateCRC(CRCFunction crcFunction, const unsigned char* buffer, size_t bufferSize, uint32_t runningCrc)
+{
+    while (bufferSize > 0)
+    {
+        int length = bufferSize > static_cast<size_t>(INT_MAX) ? INT_MAX : static_cast<int>(bufferSize);
+        runningCrc = crcFunction(buffer, length, runningCrc);
+        buffer += length;
+        bufferSize -= length;
+    }
+    return runningCrc;
+}
+
+static ByteBuffer ToBigEndianBytes(uint32_t crc)
+{
+    ByteBuffer result(4);
+    result[0] = static_cast<unsigned char>(crc >> 24);
+    result[1] = static_cast<unsigned char>(crc >> 16);
+    result[2] = static_cast<unsigned char>(crc >> 8);
+    result[3] = static_cast<unsigned char>(crc);
+    return result;
+}
+
+static HashResult CalculateCRC(CRCFunction crcFunction, const Aws::String& str)
+{
+    return HashResult(ToBigEndianBytes(UpdateCRC(crcFunction, reinterpret_cast<const unsigned char*>(str.c_str()), str.size(), 0)));
+}
+
+static HashResult CalculateCRC(CRCFunction crcFunction, Aws::IStream& stream)
+{
+    uint32_t crc = 0;
+
+    auto currentPos = stream.tellg();
+    if (currentPos == -1)
+    {
+        currentPos = 0;
+        stream.clear();
+    }
+    stream.seekg(0, stream.beg);
+
+    char streamBuffer[Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+    while (stream.good())
+    {
+        stream.read(streamBuffer, Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+        auto bytesRead = stream.gcount();
+
+        if (bytesRead > 0)
+        {
+            crc = UpdateCRC(crcFunction, reinterpret_cast<unsigned char*>(streamBuffer), static_cast<size_t>(bytesRead), crc);
+        }
+    }
+
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    return HashResult(ToBigEndianBytes(crc));
+}
+
+CRC32::CRC32() :
+    m_runningCrc(0)
+{
+}
+
+HashResult CRC32::Calculate(const Aws::String& str)
+{
+    return CalculateCRC(aws_checksums_crc32, str);
+}
+
+HashResult CRC32::Calculate(Aws::IStream& stream)
+{
+    return CalculateCRC(aws_checksums_crc32, stream);
+}
+
+void CRC32::Update(unsigned char* buffer, size_t bufferSize)
+{
+    m_runningCrc = UpdateCRC(aws_checksums_crc32, buffer, bufferSize, m_runningCrc);
+}
+
+HashResult CRC32::GetHash()
+{
+    auto result = ToBigEndianBytes(m_runningCrc);
+    m_runningCrc = 0;
+    return HashResult(std::move(result));
+}
+
+CRC32C::CRC32C() :
+    m_runningCrc(0)
+{
+}
+
+HashResult CRC32C::Calculate(const Aws::String& str)
+{
+    return CalculateCRC(aws_checksums_crc32c, str);
+}
+
+HashResult CRC32C::Calculate(Aws::IStream& stream)
+{
+    return CalculateCRC(aws_checksums_crc32c, stream);
+}
+
+void CRC32C::Update(unsigned char* buffer, size_t bufferSize)
+{
+    m_runningCrc = UpdateCRC(aws_checksums_crc32c, buffer, bufferSize, m_runningCrc);
+}
+
+HashResult CRC32C::GetHash()
+{
+    auto result = ToBigEndianBytes(m_runningCrc);
+    m_runningCrc = 0;
+    return HashResult(std::move(result));
+}
@@ -0,0 +1,27 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/Outcome.h>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Crypto
+{
+
+void Hash::Update(unsigned char*, size_t)
+{
+}
+
+HashResult Hash::GetHash()
+{
+    return HashResult();
+}
+
+} // namespace Crypto
+} // namespace Utils
+} // namespace Aws
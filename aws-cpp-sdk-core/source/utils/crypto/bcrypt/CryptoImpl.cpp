@@ -121,6 +121,8 @@ namespace Aws
                 m_hashBuffer(nullptr),
                 m_hashObjectLength(0),
                 m_hashObject(nullptr),
+                m_incrementalHashHandle(nullptr),
+                m_incrementalHashFailed(false),
                 m_algorithmMutex()
             {
                 NTSTATUS status = BCryptOpenAlgorithmProvider(&m_algorithmHandle, algorithmName, MS_PRIMITIVE_PROVIDER, isHMAC ? BCRYPT_ALG_HANDLE_HMAC_FLAG : 0);
@@ -163,6 +165,11 @@ namespace Aws
 
             BCryptHashImpl::~BCryptHashImpl()
             {
+                if (m_incrementalHashHandle)
+                {
+                    BCryptDestroyHash(m_incrementalHashHandle);
+                }
+
                 Aws::DeleteArray(m_hashObject);
                 Aws::DeleteArray(m_hashBuffer);
 
@@ -303,6 +310,85 @@ namespace Aws
                 return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
             }
 
+            void BCryptHashImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                if (!IsValid())
+                {
+                    return;
+                }
+
+                std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+                if (m_incrementalHashFailed)
+                {
+                    return;
+                }
+
+                if (!m_incrementalHashHandle)
+                {
+                    NTSTATUS status = BCryptCreateHash(m_algorithmHandle, &m_incrementalHashHandle, nullptr, 0, nullptr, 0, 0);
+                    if (!NT_SUCCESS(status))
+                    {
+                        AWS_LOGSTREAM_ERROR(logTag, "Error creating hash handle.");
+                        m_incrementalHashHandle = nullptr;
+                        m_incrementalHashFailed = true;
+                        return;
+                    }
+                }
+
+                NTSTATUS status = BCryptHashData(m_incrementalHashHandle, buffer, static_cast<ULONG>(bufferSize), 0);
+                if (!NT_SUCCESS(status))
+                {
+                    AWS_LOGSTREAM_ERROR(logTag, "Error computing hash.");
+                    m_incrementalHashFailed = true;
+                }
+            }
+
+            HashResult BCryptHashImpl::GetHash()
+            {
+                if (!IsValid())
+                {
+                    return HashResult();
+                }
+
+                std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+                bool failed = m_incrementalHashFailed;
+                m_incrementalHashFailed = false;
+                if (failed)
+                {
+                    if (m_incrementalHashHandle)
+                    {
+                        BCryptDestroyHash(m_incrementalHashHandle);
+                        m_incrementalHashHandle = nullptr;
+                    }
+                    return HashResult();
+                }
+
+                if (!m_incrementalHashHandle)
+                {
+                    //nothing was added, this is the digest of no data.
+                    BCryptHashContext context(m_algorithmHandle, m_hashObject, m_hashObjectLength);
+                    if (!context.IsValid())
+                    {
+                        AWS_LOGSTREAM_ERROR(logTag, "Error creating hash handle.");
+                        return HashResult();
+                    }
+                    return HashData(context, nullptr, 0);
+                }
+
+                NTSTATUS status = BCryptFinishHash(m_incrementalHashHandle, m_hashBuffer, m_hashBufferLength, 0);
+                BCryptDestroyHash(m_incrementalHashHandle);
+                m_incrementalHashHandle = nullptr;
+                if (!NT_SUCCESS(status))
+                {
+                    AWS_LOGSTREAM_ERROR(logTag, "Error obtaining computed hash");
+                    return HashResult();
+                }
+
+                return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
+            }
+
             MD5BcryptImpl::MD5BcryptImpl() :
                 m_impl(BCRYPT_MD5_ALGORITHM, false)
             {
@@ -318,6 +404,16 @@ namespace Aws
                 return m_impl.Calculate(stream);
             }
 
+            void MD5BcryptImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                m_impl.Update(buffer, bufferSize);
+            }
+
+            HashResult MD5BcryptImpl::GetHash()
+            {
+                return m_impl.GetHash();
+            }
+
             Sha256BcryptImpl::Sha256BcryptImpl() :
                 m_impl(BCRYPT_SHA256_ALGORITHM, false)
             {
@@ -333,6 +429,16 @@ namespace Aws
                 return m_impl.Calculate(stream);
             }
 
+            void Sha256BcryptImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                m_impl.Update(buffer, bufferSize);
+            }
+
+            HashResult Sha256BcryptImpl::GetHash()
+            {
+                return m_impl.GetHash();
+            }
+
             Sha256HMACBcryptImpl::Sha256HMACBcryptImpl() :
                 m_impl(BCRYPT_SHA256_ALGORITHM, true)
             {
@@ -222,6 +222,54 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            MD5OpenSSLImpl::MD5OpenSSLImpl() :
+                m_ctx(nullptr)
+            {
+            }
+
+            MD5OpenSSLImpl::~MD5OpenSSLImpl()
+            {
+                if (m_ctx)
+                {
+                    EVP_MD_CTX_destroy(m_ctx);
+                    m_ctx = nullptr;
+                }
+            }
+
+            void MD5OpenSSLImpl::Init()
+            {
+#if !defined(OPENSSL_IS_BORINGSSL)
+                EVP_MD_CTX_set_flags(m_ctx, EVP_MD_CTX_FLAG_NON_FIPS_ALLOW);
+#endif
+                EVP_DigestInit_ex(m_ctx, EVP_md5(), nullptr);
+            }
+
+            void MD5OpenSSLImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                // Most instances only ever Calculate, so the context is created on the first Update.
+                if (!m_ctx)
+                {
+                    m_ctx = EVP_MD_CTX_create();
+                    assert(m_ctx != nullptr);
+                    Init();
+                }
+                EVP_DigestUpdate(m_ctx, buffer, bufferSize);
+            }
+
+            HashResult MD5OpenSSLImpl::GetHash()
+            {
+                if (!m_ctx)
+                {
+                    return Calculate(Aws::String());
+                }
+
+                ByteBuffer hash(EVP_MD_size(EVP_md5()));
+                EVP_DigestFinal_ex(m_ctx, hash.GetUnderlyingData(), nullptr);
+                Init();
+
+                return HashResult(std::move(hash));
+            }
+
             HashResult Sha256OpenSSLImpl::Calculate(const Aws::String& str)
             {
                 OpensslCtxRAIIGuard guard;
@@ -272,6 +320,51 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            Sha256OpenSSLImpl::Sha256OpenSSLImpl() :
+                m_ctx(nullptr)
+            {
+            }
+
+            Sha256OpenSSLImpl::~Sha256OpenSSLImpl()
+            {
+                if (m_ctx)
+                {
+                    EVP_MD_CTX_destroy(m_ctx);
+                    m_ctx = nullptr;
+                }
+            }
+
+            void Sha256OpenSSLImpl::Init()
+            {
+                EVP_DigestInit_ex(m_ctx, EVP_sha256(), nullptr);
+            }
+
+            void Sha256OpenSSLImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                // Most instances only ever Calculate, so the context is created on the first Update.
+                if (!m_ctx)
+                {
+                    m_ctx = EVP_MD_CTX_create();
+                    assert(m_ctx != nullptr);
+                    Init();
+                }
+                EVP_DigestUpdate(m_ctx, buffer, bufferSize);
+            }
+
+            HashResult Sha256OpenSSLImpl::GetHash()
+            {
+                if (!m_ctx)
+                {
+                    return Calculate(Aws::String());
+                }
+
+                ByteBuffer hash(EVP_MD_size(EVP_sha256()));
+                EVP_DigestFinal_ex(m_ctx, hash.GetUnderlyingData(), nullptr);
+                Init();
+
+                return HashResult(std::move(hash));
+            }
+
             class HMACRAIIGuard {
             public:
                 HMACRAIIGuard() {
@@ -0,0 +1,830 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+using namespace Aws::Utils::Json;
+
+static const char JSON_READER_TAG[] = "JsonReader";
+// Same limit as cJSON, deeper documents are rejected instead of exhausting the stack.
+static const size_t MAX_NESTING_DEPTH = 1000;
+// Numbers are copied to a null terminated buffer for strtod, JSON numbers of any practical precision fit.
+static const size_t MAX_NUMBER_LENGTH = 64;
+
+static const uint64_t ONES = 0x0101010101010101ULL;
+static const uint64_t HIGHS = 0x8080808080808080ULL;
+
+static inline uint64_t LoadWord(const char* data)
+{
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/**
+ * Returns non zero if any of the 8 bytes of word is a quote, a backslash or a control character,
+ * which lets the string scanner skip plain text 8 bytes at a time.
+ */
+static inline uint64_t HasStringSpecialByte(uint64_t word)
+{
+    uint64_t quotes = word ^ (ONES * '"');
+    uint64_t backslashes = word ^ (ONES * '\\');
+    uint64_t hasQuote = (quotes - ONES) & ~quotes & HIGHS;
+    uint64_t hasBackslash = (backslashes - ONES) & ~backslashes & HIGHS;
+    uint64_t hasControl = (word - ONES * 0x20) & ~word & HIGHS;
+    return hasQuote | hasBackslash | hasControl;
+}
+
+static inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static inline int HexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static void AppendUtf8(Aws::String& out, uint32_t codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+static bool ParseHex4(const char* data, uint32_t& value)
+{
+    value = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        int digit = HexValue(data[i]);
+        if (digit < 0)
+        {
+            return false;
+        }
+        value = (value << 4) | static_cast<uint32_t>(digit);
+    }
+    return true;
+}
+
+/**
+ * Returns the length of the escape sequence starting at the backslash, or 0 if it is not valid JSON.
+ * A high surrogate is only valid when followed by a low surrogate, the pair is then a single sequence.
+ */
+static size_t EscapeSequenceLength(const char* escape, const char* end)
+{
+    if (escape + 1 >= end)
+    {
+        return 0;
+    }
+
+    switch (escape[1])
+    {
+        case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+            return 2;
+        case 'u':
+        {
+            uint32_t codePoint = 0;
+            if (escape + 6 > end || !ParseHex4(escape + 2, codePoint) || (codePoint >= 0xDC00 && codePoint <= 0xDFFF))
+            {
+                return 0;
+            }
+            if (codePoint < 0xD800 || codePoint > 0xDBFF)
+            {
+                return 6;
+            }
+
+            uint32_t lowSurrogate = 0;
+            if (escape + 12 > end || escape[6] != '\\' || escape[7] != 'u' || !ParseHex4(escape + 8, lowSurrogate) ||
+                lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+            {
+                return 0;
+            }
+            return 12;
+        }
+        default:
+            return 0;
+    }
+}
+
+JsonReader::JsonReader() : JsonReader(nullptr, 0)
+{
+}
+
+JsonReader::JsonReader(const char* data, size_t length) :
+    m_begin(data),
+    m_position(data),
+    m_end(data + length),
+    m_keyData(nullptr),
+    m_keyLength(0),
+    m_keyInScratch(false),
+    m_atContainerStart(false),
+    m_valuePending(false)
+{
+}
+
+JsonReader::JsonReader(Aws::IStream& istream) : JsonReader(nullptr, 0)
+{
+    auto text = Aws::MakeShared<Aws::String>(JSON_READER_TAG);
+    auto start = istream.tellg();
+    istream.seekg(0, std::ios_base::end);
+    auto end = istream.tellg();
+    istream.seekg(start);
+    if (start != std::streampos(-1) && end != std::streampos(-1) && end >= start)
+    {
+        text->resize(static_cast<size_t>(end - start));
+        istream.read(&(*text)[0], static_cast<std::streamsize>(text->size()));
+        text->resize(static_cast<size_t>(istream.gcount()));
+    }
+    else
+    {
+        istream.clear();
+        text->assign(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>());
+    }
+
+    m_ownedText = text;
+    m_begin = m_position = m_ownedText->c_str();
+    m_end = m_begin + m_ownedText->size();
+}
+
+JsonReader::JsonReader(Aws::String&& text) : JsonReader(nullptr, 0)
+{
+    m_ownedText = Aws::MakeShared<Aws::String>(JSON_READER_TAG, std::move(text));
+    m_begin = m_position = m_ownedText->c_str();
+    m_end = m_begin + m_ownedText->size();
+}
+
+JsonTokenType JsonReader::Peek()
+{
+    if (!WasParseSuccessful())
+    {
+        return JsonTokenType::Error;
+    }
+
+    SkipWhitespace();
+    if (m_position == m_end)
+    {
+        return JsonTokenType::End;
+    }
+
+    switch (*m_position)
+    {
+        case '{': return JsonTokenType::StartObject;
+        case '}': return JsonTokenType::EndObject;
+        case '[': return JsonTokenType::StartArray;
+        case ']': return JsonTokenType::EndArray;
+        case '"': return JsonTokenType::String;
+        case 't':
+        case 'f': return JsonTokenType::Bool;
+        case 'n': return JsonTokenType::Null;
+        default:
+            return (*m_position == '-' || IsDigit(*m_position)) ? JsonTokenType::Number : JsonTokenType::Error;
+    }
+}
+
+bool JsonReader::StartObject()
+{
+    m_valuePending = false;
+    if (Peek() == JsonTokenType::StartObject)
+    {
+        ++m_position;
+        m_atContainerStart = true;
+        return true;
+    }
+
+    SkipValue();
+    return false;
+}
+
+bool JsonReader::StartArray()
+{
+    m_valuePending = false;
+    if (Peek() == JsonTokenType::StartArray)
+    {
+        ++m_position;
+        m_atContainerStart = true;
+        return true;
+    }
+
+    SkipValue();
+    return false;
+}
+
+bool JsonReader::NextMember()
+{
+    for (;;)
+    {
+        if (!NextEntry('}'))
+        {
+            return false;
+        }
+
+        if (m_position == m_end || *m_position != '"')
+        {
+            SetError("Expected member name");
+            return false;
+        }
+
+        const char* keyEnd = nullptr;
+        bool hasEscapes = false;
+        if (!ScanString(keyEnd, hasEscapes))
+        {
+            return false;
+        }
+
+        m_keyInScratch = hasEscapes;
+        if (hasEscapes)
+        {
+            m_keyScratch.clear();
+            if (!DecodeString(m_position + 1, keyEnd, m_keyScratch))
+            {
+                return false;
+            }
+            m_keyLength = m_keyScratch.size();
+        }
+        else
+        {
+            m_keyData = m_position + 1;
+            m_keyLength = static_cast<size_t>(keyEnd - m_keyData);
+        }
+        m_position = keyEnd + 1;
+
+        SkipWhitespace();
+        if (m_position == m_end || *m_position != ':')
+        {
+            SetError("Expected ':' after member name");
+            return false;
+        }
+        ++m_position;
+        SkipWhitespace();
+
+        if (m_position != m_end && *m_position == 'n')
+        {
+            SkipValue();
+            continue;
+        }
+
+        m_valuePending = true;
+        return true;
+    }
+}
+
+bool JsonReader::NextElement()
+{
+    if (!NextEntry(']'))
+    {
+        return false;
+    }
+
+    m_valuePending = true;
+    return true;
+}
+
+bool JsonReader::NextEntry(char closing)
+{
+    if (!WasParseSuccessful())
+    {
+        return false;
+    }
+
+    if (m_valuePending)
+    {
+        SkipValue();
+        if (!WasParseSuccessful())
+        {
+            return false;
+        }
+    }
+
+    SkipWhitespace();
+    if (m_position == m_end)
+    {
+        SetError("Unexpected end of JSON text");
+        return false;
+    }
+
+    if (*m_position == closing)
+    {
+        ++m_position;
+        m_atContainerStart = false;
+        return false;
+    }
+
+    if (!m_atContainerStart)
+    {
+        if (*m_position != ',')
+        {
+            SetError(closing == '}' ? "Expected ',' or '}'" : "Expected ',' or ']'");
+            return false;
+        }
+        ++m_position;
+        SkipWhitespace();
+    }
+    m_atContainerStart = false;
+    return true;
+}
+
+bool JsonReader::KeyEquals(const char* key) const
+{
+    return strlen(key) == m_keyLength && memcmp(GetKeyData(), key, m_keyLength) == 0;
+}
+
+Aws::String JsonReader::ReadString()
+{
+    m_valuePending = false;
+    if (Peek() != JsonTokenType::String)
+    {
+        SkipValue();
+        return {};
+    }
+
+    const char* end = nullptr;
+    bool hasEscapes = false;
+    if (!ScanString(end, hasEscapes))
+    {
+        return {};
+    }
+
+    Aws::String value;
+    if (hasEscapes)
+    {
+        DecodeString(m_position + 1, end, value);
+    }
+    else
+    {
+        value.assign(m_position + 1, end);
+    }
+    m_position = end + 1;
+    return value;
+}
+
+bool JsonReader::ReadBool()
+{
+    m_valuePending = false;
+    if (Peek() == JsonTokenType::Bool)
+    {
+        bool value = *m_position == 't';
+        if (value ? ExpectLiteral("true", 4) : ExpectLiteral("false", 5))
+        {
+            return value;
+        }
+        return false;
+    }
+
+    SkipValue();
+    return false;
+}
+
+int JsonReader::ReadInteger()
+{
+    double value = 0;
+    int64_t integerValue = 0;
+    bool isInteger = false;
+    if (!ReadNumberToken(value, integerValue, isInteger))
+    {
+        return 0;
+    }
+
+    // Saturates like cJSON's valueint.
+    if (value >= INT_MAX)
+    {
+        return INT_MAX;
+    }
+    if (value <= INT_MIN)
+    {
+        return INT_MIN;
+    }
+    return isInteger ? static_cast<int>(integerValue) : static_cast<int>(value);
+}
+
+int64_t JsonReader::ReadInt64()
+{
+    double value = 0;
+    int64_t integerValue = 0;
+    bool isInteger = false;
+    if (!ReadNumberToken(value, integerValue, isInteger))
+    {
+        return 0;
+    }
+    return isInteger ? integerValue : static_cast<int64_t>(value);
+}
+
+double JsonReader::ReadDouble()
+{
+    double value = 0;
+    int64_t integerValue = 0;
+    bool isInteger = false;
+    ReadNumberToken(value, integerValue, isInteger);
+    return value;
+}
+
+bool JsonReader::ReadNumberToken(double& value, int64_t& integerValue, bool& isInteger)
+{
+    m_valuePending = false;
+    if (Peek() != JsonTokenType::Number)
+    {
+        SkipValue();
+        return false;
+    }
+
+    const char* end = nullptr;
+    if (!ScanNumber(end))
+    {
+        return false;
+    }
+
+    size_t length = static_cast<size_t>(end - m_position);
+    char buffer[MAX_NUMBER_LENGTH];
+    Aws::String longNumber;
+    const char* number = buffer;
+    if (length < MAX_NUMBER_LENGTH)
+    {
+        memcpy(buffer, m_position, length);
+        buffer[length] = '\0';
+    }
+    else
+    {
+        longNumber.assign(m_position, end);
+        number = longNumber.c_str();
+    }
+
+    isInteger = std::find_if(m_position, end, [](char c) { return c == '.' || c == 'e' || c == 'E'; }) == end;
+    value = strtod(number, nullptr);
+    integerValue = isInteger ? strtoll(number, nullptr, 10) : static_cast<int64_t>(value);
+    m_position = end;
+    return true;
+}
+
+JsonValue JsonReader::ReadValue()
+{
+    m_valuePending = false;
+    SkipWhitespace();
+    const char* start = m_position;
+    if (!SkipValueInternal(0))
+    {
+        return JsonValue();
+    }
+    return JsonValue(Aws::String(start, m_position));
+}
+
+void JsonReader::SkipValue()
+{
+    m_valuePending = false;
+    if (WasParseSuccessful())
+    {
+        SkipValueInternal(0);
+    }
+}
+
+bool JsonReader::Validate()
+{
+    m_position = m_begin;
+    if (SkipValueInternal(0))
+    {
+        SkipWhitespace();
+        if (m_position != m_end)
+        {
+            SetError("Unexpected characters after JSON value");
+        }
+    }
+
+    m_position = m_begin;
+    m_atContainerStart = false;
+    m_valuePending = false;
+    return WasParseSuccessful();
+}
+
+void JsonReader::SkipWhitespace()
+{
+    while (m_position != m_end && (*m_position == ' ' || *m_position == '\n' || *m_position == '\r' || *m_position == '\t'))
+    {
+        ++m_position;
+    }
+}
+
+bool JsonReader::ScanString(const char*& end, bool& hasEscapes)
+{
+    hasEscapes = false;
+    const char* current = m_position + 1;
+    while (current < m_end)
+    {
+        while (current + sizeof(uint64_t) <= m_end && !HasStringSpecialByte(LoadWord(current)))
+        {
+            current += sizeof(uint64_t);
+        }
+        if (current >= m_end)
+        {
+            break;
+        }
+
+        unsigned char c = static_cast<unsigned char>(*current);
+        if (c == '"')
+        {
+            end = current;
+            return true;
+        }
+        if (c == '\\')
+        {
+            size_t escapeLength = EscapeSequenceLength(current, m_end);
+            if (escapeLength == 0)
+            {
+                m_position = current;
+                SetError("Invalid escape sequence");
+                return false;
+            }
+            hasEscapes = true;
+            current += escapeLength;
+            continue;
+        }
+        if (c < 0x20)
+        {
+            m_position = current;
+            SetError("Invalid control character in string");
+            return false;
+        }
+        ++current;
+    }
+
+    SetError("Unterminated string");
+    return false;
+}
+
+bool JsonReader::DecodeString(const char* begin, const char* end, Aws::String& decoded)
+{
+    decoded.reserve(decoded.size() + static_cast<size_t>(end - begin));
+    const char* current = begin;
+    while (current < end)
+    {
+        const char* escape = static_cast<const char*>(memchr(current, '\\', static_cast<size_t>(end - current)));
+        if (!escape)
+        {
+            decoded.append(current, end);
+            return true;
+        }
+
+        decoded.append(current, escape);
+        if (escape + 1 >= end)
+        {
+            SetError("Invalid escape sequence");
+            return false;
+        }
+
+        switch (escape[1])
+        {
+            case '"': decoded.push_back('"'); break;
+            case '\\': decoded.push_back('\\'); break;
+            case '/': decoded.push_back('/'); break;
+            case 'b': decoded.push_back('\b'); break;
+            case 'f': decoded.push_back('\f'); break;
+            case 'n': decoded.push_back('\n'); break;
+            case 'r': decoded.push_back('\r'); break;
+            case 't': decoded.push_back('\t'); break;
+            case 'u':
+            {
+                uint32_t codePoint = 0;
+                if (escape + 6 > end || !ParseHex4(escape + 2, codePoint))
+                {
+                    SetError("Invalid unicode escape sequence");
+                    return false;
+                }
+                current = escape + 6;
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                {
+                    uint32_t lowSurrogate = 0;
+                    if (current + 6 > end || current[0] != '\\' || current[1] != 'u' || !ParseHex4(current + 2, lowSurrogate) ||
+                        lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                    {
+                        SetError("Invalid unicode surrogate pair");
+                        return false;
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                    current += 6;
+                }
+                AppendUtf8(decoded, codePoint);
+                continue;
+            }
+            default:
+                SetError("Invalid escape sequence");
+                return false;
+        }
+        current = escape + 2;
+    }
+    return true;
+}
+
+bool JsonReader::ScanNumber(const char*& end)
+{
+    const char* current = m_position;
+    if (current != m_end && *current == '-')
+    {
+        ++current;
+    }
+
+    if (current == m_end || !IsDigit(*current))
+    {
+        SetError("Invalid number");
+        return false;
+    }
+
+    if (*current == '0')
+    {
+        ++current;
+    }
+    else
+    {
+        while (current != m_end && IsDigit(*current)) ++current;
+    }
+
+    if (current != m_end && *current == '.')
+    {
+        ++current;
+        if (current == m_end || !IsDigit(*current))
+        {
+            SetError("Invalid number");
+            return false;
+        }
+        while (current != m_end && IsDigit(*current)) ++current;
+    }
+
+    if (current != m_end && (*current == 'e' || *current == 'E'))
+    {
+        ++current;
+        if (current != m_end && (*current == '+' || *current == '-'))
+        {
+            ++current;
+        }
+        if (current == m_end || !IsDigit(*current))
+        {
+            SetError("Invalid number");
+            return false;
+        }
+        while (current != m_end && IsDigit(*current)) ++current;
+    }
+
+    end = current;
+    return true;
+}
+
+bool JsonReader::ExpectLiteral(const char* literal, size_t length)
+{
+    if (static_cast<size_t>(m_end - m_position) < length || memcmp(m_position, literal, length) != 0)
+    {
+        SetError("Invalid literal");
+        return false;
+    }
+    m_position += length;
+    return true;
+}
+
+bool JsonReader::SkipValueInternal(size_t depth)
+{
+    if (depth > MAX_NESTING_DEPTH)
+    {
+        SetError("Maximum nesting depth exceeded");
+        return false;
+    }
+
+    SkipWhitespace();
+    if (m_position == m_end)
+    {
+        SetError("Unexpected end of JSON text");
+        return false;
+    }
+
+    switch (*m_position)
+    {
+        case '{':
+        case '[':
+        {
+            const char closing = *m_position == '{' ? '}' : ']';
+            ++m_position;
+            SkipWhitespace();
+            if (m_position != m_end && *m_position == closing)
+            {
+                ++m_position;
+                return true;
+            }
+
+            for (;;)
+            {
+                if (closing == '}')
+                {
+                    const char* keyEnd = nullptr;
+                    bool hasEscapes = false;
+                    if (m_position == m_end || *m_position != '"')
+                    {
+                        SetError("Expected member name");
+                        return false;
+                    }
+                    if (!ScanString(keyEnd, hasEscapes))
+                    {
+                        return false;
+                    }
+                    m_position = keyEnd + 1;
+                    SkipWhitespace();
+                    if (m_position == m_end || *m_position != ':')
+                    {
+                        SetError("Expected ':' after member name");
+                        return false;
+                    }
+                    ++m_position;
+                }
+
+                if (!SkipValueInternal(depth + 1))
+                {
+                    return false;
+                }
+
+                SkipWhitespace();
+                if (m_position == m_end)
+                {
+                    SetError("Unexpected end of JSON text");
+                    return false;
+                }
+                if (*m_position == closing)
+                {
+                    ++m_position;
+                    return true;
+                }
+                if (*m_position != ',')
+                {
+                    SetError(closing == '}' ? "Expected ',' or '}'" : "Expected ',' or ']'");
+                    return false;
+                }
+                ++m_position;
+                SkipWhitespace();
+            }
+        }
+        case '"':
+        {
+            const char* end = nullptr;
+            bool hasEscapes = false;
+            if (!ScanString(end, hasEscapes))
+            {
+                return false;
+            }
+            m_position = end + 1;
+            return true;
+        }
+        case 't':
+            return ExpectLiteral("true", 4);
+        case 'f':
+            return ExpectLiteral("false", 5);
+        case 'n':
+            return ExpectLiteral("null", 4);
+        default:
+        {
+            const char* end = nullptr;
+            if (!ScanNumber(end))
+            {
+                return false;
+            }
+            m_position = end;
+            return true;
+        }
+    }
+}
+
+void JsonReader::SetError(const char* message)
+{
+    if (m_errorMessage.empty())
+    {
+        Aws::StringStream ss;
+        ss << message << " at offset " << (m_position - m_begin);
+        m_errorMessage = ss.str();
+    }
+    m_position = m_end;
+}
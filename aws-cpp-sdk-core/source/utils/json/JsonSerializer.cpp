@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/stream/ResponseBodyStream.h>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
@@ -39,11 +40,24 @@ JsonValue::JsonValue(const Aws::String& value) : m_wasParseSuccessful(true)
 
 JsonValue::JsonValue(Aws::IStream& istream) : m_wasParseSuccessful(true)
 {
-    Aws::StringStream memoryStream;
-    std::copy(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>(), std::ostreambuf_iterator<char>(memoryStream));
+    Aws::String input;
+    const char* text = nullptr;
+    Stream::ResponseBodyStream* bodyStream = Stream::ResponseBodyStream::FromStream(istream);
+    if (bodyStream)
+    {
+        // Response bodies are parsed in place rather than copied out of the stream.
+        text = bodyStream->GetBuffer().GetUnreadData();
+    }
+    else
+    {
+        Aws::StringStream memoryStream;
+        std::copy(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>(), std::ostreambuf_iterator<char>(memoryStream));
+        input = memoryStream.str();
+        text = input.c_str();
+    }
+
     const char* return_parse_end;
-    const auto input = memoryStream.str();
-    m_value = cJSON_ParseWithOpts(input.c_str(), &return_parse_end, 1/*require_null_terminated*/);
+    m_value = cJSON_ParseWithOpts(text, &return_parse_end, 1/*require_null_terminated*/);
 
     if (!m_value || cJSON_IsInvalid(m_value))
     {
@@ -51,6 +65,11 @@ JsonValue::JsonValue(Aws::IStream& istream) : m_wasParseSuccessful(true)
         m_errorMessage = "Failed to parse JSON. Invalid input at: ";
         m_errorMessage += return_parse_end;
     }
+
+    if (bodyStream)
+    {
+        bodyStream->GetBuffer().pubseekoff(0, std::ios_base::end, std::ios_base::in);
+    }
 }
 
 JsonValue::JsonValue(const JsonValue& value) :
@@ -0,0 +1,447 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+
+#include <aws/core/utils/logging/BinaryLogSystem.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char* AllocationTag = "BinaryLogSystem";
+// The logging thread writes out the records this often, or as soon as this many bytes are waiting.
+static const std::chrono::milliseconds LOG_THREAD_INTERVAL(100);
+static const size_t BATCH_SIZE = 64 * 1024;
+// Past this many addresses, e.g. with tags built at runtime, the address cache starts over.
+static const size_t MAX_CACHED_ADDRESSES = 4096;
+
+/*
+ * Layout of the log, all integers in the byte order of the host, which the header records:
+ *   header:            "AWSBLOG1", uint32 0x01020304
+ *   string record:     uint8 'S', uint32 id, uint32 length, bytes
+ *   statement record:  uint8 'L', uint8 log level, int64 milliseconds since the epoch, uint64 thread id hash,
+ *                      uint32 tag id, uint32 format id, uint16 argument count, arguments
+ *   argument:          uint8 'i' int64 | 'u' uint64 | 'f' double | 'p' uint64 | 's' uint32 length, bytes
+ * Keep scripts/decode_binary_log.py in sync with it.
+ */
+static const char LOG_MAGIC[] = "AWSBLOG1";
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const char STRING_RECORD = 'S';
+static const char STATEMENT_RECORD = 'L';
+static const char SIGNED_ARGUMENT = 'i';
+static const char UNSIGNED_ARGUMENT = 'u';
+static const char DOUBLE_ARGUMENT = 'f';
+static const char POINTER_ARGUMENT = 'p';
+static const char STRING_ARGUMENT = 's';
+
+template<typename T>
+static void AppendValue(Aws::String& buffer, T value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void AppendBytes(Aws::String& buffer, const char* bytes, size_t length)
+{
+    AppendValue(buffer, static_cast<uint32_t>(length));
+    buffer.append(bytes, length);
+}
+
+static void AppendWideString(Aws::String& buffer, const wchar_t* text)
+{
+    // Only used for %ls, which the SDK doesn't log with. Characters outside of ASCII are replaced rather than converted.
+    Aws::String narrowed;
+    for (; *text; ++text)
+    {
+        narrowed.push_back(static_cast<uint32_t>(*text) < 0x80 ? static_cast<char>(*text) : '?');
+    }
+    AppendBytes(buffer, narrowed.c_str(), narrowed.size());
+}
+
+enum class LengthModifier
+{
+    None,
+    Char,
+    Short,
+    Long,
+    LongLong,
+    IntMax,
+    Size,
+    PtrDiff,
+    LongDouble
+};
+
+static LengthModifier ParseLengthModifier(const char*& spec)
+{
+    switch (*spec)
+    {
+        case 'h':
+            ++spec;
+            if (*spec == 'h')
+            {
+                ++spec;
+                return LengthModifier::Char;
+            }
+            return LengthModifier::Short;
+        case 'l':
+            ++spec;
+            if (*spec == 'l')
+            {
+                ++spec;
+                return LengthModifier::LongLong;
+            }
+            return LengthModifier::Long;
+        case 'q':
+            ++spec;
+            return LengthModifier::LongLong;
+        case 'j':
+            ++spec;
+            return LengthModifier::IntMax;
+        case 'z':
+            ++spec;
+            return LengthModifier::Size;
+        case 't':
+            ++spec;
+            return LengthModifier::PtrDiff;
+        case 'L':
+            ++spec;
+            return LengthModifier::LongDouble;
+        case 'I':
+            // Microsoft sizes: I64, I32 and I, the size of a pointer.
+            ++spec;
+            if (spec[0] == '6' && spec[1] == '4')
+            {
+                spec += 2;
+                return LengthModifier::LongLong;
+            }
+            if (spec[0] == '3' && spec[1] == '2')
+            {
+                spec += 2;
+                return LengthModifier::None;
+            }
+            return LengthModifier::Size;
+        default:
+            return LengthModifier::None;
+    }
+}
+
+static int64_t ReadSigned(va_list& args, LengthModifier length)
+{
+    switch (length)
+    {
+        case LengthModifier::Long: return va_arg(args, long);
+        case LengthModifier::LongLong: return va_arg(args, long long);
+        case LengthModifier::IntMax: return va_arg(args, intmax_t);
+        case LengthModifier::Size: return static_cast<int64_t>(va_arg(args, size_t));
+        case LengthModifier::PtrDiff: return va_arg(args, ptrdiff_t);
+        // char and short are promoted to int.
+        default: return va_arg(args, int);
+    }
+}
+
+static uint64_t ReadUnsigned(va_list& args, LengthModifier length)
+{
+    switch (length)
+    {
+        case LengthModifier::Char: return static_cast<unsigned char>(va_arg(args, unsigned int));
+        case LengthModifier::Short: return static_cast<unsigned short>(va_arg(args, unsigned int));
+        case LengthModifier::Long: return va_arg(args, unsigned long);
+        case LengthModifier::LongLong: return va_arg(args, unsigned long long);
+        case LengthModifier::IntMax: return va_arg(args, uintmax_t);
+        case LengthModifier::Size: return va_arg(args, size_t);
+        case LengthModifier::PtrDiff: return static_cast<uint64_t>(va_arg(args, ptrdiff_t));
+        default: return va_arg(args, unsigned int);
+    }
+}
+
+/**
+ * Appends the arguments formatStr consumes from args, in order, and returns how many there are. Stops at the first conversion it doesn't know
+ * since it can't tell what it consumes, the decoder then stops formatting at the same place.
+ */
+static uint16_t AppendArguments(Aws::String& buffer, const char* formatStr, va_list& args)
+{
+    uint16_t count = 0;
+    for (const char* spec = formatStr; *spec; ++spec)
+    {
+        if (*spec != '%')
+        {
+            continue;
+        }
+
+        ++spec;
+        if (*spec == '%')
+        {
+            continue;
+        }
+
+        while (*spec && strchr("-+ #0'", *spec))
+        {
+            ++spec;
+        }
+
+        if (*spec == '*')
+        {
+            AppendValue(buffer, SIGNED_ARGUMENT);
+            AppendValue(buffer, static_cast<int64_t>(va_arg(args, int)));
+            ++count;
+            ++spec;
+        }
+        while (*spec >= '0' && *spec <= '9')
+        {
+            ++spec;
+        }
+
+        if (*spec == '.')
+        {
+            ++spec;
+            if (*spec == '*')
+            {
+                AppendValue(buffer, SIGNED_ARGUMENT);
+                AppendValue(buffer, static_cast<int64_t>(va_arg(args, int)));
+                ++count;
+                ++spec;
+            }
+            while (*spec >= '0' && *spec <= '9')
+            {
+                ++spec;
+            }
+        }
+
+        LengthModifier length = ParseLengthModifier(spec);
+        switch (*spec)
+        {
+            case 'd':
+            case 'i':
+                AppendValue(buffer, SIGNED_ARGUMENT);
+                AppendValue(buffer, ReadSigned(args, length));
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                AppendValue(buffer, UNSIGNED_ARGUMENT);
+                AppendValue(buffer, ReadUnsigned(args, length));
+                break;
+            case 'c':
+                AppendValue(buffer, UNSIGNED_ARGUMENT);
+                AppendValue(buffer, static_cast<uint64_t>(static_cast<unsigned char>(va_arg(args, int))));
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                AppendValue(buffer, DOUBLE_ARGUMENT);
+                AppendValue(buffer, length == LengthModifier::LongDouble ? static_cast<double>(va_arg(args, long double)) : va_arg(args, double));
+                break;
+            case 's':
+                AppendValue(buffer, STRING_ARGUMENT);
+                if (length == LengthModifier::Long)
+                {
+                    const wchar_t* text = va_arg(args, const wchar_t*);
+                    AppendWideString(buffer, text ? text : L"(null)");
+                }
+                else
+                {
+                    const char* text = va_arg(args, const char*);
+                    text = text ? text : "(null)";
+                    AppendBytes(buffer, text, strlen(text));
+                }
+                break;
+            case 'p':
+                AppendValue(buffer, POINTER_ARGUMENT);
+                AppendValue(buffer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(args, void*))));
+                break;
+            case 'n':
+                // Nothing is written through it since nothing is formatted, the decoder skips it too.
+                va_arg(args, void*);
+                continue;
+            default:
+                return count;
+        }
+        ++count;
+    }
+    return count;
+}
+
+static std::shared_ptr<Aws::OFStream> MakeBinaryLogFile(const Aws::String& filenamePrefix)
+{
+    Aws::String newFileName = filenamePrefix + DateTime::CalculateGmtTimestampAsString("%Y-%m-%d-%H-%M-%S") + ".binlog";
+    return Aws::MakeShared<Aws::OFStream>(AllocationTag, newFileName.c_str(), Aws::OFStream::out | Aws::OFStream::binary | Aws::OFStream::app);
+}
+
+BinaryLogSystem::BinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile) :
+    m_logLevel(logLevel),
+    m_stopLogging(false),
+    m_flushesRequested(0),
+    m_flushesCompleted(0),
+    m_loggingThread()
+{
+    m_pendingRecords.append(LOG_MAGIC, sizeof(LOG_MAGIC) - 1);
+    AppendValue(m_pendingRecords, BYTE_ORDER_MARK);
+    m_loggingThread = std::thread(&BinaryLogSystem::LogThread, this, logFile);
+}
+
+BinaryLogSystem::BinaryLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix) :
+    BinaryLogSystem(logLevel, MakeBinaryLogFile(filenamePrefix))
+{
+}
+
+BinaryLogSystem::~BinaryLogSystem()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_logMutex);
+        m_stopLogging = true;
+    }
+
+    m_signal.notify_all();
+
+    m_loggingThread.join();
+}
+
+void BinaryLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
+{
+    std::va_list args;
+    va_start(args, formatStr);
+
+    bool filledBatch = false;
+    {
+        std::lock_guard<std::mutex> locker(m_logMutex);
+        size_t previousSize = m_pendingRecords.size();
+        AppendStatement(logLevel, tag, formatStr, args);
+        // Only the statement that fills the batch wakes the logging thread up, later ones find it already writing.
+        filledBatch = previousSize < BATCH_SIZE && m_pendingRecords.size() >= BATCH_SIZE;
+    }
+
+    va_end(args);
+
+    if (filledBatch)
+    {
+        m_signal.notify_all();
+    }
+}
+
+void BinaryLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream)
+{
+    Aws::String message = messageStream.str();
+    Log(logLevel, tag, "%s", message.c_str());
+}
+
+void BinaryLogSystem::Flush()
+{
+    std::unique_lock<std::mutex> locker(m_logMutex);
+    uint64_t flush = ++m_flushesRequested;
+    m_signal.notify_all();
+    m_signal.wait(locker, [&](){ return m_flushesCompleted >= flush; });
+}
+
+void BinaryLogSystem::AppendStatement(LogLevel logLevel, const char* tag, const char* formatStr, va_list args)
+{
+    uint32_t tagId = InternString(tag ? tag : "");
+    uint32_t formatId = InternString(formatStr ? formatStr : "");
+
+    AppendValue(m_pendingRecords, STATEMENT_RECORD);
+    AppendValue(m_pendingRecords, static_cast<uint8_t>(logLevel));
+    AppendValue(m_pendingRecords, DateTime::CurrentTimeMillis());
+    AppendValue(m_pendingRecords, static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+    AppendValue(m_pendingRecords, tagId);
+    AppendValue(m_pendingRecords, formatId);
+
+    size_t countPosition = m_pendingRecords.size();
+    AppendValue(m_pendingRecords, static_cast<uint16_t>(0));
+    if (formatStr)
+    {
+        va_list arguments;
+        va_copy(arguments, args);
+        uint16_t count = AppendArguments(m_pendingRecords, formatStr, arguments);
+        va_end(arguments);
+        memcpy(&m_pendingRecords[countPosition], &count, sizeof(count));
+    }
+}
+
+uint32_t BinaryLogSystem::InternString(const char* text)
+{
+    auto byAddress = m_idsByAddress.find(text);
+    // The address may have been reused for other text since, e.g. by a tag built at runtime.
+    if (byAddress != m_idsByAddress.end() && m_strings[byAddress->second] == text)
+    {
+        return byAddress->second;
+    }
+
+    if (m_idsByAddress.size() >= MAX_CACHED_ADDRESSES)
+    {
+        m_idsByAddress.clear();
+    }
+
+    Aws::String content(text);
+    uint32_t id = 0;
+    auto byText = m_idsByText.find(content);
+    if (byText != m_idsByText.end())
+    {
+        id = byText->second;
+    }
+    else
+    {
+        id = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back(content);
+        m_idsByText.emplace(content, id);
+
+        AppendValue(m_pendingRecords, STRING_RECORD);
+        AppendValue(m_pendingRecords, id);
+        AppendBytes(m_pendingRecords, content.c_str(), content.size());
+    }
+
+    m_idsByAddress[text] = id;
+    return id;
+}
+
+void BinaryLogSystem::LogThread(std::shared_ptr<Aws::OStream> logFile)
+{
+    Aws::String records;
+
+    for(;;)
+    {
+        bool stopLogging = false;
+        uint64_t flushes = 0;
+        {
+            std::unique_lock<std::mutex> locker(m_logMutex);
+            m_signal.wait_for(locker, LOG_THREAD_INTERVAL,
+                [&](){ return m_stopLogging || m_flushesRequested != m_flushesCompleted || m_pendingRecords.size() >= BATCH_SIZE; });
+            stopLogging = m_stopLogging;
+            flushes = m_flushesRequested;
+            // Both buffers keep their capacity, so after warming up logging doesn't allocate.
+            records.swap(m_pendingRecords);
+        }
+
+        if (!records.empty())
+        {
+            logFile->write(records.data(), static_cast<std::streamsize>(records.size()));
+            logFile->flush();
+            records.clear();
+        }
+
+        {
+            std::lock_guard<std::mutex> locker(m_logMutex);
+            m_flushesCompleted = flushes;
+        }
+        m_signal.notify_all();
+
+        if (stopLogging)
+        {
+            break;
+        }
+    }
+}
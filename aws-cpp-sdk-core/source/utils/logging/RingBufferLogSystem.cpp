@@ -0,0 +1,541 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+
+#include <aws/core/utils/logging/RingBufferLogSystem.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstring>
+#include <fstream>
+#include <stdio.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char* AllocationTag = "RingBufferLogSystem";
+// The logging thread writes out the buffers this often, or as soon as one of them is half full.
+static const std::chrono::milliseconds LOG_THREAD_INTERVAL(100);
+static const size_t MIN_THREAD_BUFFER_SIZE = 256;
+static const size_t FORMAT_BUFFER_SIZE = 512;
+
+static std::atomic<uint64_t> s_nextLogSystemId(1);
+
+const size_t RingBufferLogSystem::DEFAULT_THREAD_BUFFER_SIZE;
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Single producer, single consumer byte ring holding the statements of one thread until the logging thread writes them out.
+             * The producer only moves m_head and the consumer only moves m_tail, both grow forever and are taken modulo the capacity.
+             */
+            class ThreadLogBuffer
+            {
+            public:
+                struct StatementHeader
+                {
+                    uint32_t length;
+                    int32_t logLevel;
+                    int64_t timestampMillis;
+                    uint32_t tagLength;
+                    uint32_t messageLength;
+                };
+
+                ThreadLogBuffer(size_t capacity) :
+                    m_data(capacity), m_head(0), m_tail(0), m_dropped(0), m_droppedReported(0), m_threadExited(false),
+                    m_threadId(std::this_thread::get_id())
+                {
+                    Aws::OStringStream ss;
+                    ss << m_threadId;
+                    m_threadIdText = ss.str();
+                }
+
+                /**
+                 * Called by the owning thread. Returns false, counting the statement as dropped, if it does not fit.
+                 */
+                bool TryWrite(LogLevel logLevel, const char* tag, const char* message, size_t messageLength)
+                {
+                    size_t tagLength = strlen(tag);
+                    // A statement longer than the whole buffer is truncated rather than never fitting.
+                    if (sizeof(StatementHeader) + tagLength + messageLength > m_data.size())
+                    {
+                        if (sizeof(StatementHeader) + tagLength >= m_data.size())
+                        {
+                            m_dropped.fetch_add(1, std::memory_order_relaxed);
+                            return false;
+                        }
+                        messageLength = m_data.size() - sizeof(StatementHeader) - tagLength;
+                    }
+
+                    StatementHeader header;
+                    header.length = static_cast<uint32_t>(sizeof(StatementHeader) + tagLength + messageLength);
+                    header.logLevel = static_cast<int32_t>(logLevel);
+                    header.timestampMillis = DateTime::CurrentTimeMillis();
+                    header.tagLength = static_cast<uint32_t>(tagLength);
+                    header.messageLength = static_cast<uint32_t>(messageLength);
+
+                    uint64_t head = m_head.load(std::memory_order_relaxed);
+                    if (header.length > m_data.size() - (head - m_tail.load(std::memory_order_acquire)))
+                    {
+                        m_dropped.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+
+                    CopyIn(head, reinterpret_cast<const char*>(&header), sizeof(StatementHeader));
+                    CopyIn(head + sizeof(StatementHeader), tag, tagLength);
+                    CopyIn(head + sizeof(StatementHeader) + tagLength, message, messageLength);
+                    m_head.store(head + header.length, std::memory_order_release);
+                    return true;
+                }
+
+                bool IsHalfFull() const
+                {
+                    return m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_relaxed) > m_data.size() / 2;
+                }
+
+                /**
+                 * Called by the logging thread, position is between GetTail() and GetHead().
+                 */
+                void CopyOut(uint64_t position, char* destination, size_t length) const
+                {
+                    size_t offset = static_cast<size_t>(position % m_data.size());
+                    size_t firstLength = (std::min)(length, m_data.size() - offset);
+                    memcpy(destination, m_data.data() + offset, firstLength);
+                    memcpy(destination + firstLength, m_data.data(), length - firstLength);
+                }
+
+                void AppendTo(uint64_t position, size_t length, Aws::String& destination) const
+                {
+                    size_t offset = static_cast<size_t>(position % m_data.size());
+                    size_t firstLength = (std::min)(length, m_data.size() - offset);
+                    destination.append(m_data.data() + offset, firstLength);
+                    destination.append(m_data.data(), length - firstLength);
+                }
+
+                uint64_t GetHead() const { return m_head.load(std::memory_order_acquire); }
+                uint64_t GetTail() const { return m_tail.load(std::memory_order_relaxed); }
+                void SetTail(uint64_t tail) { m_tail.store(tail, std::memory_order_release); }
+
+                /**
+                 * Statements dropped since the last call, only called by the logging thread.
+                 */
+                uint64_t TakeDroppedCount()
+                {
+                    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+                    uint64_t count = dropped - m_droppedReported;
+                    m_droppedReported = dropped;
+                    return count;
+                }
+
+                void SetThreadExited() { m_threadExited.store(true); }
+                bool HasThreadExited() const { return m_threadExited.load(); }
+
+                std::thread::id GetThreadId() const { return m_threadId; }
+                const Aws::String& GetThreadIdText() const { return m_threadIdText; }
+
+            private:
+                void CopyIn(uint64_t position, const char* source, size_t length)
+                {
+                    size_t offset = static_cast<size_t>(position % m_data.size());
+                    size_t firstLength = (std::min)(length, m_data.size() - offset);
+                    memcpy(&m_data[offset], source, firstLength);
+                    memcpy(&m_data[0], source + firstLength, length - firstLength);
+                }
+
+                Aws::Vector<char> m_data;
+                std::atomic<uint64_t> m_head;
+                std::atomic<uint64_t> m_tail;
+                std::atomic<uint64_t> m_dropped;
+                uint64_t m_droppedReported;
+                std::atomic<bool> m_threadExited;
+                std::thread::id m_threadId;
+                Aws::String m_threadIdText;
+            };
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
+
+namespace
+{
+    /**
+     * Buffer of the current thread for the log system it last logged to, so that logging does not look it up under a lock.
+     */
+    struct ThreadLogBufferCache
+    {
+        ThreadLogBufferCache() : logSystemId(0) {}
+
+        ~ThreadLogBufferCache()
+        {
+            if (buffer)
+            {
+                buffer->SetThreadExited();
+            }
+        }
+
+        uint64_t logSystemId;
+        std::shared_ptr<ThreadLogBuffer> buffer;
+    };
+
+    thread_local ThreadLogBufferCache s_threadLogBufferCache;
+    // Id of the log system whose logging thread the current thread is, if any.
+    thread_local uint64_t s_loggingThreadLogSystemId = 0;
+
+    const char* GetLevelPrefix(int32_t logLevel)
+    {
+        switch (static_cast<LogLevel>(logLevel))
+        {
+            case LogLevel::Error: return "[ERROR] ";
+            case LogLevel::Fatal: return "[FATAL] ";
+            case LogLevel::Warn: return "[WARN] ";
+            case LogLevel::Info: return "[INFO] ";
+            case LogLevel::Debug: return "[DEBUG] ";
+            case LogLevel::Trace: return "[TRACE] ";
+            default: return "[UNKOWN] ";
+        }
+    }
+
+    struct BufferedStatement
+    {
+        int64_t timestampMillis;
+        size_t bufferIndex;
+        uint64_t position;
+    };
+}
+
+static std::shared_ptr<Aws::OFStream> MakeDefaultLogFile(const Aws::String& filenamePrefix)
+{
+    Aws::String newFileName = filenamePrefix + DateTime::CalculateGmtTimestampAsString("%Y-%m-%d-%H") + ".log";
+    return Aws::MakeShared<Aws::OFStream>(AllocationTag, newFileName.c_str(), Aws::OFStream::out | Aws::OFStream::app);
+}
+
+RingBufferLogSystem::RingBufferLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t threadBufferSize) :
+    RingBufferLogSystem(logLevel, threadBufferSize)
+{
+    m_logFile = logFile;
+    StartLogging();
+}
+
+RingBufferLogSystem::RingBufferLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t threadBufferSize) :
+    RingBufferLogSystem(logLevel, threadBufferSize)
+{
+    m_logFile = MakeDefaultLogFile(filenamePrefix);
+    m_filenamePrefix = filenamePrefix;
+    m_rollLog = true;
+    // localtime requires access to env. variables to get Timezone, which is not thread-safe
+    m_lastRolledHour = DateTime::Now().GetHour(false /*localtime*/);
+    StartLogging();
+}
+
+RingBufferLogSystem::RingBufferLogSystem(LogLevel logLevel, size_t threadBufferSize) :
+    m_logLevel(logLevel),
+    m_threadBufferSize((std::max)(threadBufferSize, MIN_THREAD_BUFFER_SIZE)),
+    m_id(s_nextLogSystemId++),
+    m_droppedStatements(0),
+    m_wakeRequested(false),
+    m_stopLogging(false),
+    m_flushesRequested(0),
+    m_flushesCompleted(0),
+    m_rollLog(false),
+    m_lastRolledHour(0),
+    m_timestampSecond(-1),
+    m_loggingThread()
+{
+}
+
+RingBufferLogSystem::~RingBufferLogSystem()
+{
+    StopLogging();
+}
+
+void RingBufferLogSystem::StartLogging()
+{
+    m_loggingThread = std::thread(&RingBufferLogSystem::LogThread, this);
+}
+
+void RingBufferLogSystem::StopLogging()
+{
+    if (!m_loggingThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_signalMutex);
+        m_stopLogging = true;
+    }
+
+    m_signal.notify_all();
+
+    m_loggingThread.join();
+}
+
+void RingBufferLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
+{
+    char formatBuffer[FORMAT_BUFFER_SIZE];
+
+    std::va_list args;
+    va_start(args, formatStr);
+
+    va_list tmp_args; //unfortunately you cannot consume a va_list twice
+    va_copy(tmp_args, args); //so we have to copy it
+    #ifdef WIN32
+        const int length = _vscprintf(formatStr, tmp_args);
+    #else
+        const int length = vsnprintf(formatBuffer, FORMAT_BUFFER_SIZE, formatStr, tmp_args);
+    #endif
+    va_end(tmp_args);
+
+    if (length >= 0 && static_cast<size_t>(length) < FORMAT_BUFFER_SIZE)
+    {
+    #ifdef WIN32
+        vsnprintf_s(formatBuffer, FORMAT_BUFFER_SIZE, _TRUNCATE, formatStr, args);
+    #endif // WIN32
+        Append(logLevel, tag, formatBuffer, static_cast<size_t>(length));
+    }
+    else if (length >= 0)
+    {
+        // Only statements longer than the stack buffer are formatted on the heap.
+        Array<char> outputBuff(static_cast<size_t>(length) + 1);
+    #ifdef WIN32
+        vsnprintf_s(outputBuff.GetUnderlyingData(), length + 1, _TRUNCATE, formatStr, args);
+    #else
+        vsnprintf(outputBuff.GetUnderlyingData(), length + 1, formatStr, args);
+    #endif // WIN32
+        Append(logLevel, tag, outputBuff.GetUnderlyingData(), static_cast<size_t>(length));
+    }
+
+    va_end(args);
+}
+
+void RingBufferLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream)
+{
+    Aws::String message = messageStream.str();
+    Append(logLevel, tag, message.c_str(), message.size());
+}
+
+void RingBufferLogSystem::Flush()
+{
+    std::unique_lock<std::mutex> locker(m_signalMutex);
+    uint64_t flush = ++m_flushesRequested;
+    m_signal.notify_all();
+    m_signal.wait(locker, [&](){ return m_flushesCompleted >= flush; });
+}
+
+void RingBufferLogSystem::Append(LogLevel logLevel, const char* tag, const char* message, size_t messageLength)
+{
+    if (s_loggingThreadLogSystemId == m_id)
+    {
+        return;
+    }
+
+    ThreadLogBuffer* buffer = GetThreadBuffer();
+    if (!buffer->TryWrite(logLevel, tag, message, messageLength))
+    {
+        m_droppedStatements++;
+    }
+
+    // Notifying without the lock can be missed, the logging thread then wakes up at its next interval anyway.
+    if (buffer->IsHalfFull() && !m_wakeRequested.exchange(true))
+    {
+        m_signal.notify_all();
+    }
+}
+
+ThreadLogBuffer* RingBufferLogSystem::GetThreadBuffer()
+{
+    ThreadLogBufferCache& cache = s_threadLogBufferCache;
+    if (cache.logSystemId == m_id)
+    {
+        return cache.buffer.get();
+    }
+
+    // First statement of this thread, or the thread logged to another log system in between.
+    std::shared_ptr<ThreadLogBuffer> buffer;
+    {
+        std::lock_guard<std::mutex> locker(m_threadBuffersMutex);
+        for (const auto& threadBuffer : m_threadBuffers)
+        {
+            if (threadBuffer->GetThreadId() == std::this_thread::get_id() && !threadBuffer->HasThreadExited())
+            {
+                buffer = threadBuffer;
+                break;
+            }
+        }
+
+        if (!buffer)
+        {
+            buffer = Aws::MakeShared<ThreadLogBuffer>(AllocationTag, m_threadBufferSize);
+            m_threadBuffers.push_back(buffer);
+        }
+    }
+
+    // Only the buffer of the latest log system is marked when the thread exits, the others are released with their log system.
+    cache.logSystemId = m_id;
+    cache.buffer = buffer;
+    return buffer.get();
+}
+
+void RingBufferLogSystem::LogThread()
+{
+    s_loggingThreadLogSystemId = m_id;
+
+    for(;;)
+    {
+        bool stopLogging = false;
+        uint64_t flushes = 0;
+        {
+            std::unique_lock<std::mutex> locker(m_signalMutex);
+            m_signal.wait_for(locker, LOG_THREAD_INTERVAL, [&](){ return m_stopLogging || m_flushesRequested != m_flushesCompleted || m_wakeRequested.load(); });
+            stopLogging = m_stopLogging;
+            flushes = m_flushesRequested;
+            m_wakeRequested = false;
+        }
+
+        WriteBufferedStatements(stopLogging || flushes != m_flushesCompleted);
+
+        {
+            std::lock_guard<std::mutex> locker(m_signalMutex);
+            m_flushesCompleted = flushes;
+        }
+        m_signal.notify_all();
+
+        if (stopLogging)
+        {
+            break;
+        }
+    }
+}
+
+void RingBufferLogSystem::WriteBufferedStatements(bool flush)
+{
+    Aws::Vector<std::shared_ptr<ThreadLogBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> locker(m_threadBuffersMutex);
+        buffers = m_threadBuffers;
+        // The buffer of an exited thread is written out one last time below.
+        m_threadBuffers.erase(std::remove_if(m_threadBuffers.begin(), m_threadBuffers.end(),
+            [](const std::shared_ptr<ThreadLogBuffer>& buffer) { return buffer->HasThreadExited(); }), m_threadBuffers.end());
+    }
+
+    Aws::Vector<BufferedStatement> statements;
+    Aws::Vector<uint64_t> heads(buffers.size());
+    Aws::Vector<uint64_t> droppedCounts(buffers.size());
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        heads[i] = buffers[i]->GetHead();
+        droppedCounts[i] = buffers[i]->TakeDroppedCount();
+        ThreadLogBuffer::StatementHeader header;
+        for (uint64_t position = buffers[i]->GetTail(); position < heads[i]; position += header.length)
+        {
+            buffers[i]->CopyOut(position, reinterpret_cast<char*>(&header), sizeof(header));
+            BufferedStatement statement = { header.timestampMillis, i, position };
+            statements.push_back(statement);
+        }
+    }
+
+    // The buffers are each in order already, merges them by time.
+    std::stable_sort(statements.begin(), statements.end(),
+        [](const BufferedStatement& left, const BufferedStatement& right) { return left.timestampMillis < right.timestampMillis; });
+
+    m_writeBuffer.clear();
+    m_formattedStatements.clear();
+    for (const auto& statement : statements)
+    {
+        const ThreadLogBuffer& buffer = *buffers[statement.bufferIndex];
+        ThreadLogBuffer::StatementHeader header;
+        buffer.CopyOut(statement.position, reinterpret_cast<char*>(&header), sizeof(header));
+        uint64_t tagPosition = statement.position + sizeof(header);
+
+        FormattedStatement formattedStatement = { header.timestampMillis, m_writeBuffer.size(), 0 };
+        AppendPrefix(header.logLevel, header.timestampMillis);
+        buffer.AppendTo(tagPosition, header.tagLength, m_writeBuffer);
+        AppendThreadId(buffer.GetThreadIdText());
+        buffer.AppendTo(tagPosition + header.tagLength, header.messageLength, m_writeBuffer);
+        formattedStatement.length = m_writeBuffer.size() - formattedStatement.offset;
+        m_formattedStatements.push_back(formattedStatement);
+        m_writeBuffer.push_back('\n');
+    }
+
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        if (droppedCounts[i] > 0)
+        {
+            int64_t timestampMillis = DateTime::CurrentTimeMillis();
+            FormattedStatement formattedStatement = { timestampMillis, m_writeBuffer.size(), 0 };
+            AppendPrefix(static_cast<int32_t>(LogLevel::Warn), timestampMillis);
+            m_writeBuffer.append(AllocationTag);
+            AppendThreadId(buffers[i]->GetThreadIdText());
+            m_writeBuffer.append(StringUtils::to_string(droppedCounts[i]));
+            m_writeBuffer.append(" log statements of this thread were dropped because its log buffer was full.");
+            formattedStatement.length = m_writeBuffer.size() - formattedStatement.offset;
+            m_formattedStatements.push_back(formattedStatement);
+            m_writeBuffer.push_back('\n');
+        }
+    }
+
+    // One write for the whole batch, the statements are only released once they have been written out.
+    WriteStatements(m_writeBuffer, m_formattedStatements, flush);
+
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        buffers[i]->SetTail(heads[i]);
+    }
+}
+
+void RingBufferLogSystem::AppendPrefix(int32_t logLevel, int64_t timestampMillis)
+{
+    // Statements come in bursts, the date and time is only formatted once per second.
+    int64_t second = timestampMillis / 1000;
+    if (second != m_timestampSecond)
+    {
+        m_timestampSecond = second;
+        m_timestampSecondText = DateTime(second * 1000).ToGmtString("%Y-%m-%d %H:%M:%S");
+    }
+    int64_t millis = timestampMillis - second * 1000;
+    const char millisText[] = { '.', char('0' + millis / 100), char('0' + millis / 10 % 10), char('0' + millis % 10), ' ' };
+
+    m_writeBuffer.append(GetLevelPrefix(logLevel));
+    m_writeBuffer.append(m_timestampSecondText);
+    m_writeBuffer.append(millisText, sizeof(millisText));
+}
+
+void RingBufferLogSystem::AppendThreadId(const Aws::String& threadIdText)
+{
+    m_writeBuffer.append(" [");
+    m_writeBuffer.append(threadIdText);
+    m_writeBuffer.append("] ");
+}
+
+void RingBufferLogSystem::WriteStatements(const Aws::String& text, const Aws::Vector<FormattedStatement>&, bool)
+{
+    if (m_rollLog)
+    {
+        // localtime requires access to env. variables to get Timezone, which is not thread-safe
+        int32_t currentHour = DateTime::Now().GetHour(false /*localtime*/);
+        if (currentHour != m_lastRolledHour)
+        {
+            m_logFile = MakeDefaultLogFile(m_filenamePrefix);
+            m_lastRolledHour = currentHour;
+        }
+    }
+
+    if (text.empty())
+    {
+        return;
+    }
+
+    m_logFile->write(text.data(), static_cast<std::streamsize>(text.size()));
+    m_logFile->flush();
+}
@@ -0,0 +1,427 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/stream/ResponseBodyStream.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <mutex>
+
+using namespace Aws::Utils::Stream;
+
+static const char* RESPONSE_BODY_STREAM_TAG = "ResponseBodyStream";
+
+// Capacity allocated by the first write when nothing was reserved.
+static const size_t MIN_CAPACITY = 256;
+// Content-Length is only trusted this far, larger bodies grow as they are received.
+static const uint64_t MAX_RESERVED_LENGTH = 64 * 1024 * 1024;
+// Bounds the memory a thread keeps for bodies it no longer uses: a few buffers, sized for the small bodies of most calls.
+static const size_t MAX_POOLED_BUFFERS = 4;
+static const size_t MAX_POOLED_BUFFER_SIZE = 256 * 1024;
+
+namespace
+{
+    /**
+     * Free list of the body buffers released by the streams destroyed on a thread.
+     * The pools of all the threads are linked together, so that CleanupResponseBufferPools can free their buffers
+     * while the memory system they were allocated from is still there.
+     */
+    class ResponseBufferPool
+    {
+    public:
+        ResponseBufferPool();
+
+        ~ResponseBufferPool();
+
+        char* Acquire(size_t& size)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            if (m_count == 0)
+            {
+                size = 0;
+                return nullptr;
+            }
+            --m_count;
+            size = m_sizes[m_count];
+            return m_buffers[m_count];
+        }
+
+        bool Release(char* buffer, size_t size);
+
+        void FreeBuffers()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            for (size_t i = 0; i < m_count; ++i)
+            {
+                Aws::Free(m_buffers[i]);
+            }
+            m_count = 0;
+        }
+
+    private:
+        friend void UnlinkPool(ResponseBufferPool* pool);
+        friend void FreePooledBuffers();
+
+        // Only taken by the owning thread, and by CleanupResponseBufferPools.
+        std::mutex m_lock;
+        char* m_buffers[MAX_POOLED_BUFFERS];
+        size_t m_sizes[MAX_POOLED_BUFFERS];
+        size_t m_count;
+
+        // Guarded by s_poolsLock.
+        ResponseBufferPool* m_previous;
+        ResponseBufferPool* m_next;
+    };
+
+    // Both trivially destructible, so they are still usable by the pools of the threads exiting after the static objects are destroyed.
+    std::mutex s_poolsLock;
+    ResponseBufferPool* s_pools = nullptr;
+    // Cleared between Aws::ShutdownAPI and the next Aws::InitAPI, the streams destroyed meanwhile free their buffers.
+    std::atomic<bool> s_poolingEnabled(true);
+
+    thread_local ResponseBufferPool s_responseBufferPool;
+    // Trivially destructible so that it can still be read once the pool of an exiting thread was destroyed,
+    // by streams destroyed later during the thread exit.
+    thread_local bool s_responseBufferPoolDestroyed = false;
+
+    ResponseBufferPool::ResponseBufferPool() : m_count(0), m_previous(nullptr), m_next(nullptr)
+    {
+        std::lock_guard<std::mutex> locker(s_poolsLock);
+        m_next = s_pools;
+        if (s_pools)
+        {
+            s_pools->m_previous = this;
+        }
+        s_pools = this;
+    }
+
+    void UnlinkPool(ResponseBufferPool* pool)
+    {
+        std::lock_guard<std::mutex> locker(s_poolsLock);
+        if (pool->m_previous)
+        {
+            pool->m_previous->m_next = pool->m_next;
+        }
+        else
+        {
+            s_pools = pool->m_next;
+        }
+        if (pool->m_next)
+        {
+            pool->m_next->m_previous = pool->m_previous;
+        }
+    }
+
+    void FreePooledBuffers()
+    {
+        std::lock_guard<std::mutex> locker(s_poolsLock);
+        for (ResponseBufferPool* pool = s_pools; pool; pool = pool->m_next)
+        {
+            pool->FreeBuffers();
+        }
+    }
+
+    ResponseBufferPool::~ResponseBufferPool()
+    {
+        s_responseBufferPoolDestroyed = true;
+        UnlinkPool(this);
+        FreeBuffers();
+    }
+
+    bool ResponseBufferPool::Release(char* buffer, size_t size)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        // Checked under the lock, so that CleanupResponseBufferPools either sees the buffer or it is not pooled.
+        if (!s_poolingEnabled || m_count == MAX_POOLED_BUFFERS || size > MAX_POOLED_BUFFER_SIZE)
+        {
+            return false;
+        }
+        m_buffers[m_count] = buffer;
+        m_sizes[m_count] = size;
+        ++m_count;
+        return true;
+    }
+
+    int GetResponseBodyStreamIndex()
+    {
+        static const int index = std::ios_base::xalloc();
+        return index;
+    }
+}
+
+ResponseBodyStreamBuf::ResponseBodyStreamBuf() :
+    m_buffer(nullptr),
+    m_allocatedSize(0),
+    m_end(nullptr)
+{
+}
+
+ResponseBodyStreamBuf::~ResponseBodyStreamBuf()
+{
+    if (m_buffer)
+    {
+        Aws::Free(m_buffer);
+    }
+}
+
+void ResponseBodyStreamBuf::Reserve(size_t length)
+{
+    if (length > GetCapacity())
+    {
+        Grow(length);
+    }
+}
+
+void ResponseBodyStreamBuf::Reset()
+{
+    SetAreas(0, 0, 0);
+}
+
+const char* ResponseBodyStreamBuf::GetData()
+{
+    if (!m_buffer)
+    {
+        return "";
+    }
+    *GetEnd() = '\0';
+    return m_buffer;
+}
+
+size_t ResponseBodyStreamBuf::GetLength() const
+{
+    return GetEnd() - m_buffer;
+}
+
+const char* ResponseBodyStreamBuf::GetUnreadData()
+{
+    return GetData() + (gptr() - m_buffer);
+}
+
+size_t ResponseBodyStreamBuf::GetUnreadLength() const
+{
+    return GetEnd() - gptr();
+}
+
+size_t ResponseBodyStreamBuf::GetCapacity() const
+{
+    return m_allocatedSize > 0 ? m_allocatedSize - 1 : 0;
+}
+
+char* ResponseBodyStreamBuf::SwapBuffer(char* buffer, size_t size, size_t& previousSize)
+{
+    char* previousBuffer = m_buffer;
+    previousSize = m_allocatedSize;
+    m_buffer = buffer;
+    m_allocatedSize = buffer ? size : 0;
+    Reset();
+    return previousBuffer;
+}
+
+char* ResponseBodyStreamBuf::GetEnd() const
+{
+    // Writes through sputc only move the put pointer, it can be past the end recorded last.
+    return (std::max)(m_end, pptr());
+}
+
+void ResponseBodyStreamBuf::SetAreas(size_t getPosition, size_t putPosition, size_t end)
+{
+    m_end = m_buffer + end;
+    setg(m_buffer, m_buffer + getPosition, m_end);
+    setp(m_buffer, m_buffer + GetCapacity());
+    while (putPosition > 0)
+    {
+        int step = static_cast<int>((std::min)(putPosition, static_cast<size_t>(INT_MAX)));
+        pbump(step);
+        putPosition -= step;
+    }
+}
+
+void ResponseBodyStreamBuf::Grow(size_t minLength)
+{
+    size_t getPosition = gptr() - m_buffer;
+    size_t putPosition = pptr() - m_buffer;
+    size_t end = GetLength();
+
+    size_t newSize = minLength + 1;
+    char* newBuffer = static_cast<char*>(Aws::Malloc(RESPONSE_BODY_STREAM_TAG, newSize));
+    if (m_buffer)
+    {
+        std::memcpy(newBuffer, m_buffer, end);
+        Aws::Free(m_buffer);
+    }
+    m_buffer = newBuffer;
+    m_allocatedSize = newSize;
+    SetAreas(getPosition, putPosition, end);
+}
+
+ResponseBodyStreamBuf::pos_type ResponseBodyStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    off_type base = 0;
+    if (dir == std::ios_base::end)
+    {
+        base = static_cast<off_type>(GetLength());
+    }
+    else if (dir == std::ios_base::cur)
+    {
+        if ((which & std::ios_base::in) && (which & std::ios_base::out))
+        {
+            return pos_type(off_type(-1));
+        }
+        base = (which & std::ios_base::in) ? gptr() - m_buffer : pptr() - m_buffer;
+    }
+    return seekpos(pos_type(base + off), which);
+}
+
+ResponseBodyStreamBuf::pos_type ResponseBodyStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    off_type position = off_type(pos);
+    size_t end = GetLength();
+    if (position < 0 || static_cast<size_t>(position) > end)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    size_t getPosition = (which & std::ios_base::in) ? static_cast<size_t>(position) : gptr() - m_buffer;
+    size_t putPosition = (which & std::ios_base::out) ? static_cast<size_t>(position) : pptr() - m_buffer;
+    SetAreas(getPosition, putPosition, end);
+    return pos;
+}
+
+ResponseBodyStreamBuf::int_type ResponseBodyStreamBuf::overflow(int_type c)
+{
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        return traits_type::not_eof(c);
+    }
+
+    if (pptr() == epptr())
+    {
+        Grow((std::max)(GetCapacity() * 2, MIN_CAPACITY));
+    }
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+    return c;
+}
+
+ResponseBodyStreamBuf::int_type ResponseBodyStreamBuf::underflow()
+{
+    char* end = GetEnd();
+    if (gptr() < end)
+    {
+        setg(eback(), gptr(), end);
+        return traits_type::to_int_type(*gptr());
+    }
+    return traits_type::eof();
+}
+
+std::streamsize ResponseBodyStreamBuf::xsputn(const char* s, std::streamsize n)
+{
+    if (n <= 0)
+    {
+        return 0;
+    }
+
+    size_t length = static_cast<size_t>(n);
+    size_t putPosition = pptr() - m_buffer;
+    if (length > static_cast<size_t>(epptr() - pptr()))
+    {
+        Grow((std::max)(putPosition + length, (std::max)(GetCapacity() * 2, MIN_CAPACITY)));
+    }
+    std::memcpy(pptr(), s, length);
+    SetAreas(gptr() - m_buffer, putPosition + length, (std::max)(GetLength(), putPosition + length));
+    return n;
+}
+
+ResponseBodyStream::ResponseBodyStream() :
+    Aws::IOStream(nullptr),
+    m_ownedByCaller(false)
+{
+    if (!s_responseBufferPoolDestroyed)
+    {
+        size_t size = 0;
+        char* buffer = s_responseBufferPool.Acquire(size);
+        if (buffer)
+        {
+            size_t previousSize = 0;
+            m_buffer.SwapBuffer(buffer, size, previousSize);
+        }
+    }
+    Register();
+}
+
+ResponseBodyStream::ResponseBodyStream(size_t capacity, bool ownedByCaller) :
+    Aws::IOStream(nullptr),
+    m_ownedByCaller(ownedByCaller)
+{
+    m_buffer.Reserve(capacity);
+    Register();
+}
+
+ResponseBodyStream::~ResponseBodyStream()
+{
+    if (!m_ownedByCaller && !s_responseBufferPoolDestroyed)
+    {
+        size_t size = 0;
+        char* buffer = m_buffer.SwapBuffer(nullptr, 0, size);
+        if (buffer && !s_responseBufferPool.Release(buffer, size))
+        {
+            Aws::Free(buffer);
+        }
+    }
+}
+
+void ResponseBodyStream::Register()
+{
+    rdbuf(&m_buffer);
+    pword(GetResponseBodyStreamIndex()) = this;
+}
+
+ResponseBodyStream* ResponseBodyStream::FromStream(std::ios_base& stream)
+{
+    return static_cast<ResponseBodyStream*>(stream.pword(GetResponseBodyStreamIndex()));
+}
+
+void ResponseBodyStream::ReserveIfBuffered(std::ios_base& stream, uint64_t length)
+{
+    ResponseBodyStream* bodyStream = FromStream(stream);
+    if (bodyStream)
+    {
+        bodyStream->GetBuffer().Reserve(static_cast<size_t>((std::min)(length, MAX_RESERVED_LENGTH)));
+    }
+}
+
+ResponseBodySink::ResponseBodySink(size_t capacity) :
+    ResponseBodyStream(capacity, true /*ownedByCaller*/)
+{
+}
+
+Aws::IOStreamFactory ResponseBodySink::GetFactory()
+{
+    return [this]() -> Aws::IOStream*
+    {
+        GetBuffer().Reset();
+        clear();
+        return this;
+    };
+}
+
+Aws::IOStream* Aws::Utils::Stream::PooledResponseStreamFactoryMethod()
+{
+    return Aws::New<ResponseBodyStream>(RESPONSE_BODY_STREAM_TAG);
+}
+
+void Aws::Utils::Stream::InitResponseBufferPools()
+{
+    s_poolingEnabled = true;
+}
+
+void Aws::Utils::Stream::CleanupResponseBufferPools()
+{
+    s_poolingEnabled = false;
+    FreePooledBuffers();
+}
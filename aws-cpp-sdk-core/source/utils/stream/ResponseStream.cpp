@@ -4,6 +4,7 @@
  */
 
 #include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/stream/ResponseBodyStream.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 #if defined(_GLIBCXX_FULLY_DYNAMIC_STRING) && _GLIBCXX_FULLY_DYNAMIC_STRING == 0 && defined(__ANDROID__)
@@ -59,7 +60,11 @@ void ResponseStream::ReleaseStream()
     if (m_underlyingStream)
     {
         m_underlyingStream->flush();
-        Aws::Delete(m_underlyingStream);
+        ResponseBodyStream* bodyStream = ResponseBodyStream::FromStream(*m_underlyingStream);
+        if (!bodyStream || !bodyStream->IsOwnedByCaller())
+        {
+            Aws::Delete(m_underlyingStream);
+        }
     }
 
     m_underlyingStream = nullptr;
@@ -83,9 +88,7 @@ DefaultUnderlyingStream::~DefaultUnderlyingStream()
     }
 }
 
-static const char* RESPONSE_STREAM_FACTORY_TAG = "ResponseStreamFactory";
-
 Aws::IOStream* Aws::Utils::Stream::DefaultResponseStreamFactoryMethod() 
 {
-    return Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(RESPONSE_STREAM_FACTORY_TAG);
+    return PooledResponseStreamFactoryMethod();
 }
@@ -5,10 +5,20 @@
 
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/threading/ThreadTask.h>
-#include <thread>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <algorithm>
 #include <cassert>
+#include <cerrno>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 static const char* POOLED_CLASS_TAG = "PooledThreadExecutor";
+static const char* WORK_STEALING_CLASS_TAG = "WorkStealingThreadExecutor";
 
 using namespace Aws::Utils::Threading;
 
@@ -153,3 +163,172 @@ bool PooledThreadExecutor::HasTasks()
     std::lock_guard<std::mutex> locker(m_queueLock);
     return m_tasks.size() > 0;
 }
+
+struct WorkStealingThreadExecutor::Worker
+{
+    Worker() : taskCount(0) {}
+
+    std::mutex lock;
+    Aws::Deque<TaskFunction> tasks;
+    // Size of tasks, lets thieves skip empty deques without taking their lock.
+    std::atomic<size_t> taskCount;
+    std::thread thread;
+};
+
+static void PinCurrentThreadToCpu(size_t cpu)
+{
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(static_cast<int>(cpu), &cpuSet);
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        AWS_LOGSTREAM_WARN(WORK_STEALING_CLASS_TAG, "Failed to pin worker thread to CPU " << cpu << ", errno: " << errno);
+    }
+#else
+    AWS_UNREFERENCED_PARAM(cpu);
+    AWS_LOGSTREAM_WARN(WORK_STEALING_CLASS_TAG, "Pinning worker threads to CPUs is not supported on this platform.");
+#endif
+}
+
+WorkStealingThreadExecutor::WorkStealingThreadExecutor(size_t poolSize, OverflowPolicy overflowPolicy, bool pinWorkersToCpus) :
+    m_nextWorker(0), m_queuedTasks(0), m_sleepingWorkers(0), m_continue(true), m_overflowPolicy(overflowPolicy), m_pinWorkersToCpus(pinWorkersToCpus)
+{
+    // Workers steal from each other, every deque has to exist before the first thread starts.
+    for (size_t index = 0; index < (std::max)(poolSize, static_cast<size_t>(1)); ++index)
+    {
+        m_workers.push_back(Aws::New<Worker>(WORK_STEALING_CLASS_TAG));
+    }
+
+    for (size_t index = 0; index < m_workers.size(); ++index)
+    {
+        m_workers[index]->thread = std::thread(&WorkStealingThreadExecutor::WorkerMain, this, index);
+    }
+}
+
+WorkStealingThreadExecutor::~WorkStealingThreadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_sleepLock);
+        m_continue = false;
+    }
+    m_sleepSignal.notify_all();
+
+    for (auto worker : m_workers)
+    {
+        worker->thread.join();
+    }
+
+    for (auto worker : m_workers)
+    {
+        Aws::Delete(worker);
+    }
+}
+
+bool WorkStealingThreadExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    return SubmitTask(TaskFunction(std::move(fn)));
+}
+
+bool WorkStealingThreadExecutor::SubmitTask(TaskFunction&& task)
+{
+    if (m_queuedTasks.fetch_add(1) >= m_workers.size() && m_overflowPolicy == OverflowPolicy::REJECT_IMMEDIATELY)
+    {
+        m_queuedTasks--;
+        return false;
+    }
+
+    // Tasks submitted by a worker stay on its deque, they likely touch the same data as the task submitting them.
+    size_t target = m_workers.size();
+    const auto threadId = std::this_thread::get_id();
+    for (size_t index = 0; index < m_workers.size(); ++index)
+    {
+        if (m_workers[index]->thread.get_id() == threadId)
+        {
+            target = index;
+            break;
+        }
+    }
+    if (target == m_workers.size())
+    {
+        target = m_nextWorker++ % m_workers.size();
+    }
+
+    {
+        Worker* worker = m_workers[target];
+        std::lock_guard<std::mutex> locker(worker->lock);
+        worker->tasks.push_back(std::move(task));
+        worker->taskCount = worker->tasks.size();
+    }
+
+    if (m_sleepingWorkers > 0)
+    {
+        // Taking the lock guarantees a worker that saw no task is already waiting on the signal.
+        {
+            std::lock_guard<std::mutex> locker(m_sleepLock);
+        }
+        m_sleepSignal.notify_one();
+    }
+    return true;
+}
+
+bool WorkStealingThreadExecutor::PopTask(size_t index, TaskFunction& task)
+{
+    Worker* worker = m_workers[index];
+    if (worker->taskCount > 0)
+    {
+        std::lock_guard<std::mutex> locker(worker->lock);
+        if (!worker->tasks.empty())
+        {
+            task = std::move(worker->tasks.front());
+            worker->tasks.pop_front();
+            worker->taskCount = worker->tasks.size();
+            return true;
+        }
+    }
+
+    // Owners run their tasks in submission order, thieves take the most recent ones.
+    for (size_t offset = 1; offset < m_workers.size(); ++offset)
+    {
+        Worker* victim = m_workers[(index + offset) % m_workers.size()];
+        if (victim->taskCount == 0)
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> locker(victim->lock);
+        if (!victim->tasks.empty())
+        {
+            task = std::move(victim->tasks.back());
+            victim->tasks.pop_back();
+            victim->taskCount = victim->tasks.size();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingThreadExecutor::WorkerMain(size_t index)
+{
+    if (m_pinWorkersToCpus)
+    {
+        PinCurrentThreadToCpu(index % (std::max)(std::thread::hardware_concurrency(), 1u));
+    }
+
+    TaskFunction task;
+    while (m_continue)
+    {
+        if (PopTask(index, task))
+        {
+            m_queuedTasks--;
+            task();
+            task.Reset();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(m_sleepLock);
+        m_sleepingWorkers++;
+        m_sleepSignal.wait(locker, [this] { return !m_continue || m_queuedTasks > 0; });
+        m_sleepingWorkers--;
+    }
+}
@@ -0,0 +1,530 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+using namespace Aws::Utils::Xml;
+
+static const char XML_READER_TAG[] = "XmlReader";
+// Skipping an element recurses once per nesting level, deeper documents are rejected instead of exhausting the stack.
+static const size_t MAX_NESTING_DEPTH = 500;
+
+static inline bool IsWhitespace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline bool StartsWith(const char* position, const char* end, const char* prefix, size_t length)
+{
+    return static_cast<size_t>(end - position) >= length && memcmp(position, prefix, length) == 0;
+}
+
+static void AppendUtf8(Aws::String& out, unsigned long codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+/**
+ * Decodes the entity starting at position, which points to an ampersand, and returns the position after it.
+ * Returns position unchanged if the entity is not one of the predefined ones or a character reference.
+ */
+static const char* DecodeEntity(const char* position, const char* end, Aws::String& out)
+{
+    static const size_t MAX_ENTITY_LENGTH = 12;
+    const char* limit = position + std::min(static_cast<size_t>(end - position), MAX_ENTITY_LENGTH);
+    const char* semicolon = std::find(position + 1, limit, ';');
+    if (semicolon == limit)
+    {
+        return position;
+    }
+
+    const char* name = position + 1;
+    size_t length = semicolon - name;
+    if (length == 2 && memcmp(name, "lt", 2) == 0) out.push_back('<');
+    else if (length == 2 && memcmp(name, "gt", 2) == 0) out.push_back('>');
+    else if (length == 3 && memcmp(name, "amp", 3) == 0) out.push_back('&');
+    else if (length == 4 && memcmp(name, "quot", 4) == 0) out.push_back('"');
+    else if (length == 4 && memcmp(name, "apos", 4) == 0) out.push_back('\'');
+    else if (length > 1 && *name == '#')
+    {
+        bool hex = name[1] == 'x' || name[1] == 'X';
+        const char* digits = hex ? name + 2 : name + 1;
+        if (digits == semicolon)
+        {
+            return position;
+        }
+        char buffer[MAX_ENTITY_LENGTH];
+        memcpy(buffer, digits, semicolon - digits);
+        buffer[semicolon - digits] = '\0';
+        char* parsedEnd = nullptr;
+        unsigned long codePoint = strtoul(buffer, &parsedEnd, hex ? 16 : 10);
+        if (*parsedEnd != '\0' || codePoint == 0 || codePoint > 0x10FFFF)
+        {
+            return position;
+        }
+        AppendUtf8(out, codePoint);
+    }
+    else
+    {
+        return position;
+    }
+    return semicolon + 1;
+}
+
+XmlReader::XmlReader() : XmlReader("", 0)
+{
+}
+
+XmlReader::XmlReader(const char* data, size_t length) :
+    m_begin(data),
+    m_position(data),
+    m_end(data + length),
+    m_nameData(nullptr),
+    m_nameLength(0),
+    m_attributesBegin(nullptr),
+    m_attributesEnd(nullptr),
+    m_elementPending(false),
+    m_pendingIsEmpty(false)
+{
+}
+
+XmlReader::XmlReader(Aws::IStream& istream) : XmlReader(nullptr, 0)
+{
+    auto text = Aws::MakeShared<Aws::String>(XML_READER_TAG);
+    auto start = istream.tellg();
+    istream.seekg(0, std::ios_base::end);
+    auto end = istream.tellg();
+    istream.seekg(start);
+    if (start != std::streampos(-1) && end != std::streampos(-1) && end >= start)
+    {
+        text->resize(static_cast<size_t>(end - start));
+        istream.read(&(*text)[0], static_cast<std::streamsize>(text->size()));
+        text->resize(static_cast<size_t>(istream.gcount()));
+    }
+    else
+    {
+        istream.clear();
+        text->assign(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>());
+    }
+
+    m_ownedText = text;
+    m_begin = m_position = m_ownedText->c_str();
+    m_end = m_begin + m_ownedText->size();
+}
+
+XmlReader::XmlReader(Aws::String&& text) : XmlReader(nullptr, 0)
+{
+    m_ownedText = Aws::MakeShared<Aws::String>(XML_READER_TAG, std::move(text));
+    m_begin = m_position = m_ownedText->c_str();
+    m_end = m_begin + m_ownedText->size();
+}
+
+bool XmlReader::NextChild()
+{
+    return NextChildInternal(nullptr);
+}
+
+bool XmlReader::StartElement()
+{
+    if (!WasParseSuccessful() || !m_elementPending)
+    {
+        return false;
+    }
+
+    if (m_openElements.size() >= MAX_NESTING_DEPTH)
+    {
+        SetError("Maximum nesting depth exceeded");
+        return false;
+    }
+
+    OpenElement element = { m_nameData, m_nameLength, m_pendingIsEmpty };
+    m_openElements.push_back(element);
+    m_elementPending = false;
+    return true;
+}
+
+bool XmlReader::NameEquals(const char* name) const
+{
+    return strlen(name) == m_nameLength && memcmp(name, m_nameData, m_nameLength) == 0;
+}
+
+Aws::String XmlReader::GetAttribute(const char* name) const
+{
+    size_t nameLength = strlen(name);
+    const char* position = m_attributesBegin;
+    while (position != m_attributesEnd)
+    {
+        if (IsWhitespace(*position))
+        {
+            ++position;
+            continue;
+        }
+
+        const char* attributeName = position;
+        position = ScanName(position);
+        const char* attributeNameEnd = position;
+        while (position != m_attributesEnd && IsWhitespace(*position)) ++position;
+        if (position == m_attributesEnd || *position != '=')
+        {
+            break;
+        }
+        ++position;
+        while (position != m_attributesEnd && IsWhitespace(*position)) ++position;
+        if (position == m_attributesEnd || (*position != '"' && *position != '\''))
+        {
+            break;
+        }
+
+        const char* value = position + 1;
+        const char* valueEnd = std::find(value, m_attributesEnd, *position);
+        if (valueEnd == m_attributesEnd)
+        {
+            break;
+        }
+
+        if (static_cast<size_t>(attributeNameEnd - attributeName) == nameLength && memcmp(attributeName, name, nameLength) == 0)
+        {
+            Aws::String decoded;
+            AppendText(value, valueEnd, decoded);
+            return decoded;
+        }
+        position = valueEnd + 1;
+    }
+    return {};
+}
+
+Aws::String XmlReader::ReadText()
+{
+    Aws::String text;
+    if (StartElement())
+    {
+        // Nested elements are returned as children and skipped by the next iteration.
+        while (NextChildInternal(&text))
+        {
+        }
+    }
+    return text;
+}
+
+void XmlReader::SkipElement()
+{
+    if (StartElement())
+    {
+        while (NextChildInternal(nullptr))
+        {
+        }
+    }
+}
+
+bool XmlReader::Validate()
+{
+    m_position = m_begin;
+    m_elementPending = false;
+    m_openElements.clear();
+
+    if (!NextChildInternal(nullptr))
+    {
+        if (WasParseSuccessful())
+        {
+            SetError("No root element");
+        }
+    }
+    else
+    {
+        SkipElement();
+        if (NextChildInternal(nullptr))
+        {
+            SetError("Unexpected element after the root element");
+        }
+    }
+
+    m_position = m_begin;
+    m_elementPending = false;
+    m_openElements.clear();
+    return WasParseSuccessful();
+}
+
+bool XmlReader::NextChildInternal(Aws::String* text)
+{
+    if (!WasParseSuccessful())
+    {
+        return false;
+    }
+
+    if (m_elementPending)
+    {
+        SkipElement();
+        if (!WasParseSuccessful())
+        {
+            return false;
+        }
+    }
+
+    if (!m_openElements.empty() && m_openElements.back().empty)
+    {
+        m_openElements.pop_back();
+        return false;
+    }
+
+    for (;;)
+    {
+        const char* markup = static_cast<const char*>(memchr(m_position, '<', m_end - m_position));
+        const char* textEnd = markup ? markup : m_end;
+        if (text && textEnd != m_position)
+        {
+            AppendText(m_position, textEnd, *text);
+        }
+        m_position = textEnd;
+
+        if (m_position == m_end)
+        {
+            if (!m_openElements.empty())
+            {
+                SetError("Unexpected end of XML document");
+            }
+            return false;
+        }
+
+        if (StartsWith(m_position, m_end, "</", 2))
+        {
+            ReadEndTag();
+            return false;
+        }
+        else if (StartsWith(m_position, m_end, "<?", 2))
+        {
+            if (!SkipPast("?>", 2)) return false;
+        }
+        else if (StartsWith(m_position, m_end, "<!--", 4))
+        {
+            if (!SkipPast("-->", 3)) return false;
+        }
+        else if (StartsWith(m_position, m_end, "<![CDATA[", 9))
+        {
+            const char* data = m_position + 9;
+            if (!SkipPast("]]>", 3)) return false;
+            if (text)
+            {
+                text->append(data, m_position - 3);
+            }
+        }
+        else if (StartsWith(m_position, m_end, "<!", 2))
+        {
+            if (!SkipDoctype()) return false;
+        }
+        else
+        {
+            return ReadStartTag();
+        }
+    }
+}
+
+bool XmlReader::ReadStartTag()
+{
+    const char* name = m_position + 1;
+    const char* nameEnd = ScanName(name);
+    if (nameEnd == name || nameEnd == m_end || (!IsWhitespace(*nameEnd) && *nameEnd != '/' && *nameEnd != '>'))
+    {
+        SetError("Expected element name");
+        return false;
+    }
+
+    // Finds the closing bracket, stepping over quoted attribute values as they may contain one.
+    const char* position = nameEnd;
+    char quote = 0;
+    for (; position != m_end; ++position)
+    {
+        char c = *position;
+        if (quote)
+        {
+            if (c == quote) quote = 0;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            quote = c;
+        }
+        else if (c == '>')
+        {
+            break;
+        }
+        else if (c == '<')
+        {
+            SetError("Unexpected '<' in start tag");
+            return false;
+        }
+    }
+
+    if (position == m_end)
+    {
+        SetError("Unterminated start tag");
+        return false;
+    }
+
+    m_nameData = name;
+    m_nameLength = nameEnd - name;
+    m_pendingIsEmpty = position[-1] == '/';
+    m_attributesBegin = nameEnd;
+    m_attributesEnd = m_pendingIsEmpty ? position - 1 : position;
+    m_elementPending = true;
+    m_position = position + 1;
+    return true;
+}
+
+bool XmlReader::ReadEndTag()
+{
+    const char* name = m_position + 2;
+    const char* nameEnd = ScanName(name);
+    const char* position = nameEnd;
+    while (position != m_end && IsWhitespace(*position)) ++position;
+    if (position == m_end || *position != '>')
+    {
+        SetError("Unterminated end tag");
+        return false;
+    }
+
+    if (m_openElements.empty())
+    {
+        SetError("Unexpected end tag");
+        return false;
+    }
+
+    const OpenElement& element = m_openElements.back();
+    if (static_cast<size_t>(nameEnd - name) != element.nameLength || memcmp(name, element.nameData, element.nameLength) != 0)
+    {
+        SetError("Mismatched end tag");
+        return false;
+    }
+
+    m_openElements.pop_back();
+    m_position = position + 1;
+    return true;
+}
+
+bool XmlReader::SkipPast(const char* terminator, size_t length)
+{
+    const char* found = std::search(m_position, m_end, terminator, terminator + length);
+    if (found == m_end)
+    {
+        SetError("Unterminated markup");
+        return false;
+    }
+    m_position = found + length;
+    return true;
+}
+
+bool XmlReader::SkipDoctype()
+{
+    // The internal subset of a document type declaration, in brackets, may contain closing angle brackets.
+    size_t depth = 0;
+    for (const char* position = m_position + 2; position != m_end; ++position)
+    {
+        if (*position == '[')
+        {
+            ++depth;
+        }
+        else if (*position == ']' && depth > 0)
+        {
+            --depth;
+        }
+        else if (*position == '>' && depth == 0)
+        {
+            m_position = position + 1;
+            return true;
+        }
+    }
+    SetError("Unterminated markup");
+    return false;
+}
+
+void XmlReader::AppendText(const char* begin, const char* end, Aws::String& text) const
+{
+    const char* run = begin;
+    const char* position = begin;
+    while (position != end)
+    {
+        char c = *position;
+        if (c == '&')
+        {
+            text.append(run, position);
+            const char* next = DecodeEntity(position, end, text);
+            if (next == position)
+            {
+                text.push_back('&');
+                ++next;
+            }
+            position = run = next;
+        }
+        else if (c == '\r')
+        {
+            // Line endings are normalized to line feeds, as XML parsers are required to.
+            text.append(run, position);
+            text.push_back('\n');
+            ++position;
+            if (position != end && *position == '\n')
+            {
+                ++position;
+            }
+            run = position;
+        }
+        else
+        {
+            ++position;
+        }
+    }
+    text.append(run, end);
+}
+
+const char* XmlReader::ScanName(const char* position) const
+{
+    while (position != m_end)
+    {
+        char c = *position;
+        if (IsWhitespace(c) || c == '/' || c == '>' || c == '<' || c == '=' || c == '"' || c == '\'')
+        {
+            break;
+        }
+        ++position;
+    }
+    return position;
+}
+
+void XmlReader::SetError(const char* message)
+{
+    if (m_errorMessage.empty())
+    {
+        Aws::StringStream ss;
+        ss << message << " at offset " << (m_position - m_begin);
+        m_errorMessage = ss.str();
+    }
+    m_position = m_end;
+    m_elementPending = false;
+}
@@ -6,6 +6,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/stream/ResponseBodyStream.h>
 #include <aws/core/external/tinyxml2/tinyxml2.h>
 
 #include <utility>
@@ -278,6 +279,18 @@ Aws::String XmlDocument::ConvertToString() const
 
 XmlDocument XmlDocument::CreateFromXmlStream(Aws::IOStream& xmlStream)
 {
+    Stream::ResponseBodyStream* bodyStream = Stream::ResponseBodyStream::FromStream(xmlStream);
+    if (bodyStream)
+    {
+        // Response bodies are parsed in place rather than copied out of the stream.
+        XmlDocument xmlDocument;
+        xmlDocument.InitDoc();
+        Stream::ResponseBodyStreamBuf& buffer = bodyStream->GetBuffer();
+        xmlDocument.m_doc->Parse(buffer.GetUnreadData(), buffer.GetUnreadLength());
+        buffer.pubseekoff(0, std::ios_base::end, std::ios_base::in);
+        return xmlDocument;
+    }
+
     Aws::String xmlString((Aws::IStreamBufIterator(xmlStream)), Aws::IStreamBufIterator());
     return CreateFromXmlString(xmlString);
 }
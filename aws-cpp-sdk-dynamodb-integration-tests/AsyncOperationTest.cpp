@@ -0,0 +1,358 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/DynamoDBErrors.h>
+#include <aws/dynamodb/model/GetItemRequest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+
+namespace
+{
+    static const char ALLOCATION_TAG[] = "AsyncOperationTest";
+    static const char THROTTLED_RESPONSE[] = "{\"__type\":\"com.amazonaws.dynamodb.v20120810#ProvisionedThroughputExceededException\","
+        "\"message\":\"The level of configured provisioned throughput for the table was exceeded.\"}";
+
+    /**
+     * Minimal HTTP/1.1 server on the loopback interface that answers DynamoDB GetItem calls with the requested key as the item.
+     * Responses are held back until the configured number of requests is in flight, so a test can tell whether the client
+     * keeps several requests outstanding at once, and the first few requests can be throttled to drive the retry path.
+     */
+    class LocalDynamoDBServer
+    {
+    public:
+        LocalDynamoDBServer(size_t requestsToHold, size_t requestsToThrottle) :
+            m_listenFd(-1), m_port(0), m_requestsToHold(requestsToHold), m_requestsToThrottle(requestsToThrottle),
+            m_requestCount(0), m_inFlight(0), m_maxInFlight(0), m_released(false)
+        {
+            m_listenFd = socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+            socklen_t length = sizeof(address);
+            if (m_listenFd < 0 || bind(m_listenFd, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+                listen(m_listenFd, 16) != 0 || getsockname(m_listenFd, reinterpret_cast<sockaddr*>(&address), &length) != 0)
+            {
+                return;
+            }
+            m_port = ntohs(address.sin_port);
+            m_acceptThread = std::thread(&LocalDynamoDBServer::Accept, this);
+        }
+
+        ~LocalDynamoDBServer()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                m_released = true;
+                for (int fd : m_connections)
+                {
+                    shutdown(fd, SHUT_RDWR);
+                }
+            }
+            m_cv.notify_all();
+            if (m_listenFd >= 0)
+            {
+                shutdown(m_listenFd, SHUT_RDWR);
+                close(m_listenFd);
+            }
+            if (m_acceptThread.joinable())
+            {
+                m_acceptThread.join();
+            }
+            for (auto& worker : m_workers)
+            {
+                worker.join();
+            }
+            for (int fd : m_connections)
+            {
+                close(fd);
+            }
+        }
+
+        unsigned short GetPort() const { return m_port; }
+        size_t GetRequestCount() const { return m_requestCount; }
+        size_t GetMaxInFlight() const { return m_maxInFlight; }
+
+        Aws::Vector<Aws::String> GetTargets() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_targets;
+        }
+
+    private:
+        void Accept()
+        {
+            for (;;)
+            {
+                int fd = accept(m_listenFd, nullptr, nullptr);
+                if (fd < 0)
+                {
+                    return;
+                }
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (m_released)
+                {
+                    close(fd);
+                    return;
+                }
+                m_connections.push_back(fd);
+                m_workers.emplace_back(&LocalDynamoDBServer::Serve, this, fd);
+            }
+        }
+
+        void Serve(int fd)
+        {
+            Aws::String buffer;
+            char chunk[4096];
+            for (;;)
+            {
+                size_t headerEnd = buffer.find("\r\n\r\n");
+                if (headerEnd == Aws::String::npos)
+                {
+                    ssize_t read = recv(fd, chunk, sizeof(chunk), 0);
+                    if (read <= 0)
+                    {
+                        return;
+                    }
+                    buffer.append(chunk, static_cast<size_t>(read));
+                    continue;
+                }
+
+                Aws::String target;
+                size_t contentLength = 0;
+                bool expectContinue = false;
+                for (const auto& line : StringUtils::Split(buffer.substr(0, headerEnd), '\n'))
+                {
+                    size_t colon = line.find(':');
+                    if (colon == Aws::String::npos)
+                    {
+                        continue;
+                    }
+                    Aws::String name = StringUtils::ToLower(line.substr(0, colon).c_str());
+                    Aws::String value = StringUtils::Trim(line.substr(colon + 1).c_str());
+                    if (name == "x-amz-target")
+                    {
+                        target = value;
+                    }
+                    else if (name == "content-length")
+                    {
+                        contentLength = static_cast<size_t>(StringUtils::ConvertToInt64(value.c_str()));
+                    }
+                    else if (name == "expect")
+                    {
+                        expectContinue = StringUtils::ToLower(value.c_str()) == "100-continue";
+                    }
+                }
+                // Without the interim response curl holds the body back for a second before sending it anyway.
+                if (expectContinue && buffer.size() < headerEnd + 4 + contentLength && !Send(fd, "HTTP/1.1 100 Continue\r\n\r\n"))
+                {
+                    return;
+                }
+                while (buffer.size() < headerEnd + 4 + contentLength)
+                {
+                    ssize_t read = recv(fd, chunk, sizeof(chunk), 0);
+                    if (read <= 0)
+                    {
+                        return;
+                    }
+                    buffer.append(chunk, static_cast<size_t>(read));
+                }
+                Aws::String body = buffer.substr(headerEnd + 4, contentLength);
+                buffer.erase(0, headerEnd + 4 + contentLength);
+
+                if (!Respond(fd, target, body))
+                {
+                    return;
+                }
+            }
+        }
+
+        bool Respond(int fd, const Aws::String& target, const Aws::String& body)
+        {
+            bool throttle = false;
+            {
+                std::unique_lock<std::mutex> locker(m_lock);
+                m_targets.push_back(target);
+                throttle = ++m_requestCount <= m_requestsToThrottle;
+                if (!throttle)
+                {
+                    m_inFlight++;
+                    m_maxInFlight = (std::max)(m_maxInFlight.load(), m_inFlight);
+                    m_cv.notify_all();
+                    // Never wait forever, a client that serializes its requests must fail the assertions rather than hang.
+                    m_cv.wait_for(locker, std::chrono::seconds(5), [this] { return m_released || m_maxInFlight >= m_requestsToHold; });
+                    m_inFlight--;
+                }
+            }
+
+            Aws::String payload;
+            Aws::String status;
+            if (throttle)
+            {
+                status = "400 Bad Request";
+                payload = THROTTLED_RESPONSE;
+            }
+            else
+            {
+                status = "200 OK";
+                JsonValue request(body);
+                JsonValue response;
+                response.WithObject("Item", request.View().GetObject("Key").Materialize());
+                payload = response.View().WriteCompact();
+            }
+
+            Aws::StringStream response;
+            response << "HTTP/1.1 " << status << "\r\n"
+                     << "Content-Type: application/x-amz-json-1.0\r\n"
+                     << "Content-Length: " << payload.size() << "\r\n"
+                     << "x-amzn-RequestId: " << ALLOCATION_TAG << "\r\n\r\n"
+                     << payload;
+            return Send(fd, response.str());
+        }
+
+        static bool Send(int fd, const Aws::String& raw)
+        {
+            size_t sent = 0;
+            while (sent < raw.size())
+            {
+                ssize_t written = send(fd, raw.c_str() + sent, raw.size() - sent, MSG_NOSIGNAL);
+                if (written <= 0)
+                {
+                    return false;
+                }
+                sent += static_cast<size_t>(written);
+            }
+            return true;
+        }
+
+        int m_listenFd;
+        unsigned short m_port;
+        size_t m_requestsToHold;
+        size_t m_requestsToThrottle;
+        std::atomic<size_t> m_requestCount;
+        size_t m_inFlight;
+        std::atomic<size_t> m_maxInFlight;
+        bool m_released;
+        mutable std::mutex m_lock;
+        std::condition_variable m_cv;
+        Aws::Vector<Aws::String> m_targets;
+        Aws::Vector<int> m_connections;
+        std::thread m_acceptThread;
+        Aws::Vector<std::thread> m_workers;
+    };
+
+    ClientConfiguration LocalClientConfiguration(const LocalDynamoDBServer& server, size_t executorThreads)
+    {
+        ClientConfiguration config;
+        config.region = "us-east-1";
+        config.scheme = Scheme::HTTP;
+        config.endpointOverride = "127.0.0.1:" + StringUtils::to_string(server.GetPort());
+        config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+        config.connectTimeoutMs = 5000;
+        config.requestTimeoutMs = 10000;
+        config.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, executorThreads);
+        return config;
+    }
+
+    GetItemRequest MakeGetItemRequest(const Aws::String& id)
+    {
+        GetItemRequest request;
+        request.SetTableName("Music");
+        request.AddKey("Id", AttributeValue().SetS(id));
+        return request;
+    }
+
+    TEST(AsyncOperationTest, TestGetItemAsyncKeepsRequestsInFlightWithSingleExecutorThread)
+    {
+        static const size_t REQUEST_COUNT = 4;
+        LocalDynamoDBServer server(REQUEST_COUNT, 0);
+        ASSERT_NE(0, server.GetPort());
+
+        Aws::Vector<std::promise<GetItemOutcome>> outcomes(REQUEST_COUNT);
+        {
+            // One executor thread: if a call held it while waiting for its response, the server would only ever see one request.
+            DynamoDBClient client(Aws::Auth::AWSCredentials("akid", "secret"), LocalClientConfiguration(server, 1));
+            for (size_t i = 0; i < REQUEST_COUNT; ++i)
+            {
+                client.GetItemAsync(MakeGetItemRequest("song-" + StringUtils::to_string(i)),
+                    [&outcomes, i](const DynamoDBClient*, const GetItemRequest&, const GetItemOutcome& outcome, const std::shared_ptr<const AsyncCallerContext>&)
+                    {
+                        outcomes[i].set_value(outcome);
+                    });
+            }
+
+            for (size_t i = 0; i < REQUEST_COUNT; ++i)
+            {
+                auto future = outcomes[i].get_future();
+                ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(30)));
+                auto outcome = future.get();
+                ASSERT_TRUE(outcome.IsSuccess()) << outcome.GetError().GetMessage();
+                ASSERT_EQ("song-" + StringUtils::to_string(i), outcome.GetResult().GetItem().at("Id").GetS());
+            }
+        }
+
+        ASSERT_EQ(REQUEST_COUNT, server.GetRequestCount());
+        ASSERT_EQ(REQUEST_COUNT, server.GetMaxInFlight());
+        for (const auto& target : server.GetTargets())
+        {
+            ASSERT_EQ("DynamoDB_20120810.GetItem", target);
+        }
+    }
+
+    TEST(AsyncOperationTest, TestGetItemAsyncRetriesThrottledRequest)
+    {
+        LocalDynamoDBServer server(1, 1);
+        ASSERT_NE(0, server.GetPort());
+
+        std::promise<GetItemOutcome> result;
+        {
+            DynamoDBClient client(Aws::Auth::AWSCredentials("akid", "secret"), LocalClientConfiguration(server, 1));
+            client.GetItemAsync(MakeGetItemRequest("retried"),
+                [&result](const DynamoDBClient*, const GetItemRequest&, const GetItemOutcome& outcome, const std::shared_ptr<const AsyncCallerContext>&)
+                {
+                    result.set_value(outcome);
+                });
+
+            auto future = result.get_future();
+            ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(30)));
+            auto outcome = future.get();
+            ASSERT_TRUE(outcome.IsSuccess()) << outcome.GetError().GetMessage();
+            ASSERT_EQ("retried", outcome.GetResult().GetItem().at("Id").GetS());
+        }
+
+        ASSERT_EQ(2u, server.GetRequestCount());
+    }
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
@@ -0,0 +1,120 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/dynamodb/model/DescribeTableResult.h>
+#include <aws/dynamodb/model/GetItemResult.h>
+#include <aws/dynamodb/model/QueryResult.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+using namespace Aws::DynamoDB::Model;
+
+namespace
+{
+    // Response bodies as DynamoDB returns them, every attribute value type appears at least once.
+    static const char GET_ITEM_RESPONSE[] = "{\"ConsumedCapacity\":{\"CapacityUnits\":0.5,\"TableName\":\"Music\"},"
+        "\"Item\":{\"Artist\":{\"S\":\"No One You Know\"},\"Plays\":{\"N\":\"42\"},\"Cover\":{\"B\":\"AAEC\"},"
+        "\"Tags\":{\"SS\":[\"indie\",\"live\"]},\"Durations\":{\"NS\":[\"181\",\"240.5\"]},\"Samples\":{\"BS\":[\"AQ==\",\"Ag==\"]},"
+        "\"Ratings\":{\"L\":[{\"N\":\"1\"},{\"S\":\"five\"}]},"
+        "\"Details\":{\"M\":{\"Explicit\":{\"BOOL\":true},\"Label\":{\"NULL\":true},\"Nested\":{\"M\":{\"Year\":{\"N\":\"1999\"}}}}}}}";
+
+    static const char QUERY_RESPONSE[] = "{\"Count\":2,\"Items\":["
+        "{\"Artist\":{\"S\":\"No One You Know\"},\"SongTitle\":{\"S\":\"Call Me Today\"}},"
+        "{\"Artist\":{\"S\":\"No One You Know\"},\"SongTitle\":{\"S\":\"Scared of My Shadow\"}}],"
+        "\"LastEvaluatedKey\":{\"Artist\":{\"S\":\"No One You Know\"},\"SongTitle\":{\"S\":\"Scared of My Shadow\"}},"
+        "\"ScannedCount\":3,\"UnknownMember\":{\"Ignored\":[1,2,{\"Deep\":null}]}}";
+
+    static const char DESCRIBE_TABLE_RESPONSE[] = "{\"Table\":{"
+        "\"AttributeDefinitions\":[{\"AttributeName\":\"Artist\",\"AttributeType\":\"S\"},{\"AttributeName\":\"SongTitle\",\"AttributeType\":\"S\"}],"
+        "\"CreationDateTime\":1.421866952062E9,\"ItemCount\":7,"
+        "\"KeySchema\":[{\"AttributeName\":\"Artist\",\"KeyType\":\"HASH\"},{\"AttributeName\":\"SongTitle\",\"KeyType\":\"RANGE\"}],"
+        "\"ProvisionedThroughput\":{\"NumberOfDecreasesToday\":0,\"ReadCapacityUnits\":5,\"WriteCapacityUnits\":5},"
+        "\"TableArn\":\"arn:aws:dynamodb:us-west-2:123456789012:table/Music\",\"TableName\":\"Music\","
+        "\"TableSizeBytes\":1024,\"TableStatus\":\"ACTIVE\"}}";
+
+    template<typename RESULT>
+    RESULT ResultFromJsonValue(const char* body)
+    {
+        return RESULT(Aws::AmazonWebServiceResult<JsonValue>(JsonValue(body), HeaderValueCollection()));
+    }
+
+    template<typename RESULT>
+    RESULT ResultFromJsonReader(const char* body)
+    {
+        return RESULT(Aws::AmazonWebServiceResult<JsonReader>(JsonReader(body, strlen(body)), HeaderValueCollection()));
+    }
+
+    TEST(ModelJsonReaderTest, TestGetItemResult)
+    {
+        auto result = ResultFromJsonReader<GetItemResult>(GET_ITEM_RESPONSE);
+        const auto& item = result.GetItem();
+        ASSERT_EQ(8u, item.size());
+        ASSERT_EQ("No One You Know", item.at("Artist").GetS());
+        ASSERT_EQ("42", item.at("Plays").GetN());
+        ASSERT_EQ(HashingUtils::Base64Decode("AAEC"), item.at("Cover").GetB());
+        ASSERT_EQ(Aws::Vector<Aws::String>({"indie", "live"}), item.at("Tags").GetSS());
+        ASSERT_EQ(Aws::Vector<Aws::String>({"181", "240.5"}), item.at("Durations").GetNS());
+        ASSERT_EQ(2u, item.at("Samples").GetBS().size());
+        ASSERT_EQ(2u, item.at("Ratings").GetL().size());
+        ASSERT_EQ("five", item.at("Ratings").GetL()[1]->GetS());
+        const auto& details = item.at("Details").GetM();
+        ASSERT_TRUE(details.at("Explicit")->GetBool());
+        ASSERT_TRUE(details.at("Label")->GetNull());
+        ASSERT_EQ("1999", details.at("Nested")->GetM().at("Year")->GetN());
+        ASSERT_EQ("Music", result.GetConsumedCapacity().GetTableName());
+        ASSERT_EQ(0.5, result.GetConsumedCapacity().GetCapacityUnits());
+
+        // Both ways of reading the payload build the same model.
+        auto expected = ResultFromJsonValue<GetItemResult>(GET_ITEM_RESPONSE);
+        ASSERT_EQ(expected.GetItem(), item);
+        ASSERT_EQ(expected.GetConsumedCapacity().Jsonize().View().WriteCompact(), result.GetConsumedCapacity().Jsonize().View().WriteCompact());
+    }
+
+    TEST(ModelJsonReaderTest, TestQueryResultSkipsUnknownMembers)
+    {
+        auto result = ResultFromJsonReader<QueryResult>(QUERY_RESPONSE);
+        ASSERT_EQ(2, result.GetCount());
+        ASSERT_EQ(3, result.GetScannedCount());
+        ASSERT_EQ(2u, result.GetItems().size());
+        ASSERT_EQ("Scared of My Shadow", result.GetItems()[1].at("SongTitle").GetS());
+        ASSERT_EQ("Scared of My Shadow", result.GetLastEvaluatedKey().at("SongTitle").GetS());
+
+        auto expected = ResultFromJsonValue<QueryResult>(QUERY_RESPONSE);
+        ASSERT_EQ(expected.GetItems(), result.GetItems());
+        ASSERT_EQ(expected.GetLastEvaluatedKey(), result.GetLastEvaluatedKey());
+    }
+
+    TEST(ModelJsonReaderTest, TestDescribeTableResult)
+    {
+        auto result = ResultFromJsonReader<DescribeTableResult>(DESCRIBE_TABLE_RESPONSE);
+        const auto& table = result.GetTable();
+        ASSERT_EQ("Music", table.GetTableName());
+        ASSERT_EQ(TableStatus::ACTIVE, table.GetTableStatus());
+        ASSERT_EQ(7, table.GetItemCount());
+        ASSERT_EQ(1024, table.GetTableSizeBytes());
+        ASSERT_EQ(2u, table.GetKeySchema().size());
+        ASSERT_EQ(KeyType::RANGE, table.GetKeySchema()[1].GetKeyType());
+        ASSERT_EQ(ScalarAttributeType::S, table.GetAttributeDefinitions()[0].GetAttributeType());
+        ASSERT_EQ(5, table.GetProvisionedThroughput().GetReadCapacityUnits());
+        ASSERT_EQ(1421866952062, table.GetCreationDateTime().Millis());
+
+        auto expected = ResultFromJsonValue<DescribeTableResult>(DESCRIBE_TABLE_RESPONSE);
+        ASSERT_EQ(expected.GetTable().Jsonize().View().WriteCompact(), table.Jsonize().View().WriteCompact());
+    }
+
+    TEST(ModelJsonReaderTest, TestEmptyPayload)
+    {
+        auto result = GetItemResult(Aws::AmazonWebServiceResult<JsonReader>(JsonReader(), HeaderValueCollection()));
+        ASSERT_TRUE(result.GetItem().empty());
+    }
+}
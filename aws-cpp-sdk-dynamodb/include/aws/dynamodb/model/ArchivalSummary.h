@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -35,6 +36,8 @@ namespace Model
     ArchivalSummary();
     ArchivalSummary(Aws::Utils::Json::JsonView jsonValue);
     ArchivalSummary& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ArchivalSummary(Aws::Utils::Json::JsonReader& reader);
+    ArchivalSummary& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
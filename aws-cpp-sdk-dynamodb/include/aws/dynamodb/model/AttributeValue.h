@@ -10,6 +10,7 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 namespace Aws
 {
@@ -29,6 +30,7 @@ public:
     explicit AttributeValue(const Aws::String& s) { SetS(s); }
     explicit AttributeValue(const Aws::Vector<Aws::String>& ss) { SetSS(ss); }
     AttributeValue(Aws::Utils::Json::JsonView jsonValue) { *this = jsonValue; }
+    AttributeValue(Aws::Utils::Json::JsonReader& reader) { *this = reader; }
 
     /// returns the String value if the value is specialized to this type, otherwise an empty String
     const Aws::String GetS() const;
@@ -156,6 +158,7 @@ public:
     AttributeValue& SetNull(bool value);
 
     AttributeValue& operator = (Aws::Utils::Json::JsonView);
+    AttributeValue& operator = (Aws::Utils::Json::JsonReader& reader);
 
     bool operator == (const AttributeValue& other) const;
     inline bool operator != (const AttributeValue& other) const { return !(*this == other); }
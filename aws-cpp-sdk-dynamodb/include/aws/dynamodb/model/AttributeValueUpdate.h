@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -43,6 +44,8 @@ namespace Model
     AttributeValueUpdate();
     AttributeValueUpdate(Aws::Utils::Json::JsonView jsonValue);
     AttributeValueUpdate& operator=(Aws::Utils::Json::JsonView jsonValue);
+    AttributeValueUpdate(Aws::Utils::Json::JsonReader& reader);
+    AttributeValueUpdate& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
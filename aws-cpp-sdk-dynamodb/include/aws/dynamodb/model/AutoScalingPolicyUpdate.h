@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     AutoScalingPolicyUpdate();
     AutoScalingPolicyUpdate(Aws::Utils::Json::JsonView jsonValue);
     AutoScalingPolicyUpdate& operator=(Aws::Utils::Json::JsonView jsonValue);
+    AutoScalingPolicyUpdate(Aws::Utils::Json::JsonReader& reader);
+    AutoScalingPolicyUpdate& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -37,6 +38,8 @@ namespace Model
     AutoScalingSettingsDescription();
     AutoScalingSettingsDescription(Aws::Utils::Json::JsonView jsonValue);
     AutoScalingSettingsDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    AutoScalingSettingsDescription(Aws::Utils::Json::JsonReader& reader);
+    AutoScalingSettingsDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -33,6 +34,8 @@ namespace Model
     AutoScalingTargetTrackingScalingPolicyConfigurationDescription();
     AutoScalingTargetTrackingScalingPolicyConfigurationDescription(Aws::Utils::Json::JsonView jsonValue);
     AutoScalingTargetTrackingScalingPolicyConfigurationDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    AutoScalingTargetTrackingScalingPolicyConfigurationDescription(Aws::Utils::Json::JsonReader& reader);
+    AutoScalingTargetTrackingScalingPolicyConfigurationDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -33,6 +34,8 @@ namespace Model
     AutoScalingTargetTrackingScalingPolicyConfigurationUpdate();
     AutoScalingTargetTrackingScalingPolicyConfigurationUpdate(Aws::Utils::Json::JsonView jsonValue);
     AutoScalingTargetTrackingScalingPolicyConfigurationUpdate& operator=(Aws::Utils::Json::JsonView jsonValue);
+    AutoScalingTargetTrackingScalingPolicyConfigurationUpdate(Aws::Utils::Json::JsonReader& reader);
+    AutoScalingTargetTrackingScalingPolicyConfigurationUpdate& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
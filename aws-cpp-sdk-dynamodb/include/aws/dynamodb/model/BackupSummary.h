@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -37,6 +38,8 @@ namespace Model
     BackupSummary();
     BackupSummary(Aws::Utils::Json::JsonView jsonValue);
     BackupSummary& operator=(Aws::Utils::Json::JsonView jsonValue);
+    BackupSummary(Aws::Utils::Json::JsonReader& reader);
+    BackupSummary& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
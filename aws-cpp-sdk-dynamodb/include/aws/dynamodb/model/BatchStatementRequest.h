@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     BatchStatementRequest();
     BatchStatementRequest(Aws::Utils::Json::JsonView jsonValue);
     BatchStatementRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
+    BatchStatementRequest(Aws::Utils::Json::JsonReader& reader);
+    BatchStatementRequest& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
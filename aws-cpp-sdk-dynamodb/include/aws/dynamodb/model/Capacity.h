@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -33,6 +34,8 @@ namespace Model
     Capacity();
     Capacity(Aws::Utils::Json::JsonView jsonValue);
     Capacity& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Capacity(Aws::Utils::Json::JsonReader& reader);
+    Capacity& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -46,6 +47,8 @@ namespace Model
     Condition();
     Condition(Aws::Utils::Json::JsonView jsonValue);
     Condition& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Condition(Aws::Utils::Json::JsonReader& reader);
+    Condition& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -42,6 +43,8 @@ namespace Model
     ConsumedCapacity();
     ConsumedCapacity(Aws::Utils::Json::JsonView jsonValue);
     ConsumedCapacity& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ConsumedCapacity(Aws::Utils::Json::JsonReader& reader);
+    ConsumedCapacity& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
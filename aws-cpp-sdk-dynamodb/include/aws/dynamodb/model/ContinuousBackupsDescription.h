@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     ContinuousBackupsDescription();
     ContinuousBackupsDescription(Aws::Utils::Json::JsonView jsonValue);
     ContinuousBackupsDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ContinuousBackupsDescription(Aws::Utils::Json::JsonReader& reader);
+    ContinuousBackupsDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
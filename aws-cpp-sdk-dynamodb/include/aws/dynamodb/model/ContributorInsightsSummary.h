@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     ContributorInsightsSummary();
     ContributorInsightsSummary(Aws::Utils::Json::JsonView jsonValue);
     ContributorInsightsSummary& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ContributorInsightsSummary(Aws::Utils::Json::JsonReader& reader);
+    ContributorInsightsSummary& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -20,6 +20,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     CreateGlobalSecondaryIndexAction();
     CreateGlobalSecondaryIndexAction(Aws::Utils::Json::JsonView jsonValue);
     CreateGlobalSecondaryIndexAction& operator=(Aws::Utils::Json::JsonView jsonValue);
+    CreateGlobalSecondaryIndexAction(Aws::Utils::Json::JsonReader& reader);
+    CreateGlobalSecondaryIndexAction& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -30,6 +31,8 @@ namespace Model
     CreateGlobalTableResult();
     CreateGlobalTableResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     CreateGlobalTableResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    CreateGlobalTableResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonReader>& result);
+    CreateGlobalTableResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonReader>& result);
 
 
     /**
@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -35,6 +36,8 @@ namespace Model
     DeleteGlobalSecondaryIndexAction();
     DeleteGlobalSecondaryIndexAction(Aws::Utils::Json::JsonView jsonValue);
     DeleteGlobalSecondaryIndexAction& operator=(Aws::Utils::Json::JsonView jsonValue);
+    DeleteGlobalSecondaryIndexAction(Aws::Utils::Json::JsonReader& reader);
+    DeleteGlobalSecondaryIndexAction& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
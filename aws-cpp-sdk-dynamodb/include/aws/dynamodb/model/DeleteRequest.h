@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -37,6 +38,8 @@ namespace Model
     DeleteRequest();
     DeleteRequest(Aws::Utils::Json::JsonView jsonValue);
     DeleteRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
+    DeleteRequest(Aws::Utils::Json::JsonReader& reader);
+    DeleteRequest& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
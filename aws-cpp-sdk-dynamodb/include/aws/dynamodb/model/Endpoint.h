@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -34,6 +35,8 @@ namespace Model
     Endpoint();
     Endpoint(Aws::Utils::Json::JsonView jsonValue);
     Endpoint& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Endpoint(Aws::Utils::Json::JsonReader& reader);
+    Endpoint& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
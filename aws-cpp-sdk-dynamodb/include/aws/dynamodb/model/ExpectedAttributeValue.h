@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -54,6 +55,8 @@ namespace Model
     ExpectedAttributeValue();
     ExpectedAttributeValue(Aws::Utils::Json::JsonView jsonValue);
     ExpectedAttributeValue& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ExpectedAttributeValue(Aws::Utils::Json::JsonReader& reader);
+    ExpectedAttributeValue& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
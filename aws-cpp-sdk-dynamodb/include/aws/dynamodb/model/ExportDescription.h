@@ -20,6 +20,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     ExportDescription();
     ExportDescription(Aws::Utils::Json::JsonView jsonValue);
     ExportDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ExportDescription(Aws::Utils::Json::JsonReader& reader);
+    ExportDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -35,6 +36,8 @@ namespace Model
     FailureException();
     FailureException(Aws::Utils::Json::JsonView jsonValue);
     FailureException& operator=(Aws::Utils::Json::JsonView jsonValue);
+    FailureException(Aws::Utils::Json::JsonReader& reader);
+    FailureException& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
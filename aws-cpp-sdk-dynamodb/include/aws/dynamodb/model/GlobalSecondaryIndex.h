@@ -20,6 +20,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     GlobalSecondaryIndex();
     GlobalSecondaryIndex(Aws::Utils::Json::JsonView jsonValue);
     GlobalSecondaryIndex& operator=(Aws::Utils::Json::JsonView jsonValue);
+    GlobalSecondaryIndex(Aws::Utils::Json::JsonReader& reader);
+    GlobalSecondaryIndex& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -40,6 +41,8 @@ namespace Model
     GlobalSecondaryIndexUpdate();
     GlobalSecondaryIndexUpdate(Aws::Utils::Json::JsonView jsonValue);
     GlobalSecondaryIndexUpdate& operator=(Aws::Utils::Json::JsonView jsonValue);
+    GlobalSecondaryIndexUpdate(Aws::Utils::Json::JsonReader& reader);
+    GlobalSecondaryIndexUpdate& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
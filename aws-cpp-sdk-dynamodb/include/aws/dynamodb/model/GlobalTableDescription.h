@@ -20,6 +20,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     GlobalTableDescription();
     GlobalTableDescription(Aws::Utils::Json::JsonView jsonValue);
     GlobalTableDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    GlobalTableDescription(Aws::Utils::Json::JsonReader& reader);
+    GlobalTableDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
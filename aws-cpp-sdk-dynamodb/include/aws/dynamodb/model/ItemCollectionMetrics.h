@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -40,6 +41,8 @@ namespace Model
     ItemCollectionMetrics();
     ItemCollectionMetrics(Aws::Utils::Json::JsonView jsonValue);
     ItemCollectionMetrics& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ItemCollectionMetrics(Aws::Utils::Json::JsonReader& reader);
+    ItemCollectionMetrics& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     ItemResponse();
     ItemResponse(Aws::Utils::Json::JsonView jsonValue);
     ItemResponse& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ItemResponse(Aws::Utils::Json::JsonReader& reader);
+    ItemResponse& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -44,6 +45,8 @@ namespace Model
     KeySchemaElement();
     KeySchemaElement(Aws::Utils::Json::JsonView jsonValue);
     KeySchemaElement& operator=(Aws::Utils::Json::JsonView jsonValue);
+    KeySchemaElement(Aws::Utils::Json::JsonReader& reader);
+    KeySchemaElement& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
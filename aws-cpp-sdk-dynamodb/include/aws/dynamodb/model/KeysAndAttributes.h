@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -42,6 +43,8 @@ namespace Model
     KeysAndAttributes();
     KeysAndAttributes(Aws::Utils::Json::JsonView jsonValue);
     KeysAndAttributes& operator=(Aws::Utils::Json::JsonView jsonValue);
+    KeysAndAttributes(Aws::Utils::Json::JsonReader& reader);
+    KeysAndAttributes& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
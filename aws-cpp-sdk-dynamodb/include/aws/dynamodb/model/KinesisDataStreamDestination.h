@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -35,6 +36,8 @@ namespace Model
     KinesisDataStreamDestination();
     KinesisDataStreamDestination(Aws::Utils::Json::JsonView jsonValue);
     KinesisDataStreamDestination& operator=(Aws::Utils::Json::JsonView jsonValue);
+    KinesisDataStreamDestination(Aws::Utils::Json::JsonReader& reader);
+    KinesisDataStreamDestination& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
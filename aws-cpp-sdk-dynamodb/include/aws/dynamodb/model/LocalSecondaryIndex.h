@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     LocalSecondaryIndex();
     LocalSecondaryIndex(Aws::Utils::Json::JsonView jsonValue);
     LocalSecondaryIndex& operator=(Aws::Utils::Json::JsonView jsonValue);
+    LocalSecondaryIndex(Aws::Utils::Json::JsonReader& reader);
+    LocalSecondaryIndex& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
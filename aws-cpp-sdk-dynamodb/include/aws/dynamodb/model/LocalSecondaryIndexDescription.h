@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     LocalSecondaryIndexDescription();
     LocalSecondaryIndexDescription(Aws::Utils::Json::JsonView jsonValue);
     LocalSecondaryIndexDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    LocalSecondaryIndexDescription(Aws::Utils::Json::JsonReader& reader);
+    LocalSecondaryIndexDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -37,6 +38,8 @@ namespace Model
     ParameterizedStatement();
     ParameterizedStatement(Aws::Utils::Json::JsonView jsonValue);
     ParameterizedStatement& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ParameterizedStatement(Aws::Utils::Json::JsonReader& reader);
+    ParameterizedStatement& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -33,6 +34,8 @@ namespace Model
     PointInTimeRecoverySpecification();
     PointInTimeRecoverySpecification(Aws::Utils::Json::JsonView jsonValue);
     PointInTimeRecoverySpecification& operator=(Aws::Utils::Json::JsonView jsonValue);
+    PointInTimeRecoverySpecification(Aws::Utils::Json::JsonReader& reader);
+    PointInTimeRecoverySpecification& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     Projection();
     Projection(Aws::Utils::Json::JsonView jsonValue);
     Projection& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Projection(Aws::Utils::Json::JsonReader& reader);
+    Projection& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     ProvisionedThroughput();
     ProvisionedThroughput(Aws::Utils::Json::JsonView jsonValue);
     ProvisionedThroughput& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ProvisionedThroughput(Aws::Utils::Json::JsonReader& reader);
+    ProvisionedThroughput& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
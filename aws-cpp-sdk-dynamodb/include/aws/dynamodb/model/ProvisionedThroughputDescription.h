@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     ProvisionedThroughputDescription();
     ProvisionedThroughputDescription(Aws::Utils::Json::JsonView jsonValue);
     ProvisionedThroughputDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ProvisionedThroughputDescription(Aws::Utils::Json::JsonReader& reader);
+    ProvisionedThroughputDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
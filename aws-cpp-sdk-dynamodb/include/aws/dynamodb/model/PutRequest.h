@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -37,6 +38,8 @@ namespace Model
     PutRequest();
     PutRequest(Aws::Utils::Json::JsonView jsonValue);
     PutRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
+    PutRequest(Aws::Utils::Json::JsonReader& reader);
+    PutRequest& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -34,6 +35,8 @@ namespace Model
     Replica();
     Replica(Aws::Utils::Json::JsonView jsonValue);
     Replica& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Replica(Aws::Utils::Json::JsonReader& reader);
+    Replica& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
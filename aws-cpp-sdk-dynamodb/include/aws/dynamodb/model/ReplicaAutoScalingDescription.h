@@ -20,6 +20,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     ReplicaAutoScalingDescription();
     ReplicaAutoScalingDescription(Aws::Utils::Json::JsonView jsonValue);
     ReplicaAutoScalingDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ReplicaAutoScalingDescription(Aws::Utils::Json::JsonReader& reader);
+    ReplicaAutoScalingDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -21,6 +21,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     ReplicaDescription();
     ReplicaDescription(Aws::Utils::Json::JsonView jsonValue);
     ReplicaDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ReplicaDescription(Aws::Utils::Json::JsonReader& reader);
+    ReplicaDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
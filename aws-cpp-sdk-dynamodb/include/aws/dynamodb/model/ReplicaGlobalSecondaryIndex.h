@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     ReplicaGlobalSecondaryIndex();
     ReplicaGlobalSecondaryIndex(Aws::Utils::Json::JsonView jsonValue);
     ReplicaGlobalSecondaryIndex& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ReplicaGlobalSecondaryIndex(Aws::Utils::Json::JsonReader& reader);
+    ReplicaGlobalSecondaryIndex& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -36,6 +37,8 @@ namespace Model
     ReplicaGlobalSecondaryIndexDescription();
     ReplicaGlobalSecondaryIndexDescription(Aws::Utils::Json::JsonView jsonValue);
     ReplicaGlobalSecondaryIndexDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ReplicaGlobalSecondaryIndexDescription(Aws::Utils::Json::JsonReader& reader);
+    ReplicaGlobalSecondaryIndexDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -21,6 +21,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     ReplicaSettingsDescription();
     ReplicaSettingsDescription(Aws::Utils::Json::JsonView jsonValue);
     ReplicaSettingsDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ReplicaSettingsDescription(Aws::Utils::Json::JsonReader& reader);
+    ReplicaSettingsDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
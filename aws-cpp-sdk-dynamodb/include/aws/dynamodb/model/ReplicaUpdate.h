@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     ReplicaUpdate();
     ReplicaUpdate(Aws::Utils::Json::JsonView jsonValue);
     ReplicaUpdate& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ReplicaUpdate(Aws::Utils::Json::JsonReader& reader);
+    ReplicaUpdate& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -44,6 +45,8 @@ namespace Model
     ReplicationGroupUpdate();
     ReplicationGroupUpdate(Aws::Utils::Json::JsonView jsonValue);
     ReplicationGroupUpdate& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ReplicationGroupUpdate(Aws::Utils::Json::JsonReader& reader);
+    ReplicationGroupUpdate& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
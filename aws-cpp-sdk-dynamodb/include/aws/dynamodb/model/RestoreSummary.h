@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -35,6 +36,8 @@ namespace Model
     RestoreSummary();
     RestoreSummary(Aws::Utils::Json::JsonView jsonValue);
     RestoreSummary& operator=(Aws::Utils::Json::JsonView jsonValue);
+    RestoreSummary(Aws::Utils::Json::JsonReader& reader);
+    RestoreSummary& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
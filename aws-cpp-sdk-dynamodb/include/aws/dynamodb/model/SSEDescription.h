@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     SSEDescription();
     SSEDescription(Aws::Utils::Json::JsonView jsonValue);
     SSEDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    SSEDescription(Aws::Utils::Json::JsonReader& reader);
+    SSEDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
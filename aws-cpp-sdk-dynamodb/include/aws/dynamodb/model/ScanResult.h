@@ -22,6 +22,7 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -40,6 +41,8 @@ namespace Model
     ScanResult();
     ScanResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     ScanResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    ScanResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonReader>& result);
+    ScanResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonReader>& result);
 
 
     /**
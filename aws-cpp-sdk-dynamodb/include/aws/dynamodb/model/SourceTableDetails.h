@@ -21,6 +21,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -40,6 +41,8 @@ namespace Model
     SourceTableDetails();
     SourceTableDetails(Aws::Utils::Json::JsonView jsonValue);
     SourceTableDetails& operator=(Aws::Utils::Json::JsonView jsonValue);
+    SourceTableDetails(Aws::Utils::Json::JsonReader& reader);
+    SourceTableDetails& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -21,6 +21,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -40,6 +41,8 @@ namespace Model
     SourceTableFeatureDetails();
     SourceTableFeatureDetails(Aws::Utils::Json::JsonView jsonValue);
     SourceTableFeatureDetails& operator=(Aws::Utils::Json::JsonView jsonValue);
+    SourceTableFeatureDetails(Aws::Utils::Json::JsonReader& reader);
+    SourceTableFeatureDetails& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -35,6 +36,8 @@ namespace Model
     StreamSpecification();
     StreamSpecification(Aws::Utils::Json::JsonView jsonValue);
     StreamSpecification& operator=(Aws::Utils::Json::JsonView jsonValue);
+    StreamSpecification(Aws::Utils::Json::JsonReader& reader);
+    StreamSpecification& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     TableAutoScalingDescription();
     TableAutoScalingDescription(Aws::Utils::Json::JsonView jsonValue);
     TableAutoScalingDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    TableAutoScalingDescription(Aws::Utils::Json::JsonReader& reader);
+    TableAutoScalingDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
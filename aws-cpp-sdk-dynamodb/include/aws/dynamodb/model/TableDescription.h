@@ -30,6 +30,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -48,6 +49,8 @@ namespace Model
     TableDescription();
     TableDescription(Aws::Utils::Json::JsonView jsonValue);
     TableDescription& operator=(Aws::Utils::Json::JsonView jsonValue);
+    TableDescription(Aws::Utils::Json::JsonReader& reader);
+    TableDescription& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
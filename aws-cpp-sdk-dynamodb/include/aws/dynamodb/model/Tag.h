@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -43,6 +44,8 @@ namespace Model
     Tag();
     Tag(Aws::Utils::Json::JsonView jsonValue);
     Tag& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Tag(Aws::Utils::Json::JsonReader& reader);
+    Tag& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -35,6 +36,8 @@ namespace Model
     TransactGetItem();
     TransactGetItem(Aws::Utils::Json::JsonView jsonValue);
     TransactGetItem& operator=(Aws::Utils::Json::JsonView jsonValue);
+    TransactGetItem(Aws::Utils::Json::JsonReader& reader);
+    TransactGetItem& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     TransactWriteItem();
     TransactWriteItem(Aws::Utils::Json::JsonView jsonValue);
     TransactWriteItem& operator=(Aws::Utils::Json::JsonView jsonValue);
+    TransactWriteItem(Aws::Utils::Json::JsonReader& reader);
+    TransactWriteItem& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
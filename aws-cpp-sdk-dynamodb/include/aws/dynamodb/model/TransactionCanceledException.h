@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -106,6 +107,8 @@ namespace Model
     TransactionCanceledException();
     TransactionCanceledException(Aws::Utils::Json::JsonView jsonValue);
     TransactionCanceledException& operator=(Aws::Utils::Json::JsonView jsonValue);
+    TransactionCanceledException(Aws::Utils::Json::JsonReader& reader);
+    TransactionCanceledException& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,8 @@ namespace Model
     Update();
     Update(Aws::Utils::Json::JsonView jsonValue);
     Update& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Update(Aws::Utils::Json::JsonReader& reader);
+    Update& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -37,6 +38,8 @@ namespace Model
     UpdateReplicationGroupMemberAction();
     UpdateReplicationGroupMemberAction(Aws::Utils::Json::JsonView jsonValue);
     UpdateReplicationGroupMemberAction& operator=(Aws::Utils::Json::JsonView jsonValue);
+    UpdateReplicationGroupMemberAction(Aws::Utils::Json::JsonReader& reader);
+    UpdateReplicationGroupMemberAction& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -39,6 +40,8 @@ namespace Model
     WriteRequest();
     WriteRequest(Aws::Utils::Json::JsonView jsonValue);
     WriteRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
+    WriteRequest(Aws::Utils::Json::JsonReader& reader);
+    WriteRequest& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -12,6 +12,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -137,6 +138,7 @@ void DynamoDBClient::init(const ClientConfiguration& config)
   else
   {
     m_enableEndpointDiscovery = config.enableEndpointDiscovery;
+    m_endpointsCache.SetExecutor(m_executor);
   }
 }
 
@@ -159,7 +161,7 @@ BatchExecuteStatementOutcome DynamoDBClient::BatchExecuteStatement(const BatchEx
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return BatchExecuteStatementOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return BatchExecuteStatementOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 BatchExecuteStatementOutcomeCallable DynamoDBClient::BatchExecuteStatementCallable(const BatchExecuteStatementRequest& request) const
@@ -177,7 +179,19 @@ void DynamoDBClient::BatchExecuteStatementAsync(const BatchExecuteStatementReque
 
 void DynamoDBClient::BatchExecuteStatementAsyncHelper(const BatchExecuteStatementRequest& request, const BatchExecuteStatementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, BatchExecuteStatement(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, BatchExecuteStatement(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<BatchExecuteStatementRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, BatchExecuteStatementOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& request) const
@@ -186,34 +200,36 @@ BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& requ
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("BatchGetItem", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("BatchGetItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("BatchGetItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("BatchGetItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("BatchGetItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return BatchGetItemOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return BatchGetItemOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetItemRequest& request) const
@@ -231,7 +247,48 @@ void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const
 
 void DynamoDBClient::BatchGetItemAsyncHelper(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, BatchGetItem(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, BatchGetItem(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("BatchGetItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("BatchGetItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("BatchGetItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<BatchGetItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, BatchGetItemOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest& request) const
@@ -240,34 +297,36 @@ BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("BatchWriteItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("BatchWriteItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("BatchWriteItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return BatchWriteItemOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return BatchWriteItemOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const BatchWriteItemRequest& request) const
@@ -285,7 +344,48 @@ void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, c
 
 void DynamoDBClient::BatchWriteItemAsyncHelper(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, BatchWriteItem(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, BatchWriteItem(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("BatchWriteItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("BatchWriteItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<BatchWriteItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, BatchWriteItemOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 CreateBackupOutcome DynamoDBClient::CreateBackup(const CreateBackupRequest& request) const
@@ -294,34 +394,36 @@ CreateBackupOutcome DynamoDBClient::CreateBackup(const CreateBackupRequest& requ
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("CreateBackup", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("CreateBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("CreateBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("CreateBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return CreateBackupOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return CreateBackupOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 CreateBackupOutcomeCallable DynamoDBClient::CreateBackupCallable(const CreateBackupRequest& request) const
@@ -339,7 +441,48 @@ void DynamoDBClient::CreateBackupAsync(const CreateBackupRequest& request, const
 
 void DynamoDBClient::CreateBackupAsyncHelper(const CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateBackup(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CreateBackup(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("CreateBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("CreateBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, CreateBackupOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 CreateGlobalTableOutcome DynamoDBClient::CreateGlobalTable(const CreateGlobalTableRequest& request) const
@@ -348,34 +491,36 @@ CreateGlobalTableOutcome DynamoDBClient::CreateGlobalTable(const CreateGlobalTab
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("CreateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("CreateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("CreateGlobalTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return CreateGlobalTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return CreateGlobalTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 CreateGlobalTableOutcomeCallable DynamoDBClient::CreateGlobalTableCallable(const CreateGlobalTableRequest& request) const
@@ -393,7 +538,48 @@ void DynamoDBClient::CreateGlobalTableAsync(const CreateGlobalTableRequest& requ
 
 void DynamoDBClient::CreateGlobalTableAsyncHelper(const CreateGlobalTableRequest& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateGlobalTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CreateGlobalTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("CreateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("CreateGlobalTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateGlobalTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, CreateGlobalTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request) const
@@ -402,34 +588,36 @@ CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("CreateTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("CreateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("CreateTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return CreateTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return CreateTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTableRequest& request) const
@@ -447,7 +635,48 @@ void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const C
 
 void DynamoDBClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CreateTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("CreateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("CreateTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, CreateTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DeleteBackupOutcome DynamoDBClient::DeleteBackup(const DeleteBackupRequest& request) const
@@ -456,34 +685,36 @@ DeleteBackupOutcome DynamoDBClient::DeleteBackup(const DeleteBackupRequest& requ
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DeleteBackup", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DeleteBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DeleteBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DeleteBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DeleteBackupOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DeleteBackupOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DeleteBackupOutcomeCallable DynamoDBClient::DeleteBackupCallable(const DeleteBackupRequest& request) const
@@ -501,7 +732,48 @@ void DynamoDBClient::DeleteBackupAsync(const DeleteBackupRequest& request, const
 
 void DynamoDBClient::DeleteBackupAsyncHelper(const DeleteBackupRequest& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBackup(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBackup(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DeleteBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DeleteBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBackupOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) const
@@ -510,34 +782,36 @@ DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) c
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DeleteItem", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DeleteItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DeleteItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DeleteItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DeleteItemOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DeleteItemOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemRequest& request) const
@@ -555,7 +829,48 @@ void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const Del
 
 void DynamoDBClient::DeleteItemAsyncHelper(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteItem(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteItem(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DeleteItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DeleteItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteItemOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request) const
@@ -564,34 +879,36 @@ DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DeleteTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DeleteTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DeleteTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DeleteTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DeleteTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTableRequest& request) const
@@ -609,43 +926,86 @@ void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const D
 
 void DynamoDBClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteTable(request), context);
-}
-
-DescribeBackupOutcome DynamoDBClient::DescribeBackup(const DescribeBackupRequest& request) const
-{
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteTable(request), context);
+    return;
+  }
   Aws::Http::URI uri = m_uri;
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DescribeBackup", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
-      {
-        AWS_LOGSTREAM_ERROR("DescribeBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DeleteTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
     }
-  }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DeleteTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+}
+
+DescribeBackupOutcome DynamoDBClient::DescribeBackup(const DescribeBackupRequest& request) const
+{
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeBackupOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeBackupOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeBackupOutcomeCallable DynamoDBClient::DescribeBackupCallable(const DescribeBackupRequest& request) const
@@ -663,7 +1023,48 @@ void DynamoDBClient::DescribeBackupAsync(const DescribeBackupRequest& request, c
 
 void DynamoDBClient::DescribeBackupAsyncHelper(const DescribeBackupRequest& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeBackup(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeBackup(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeBackupOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeContinuousBackupsOutcome DynamoDBClient::DescribeContinuousBackups(const DescribeContinuousBackupsRequest& request) const
@@ -672,34 +1073,36 @@ DescribeContinuousBackupsOutcome DynamoDBClient::DescribeContinuousBackups(const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DescribeContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DescribeContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeContinuousBackups", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeContinuousBackupsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeContinuousBackupsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeContinuousBackupsOutcomeCallable DynamoDBClient::DescribeContinuousBackupsCallable(const DescribeContinuousBackupsRequest& request) const
@@ -717,7 +1120,48 @@ void DynamoDBClient::DescribeContinuousBackupsAsync(const DescribeContinuousBack
 
 void DynamoDBClient::DescribeContinuousBackupsAsyncHelper(const DescribeContinuousBackupsRequest& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeContinuousBackups(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeContinuousBackups(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeContinuousBackups", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeContinuousBackupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeContinuousBackupsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeContributorInsightsOutcome DynamoDBClient::DescribeContributorInsights(const DescribeContributorInsightsRequest& request) const
@@ -726,7 +1170,7 @@ DescribeContributorInsightsOutcome DynamoDBClient::DescribeContributorInsights(c
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeContributorInsightsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeContributorInsightsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeContributorInsightsOutcomeCallable DynamoDBClient::DescribeContributorInsightsCallable(const DescribeContributorInsightsRequest& request) const
@@ -744,7 +1188,19 @@ void DynamoDBClient::DescribeContributorInsightsAsync(const DescribeContributorI
 
 void DynamoDBClient::DescribeContributorInsightsAsyncHelper(const DescribeContributorInsightsRequest& request, const DescribeContributorInsightsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeContributorInsights(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeContributorInsights(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeContributorInsightsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeContributorInsightsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeEndpointsOutcome DynamoDBClient::DescribeEndpoints(const DescribeEndpointsRequest& request) const
@@ -753,7 +1209,7 @@ DescribeEndpointsOutcome DynamoDBClient::DescribeEndpoints(const DescribeEndpoin
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeEndpointsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeEndpointsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeEndpointsOutcomeCallable DynamoDBClient::DescribeEndpointsCallable(const DescribeEndpointsRequest& request) const
@@ -771,7 +1227,19 @@ void DynamoDBClient::DescribeEndpointsAsync(const DescribeEndpointsRequest& requ
 
 void DynamoDBClient::DescribeEndpointsAsyncHelper(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeEndpoints(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeEndpoints(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeEndpointsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeEndpointsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeExportOutcome DynamoDBClient::DescribeExport(const DescribeExportRequest& request) const
@@ -780,7 +1248,7 @@ DescribeExportOutcome DynamoDBClient::DescribeExport(const DescribeExportRequest
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeExportOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeExportOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeExportOutcomeCallable DynamoDBClient::DescribeExportCallable(const DescribeExportRequest& request) const
@@ -798,7 +1266,19 @@ void DynamoDBClient::DescribeExportAsync(const DescribeExportRequest& request, c
 
 void DynamoDBClient::DescribeExportAsyncHelper(const DescribeExportRequest& request, const DescribeExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeExport(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeExport(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeExportRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeExportOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeGlobalTableOutcome DynamoDBClient::DescribeGlobalTable(const DescribeGlobalTableRequest& request) const
@@ -807,34 +1287,36 @@ DescribeGlobalTableOutcome DynamoDBClient::DescribeGlobalTable(const DescribeGlo
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DescribeGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DescribeGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeGlobalTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeGlobalTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeGlobalTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeGlobalTableOutcomeCallable DynamoDBClient::DescribeGlobalTableCallable(const DescribeGlobalTableRequest& request) const
@@ -852,7 +1334,48 @@ void DynamoDBClient::DescribeGlobalTableAsync(const DescribeGlobalTableRequest&
 
 void DynamoDBClient::DescribeGlobalTableAsyncHelper(const DescribeGlobalTableRequest& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeGlobalTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeGlobalTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeGlobalTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeGlobalTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeGlobalTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeGlobalTableSettingsOutcome DynamoDBClient::DescribeGlobalTableSettings(const DescribeGlobalTableSettingsRequest& request) const
@@ -861,34 +1384,36 @@ DescribeGlobalTableSettingsOutcome DynamoDBClient::DescribeGlobalTableSettings(c
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DescribeGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DescribeGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeGlobalTableSettings", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeGlobalTableSettingsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeGlobalTableSettingsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeGlobalTableSettingsOutcomeCallable DynamoDBClient::DescribeGlobalTableSettingsCallable(const DescribeGlobalTableSettingsRequest& request) const
@@ -906,7 +1431,48 @@ void DynamoDBClient::DescribeGlobalTableSettingsAsync(const DescribeGlobalTableS
 
 void DynamoDBClient::DescribeGlobalTableSettingsAsyncHelper(const DescribeGlobalTableSettingsRequest& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeGlobalTableSettings(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeGlobalTableSettings(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeGlobalTableSettings", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeGlobalTableSettingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeGlobalTableSettingsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeKinesisStreamingDestinationOutcome DynamoDBClient::DescribeKinesisStreamingDestination(const DescribeKinesisStreamingDestinationRequest& request) const
@@ -915,34 +1481,36 @@ DescribeKinesisStreamingDestinationOutcome DynamoDBClient::DescribeKinesisStream
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DescribeKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DescribeKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeKinesisStreamingDestination", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeKinesisStreamingDestinationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeKinesisStreamingDestinationOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeKinesisStreamingDestinationOutcomeCallable DynamoDBClient::DescribeKinesisStreamingDestinationCallable(const DescribeKinesisStreamingDestinationRequest& request) const
@@ -960,7 +1528,48 @@ void DynamoDBClient::DescribeKinesisStreamingDestinationAsync(const DescribeKine
 
 void DynamoDBClient::DescribeKinesisStreamingDestinationAsyncHelper(const DescribeKinesisStreamingDestinationRequest& request, const DescribeKinesisStreamingDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeKinesisStreamingDestination(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeKinesisStreamingDestination(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeKinesisStreamingDestination", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeKinesisStreamingDestinationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeKinesisStreamingDestinationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeLimitsOutcome DynamoDBClient::DescribeLimits(const DescribeLimitsRequest& request) const
@@ -969,34 +1578,36 @@ DescribeLimitsOutcome DynamoDBClient::DescribeLimits(const DescribeLimitsRequest
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DescribeLimits", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DescribeLimits", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DescribeLimits", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeLimits", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeLimits", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeLimitsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeLimitsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(const DescribeLimitsRequest& request) const
@@ -1014,7 +1625,48 @@ void DynamoDBClient::DescribeLimitsAsync(const DescribeLimitsRequest& request, c
 
 void DynamoDBClient::DescribeLimitsAsyncHelper(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeLimits(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeLimits(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeLimits", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeLimits", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeLimits", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeLimitsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeLimitsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& request) const
@@ -1023,34 +1675,36 @@ DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& r
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DescribeTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DescribeTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const DescribeTableRequest& request) const
@@ -1068,26 +1722,67 @@ void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, con
 
 void DynamoDBClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeTable(request), context);
-}
-
-DescribeTableReplicaAutoScalingOutcome DynamoDBClient::DescribeTableReplicaAutoScaling(const DescribeTableReplicaAutoScalingRequest& request) const
-{
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeTable(request), context);
+    return;
+  }
   Aws::Http::URI uri = m_uri;
-  Aws::StringStream ss;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeTableReplicaAutoScalingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
-}
-
-DescribeTableReplicaAutoScalingOutcomeCallable DynamoDBClient::DescribeTableReplicaAutoScalingCallable(const DescribeTableReplicaAutoScalingRequest& request) const
-{
-  auto task = Aws::MakeShared< std::packaged_task< DescribeTableReplicaAutoScalingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTableReplicaAutoScaling(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
-}
-
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+}
+
+DescribeTableReplicaAutoScalingOutcome DynamoDBClient::DescribeTableReplicaAutoScaling(const DescribeTableReplicaAutoScalingRequest& request) const
+{
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  return DescribeTableReplicaAutoScalingOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+}
+
+DescribeTableReplicaAutoScalingOutcomeCallable DynamoDBClient::DescribeTableReplicaAutoScalingCallable(const DescribeTableReplicaAutoScalingRequest& request) const
+{
+  auto task = Aws::MakeShared< std::packaged_task< DescribeTableReplicaAutoScalingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTableReplicaAutoScaling(request); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  m_executor->Submit(packagedFunction);
+  return task->get_future();
+}
+
 void DynamoDBClient::DescribeTableReplicaAutoScalingAsync(const DescribeTableReplicaAutoScalingRequest& request, const DescribeTableReplicaAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTableReplicaAutoScalingAsyncHelper( request, handler, context ); } );
@@ -1095,7 +1790,19 @@ void DynamoDBClient::DescribeTableReplicaAutoScalingAsync(const DescribeTableRep
 
 void DynamoDBClient::DescribeTableReplicaAutoScalingAsyncHelper(const DescribeTableReplicaAutoScalingRequest& request, const DescribeTableReplicaAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeTableReplicaAutoScaling(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeTableReplicaAutoScaling(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTableReplicaAutoScalingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeTableReplicaAutoScalingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeTimeToLiveOutcome DynamoDBClient::DescribeTimeToLive(const DescribeTimeToLiveRequest& request) const
@@ -1104,34 +1811,36 @@ DescribeTimeToLiveOutcome DynamoDBClient::DescribeTimeToLive(const DescribeTimeT
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DescribeTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DescribeTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeTimeToLive", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeTimeToLiveOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeTimeToLiveOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeTimeToLiveOutcomeCallable DynamoDBClient::DescribeTimeToLiveCallable(const DescribeTimeToLiveRequest& request) const
@@ -1149,7 +1858,48 @@ void DynamoDBClient::DescribeTimeToLiveAsync(const DescribeTimeToLiveRequest& re
 
 void DynamoDBClient::DescribeTimeToLiveAsyncHelper(const DescribeTimeToLiveRequest& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeTimeToLive(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeTimeToLive(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DescribeTimeToLive", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTimeToLiveRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeTimeToLiveOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DisableKinesisStreamingDestinationOutcome DynamoDBClient::DisableKinesisStreamingDestination(const DisableKinesisStreamingDestinationRequest& request) const
@@ -1158,34 +1908,36 @@ DisableKinesisStreamingDestinationOutcome DynamoDBClient::DisableKinesisStreamin
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("DisableKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("DisableKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DisableKinesisStreamingDestination", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DisableKinesisStreamingDestinationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DisableKinesisStreamingDestinationOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DisableKinesisStreamingDestinationOutcomeCallable DynamoDBClient::DisableKinesisStreamingDestinationCallable(const DisableKinesisStreamingDestinationRequest& request) const
@@ -1203,7 +1955,48 @@ void DynamoDBClient::DisableKinesisStreamingDestinationAsync(const DisableKinesi
 
 void DynamoDBClient::DisableKinesisStreamingDestinationAsyncHelper(const DisableKinesisStreamingDestinationRequest& request, const DisableKinesisStreamingDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DisableKinesisStreamingDestination(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DisableKinesisStreamingDestination(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DisableKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DisableKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("DisableKinesisStreamingDestination", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisableKinesisStreamingDestinationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DisableKinesisStreamingDestinationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 EnableKinesisStreamingDestinationOutcome DynamoDBClient::EnableKinesisStreamingDestination(const EnableKinesisStreamingDestinationRequest& request) const
@@ -1212,34 +2005,36 @@ EnableKinesisStreamingDestinationOutcome DynamoDBClient::EnableKinesisStreamingD
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("EnableKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("EnableKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("EnableKinesisStreamingDestination", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return EnableKinesisStreamingDestinationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return EnableKinesisStreamingDestinationOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 EnableKinesisStreamingDestinationOutcomeCallable DynamoDBClient::EnableKinesisStreamingDestinationCallable(const EnableKinesisStreamingDestinationRequest& request) const
@@ -1257,7 +2052,48 @@ void DynamoDBClient::EnableKinesisStreamingDestinationAsync(const EnableKinesisS
 
 void DynamoDBClient::EnableKinesisStreamingDestinationAsyncHelper(const EnableKinesisStreamingDestinationRequest& request, const EnableKinesisStreamingDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, EnableKinesisStreamingDestination(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, EnableKinesisStreamingDestination(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("EnableKinesisStreamingDestination", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("EnableKinesisStreamingDestination", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("EnableKinesisStreamingDestination", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<EnableKinesisStreamingDestinationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, EnableKinesisStreamingDestinationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ExecuteStatementOutcome DynamoDBClient::ExecuteStatement(const ExecuteStatementRequest& request) const
@@ -1266,7 +2102,7 @@ ExecuteStatementOutcome DynamoDBClient::ExecuteStatement(const ExecuteStatementR
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ExecuteStatementOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ExecuteStatementOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ExecuteStatementOutcomeCallable DynamoDBClient::ExecuteStatementCallable(const ExecuteStatementRequest& request) const
@@ -1284,7 +2120,19 @@ void DynamoDBClient::ExecuteStatementAsync(const ExecuteStatementRequest& reques
 
 void DynamoDBClient::ExecuteStatementAsyncHelper(const ExecuteStatementRequest& request, const ExecuteStatementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ExecuteStatement(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ExecuteStatement(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ExecuteStatementRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ExecuteStatementOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ExecuteTransactionOutcome DynamoDBClient::ExecuteTransaction(const ExecuteTransactionRequest& request) const
@@ -1293,7 +2141,7 @@ ExecuteTransactionOutcome DynamoDBClient::ExecuteTransaction(const ExecuteTransa
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ExecuteTransactionOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ExecuteTransactionOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ExecuteTransactionOutcomeCallable DynamoDBClient::ExecuteTransactionCallable(const ExecuteTransactionRequest& request) const
@@ -1311,7 +2159,19 @@ void DynamoDBClient::ExecuteTransactionAsync(const ExecuteTransactionRequest& re
 
 void DynamoDBClient::ExecuteTransactionAsyncHelper(const ExecuteTransactionRequest& request, const ExecuteTransactionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ExecuteTransaction(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ExecuteTransaction(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ExecuteTransactionRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ExecuteTransactionOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ExportTableToPointInTimeOutcome DynamoDBClient::ExportTableToPointInTime(const ExportTableToPointInTimeRequest& request) const
@@ -1320,7 +2180,7 @@ ExportTableToPointInTimeOutcome DynamoDBClient::ExportTableToPointInTime(const E
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ExportTableToPointInTimeOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ExportTableToPointInTimeOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ExportTableToPointInTimeOutcomeCallable DynamoDBClient::ExportTableToPointInTimeCallable(const ExportTableToPointInTimeRequest& request) const
@@ -1338,7 +2198,19 @@ void DynamoDBClient::ExportTableToPointInTimeAsync(const ExportTableToPointInTim
 
 void DynamoDBClient::ExportTableToPointInTimeAsyncHelper(const ExportTableToPointInTimeRequest& request, const ExportTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ExportTableToPointInTime(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ExportTableToPointInTime(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ExportTableToPointInTimeRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ExportTableToPointInTimeOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
@@ -1347,34 +2219,36 @@ GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("GetItem", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("GetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("GetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("GetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("GetItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("GetItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("GetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("GetItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("GetItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return GetItemOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return GetItemOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& request) const
@@ -1392,7 +2266,48 @@ void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemRe
 
 void DynamoDBClient::GetItemAsyncHelper(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetItem(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetItem(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("GetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("GetItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("GetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("GetItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("GetItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, GetItemOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListBackupsOutcome DynamoDBClient::ListBackups(const ListBackupsRequest& request) const
@@ -1401,34 +2316,36 @@ ListBackupsOutcome DynamoDBClient::ListBackups(const ListBackupsRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("ListBackups", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("ListBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("ListBackups", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("ListBackups", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListBackups", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListBackups", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListBackupsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListBackupsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListBackupsOutcomeCallable DynamoDBClient::ListBackupsCallable(const ListBackupsRequest& request) const
@@ -1446,7 +2363,48 @@ void DynamoDBClient::ListBackupsAsync(const ListBackupsRequest& request, const L
 
 void DynamoDBClient::ListBackupsAsyncHelper(const ListBackupsRequest& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListBackups(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListBackups(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("ListBackups", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListBackups", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListBackups", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBackupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListBackupsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListContributorInsightsOutcome DynamoDBClient::ListContributorInsights(const ListContributorInsightsRequest& request) const
@@ -1455,7 +2413,7 @@ ListContributorInsightsOutcome DynamoDBClient::ListContributorInsights(const Lis
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListContributorInsightsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListContributorInsightsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListContributorInsightsOutcomeCallable DynamoDBClient::ListContributorInsightsCallable(const ListContributorInsightsRequest& request) const
@@ -1473,7 +2431,19 @@ void DynamoDBClient::ListContributorInsightsAsync(const ListContributorInsightsR
 
 void DynamoDBClient::ListContributorInsightsAsyncHelper(const ListContributorInsightsRequest& request, const ListContributorInsightsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListContributorInsights(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListContributorInsights(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListContributorInsightsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListContributorInsightsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListExportsOutcome DynamoDBClient::ListExports(const ListExportsRequest& request) const
@@ -1482,7 +2452,7 @@ ListExportsOutcome DynamoDBClient::ListExports(const ListExportsRequest& request
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListExportsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListExportsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListExportsOutcomeCallable DynamoDBClient::ListExportsCallable(const ListExportsRequest& request) const
@@ -1500,7 +2470,19 @@ void DynamoDBClient::ListExportsAsync(const ListExportsRequest& request, const L
 
 void DynamoDBClient::ListExportsAsyncHelper(const ListExportsRequest& request, const ListExportsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListExports(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListExports(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListExportsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListExportsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListGlobalTablesOutcome DynamoDBClient::ListGlobalTables(const ListGlobalTablesRequest& request) const
@@ -1509,34 +2491,36 @@ ListGlobalTablesOutcome DynamoDBClient::ListGlobalTables(const ListGlobalTablesR
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("ListGlobalTables", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("ListGlobalTables", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListGlobalTables", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListGlobalTablesOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListGlobalTablesOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListGlobalTablesOutcomeCallable DynamoDBClient::ListGlobalTablesCallable(const ListGlobalTablesRequest& request) const
@@ -1554,43 +2538,86 @@ void DynamoDBClient::ListGlobalTablesAsync(const ListGlobalTablesRequest& reques
 
 void DynamoDBClient::ListGlobalTablesAsyncHelper(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListGlobalTables(request), context);
-}
-
-ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) const
-{
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListGlobalTables(request), context);
+    return;
+  }
   Aws::Http::URI uri = m_uri;
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("ListTables", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("ListTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("ListTables", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("ListGlobalTables", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListGlobalTables", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListTablesOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  auto sharedRequest = Aws::MakeShared<ListGlobalTablesRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListGlobalTablesOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+}
+
+ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) const
+{
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("ListTables", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTables", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListTables", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  return ListTablesOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesRequest& request) const
@@ -1608,7 +2635,48 @@ void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const Lis
 
 void DynamoDBClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTables(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListTables(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("ListTables", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTables", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListTables", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTablesRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListTablesOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListTagsOfResourceOutcome DynamoDBClient::ListTagsOfResource(const ListTagsOfResourceRequest& request) const
@@ -1617,34 +2685,36 @@ ListTagsOfResourceOutcome DynamoDBClient::ListTagsOfResource(const ListTagsOfRes
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("ListTagsOfResource", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("ListTagsOfResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListTagsOfResource", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListTagsOfResourceOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListTagsOfResourceOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListTagsOfResourceOutcomeCallable DynamoDBClient::ListTagsOfResourceCallable(const ListTagsOfResourceRequest& request) const
@@ -1662,7 +2732,48 @@ void DynamoDBClient::ListTagsOfResourceAsync(const ListTagsOfResourceRequest& re
 
 void DynamoDBClient::ListTagsOfResourceAsyncHelper(const ListTagsOfResourceRequest& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTagsOfResource(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListTagsOfResource(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("ListTagsOfResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("ListTagsOfResource", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsOfResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListTagsOfResourceOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
@@ -1671,34 +2782,36 @@ PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("PutItem", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("PutItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("PutItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("PutItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("PutItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("PutItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("PutItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("PutItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("PutItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return PutItemOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return PutItemOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& request) const
@@ -1716,7 +2829,48 @@ void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemRe
 
 void DynamoDBClient::PutItemAsyncHelper(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutItem(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutItem(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("PutItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("PutItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("PutItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("PutItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("PutItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, PutItemOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
@@ -1725,34 +2879,36 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("Query", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("Query", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("Query", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("Query", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("Query", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("Query", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("Query", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("Query", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("Query", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return QueryOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return QueryOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request) const
@@ -1770,7 +2926,48 @@ void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponse
 
 void DynamoDBClient::QueryAsyncHelper(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, Query(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, Query(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("Query", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("Query", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("Query", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("Query", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("Query", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<QueryRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, QueryOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 RestoreTableFromBackupOutcome DynamoDBClient::RestoreTableFromBackup(const RestoreTableFromBackupRequest& request) const
@@ -1779,34 +2976,36 @@ RestoreTableFromBackupOutcome DynamoDBClient::RestoreTableFromBackup(const Resto
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("RestoreTableFromBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("RestoreTableFromBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("RestoreTableFromBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return RestoreTableFromBackupOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return RestoreTableFromBackupOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 RestoreTableFromBackupOutcomeCallable DynamoDBClient::RestoreTableFromBackupCallable(const RestoreTableFromBackupRequest& request) const
@@ -1824,7 +3023,48 @@ void DynamoDBClient::RestoreTableFromBackupAsync(const RestoreTableFromBackupReq
 
 void DynamoDBClient::RestoreTableFromBackupAsyncHelper(const RestoreTableFromBackupRequest& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RestoreTableFromBackup(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, RestoreTableFromBackup(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("RestoreTableFromBackup", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("RestoreTableFromBackup", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreTableFromBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, RestoreTableFromBackupOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 RestoreTableToPointInTimeOutcome DynamoDBClient::RestoreTableToPointInTime(const RestoreTableToPointInTimeRequest& request) const
@@ -1833,34 +3073,36 @@ RestoreTableToPointInTimeOutcome DynamoDBClient::RestoreTableToPointInTime(const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("RestoreTableToPointInTime", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("RestoreTableToPointInTime", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("RestoreTableToPointInTime", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return RestoreTableToPointInTimeOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return RestoreTableToPointInTimeOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 RestoreTableToPointInTimeOutcomeCallable DynamoDBClient::RestoreTableToPointInTimeCallable(const RestoreTableToPointInTimeRequest& request) const
@@ -1878,7 +3120,48 @@ void DynamoDBClient::RestoreTableToPointInTimeAsync(const RestoreTableToPointInT
 
 void DynamoDBClient::RestoreTableToPointInTimeAsyncHelper(const RestoreTableToPointInTimeRequest& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RestoreTableToPointInTime(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, RestoreTableToPointInTime(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("RestoreTableToPointInTime", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("RestoreTableToPointInTime", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreTableToPointInTimeRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, RestoreTableToPointInTimeOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
@@ -1887,34 +3170,36 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("Scan", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("Scan", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("Scan", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("Scan", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("Scan", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("Scan", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("Scan", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("Scan", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("Scan", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ScanOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ScanOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) const
@@ -1932,7 +3217,48 @@ void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseRec
 
 void DynamoDBClient::ScanAsyncHelper(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, Scan(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, Scan(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("Scan", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("Scan", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("Scan", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("Scan", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("Scan", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ScanRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ScanOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 TagResourceOutcome DynamoDBClient::TagResource(const TagResourceRequest& request) const
@@ -1941,34 +3267,36 @@ TagResourceOutcome DynamoDBClient::TagResource(const TagResourceRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("TagResource", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("TagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("TagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
-      {
-        AWS_LOGSTREAM_ERROR("TagResource", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("TagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("TagResource", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return TagResourceOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return TagResourceOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 TagResourceOutcomeCallable DynamoDBClient::TagResourceCallable(const TagResourceRequest& request) const
@@ -1986,7 +3314,48 @@ void DynamoDBClient::TagResourceAsync(const TagResourceRequest& request, const T
 
 void DynamoDBClient::TagResourceAsyncHelper(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, TagResource(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, TagResource(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("TagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("TagResource", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, TagResourceOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 TransactGetItemsOutcome DynamoDBClient::TransactGetItems(const TransactGetItemsRequest& request) const
@@ -1995,34 +3364,36 @@ TransactGetItemsOutcome DynamoDBClient::TransactGetItems(const TransactGetItemsR
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("TransactGetItems", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
-      {
-        AWS_LOGSTREAM_ERROR("TransactGetItems", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("TransactGetItems", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TransactGetItems", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("TransactGetItems", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return TransactGetItemsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return TransactGetItemsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 TransactGetItemsOutcomeCallable DynamoDBClient::TransactGetItemsCallable(const TransactGetItemsRequest& request) const
@@ -2040,7 +3411,48 @@ void DynamoDBClient::TransactGetItemsAsync(const TransactGetItemsRequest& reques
 
 void DynamoDBClient::TransactGetItemsAsyncHelper(const TransactGetItemsRequest& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, TransactGetItems(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, TransactGetItems(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("TransactGetItems", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TransactGetItems", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("TransactGetItems", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TransactGetItemsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, TransactGetItemsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 TransactWriteItemsOutcome DynamoDBClient::TransactWriteItems(const TransactWriteItemsRequest& request) const
@@ -2049,52 +3461,95 @@ TransactWriteItemsOutcome DynamoDBClient::TransactWriteItems(const TransactWrite
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("TransactWriteItems", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      AWS_LOGSTREAM_ERROR("TransactWriteItems", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  return TransactWriteItemsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+}
+
+TransactWriteItemsOutcomeCallable DynamoDBClient::TransactWriteItemsCallable(const TransactWriteItemsRequest& request) const
+{
+  auto task = Aws::MakeShared< std::packaged_task< TransactWriteItemsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TransactWriteItems(request); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  m_executor->Submit(packagedFunction);
+  return task->get_future();
+}
+
+void DynamoDBClient::TransactWriteItemsAsync(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit( [this, request, handler, context](){ this->TransactWriteItemsAsyncHelper( request, handler, context ); } );
+}
+
+void DynamoDBClient::TransactWriteItemsAsyncHelper(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, TransactWriteItems(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
-      {
-        AWS_LOGSTREAM_ERROR("TransactWriteItems", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("TransactWriteItems", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("TransactWriteItems", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return TransactWriteItemsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
-}
-
-TransactWriteItemsOutcomeCallable DynamoDBClient::TransactWriteItemsCallable(const TransactWriteItemsRequest& request) const
-{
-  auto task = Aws::MakeShared< std::packaged_task< TransactWriteItemsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TransactWriteItems(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
-}
-
-void DynamoDBClient::TransactWriteItemsAsync(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit( [this, request, handler, context](){ this->TransactWriteItemsAsyncHelper( request, handler, context ); } );
-}
-
-void DynamoDBClient::TransactWriteItemsAsyncHelper(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, TransactWriteItems(request), context);
+  auto sharedRequest = Aws::MakeShared<TransactWriteItemsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, TransactWriteItemsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UntagResourceOutcome DynamoDBClient::UntagResource(const UntagResourceRequest& request) const
@@ -2103,34 +3558,36 @@ UntagResourceOutcome DynamoDBClient::UntagResource(const UntagResourceRequest& r
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UntagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("UntagResource", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("UntagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UntagResource", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UntagResourceOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UntagResourceOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UntagResourceOutcomeCallable DynamoDBClient::UntagResourceCallable(const UntagResourceRequest& request) const
@@ -2148,7 +3605,48 @@ void DynamoDBClient::UntagResourceAsync(const UntagResourceRequest& request, con
 
 void DynamoDBClient::UntagResourceAsyncHelper(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UntagResource(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UntagResource(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UntagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UntagResource", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UntagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UntagResourceOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateContinuousBackupsOutcome DynamoDBClient::UpdateContinuousBackups(const UpdateContinuousBackupsRequest& request) const
@@ -2157,34 +3655,36 @@ UpdateContinuousBackupsOutcome DynamoDBClient::UpdateContinuousBackups(const Upd
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("UpdateContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("UpdateContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateContinuousBackups", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateContinuousBackupsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateContinuousBackupsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateContinuousBackupsOutcomeCallable DynamoDBClient::UpdateContinuousBackupsCallable(const UpdateContinuousBackupsRequest& request) const
@@ -2202,7 +3702,48 @@ void DynamoDBClient::UpdateContinuousBackupsAsync(const UpdateContinuousBackupsR
 
 void DynamoDBClient::UpdateContinuousBackupsAsyncHelper(const UpdateContinuousBackupsRequest& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateContinuousBackups(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateContinuousBackups(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateContinuousBackups", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateContinuousBackupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateContinuousBackupsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateContributorInsightsOutcome DynamoDBClient::UpdateContributorInsights(const UpdateContributorInsightsRequest& request) const
@@ -2211,7 +3752,7 @@ UpdateContributorInsightsOutcome DynamoDBClient::UpdateContributorInsights(const
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateContributorInsightsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateContributorInsightsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateContributorInsightsOutcomeCallable DynamoDBClient::UpdateContributorInsightsCallable(const UpdateContributorInsightsRequest& request) const
@@ -2229,7 +3770,19 @@ void DynamoDBClient::UpdateContributorInsightsAsync(const UpdateContributorInsig
 
 void DynamoDBClient::UpdateContributorInsightsAsyncHelper(const UpdateContributorInsightsRequest& request, const UpdateContributorInsightsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateContributorInsights(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateContributorInsights(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateContributorInsightsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateContributorInsightsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateGlobalTableOutcome DynamoDBClient::UpdateGlobalTable(const UpdateGlobalTableRequest& request) const
@@ -2238,34 +3791,36 @@ UpdateGlobalTableOutcome DynamoDBClient::UpdateGlobalTable(const UpdateGlobalTab
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("UpdateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("UpdateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateGlobalTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateGlobalTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateGlobalTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateGlobalTableOutcomeCallable DynamoDBClient::UpdateGlobalTableCallable(const UpdateGlobalTableRequest& request) const
@@ -2283,7 +3838,48 @@ void DynamoDBClient::UpdateGlobalTableAsync(const UpdateGlobalTableRequest& requ
 
 void DynamoDBClient::UpdateGlobalTableAsyncHelper(const UpdateGlobalTableRequest& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateGlobalTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateGlobalTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateGlobalTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGlobalTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateGlobalTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateGlobalTableSettingsOutcome DynamoDBClient::UpdateGlobalTableSettings(const UpdateGlobalTableSettingsRequest& request) const
@@ -2292,34 +3888,36 @@ UpdateGlobalTableSettingsOutcome DynamoDBClient::UpdateGlobalTableSettings(const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("UpdateGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("UpdateGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateGlobalTableSettings", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateGlobalTableSettingsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateGlobalTableSettingsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateGlobalTableSettingsOutcomeCallable DynamoDBClient::UpdateGlobalTableSettingsCallable(const UpdateGlobalTableSettingsRequest& request) const
@@ -2337,7 +3935,48 @@ void DynamoDBClient::UpdateGlobalTableSettingsAsync(const UpdateGlobalTableSetti
 
 void DynamoDBClient::UpdateGlobalTableSettingsAsyncHelper(const UpdateGlobalTableSettingsRequest& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateGlobalTableSettings(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateGlobalTableSettings(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateGlobalTableSettings", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGlobalTableSettingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateGlobalTableSettingsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) const
@@ -2346,34 +3985,36 @@ UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) c
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("UpdateItem", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("UpdateItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("UpdateItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateItemOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateItemOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemRequest& request) const
@@ -2391,7 +4032,48 @@ void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const Upd
 
 void DynamoDBClient::UpdateItemAsyncHelper(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateItem(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateItem(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateItem", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateItem", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateItem", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateItemOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request) const
@@ -2400,34 +4082,36 @@ UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("UpdateTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("UpdateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTableRequest& request) const
@@ -2445,7 +4129,48 @@ void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const U
 
 void DynamoDBClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateTable", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateTableReplicaAutoScalingOutcome DynamoDBClient::UpdateTableReplicaAutoScaling(const UpdateTableReplicaAutoScalingRequest& request) const
@@ -2454,7 +4179,7 @@ UpdateTableReplicaAutoScalingOutcome DynamoDBClient::UpdateTableReplicaAutoScali
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateTableReplicaAutoScalingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateTableReplicaAutoScalingOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateTableReplicaAutoScalingOutcomeCallable DynamoDBClient::UpdateTableReplicaAutoScalingCallable(const UpdateTableReplicaAutoScalingRequest& request) const
@@ -2472,7 +4197,19 @@ void DynamoDBClient::UpdateTableReplicaAutoScalingAsync(const UpdateTableReplica
 
 void DynamoDBClient::UpdateTableReplicaAutoScalingAsyncHelper(const UpdateTableReplicaAutoScalingRequest& request, const UpdateTableReplicaAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateTableReplicaAutoScaling(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateTableReplicaAutoScaling(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTableReplicaAutoScalingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateTableReplicaAutoScalingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateTimeToLiveOutcome DynamoDBClient::UpdateTimeToLive(const UpdateTimeToLiveRequest& request) const
@@ -2481,34 +4218,36 @@ UpdateTimeToLiveOutcome DynamoDBClient::UpdateTimeToLive(const UpdateTimeToLiveR
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
-        AWS_LOGSTREAM_ERROR("UpdateTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+        AWS_LOGSTREAM_ERROR("UpdateTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateTimeToLive", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateTimeToLiveOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateTimeToLiveOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateTimeToLiveOutcomeCallable DynamoDBClient::UpdateTimeToLiveCallable(const UpdateTimeToLiveRequest& request) const
@@ -2526,6 +4265,47 @@ void DynamoDBClient::UpdateTimeToLiveAsync(const UpdateTimeToLiveRequest& reques
 
 void DynamoDBClient::UpdateTimeToLiveAsyncHelper(const UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateTimeToLive(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateTimeToLive(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      AWS_LOGSTREAM_ERROR("UpdateTimeToLive", "Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTimeToLiveRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateTimeToLiveOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
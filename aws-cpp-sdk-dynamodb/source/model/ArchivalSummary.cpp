@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ArchivalSummary.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ ArchivalSummary::ArchivalSummary(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ArchivalSummary::ArchivalSummary(JsonReader& reader) : 
+    m_archivalDateTimeHasBeenSet(false),
+    m_archivalReasonHasBeenSet(false),
+    m_archivalBackupArnHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ArchivalSummary& ArchivalSummary::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ArchivalDateTime"))
@@ -59,6 +68,32 @@ ArchivalSummary& ArchivalSummary::operator =(JsonView jsonValue)
   return *this;
 }
 
+ArchivalSummary& ArchivalSummary::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ArchivalDateTime"))
+      {
+        m_archivalDateTime = reader.ReadDouble();
+        m_archivalDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ArchivalReason"))
+      {
+        m_archivalReason = reader.ReadString();
+        m_archivalReasonHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ArchivalBackupArn"))
+      {
+        m_archivalBackupArn = reader.ReadString();
+        m_archivalBackupArnHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ArchivalSummary::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AttributeDefinition.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ AttributeDefinition::AttributeDefinition(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+AttributeDefinition::AttributeDefinition(JsonReader& reader) : 
+    m_attributeNameHasBeenSet(false),
+    m_attributeType(ScalarAttributeType::NOT_SET),
+    m_attributeTypeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AttributeDefinition& AttributeDefinition::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("AttributeName"))
@@ -52,6 +61,27 @@ AttributeDefinition& AttributeDefinition::operator =(JsonView jsonValue)
   return *this;
 }
 
+AttributeDefinition& AttributeDefinition::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("AttributeName"))
+      {
+        m_attributeName = reader.ReadString();
+        m_attributeNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AttributeType"))
+      {
+        m_attributeType = ScalarAttributeTypeMapper::GetScalarAttributeTypeForName(reader.ReadString());
+        m_attributeTypeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AttributeDefinition::Jsonize() const
 {
   JsonValue payload;
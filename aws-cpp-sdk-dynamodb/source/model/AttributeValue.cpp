@@ -5,6 +5,8 @@
 
 #include <aws/dynamodb/model/AttributeValue.h>
 #include <aws/dynamodb/model/AttributeValueValue.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -340,6 +342,95 @@ AttributeValue& AttributeValue::operator =(JsonView jsonValue)
     return *this;
 }
 
+static Aws::Vector<Aws::String> ReadStringList(JsonReader& reader)
+{
+    Aws::Vector<Aws::String> list;
+    if (reader.StartArray())
+    {
+        while (reader.NextElement())
+        {
+            list.push_back(reader.ReadString());
+        }
+    }
+    return list;
+}
+
+AttributeValue& AttributeValue::operator =(JsonReader& reader)
+{
+    if (!reader.StartObject())
+    {
+        return *this;
+    }
+
+    while (reader.NextMember())
+    {
+        if (reader.KeyEquals("S"))
+        {
+            SetS(reader.ReadString());
+        }
+        else if (reader.KeyEquals("N"))
+        {
+            SetN(reader.ReadString());
+        }
+        else if (reader.KeyEquals("B"))
+        {
+            SetB(HashingUtils::Base64Decode(reader.ReadString()));
+        }
+        else if (reader.KeyEquals("SS"))
+        {
+            SetSS(ReadStringList(reader));
+        }
+        else if (reader.KeyEquals("NS"))
+        {
+            SetNS(ReadStringList(reader));
+        }
+        else if (reader.KeyEquals("BS"))
+        {
+            Aws::Vector<ByteBuffer> bs;
+            for (const auto& item : ReadStringList(reader))
+            {
+                bs.push_back(HashingUtils::Base64Decode(item));
+            }
+            SetBS(bs);
+        }
+        else if (reader.KeyEquals("M"))
+        {
+            Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> map;
+            if (reader.StartObject())
+            {
+                while (reader.NextMember())
+                {
+                    Aws::String key = reader.GetKey();
+                    map.emplace(std::move(key), Aws::MakeShared<AttributeValue>("AttributeValue", reader));
+                }
+            }
+            SetM(map);
+        }
+        else if (reader.KeyEquals("L"))
+        {
+            Aws::Vector<std::shared_ptr<AttributeValue>> list;
+            if (reader.StartArray())
+            {
+                while (reader.NextElement())
+                {
+                    list.push_back(Aws::MakeShared<AttributeValue>("AttributeValue", reader));
+                }
+            }
+            SetL(list);
+        }
+        else if (reader.KeyEquals("BOOL"))
+        {
+            SetBool(reader.ReadBool());
+        }
+        else if (reader.KeyEquals("NULL"))
+        {
+            SetNull(reader.ReadBool());
+        }
+    }
+
+    return *this;
+}
+
 bool AttributeValue::operator ==(const AttributeValue& other) const
 {
     if (this == &other)
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AttributeValueUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ AttributeValueUpdate::AttributeValueUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+AttributeValueUpdate::AttributeValueUpdate(JsonReader& reader) : 
+    m_valueHasBeenSet(false),
+    m_action(AttributeAction::NOT_SET),
+    m_actionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AttributeValueUpdate& AttributeValueUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Value"))
@@ -52,6 +61,27 @@ AttributeValueUpdate& AttributeValueUpdate::operator =(JsonView jsonValue)
   return *this;
 }
 
+AttributeValueUpdate& AttributeValueUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Value"))
+      {
+        m_value = reader;
+        m_valueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Action"))
+      {
+        m_action = AttributeActionMapper::GetAttributeActionForName(reader.ReadString());
+        m_actionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AttributeValueUpdate::Jsonize() const
 {
   JsonValue payload;
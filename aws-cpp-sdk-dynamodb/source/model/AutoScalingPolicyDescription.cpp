@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AutoScalingPolicyDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ AutoScalingPolicyDescription::AutoScalingPolicyDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+AutoScalingPolicyDescription::AutoScalingPolicyDescription(JsonReader& reader) : 
+    m_policyNameHasBeenSet(false),
+    m_targetTrackingScalingPolicyConfigurationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AutoScalingPolicyDescription& AutoScalingPolicyDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("PolicyName"))
@@ -50,6 +58,27 @@ AutoScalingPolicyDescription& AutoScalingPolicyDescription::operator =(JsonView
   return *this;
 }
 
+AutoScalingPolicyDescription& AutoScalingPolicyDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("PolicyName"))
+      {
+        m_policyName = reader.ReadString();
+        m_policyNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TargetTrackingScalingPolicyConfiguration"))
+      {
+        m_targetTrackingScalingPolicyConfiguration = reader;
+        m_targetTrackingScalingPolicyConfigurationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AutoScalingPolicyDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AutoScalingPolicyUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ AutoScalingPolicyUpdate::AutoScalingPolicyUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+AutoScalingPolicyUpdate::AutoScalingPolicyUpdate(JsonReader& reader) : 
+    m_policyNameHasBeenSet(false),
+    m_targetTrackingScalingPolicyConfigurationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AutoScalingPolicyUpdate& AutoScalingPolicyUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("PolicyName"))
@@ -50,6 +58,27 @@ AutoScalingPolicyUpdate& AutoScalingPolicyUpdate::operator =(JsonView jsonValue)
   return *this;
 }
 
+AutoScalingPolicyUpdate& AutoScalingPolicyUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("PolicyName"))
+      {
+        m_policyName = reader.ReadString();
+        m_policyNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TargetTrackingScalingPolicyConfiguration"))
+      {
+        m_targetTrackingScalingPolicyConfiguration = reader;
+        m_targetTrackingScalingPolicyConfigurationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AutoScalingPolicyUpdate::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AutoScalingSettingsDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -43,6 +44,19 @@ AutoScalingSettingsDescription::AutoScalingSettingsDescription(JsonView jsonValu
   *this = jsonValue;
 }
 
+AutoScalingSettingsDescription::AutoScalingSettingsDescription(JsonReader& reader) : 
+    m_minimumUnits(0),
+    m_minimumUnitsHasBeenSet(false),
+    m_maximumUnits(0),
+    m_maximumUnitsHasBeenSet(false),
+    m_autoScalingDisabled(false),
+    m_autoScalingDisabledHasBeenSet(false),
+    m_autoScalingRoleArnHasBeenSet(false),
+    m_scalingPoliciesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AutoScalingSettingsDescription& AutoScalingSettingsDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("MinimumUnits"))
@@ -86,6 +100,48 @@ AutoScalingSettingsDescription& AutoScalingSettingsDescription::operator =(JsonV
   return *this;
 }
 
+AutoScalingSettingsDescription& AutoScalingSettingsDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("MinimumUnits"))
+      {
+        m_minimumUnits = reader.ReadInt64();
+        m_minimumUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("MaximumUnits"))
+      {
+        m_maximumUnits = reader.ReadInt64();
+        m_maximumUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AutoScalingDisabled"))
+      {
+        m_autoScalingDisabled = reader.ReadBool();
+        m_autoScalingDisabledHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AutoScalingRoleArn"))
+      {
+        m_autoScalingRoleArn = reader.ReadString();
+        m_autoScalingRoleArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ScalingPolicies"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_scalingPolicies.push_back(reader);
+          }
+        }
+        m_scalingPoliciesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AutoScalingSettingsDescription::Jsonize() const
 {
   JsonValue payload;
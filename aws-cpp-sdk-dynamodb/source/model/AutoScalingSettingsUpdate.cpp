@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AutoScalingSettingsUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -43,6 +44,19 @@ AutoScalingSettingsUpdate::AutoScalingSettingsUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+AutoScalingSettingsUpdate::AutoScalingSettingsUpdate(JsonReader& reader) : 
+    m_minimumUnits(0),
+    m_minimumUnitsHasBeenSet(false),
+    m_maximumUnits(0),
+    m_maximumUnitsHasBeenSet(false),
+    m_autoScalingDisabled(false),
+    m_autoScalingDisabledHasBeenSet(false),
+    m_autoScalingRoleArnHasBeenSet(false),
+    m_scalingPolicyUpdateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AutoScalingSettingsUpdate& AutoScalingSettingsUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("MinimumUnits"))
@@ -83,6 +97,42 @@ AutoScalingSettingsUpdate& AutoScalingSettingsUpdate::operator =(JsonView jsonVa
   return *this;
 }
 
+AutoScalingSettingsUpdate& AutoScalingSettingsUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("MinimumUnits"))
+      {
+        m_minimumUnits = reader.ReadInt64();
+        m_minimumUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("MaximumUnits"))
+      {
+        m_maximumUnits = reader.ReadInt64();
+        m_maximumUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AutoScalingDisabled"))
+      {
+        m_autoScalingDisabled = reader.ReadBool();
+        m_autoScalingDisabledHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AutoScalingRoleArn"))
+      {
+        m_autoScalingRoleArn = reader.ReadString();
+        m_autoScalingRoleArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ScalingPolicyUpdate"))
+      {
+        m_scalingPolicyUpdate = reader;
+        m_scalingPolicyUpdateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AutoScalingSettingsUpdate::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AutoScalingTargetTrackingScalingPolicyConfigurationDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -43,6 +44,19 @@ AutoScalingTargetTrackingScalingPolicyConfigurationDescription::AutoScalingTarge
   *this = jsonValue;
 }
 
+AutoScalingTargetTrackingScalingPolicyConfigurationDescription::AutoScalingTargetTrackingScalingPolicyConfigurationDescription(JsonReader& reader) : 
+    m_disableScaleIn(false),
+    m_disableScaleInHasBeenSet(false),
+    m_scaleInCooldown(0),
+    m_scaleInCooldownHasBeenSet(false),
+    m_scaleOutCooldown(0),
+    m_scaleOutCooldownHasBeenSet(false),
+    m_targetValue(0.0),
+    m_targetValueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AutoScalingTargetTrackingScalingPolicyConfigurationDescription& AutoScalingTargetTrackingScalingPolicyConfigurationDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("DisableScaleIn"))
@@ -76,6 +90,37 @@ AutoScalingTargetTrackingScalingPolicyConfigurationDescription& AutoScalingTarge
   return *this;
 }
 
+AutoScalingTargetTrackingScalingPolicyConfigurationDescription& AutoScalingTargetTrackingScalingPolicyConfigurationDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("DisableScaleIn"))
+      {
+        m_disableScaleIn = reader.ReadBool();
+        m_disableScaleInHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ScaleInCooldown"))
+      {
+        m_scaleInCooldown = reader.ReadInteger();
+        m_scaleInCooldownHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ScaleOutCooldown"))
+      {
+        m_scaleOutCooldown = reader.ReadInteger();
+        m_scaleOutCooldownHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TargetValue"))
+      {
+        m_targetValue = reader.ReadDouble();
+        m_targetValueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AutoScalingTargetTrackingScalingPolicyConfigurationDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AutoScalingTargetTrackingScalingPolicyConfigurationUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -43,6 +44,19 @@ AutoScalingTargetTrackingScalingPolicyConfigurationUpdate::AutoScalingTargetTrac
   *this = jsonValue;
 }
 
+AutoScalingTargetTrackingScalingPolicyConfigurationUpdate::AutoScalingTargetTrackingScalingPolicyConfigurationUpdate(JsonReader& reader) : 
+    m_disableScaleIn(false),
+    m_disableScaleInHasBeenSet(false),
+    m_scaleInCooldown(0),
+    m_scaleInCooldownHasBeenSet(false),
+    m_scaleOutCooldown(0),
+    m_scaleOutCooldownHasBeenSet(false),
+    m_targetValue(0.0),
+    m_targetValueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AutoScalingTargetTrackingScalingPolicyConfigurationUpdate& AutoScalingTargetTrackingScalingPolicyConfigurationUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("DisableScaleIn"))
@@ -76,6 +90,37 @@ AutoScalingTargetTrackingScalingPolicyConfigurationUpdate& AutoScalingTargetTrac
   return *this;
 }
 
+AutoScalingTargetTrackingScalingPolicyConfigurationUpdate& AutoScalingTargetTrackingScalingPolicyConfigurationUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("DisableScaleIn"))
+      {
+        m_disableScaleIn = reader.ReadBool();
+        m_disableScaleInHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ScaleInCooldown"))
+      {
+        m_scaleInCooldown = reader.ReadInteger();
+        m_scaleInCooldownHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ScaleOutCooldown"))
+      {
+        m_scaleOutCooldown = reader.ReadInteger();
+        m_scaleOutCooldownHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TargetValue"))
+      {
+        m_targetValue = reader.ReadDouble();
+        m_targetValueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue AutoScalingTargetTrackingScalingPolicyConfigurationUpdate::Jsonize() const
 {
   JsonValue payload;
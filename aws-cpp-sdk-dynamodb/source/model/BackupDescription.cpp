@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BackupDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ BackupDescription::BackupDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+BackupDescription::BackupDescription(JsonReader& reader) : 
+    m_backupDetailsHasBeenSet(false),
+    m_sourceTableDetailsHasBeenSet(false),
+    m_sourceTableFeatureDetailsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BackupDescription& BackupDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("BackupDetails"))
@@ -59,6 +68,32 @@ BackupDescription& BackupDescription::operator =(JsonView jsonValue)
   return *this;
 }
 
+BackupDescription& BackupDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("BackupDetails"))
+      {
+        m_backupDetails = reader;
+        m_backupDetailsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SourceTableDetails"))
+      {
+        m_sourceTableDetails = reader;
+        m_sourceTableDetailsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SourceTableFeatureDetails"))
+      {
+        m_sourceTableFeatureDetails = reader;
+        m_sourceTableFeatureDetailsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue BackupDescription::Jsonize() const
 {
   JsonValue payload;
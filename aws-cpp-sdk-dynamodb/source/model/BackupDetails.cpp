@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BackupDetails.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -47,6 +48,21 @@ BackupDetails::BackupDetails(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+BackupDetails::BackupDetails(JsonReader& reader) : 
+    m_backupArnHasBeenSet(false),
+    m_backupNameHasBeenSet(false),
+    m_backupSizeBytes(0),
+    m_backupSizeBytesHasBeenSet(false),
+    m_backupStatus(BackupStatus::NOT_SET),
+    m_backupStatusHasBeenSet(false),
+    m_backupType(BackupType::NOT_SET),
+    m_backupTypeHasBeenSet(false),
+    m_backupCreationDateTimeHasBeenSet(false),
+    m_backupExpiryDateTimeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BackupDetails& BackupDetails::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("BackupArn"))
@@ -101,6 +117,52 @@ BackupDetails& BackupDetails::operator =(JsonView jsonValue)
   return *this;
 }
 
+BackupDetails& BackupDetails::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("BackupArn"))
+      {
+        m_backupArn = reader.ReadString();
+        m_backupArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupName"))
+      {
+        m_backupName = reader.ReadString();
+        m_backupNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupSizeBytes"))
+      {
+        m_backupSizeBytes = reader.ReadInt64();
+        m_backupSizeBytesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupStatus"))
+      {
+        m_backupStatus = BackupStatusMapper::GetBackupStatusForName(reader.ReadString());
+        m_backupStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupType"))
+      {
+        m_backupType = BackupTypeMapper::GetBackupTypeForName(reader.ReadString());
+        m_backupTypeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupCreationDateTime"))
+      {
+        m_backupCreationDateTime = reader.ReadDouble();
+        m_backupCreationDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupExpiryDateTime"))
+      {
+        m_backupExpiryDateTime = reader.ReadDouble();
+        m_backupExpiryDateTimeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue BackupDetails::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BackupSummary.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -53,6 +54,24 @@ BackupSummary::BackupSummary(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+BackupSummary::BackupSummary(JsonReader& reader) : 
+    m_tableNameHasBeenSet(false),
+    m_tableIdHasBeenSet(false),
+    m_tableArnHasBeenSet(false),
+    m_backupArnHasBeenSet(false),
+    m_backupNameHasBeenSet(false),
+    m_backupCreationDateTimeHasBeenSet(false),
+    m_backupExpiryDateTimeHasBeenSet(false),
+    m_backupStatus(BackupStatus::NOT_SET),
+    m_backupStatusHasBeenSet(false),
+    m_backupType(BackupType::NOT_SET),
+    m_backupTypeHasBeenSet(false),
+    m_backupSizeBytes(0),
+    m_backupSizeBytesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BackupSummary& BackupSummary::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("TableName"))
@@ -128,6 +147,67 @@ BackupSummary& BackupSummary::operator =(JsonView jsonValue)
   return *this;
 }
 
+BackupSummary& BackupSummary::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableId"))
+      {
+        m_tableId = reader.ReadString();
+        m_tableIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableArn"))
+      {
+        m_tableArn = reader.ReadString();
+        m_tableArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupArn"))
+      {
+        m_backupArn = reader.ReadString();
+        m_backupArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupName"))
+      {
+        m_backupName = reader.ReadString();
+        m_backupNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupCreationDateTime"))
+      {
+        m_backupCreationDateTime = reader.ReadDouble();
+        m_backupCreationDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupExpiryDateTime"))
+      {
+        m_backupExpiryDateTime = reader.ReadDouble();
+        m_backupExpiryDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupStatus"))
+      {
+        m_backupStatus = BackupStatusMapper::GetBackupStatusForName(reader.ReadString());
+        m_backupStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupType"))
+      {
+        m_backupType = BackupTypeMapper::GetBackupTypeForName(reader.ReadString());
+        m_backupTypeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BackupSizeBytes"))
+      {
+        m_backupSizeBytes = reader.ReadInt64();
+        m_backupSizeBytesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue BackupSummary::Jsonize() const
 {
   JsonValue payload;
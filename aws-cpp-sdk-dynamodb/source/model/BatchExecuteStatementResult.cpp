@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BatchExecuteStatementResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -39,5 +40,34 @@ BatchExecuteStatementResult& BatchExecuteStatementResult::operator =(const Aws::
 
 
 
+  return *this;
+}
+
+BatchExecuteStatementResult::BatchExecuteStatementResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+BatchExecuteStatementResult& BatchExecuteStatementResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Responses"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_responses.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
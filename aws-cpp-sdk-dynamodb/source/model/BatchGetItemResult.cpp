@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BatchGetItemResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -70,5 +71,73 @@ BatchGetItemResult& BatchGetItemResult::operator =(const Aws::AmazonWebServiceRe
 
 
 
+  return *this;
+}
+
+BatchGetItemResult::BatchGetItemResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+BatchGetItemResult& BatchGetItemResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Responses"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String responsesKey = reader.GetKey();
+            Aws::Vector<Aws::Map<Aws::String, AttributeValue>> itemListList;
+            if(reader.StartArray())
+            {
+              while(reader.NextElement())
+              {
+                Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+                if(reader.StartObject())
+                {
+                  while(reader.NextMember())
+                  {
+                    Aws::String attributeMapKey = reader.GetKey();
+                    attributeMapMap[attributeMapKey] = reader;
+                  }
+                }
+                itemListList.push_back(std::move(attributeMapMap));
+              }
+            }
+            m_responses[responsesKey] = std::move(itemListList);
+          }
+        }
+      }
+      else if(reader.KeyEquals("UnprocessedKeys"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String unprocessedKeysKey = reader.GetKey();
+            m_unprocessedKeys[unprocessedKeysKey] = reader;
+          }
+        }
+      }
+      else if(reader.KeyEquals("ConsumedCapacity"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_consumedCapacity.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BatchStatementError.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ BatchStatementError::BatchStatementError(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+BatchStatementError::BatchStatementError(JsonReader& reader) : 
+    m_code(BatchStatementErrorCodeEnum::NOT_SET),
+    m_codeHasBeenSet(false),
+    m_messageHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BatchStatementError& BatchStatementError::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Code"))
@@ -52,6 +61,27 @@ BatchStatementError& BatchStatementError::operator =(JsonView jsonValue)
   return *this;
 }
 
+BatchStatementError& BatchStatementError::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Code"))
+      {
+        m_code = BatchStatementErrorCodeEnumMapper::GetBatchStatementErrorCodeEnumForName(reader.ReadString());
+        m_codeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Message"))
+      {
+        m_message = reader.ReadString();
+        m_messageHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue BatchStatementError::Jsonize() const
 {
   JsonValue payload;
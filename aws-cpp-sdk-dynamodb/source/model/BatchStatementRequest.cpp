@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BatchStatementRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ BatchStatementRequest::BatchStatementRequest(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+BatchStatementRequest::BatchStatementRequest(JsonReader& reader) : 
+    m_statementHasBeenSet(false),
+    m_parametersHasBeenSet(false),
+    m_consistentRead(false),
+    m_consistentReadHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BatchStatementRequest& BatchStatementRequest::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Statement"))
@@ -64,6 +74,38 @@ BatchStatementRequest& BatchStatementRequest::operator =(JsonView jsonValue)
   return *this;
 }
 
+BatchStatementRequest& BatchStatementRequest::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Statement"))
+      {
+        m_statement = reader.ReadString();
+        m_statementHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Parameters"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_parameters.push_back(reader);
+          }
+        }
+        m_parametersHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ConsistentRead"))
+      {
+        m_consistentRead = reader.ReadBool();
+        m_consistentReadHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue BatchStatementRequest::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BatchStatementResponse.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ BatchStatementResponse::BatchStatementResponse(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+BatchStatementResponse::BatchStatementResponse(JsonReader& reader) : 
+    m_errorHasBeenSet(false),
+    m_tableNameHasBeenSet(false),
+    m_itemHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BatchStatementResponse& BatchStatementResponse::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Error"))
@@ -62,6 +71,39 @@ BatchStatementResponse& BatchStatementResponse::operator =(JsonView jsonValue)
   return *this;
 }
 
+BatchStatementResponse& BatchStatementResponse::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Error"))
+      {
+        m_error = reader;
+        m_errorHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Item"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemKey = reader.GetKey();
+            m_item[itemKey] = reader;
+          }
+        }
+        m_itemHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue BatchStatementResponse::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BatchWriteItemResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -71,5 +72,72 @@ BatchWriteItemResult& BatchWriteItemResult::operator =(const Aws::AmazonWebServi
 
 
 
+  return *this;
+}
+
+BatchWriteItemResult::BatchWriteItemResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+BatchWriteItemResult& BatchWriteItemResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("UnprocessedItems"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String unprocessedItemsKey = reader.GetKey();
+            Aws::Vector<WriteRequest> writeRequestsList;
+            if(reader.StartArray())
+            {
+              while(reader.NextElement())
+              {
+                writeRequestsList.push_back(reader);
+              }
+            }
+            m_unprocessedItems[unprocessedItemsKey] = std::move(writeRequestsList);
+          }
+        }
+      }
+      else if(reader.KeyEquals("ItemCollectionMetrics"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemCollectionMetricsKey = reader.GetKey();
+            Aws::Vector<ItemCollectionMetrics> itemCollectionMetricsMultipleList;
+            if(reader.StartArray())
+            {
+              while(reader.NextElement())
+              {
+                itemCollectionMetricsMultipleList.push_back(reader);
+              }
+            }
+            m_itemCollectionMetrics[itemCollectionMetricsKey] = std::move(itemCollectionMetricsMultipleList);
+          }
+        }
+      }
+      else if(reader.KeyEquals("ConsumedCapacity"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_consumedCapacity.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BillingModeSummary.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ BillingModeSummary::BillingModeSummary(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+BillingModeSummary::BillingModeSummary(JsonReader& reader) : 
+    m_billingMode(BillingMode::NOT_SET),
+    m_billingModeHasBeenSet(false),
+    m_lastUpdateToPayPerRequestDateTimeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BillingModeSummary& BillingModeSummary::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("BillingMode"))
@@ -52,6 +61,27 @@ BillingModeSummary& BillingModeSummary::operator =(JsonView jsonValue)
   return *this;
 }
 
+BillingModeSummary& BillingModeSummary::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("BillingMode"))
+      {
+        m_billingMode = BillingModeMapper::GetBillingModeForName(reader.ReadString());
+        m_billingModeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LastUpdateToPayPerRequestDateTime"))
+      {
+        m_lastUpdateToPayPerRequestDateTime = reader.ReadDouble();
+        m_lastUpdateToPayPerRequestDateTimeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue BillingModeSummary::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/CancellationReason.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ CancellationReason::CancellationReason(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+CancellationReason::CancellationReason(JsonReader& reader) : 
+    m_itemHasBeenSet(false),
+    m_codeHasBeenSet(false),
+    m_messageHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CancellationReason& CancellationReason::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Item"))
@@ -62,6 +71,39 @@ CancellationReason& CancellationReason::operator =(JsonView jsonValue)
   return *this;
 }
 
+CancellationReason& CancellationReason::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Item"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemKey = reader.GetKey();
+            m_item[itemKey] = reader;
+          }
+        }
+        m_itemHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Code"))
+      {
+        m_code = reader.ReadString();
+        m_codeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Message"))
+      {
+        m_message = reader.ReadString();
+        m_messageHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue CancellationReason::Jsonize() const
 {
   JsonValue payload;
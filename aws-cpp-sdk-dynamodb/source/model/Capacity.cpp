@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Capacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -39,6 +40,17 @@ Capacity::Capacity(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Capacity::Capacity(JsonReader& reader) : 
+    m_readCapacityUnits(0.0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0.0),
+    m_writeCapacityUnitsHasBeenSet(false),
+    m_capacityUnits(0.0),
+    m_capacityUnitsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Capacity& Capacity::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ReadCapacityUnits"))
@@ -65,6 +77,32 @@ Capacity& Capacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+Capacity& Capacity::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ReadCapacityUnits"))
+      {
+        m_readCapacityUnits = reader.ReadDouble();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("WriteCapacityUnits"))
+      {
+        m_writeCapacityUnits = reader.ReadDouble();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CapacityUnits"))
+      {
+        m_capacityUnits = reader.ReadDouble();
+        m_capacityUnitsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Capacity::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Condition.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ Condition::Condition(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Condition::Condition(JsonReader& reader) : 
+    m_attributeValueListHasBeenSet(false),
+    m_comparisonOperator(ComparisonOperator::NOT_SET),
+    m_comparisonOperatorHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Condition& Condition::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("AttributeValueList"))
@@ -55,6 +64,33 @@ Condition& Condition::operator =(JsonView jsonValue)
   return *this;
 }
 
+Condition& Condition::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("AttributeValueList"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_attributeValueList.push_back(reader);
+          }
+        }
+        m_attributeValueListHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ComparisonOperator"))
+      {
+        m_comparisonOperator = ComparisonOperatorMapper::GetComparisonOperatorForName(reader.ReadString());
+        m_comparisonOperatorHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Condition::Jsonize() const
 {
   JsonValue payload;
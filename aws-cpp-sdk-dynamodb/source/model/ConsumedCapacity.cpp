@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ConsumedCapacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -47,6 +48,21 @@ ConsumedCapacity::ConsumedCapacity(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ConsumedCapacity::ConsumedCapacity(JsonReader& reader) : 
+    m_tableNameHasBeenSet(false),
+    m_capacityUnits(0.0),
+    m_capacityUnitsHasBeenSet(false),
+    m_readCapacityUnits(0.0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0.0),
+    m_writeCapacityUnitsHasBeenSet(false),
+    m_tableHasBeenSet(false),
+    m_localSecondaryIndexesHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ConsumedCapacity& ConsumedCapacity::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("TableName"))
@@ -107,6 +123,66 @@ ConsumedCapacity& ConsumedCapacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+ConsumedCapacity& ConsumedCapacity::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CapacityUnits"))
+      {
+        m_capacityUnits = reader.ReadDouble();
+        m_capacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReadCapacityUnits"))
+      {
+        m_readCapacityUnits = reader.ReadDouble();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("WriteCapacityUnits"))
+      {
+        m_writeCapacityUnits = reader.ReadDouble();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Table"))
+      {
+        m_table = reader;
+        m_tableHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LocalSecondaryIndexes"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String localSecondaryIndexesKey = reader.GetKey();
+            m_localSecondaryIndexes[localSecondaryIndexesKey] = reader;
+          }
+        }
+        m_localSecondaryIndexesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalSecondaryIndexes"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String globalSecondaryIndexesKey = reader.GetKey();
+            m_globalSecondaryIndexes[globalSecondaryIndexesKey] = reader;
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ConsumedCapacity::Jsonize() const
 {
   JsonValue payload;
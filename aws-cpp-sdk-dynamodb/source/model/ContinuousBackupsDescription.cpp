@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ContinuousBackupsDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ ContinuousBackupsDescription::ContinuousBackupsDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ContinuousBackupsDescription::ContinuousBackupsDescription(JsonReader& reader) : 
+    m_continuousBackupsStatus(ContinuousBackupsStatus::NOT_SET),
+    m_continuousBackupsStatusHasBeenSet(false),
+    m_pointInTimeRecoveryDescriptionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ContinuousBackupsDescription& ContinuousBackupsDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ContinuousBackupsStatus"))
@@ -52,6 +61,27 @@ ContinuousBackupsDescription& ContinuousBackupsDescription::operator =(JsonView
   return *this;
 }
 
+ContinuousBackupsDescription& ContinuousBackupsDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ContinuousBackupsStatus"))
+      {
+        m_continuousBackupsStatus = ContinuousBackupsStatusMapper::GetContinuousBackupsStatusForName(reader.ReadString());
+        m_continuousBackupsStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("PointInTimeRecoveryDescription"))
+      {
+        m_pointInTimeRecoveryDescription = reader;
+        m_pointInTimeRecoveryDescriptionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ContinuousBackupsDescription::Jsonize() const
 {
   JsonValue payload;
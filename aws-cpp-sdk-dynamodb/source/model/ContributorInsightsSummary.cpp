@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ContributorInsightsSummary.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ ContributorInsightsSummary::ContributorInsightsSummary(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ContributorInsightsSummary::ContributorInsightsSummary(JsonReader& reader) : 
+    m_tableNameHasBeenSet(false),
+    m_indexNameHasBeenSet(false),
+    m_contributorInsightsStatus(ContributorInsightsStatus::NOT_SET),
+    m_contributorInsightsStatusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ContributorInsightsSummary& ContributorInsightsSummary::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("TableName"))
@@ -61,6 +71,32 @@ ContributorInsightsSummary& ContributorInsightsSummary::operator =(JsonView json
   return *this;
 }
 
+ContributorInsightsSummary& ContributorInsightsSummary::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ContributorInsightsStatus"))
+      {
+        m_contributorInsightsStatus = ContributorInsightsStatusMapper::GetContributorInsightsStatusForName(reader.ReadString());
+        m_contributorInsightsStatusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ContributorInsightsSummary::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/CreateBackupResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ CreateBackupResult& CreateBackupResult::operator =(const Aws::AmazonWebServiceRe
 
 
 
+  return *this;
+}
+
+CreateBackupResult::CreateBackupResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+CreateBackupResult& CreateBackupResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("BackupDetails"))
+      {
+        m_backupDetails = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/CreateGlobalTableResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ CreateGlobalTableResult& CreateGlobalTableResult::operator =(const Aws::AmazonWe
 
 
 
+  return *this;
+}
+
+CreateGlobalTableResult::CreateGlobalTableResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+CreateGlobalTableResult& CreateGlobalTableResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("GlobalTableDescription"))
+      {
+        m_globalTableDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/CreateReplicaAction.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ CreateReplicaAction::CreateReplicaAction(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+CreateReplicaAction::CreateReplicaAction(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CreateReplicaAction& CreateReplicaAction::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -41,6 +48,22 @@ CreateReplicaAction& CreateReplicaAction::operator =(JsonView jsonValue)
   return *this;
 }
 
+CreateReplicaAction& CreateReplicaAction::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue CreateReplicaAction::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/CreateReplicationGroupMemberAction.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ CreateReplicationGroupMemberAction::CreateReplicationGroupMemberAction(JsonView
   *this = jsonValue;
 }
 
+CreateReplicationGroupMemberAction::CreateReplicationGroupMemberAction(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false),
+    m_kMSMasterKeyIdHasBeenSet(false),
+    m_provisionedThroughputOverrideHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CreateReplicationGroupMemberAction& CreateReplicationGroupMemberAction::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -71,6 +81,43 @@ CreateReplicationGroupMemberAction& CreateReplicationGroupMemberAction::operator
   return *this;
 }
 
+CreateReplicationGroupMemberAction& CreateReplicationGroupMemberAction::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KMSMasterKeyId"))
+      {
+        m_kMSMasterKeyId = reader.ReadString();
+        m_kMSMasterKeyIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughputOverride"))
+      {
+        m_provisionedThroughputOverride = reader;
+        m_provisionedThroughputOverrideHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalSecondaryIndexes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_globalSecondaryIndexes.push_back(reader);
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue CreateReplicationGroupMemberAction::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Delete.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -41,6 +42,18 @@ Delete::Delete(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Delete::Delete(JsonReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_tableNameHasBeenSet(false),
+    m_conditionExpressionHasBeenSet(false),
+    m_expressionAttributeNamesHasBeenSet(false),
+    m_expressionAttributeValuesHasBeenSet(false),
+    m_returnValuesOnConditionCheckFailure(ReturnValuesOnConditionCheckFailure::NOT_SET),
+    m_returnValuesOnConditionCheckFailureHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Delete& Delete::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Key"))
@@ -97,6 +110,68 @@ Delete& Delete::operator =(JsonView jsonValue)
   return *this;
 }
 
+Delete& Delete::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Key"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String keyKey = reader.GetKey();
+            m_key[keyKey] = reader;
+          }
+        }
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ConditionExpression"))
+      {
+        m_conditionExpression = reader.ReadString();
+        m_conditionExpressionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExpressionAttributeNames"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String expressionAttributeNamesKey = reader.GetKey();
+            m_expressionAttributeNames[expressionAttributeNamesKey] = reader.ReadString();
+          }
+        }
+        m_expressionAttributeNamesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExpressionAttributeValues"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String expressionAttributeValuesKey = reader.GetKey();
+            m_expressionAttributeValues[expressionAttributeValuesKey] = reader;
+          }
+        }
+        m_expressionAttributeValuesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReturnValuesOnConditionCheckFailure"))
+      {
+        m_returnValuesOnConditionCheckFailure = ReturnValuesOnConditionCheckFailureMapper::GetReturnValuesOnConditionCheckFailureForName(reader.ReadString());
+        m_returnValuesOnConditionCheckFailureHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Delete::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DeleteBackupResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DeleteBackupResult& DeleteBackupResult::operator =(const Aws::AmazonWebServiceRe
 
 
 
+  return *this;
+}
+
+DeleteBackupResult::DeleteBackupResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DeleteBackupResult& DeleteBackupResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("BackupDescription"))
+      {
+        m_backupDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
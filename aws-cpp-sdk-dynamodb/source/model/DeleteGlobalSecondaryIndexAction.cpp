@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DeleteGlobalSecondaryIndexAction.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ DeleteGlobalSecondaryIndexAction::DeleteGlobalSecondaryIndexAction(JsonView json
   *this = jsonValue;
 }
 
+DeleteGlobalSecondaryIndexAction::DeleteGlobalSecondaryIndexAction(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteGlobalSecondaryIndexAction& DeleteGlobalSecondaryIndexAction::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -41,6 +48,22 @@ DeleteGlobalSecondaryIndexAction& DeleteGlobalSecondaryIndexAction::operator =(J
   return *this;
 }
 
+DeleteGlobalSecondaryIndexAction& DeleteGlobalSecondaryIndexAction::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue DeleteGlobalSecondaryIndexAction::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DeleteReplicaAction.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ DeleteReplicaAction::DeleteReplicaAction(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+DeleteReplicaAction::DeleteReplicaAction(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteReplicaAction& DeleteReplicaAction::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -41,6 +48,22 @@ DeleteReplicaAction& DeleteReplicaAction::operator =(JsonView jsonValue)
   return *this;
 }
 
+DeleteReplicaAction& DeleteReplicaAction::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue DeleteReplicaAction::Jsonize() const
 {
   JsonValue payload;
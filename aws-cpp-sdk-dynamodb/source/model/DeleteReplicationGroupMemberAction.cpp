@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DeleteReplicationGroupMemberAction.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ DeleteReplicationGroupMemberAction::DeleteReplicationGroupMemberAction(JsonView
   *this = jsonValue;
 }
 
+DeleteReplicationGroupMemberAction::DeleteReplicationGroupMemberAction(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteReplicationGroupMemberAction& DeleteReplicationGroupMemberAction::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -41,6 +48,22 @@ DeleteReplicationGroupMemberAction& DeleteReplicationGroupMemberAction::operator
   return *this;
 }
 
+DeleteReplicationGroupMemberAction& DeleteReplicationGroupMemberAction::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue DeleteReplicationGroupMemberAction::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DeleteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ DeleteRequest::DeleteRequest(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+DeleteRequest::DeleteRequest(JsonReader& reader) : 
+    m_keyHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteRequest& DeleteRequest::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Key"))
@@ -44,6 +51,29 @@ DeleteRequest& DeleteRequest::operator =(JsonView jsonValue)
   return *this;
 }
 
+DeleteRequest& DeleteRequest::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Key"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String keyKey = reader.GetKey();
+            m_key[keyKey] = reader;
+          }
+        }
+        m_keyHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue DeleteRequest::Jsonize() const
 {
   JsonValue payload;
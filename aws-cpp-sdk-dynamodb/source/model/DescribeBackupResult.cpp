@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeBackupResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DescribeBackupResult& DescribeBackupResult::operator =(const Aws::AmazonWebServi
 
 
 
+  return *this;
+}
+
+DescribeBackupResult::DescribeBackupResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeBackupResult& DescribeBackupResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("BackupDescription"))
+      {
+        m_backupDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeContributorInsightsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -71,5 +72,55 @@ DescribeContributorInsightsResult& DescribeContributorInsightsResult::operator =
 
 
 
+  return *this;
+}
+
+DescribeContributorInsightsResult::DescribeContributorInsightsResult(const Aws::AmazonWebServiceResult<JsonReader>& result) : 
+    m_contributorInsightsStatus(ContributorInsightsStatus::NOT_SET)
+{
+  *this = result;
+}
+
+DescribeContributorInsightsResult& DescribeContributorInsightsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+      }
+      else if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+      }
+      else if(reader.KeyEquals("ContributorInsightsRuleList"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_contributorInsightsRuleList.push_back(reader.ReadString());
+          }
+        }
+      }
+      else if(reader.KeyEquals("ContributorInsightsStatus"))
+      {
+        m_contributorInsightsStatus = ContributorInsightsStatusMapper::GetContributorInsightsStatusForName(reader.ReadString());
+      }
+      else if(reader.KeyEquals("LastUpdateDateTime"))
+      {
+        m_lastUpdateDateTime = reader.ReadDouble();
+      }
+      else if(reader.KeyEquals("FailureException"))
+      {
+        m_failureException = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
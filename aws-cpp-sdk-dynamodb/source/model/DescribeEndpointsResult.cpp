@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeEndpointsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -39,5 +40,34 @@ DescribeEndpointsResult& DescribeEndpointsResult::operator =(const Aws::AmazonWe
 
 
 
+  return *this;
+}
+
+DescribeEndpointsResult::DescribeEndpointsResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeEndpointsResult& DescribeEndpointsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Endpoints"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_endpoints.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
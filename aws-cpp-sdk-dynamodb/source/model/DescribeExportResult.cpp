@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeExportResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DescribeExportResult& DescribeExportResult::operator =(const Aws::AmazonWebServi
 
 
 
+  return *this;
+}
+
+DescribeExportResult::DescribeExportResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeExportResult& DescribeExportResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ExportDescription"))
+      {
+        m_exportDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
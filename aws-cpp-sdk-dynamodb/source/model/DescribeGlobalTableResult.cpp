@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeGlobalTableResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DescribeGlobalTableResult& DescribeGlobalTableResult::operator =(const Aws::Amaz
 
 
 
+  return *this;
+}
+
+DescribeGlobalTableResult::DescribeGlobalTableResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeGlobalTableResult& DescribeGlobalTableResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("GlobalTableDescription"))
+      {
+        m_globalTableDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeKinesisStreamingDestinationResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,38 @@ DescribeKinesisStreamingDestinationResult& DescribeKinesisStreamingDestinationRe
 
 
 
+  return *this;
+}
+
+DescribeKinesisStreamingDestinationResult::DescribeKinesisStreamingDestinationResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeKinesisStreamingDestinationResult& DescribeKinesisStreamingDestinationResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+      }
+      else if(reader.KeyEquals("KinesisDataStreamDestinations"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_kinesisDataStreamDestinations.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeLimitsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -62,5 +63,44 @@ DescribeLimitsResult& DescribeLimitsResult::operator =(const Aws::AmazonWebServi
 
 
 
+  return *this;
+}
+
+DescribeLimitsResult::DescribeLimitsResult(const Aws::AmazonWebServiceResult<JsonReader>& result) : 
+    m_accountMaxReadCapacityUnits(0),
+    m_accountMaxWriteCapacityUnits(0),
+    m_tableMaxReadCapacityUnits(0),
+    m_tableMaxWriteCapacityUnits(0)
+{
+  *this = result;
+}
+
+DescribeLimitsResult& DescribeLimitsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("AccountMaxReadCapacityUnits"))
+      {
+        m_accountMaxReadCapacityUnits = reader.ReadInt64();
+      }
+      else if(reader.KeyEquals("AccountMaxWriteCapacityUnits"))
+      {
+        m_accountMaxWriteCapacityUnits = reader.ReadInt64();
+      }
+      else if(reader.KeyEquals("TableMaxReadCapacityUnits"))
+      {
+        m_tableMaxReadCapacityUnits = reader.ReadInt64();
+      }
+      else if(reader.KeyEquals("TableMaxWriteCapacityUnits"))
+      {
+        m_tableMaxWriteCapacityUnits = reader.ReadInt64();
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeTableReplicaAutoScalingResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DescribeTableReplicaAutoScalingResult& DescribeTableReplicaAutoScalingResult::op
 
 
 
+  return *this;
+}
+
+DescribeTableReplicaAutoScalingResult::DescribeTableReplicaAutoScalingResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeTableReplicaAutoScalingResult& DescribeTableReplicaAutoScalingResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableAutoScalingDescription"))
+      {
+        m_tableAutoScalingDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeTableResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DescribeTableResult& DescribeTableResult::operator =(const Aws::AmazonWebService
 
 
 
+  return *this;
+}
+
+DescribeTableResult::DescribeTableResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeTableResult& DescribeTableResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Table"))
+      {
+        m_table = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DescribeTimeToLiveResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DescribeTimeToLiveResult& DescribeTimeToLiveResult::operator =(const Aws::Amazon
 
 
 
+  return *this;
+}
+
+DescribeTimeToLiveResult::DescribeTimeToLiveResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeTimeToLiveResult& DescribeTimeToLiveResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TimeToLiveDescription"))
+      {
+        m_timeToLiveDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
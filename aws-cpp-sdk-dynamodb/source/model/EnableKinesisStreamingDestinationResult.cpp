@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/EnableKinesisStreamingDestinationResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -50,5 +51,37 @@ EnableKinesisStreamingDestinationResult& EnableKinesisStreamingDestinationResult
 
 
 
+  return *this;
+}
+
+EnableKinesisStreamingDestinationResult::EnableKinesisStreamingDestinationResult(const Aws::AmazonWebServiceResult<JsonReader>& result) : 
+    m_destinationStatus(DestinationStatus::NOT_SET)
+{
+  *this = result;
+}
+
+EnableKinesisStreamingDestinationResult& EnableKinesisStreamingDestinationResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+      }
+      else if(reader.KeyEquals("StreamArn"))
+      {
+        m_streamArn = reader.ReadString();
+      }
+      else if(reader.KeyEquals("DestinationStatus"))
+      {
+        m_destinationStatus = DestinationStatusMapper::GetDestinationStatusForName(reader.ReadString());
+      }
+    }
+  }
+
+
   return *this;
 }
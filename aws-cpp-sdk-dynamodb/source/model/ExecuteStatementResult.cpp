@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ExecuteStatementResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -51,5 +52,47 @@ ExecuteStatementResult& ExecuteStatementResult::operator =(const Aws::AmazonWebS
 
 
 
+  return *this;
+}
+
+ExecuteStatementResult::ExecuteStatementResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ExecuteStatementResult& ExecuteStatementResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Items"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+            if(reader.StartObject())
+            {
+              while(reader.NextMember())
+              {
+                Aws::String attributeMapKey = reader.GetKey();
+                attributeMapMap[attributeMapKey] = reader;
+              }
+            }
+            m_items.push_back(std::move(attributeMapMap));
+          }
+        }
+      }
+      else if(reader.KeyEquals("NextToken"))
+      {
+        m_nextToken = reader.ReadString();
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ExecuteTransactionResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -39,5 +40,34 @@ ExecuteTransactionResult& ExecuteTransactionResult::operator =(const Aws::Amazon
 
 
 
+  return *this;
+}
+
+ExecuteTransactionResult::ExecuteTransactionResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ExecuteTransactionResult& ExecuteTransactionResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Responses"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_responses.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ExpectedAttributeValue.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -39,6 +40,17 @@ ExpectedAttributeValue::ExpectedAttributeValue(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ExpectedAttributeValue::ExpectedAttributeValue(JsonReader& reader) : 
+    m_valueHasBeenSet(false),
+    m_exists(false),
+    m_existsHasBeenSet(false),
+    m_comparisonOperator(ComparisonOperator::NOT_SET),
+    m_comparisonOperatorHasBeenSet(false),
+    m_attributeValueListHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ExpectedAttributeValue& ExpectedAttributeValue::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Value"))
@@ -75,6 +87,43 @@ ExpectedAttributeValue& ExpectedAttributeValue::operator =(JsonView jsonValue)
   return *this;
 }
 
+ExpectedAttributeValue& ExpectedAttributeValue::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Value"))
+      {
+        m_value = reader;
+        m_valueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Exists"))
+      {
+        m_exists = reader.ReadBool();
+        m_existsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ComparisonOperator"))
+      {
+        m_comparisonOperator = ComparisonOperatorMapper::GetComparisonOperatorForName(reader.ReadString());
+        m_comparisonOperatorHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AttributeValueList"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_attributeValueList.push_back(reader);
+          }
+        }
+        m_attributeValueListHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ExpectedAttributeValue::Jsonize() const
 {
   JsonValue payload;
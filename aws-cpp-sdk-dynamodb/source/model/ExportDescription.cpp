@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ExportDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -75,6 +76,35 @@ ExportDescription::ExportDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ExportDescription::ExportDescription(JsonReader& reader) : 
+    m_exportArnHasBeenSet(false),
+    m_exportStatus(ExportStatus::NOT_SET),
+    m_exportStatusHasBeenSet(false),
+    m_startTimeHasBeenSet(false),
+    m_endTimeHasBeenSet(false),
+    m_exportManifestHasBeenSet(false),
+    m_tableArnHasBeenSet(false),
+    m_tableIdHasBeenSet(false),
+    m_exportTimeHasBeenSet(false),
+    m_clientTokenHasBeenSet(false),
+    m_s3BucketHasBeenSet(false),
+    m_s3BucketOwnerHasBeenSet(false),
+    m_s3PrefixHasBeenSet(false),
+    m_s3SseAlgorithm(S3SseAlgorithm::NOT_SET),
+    m_s3SseAlgorithmHasBeenSet(false),
+    m_s3SseKmsKeyIdHasBeenSet(false),
+    m_failureCodeHasBeenSet(false),
+    m_failureMessageHasBeenSet(false),
+    m_exportFormat(ExportFormat::NOT_SET),
+    m_exportFormatHasBeenSet(false),
+    m_billedSizeBytes(0),
+    m_billedSizeBytesHasBeenSet(false),
+    m_itemCount(0),
+    m_itemCountHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ExportDescription& ExportDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ExportArn"))
@@ -213,6 +243,112 @@ ExportDescription& ExportDescription::operator =(JsonView jsonValue)
   return *this;
 }
 
+ExportDescription& ExportDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ExportArn"))
+      {
+        m_exportArn = reader.ReadString();
+        m_exportArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExportStatus"))
+      {
+        m_exportStatus = ExportStatusMapper::GetExportStatusForName(reader.ReadString());
+        m_exportStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("StartTime"))
+      {
+        m_startTime = reader.ReadDouble();
+        m_startTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("EndTime"))
+      {
+        m_endTime = reader.ReadDouble();
+        m_endTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExportManifest"))
+      {
+        m_exportManifest = reader.ReadString();
+        m_exportManifestHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableArn"))
+      {
+        m_tableArn = reader.ReadString();
+        m_tableArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableId"))
+      {
+        m_tableId = reader.ReadString();
+        m_tableIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExportTime"))
+      {
+        m_exportTime = reader.ReadDouble();
+        m_exportTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ClientToken"))
+      {
+        m_clientToken = reader.ReadString();
+        m_clientTokenHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("S3Bucket"))
+      {
+        m_s3Bucket = reader.ReadString();
+        m_s3BucketHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("S3BucketOwner"))
+      {
+        m_s3BucketOwner = reader.ReadString();
+        m_s3BucketOwnerHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("S3Prefix"))
+      {
+        m_s3Prefix = reader.ReadString();
+        m_s3PrefixHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("S3SseAlgorithm"))
+      {
+        m_s3SseAlgorithm = S3SseAlgorithmMapper::GetS3SseAlgorithmForName(reader.ReadString());
+        m_s3SseAlgorithmHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("S3SseKmsKeyId"))
+      {
+        m_s3SseKmsKeyId = reader.ReadString();
+        m_s3SseKmsKeyIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("FailureCode"))
+      {
+        m_failureCode = reader.ReadString();
+        m_failureCodeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("FailureMessage"))
+      {
+        m_failureMessage = reader.ReadString();
+        m_failureMessageHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExportFormat"))
+      {
+        m_exportFormat = ExportFormatMapper::GetExportFormatForName(reader.ReadString());
+        m_exportFormatHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BilledSizeBytes"))
+      {
+        m_billedSizeBytes = reader.ReadInt64();
+        m_billedSizeBytesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ItemCount"))
+      {
+        m_itemCount = reader.ReadInt64();
+        m_itemCountHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ExportDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ExportSummary.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ ExportSummary::ExportSummary(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ExportSummary::ExportSummary(JsonReader& reader) : 
+    m_exportArnHasBeenSet(false),
+    m_exportStatus(ExportStatus::NOT_SET),
+    m_exportStatusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ExportSummary& ExportSummary::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ExportArn"))
@@ -52,6 +61,27 @@ ExportSummary& ExportSummary::operator =(JsonView jsonValue)
   return *this;
 }
 
+ExportSummary& ExportSummary::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ExportArn"))
+      {
+        m_exportArn = reader.ReadString();
+        m_exportArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExportStatus"))
+      {
+        m_exportStatus = ExportStatusMapper::GetExportStatusForName(reader.ReadString());
+        m_exportStatusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ExportSummary::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ExportTableToPointInTimeResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ ExportTableToPointInTimeResult& ExportTableToPointInTimeResult::operator =(const
 
 
 
+  return *this;
+}
+
+ExportTableToPointInTimeResult::ExportTableToPointInTimeResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ExportTableToPointInTimeResult& ExportTableToPointInTimeResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ExportDescription"))
+      {
+        m_exportDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
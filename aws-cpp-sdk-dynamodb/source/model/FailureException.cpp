@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/FailureException.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ FailureException::FailureException(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+FailureException::FailureException(JsonReader& reader) : 
+    m_exceptionNameHasBeenSet(false),
+    m_exceptionDescriptionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 FailureException& FailureException::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ExceptionName"))
@@ -50,6 +58,27 @@ FailureException& FailureException::operator =(JsonView jsonValue)
   return *this;
 }
 
+FailureException& FailureException::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ExceptionName"))
+      {
+        m_exceptionName = reader.ReadString();
+        m_exceptionNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExceptionDescription"))
+      {
+        m_exceptionDescription = reader.ReadString();
+        m_exceptionDescriptionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue FailureException::Jsonize() const
 {
   JsonValue payload;
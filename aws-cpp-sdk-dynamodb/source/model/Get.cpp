@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Get.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ Get::Get(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Get::Get(JsonReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_tableNameHasBeenSet(false),
+    m_projectionExpressionHasBeenSet(false),
+    m_expressionAttributeNamesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Get& Get::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Key"))
@@ -74,6 +84,51 @@ Get& Get::operator =(JsonView jsonValue)
   return *this;
 }
 
+Get& Get::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Key"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String keyKey = reader.GetKey();
+            m_key[keyKey] = reader;
+          }
+        }
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProjectionExpression"))
+      {
+        m_projectionExpression = reader.ReadString();
+        m_projectionExpressionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExpressionAttributeNames"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String expressionAttributeNamesKey = reader.GetKey();
+            m_expressionAttributeNames[expressionAttributeNamesKey] = reader.ReadString();
+          }
+        }
+        m_expressionAttributeNamesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Get::Jsonize() const
 {
   JsonValue payload;
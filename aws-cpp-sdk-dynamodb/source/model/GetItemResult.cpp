@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GetItemResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,39 @@ GetItemResult& GetItemResult::operator =(const Aws::AmazonWebServiceResult<JsonV
 
 
 
+  return *this;
+}
+
+GetItemResult::GetItemResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+GetItemResult& GetItemResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Item"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemKey = reader.GetKey();
+            m_item[itemKey] = reader;
+          }
+        }
+      }
+      else if(reader.KeyEquals("ConsumedCapacity"))
+      {
+        m_consumedCapacity = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
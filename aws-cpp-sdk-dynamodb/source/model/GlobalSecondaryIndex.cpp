@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GlobalSecondaryIndex.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ GlobalSecondaryIndex::GlobalSecondaryIndex(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+GlobalSecondaryIndex::GlobalSecondaryIndex(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_keySchemaHasBeenSet(false),
+    m_projectionHasBeenSet(false),
+    m_provisionedThroughputHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlobalSecondaryIndex& GlobalSecondaryIndex::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -71,6 +81,43 @@ GlobalSecondaryIndex& GlobalSecondaryIndex::operator =(JsonView jsonValue)
   return *this;
 }
 
+GlobalSecondaryIndex& GlobalSecondaryIndex::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeySchema"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_keySchema.push_back(reader);
+          }
+        }
+        m_keySchemaHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Projection"))
+      {
+        m_projection = reader;
+        m_projectionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughput"))
+      {
+        m_provisionedThroughput = reader;
+        m_provisionedThroughputHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue GlobalSecondaryIndex::Jsonize() const
 {
   JsonValue payload;
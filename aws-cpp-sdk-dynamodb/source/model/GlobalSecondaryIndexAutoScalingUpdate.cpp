@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GlobalSecondaryIndexAutoScalingUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ GlobalSecondaryIndexAutoScalingUpdate::GlobalSecondaryIndexAutoScalingUpdate(Jso
   *this = jsonValue;
 }
 
+GlobalSecondaryIndexAutoScalingUpdate::GlobalSecondaryIndexAutoScalingUpdate(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_provisionedWriteCapacityAutoScalingUpdateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlobalSecondaryIndexAutoScalingUpdate& GlobalSecondaryIndexAutoScalingUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -50,6 +58,27 @@ GlobalSecondaryIndexAutoScalingUpdate& GlobalSecondaryIndexAutoScalingUpdate::op
   return *this;
 }
 
+GlobalSecondaryIndexAutoScalingUpdate& GlobalSecondaryIndexAutoScalingUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedWriteCapacityAutoScalingUpdate"))
+      {
+        m_provisionedWriteCapacityAutoScalingUpdate = reader;
+        m_provisionedWriteCapacityAutoScalingUpdateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue GlobalSecondaryIndexAutoScalingUpdate::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GlobalSecondaryIndexDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -53,6 +54,24 @@ GlobalSecondaryIndexDescription::GlobalSecondaryIndexDescription(JsonView jsonVa
   *this = jsonValue;
 }
 
+GlobalSecondaryIndexDescription::GlobalSecondaryIndexDescription(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_keySchemaHasBeenSet(false),
+    m_projectionHasBeenSet(false),
+    m_indexStatus(IndexStatus::NOT_SET),
+    m_indexStatusHasBeenSet(false),
+    m_backfilling(false),
+    m_backfillingHasBeenSet(false),
+    m_provisionedThroughputHasBeenSet(false),
+    m_indexSizeBytes(0),
+    m_indexSizeBytesHasBeenSet(false),
+    m_itemCount(0),
+    m_itemCountHasBeenSet(false),
+    m_indexArnHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlobalSecondaryIndexDescription& GlobalSecondaryIndexDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -124,6 +143,68 @@ GlobalSecondaryIndexDescription& GlobalSecondaryIndexDescription::operator =(Jso
   return *this;
 }
 
+GlobalSecondaryIndexDescription& GlobalSecondaryIndexDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeySchema"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_keySchema.push_back(reader);
+          }
+        }
+        m_keySchemaHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Projection"))
+      {
+        m_projection = reader;
+        m_projectionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexStatus"))
+      {
+        m_indexStatus = IndexStatusMapper::GetIndexStatusForName(reader.ReadString());
+        m_indexStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Backfilling"))
+      {
+        m_backfilling = reader.ReadBool();
+        m_backfillingHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughput"))
+      {
+        m_provisionedThroughput = reader;
+        m_provisionedThroughputHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexSizeBytes"))
+      {
+        m_indexSizeBytes = reader.ReadInt64();
+        m_indexSizeBytesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ItemCount"))
+      {
+        m_itemCount = reader.ReadInt64();
+        m_itemCountHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexArn"))
+      {
+        m_indexArn = reader.ReadString();
+        m_indexArnHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue GlobalSecondaryIndexDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GlobalSecondaryIndexUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ GlobalSecondaryIndexUpdate::GlobalSecondaryIndexUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+GlobalSecondaryIndexUpdate::GlobalSecondaryIndexUpdate(JsonReader& reader) : 
+    m_updateHasBeenSet(false),
+    m_createHasBeenSet(false),
+    m_deleteHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlobalSecondaryIndexUpdate& GlobalSecondaryIndexUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Update"))
@@ -59,6 +68,32 @@ GlobalSecondaryIndexUpdate& GlobalSecondaryIndexUpdate::operator =(JsonView json
   return *this;
 }
 
+GlobalSecondaryIndexUpdate& GlobalSecondaryIndexUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Update"))
+      {
+        m_update = reader;
+        m_updateHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Create"))
+      {
+        m_create = reader;
+        m_createHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Delete"))
+      {
+        m_delete = reader;
+        m_deleteHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue GlobalSecondaryIndexUpdate::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GlobalTable.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ GlobalTable::GlobalTable(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+GlobalTable::GlobalTable(JsonReader& reader) : 
+    m_globalTableNameHasBeenSet(false),
+    m_replicationGroupHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlobalTable& GlobalTable::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("GlobalTableName"))
@@ -53,6 +61,33 @@ GlobalTable& GlobalTable::operator =(JsonView jsonValue)
   return *this;
 }
 
+GlobalTable& GlobalTable::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("GlobalTableName"))
+      {
+        m_globalTableName = reader.ReadString();
+        m_globalTableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicationGroup"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicationGroup.push_back(reader);
+          }
+        }
+        m_replicationGroupHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue GlobalTable::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GlobalTableDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -39,6 +40,17 @@ GlobalTableDescription::GlobalTableDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+GlobalTableDescription::GlobalTableDescription(JsonReader& reader) : 
+    m_replicationGroupHasBeenSet(false),
+    m_globalTableArnHasBeenSet(false),
+    m_creationDateTimeHasBeenSet(false),
+    m_globalTableStatus(GlobalTableStatus::NOT_SET),
+    m_globalTableStatusHasBeenSet(false),
+    m_globalTableNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlobalTableDescription& GlobalTableDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ReplicationGroup"))
@@ -82,6 +94,48 @@ GlobalTableDescription& GlobalTableDescription::operator =(JsonView jsonValue)
   return *this;
 }
 
+GlobalTableDescription& GlobalTableDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ReplicationGroup"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicationGroup.push_back(reader);
+          }
+        }
+        m_replicationGroupHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalTableArn"))
+      {
+        m_globalTableArn = reader.ReadString();
+        m_globalTableArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CreationDateTime"))
+      {
+        m_creationDateTime = reader.ReadDouble();
+        m_creationDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalTableStatus"))
+      {
+        m_globalTableStatus = GlobalTableStatusMapper::GetGlobalTableStatusForName(reader.ReadString());
+        m_globalTableStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalTableName"))
+      {
+        m_globalTableName = reader.ReadString();
+        m_globalTableNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue GlobalTableDescription::Jsonize() const
 {
   JsonValue payload;
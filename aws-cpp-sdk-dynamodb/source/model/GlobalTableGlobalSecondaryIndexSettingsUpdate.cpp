@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/GlobalTableGlobalSecondaryIndexSettingsUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ GlobalTableGlobalSecondaryIndexSettingsUpdate::GlobalTableGlobalSecondaryIndexSe
   *this = jsonValue;
 }
 
+GlobalTableGlobalSecondaryIndexSettingsUpdate::GlobalTableGlobalSecondaryIndexSettingsUpdate(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_provisionedWriteCapacityUnits(0),
+    m_provisionedWriteCapacityUnitsHasBeenSet(false),
+    m_provisionedWriteCapacityAutoScalingSettingsUpdateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlobalTableGlobalSecondaryIndexSettingsUpdate& GlobalTableGlobalSecondaryIndexSettingsUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -61,6 +71,32 @@ GlobalTableGlobalSecondaryIndexSettingsUpdate& GlobalTableGlobalSecondaryIndexSe
   return *this;
 }
 
+GlobalTableGlobalSecondaryIndexSettingsUpdate& GlobalTableGlobalSecondaryIndexSettingsUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedWriteCapacityUnits"))
+      {
+        m_provisionedWriteCapacityUnits = reader.ReadInt64();
+        m_provisionedWriteCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedWriteCapacityAutoScalingSettingsUpdate"))
+      {
+        m_provisionedWriteCapacityAutoScalingSettingsUpdate = reader;
+        m_provisionedWriteCapacityAutoScalingSettingsUpdateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue GlobalTableGlobalSecondaryIndexSettingsUpdate::Jsonize() const
 {
   JsonValue payload;
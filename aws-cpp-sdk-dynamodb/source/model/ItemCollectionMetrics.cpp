@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ItemCollectionMetrics.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ ItemCollectionMetrics::ItemCollectionMetrics(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ItemCollectionMetrics::ItemCollectionMetrics(JsonReader& reader) : 
+    m_itemCollectionKeyHasBeenSet(false),
+    m_sizeEstimateRangeGBHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ItemCollectionMetrics& ItemCollectionMetrics::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ItemCollectionKey"))
@@ -56,6 +64,40 @@ ItemCollectionMetrics& ItemCollectionMetrics::operator =(JsonView jsonValue)
   return *this;
 }
 
+ItemCollectionMetrics& ItemCollectionMetrics::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ItemCollectionKey"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemCollectionKeyKey = reader.GetKey();
+            m_itemCollectionKey[itemCollectionKeyKey] = reader;
+          }
+        }
+        m_itemCollectionKeyHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SizeEstimateRangeGB"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_sizeEstimateRangeGB.push_back(reader.ReadDouble());
+          }
+        }
+        m_sizeEstimateRangeGBHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ItemCollectionMetrics::Jsonize() const
 {
   JsonValue payload;
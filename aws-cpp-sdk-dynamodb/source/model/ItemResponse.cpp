@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ItemResponse.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ ItemResponse::ItemResponse(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ItemResponse::ItemResponse(JsonReader& reader) : 
+    m_itemHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ItemResponse& ItemResponse::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Item"))
@@ -44,6 +51,29 @@ ItemResponse& ItemResponse::operator =(JsonView jsonValue)
   return *this;
 }
 
+ItemResponse& ItemResponse::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Item"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemKey = reader.GetKey();
+            m_item[itemKey] = reader;
+          }
+        }
+        m_itemHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ItemResponse::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/KeySchemaElement.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ KeySchemaElement::KeySchemaElement(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+KeySchemaElement::KeySchemaElement(JsonReader& reader) : 
+    m_attributeNameHasBeenSet(false),
+    m_keyType(KeyType::NOT_SET),
+    m_keyTypeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 KeySchemaElement& KeySchemaElement::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("AttributeName"))
@@ -52,6 +61,27 @@ KeySchemaElement& KeySchemaElement::operator =(JsonView jsonValue)
   return *this;
 }
 
+KeySchemaElement& KeySchemaElement::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("AttributeName"))
+      {
+        m_attributeName = reader.ReadString();
+        m_attributeNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeyType"))
+      {
+        m_keyType = KeyTypeMapper::GetKeyTypeForName(reader.ReadString());
+        m_keyTypeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue KeySchemaElement::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/KeysAndAttributes.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -39,6 +40,17 @@ KeysAndAttributes::KeysAndAttributes(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+KeysAndAttributes::KeysAndAttributes(JsonReader& reader) : 
+    m_keysHasBeenSet(false),
+    m_attributesToGetHasBeenSet(false),
+    m_consistentRead(false),
+    m_consistentReadHasBeenSet(false),
+    m_projectionExpressionHasBeenSet(false),
+    m_expressionAttributeNamesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 KeysAndAttributes& KeysAndAttributes::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Keys"))
@@ -94,6 +106,70 @@ KeysAndAttributes& KeysAndAttributes::operator =(JsonView jsonValue)
   return *this;
 }
 
+KeysAndAttributes& KeysAndAttributes::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Keys"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            Aws::Map<Aws::String, AttributeValue> keyMap;
+            if(reader.StartObject())
+            {
+              while(reader.NextMember())
+              {
+                Aws::String keyKey = reader.GetKey();
+                keyMap[keyKey] = reader;
+              }
+            }
+            m_keys.push_back(std::move(keyMap));
+          }
+        }
+        m_keysHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AttributesToGet"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_attributesToGet.push_back(reader.ReadString());
+          }
+        }
+        m_attributesToGetHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ConsistentRead"))
+      {
+        m_consistentRead = reader.ReadBool();
+        m_consistentReadHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProjectionExpression"))
+      {
+        m_projectionExpression = reader.ReadString();
+        m_projectionExpressionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExpressionAttributeNames"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String expressionAttributeNamesKey = reader.GetKey();
+            m_expressionAttributeNames[expressionAttributeNamesKey] = reader.ReadString();
+          }
+        }
+        m_expressionAttributeNamesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue KeysAndAttributes::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/KinesisDataStreamDestination.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ KinesisDataStreamDestination::KinesisDataStreamDestination(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+KinesisDataStreamDestination::KinesisDataStreamDestination(JsonReader& reader) : 
+    m_streamArnHasBeenSet(false),
+    m_destinationStatus(DestinationStatus::NOT_SET),
+    m_destinationStatusHasBeenSet(false),
+    m_destinationStatusDescriptionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 KinesisDataStreamDestination& KinesisDataStreamDestination::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("StreamArn"))
@@ -61,6 +71,32 @@ KinesisDataStreamDestination& KinesisDataStreamDestination::operator =(JsonView
   return *this;
 }
 
+KinesisDataStreamDestination& KinesisDataStreamDestination::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("StreamArn"))
+      {
+        m_streamArn = reader.ReadString();
+        m_streamArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("DestinationStatus"))
+      {
+        m_destinationStatus = DestinationStatusMapper::GetDestinationStatusForName(reader.ReadString());
+        m_destinationStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("DestinationStatusDescription"))
+      {
+        m_destinationStatusDescription = reader.ReadString();
+        m_destinationStatusDescriptionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue KinesisDataStreamDestination::Jsonize() const
 {
   JsonValue payload;
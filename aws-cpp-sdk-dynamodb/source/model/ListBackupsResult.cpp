@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ListBackupsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,38 @@ ListBackupsResult& ListBackupsResult::operator =(const Aws::AmazonWebServiceResu
 
 
 
+  return *this;
+}
+
+ListBackupsResult::ListBackupsResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ListBackupsResult& ListBackupsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("BackupSummaries"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_backupSummaries.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("LastEvaluatedBackupArn"))
+      {
+        m_lastEvaluatedBackupArn = reader.ReadString();
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ListExportsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,38 @@ ListExportsResult& ListExportsResult::operator =(const Aws::AmazonWebServiceResu
 
 
 
+  return *this;
+}
+
+ListExportsResult::ListExportsResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ListExportsResult& ListExportsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ExportSummaries"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_exportSummaries.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("NextToken"))
+      {
+        m_nextToken = reader.ReadString();
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ListGlobalTablesResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,38 @@ ListGlobalTablesResult& ListGlobalTablesResult::operator =(const Aws::AmazonWebS
 
 
 
+  return *this;
+}
+
+ListGlobalTablesResult::ListGlobalTablesResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ListGlobalTablesResult& ListGlobalTablesResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("GlobalTables"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_globalTables.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("LastEvaluatedGlobalTableName"))
+      {
+        m_lastEvaluatedGlobalTableName = reader.ReadString();
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ListTablesResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,38 @@ ListTablesResult& ListTablesResult::operator =(const Aws::AmazonWebServiceResult
 
 
 
+  return *this;
+}
+
+ListTablesResult::ListTablesResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ListTablesResult& ListTablesResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableNames"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_tableNames.push_back(reader.ReadString());
+          }
+        }
+      }
+      else if(reader.KeyEquals("LastEvaluatedTableName"))
+      {
+        m_lastEvaluatedTableName = reader.ReadString();
+      }
+    }
+  }
+
+
   return *this;
 }
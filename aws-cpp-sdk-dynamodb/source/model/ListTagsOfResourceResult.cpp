@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ListTagsOfResourceResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,38 @@ ListTagsOfResourceResult& ListTagsOfResourceResult::operator =(const Aws::Amazon
 
 
 
+  return *this;
+}
+
+ListTagsOfResourceResult::ListTagsOfResourceResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+ListTagsOfResourceResult& ListTagsOfResourceResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Tags"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_tags.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("NextToken"))
+      {
+        m_nextToken = reader.ReadString();
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/LocalSecondaryIndex.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ LocalSecondaryIndex::LocalSecondaryIndex(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+LocalSecondaryIndex::LocalSecondaryIndex(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_keySchemaHasBeenSet(false),
+    m_projectionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 LocalSecondaryIndex& LocalSecondaryIndex::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -62,6 +71,38 @@ LocalSecondaryIndex& LocalSecondaryIndex::operator =(JsonView jsonValue)
   return *this;
 }
 
+LocalSecondaryIndex& LocalSecondaryIndex::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeySchema"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_keySchema.push_back(reader);
+          }
+        }
+        m_keySchemaHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Projection"))
+      {
+        m_projection = reader;
+        m_projectionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue LocalSecondaryIndex::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/LocalSecondaryIndexDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -43,6 +44,19 @@ LocalSecondaryIndexDescription::LocalSecondaryIndexDescription(JsonView jsonValu
   *this = jsonValue;
 }
 
+LocalSecondaryIndexDescription::LocalSecondaryIndexDescription(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_keySchemaHasBeenSet(false),
+    m_projectionHasBeenSet(false),
+    m_indexSizeBytes(0),
+    m_indexSizeBytesHasBeenSet(false),
+    m_itemCount(0),
+    m_itemCountHasBeenSet(false),
+    m_indexArnHasBeenSet(false)
+{
+  *this = reader;
+}
+
 LocalSecondaryIndexDescription& LocalSecondaryIndexDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -93,6 +107,53 @@ LocalSecondaryIndexDescription& LocalSecondaryIndexDescription::operator =(JsonV
   return *this;
 }
 
+LocalSecondaryIndexDescription& LocalSecondaryIndexDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeySchema"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_keySchema.push_back(reader);
+          }
+        }
+        m_keySchemaHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Projection"))
+      {
+        m_projection = reader;
+        m_projectionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexSizeBytes"))
+      {
+        m_indexSizeBytes = reader.ReadInt64();
+        m_indexSizeBytesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ItemCount"))
+      {
+        m_itemCount = reader.ReadInt64();
+        m_itemCountHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexArn"))
+      {
+        m_indexArn = reader.ReadString();
+        m_indexArnHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue LocalSecondaryIndexDescription::Jsonize() const
 {
   JsonValue payload;
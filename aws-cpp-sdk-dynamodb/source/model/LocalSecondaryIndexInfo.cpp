@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/LocalSecondaryIndexInfo.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ LocalSecondaryIndexInfo::LocalSecondaryIndexInfo(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+LocalSecondaryIndexInfo::LocalSecondaryIndexInfo(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_keySchemaHasBeenSet(false),
+    m_projectionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 LocalSecondaryIndexInfo& LocalSecondaryIndexInfo::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -62,6 +71,38 @@ LocalSecondaryIndexInfo& LocalSecondaryIndexInfo::operator =(JsonView jsonValue)
   return *this;
 }
 
+LocalSecondaryIndexInfo& LocalSecondaryIndexInfo::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeySchema"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_keySchema.push_back(reader);
+          }
+        }
+        m_keySchemaHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Projection"))
+      {
+        m_projection = reader;
+        m_projectionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue LocalSecondaryIndexInfo::Jsonize() const
 {
   JsonValue payload;
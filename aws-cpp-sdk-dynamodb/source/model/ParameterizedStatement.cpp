@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ParameterizedStatement.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ ParameterizedStatement::ParameterizedStatement(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ParameterizedStatement::ParameterizedStatement(JsonReader& reader) : 
+    m_statementHasBeenSet(false),
+    m_parametersHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ParameterizedStatement& ParameterizedStatement::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Statement"))
@@ -53,6 +61,33 @@ ParameterizedStatement& ParameterizedStatement::operator =(JsonView jsonValue)
   return *this;
 }
 
+ParameterizedStatement& ParameterizedStatement::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Statement"))
+      {
+        m_statement = reader.ReadString();
+        m_statementHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Parameters"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_parameters.push_back(reader);
+          }
+        }
+        m_parametersHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ParameterizedStatement::Jsonize() const
 {
   JsonValue payload;
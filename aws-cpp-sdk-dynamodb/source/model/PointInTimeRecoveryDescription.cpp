@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/PointInTimeRecoveryDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ PointInTimeRecoveryDescription::PointInTimeRecoveryDescription(JsonView jsonValu
   *this = jsonValue;
 }
 
+PointInTimeRecoveryDescription::PointInTimeRecoveryDescription(JsonReader& reader) : 
+    m_pointInTimeRecoveryStatus(PointInTimeRecoveryStatus::NOT_SET),
+    m_pointInTimeRecoveryStatusHasBeenSet(false),
+    m_earliestRestorableDateTimeHasBeenSet(false),
+    m_latestRestorableDateTimeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 PointInTimeRecoveryDescription& PointInTimeRecoveryDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("PointInTimeRecoveryStatus"))
@@ -61,6 +71,32 @@ PointInTimeRecoveryDescription& PointInTimeRecoveryDescription::operator =(JsonV
   return *this;
 }
 
+PointInTimeRecoveryDescription& PointInTimeRecoveryDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("PointInTimeRecoveryStatus"))
+      {
+        m_pointInTimeRecoveryStatus = PointInTimeRecoveryStatusMapper::GetPointInTimeRecoveryStatusForName(reader.ReadString());
+        m_pointInTimeRecoveryStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("EarliestRestorableDateTime"))
+      {
+        m_earliestRestorableDateTime = reader.ReadDouble();
+        m_earliestRestorableDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LatestRestorableDateTime"))
+      {
+        m_latestRestorableDateTime = reader.ReadDouble();
+        m_latestRestorableDateTimeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue PointInTimeRecoveryDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/PointInTimeRecoverySpecification.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ PointInTimeRecoverySpecification::PointInTimeRecoverySpecification(JsonView json
   *this = jsonValue;
 }
 
+PointInTimeRecoverySpecification::PointInTimeRecoverySpecification(JsonReader& reader) : 
+    m_pointInTimeRecoveryEnabled(false),
+    m_pointInTimeRecoveryEnabledHasBeenSet(false)
+{
+  *this = reader;
+}
+
 PointInTimeRecoverySpecification& PointInTimeRecoverySpecification::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("PointInTimeRecoveryEnabled"))
@@ -43,6 +51,22 @@ PointInTimeRecoverySpecification& PointInTimeRecoverySpecification::operator =(J
   return *this;
 }
 
+PointInTimeRecoverySpecification& PointInTimeRecoverySpecification::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("PointInTimeRecoveryEnabled"))
+      {
+        m_pointInTimeRecoveryEnabled = reader.ReadBool();
+        m_pointInTimeRecoveryEnabledHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue PointInTimeRecoverySpecification::Jsonize() const
 {
   JsonValue payload;
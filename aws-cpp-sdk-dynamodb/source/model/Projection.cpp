@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Projection.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ Projection::Projection(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Projection::Projection(JsonReader& reader) : 
+    m_projectionType(ProjectionType::NOT_SET),
+    m_projectionTypeHasBeenSet(false),
+    m_nonKeyAttributesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Projection& Projection::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ProjectionType"))
@@ -55,6 +64,33 @@ Projection& Projection::operator =(JsonView jsonValue)
   return *this;
 }
 
+Projection& Projection::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ProjectionType"))
+      {
+        m_projectionType = ProjectionTypeMapper::GetProjectionTypeForName(reader.ReadString());
+        m_projectionTypeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("NonKeyAttributes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_nonKeyAttributes.push_back(reader.ReadString());
+          }
+        }
+        m_nonKeyAttributesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Projection::Jsonize() const
 {
   JsonValue payload;
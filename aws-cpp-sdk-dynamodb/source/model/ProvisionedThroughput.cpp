@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ProvisionedThroughput.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ ProvisionedThroughput::ProvisionedThroughput(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ProvisionedThroughput::ProvisionedThroughput(JsonReader& reader) : 
+    m_readCapacityUnits(0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0),
+    m_writeCapacityUnitsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ProvisionedThroughput& ProvisionedThroughput::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ReadCapacityUnits"))
@@ -54,6 +64,27 @@ ProvisionedThroughput& ProvisionedThroughput::operator =(JsonView jsonValue)
   return *this;
 }
 
+ProvisionedThroughput& ProvisionedThroughput::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ReadCapacityUnits"))
+      {
+        m_readCapacityUnits = reader.ReadInt64();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("WriteCapacityUnits"))
+      {
+        m_writeCapacityUnits = reader.ReadInt64();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ProvisionedThroughput::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ProvisionedThroughputDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -43,6 +44,19 @@ ProvisionedThroughputDescription::ProvisionedThroughputDescription(JsonView json
   *this = jsonValue;
 }
 
+ProvisionedThroughputDescription::ProvisionedThroughputDescription(JsonReader& reader) : 
+    m_lastIncreaseDateTimeHasBeenSet(false),
+    m_lastDecreaseDateTimeHasBeenSet(false),
+    m_numberOfDecreasesToday(0),
+    m_numberOfDecreasesTodayHasBeenSet(false),
+    m_readCapacityUnits(0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0),
+    m_writeCapacityUnitsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ProvisionedThroughputDescription& ProvisionedThroughputDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("LastIncreaseDateTime"))
@@ -83,6 +97,42 @@ ProvisionedThroughputDescription& ProvisionedThroughputDescription::operator =(J
   return *this;
 }
 
+ProvisionedThroughputDescription& ProvisionedThroughputDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("LastIncreaseDateTime"))
+      {
+        m_lastIncreaseDateTime = reader.ReadDouble();
+        m_lastIncreaseDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LastDecreaseDateTime"))
+      {
+        m_lastDecreaseDateTime = reader.ReadDouble();
+        m_lastDecreaseDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("NumberOfDecreasesToday"))
+      {
+        m_numberOfDecreasesToday = reader.ReadInt64();
+        m_numberOfDecreasesTodayHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReadCapacityUnits"))
+      {
+        m_readCapacityUnits = reader.ReadInt64();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("WriteCapacityUnits"))
+      {
+        m_writeCapacityUnits = reader.ReadInt64();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ProvisionedThroughputDescription::Jsonize() const
 {
   JsonValue payload;
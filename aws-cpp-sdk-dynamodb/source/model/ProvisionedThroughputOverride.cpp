@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ProvisionedThroughputOverride.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ ProvisionedThroughputOverride::ProvisionedThroughputOverride(JsonView jsonValue)
   *this = jsonValue;
 }
 
+ProvisionedThroughputOverride::ProvisionedThroughputOverride(JsonReader& reader) : 
+    m_readCapacityUnits(0),
+    m_readCapacityUnitsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ProvisionedThroughputOverride& ProvisionedThroughputOverride::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ReadCapacityUnits"))
@@ -43,6 +51,22 @@ ProvisionedThroughputOverride& ProvisionedThroughputOverride::operator =(JsonVie
   return *this;
 }
 
+ProvisionedThroughputOverride& ProvisionedThroughputOverride::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ReadCapacityUnits"))
+      {
+        m_readCapacityUnits = reader.ReadInt64();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ProvisionedThroughputOverride::Jsonize() const
 {
   JsonValue payload;
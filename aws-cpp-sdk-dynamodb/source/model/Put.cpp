@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Put.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -41,6 +42,18 @@ Put::Put(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Put::Put(JsonReader& reader) : 
+    m_itemHasBeenSet(false),
+    m_tableNameHasBeenSet(false),
+    m_conditionExpressionHasBeenSet(false),
+    m_expressionAttributeNamesHasBeenSet(false),
+    m_expressionAttributeValuesHasBeenSet(false),
+    m_returnValuesOnConditionCheckFailure(ReturnValuesOnConditionCheckFailure::NOT_SET),
+    m_returnValuesOnConditionCheckFailureHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Put& Put::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Item"))
@@ -97,6 +110,68 @@ Put& Put::operator =(JsonView jsonValue)
   return *this;
 }
 
+Put& Put::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Item"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemKey = reader.GetKey();
+            m_item[itemKey] = reader;
+          }
+        }
+        m_itemHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ConditionExpression"))
+      {
+        m_conditionExpression = reader.ReadString();
+        m_conditionExpressionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExpressionAttributeNames"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String expressionAttributeNamesKey = reader.GetKey();
+            m_expressionAttributeNames[expressionAttributeNamesKey] = reader.ReadString();
+          }
+        }
+        m_expressionAttributeNamesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExpressionAttributeValues"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String expressionAttributeValuesKey = reader.GetKey();
+            m_expressionAttributeValues[expressionAttributeValuesKey] = reader;
+          }
+        }
+        m_expressionAttributeValuesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReturnValuesOnConditionCheckFailure"))
+      {
+        m_returnValuesOnConditionCheckFailure = ReturnValuesOnConditionCheckFailureMapper::GetReturnValuesOnConditionCheckFailureForName(reader.ReadString());
+        m_returnValuesOnConditionCheckFailureHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Put::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/PutRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ PutRequest::PutRequest(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+PutRequest::PutRequest(JsonReader& reader) : 
+    m_itemHasBeenSet(false)
+{
+  *this = reader;
+}
+
 PutRequest& PutRequest::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Item"))
@@ -44,6 +51,29 @@ PutRequest& PutRequest::operator =(JsonView jsonValue)
   return *this;
 }
 
+PutRequest& PutRequest::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Item"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemKey = reader.GetKey();
+            m_item[itemKey] = reader;
+          }
+        }
+        m_itemHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue PutRequest::Jsonize() const
 {
   JsonValue payload;
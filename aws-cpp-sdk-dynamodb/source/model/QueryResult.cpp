@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/QueryResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -76,5 +77,68 @@ QueryResult& QueryResult::operator =(const Aws::AmazonWebServiceResult<JsonValue
 
 
 
+  return *this;
+}
+
+QueryResult::QueryResult(const Aws::AmazonWebServiceResult<JsonReader>& result) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  *this = result;
+}
+
+QueryResult& QueryResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Items"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+            if(reader.StartObject())
+            {
+              while(reader.NextMember())
+              {
+                Aws::String attributeMapKey = reader.GetKey();
+                attributeMapMap[attributeMapKey] = reader;
+              }
+            }
+            m_items.push_back(std::move(attributeMapMap));
+          }
+        }
+      }
+      else if(reader.KeyEquals("Count"))
+      {
+        m_count = reader.ReadInteger();
+      }
+      else if(reader.KeyEquals("ScannedCount"))
+      {
+        m_scannedCount = reader.ReadInteger();
+      }
+      else if(reader.KeyEquals("LastEvaluatedKey"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String lastEvaluatedKeyKey = reader.GetKey();
+            m_lastEvaluatedKey[lastEvaluatedKeyKey] = reader;
+          }
+        }
+      }
+      else if(reader.KeyEquals("ConsumedCapacity"))
+      {
+        m_consumedCapacity = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
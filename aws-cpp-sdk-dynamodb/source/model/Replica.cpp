@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Replica.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ Replica::Replica(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Replica::Replica(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Replica& Replica::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -41,6 +48,22 @@ Replica& Replica::operator =(JsonView jsonValue)
   return *this;
 }
 
+Replica& Replica::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Replica::Jsonize() const
 {
   JsonValue payload;
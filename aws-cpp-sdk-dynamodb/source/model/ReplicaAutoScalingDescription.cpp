@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaAutoScalingDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -39,6 +40,17 @@ ReplicaAutoScalingDescription::ReplicaAutoScalingDescription(JsonView jsonValue)
   *this = jsonValue;
 }
 
+ReplicaAutoScalingDescription::ReplicaAutoScalingDescription(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false),
+    m_replicaProvisionedReadCapacityAutoScalingSettingsHasBeenSet(false),
+    m_replicaProvisionedWriteCapacityAutoScalingSettingsHasBeenSet(false),
+    m_replicaStatus(ReplicaStatus::NOT_SET),
+    m_replicaStatusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaAutoScalingDescription& ReplicaAutoScalingDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -82,6 +94,48 @@ ReplicaAutoScalingDescription& ReplicaAutoScalingDescription::operator =(JsonVie
   return *this;
 }
 
+ReplicaAutoScalingDescription& ReplicaAutoScalingDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalSecondaryIndexes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_globalSecondaryIndexes.push_back(reader);
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedReadCapacityAutoScalingSettings"))
+      {
+        m_replicaProvisionedReadCapacityAutoScalingSettings = reader;
+        m_replicaProvisionedReadCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedWriteCapacityAutoScalingSettings"))
+      {
+        m_replicaProvisionedWriteCapacityAutoScalingSettings = reader;
+        m_replicaProvisionedWriteCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaStatus"))
+      {
+        m_replicaStatus = ReplicaStatusMapper::GetReplicaStatusForName(reader.ReadString());
+        m_replicaStatusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaAutoScalingDescription::Jsonize() const
 {
   JsonValue payload;
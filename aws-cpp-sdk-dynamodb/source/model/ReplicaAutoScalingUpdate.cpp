@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaAutoScalingUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ ReplicaAutoScalingUpdate::ReplicaAutoScalingUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ReplicaAutoScalingUpdate::ReplicaAutoScalingUpdate(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false),
+    m_replicaGlobalSecondaryIndexUpdatesHasBeenSet(false),
+    m_replicaProvisionedReadCapacityAutoScalingUpdateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaAutoScalingUpdate& ReplicaAutoScalingUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -62,6 +71,38 @@ ReplicaAutoScalingUpdate& ReplicaAutoScalingUpdate::operator =(JsonView jsonValu
   return *this;
 }
 
+ReplicaAutoScalingUpdate& ReplicaAutoScalingUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaGlobalSecondaryIndexUpdates"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicaGlobalSecondaryIndexUpdates.push_back(reader);
+          }
+        }
+        m_replicaGlobalSecondaryIndexUpdatesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedReadCapacityAutoScalingUpdate"))
+      {
+        m_replicaProvisionedReadCapacityAutoScalingUpdate = reader;
+        m_replicaProvisionedReadCapacityAutoScalingUpdateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaAutoScalingUpdate::Jsonize() const
 {
   JsonValue payload;
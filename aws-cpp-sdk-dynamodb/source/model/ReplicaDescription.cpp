@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -45,6 +46,20 @@ ReplicaDescription::ReplicaDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ReplicaDescription::ReplicaDescription(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false),
+    m_replicaStatus(ReplicaStatus::NOT_SET),
+    m_replicaStatusHasBeenSet(false),
+    m_replicaStatusDescriptionHasBeenSet(false),
+    m_replicaStatusPercentProgressHasBeenSet(false),
+    m_kMSMasterKeyIdHasBeenSet(false),
+    m_provisionedThroughputOverrideHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false),
+    m_replicaInaccessibleDateTimeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaDescription& ReplicaDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -109,6 +124,63 @@ ReplicaDescription& ReplicaDescription::operator =(JsonView jsonValue)
   return *this;
 }
 
+ReplicaDescription& ReplicaDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaStatus"))
+      {
+        m_replicaStatus = ReplicaStatusMapper::GetReplicaStatusForName(reader.ReadString());
+        m_replicaStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaStatusDescription"))
+      {
+        m_replicaStatusDescription = reader.ReadString();
+        m_replicaStatusDescriptionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaStatusPercentProgress"))
+      {
+        m_replicaStatusPercentProgress = reader.ReadString();
+        m_replicaStatusPercentProgressHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KMSMasterKeyId"))
+      {
+        m_kMSMasterKeyId = reader.ReadString();
+        m_kMSMasterKeyIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughputOverride"))
+      {
+        m_provisionedThroughputOverride = reader;
+        m_provisionedThroughputOverrideHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalSecondaryIndexes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_globalSecondaryIndexes.push_back(reader);
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaInaccessibleDateTime"))
+      {
+        m_replicaInaccessibleDateTime = reader.ReadDouble();
+        m_replicaInaccessibleDateTimeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaGlobalSecondaryIndex.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ ReplicaGlobalSecondaryIndex::ReplicaGlobalSecondaryIndex(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ReplicaGlobalSecondaryIndex::ReplicaGlobalSecondaryIndex(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_provisionedThroughputOverrideHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaGlobalSecondaryIndex& ReplicaGlobalSecondaryIndex::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -50,6 +58,27 @@ ReplicaGlobalSecondaryIndex& ReplicaGlobalSecondaryIndex::operator =(JsonView js
   return *this;
 }
 
+ReplicaGlobalSecondaryIndex& ReplicaGlobalSecondaryIndex::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughputOverride"))
+      {
+        m_provisionedThroughputOverride = reader;
+        m_provisionedThroughputOverrideHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaGlobalSecondaryIndex::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaGlobalSecondaryIndexAutoScalingDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -37,6 +38,16 @@ ReplicaGlobalSecondaryIndexAutoScalingDescription::ReplicaGlobalSecondaryIndexAu
   *this = jsonValue;
 }
 
+ReplicaGlobalSecondaryIndexAutoScalingDescription::ReplicaGlobalSecondaryIndexAutoScalingDescription(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_indexStatus(IndexStatus::NOT_SET),
+    m_indexStatusHasBeenSet(false),
+    m_provisionedReadCapacityAutoScalingSettingsHasBeenSet(false),
+    m_provisionedWriteCapacityAutoScalingSettingsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaGlobalSecondaryIndexAutoScalingDescription& ReplicaGlobalSecondaryIndexAutoScalingDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -70,6 +81,37 @@ ReplicaGlobalSecondaryIndexAutoScalingDescription& ReplicaGlobalSecondaryIndexAu
   return *this;
 }
 
+ReplicaGlobalSecondaryIndexAutoScalingDescription& ReplicaGlobalSecondaryIndexAutoScalingDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexStatus"))
+      {
+        m_indexStatus = IndexStatusMapper::GetIndexStatusForName(reader.ReadString());
+        m_indexStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedReadCapacityAutoScalingSettings"))
+      {
+        m_provisionedReadCapacityAutoScalingSettings = reader;
+        m_provisionedReadCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedWriteCapacityAutoScalingSettings"))
+      {
+        m_provisionedWriteCapacityAutoScalingSettings = reader;
+        m_provisionedWriteCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaGlobalSecondaryIndexAutoScalingDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaGlobalSecondaryIndexAutoScalingUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ ReplicaGlobalSecondaryIndexAutoScalingUpdate::ReplicaGlobalSecondaryIndexAutoSca
   *this = jsonValue;
 }
 
+ReplicaGlobalSecondaryIndexAutoScalingUpdate::ReplicaGlobalSecondaryIndexAutoScalingUpdate(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_provisionedReadCapacityAutoScalingUpdateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaGlobalSecondaryIndexAutoScalingUpdate& ReplicaGlobalSecondaryIndexAutoScalingUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -50,6 +58,27 @@ ReplicaGlobalSecondaryIndexAutoScalingUpdate& ReplicaGlobalSecondaryIndexAutoSca
   return *this;
 }
 
+ReplicaGlobalSecondaryIndexAutoScalingUpdate& ReplicaGlobalSecondaryIndexAutoScalingUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedReadCapacityAutoScalingUpdate"))
+      {
+        m_provisionedReadCapacityAutoScalingUpdate = reader;
+        m_provisionedReadCapacityAutoScalingUpdateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaGlobalSecondaryIndexAutoScalingUpdate::Jsonize() const
 {
   JsonValue payload;
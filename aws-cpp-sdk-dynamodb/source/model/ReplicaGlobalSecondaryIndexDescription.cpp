@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaGlobalSecondaryIndexDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ ReplicaGlobalSecondaryIndexDescription::ReplicaGlobalSecondaryIndexDescription(J
   *this = jsonValue;
 }
 
+ReplicaGlobalSecondaryIndexDescription::ReplicaGlobalSecondaryIndexDescription(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_provisionedThroughputOverrideHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaGlobalSecondaryIndexDescription& ReplicaGlobalSecondaryIndexDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -50,6 +58,27 @@ ReplicaGlobalSecondaryIndexDescription& ReplicaGlobalSecondaryIndexDescription::
   return *this;
 }
 
+ReplicaGlobalSecondaryIndexDescription& ReplicaGlobalSecondaryIndexDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughputOverride"))
+      {
+        m_provisionedThroughputOverride = reader;
+        m_provisionedThroughputOverrideHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaGlobalSecondaryIndexDescription::Jsonize() const
 {
   JsonValue payload;
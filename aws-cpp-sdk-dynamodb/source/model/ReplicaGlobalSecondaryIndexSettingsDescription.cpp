@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaGlobalSecondaryIndexSettingsDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -45,6 +46,20 @@ ReplicaGlobalSecondaryIndexSettingsDescription::ReplicaGlobalSecondaryIndexSetti
   *this = jsonValue;
 }
 
+ReplicaGlobalSecondaryIndexSettingsDescription::ReplicaGlobalSecondaryIndexSettingsDescription(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_indexStatus(IndexStatus::NOT_SET),
+    m_indexStatusHasBeenSet(false),
+    m_provisionedReadCapacityUnits(0),
+    m_provisionedReadCapacityUnitsHasBeenSet(false),
+    m_provisionedReadCapacityAutoScalingSettingsHasBeenSet(false),
+    m_provisionedWriteCapacityUnits(0),
+    m_provisionedWriteCapacityUnitsHasBeenSet(false),
+    m_provisionedWriteCapacityAutoScalingSettingsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaGlobalSecondaryIndexSettingsDescription& ReplicaGlobalSecondaryIndexSettingsDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -92,6 +107,47 @@ ReplicaGlobalSecondaryIndexSettingsDescription& ReplicaGlobalSecondaryIndexSetti
   return *this;
 }
 
+ReplicaGlobalSecondaryIndexSettingsDescription& ReplicaGlobalSecondaryIndexSettingsDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("IndexStatus"))
+      {
+        m_indexStatus = IndexStatusMapper::GetIndexStatusForName(reader.ReadString());
+        m_indexStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedReadCapacityUnits"))
+      {
+        m_provisionedReadCapacityUnits = reader.ReadInt64();
+        m_provisionedReadCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedReadCapacityAutoScalingSettings"))
+      {
+        m_provisionedReadCapacityAutoScalingSettings = reader;
+        m_provisionedReadCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedWriteCapacityUnits"))
+      {
+        m_provisionedWriteCapacityUnits = reader.ReadInt64();
+        m_provisionedWriteCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedWriteCapacityAutoScalingSettings"))
+      {
+        m_provisionedWriteCapacityAutoScalingSettings = reader;
+        m_provisionedWriteCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaGlobalSecondaryIndexSettingsDescription::Jsonize() const
 {
   JsonValue payload;
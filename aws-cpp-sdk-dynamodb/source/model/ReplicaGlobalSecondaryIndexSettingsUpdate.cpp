@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaGlobalSecondaryIndexSettingsUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ ReplicaGlobalSecondaryIndexSettingsUpdate::ReplicaGlobalSecondaryIndexSettingsUp
   *this = jsonValue;
 }
 
+ReplicaGlobalSecondaryIndexSettingsUpdate::ReplicaGlobalSecondaryIndexSettingsUpdate(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_provisionedReadCapacityUnits(0),
+    m_provisionedReadCapacityUnitsHasBeenSet(false),
+    m_provisionedReadCapacityAutoScalingSettingsUpdateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaGlobalSecondaryIndexSettingsUpdate& ReplicaGlobalSecondaryIndexSettingsUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -61,6 +71,32 @@ ReplicaGlobalSecondaryIndexSettingsUpdate& ReplicaGlobalSecondaryIndexSettingsUp
   return *this;
 }
 
+ReplicaGlobalSecondaryIndexSettingsUpdate& ReplicaGlobalSecondaryIndexSettingsUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedReadCapacityUnits"))
+      {
+        m_provisionedReadCapacityUnits = reader.ReadInt64();
+        m_provisionedReadCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedReadCapacityAutoScalingSettingsUpdate"))
+      {
+        m_provisionedReadCapacityAutoScalingSettingsUpdate = reader;
+        m_provisionedReadCapacityAutoScalingSettingsUpdateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaGlobalSecondaryIndexSettingsUpdate::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaSettingsDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -49,6 +50,22 @@ ReplicaSettingsDescription::ReplicaSettingsDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ReplicaSettingsDescription::ReplicaSettingsDescription(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false),
+    m_replicaStatus(ReplicaStatus::NOT_SET),
+    m_replicaStatusHasBeenSet(false),
+    m_replicaBillingModeSummaryHasBeenSet(false),
+    m_replicaProvisionedReadCapacityUnits(0),
+    m_replicaProvisionedReadCapacityUnitsHasBeenSet(false),
+    m_replicaProvisionedReadCapacityAutoScalingSettingsHasBeenSet(false),
+    m_replicaProvisionedWriteCapacityUnits(0),
+    m_replicaProvisionedWriteCapacityUnitsHasBeenSet(false),
+    m_replicaProvisionedWriteCapacityAutoScalingSettingsHasBeenSet(false),
+    m_replicaGlobalSecondaryIndexSettingsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaSettingsDescription& ReplicaSettingsDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -113,6 +130,63 @@ ReplicaSettingsDescription& ReplicaSettingsDescription::operator =(JsonView json
   return *this;
 }
 
+ReplicaSettingsDescription& ReplicaSettingsDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaStatus"))
+      {
+        m_replicaStatus = ReplicaStatusMapper::GetReplicaStatusForName(reader.ReadString());
+        m_replicaStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaBillingModeSummary"))
+      {
+        m_replicaBillingModeSummary = reader;
+        m_replicaBillingModeSummaryHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedReadCapacityUnits"))
+      {
+        m_replicaProvisionedReadCapacityUnits = reader.ReadInt64();
+        m_replicaProvisionedReadCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedReadCapacityAutoScalingSettings"))
+      {
+        m_replicaProvisionedReadCapacityAutoScalingSettings = reader;
+        m_replicaProvisionedReadCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedWriteCapacityUnits"))
+      {
+        m_replicaProvisionedWriteCapacityUnits = reader.ReadInt64();
+        m_replicaProvisionedWriteCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedWriteCapacityAutoScalingSettings"))
+      {
+        m_replicaProvisionedWriteCapacityAutoScalingSettings = reader;
+        m_replicaProvisionedWriteCapacityAutoScalingSettingsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaGlobalSecondaryIndexSettings"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicaGlobalSecondaryIndexSettings.push_back(reader);
+          }
+        }
+        m_replicaGlobalSecondaryIndexSettingsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaSettingsDescription::Jsonize() const
 {
   JsonValue payload;
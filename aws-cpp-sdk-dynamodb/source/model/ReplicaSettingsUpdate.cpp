@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaSettingsUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -37,6 +38,16 @@ ReplicaSettingsUpdate::ReplicaSettingsUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ReplicaSettingsUpdate::ReplicaSettingsUpdate(JsonReader& reader) : 
+    m_regionNameHasBeenSet(false),
+    m_replicaProvisionedReadCapacityUnits(0),
+    m_replicaProvisionedReadCapacityUnitsHasBeenSet(false),
+    m_replicaProvisionedReadCapacityAutoScalingSettingsUpdateHasBeenSet(false),
+    m_replicaGlobalSecondaryIndexSettingsUpdateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaSettingsUpdate& ReplicaSettingsUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RegionName"))
@@ -73,6 +84,43 @@ ReplicaSettingsUpdate& ReplicaSettingsUpdate::operator =(JsonView jsonValue)
   return *this;
 }
 
+ReplicaSettingsUpdate& ReplicaSettingsUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RegionName"))
+      {
+        m_regionName = reader.ReadString();
+        m_regionNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedReadCapacityUnits"))
+      {
+        m_replicaProvisionedReadCapacityUnits = reader.ReadInt64();
+        m_replicaProvisionedReadCapacityUnitsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaProvisionedReadCapacityAutoScalingSettingsUpdate"))
+      {
+        m_replicaProvisionedReadCapacityAutoScalingSettingsUpdate = reader;
+        m_replicaProvisionedReadCapacityAutoScalingSettingsUpdateHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ReplicaGlobalSecondaryIndexSettingsUpdate"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicaGlobalSecondaryIndexSettingsUpdate.push_back(reader);
+          }
+        }
+        m_replicaGlobalSecondaryIndexSettingsUpdateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaSettingsUpdate::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicaUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ ReplicaUpdate::ReplicaUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ReplicaUpdate::ReplicaUpdate(JsonReader& reader) : 
+    m_createHasBeenSet(false),
+    m_deleteHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaUpdate& ReplicaUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Create"))
@@ -50,6 +58,27 @@ ReplicaUpdate& ReplicaUpdate::operator =(JsonView jsonValue)
   return *this;
 }
 
+ReplicaUpdate& ReplicaUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Create"))
+      {
+        m_create = reader;
+        m_createHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Delete"))
+      {
+        m_delete = reader;
+        m_deleteHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicaUpdate::Jsonize() const
 {
   JsonValue payload;
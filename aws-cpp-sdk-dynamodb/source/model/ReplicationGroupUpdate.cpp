@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ReplicationGroupUpdate.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ ReplicationGroupUpdate::ReplicationGroupUpdate(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ReplicationGroupUpdate::ReplicationGroupUpdate(JsonReader& reader) : 
+    m_createHasBeenSet(false),
+    m_updateHasBeenSet(false),
+    m_deleteHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicationGroupUpdate& ReplicationGroupUpdate::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Create"))
@@ -59,6 +68,32 @@ ReplicationGroupUpdate& ReplicationGroupUpdate::operator =(JsonView jsonValue)
   return *this;
 }
 
+ReplicationGroupUpdate& ReplicationGroupUpdate::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Create"))
+      {
+        m_create = reader;
+        m_createHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Update"))
+      {
+        m_update = reader;
+        m_updateHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Delete"))
+      {
+        m_delete = reader;
+        m_deleteHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ReplicationGroupUpdate::Jsonize() const
 {
   JsonValue payload;
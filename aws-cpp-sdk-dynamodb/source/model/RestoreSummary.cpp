@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/RestoreSummary.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -37,6 +38,16 @@ RestoreSummary::RestoreSummary(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+RestoreSummary::RestoreSummary(JsonReader& reader) : 
+    m_sourceBackupArnHasBeenSet(false),
+    m_sourceTableArnHasBeenSet(false),
+    m_restoreDateTimeHasBeenSet(false),
+    m_restoreInProgress(false),
+    m_restoreInProgressHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RestoreSummary& RestoreSummary::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("SourceBackupArn"))
@@ -70,6 +81,37 @@ RestoreSummary& RestoreSummary::operator =(JsonView jsonValue)
   return *this;
 }
 
+RestoreSummary& RestoreSummary::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("SourceBackupArn"))
+      {
+        m_sourceBackupArn = reader.ReadString();
+        m_sourceBackupArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SourceTableArn"))
+      {
+        m_sourceTableArn = reader.ReadString();
+        m_sourceTableArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("RestoreDateTime"))
+      {
+        m_restoreDateTime = reader.ReadDouble();
+        m_restoreDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("RestoreInProgress"))
+      {
+        m_restoreInProgress = reader.ReadBool();
+        m_restoreInProgressHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue RestoreSummary::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/RestoreTableFromBackupResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ RestoreTableFromBackupResult& RestoreTableFromBackupResult::operator =(const Aws
 
 
 
+  return *this;
+}
+
+RestoreTableFromBackupResult::RestoreTableFromBackupResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+RestoreTableFromBackupResult& RestoreTableFromBackupResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableDescription"))
+      {
+        m_tableDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/SSEDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -39,6 +40,17 @@ SSEDescription::SSEDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+SSEDescription::SSEDescription(JsonReader& reader) : 
+    m_status(SSEStatus::NOT_SET),
+    m_statusHasBeenSet(false),
+    m_sSEType(SSEType::NOT_SET),
+    m_sSETypeHasBeenSet(false),
+    m_kMSMasterKeyArnHasBeenSet(false),
+    m_inaccessibleEncryptionDateTimeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SSEDescription& SSEDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Status"))
@@ -72,6 +84,37 @@ SSEDescription& SSEDescription::operator =(JsonView jsonValue)
   return *this;
 }
 
+SSEDescription& SSEDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Status"))
+      {
+        m_status = SSEStatusMapper::GetSSEStatusForName(reader.ReadString());
+        m_statusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SSEType"))
+      {
+        m_sSEType = SSETypeMapper::GetSSETypeForName(reader.ReadString());
+        m_sSETypeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KMSMasterKeyArn"))
+      {
+        m_kMSMasterKeyArn = reader.ReadString();
+        m_kMSMasterKeyArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("InaccessibleEncryptionDateTime"))
+      {
+        m_inaccessibleEncryptionDateTime = reader.ReadDouble();
+        m_inaccessibleEncryptionDateTimeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue SSEDescription::Jsonize() const
 {
   JsonValue payload;
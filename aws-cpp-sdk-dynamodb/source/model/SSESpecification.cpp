@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/SSESpecification.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -37,6 +38,16 @@ SSESpecification::SSESpecification(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+SSESpecification::SSESpecification(JsonReader& reader) : 
+    m_enabled(false),
+    m_enabledHasBeenSet(false),
+    m_sSEType(SSEType::NOT_SET),
+    m_sSETypeHasBeenSet(false),
+    m_kMSMasterKeyIdHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SSESpecification& SSESpecification::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Enabled"))
@@ -63,6 +74,32 @@ SSESpecification& SSESpecification::operator =(JsonView jsonValue)
   return *this;
 }
 
+SSESpecification& SSESpecification::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Enabled"))
+      {
+        m_enabled = reader.ReadBool();
+        m_enabledHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SSEType"))
+      {
+        m_sSEType = SSETypeMapper::GetSSETypeForName(reader.ReadString());
+        m_sSETypeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KMSMasterKeyId"))
+      {
+        m_kMSMasterKeyId = reader.ReadString();
+        m_kMSMasterKeyIdHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue SSESpecification::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/SourceTableDetails.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -51,6 +52,23 @@ SourceTableDetails::SourceTableDetails(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+SourceTableDetails::SourceTableDetails(JsonReader& reader) : 
+    m_tableNameHasBeenSet(false),
+    m_tableIdHasBeenSet(false),
+    m_tableArnHasBeenSet(false),
+    m_tableSizeBytes(0),
+    m_tableSizeBytesHasBeenSet(false),
+    m_keySchemaHasBeenSet(false),
+    m_tableCreationDateTimeHasBeenSet(false),
+    m_provisionedThroughputHasBeenSet(false),
+    m_itemCount(0),
+    m_itemCountHasBeenSet(false),
+    m_billingMode(BillingMode::NOT_SET),
+    m_billingModeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SourceTableDetails& SourceTableDetails::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("TableName"))
@@ -122,6 +140,68 @@ SourceTableDetails& SourceTableDetails::operator =(JsonView jsonValue)
   return *this;
 }
 
+SourceTableDetails& SourceTableDetails::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableId"))
+      {
+        m_tableId = reader.ReadString();
+        m_tableIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableArn"))
+      {
+        m_tableArn = reader.ReadString();
+        m_tableArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableSizeBytes"))
+      {
+        m_tableSizeBytes = reader.ReadInt64();
+        m_tableSizeBytesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeySchema"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_keySchema.push_back(reader);
+          }
+        }
+        m_keySchemaHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableCreationDateTime"))
+      {
+        m_tableCreationDateTime = reader.ReadDouble();
+        m_tableCreationDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughput"))
+      {
+        m_provisionedThroughput = reader;
+        m_provisionedThroughputHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ItemCount"))
+      {
+        m_itemCount = reader.ReadInt64();
+        m_itemCountHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BillingMode"))
+      {
+        m_billingMode = BillingModeMapper::GetBillingModeForName(reader.ReadString());
+        m_billingModeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue SourceTableDetails::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/SourceTableFeatureDetails.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -37,6 +38,16 @@ SourceTableFeatureDetails::SourceTableFeatureDetails(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+SourceTableFeatureDetails::SourceTableFeatureDetails(JsonReader& reader) : 
+    m_localSecondaryIndexesHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false),
+    m_streamDescriptionHasBeenSet(false),
+    m_timeToLiveDescriptionHasBeenSet(false),
+    m_sSEDescriptionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SourceTableFeatureDetails& SourceTableFeatureDetails::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("LocalSecondaryIndexes"))
@@ -83,6 +94,54 @@ SourceTableFeatureDetails& SourceTableFeatureDetails::operator =(JsonView jsonVa
   return *this;
 }
 
+SourceTableFeatureDetails& SourceTableFeatureDetails::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("LocalSecondaryIndexes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_localSecondaryIndexes.push_back(reader);
+          }
+        }
+        m_localSecondaryIndexesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalSecondaryIndexes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_globalSecondaryIndexes.push_back(reader);
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("StreamDescription"))
+      {
+        m_streamDescription = reader;
+        m_streamDescriptionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TimeToLiveDescription"))
+      {
+        m_timeToLiveDescription = reader;
+        m_timeToLiveDescriptionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SSEDescription"))
+      {
+        m_sSEDescription = reader;
+        m_sSEDescriptionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue SourceTableFeatureDetails::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/StreamSpecification.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ StreamSpecification::StreamSpecification(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+StreamSpecification::StreamSpecification(JsonReader& reader) : 
+    m_streamEnabled(false),
+    m_streamEnabledHasBeenSet(false),
+    m_streamViewType(StreamViewType::NOT_SET),
+    m_streamViewTypeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 StreamSpecification& StreamSpecification::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("StreamEnabled"))
@@ -54,6 +64,27 @@ StreamSpecification& StreamSpecification::operator =(JsonView jsonValue)
   return *this;
 }
 
+StreamSpecification& StreamSpecification::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("StreamEnabled"))
+      {
+        m_streamEnabled = reader.ReadBool();
+        m_streamEnabledHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("StreamViewType"))
+      {
+        m_streamViewType = StreamViewTypeMapper::GetStreamViewTypeForName(reader.ReadString());
+        m_streamViewTypeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue StreamSpecification::Jsonize() const
 {
   JsonValue payload;
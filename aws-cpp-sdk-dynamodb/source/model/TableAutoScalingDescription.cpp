@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TableAutoScalingDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ TableAutoScalingDescription::TableAutoScalingDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TableAutoScalingDescription::TableAutoScalingDescription(JsonReader& reader) : 
+    m_tableNameHasBeenSet(false),
+    m_tableStatus(TableStatus::NOT_SET),
+    m_tableStatusHasBeenSet(false),
+    m_replicasHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TableAutoScalingDescription& TableAutoScalingDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("TableName"))
@@ -64,6 +74,38 @@ TableAutoScalingDescription& TableAutoScalingDescription::operator =(JsonView js
   return *this;
 }
 
+TableAutoScalingDescription& TableAutoScalingDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableStatus"))
+      {
+        m_tableStatus = TableStatusMapper::GetTableStatusForName(reader.ReadString());
+        m_tableStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Replicas"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicas.push_back(reader);
+          }
+        }
+        m_replicasHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TableAutoScalingDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TableDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -75,6 +76,35 @@ TableDescription::TableDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TableDescription::TableDescription(JsonReader& reader) : 
+    m_attributeDefinitionsHasBeenSet(false),
+    m_tableNameHasBeenSet(false),
+    m_keySchemaHasBeenSet(false),
+    m_tableStatus(TableStatus::NOT_SET),
+    m_tableStatusHasBeenSet(false),
+    m_creationDateTimeHasBeenSet(false),
+    m_provisionedThroughputHasBeenSet(false),
+    m_tableSizeBytes(0),
+    m_tableSizeBytesHasBeenSet(false),
+    m_itemCount(0),
+    m_itemCountHasBeenSet(false),
+    m_tableArnHasBeenSet(false),
+    m_tableIdHasBeenSet(false),
+    m_billingModeSummaryHasBeenSet(false),
+    m_localSecondaryIndexesHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false),
+    m_streamSpecificationHasBeenSet(false),
+    m_latestStreamLabelHasBeenSet(false),
+    m_latestStreamArnHasBeenSet(false),
+    m_globalTableVersionHasBeenSet(false),
+    m_replicasHasBeenSet(false),
+    m_restoreSummaryHasBeenSet(false),
+    m_sSEDescriptionHasBeenSet(false),
+    m_archivalSummaryHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TableDescription& TableDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("AttributeDefinitions"))
@@ -242,6 +272,152 @@ TableDescription& TableDescription::operator =(JsonView jsonValue)
   return *this;
 }
 
+TableDescription& TableDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("AttributeDefinitions"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_attributeDefinitions.push_back(reader);
+          }
+        }
+        m_attributeDefinitionsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KeySchema"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_keySchema.push_back(reader);
+          }
+        }
+        m_keySchemaHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableStatus"))
+      {
+        m_tableStatus = TableStatusMapper::GetTableStatusForName(reader.ReadString());
+        m_tableStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CreationDateTime"))
+      {
+        m_creationDateTime = reader.ReadDouble();
+        m_creationDateTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughput"))
+      {
+        m_provisionedThroughput = reader;
+        m_provisionedThroughputHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableSizeBytes"))
+      {
+        m_tableSizeBytes = reader.ReadInt64();
+        m_tableSizeBytesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ItemCount"))
+      {
+        m_itemCount = reader.ReadInt64();
+        m_itemCountHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableArn"))
+      {
+        m_tableArn = reader.ReadString();
+        m_tableArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableId"))
+      {
+        m_tableId = reader.ReadString();
+        m_tableIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("BillingModeSummary"))
+      {
+        m_billingModeSummary = reader;
+        m_billingModeSummaryHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LocalSecondaryIndexes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_localSecondaryIndexes.push_back(reader);
+          }
+        }
+        m_localSecondaryIndexesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalSecondaryIndexes"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_globalSecondaryIndexes.push_back(reader);
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("StreamSpecification"))
+      {
+        m_streamSpecification = reader;
+        m_streamSpecificationHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LatestStreamLabel"))
+      {
+        m_latestStreamLabel = reader.ReadString();
+        m_latestStreamLabelHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LatestStreamArn"))
+      {
+        m_latestStreamArn = reader.ReadString();
+        m_latestStreamArnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("GlobalTableVersion"))
+      {
+        m_globalTableVersion = reader.ReadString();
+        m_globalTableVersionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Replicas"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicas.push_back(reader);
+          }
+        }
+        m_replicasHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("RestoreSummary"))
+      {
+        m_restoreSummary = reader;
+        m_restoreSummaryHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("SSEDescription"))
+      {
+        m_sSEDescription = reader;
+        m_sSEDescriptionHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ArchivalSummary"))
+      {
+        m_archivalSummary = reader;
+        m_archivalSummaryHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TableDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TimeToLiveDescription.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ TimeToLiveDescription::TimeToLiveDescription(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TimeToLiveDescription::TimeToLiveDescription(JsonReader& reader) : 
+    m_timeToLiveStatus(TimeToLiveStatus::NOT_SET),
+    m_timeToLiveStatusHasBeenSet(false),
+    m_attributeNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TimeToLiveDescription& TimeToLiveDescription::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("TimeToLiveStatus"))
@@ -52,6 +61,27 @@ TimeToLiveDescription& TimeToLiveDescription::operator =(JsonView jsonValue)
   return *this;
 }
 
+TimeToLiveDescription& TimeToLiveDescription::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TimeToLiveStatus"))
+      {
+        m_timeToLiveStatus = TimeToLiveStatusMapper::GetTimeToLiveStatusForName(reader.ReadString());
+        m_timeToLiveStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AttributeName"))
+      {
+        m_attributeName = reader.ReadString();
+        m_attributeNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TimeToLiveDescription::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TimeToLiveSpecification.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ TimeToLiveSpecification::TimeToLiveSpecification(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TimeToLiveSpecification::TimeToLiveSpecification(JsonReader& reader) : 
+    m_enabled(false),
+    m_enabledHasBeenSet(false),
+    m_attributeNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TimeToLiveSpecification& TimeToLiveSpecification::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Enabled"))
@@ -52,6 +61,27 @@ TimeToLiveSpecification& TimeToLiveSpecification::operator =(JsonView jsonValue)
   return *this;
 }
 
+TimeToLiveSpecification& TimeToLiveSpecification::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Enabled"))
+      {
+        m_enabled = reader.ReadBool();
+        m_enabledHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("AttributeName"))
+      {
+        m_attributeName = reader.ReadString();
+        m_attributeNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TimeToLiveSpecification::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TransactGetItem.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ TransactGetItem::TransactGetItem(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TransactGetItem::TransactGetItem(JsonReader& reader) : 
+    m_getHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TransactGetItem& TransactGetItem::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Get"))
@@ -41,6 +48,22 @@ TransactGetItem& TransactGetItem::operator =(JsonView jsonValue)
   return *this;
 }
 
+TransactGetItem& TransactGetItem::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Get"))
+      {
+        m_get = reader;
+        m_getHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TransactGetItem::Jsonize() const
 {
   JsonValue payload;
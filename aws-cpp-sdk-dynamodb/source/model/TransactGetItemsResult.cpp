@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TransactGetItemsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -48,5 +49,44 @@ TransactGetItemsResult& TransactGetItemsResult::operator =(const Aws::AmazonWebS
 
 
 
+  return *this;
+}
+
+TransactGetItemsResult::TransactGetItemsResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+TransactGetItemsResult& TransactGetItemsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ConsumedCapacity"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_consumedCapacity.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("Responses"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_responses.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
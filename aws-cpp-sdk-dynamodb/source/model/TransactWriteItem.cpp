@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TransactWriteItem.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ TransactWriteItem::TransactWriteItem(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TransactWriteItem::TransactWriteItem(JsonReader& reader) : 
+    m_conditionCheckHasBeenSet(false),
+    m_putHasBeenSet(false),
+    m_deleteHasBeenSet(false),
+    m_updateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TransactWriteItem& TransactWriteItem::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ConditionCheck"))
@@ -68,6 +78,37 @@ TransactWriteItem& TransactWriteItem::operator =(JsonView jsonValue)
   return *this;
 }
 
+TransactWriteItem& TransactWriteItem::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ConditionCheck"))
+      {
+        m_conditionCheck = reader;
+        m_conditionCheckHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Put"))
+      {
+        m_put = reader;
+        m_putHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Delete"))
+      {
+        m_delete = reader;
+        m_deleteHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Update"))
+      {
+        m_update = reader;
+        m_updateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TransactWriteItem::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TransactWriteItemsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -55,5 +56,53 @@ TransactWriteItemsResult& TransactWriteItemsResult::operator =(const Aws::Amazon
 
 
 
+  return *this;
+}
+
+TransactWriteItemsResult::TransactWriteItemsResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+TransactWriteItemsResult& TransactWriteItemsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ConsumedCapacity"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_consumedCapacity.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("ItemCollectionMetrics"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String itemCollectionMetricsKey = reader.GetKey();
+            Aws::Vector<ItemCollectionMetrics> itemCollectionMetricsMultipleList;
+            if(reader.StartArray())
+            {
+              while(reader.NextElement())
+              {
+                itemCollectionMetricsMultipleList.push_back(reader);
+              }
+            }
+            m_itemCollectionMetrics[itemCollectionMetricsKey] = std::move(itemCollectionMetricsMultipleList);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/TransactionCanceledException.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ TransactionCanceledException::TransactionCanceledException(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TransactionCanceledException::TransactionCanceledException(JsonReader& reader) : 
+    m_messageHasBeenSet(false),
+    m_cancellationReasonsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TransactionCanceledException& TransactionCanceledException::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Message"))
@@ -53,6 +61,33 @@ TransactionCanceledException& TransactionCanceledException::operator =(JsonView
   return *this;
 }
 
+TransactionCanceledException& TransactionCanceledException::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Message"))
+      {
+        m_message = reader.ReadString();
+        m_messageHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CancellationReasons"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_cancellationReasons.push_back(reader);
+          }
+        }
+        m_cancellationReasonsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TransactionCanceledException::Jsonize() const
 {
   JsonValue payload;
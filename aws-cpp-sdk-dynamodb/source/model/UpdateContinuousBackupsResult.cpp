@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateContinuousBackupsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ UpdateContinuousBackupsResult& UpdateContinuousBackupsResult::operator =(const A
 
 
 
+  return *this;
+}
+
+UpdateContinuousBackupsResult::UpdateContinuousBackupsResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UpdateContinuousBackupsResult& UpdateContinuousBackupsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ContinuousBackupsDescription"))
+      {
+        m_continuousBackupsDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateContributorInsightsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -50,5 +51,37 @@ UpdateContributorInsightsResult& UpdateContributorInsightsResult::operator =(con
 
 
 
+  return *this;
+}
+
+UpdateContributorInsightsResult::UpdateContributorInsightsResult(const Aws::AmazonWebServiceResult<JsonReader>& result) : 
+    m_contributorInsightsStatus(ContributorInsightsStatus::NOT_SET)
+{
+  *this = result;
+}
+
+UpdateContributorInsightsResult& UpdateContributorInsightsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+      }
+      else if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+      }
+      else if(reader.KeyEquals("ContributorInsightsStatus"))
+      {
+        m_contributorInsightsStatus = ContributorInsightsStatusMapper::GetContributorInsightsStatusForName(reader.ReadString());
+      }
+    }
+  }
+
+
   return *this;
 }
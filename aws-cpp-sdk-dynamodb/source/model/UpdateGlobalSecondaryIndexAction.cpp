@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateGlobalSecondaryIndexAction.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ UpdateGlobalSecondaryIndexAction::UpdateGlobalSecondaryIndexAction(JsonView json
   *this = jsonValue;
 }
 
+UpdateGlobalSecondaryIndexAction::UpdateGlobalSecondaryIndexAction(JsonReader& reader) : 
+    m_indexNameHasBeenSet(false),
+    m_provisionedThroughputHasBeenSet(false)
+{
+  *this = reader;
+}
+
 UpdateGlobalSecondaryIndexAction& UpdateGlobalSecondaryIndexAction::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("IndexName"))
@@ -50,6 +58,27 @@ UpdateGlobalSecondaryIndexAction& UpdateGlobalSecondaryIndexAction::operator =(J
   return *this;
 }
 
+UpdateGlobalSecondaryIndexAction& UpdateGlobalSecondaryIndexAction::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("IndexName"))
+      {
+        m_indexName = reader.ReadString();
+        m_indexNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ProvisionedThroughput"))
+      {
+        m_provisionedThroughput = reader;
+        m_provisionedThroughputHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue UpdateGlobalSecondaryIndexAction::Jsonize() const
 {
   JsonValue payload;
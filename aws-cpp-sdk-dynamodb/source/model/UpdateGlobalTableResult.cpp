@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateGlobalTableResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ UpdateGlobalTableResult& UpdateGlobalTableResult::operator =(const Aws::AmazonWe
 
 
 
+  return *this;
+}
+
+UpdateGlobalTableResult::UpdateGlobalTableResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UpdateGlobalTableResult& UpdateGlobalTableResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("GlobalTableDescription"))
+      {
+        m_globalTableDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
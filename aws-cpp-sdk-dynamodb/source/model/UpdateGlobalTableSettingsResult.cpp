@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateGlobalTableSettingsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -45,5 +46,38 @@ UpdateGlobalTableSettingsResult& UpdateGlobalTableSettingsResult::operator =(con
 
 
 
+  return *this;
+}
+
+UpdateGlobalTableSettingsResult::UpdateGlobalTableSettingsResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UpdateGlobalTableSettingsResult& UpdateGlobalTableSettingsResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("GlobalTableName"))
+      {
+        m_globalTableName = reader.ReadString();
+      }
+      else if(reader.KeyEquals("ReplicaSettings"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_replicaSettings.push_back(reader);
+          }
+        }
+      }
+    }
+  }
+
+
   return *this;
 }
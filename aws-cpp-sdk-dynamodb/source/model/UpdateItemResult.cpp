@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateItemResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -51,5 +52,43 @@ UpdateItemResult& UpdateItemResult::operator =(const Aws::AmazonWebServiceResult
 
 
 
+  return *this;
+}
+
+UpdateItemResult::UpdateItemResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UpdateItemResult& UpdateItemResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Attributes"))
+      {
+        if(reader.StartObject())
+        {
+          while(reader.NextMember())
+          {
+            Aws::String attributesKey = reader.GetKey();
+            m_attributes[attributesKey] = reader;
+          }
+        }
+      }
+      else if(reader.KeyEquals("ConsumedCapacity"))
+      {
+        m_consumedCapacity = reader;
+      }
+      else if(reader.KeyEquals("ItemCollectionMetrics"))
+      {
+        m_itemCollectionMetrics = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
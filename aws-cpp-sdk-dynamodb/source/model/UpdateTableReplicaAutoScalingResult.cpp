@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateTableReplicaAutoScalingResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ UpdateTableReplicaAutoScalingResult& UpdateTableReplicaAutoScalingResult::operat
 
 
 
+  return *this;
+}
+
+UpdateTableReplicaAutoScalingResult::UpdateTableReplicaAutoScalingResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UpdateTableReplicaAutoScalingResult& UpdateTableReplicaAutoScalingResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TableAutoScalingDescription"))
+      {
+        m_tableAutoScalingDescription = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/UpdateTimeToLiveResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ UpdateTimeToLiveResult& UpdateTimeToLiveResult::operator =(const Aws::AmazonWebS
 
 
 
+  return *this;
+}
+
+UpdateTimeToLiveResult::UpdateTimeToLiveResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UpdateTimeToLiveResult& UpdateTimeToLiveResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("TimeToLiveSpecification"))
+      {
+        m_timeToLiveSpecification = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
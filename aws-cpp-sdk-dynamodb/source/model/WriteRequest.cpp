@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/WriteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ WriteRequest::WriteRequest(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+WriteRequest::WriteRequest(JsonReader& reader) : 
+    m_putRequestHasBeenSet(false),
+    m_deleteRequestHasBeenSet(false)
+{
+  *this = reader;
+}
+
 WriteRequest& WriteRequest::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("PutRequest"))
@@ -50,6 +58,27 @@ WriteRequest& WriteRequest::operator =(JsonView jsonValue)
   return *this;
 }
 
+WriteRequest& WriteRequest::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("PutRequest"))
+      {
+        m_putRequest = reader;
+        m_putRequestHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("DeleteRequest"))
+      {
+        m_deleteRequest = reader;
+        m_deleteRequestHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue WriteRequest::Jsonize() const
 {
   JsonValue payload;
@@ -10,6 +10,10 @@
 #include <aws/core/utils/DateTime.h>
 #include <aws/external/gtest.h>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 using namespace Aws::Auth;
 using namespace Aws::STS;
 using namespace Aws::Utils;
@@ -21,8 +25,10 @@ class MockSTSClient : public STSClient
 public:
     MockSTSClient() : STSClient(AWSCredentials()), m_calledCount(0) {}
 
+    // Called by the background refresh of the provider as well as by the test.
     Model::AssumeRoleOutcome AssumeRole(const Model::AssumeRoleRequest& request) const
     {
+        std::lock_guard<std::mutex> locker(m_mutex);
         m_calledCount++;
         m_capturedRequest = request;
         return m_mockedOutcome;
@@ -30,11 +36,13 @@ public:
 
     void MockAssumeRole(const Model::AssumeRoleOutcome& outcome)
     {
+        std::lock_guard<std::mutex> locker(m_mutex);
         m_mockedOutcome = outcome;
     }
 
     Model::AssumeRoleRequest CapturedRequest() const
     {
+        std::lock_guard<std::mutex> locker(m_mutex);
         return m_capturedRequest;
     }
 
@@ -44,7 +52,8 @@ public:
     }
 
 private:
-    mutable int m_calledCount;
+    mutable std::mutex m_mutex;
+    mutable std::atomic<int> m_calledCount;
     mutable Model::AssumeRoleRequest m_capturedRequest;
     Model::AssumeRoleOutcome m_mockedOutcome;
 };
@@ -133,18 +142,24 @@ TEST(STSAssumeRoleCredentialsProviderTest, TestCredentialsCacheExpiry)
     ASSERT_EQ(DEFAULT_CREDS_LOAD_FREQ_SECONDS, request.GetDurationSeconds());
     ASSERT_STREQ(EXTERNAL_ID, request.GetExternalId().c_str());
 
+    // The first credentials expire within the prefetch window, they are refreshed in the background
+    // while the cached ones keep being returned. The new ones don't need to be refreshed again during the test.
     stsCredentials.WithAccessKeyId(ACCESS_KEY_ID_2)
         .WithSecretAccessKey(SECRET_ACCESS_KEY_ID_2)
         .WithSessionToken(SESSION_TOKEN_2)
-        .WithExpiration(expiryTime);
+        .WithExpiration(DateTime(DateTime::CurrentTimeMillis() + 3600 * 1000));
 
     assumeRoleResult.SetCredentials(stsCredentials);
 
     stsClient->MockAssumeRole(assumeRoleResult);
 
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    for (int i = 0; i < 100 && credentials.GetAWSAccessKeyId() != ACCESS_KEY_ID_2; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        credentials = credsProvider.GetAWSCredentials();
+        ASSERT_FALSE(credentials.IsEmpty());
+    }
 
-    credentials = credsProvider.GetAWSCredentials();
     request = stsClient->CapturedRequest();
     ASSERT_STREQ(ACCESS_KEY_ID_2, credentials.GetAWSAccessKeyId().c_str());
     ASSERT_STREQ(SECRET_ACCESS_KEY_ID_2, credentials.GetAWSSecretKey().c_str());
@@ -7,10 +7,9 @@
 
 #include <aws/identity-management/IdentityManagment_EXPORTS.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/RefreshingCredentialsCache.h>
 
 #include <memory>
-#include <mutex>
-#include <atomic>
 
 namespace Aws
 {
@@ -27,7 +26,8 @@ namespace Aws
         static const int DEFAULT_CREDS_LOAD_FREQ_SECONDS = 900;
 
         /**
-         * Credentials provider for STS Assume Role
+         * Credentials provider for STS Assume Role. The role is assumed again in the background before the credentials expire,
+         * GetAWSCredentials only waits on STS the first time, or if assuming the role failed until the credentials expired.
          */
         class AWS_IDENTITY_MANAGEMENT_API STSAssumeRoleCredentialsProvider : public AWSCredentialsProvider
         {
@@ -51,16 +51,15 @@ namespace Aws
             AWSCredentials GetAWSCredentials() override;
 
         private:
-            void LoadCredentialsFromSTS();
+            bool LoadCredentialsFromSTS(AWSCredentials& credentials);
 
             std::shared_ptr<Aws::STS::STSClient> m_stsClient;
-            AWSCredentials m_cachedCredentials;
             Aws::String m_roleArn;
             Aws::String m_sessionName;
             Aws::String m_externalId;
-            std::atomic<int64_t> m_expiry;
-            std::mutex m_credsMutex;
-            std::atomic<int> m_loadFrequency;
+            int m_loadFrequency;
+            // Declared last so that its refresh thread stops before the members it loads with are destroyed.
+            RefreshingCredentialsCache m_credentialsCache;
         };
     }
 }
\ No newline at end of file
@@ -17,14 +17,15 @@ namespace Aws
     namespace Auth
     {
         static const char* CLASS_TAG = "STSAssumeRoleCredentialsProvider";
-        //60 seconds;
-        static const int ACCOUNT_FOR_LATENCY = 60;
 
         STSAssumeRoleCredentialsProvider::STSAssumeRoleCredentialsProvider(const Aws::String& roleArn, const Aws::String& sessionName,
             const Aws::String& externalId, int loadFrequency, const std::shared_ptr<Aws::STS::STSClient>& stsClient) :
             m_stsClient(stsClient == nullptr ? Aws::MakeShared<Aws::STS::STSClient>(CLASS_TAG) : stsClient),
             m_roleArn(roleArn), m_sessionName(sessionName), m_externalId(externalId),
-            m_expiry(0), m_loadFrequency(loadFrequency)            
+            m_loadFrequency(loadFrequency),
+            // STS sessions last at least 15 minutes, the credentials are refreshed within the default prefetch window before they expire,
+            // which leaves room for retries while STS is unavailable.
+            m_credentialsCache(CLASS_TAG, [this](AWSCredentials& credentials) { return LoadCredentialsFromSTS(credentials); }, loadFrequency * 1000L)
         {
             if (sessionName.empty())
             {   
@@ -37,51 +38,35 @@ namespace Aws
 
         AWSCredentials STSAssumeRoleCredentialsProvider::GetAWSCredentials()
         {
-            LoadCredentialsFromSTS();
-            std::lock_guard<std::mutex> locker(m_credsMutex);
-            return m_cachedCredentials;
+            return m_credentialsCache.GetCredentials();
         }
 
-        void STSAssumeRoleCredentialsProvider::LoadCredentialsFromSTS()
+        bool STSAssumeRoleCredentialsProvider::LoadCredentialsFromSTS(AWSCredentials& credentials)
         {
-            //standard check lock check
-            auto diffSeconds = static_cast<int>(DateTime::Now().SecondsWithMSPrecision() - DateTime(m_expiry.load()).SecondsWithMSPrecision());
-            if (diffSeconds > 0 - ACCOUNT_FOR_LATENCY)
+            AWS_LOGSTREAM_INFO(CLASS_TAG, "Assuming role " << m_roleArn << " to refresh the credentials.");
+            Model::AssumeRoleRequest assumeRoleRequest;
+            assumeRoleRequest.WithRoleArn(m_roleArn)
+                .WithRoleSessionName(m_sessionName)
+                .WithDurationSeconds(m_loadFrequency);
+
+            if (!m_externalId.empty())
             {
-                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Credentials have expired with diff of " << diffSeconds << " since last credentials pull.");
-                AWS_LOGSTREAM_TRACE(CLASS_TAG, "Grabbing lock.");
-                std::lock_guard<std::mutex> locker(m_credsMutex);
-                AWS_LOGSTREAM_TRACE(CLASS_TAG, "Lock acquired. Checking expiration again.");
-                diffSeconds = static_cast<int>(DateTime::Now().SecondsWithMSPrecision() - DateTime(m_expiry.load()).SecondsWithMSPrecision());
-                if (diffSeconds > 0 - ACCOUNT_FOR_LATENCY)
-                {
-                    AWS_LOGSTREAM_INFO(CLASS_TAG, "Credentials have expired with diff of " << diffSeconds << " since last credentials pull.");
-                    Model::AssumeRoleRequest assumeRoleRequest;
-                    assumeRoleRequest.WithRoleArn(m_roleArn)
-                        .WithRoleSessionName(m_sessionName)
-                        .WithDurationSeconds(m_loadFrequency);
+                assumeRoleRequest.SetExternalId(m_externalId);
+            }
 
-                    if (!m_externalId.empty())
-                    {
-                        assumeRoleRequest.SetExternalId(m_externalId);
-                    }
+            auto assumeRoleOutcome = m_stsClient->AssumeRole(assumeRoleRequest);
+            if (!assumeRoleOutcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Credentials refresh failed with error " << assumeRoleOutcome.GetError().GetExceptionName()
+                        << " message: " << assumeRoleOutcome.GetError().GetMessage());
+                return false;
+            }
 
-                    auto assumeRoleOutcome = m_stsClient->AssumeRole(assumeRoleRequest);
-                    if (assumeRoleOutcome.IsSuccess())
-                    {
-                        const auto& stsCredentials = assumeRoleOutcome.GetResult().GetCredentials();
-                        m_cachedCredentials = AWSCredentials(stsCredentials.GetAccessKeyId(), stsCredentials.GetSecretAccessKey(), stsCredentials.GetSessionToken());
-                        m_expiry = stsCredentials.GetExpiration().Millis();
-                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Credentials refreshed with new expiry " << 
-                            DateTime(m_expiry.load()).ToGmtString(DateFormat::ISO_8601));
-                    }
-                    else
-                    {
-                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Credentials refresh failed with error " << assumeRoleOutcome.GetError().GetExceptionName()
-                                << " message: " << assumeRoleOutcome.GetError().GetMessage());
-                    }
-                }
-            }            
+            const auto& stsCredentials = assumeRoleOutcome.GetResult().GetCredentials();
+            credentials = AWSCredentials(stsCredentials.GetAccessKeyId(), stsCredentials.GetSecretAccessKey(), stsCredentials.GetSessionToken(),
+                stsCredentials.GetExpiration());
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Credentials refreshed with new expiry " << stsCredentials.GetExpiration().ToGmtString(DateFormat::ISO_8601));
+            return true;
         }
     }
 }
\ No newline at end of file
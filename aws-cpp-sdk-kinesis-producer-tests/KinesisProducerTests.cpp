@@ -0,0 +1,437 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/kinesis-producer/KinesisProducer.h>
+#include <aws/kinesis-producer/RecordAggregator.h>
+#include <aws/kinesis-producer/HashKey.h>
+#include <aws/kinesis/KinesisClient.h>
+#include <aws/kinesis/model/ListShardsRequest.h>
+#include <aws/kinesis/model/PutRecordsRequest.h>
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::KinesisProducer;
+using namespace Aws::Kinesis;
+using namespace Aws::Utils;
+
+namespace {
+
+static const char* ALLOCATION_TAG = "KinesisProducerTests";
+static const char* STREAM_NAME = "stream";
+static const char* FIRST_SHARD = "shardId-000000000000";
+static const char* SECOND_SHARD = "shardId-000000000001";
+// The two shards split the hash key space in halves.
+static const char* FIRST_SHARD_ENDING_HASH_KEY = "170141183460469231731687303715884105727";
+static const char* SECOND_SHARD_STARTING_HASH_KEY = "170141183460469231731687303715884105728";
+static const char* MAX_HASH_KEY = "340282366920938463463374607431768211455";
+
+static Model::Shard MakeShard(const char* shardId, const char* startingHashKey, const char* endingHashKey)
+{
+    Model::HashKeyRange hashKeyRange;
+    hashKeyRange.SetStartingHashKey(startingHashKey);
+    hashKeyRange.SetEndingHashKey(endingHashKey);
+    Model::Shard shard;
+    shard.SetShardId(shardId);
+    shard.SetHashKeyRange(hashKeyRange);
+    return shard;
+}
+
+static Aws::String GetExpectedShard(const Aws::String& partitionKey, const Aws::String& explicitHashKey)
+{
+    HashKey hashKey = HashKey::FromPartitionKey(partitionKey);
+    if (!explicitHashKey.empty())
+    {
+        HashKey::FromDecimalString(explicitHashKey, hashKey);
+    }
+    return hashKey.GetHigh() >> 63 ? SECOND_SHARD : FIRST_SHARD;
+}
+
+static ByteBuffer MakeData(const Aws::String& data)
+{
+    return ByteBuffer(reinterpret_cast<const unsigned char*>(data.c_str()), data.size());
+}
+
+/**
+ * Stream of two open shards. PutRecords puts records in the shard owning their hash key,
+ * or fails the records selected by the test. The asynchronous calls of the producer go through the executor of the client to these.
+ */
+class MockKinesisClient : public KinesisClient
+{
+public:
+    MockKinesisClient() : KinesisClient(Aws::Auth::AWSCredentials("accessKeyId", "secretKey")), m_sequenceNumber(0) {}
+
+    // Each shard is listed in a page of its own.
+    Model::ListShardsOutcome ListShards(const Model::ListShardsRequest& request) const override
+    {
+        Model::ListShardsResult result;
+        if (request.GetNextToken().empty())
+        {
+            EXPECT_EQ(STREAM_NAME, request.GetStreamName());
+            result.AddShards(MakeShard(FIRST_SHARD, "0", FIRST_SHARD_ENDING_HASH_KEY));
+            result.SetNextToken("nextPage");
+        }
+        else
+        {
+            EXPECT_TRUE(request.GetStreamName().empty());
+            result.AddShards(MakeShard(SECOND_SHARD, SECOND_SHARD_STARTING_HASH_KEY, MAX_HASH_KEY));
+        }
+        return result;
+    }
+
+    Model::PutRecordsOutcome PutRecords(const Model::PutRecordsRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        size_t call = m_requests.size();
+        m_requests.push_back(request);
+
+        Model::PutRecordsResult result;
+        int failedRecordCount = 0;
+        for (size_t i = 0; i < request.GetRecords().size(); ++i)
+        {
+            const auto& record = request.GetRecords()[i];
+            Model::PutRecordsResultEntry entry;
+            if (m_failRecord && m_failRecord(call, i))
+            {
+                entry.SetErrorCode("ProvisionedThroughputExceededException");
+                entry.SetErrorMessage("Rate exceeded for shard.");
+                ++failedRecordCount;
+            }
+            else
+            {
+                entry.SetShardId(GetExpectedShard(record.GetPartitionKey(), record.GetExplicitHashKey()));
+                entry.SetSequenceNumber(StringUtils::to_string(++m_sequenceNumber));
+            }
+            result.AddRecords(entry);
+        }
+        result.SetFailedRecordCount(failedRecordCount);
+        return result;
+    }
+
+    void FailRecords(const std::function<bool(size_t call, size_t record)>& failRecord)
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_failRecord = failRecord;
+    }
+
+    Aws::Vector<Model::PutRecordsRequest> GetRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_requests;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    mutable Aws::Vector<Model::PutRecordsRequest> m_requests;
+    mutable long long m_sequenceNumber;
+    std::function<bool(size_t, size_t)> m_failRecord;
+};
+
+class KinesisProducerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_kinesisClient = Aws::MakeShared<MockKinesisClient>(ALLOCATION_TAG);
+        m_configuration.kinesisClient = m_kinesisClient;
+        m_configuration.streamName = STREAM_NAME;
+        m_configuration.userRecordResultCallback = [this](const KinesisProducer*, const UserRecordResult& result)
+        {
+            std::lock_guard<std::mutex> locker(m_resultsMutex);
+            m_results.push_back(result);
+        };
+    }
+
+    void TearDown() override
+    {
+        m_kinesisClient = nullptr;
+    }
+
+    // Records added before the shard map is loaded are neither aggregated nor rate limited.
+    static void WaitForShardMap(const KinesisProducer& producer)
+    {
+        for (int i = 0; i < 100 && producer.GetMetrics().shardMapRefreshes == 0; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(1u, producer.GetMetrics().shardMapRefreshes);
+    }
+
+    Aws::Vector<UserRecordResult> GetResults()
+    {
+        std::lock_guard<std::mutex> locker(m_resultsMutex);
+        return m_results;
+    }
+
+    std::shared_ptr<MockKinesisClient> m_kinesisClient;
+    KinesisProducerConfiguration m_configuration;
+    std::mutex m_resultsMutex;
+    Aws::Vector<UserRecordResult> m_results;
+};
+
+} // anonymous namespace
+
+TEST(HashKeyTest, TestDecimalConversions)
+{
+    HashKey hashKey;
+    ASSERT_TRUE(HashKey::FromDecimalString("0", hashKey));
+    ASSERT_EQ(HashKey(0, 0), hashKey);
+    ASSERT_EQ("0", hashKey.ToDecimalString());
+
+    ASSERT_TRUE(HashKey::FromDecimalString(MAX_HASH_KEY, hashKey));
+    ASSERT_EQ(HashKey(UINT64_MAX, UINT64_MAX), hashKey);
+    ASSERT_EQ(MAX_HASH_KEY, hashKey.ToDecimalString());
+
+    ASSERT_TRUE(HashKey::FromDecimalString(SECOND_SHARD_STARTING_HASH_KEY, hashKey));
+    ASSERT_EQ(HashKey(0x8000000000000000ULL, 0), hashKey);
+    ASSERT_EQ(SECOND_SHARD_STARTING_HASH_KEY, hashKey.ToDecimalString());
+
+    // 2^128 doesn't fit.
+    ASSERT_FALSE(HashKey::FromDecimalString("340282366920938463463374607431768211456", hashKey));
+    ASSERT_FALSE(HashKey::FromDecimalString("", hashKey));
+    ASSERT_FALSE(HashKey::FromDecimalString("12a", hashKey));
+    ASSERT_FALSE(HashKey::FromDecimalString("-1", hashKey));
+
+    // MD5("a") is 0cc175b9c0f1b6a831c399e269772661.
+    ASSERT_EQ(HashKey(0x0cc175b9c0f1b6a8ULL, 0x31c399e269772661ULL), HashKey::FromPartitionKey("a"));
+    ASSERT_EQ("16955237001963240173058271559858726497", HashKey::FromPartitionKey("a").ToDecimalString());
+}
+
+TEST(RecordAggregatorTest, TestAggregatedRecordsRoundTrip)
+{
+    RecordAggregator aggregator;
+    ASSERT_TRUE(aggregator.IsEmpty());
+
+    struct { const char* partitionKey; const char* explicitHashKey; const char* data; } userRecords[] = {
+        { "key1", "", "first" },
+        { "key2", "", "second" },
+        { "key1", "12345", "third" },
+        { "key2", "12345", "" },
+    };
+    for (const auto& userRecord : userRecords)
+    {
+        ByteBuffer data = MakeData(userRecord.data);
+        size_t expectedSize = aggregator.GetSizeWith(userRecord.partitionKey, userRecord.explicitHashKey, data.GetLength());
+        aggregator.Add(userRecord.partitionKey, userRecord.explicitHashKey, data.GetUnderlyingData(), data.GetLength());
+        ASSERT_EQ(expectedSize, aggregator.GetSize());
+    }
+    ASSERT_EQ(4u, aggregator.GetRecordCount());
+    ASSERT_EQ("key1", aggregator.GetPartitionKey());
+
+    ByteBuffer record = aggregator.Serialize();
+    ASSERT_EQ(aggregator.GetSize(), record.GetLength());
+    ASSERT_TRUE(RecordAggregator::IsAggregated(record.GetUnderlyingData(), record.GetLength()));
+
+    Aws::Vector<UserRecord> deaggregated;
+    ASSERT_TRUE(RecordAggregator::Deaggregate(record.GetUnderlyingData(), record.GetLength(), deaggregated));
+    ASSERT_EQ(4u, deaggregated.size());
+    for (size_t i = 0; i < deaggregated.size(); ++i)
+    {
+        ASSERT_EQ(userRecords[i].partitionKey, deaggregated[i].partitionKey);
+        ASSERT_EQ(userRecords[i].explicitHashKey, deaggregated[i].explicitHashKey);
+        ASSERT_EQ(MakeData(userRecords[i].data), deaggregated[i].data);
+    }
+
+    // The digest covers the message.
+    record[10] ^= 0x1;
+    ASSERT_FALSE(RecordAggregator::Deaggregate(record.GetUnderlyingData(), record.GetLength(), deaggregated));
+    ByteBuffer plainRecord = MakeData("not aggregated, but long enough to hold a digest");
+    ASSERT_FALSE(RecordAggregator::IsAggregated(plainRecord.GetUnderlyingData(), plainRecord.GetLength()));
+
+    aggregator.Clear();
+    ASSERT_TRUE(aggregator.IsEmpty());
+    ASSERT_EQ(20u, aggregator.GetSize());
+}
+
+TEST_F(KinesisProducerTest, TestRecordsAreAggregatedPerShard)
+{
+    m_configuration.recordMaxBufferedTimeMs = 60000;
+    KinesisProducer producer(m_configuration);
+    WaitForShardMap(producer);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(producer.AddUserRecord("key" + StringUtils::to_string(i), MakeData("data" + StringUtils::to_string(i))));
+    }
+    producer.FlushSync();
+
+    // One aggregated record per shard, in a single call.
+    auto requests = m_kinesisClient->GetRequests();
+    ASSERT_EQ(1u, requests.size());
+    ASSERT_EQ(2u, requests[0].GetRecords().size());
+    size_t userRecordCount = 0;
+    for (const auto& record : requests[0].GetRecords())
+    {
+        Aws::Vector<UserRecord> userRecords;
+        ASSERT_TRUE(RecordAggregator::Deaggregate(record.GetData().GetUnderlyingData(), record.GetData().GetLength(), userRecords));
+        for (const auto& userRecord : userRecords)
+        {
+            ASSERT_EQ(GetExpectedShard(record.GetPartitionKey(), record.GetExplicitHashKey()), GetExpectedShard(userRecord.partitionKey, ""));
+        }
+        userRecordCount += userRecords.size();
+    }
+    ASSERT_EQ(100u, userRecordCount);
+
+    auto results = GetResults();
+    ASSERT_EQ(100u, results.size());
+    Aws::Set<std::pair<Aws::String, size_t>> subSequenceNumbers;
+    for (const auto& result : results)
+    {
+        ASSERT_TRUE(result.successful);
+        ASSERT_EQ(GetExpectedShard(result.partitionKey, ""), result.shardId);
+        ASSERT_EQ(1, result.attempts);
+        subSequenceNumbers.emplace(result.sequenceNumber, result.subSequenceNumber);
+    }
+    ASSERT_EQ(100u, subSequenceNumbers.size());
+
+    auto metrics = producer.GetMetrics();
+    ASSERT_EQ(100u, metrics.userRecordsReceived);
+    ASSERT_EQ(100u, metrics.userRecordsPut);
+    ASSERT_EQ(0u, metrics.userRecordsPending);
+    ASSERT_EQ(2u, metrics.kinesisRecordsPut);
+    ASSERT_EQ(1u, metrics.putRecordsRequests);
+    ASSERT_EQ(0u, metrics.shardMispredictions);
+}
+
+TEST_F(KinesisProducerTest, TestOnlyFailedRecordsAreRetried)
+{
+    m_configuration.aggregationEnabled = false;
+    m_configuration.recordMaxBufferedTimeMs = 60000;
+    m_kinesisClient->FailRecords([](size_t call, size_t record) { return call == 0 && record % 2 == 1; });
+    KinesisProducer producer(m_configuration);
+    WaitForShardMap(producer);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(producer.AddUserRecord("key" + StringUtils::to_string(i), MakeData("data")));
+    }
+    producer.FlushSync();
+
+    auto requests = m_kinesisClient->GetRequests();
+    ASSERT_EQ(2u, requests.size());
+    ASSERT_EQ(10u, requests[0].GetRecords().size());
+    ASSERT_EQ(5u, requests[1].GetRecords().size());
+    for (const auto& record : requests[1].GetRecords())
+    {
+        bool failedFirst = false;
+        for (size_t i = 1; i < requests[0].GetRecords().size(); i += 2)
+        {
+            failedFirst = failedFirst || requests[0].GetRecords()[i].GetPartitionKey() == record.GetPartitionKey();
+        }
+        ASSERT_TRUE(failedFirst);
+    }
+
+    auto results = GetResults();
+    ASSERT_EQ(10u, results.size());
+    size_t retried = 0;
+    for (const auto& result : results)
+    {
+        ASSERT_TRUE(result.successful);
+        retried += result.attempts == 2 ? 1 : 0;
+    }
+    ASSERT_EQ(5u, retried);
+
+    auto metrics = producer.GetMetrics();
+    ASSERT_EQ(10u, metrics.userRecordsPut);
+    ASSERT_EQ(5u, metrics.kinesisRecordsThrottled);
+    ASSERT_EQ(5u, metrics.kinesisRecordsRetried);
+    ASSERT_EQ(2u, metrics.putRecordsRequests);
+}
+
+TEST_F(KinesisProducerTest, TestRecordsAreSentAfterBufferedTime)
+{
+    m_configuration.recordMaxBufferedTimeMs = 50;
+    KinesisProducer producer(m_configuration);
+    WaitForShardMap(producer);
+
+    ASSERT_TRUE(producer.AddUserRecord("key", MakeData("data")));
+    for (int i = 0; i < 200 && GetResults().empty(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    auto results = GetResults();
+    ASSERT_EQ(1u, results.size());
+    ASSERT_TRUE(results[0].successful);
+    // A lone record isn't aggregated.
+    auto requests = m_kinesisClient->GetRequests();
+    ASSERT_EQ(1u, requests.size());
+    ASSERT_EQ(MakeData("data"), requests[0].GetRecords()[0].GetData());
+}
+
+TEST_F(KinesisProducerTest, TestRecordsFailOnceExpired)
+{
+    m_configuration.recordTtlMs = 300;
+    m_kinesisClient->FailRecords([](size_t, size_t) { return true; });
+    KinesisProducer producer(m_configuration);
+    WaitForShardMap(producer);
+
+    auto context = Aws::MakeShared<Aws::Client::AsyncCallerContext>(ALLOCATION_TAG, "context");
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(producer.AddUserRecord("key" + StringUtils::to_string(i), "", reinterpret_cast<const unsigned char*>("data"), 4, context));
+    }
+    producer.FlushSync();
+
+    auto results = GetResults();
+    ASSERT_EQ(3u, results.size());
+    for (const auto& result : results)
+    {
+        ASSERT_FALSE(result.successful);
+        ASSERT_EQ("ProvisionedThroughputExceededException", result.errorCode);
+        ASSERT_GE(result.attempts, 2);
+        ASSERT_EQ(context, result.context);
+    }
+
+    auto metrics = producer.GetMetrics();
+    ASSERT_EQ(3u, metrics.userRecordsFailed);
+    ASSERT_EQ(0u, metrics.userRecordsPending);
+    ASSERT_GT(metrics.kinesisRecordsRetried, 0u);
+}
+
+TEST_F(KinesisProducerTest, TestInvalidRecordsAreRejected)
+{
+    KinesisProducer producer(m_configuration);
+    ASSERT_FALSE(producer.AddUserRecord("", MakeData("data")));
+    ASSERT_FALSE(producer.AddUserRecord(Aws::String(257, 'k'), MakeData("data")));
+    ASSERT_FALSE(producer.AddUserRecord("key", ByteBuffer(1024 * 1024)));
+    ASSERT_FALSE(producer.AddUserRecord("key", "12a", reinterpret_cast<const unsigned char*>("data"), 4));
+    ASSERT_FALSE(producer.AddUserRecord("key", "340282366920938463463374607431768211456", reinterpret_cast<const unsigned char*>("data"), 4));
+    ASSERT_EQ(0u, producer.GetMetrics().userRecordsReceived);
+}
+
+TEST_F(KinesisProducerTest, TestShardsAreRateLimited)
+{
+    // 10 records per second per shard.
+    m_configuration.rateLimit = 1;
+    m_configuration.aggregationEnabled = false;
+    KinesisProducer producer(m_configuration);
+    WaitForShardMap(producer);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 25; ++i)
+    {
+        ASSERT_TRUE(producer.AddUserRecord("key" + StringUtils::to_string(i), "0", reinterpret_cast<const unsigned char*>("data"), 4));
+    }
+    producer.FlushSync();
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_GE(elapsedMs, 800);
+    auto requests = m_kinesisClient->GetRequests();
+    ASSERT_GE(requests.size(), 3u);
+    for (const auto& request : requests)
+    {
+        ASSERT_LE(request.GetRecords().size(), 10u);
+    }
+    auto metrics = producer.GetMetrics();
+    ASSERT_EQ(25u, metrics.userRecordsPut);
+    ASSERT_GT(metrics.rateLimitedShardDelays, 0u);
+}
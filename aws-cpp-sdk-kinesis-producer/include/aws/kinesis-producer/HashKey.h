@@ -0,0 +1,58 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/kinesis-producer/KinesisProducer_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace KinesisProducer
+    {
+        /**
+         * 128 bit hash key Kinesis maps records to shards with. Shards own ranges of hash keys,
+         * a record goes to the shard whose range contains the MD5 digest of its partition key, or its explicit hash key.
+         */
+        class AWS_KINESIS_PRODUCER_API HashKey
+        {
+        public:
+            HashKey() : m_high(0), m_low(0) {}
+            HashKey(uint64_t high, uint64_t low) : m_high(high), m_low(low) {}
+
+            /**
+             * Hash key Kinesis computes for partitionKey: its MD5 digest, read as a big endian number.
+             */
+            static HashKey FromPartitionKey(const Aws::String& partitionKey);
+
+            /**
+             * Parses the decimal representation used by the Kinesis API, e.g. for explicit hash keys and the hash key ranges of shards.
+             * Returns false if value isn't a decimal number between 0 and 2^128 - 1.
+             */
+            static bool FromDecimalString(const Aws::String& value, HashKey& hashKey);
+
+            /**
+             * Decimal representation used by the Kinesis API.
+             */
+            Aws::String ToDecimalString() const;
+
+            inline uint64_t GetHigh() const { return m_high; }
+            inline uint64_t GetLow() const { return m_low; }
+
+            inline bool operator==(const HashKey& other) const { return m_high == other.m_high && m_low == other.m_low; }
+            inline bool operator!=(const HashKey& other) const { return !(*this == other); }
+            inline bool operator<(const HashKey& other) const { return m_high < other.m_high || (m_high == other.m_high && m_low < other.m_low); }
+            inline bool operator>(const HashKey& other) const { return other < *this; }
+            inline bool operator<=(const HashKey& other) const { return !(other < *this); }
+            inline bool operator>=(const HashKey& other) const { return !(*this < other); }
+
+        private:
+            uint64_t m_high;
+            uint64_t m_low;
+        };
+    }
+}
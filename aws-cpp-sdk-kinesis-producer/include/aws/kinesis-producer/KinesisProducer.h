@@ -0,0 +1,263 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/kinesis-producer/KinesisProducer_EXPORTS.h>
+#include <aws/kinesis-producer/HashKey.h>
+#include <aws/kinesis-producer/ShardMap.h>
+#include <aws/kinesis/KinesisClient.h>
+#include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace KinesisProducer
+    {
+        class KinesisProducer;
+
+        /**
+         * Outcome of a user record added to the producer.
+         */
+        struct UserRecordResult
+        {
+            UserRecordResult() : successful(false), subSequenceNumber(0), attempts(0) {}
+
+            bool successful;
+            Aws::String partitionKey;
+            /**
+             * Shard and sequence number of the Kinesis record the user record was put in, when successful.
+             */
+            Aws::String shardId;
+            Aws::String sequenceNumber;
+            /**
+             * Position of the user record within the aggregated Kinesis record it was put in, 0 when it was put alone.
+             */
+            size_t subSequenceNumber;
+            /**
+             * Error of the last attempt, when the user record failed.
+             */
+            Aws::String errorCode;
+            Aws::String errorMessage;
+            /**
+             * Number of times the Kinesis record holding the user record was sent.
+             */
+            int attempts;
+            /**
+             * Context passed to AddUserRecord.
+             */
+            std::shared_ptr<const Aws::Client::AsyncCallerContext> context;
+        };
+
+        typedef std::function<void(const KinesisProducer*, const UserRecordResult&)> UserRecordResultCallback;
+
+        /**
+         * Counters of the work done by the producer since it was created. The throughput is the difference between
+         * two snapshots divided by the difference of their uptimes.
+         */
+        struct KinesisProducerMetrics
+        {
+            KinesisProducerMetrics() : userRecordsReceived(0), userRecordsPut(0), userRecordsFailed(0), userRecordsPending(0),
+                kinesisRecordsPut(0), bytesPut(0), putRecordsRequests(0), putRecordsRequestsFailed(0), kinesisRecordsRetried(0),
+                kinesisRecordsThrottled(0), rateLimitedShardDelays(0), shardMapRefreshes(0), shardMispredictions(0), uptimeMs(0)
+            {
+            }
+
+            uint64_t userRecordsReceived;
+            uint64_t userRecordsPut;
+            uint64_t userRecordsFailed;
+            /**
+             * User records added but not put or failed yet, whether buffered or in flight.
+             */
+            uint64_t userRecordsPending;
+            /**
+             * Records sent to Kinesis, after aggregation, and the size of their data and partition keys.
+             */
+            uint64_t kinesisRecordsPut;
+            uint64_t bytesPut;
+            uint64_t putRecordsRequests;
+            /**
+             * PutRecords calls that failed as a whole, rather than for some of their records.
+             */
+            uint64_t putRecordsRequestsFailed;
+            uint64_t kinesisRecordsRetried;
+            /**
+             * Records Kinesis rejected with ProvisionedThroughputExceededException.
+             */
+            uint64_t kinesisRecordsThrottled;
+            /**
+             * Times the records of a shard were held back by its rate limits.
+             */
+            uint64_t rateLimitedShardDelays;
+            uint64_t shardMapRefreshes;
+            /**
+             * Records Kinesis put in another shard than the one predicted, after the stream was resharded.
+             */
+            uint64_t shardMispredictions;
+            int64_t uptimeMs;
+        };
+
+        /**
+         * Configuration for use with KinesisProducer. The data here will be copied directly to KinesisProducer.
+         */
+        struct KinesisProducerConfiguration
+        {
+            KinesisProducerConfiguration() : aggregationEnabled(true), aggregationMaxCount(4294967295u), aggregationMaxSize(51200),
+                collectionMaxCount(500), collectionMaxSize(5 * 1024 * 1024), recordMaxBufferedTimeMs(100), recordTtlMs(30000),
+                rateLimit(150), maxOutstandingRequests(24), shardMapRefreshIntervalMs(60000)
+            {
+            }
+
+            /**
+             * Kinesis client to use for the PutRecords and ListShards calls. You are responsible for setting this.
+             * Its executor runs the PutRecords calls, so it should allow for maxOutstandingRequests concurrent tasks.
+             */
+            std::shared_ptr<Aws::Kinesis::KinesisClient> kinesisClient;
+            /**
+             * Stream records are put to. You are responsible for setting this.
+             */
+            Aws::String streamName;
+            /**
+             * When true, user records predicted to go to the same shard are packed into Kinesis records in the KPL aggregation format.
+             * Consumers need to deaggregate them, which the KCL and Lambda do transparently. Enabled by default.
+             * Records are only aggregated once the shard map was loaded.
+             */
+            bool aggregationEnabled;
+            /**
+             * Maximum number of user records and size in bytes of an aggregated Kinesis record, including its partition key.
+             * Defaults to no limit on the count, and 51200 bytes. User records larger than aggregationMaxSize are put alone.
+             */
+            size_t aggregationMaxCount;
+            size_t aggregationMaxSize;
+            /**
+             * Maximum number of Kinesis records and total size in bytes of a PutRecords call, defaults to the service limits of 500 records and 5 MB.
+             * Buffered records are sent as soon as they reach either limit.
+             */
+            size_t collectionMaxCount;
+            size_t collectionMaxSize;
+            /**
+             * Maximum time in ms a user record is buffered, to be aggregated and batched with others, before it is sent. Defaults to 100ms.
+             */
+            long recordMaxBufferedTimeMs;
+            /**
+             * Time in ms after which a user record that couldn't be put, e.g. because the shard was throttled, fails. Defaults to 30 seconds.
+             */
+            long recordTtlMs;
+            /**
+             * Limits the records sent to each shard to this percentage of the throughput of a shard, 1000 records and 1 MB per second.
+             * Defaults to 150: Kinesis throttles the excess, and the failed records are retried, but a producer can't flood shards with records bound to fail.
+             * Lower it to 100 or less to avoid throttling when the producer is the only writer of the stream.
+             */
+            unsigned rateLimit;
+            /**
+             * Maximum number of PutRecords calls in flight, defaults to 24.
+             */
+            size_t maxOutstandingRequests;
+            /**
+             * Interval in ms between reloads of the shard map, defaults to 60 seconds. The map is also reloaded when records land in other shards than predicted.
+             */
+            long shardMapRefreshIntervalMs;
+            /**
+             * Callback receiving the outcome of every user record. Called from the threads of the executor of the Kinesis client,
+             * and from the producer thread, it shouldn't block for long.
+             */
+            UserRecordResultCallback userRecordResultCallback;
+        };
+
+        /**
+         * High-level producer for Kinesis Data Streams. User records are predicted to shards from their hash keys,
+         * aggregated per shard, and sent in PutRecords batches of up to collectionMaxCount records, once a batch is full
+         * or its oldest record was buffered for recordMaxBufferedTimeMs. Each shard is rate limited on the producer side.
+         * Records failing in a partially successful PutRecords call are retried alone, with backoff, until their TTL expires.
+         *
+         * Records are sent by a background thread, and the outcome of every user record is reported to userRecordResultCallback.
+         * The destructor flushes the buffered records and waits for them to complete.
+         */
+        class AWS_KINESIS_PRODUCER_API KinesisProducer
+        {
+        public:
+            explicit KinesisProducer(const KinesisProducerConfiguration& configuration);
+            ~KinesisProducer();
+
+            KinesisProducer(const KinesisProducer&) = delete;
+            KinesisProducer& operator=(const KinesisProducer&) = delete;
+
+            /**
+             * Buffers a user record, mapped to a shard by its partition key. Returns false if the record is invalid:
+             * partition keys are 1 to 256 characters long, and a partition key and its data can't be larger than 1 MB.
+             */
+            bool AddUserRecord(const Aws::String& partitionKey, const Aws::Utils::ByteBuffer& data,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+            /**
+             * Buffers a user record, mapped to a shard by explicitHashKey, a decimal number, when it isn't empty.
+             * Returns false if the record is invalid.
+             */
+            bool AddUserRecord(const Aws::String& partitionKey, const Aws::String& explicitHashKey, const unsigned char* data, size_t length,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+            /**
+             * Sends the buffered records without waiting for recordMaxBufferedTimeMs, still subject to the rate limits.
+             */
+            void Flush();
+
+            /**
+             * Flushes, then blocks until every user record added so far was put or failed.
+             */
+            void FlushSync();
+
+            KinesisProducerMetrics GetMetrics() const;
+
+        private:
+            struct PendingUserRecord;
+            struct KinesisRecord;
+            struct ShardQueue;
+            typedef Aws::Vector<std::shared_ptr<KinesisRecord>> RecordBatch;
+
+            void ProducerThread();
+            void RefreshShardMap();
+            ShardQueue& GetShardQueue(const Aws::String& shardId);
+            void EnqueueRecord(ShardQueue& shardQueue, const std::shared_ptr<KinesisRecord>& record, bool retry);
+            void CloseAggregate(ShardQueue& shardQueue);
+            int64_t CollectBatches(int64_t nowMs, Aws::Vector<std::shared_ptr<RecordBatch>>& batches, Aws::Vector<UserRecordResult>& results);
+            void SendBatch(const std::shared_ptr<RecordBatch>& batch);
+            void OnPutRecordsOutcome(const RecordBatch& batch, const Aws::Kinesis::Model::PutRecordsOutcome& outcome);
+            void RetryOrFail(const std::shared_ptr<KinesisRecord>& record, const Aws::String& errorCode, const Aws::String& errorMessage,
+                bool retryable, int64_t nowMs, Aws::Vector<UserRecordResult>& results);
+            void Fail(const KinesisRecord& record, const Aws::String& errorCode, const Aws::String& errorMessage, Aws::Vector<UserRecordResult>& results);
+            void DeliverResults(const Aws::Vector<UserRecordResult>& results) const;
+
+            KinesisProducerConfiguration m_configuration;
+            ShardMap m_shardMap;
+            mutable std::mutex m_mutex;
+            // Wakes the producer thread, and the callers of FlushSync.
+            std::condition_variable m_producerSignal;
+            std::condition_variable m_completionSignal;
+            Aws::Map<Aws::String, std::shared_ptr<ShardQueue>> m_shardQueues;
+            // Kinesis records waiting to be sent, and their size.
+            size_t m_readyRecordCount;
+            size_t m_readySize;
+            size_t m_outstandingRequests;
+            // Time the producer thread wakes up at, records due earlier wake it up. 0 while it is awake.
+            int64_t m_producerWakeUpMs;
+            int64_t m_lastShardMapRefreshMs;
+            int64_t m_nextShardMapRefreshMs;
+            bool m_flushRequested;
+            bool m_stopping;
+            KinesisProducerMetrics m_metrics;
+            int64_t m_startMs;
+            std::thread m_producerThread;
+        };
+    }
+}
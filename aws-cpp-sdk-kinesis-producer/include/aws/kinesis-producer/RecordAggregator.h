@@ -0,0 +1,102 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/kinesis-producer/KinesisProducer_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace KinesisProducer
+    {
+        /**
+         * Record as put by the producer, and as extracted from aggregated Kinesis records by RecordAggregator::Deaggregate.
+         */
+        struct UserRecord
+        {
+            Aws::String partitionKey;
+            /**
+             * Empty when the record is mapped to a shard by its partition key.
+             */
+            Aws::String explicitHashKey;
+            Aws::Utils::ByteBuffer data;
+        };
+
+        /**
+         * Packs user records into a single Kinesis record, in the aggregation format of the Kinesis Producer Library (KPL):
+         * 4 magic bytes, an AggregatedRecord protocol buffers message, and the MD5 digest of that message.
+         * The KPL, the Kinesis Client Library and Lambda event sources deaggregate these records transparently,
+         * other consumers can use Deaggregate. Partition keys and explicit hash keys are stored once per aggregated record
+         * and referred to by index, so records sharing keys cost little more than their data.
+         */
+        class AWS_KINESIS_PRODUCER_API RecordAggregator
+        {
+        public:
+            RecordAggregator();
+
+            inline size_t GetRecordCount() const { return m_recordCount; }
+            inline bool IsEmpty() const { return m_recordCount == 0; }
+
+            /**
+             * Size of the data Serialize() returns.
+             */
+            size_t GetSize() const;
+
+            /**
+             * Size of the data Serialize() would return once a record with these keys and dataLength bytes of data is added.
+             */
+            size_t GetSizeWith(const Aws::String& partitionKey, const Aws::String& explicitHashKey, size_t dataLength) const;
+
+            /**
+             * Adds a record, explicitHashKey is empty when the record doesn't have one.
+             */
+            void Add(const Aws::String& partitionKey, const Aws::String& explicitHashKey, const unsigned char* data, size_t length);
+
+            /**
+             * Partition key of the first record added, which the aggregated record is put with.
+             */
+            inline const Aws::String& GetPartitionKey() const { return m_firstPartitionKey; }
+
+            /**
+             * Returns the aggregated record.
+             */
+            Aws::Utils::ByteBuffer Serialize() const;
+
+            /**
+             * Removes all records.
+             */
+            void Clear();
+
+            /**
+             * Whether data starts with the magic bytes of aggregated records.
+             */
+            static bool IsAggregated(const unsigned char* data, size_t length);
+
+            /**
+             * Extracts the user records of an aggregated record into records.
+             * Returns false if data isn't a well formed aggregated record or its digest doesn't match.
+             */
+            static bool Deaggregate(const unsigned char* data, size_t length, Aws::Vector<UserRecord>& records);
+
+        private:
+            uint64_t GetKeyIndex(const Aws::String& key, Aws::Map<Aws::String, uint64_t>& indices, Aws::String& table, unsigned char fieldTag);
+
+            // Protocol buffers encoding of the repeated fields of the AggregatedRecord message, appended to as records are added.
+            Aws::String m_partitionKeyTable;
+            Aws::String m_explicitHashKeyTable;
+            Aws::String m_records;
+            Aws::Map<Aws::String, uint64_t> m_partitionKeyIndices;
+            Aws::Map<Aws::String, uint64_t> m_explicitHashKeyIndices;
+            Aws::String m_firstPartitionKey;
+            size_t m_recordCount;
+        };
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/kinesis-producer/KinesisProducer_EXPORTS.h>
+#include <aws/kinesis-producer/HashKey.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Kinesis
+    {
+        class KinesisClient;
+    }
+
+    namespace KinesisProducer
+    {
+        /**
+         * Cached map of the hash key ranges of the open shards of a stream, loaded with ListShards.
+         * Lets the producer predict the shard a record goes to, to aggregate and rate limit records per shard.
+         * Predictions are wrong after the stream was resharded, until the map is refreshed.
+         */
+        class AWS_KINESIS_PRODUCER_API ShardMap
+        {
+        public:
+            ShardMap(const std::shared_ptr<Aws::Kinesis::KinesisClient>& kinesisClient, const Aws::String& streamName);
+
+            /**
+             * Reloads the map, going through all the pages of ListShards. Blocks on the calls.
+             * Returns false if a call failed, the previous map is kept then.
+             */
+            bool Refresh();
+
+            /**
+             * Sets shardId to the id of the open shard owning hashKey.
+             * Returns false if the map wasn't loaded yet, or no open shard owns hashKey.
+             */
+            bool PredictShard(const HashKey& hashKey, Aws::String& shardId) const;
+
+            /**
+             * Whether the map was loaded at least once.
+             */
+            bool IsLoaded() const;
+
+            size_t GetShardCount() const;
+
+        private:
+            struct ShardRange
+            {
+                HashKey startingHashKey;
+                HashKey endingHashKey;
+                Aws::String shardId;
+            };
+
+            std::shared_ptr<Aws::Kinesis::KinesisClient> m_kinesisClient;
+            Aws::String m_streamName;
+            // Open shards, sorted by ending hash key.
+            Aws::Vector<ShardRange> m_shards;
+            bool m_loaded;
+            mutable Aws::Utils::Threading::ReaderWriterLock m_shardsLock;
+        };
+    }
+}
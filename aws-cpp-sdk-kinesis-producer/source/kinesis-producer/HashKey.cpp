@@ -0,0 +1,91 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/kinesis-producer/HashKey.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Array.h>
+
+#include <algorithm>
+
+using namespace Aws::KinesisProducer;
+using namespace Aws::Utils;
+
+// Decimal conversions work on 32 bit limbs, least significant first, so that products and remainders fit in 64 bits.
+static const size_t LIMB_COUNT = 4;
+
+static void ToLimbs(const HashKey& hashKey, uint32_t* limbs)
+{
+    limbs[0] = static_cast<uint32_t>(hashKey.GetLow());
+    limbs[1] = static_cast<uint32_t>(hashKey.GetLow() >> 32);
+    limbs[2] = static_cast<uint32_t>(hashKey.GetHigh());
+    limbs[3] = static_cast<uint32_t>(hashKey.GetHigh() >> 32);
+}
+
+HashKey HashKey::FromPartitionKey(const Aws::String& partitionKey)
+{
+    ByteBuffer digest = HashingUtils::CalculateMD5(partitionKey);
+    uint64_t high = 0;
+    uint64_t low = 0;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        high = (high << 8) | digest[i];
+        low = (low << 8) | digest[i + 8];
+    }
+    return HashKey(high, low);
+}
+
+bool HashKey::FromDecimalString(const Aws::String& value, HashKey& hashKey)
+{
+    if (value.empty())
+    {
+        return false;
+    }
+
+    uint32_t limbs[LIMB_COUNT] = {};
+    for (char c : value)
+    {
+        if (c < '0' || c > '9')
+        {
+            return false;
+        }
+
+        uint64_t carry = static_cast<uint64_t>(c - '0');
+        for (size_t i = 0; i < LIMB_COUNT; ++i)
+        {
+            uint64_t limb = static_cast<uint64_t>(limbs[i]) * 10 + carry;
+            limbs[i] = static_cast<uint32_t>(limb);
+            carry = limb >> 32;
+        }
+        if (carry != 0)
+        {
+            return false;
+        }
+    }
+
+    hashKey = HashKey((static_cast<uint64_t>(limbs[3]) << 32) | limbs[2], (static_cast<uint64_t>(limbs[1]) << 32) | limbs[0]);
+    return true;
+}
+
+Aws::String HashKey::ToDecimalString() const
+{
+    uint32_t limbs[LIMB_COUNT];
+    ToLimbs(*this, limbs);
+
+    Aws::String digits;
+    do
+    {
+        uint64_t remainder = 0;
+        for (size_t i = LIMB_COUNT; i > 0; --i)
+        {
+            uint64_t limb = (remainder << 32) | limbs[i - 1];
+            limbs[i - 1] = static_cast<uint32_t>(limb / 10);
+            remainder = limb % 10;
+        }
+        digits.push_back(static_cast<char>('0' + remainder));
+    } while (limbs[0] != 0 || limbs[1] != 0 || limbs[2] != 0 || limbs[3] != 0);
+
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
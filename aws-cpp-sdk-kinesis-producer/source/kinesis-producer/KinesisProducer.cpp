@@ -0,0 +1,629 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/kinesis-producer/KinesisProducer.h>
+#include <aws/kinesis-producer/RecordAggregator.h>
+#include <aws/kinesis/model/PutRecordsRequest.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/ratelimiter/DefaultRateLimiter.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+using namespace Aws::KinesisProducer;
+using namespace Aws::Kinesis;
+using namespace Aws::Utils;
+
+static const char* KINESIS_PRODUCER_TAG = "KinesisProducer";
+
+// Service limits.
+static const size_t MAX_PARTITION_KEY_LENGTH = 256;
+static const size_t MAX_RECORD_SIZE = 1024 * 1024;
+static const int64_t SHARD_RECORDS_PER_SECOND = 1000;
+static const int64_t SHARD_BYTES_PER_SECOND = 1024 * 1024;
+static const char* PROVISIONED_THROUGHPUT_EXCEEDED = "ProvisionedThroughputExceededException";
+// Backoff of the records retried after failing, doubling with every attempt.
+static const int64_t MIN_RETRY_DELAY_MS = 100;
+static const int64_t MAX_RETRY_DELAY_MS = 2000;
+// Reloads of the shard map requested by mispredictions, or retried after failing, are at least this far apart.
+static const int64_t MIN_SHARD_MAP_REFRESH_INTERVAL_MS = 1000;
+static const int64_t NEVER = (std::numeric_limits<int64_t>::max)();
+
+static int64_t NowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct KinesisProducer::PendingUserRecord
+{
+    Aws::String partitionKey;
+    std::shared_ptr<const Aws::Client::AsyncCallerContext> context;
+};
+
+/**
+ * Entry of a PutRecords call, holding one user record, or several aggregated ones.
+ */
+struct KinesisProducer::KinesisRecord
+{
+    KinesisRecord() : arrivalMs(0), deadlineMs(0), notBeforeMs(0), size(0), attempts(0), aggregated(false) {}
+
+    Model::PutRecordsRequestEntry entry;
+    Aws::Vector<PendingUserRecord> userRecords;
+    // Hash key the record is mapped to shards with, to predict its shard again when it is retried.
+    HashKey hashKey;
+    Aws::String predictedShardId;
+    // Time the oldest of its user records was added, and the time they expire at.
+    int64_t arrivalMs;
+    int64_t deadlineMs;
+    // Retried records are held back until then.
+    int64_t notBeforeMs;
+    // Size of the data and the partition key, as counted against the limits of Kinesis.
+    size_t size;
+    int attempts;
+    bool aggregated;
+};
+
+/**
+ * Records predicted to go to a shard: the aggregate being filled, and the Kinesis records ready to be sent,
+ * along with the token buckets limiting the records and bytes sent to the shard per second.
+ * Records whose shard can't be predicted are queued under an empty shard id, they aren't aggregated nor rate limited.
+ */
+struct KinesisProducer::ShardQueue
+{
+    ShardQueue(const Aws::String& shardId, int64_t recordsPerSecond, int64_t bytesPerSecond) :
+        shardId(shardId),
+        aggregateArrivalMs(0),
+        recordsPerSecond(recordsPerSecond),
+        bytesPerSecond(bytesPerSecond),
+        recordLimiter(recordsPerSecond),
+        byteLimiter(bytesPerSecond)
+    {
+    }
+
+    Aws::String shardId;
+    RecordAggregator aggregator;
+    Aws::Vector<PendingUserRecord> aggregatedUserRecords;
+    // Data of the first user record of the aggregate, sent as is if no other record joins it.
+    Aws::Utils::ByteBuffer firstUserRecordData;
+    Aws::String firstExplicitHashKey;
+    HashKey aggregateHashKey;
+    int64_t aggregateArrivalMs;
+    Aws::Deque<std::shared_ptr<KinesisRecord>> readyRecords;
+    int64_t recordsPerSecond;
+    int64_t bytesPerSecond;
+    RateLimits::DefaultRateLimiter<> recordLimiter;
+    RateLimits::DefaultRateLimiter<> byteLimiter;
+};
+
+KinesisProducer::KinesisProducer(const KinesisProducerConfiguration& configuration) :
+    m_configuration(configuration),
+    m_shardMap(configuration.kinesisClient, configuration.streamName),
+    m_readyRecordCount(0),
+    m_readySize(0),
+    m_outstandingRequests(0),
+    m_producerWakeUpMs(0),
+    m_lastShardMapRefreshMs(0),
+    m_nextShardMapRefreshMs(0),
+    m_flushRequested(false),
+    m_stopping(false),
+    m_startMs(NowMs())
+{
+    m_configuration.collectionMaxCount = (std::max)(m_configuration.collectionMaxCount, static_cast<size_t>(1));
+    m_configuration.maxOutstandingRequests = (std::max)(m_configuration.maxOutstandingRequests, static_cast<size_t>(1));
+    m_configuration.rateLimit = (std::max)(m_configuration.rateLimit, 1u);
+    m_producerThread = std::thread(&KinesisProducer::ProducerThread, this);
+}
+
+KinesisProducer::~KinesisProducer()
+{
+    FlushSync();
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_stopping = true;
+    }
+    m_producerSignal.notify_one();
+    if (m_producerThread.joinable())
+    {
+        m_producerThread.join();
+    }
+}
+
+bool KinesisProducer::AddUserRecord(const Aws::String& partitionKey, const ByteBuffer& data,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    return AddUserRecord(partitionKey, Aws::String(), data.GetUnderlyingData(), data.GetLength(), context);
+}
+
+bool KinesisProducer::AddUserRecord(const Aws::String& partitionKey, const Aws::String& explicitHashKey, const unsigned char* data, size_t length,
+    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+{
+    if (partitionKey.empty() || partitionKey.size() > MAX_PARTITION_KEY_LENGTH || length > MAX_RECORD_SIZE - partitionKey.size())
+    {
+        AWS_LOGSTREAM_ERROR(KINESIS_PRODUCER_TAG, "Rejected user record with a partition key of " << partitionKey.size()
+            << " characters and " << length << " bytes of data.");
+        return false;
+    }
+
+    HashKey hashKey;
+    if (explicitHashKey.empty())
+    {
+        hashKey = HashKey::FromPartitionKey(partitionKey);
+    }
+    else if (!HashKey::FromDecimalString(explicitHashKey, hashKey))
+    {
+        AWS_LOGSTREAM_ERROR(KINESIS_PRODUCER_TAG, "Rejected user record with invalid explicit hash key " << explicitHashKey);
+        return false;
+    }
+
+    Aws::String shardId;
+    m_shardMap.PredictShard(hashKey, shardId);
+    int64_t nowMs = NowMs();
+    PendingUserRecord userRecord;
+    userRecord.partitionKey = partitionKey;
+    userRecord.context = context;
+
+    bool wakeUpProducer = false;
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        ++m_metrics.userRecordsReceived;
+        ++m_metrics.userRecordsPending;
+        ShardQueue& shardQueue = GetShardQueue(shardId);
+
+        bool aggregate = m_configuration.aggregationEnabled && !shardId.empty();
+        if (aggregate && !shardQueue.aggregator.IsEmpty() &&
+            (shardQueue.aggregator.GetRecordCount() >= m_configuration.aggregationMaxCount ||
+             shardQueue.aggregator.GetSizeWith(partitionKey, explicitHashKey, length) + shardQueue.aggregator.GetPartitionKey().size() > m_configuration.aggregationMaxSize))
+        {
+            CloseAggregate(shardQueue);
+        }
+
+        if (aggregate && RecordAggregator().GetSizeWith(partitionKey, explicitHashKey, length) + partitionKey.size() <= m_configuration.aggregationMaxSize)
+        {
+            if (shardQueue.aggregator.IsEmpty())
+            {
+                shardQueue.firstUserRecordData = ByteBuffer(data, length);
+                shardQueue.firstExplicitHashKey = explicitHashKey;
+                shardQueue.aggregateHashKey = hashKey;
+                shardQueue.aggregateArrivalMs = nowMs;
+                wakeUpProducer = nowMs + m_configuration.recordMaxBufferedTimeMs < m_producerWakeUpMs;
+            }
+            else
+            {
+                shardQueue.firstUserRecordData = ByteBuffer();
+            }
+            shardQueue.aggregator.Add(partitionKey, explicitHashKey, data, length);
+            shardQueue.aggregatedUserRecords.push_back(std::move(userRecord));
+        }
+        else
+        {
+            auto record = Aws::MakeShared<KinesisRecord>(KINESIS_PRODUCER_TAG);
+            record->entry.SetPartitionKey(partitionKey);
+            if (!explicitHashKey.empty())
+            {
+                record->entry.SetExplicitHashKey(explicitHashKey);
+            }
+            record->entry.SetData(ByteBuffer(data, length));
+            record->userRecords.push_back(std::move(userRecord));
+            record->hashKey = hashKey;
+            record->predictedShardId = shardId;
+            record->arrivalMs = nowMs;
+            record->deadlineMs = nowMs + m_configuration.recordTtlMs;
+            record->size = partitionKey.size() + length;
+            EnqueueRecord(shardQueue, record, false /*retry*/);
+            wakeUpProducer = nowMs + m_configuration.recordMaxBufferedTimeMs < m_producerWakeUpMs;
+        }
+
+        wakeUpProducer = wakeUpProducer || m_readyRecordCount >= m_configuration.collectionMaxCount || m_readySize >= m_configuration.collectionMaxSize;
+    }
+
+    if (wakeUpProducer)
+    {
+        m_producerSignal.notify_one();
+    }
+    return true;
+}
+
+void KinesisProducer::Flush()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_flushRequested = true;
+    }
+    m_producerSignal.notify_one();
+}
+
+void KinesisProducer::FlushSync()
+{
+    Flush();
+    std::unique_lock<std::mutex> locker(m_mutex);
+    m_completionSignal.wait(locker, [this] { return m_metrics.userRecordsPending == 0 && m_outstandingRequests == 0; });
+}
+
+KinesisProducerMetrics KinesisProducer::GetMetrics() const
+{
+    std::lock_guard<std::mutex> locker(m_mutex);
+    KinesisProducerMetrics metrics = m_metrics;
+    metrics.uptimeMs = NowMs() - m_startMs;
+    return metrics;
+}
+
+KinesisProducer::ShardQueue& KinesisProducer::GetShardQueue(const Aws::String& shardId)
+{
+    auto shardQueue = m_shardQueues.find(shardId);
+    if (shardQueue == m_shardQueues.end())
+    {
+        int64_t recordsPerSecond = (std::max)(SHARD_RECORDS_PER_SECOND * m_configuration.rateLimit / 100, static_cast<int64_t>(1));
+        int64_t bytesPerSecond = (std::max)(SHARD_BYTES_PER_SECOND * m_configuration.rateLimit / 100, static_cast<int64_t>(1));
+        shardQueue = m_shardQueues.emplace(shardId, Aws::MakeShared<ShardQueue>(KINESIS_PRODUCER_TAG, shardId, recordsPerSecond, bytesPerSecond)).first;
+    }
+    return *shardQueue->second;
+}
+
+void KinesisProducer::EnqueueRecord(ShardQueue& shardQueue, const std::shared_ptr<KinesisRecord>& record, bool retry)
+{
+    // Retried records are older than the others, they go first.
+    if (retry)
+    {
+        shardQueue.readyRecords.push_front(record);
+    }
+    else
+    {
+        shardQueue.readyRecords.push_back(record);
+    }
+    ++m_readyRecordCount;
+    m_readySize += record->size;
+}
+
+void KinesisProducer::CloseAggregate(ShardQueue& shardQueue)
+{
+    auto record = Aws::MakeShared<KinesisRecord>(KINESIS_PRODUCER_TAG);
+    if (shardQueue.aggregator.GetRecordCount() == 1)
+    {
+        record->entry.SetPartitionKey(shardQueue.aggregator.GetPartitionKey());
+        if (!shardQueue.firstExplicitHashKey.empty())
+        {
+            record->entry.SetExplicitHashKey(shardQueue.firstExplicitHashKey);
+        }
+        record->entry.SetData(std::move(shardQueue.firstUserRecordData));
+    }
+    else
+    {
+        // The aggregated record is put with the hash key of its first user record, so that it goes to the shard all of them were predicted to.
+        record->entry.SetPartitionKey(shardQueue.aggregator.GetPartitionKey());
+        record->entry.SetExplicitHashKey(shardQueue.aggregateHashKey.ToDecimalString());
+        record->entry.SetData(shardQueue.aggregator.Serialize());
+        record->aggregated = true;
+    }
+
+    record->userRecords.swap(shardQueue.aggregatedUserRecords);
+    record->hashKey = shardQueue.aggregateHashKey;
+    record->predictedShardId = shardQueue.shardId;
+    record->arrivalMs = shardQueue.aggregateArrivalMs;
+    record->deadlineMs = shardQueue.aggregateArrivalMs + m_configuration.recordTtlMs;
+    record->size = record->entry.GetPartitionKey().size() + record->entry.GetData().GetLength();
+
+    shardQueue.aggregator.Clear();
+    shardQueue.aggregatedUserRecords.clear();
+    shardQueue.firstUserRecordData = ByteBuffer();
+    shardQueue.firstExplicitHashKey.clear();
+    EnqueueRecord(shardQueue, record, false /*retry*/);
+}
+
+void KinesisProducer::ProducerThread()
+{
+    std::unique_lock<std::mutex> locker(m_mutex);
+    while (!m_stopping)
+    {
+        int64_t nowMs = NowMs();
+        if (nowMs >= m_nextShardMapRefreshMs)
+        {
+            locker.unlock();
+            RefreshShardMap();
+            locker.lock();
+            continue;
+        }
+
+        Aws::Vector<std::shared_ptr<RecordBatch>> batches;
+        Aws::Vector<UserRecordResult> results;
+        int64_t wakeUpMs = CollectBatches(nowMs, batches, results);
+        if (!batches.empty() || !results.empty())
+        {
+            m_outstandingRequests += batches.size();
+            locker.unlock();
+            for (const auto& batch : batches)
+            {
+                SendBatch(batch);
+            }
+            DeliverResults(results);
+            locker.lock();
+            m_metrics.userRecordsPending -= results.size();
+            m_completionSignal.notify_all();
+            continue;
+        }
+
+        m_producerWakeUpMs = (std::min)(wakeUpMs, m_nextShardMapRefreshMs);
+        m_producerSignal.wait_for(locker, std::chrono::milliseconds(m_producerWakeUpMs - nowMs));
+        m_producerWakeUpMs = 0;
+    }
+}
+
+void KinesisProducer::RefreshShardMap()
+{
+    bool refreshed = m_shardMap.Refresh();
+    int64_t nowMs = NowMs();
+
+    std::lock_guard<std::mutex> locker(m_mutex);
+    if (refreshed)
+    {
+        ++m_metrics.shardMapRefreshes;
+    }
+    m_lastShardMapRefreshMs = nowMs;
+    m_nextShardMapRefreshMs = nowMs + (refreshed ? (std::max)(static_cast<int64_t>(m_configuration.shardMapRefreshIntervalMs), MIN_SHARD_MAP_REFRESH_INTERVAL_MS)
+        : MIN_SHARD_MAP_REFRESH_INTERVAL_MS);
+}
+
+int64_t KinesisProducer::CollectBatches(int64_t nowMs, Aws::Vector<std::shared_ptr<RecordBatch>>& batches, Aws::Vector<UserRecordResult>& results)
+{
+    int64_t wakeUpMs = NEVER;
+    for (auto& shardQueueEntry : m_shardQueues)
+    {
+        ShardQueue& shardQueue = *shardQueueEntry.second;
+        if (shardQueue.aggregator.IsEmpty())
+        {
+            continue;
+        }
+        int64_t dueMs = shardQueue.aggregateArrivalMs + m_configuration.recordMaxBufferedTimeMs;
+        if (m_flushRequested || dueMs <= nowMs)
+        {
+            CloseAggregate(shardQueue);
+        }
+        else
+        {
+            wakeUpMs = (std::min)(wakeUpMs, dueMs);
+        }
+    }
+
+    // Once a record is due, or there are enough records for a full PutRecords call, every record that can be sent is.
+    bool sendAll = m_flushRequested || m_readyRecordCount >= m_configuration.collectionMaxCount || m_readySize >= m_configuration.collectionMaxSize;
+    int64_t nextDueMs = NEVER;
+    for (const auto& shardQueueEntry : m_shardQueues)
+    {
+        for (const auto& record : shardQueueEntry.second->readyRecords)
+        {
+            // Retried records already waited to be batched, they are due once their backoff elapsed.
+            nextDueMs = (std::min)(nextDueMs, record->attempts > 0 ? record->notBeforeMs : record->arrivalMs + m_configuration.recordMaxBufferedTimeMs);
+        }
+    }
+    if (!sendAll && nextDueMs > nowMs)
+    {
+        return (std::min)(wakeUpMs, nextDueMs);
+    }
+
+    std::shared_ptr<RecordBatch> batch;
+    size_t batchSize = 0;
+    for (auto& shardQueueEntry : m_shardQueues)
+    {
+        ShardQueue& shardQueue = *shardQueueEntry.second;
+        if (shardQueue.readyRecords.empty())
+        {
+            continue;
+        }
+
+        bool rateLimited = !shardQueue.shardId.empty();
+        if (rateLimited)
+        {
+            int64_t delayMs = (std::max)(shardQueue.recordLimiter.ApplyCost(0).count(), shardQueue.byteLimiter.ApplyCost(0).count());
+            if (delayMs > 0)
+            {
+                ++m_metrics.rateLimitedShardDelays;
+                wakeUpMs = (std::min)(wakeUpMs, nowMs + delayMs);
+                continue;
+            }
+        }
+
+        // A shard gets at most a second worth of its throughput per pass, the token buckets then hold it back for that second.
+        int64_t sentRecords = 0;
+        int64_t sentBytes = 0;
+        Aws::Deque<std::shared_ptr<KinesisRecord>> heldRecords;
+        while (!shardQueue.readyRecords.empty())
+        {
+            std::shared_ptr<KinesisRecord> record = shardQueue.readyRecords.front();
+            shardQueue.readyRecords.pop_front();
+
+            if (nowMs >= record->deadlineMs)
+            {
+                --m_readyRecordCount;
+                m_readySize -= record->size;
+                Fail(*record, "Expired", "The record expired before it could be put.", results);
+                continue;
+            }
+
+            bool budgetExhausted = rateLimited && sentRecords > 0 &&
+                (sentRecords >= shardQueue.recordsPerSecond || sentBytes + static_cast<int64_t>(record->size) > shardQueue.bytesPerSecond);
+            if (record->notBeforeMs > nowMs || budgetExhausted)
+            {
+                wakeUpMs = (std::min)(wakeUpMs, (std::max)(record->notBeforeMs, nowMs));
+                heldRecords.push_back(record);
+                continue;
+            }
+
+            if (!batch || batch->size() >= m_configuration.collectionMaxCount || batchSize + record->size > m_configuration.collectionMaxSize)
+            {
+                if (m_outstandingRequests + batches.size() >= m_configuration.maxOutstandingRequests)
+                {
+                    // The next pass follows the completion of a call.
+                    heldRecords.push_back(record);
+                    continue;
+                }
+                batch = Aws::MakeShared<RecordBatch>(KINESIS_PRODUCER_TAG);
+                batchSize = 0;
+                batches.push_back(batch);
+            }
+
+            ++record->attempts;
+            batch->push_back(record);
+            batchSize += record->size;
+            --m_readyRecordCount;
+            m_readySize -= record->size;
+            ++sentRecords;
+            sentBytes += record->size;
+        }
+        shardQueue.readyRecords.swap(heldRecords);
+
+        if (rateLimited && sentRecords > 0)
+        {
+            shardQueue.recordLimiter.ApplyCost(sentRecords);
+            shardQueue.byteLimiter.ApplyCost(sentBytes);
+        }
+    }
+
+    m_metrics.putRecordsRequests += batches.size();
+    if (m_flushRequested && m_readyRecordCount == 0)
+    {
+        m_flushRequested = false;
+    }
+    return wakeUpMs;
+}
+
+void KinesisProducer::SendBatch(const std::shared_ptr<RecordBatch>& batch)
+{
+    Model::PutRecordsRequest request;
+    request.SetStreamName(m_configuration.streamName);
+    for (const auto& record : *batch)
+    {
+        request.AddRecords(record->entry);
+    }
+
+    m_configuration.kinesisClient->PutRecordsAsync(request,
+        [this, batch](const KinesisClient*, const Model::PutRecordsRequest&, const Model::PutRecordsOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+        {
+            OnPutRecordsOutcome(*batch, outcome);
+        });
+}
+
+void KinesisProducer::OnPutRecordsOutcome(const RecordBatch& batch, const Model::PutRecordsOutcome& outcome)
+{
+    Aws::Vector<UserRecordResult> results;
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        int64_t nowMs = NowMs();
+        if (!outcome.IsSuccess())
+        {
+            const auto& error = outcome.GetError();
+            AWS_LOGSTREAM_WARN(KINESIS_PRODUCER_TAG, "PutRecords call with " << batch.size() << " records failed: "
+                << error.GetExceptionName() << " " << error.GetMessage());
+            ++m_metrics.putRecordsRequestsFailed;
+            for (const auto& record : batch)
+            {
+                RetryOrFail(record, error.GetExceptionName(), error.GetMessage(), error.ShouldRetry(), nowMs, results);
+            }
+        }
+        else
+        {
+            // Results are in the order of the records of the request, only the failed records are retried.
+            const auto& entries = outcome.GetResult().GetRecords();
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                const std::shared_ptr<KinesisRecord>& record = batch[i];
+                if (i >= entries.size())
+                {
+                    RetryOrFail(record, "MissingResult", "PutRecords didn't return a result for the record.", true /*retryable*/, nowMs, results);
+                    continue;
+                }
+
+                const auto& entry = entries[i];
+                if (!entry.GetErrorCode().empty())
+                {
+                    if (entry.GetErrorCode() == PROVISIONED_THROUGHPUT_EXCEEDED)
+                    {
+                        ++m_metrics.kinesisRecordsThrottled;
+                    }
+                    RetryOrFail(record, entry.GetErrorCode(), entry.GetErrorMessage(), true /*retryable*/, nowMs, results);
+                    continue;
+                }
+
+                if (!record->predictedShardId.empty() && record->predictedShardId != entry.GetShardId())
+                {
+                    ++m_metrics.shardMispredictions;
+                    m_nextShardMapRefreshMs = (std::min)(m_nextShardMapRefreshMs, m_lastShardMapRefreshMs + MIN_SHARD_MAP_REFRESH_INTERVAL_MS);
+                }
+
+                ++m_metrics.kinesisRecordsPut;
+                m_metrics.bytesPut += record->size;
+                m_metrics.userRecordsPut += record->userRecords.size();
+                for (size_t j = 0; j < record->userRecords.size(); ++j)
+                {
+                    UserRecordResult result;
+                    result.successful = true;
+                    result.partitionKey = record->userRecords[j].partitionKey;
+                    result.shardId = entry.GetShardId();
+                    result.sequenceNumber = entry.GetSequenceNumber();
+                    result.subSequenceNumber = record->aggregated ? j : 0;
+                    result.attempts = record->attempts;
+                    result.context = record->userRecords[j].context;
+                    results.push_back(std::move(result));
+                }
+            }
+        }
+    }
+
+    DeliverResults(results);
+
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_metrics.userRecordsPending -= results.size();
+    --m_outstandingRequests;
+    // Notified under the lock: once the last call completed, the producer can be destroyed as soon as the lock is released.
+    m_producerSignal.notify_one();
+    m_completionSignal.notify_all();
+}
+
+void KinesisProducer::RetryOrFail(const std::shared_ptr<KinesisRecord>& record, const Aws::String& errorCode, const Aws::String& errorMessage,
+    bool retryable, int64_t nowMs, Aws::Vector<UserRecordResult>& results)
+{
+    int64_t delayMs = (std::min)(MAX_RETRY_DELAY_MS, MIN_RETRY_DELAY_MS << (std::min)(record->attempts - 1, 5));
+    if (!retryable || nowMs + delayMs >= record->deadlineMs)
+    {
+        Fail(*record, errorCode, errorMessage, results);
+        return;
+    }
+
+    ++m_metrics.kinesisRecordsRetried;
+    record->notBeforeMs = nowMs + delayMs;
+    // The shard map may have been refreshed since the record was first queued.
+    Aws::String shardId;
+    m_shardMap.PredictShard(record->hashKey, shardId);
+    record->predictedShardId = shardId;
+    EnqueueRecord(GetShardQueue(shardId), record, true /*retry*/);
+}
+
+void KinesisProducer::Fail(const KinesisRecord& record, const Aws::String& errorCode, const Aws::String& errorMessage, Aws::Vector<UserRecordResult>& results)
+{
+    m_metrics.userRecordsFailed += record.userRecords.size();
+    for (const auto& userRecord : record.userRecords)
+    {
+        UserRecordResult result;
+        result.partitionKey = userRecord.partitionKey;
+        result.errorCode = errorCode;
+        result.errorMessage = errorMessage;
+        result.attempts = record.attempts;
+        result.context = userRecord.context;
+        results.push_back(std::move(result));
+    }
+}
+
+void KinesisProducer::DeliverResults(const Aws::Vector<UserRecordResult>& results) const
+{
+    if (m_configuration.userRecordResultCallback)
+    {
+        for (const auto& result : results)
+        {
+            m_configuration.userRecordResultCallback(this, result);
+        }
+    }
+}
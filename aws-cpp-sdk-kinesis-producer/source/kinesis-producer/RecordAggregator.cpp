@@ -0,0 +1,359 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/kinesis-producer/RecordAggregator.h>
+#include <aws/core/utils/HashingUtils.h>
+
+#include <cstring>
+
+using namespace Aws::KinesisProducer;
+using namespace Aws::Utils;
+
+static const unsigned char AGGREGATED_RECORD_MAGIC[] = { 0xF3, 0x89, 0x9A, 0xC2 };
+static const size_t MAGIC_LENGTH = sizeof(AGGREGATED_RECORD_MAGIC);
+static const size_t DIGEST_LENGTH = 16;
+
+// Protocol buffers wire types.
+static const unsigned VARINT_WIRE_TYPE = 0;
+static const unsigned FIXED64_WIRE_TYPE = 1;
+static const unsigned LENGTH_DELIMITED_WIRE_TYPE = 2;
+static const unsigned FIXED32_WIRE_TYPE = 5;
+
+// Fields of the AggregatedRecord message.
+static const unsigned PARTITION_KEY_TABLE_FIELD = 1;
+static const unsigned EXPLICIT_HASH_KEY_TABLE_FIELD = 2;
+static const unsigned RECORDS_FIELD = 3;
+// Fields of the Record message.
+static const unsigned PARTITION_KEY_INDEX_FIELD = 1;
+static const unsigned EXPLICIT_HASH_KEY_INDEX_FIELD = 2;
+static const unsigned DATA_FIELD = 3;
+
+static unsigned char MakeTag(unsigned field, unsigned wireType)
+{
+    return static_cast<unsigned char>((field << 3) | wireType);
+}
+
+static size_t GetVarintLength(uint64_t value)
+{
+    size_t length = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        ++length;
+    }
+    return length;
+}
+
+static void AppendVarint(Aws::String& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+static bool ReadVarint(const unsigned char*& position, const unsigned char* end, uint64_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64 && position < end; shift += 7)
+    {
+        unsigned char byte = *position++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ReadLengthDelimited(const unsigned char*& position, const unsigned char* end, const unsigned char*& field, size_t& length)
+{
+    uint64_t fieldLength = 0;
+    if (!ReadVarint(position, end, fieldLength) || fieldLength > static_cast<uint64_t>(end - position))
+    {
+        return false;
+    }
+    field = position;
+    length = static_cast<size_t>(fieldLength);
+    position += length;
+    return true;
+}
+
+static bool SkipField(const unsigned char*& position, const unsigned char* end, unsigned wireType)
+{
+    uint64_t value = 0;
+    const unsigned char* field = nullptr;
+    size_t length = 0;
+    switch (wireType)
+    {
+    case VARINT_WIRE_TYPE:
+        return ReadVarint(position, end, value);
+    case LENGTH_DELIMITED_WIRE_TYPE:
+        return ReadLengthDelimited(position, end, field, length);
+    case FIXED64_WIRE_TYPE:
+    case FIXED32_WIRE_TYPE:
+        length = wireType == FIXED64_WIRE_TYPE ? 8 : 4;
+        if (length > static_cast<size_t>(end - position))
+        {
+            return false;
+        }
+        position += length;
+        return true;
+    default:
+        return false;
+    }
+}
+
+static size_t GetKeyTableEntrySize(const Aws::String& key)
+{
+    return 1 + GetVarintLength(key.size()) + key.size();
+}
+
+static size_t GetRecordMessageSize(uint64_t partitionKeyIndex, bool hasExplicitHashKey, uint64_t explicitHashKeyIndex, size_t dataLength)
+{
+    size_t size = 1 + GetVarintLength(partitionKeyIndex) + 1 + GetVarintLength(dataLength) + dataLength;
+    if (hasExplicitHashKey)
+    {
+        size += 1 + GetVarintLength(explicitHashKeyIndex);
+    }
+    return size;
+}
+
+static bool ParseRecord(const unsigned char* position, const unsigned char* end, const Aws::Vector<Aws::String>& partitionKeys,
+    const Aws::Vector<Aws::String>& explicitHashKeys, UserRecord& record)
+{
+    bool hasPartitionKey = false;
+    bool hasData = false;
+    while (position < end)
+    {
+        uint64_t tag = 0;
+        if (!ReadVarint(position, end, tag))
+        {
+            return false;
+        }
+
+        unsigned field = static_cast<unsigned>(tag >> 3);
+        unsigned wireType = static_cast<unsigned>(tag & 0x7);
+        uint64_t index = 0;
+        if ((field == PARTITION_KEY_INDEX_FIELD || field == EXPLICIT_HASH_KEY_INDEX_FIELD) && wireType == VARINT_WIRE_TYPE)
+        {
+            const Aws::Vector<Aws::String>& table = field == PARTITION_KEY_INDEX_FIELD ? partitionKeys : explicitHashKeys;
+            if (!ReadVarint(position, end, index) || index >= table.size())
+            {
+                return false;
+            }
+            (field == PARTITION_KEY_INDEX_FIELD ? record.partitionKey : record.explicitHashKey) = table[static_cast<size_t>(index)];
+            hasPartitionKey = hasPartitionKey || field == PARTITION_KEY_INDEX_FIELD;
+        }
+        else if (field == DATA_FIELD && wireType == LENGTH_DELIMITED_WIRE_TYPE)
+        {
+            const unsigned char* data = nullptr;
+            size_t length = 0;
+            if (!ReadLengthDelimited(position, end, data, length))
+            {
+                return false;
+            }
+            record.data = ByteBuffer(data, length);
+            hasData = true;
+        }
+        else if (!SkipField(position, end, wireType))
+        {
+            // Unknown fields, such as the tags of the record, are skipped.
+            return false;
+        }
+    }
+    return hasPartitionKey && hasData;
+}
+
+RecordAggregator::RecordAggregator() :
+    m_recordCount(0)
+{
+}
+
+size_t RecordAggregator::GetSize() const
+{
+    return MAGIC_LENGTH + m_partitionKeyTable.size() + m_explicitHashKeyTable.size() + m_records.size() + DIGEST_LENGTH;
+}
+
+size_t RecordAggregator::GetSizeWith(const Aws::String& partitionKey, const Aws::String& explicitHashKey, size_t dataLength) const
+{
+    size_t size = GetSize();
+
+    uint64_t partitionKeyIndex = m_partitionKeyIndices.size();
+    auto partitionKeyEntry = m_partitionKeyIndices.find(partitionKey);
+    if (partitionKeyEntry == m_partitionKeyIndices.end())
+    {
+        size += GetKeyTableEntrySize(partitionKey);
+    }
+    else
+    {
+        partitionKeyIndex = partitionKeyEntry->second;
+    }
+
+    uint64_t explicitHashKeyIndex = m_explicitHashKeyIndices.size();
+    if (!explicitHashKey.empty())
+    {
+        auto explicitHashKeyEntry = m_explicitHashKeyIndices.find(explicitHashKey);
+        if (explicitHashKeyEntry == m_explicitHashKeyIndices.end())
+        {
+            size += GetKeyTableEntrySize(explicitHashKey);
+        }
+        else
+        {
+            explicitHashKeyIndex = explicitHashKeyEntry->second;
+        }
+    }
+
+    size_t recordSize = GetRecordMessageSize(partitionKeyIndex, !explicitHashKey.empty(), explicitHashKeyIndex, dataLength);
+    return size + 1 + GetVarintLength(recordSize) + recordSize;
+}
+
+void RecordAggregator::Add(const Aws::String& partitionKey, const Aws::String& explicitHashKey, const unsigned char* data, size_t length)
+{
+    if (m_recordCount == 0)
+    {
+        m_firstPartitionKey = partitionKey;
+    }
+
+    uint64_t partitionKeyIndex = GetKeyIndex(partitionKey, m_partitionKeyIndices, m_partitionKeyTable,
+        MakeTag(PARTITION_KEY_TABLE_FIELD, LENGTH_DELIMITED_WIRE_TYPE));
+    uint64_t explicitHashKeyIndex = 0;
+    if (!explicitHashKey.empty())
+    {
+        explicitHashKeyIndex = GetKeyIndex(explicitHashKey, m_explicitHashKeyIndices, m_explicitHashKeyTable,
+            MakeTag(EXPLICIT_HASH_KEY_TABLE_FIELD, LENGTH_DELIMITED_WIRE_TYPE));
+    }
+
+    m_records.push_back(static_cast<char>(MakeTag(RECORDS_FIELD, LENGTH_DELIMITED_WIRE_TYPE)));
+    AppendVarint(m_records, GetRecordMessageSize(partitionKeyIndex, !explicitHashKey.empty(), explicitHashKeyIndex, length));
+    m_records.push_back(static_cast<char>(MakeTag(PARTITION_KEY_INDEX_FIELD, VARINT_WIRE_TYPE)));
+    AppendVarint(m_records, partitionKeyIndex);
+    if (!explicitHashKey.empty())
+    {
+        m_records.push_back(static_cast<char>(MakeTag(EXPLICIT_HASH_KEY_INDEX_FIELD, VARINT_WIRE_TYPE)));
+        AppendVarint(m_records, explicitHashKeyIndex);
+    }
+    m_records.push_back(static_cast<char>(MakeTag(DATA_FIELD, LENGTH_DELIMITED_WIRE_TYPE)));
+    AppendVarint(m_records, length);
+    m_records.append(reinterpret_cast<const char*>(data), length);
+    ++m_recordCount;
+}
+
+uint64_t RecordAggregator::GetKeyIndex(const Aws::String& key, Aws::Map<Aws::String, uint64_t>& indices, Aws::String& table, unsigned char fieldTag)
+{
+    auto entry = indices.find(key);
+    if (entry != indices.end())
+    {
+        return entry->second;
+    }
+
+    uint64_t index = indices.size();
+    indices.emplace(key, index);
+    table.push_back(static_cast<char>(fieldTag));
+    AppendVarint(table, key.size());
+    table.append(key);
+    return index;
+}
+
+ByteBuffer RecordAggregator::Serialize() const
+{
+    // The tables come first, as the KPL writes them, though the fields of a message can be in any order.
+    Aws::String message;
+    message.reserve(m_partitionKeyTable.size() + m_explicitHashKeyTable.size() + m_records.size());
+    message.append(m_partitionKeyTable).append(m_explicitHashKeyTable).append(m_records);
+    ByteBuffer digest = HashingUtils::CalculateMD5(message);
+
+    ByteBuffer record(MAGIC_LENGTH + message.size() + DIGEST_LENGTH);
+    std::memcpy(record.GetUnderlyingData(), AGGREGATED_RECORD_MAGIC, MAGIC_LENGTH);
+    std::memcpy(record.GetUnderlyingData() + MAGIC_LENGTH, message.c_str(), message.size());
+    std::memcpy(record.GetUnderlyingData() + MAGIC_LENGTH + message.size(), digest.GetUnderlyingData(), DIGEST_LENGTH);
+    return record;
+}
+
+void RecordAggregator::Clear()
+{
+    m_partitionKeyTable.clear();
+    m_explicitHashKeyTable.clear();
+    m_records.clear();
+    m_partitionKeyIndices.clear();
+    m_explicitHashKeyIndices.clear();
+    m_firstPartitionKey.clear();
+    m_recordCount = 0;
+}
+
+bool RecordAggregator::IsAggregated(const unsigned char* data, size_t length)
+{
+    return length >= MAGIC_LENGTH + DIGEST_LENGTH && std::memcmp(data, AGGREGATED_RECORD_MAGIC, MAGIC_LENGTH) == 0;
+}
+
+bool RecordAggregator::Deaggregate(const unsigned char* data, size_t length, Aws::Vector<UserRecord>& records)
+{
+    records.clear();
+    if (!IsAggregated(data, length))
+    {
+        return false;
+    }
+
+    const unsigned char* position = data + MAGIC_LENGTH;
+    const unsigned char* end = data + length - DIGEST_LENGTH;
+    ByteBuffer digest = HashingUtils::CalculateMD5(Aws::String(reinterpret_cast<const char*>(position), end - position));
+    if (std::memcmp(digest.GetUnderlyingData(), end, DIGEST_LENGTH) != 0)
+    {
+        return false;
+    }
+
+    // The tables can follow the records, so the records are only resolved once the whole message was read.
+    Aws::Vector<Aws::String> partitionKeys;
+    Aws::Vector<Aws::String> explicitHashKeys;
+    Aws::Vector<std::pair<const unsigned char*, size_t>> recordMessages;
+    while (position < end)
+    {
+        uint64_t tag = 0;
+        if (!ReadVarint(position, end, tag))
+        {
+            return false;
+        }
+
+        unsigned field = static_cast<unsigned>(tag >> 3);
+        unsigned wireType = static_cast<unsigned>(tag & 0x7);
+        if (field >= PARTITION_KEY_TABLE_FIELD && field <= RECORDS_FIELD && wireType == LENGTH_DELIMITED_WIRE_TYPE)
+        {
+            const unsigned char* value = nullptr;
+            size_t valueLength = 0;
+            if (!ReadLengthDelimited(position, end, value, valueLength))
+            {
+                return false;
+            }
+
+            if (field == RECORDS_FIELD)
+            {
+                recordMessages.emplace_back(value, valueLength);
+            }
+            else
+            {
+                (field == PARTITION_KEY_TABLE_FIELD ? partitionKeys : explicitHashKeys).emplace_back(reinterpret_cast<const char*>(value), valueLength);
+            }
+        }
+        else if (!SkipField(position, end, wireType))
+        {
+            return false;
+        }
+    }
+
+    records.resize(recordMessages.size());
+    for (size_t i = 0; i < recordMessages.size(); ++i)
+    {
+        const unsigned char* message = recordMessages[i].first;
+        if (!ParseRecord(message, message + recordMessages[i].second, partitionKeys, explicitHashKeys, records[i]))
+        {
+            records.clear();
+            return false;
+        }
+    }
+    return true;
+}
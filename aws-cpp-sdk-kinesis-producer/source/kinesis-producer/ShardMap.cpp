@@ -0,0 +1,97 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/kinesis-producer/ShardMap.h>
+#include <aws/kinesis/KinesisClient.h>
+#include <aws/kinesis/model/ListShardsRequest.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+
+using namespace Aws::KinesisProducer;
+using namespace Aws::Kinesis;
+using namespace Aws::Utils::Threading;
+
+static const char* SHARD_MAP_TAG = "ShardMap";
+
+ShardMap::ShardMap(const std::shared_ptr<KinesisClient>& kinesisClient, const Aws::String& streamName) :
+    m_kinesisClient(kinesisClient),
+    m_streamName(streamName),
+    m_loaded(false)
+{
+}
+
+bool ShardMap::Refresh()
+{
+    Aws::Vector<ShardRange> shards;
+    Model::ListShardsRequest request;
+    request.SetStreamName(m_streamName);
+    do
+    {
+        auto outcome = m_kinesisClient->ListShards(request);
+        if (!outcome.IsSuccess())
+        {
+            AWS_LOGSTREAM_ERROR(SHARD_MAP_TAG, "Failed to list the shards of stream " << m_streamName << ": "
+                << outcome.GetError().GetExceptionName() << " " << outcome.GetError().GetMessage());
+            return false;
+        }
+
+        for (const auto& shard : outcome.GetResult().GetShards())
+        {
+            // Closed shards no longer take records, their hash key ranges now belong to their children.
+            if (shard.GetSequenceNumberRange().EndingSequenceNumberHasBeenSet())
+            {
+                continue;
+            }
+
+            ShardRange range;
+            range.shardId = shard.GetShardId();
+            if (!HashKey::FromDecimalString(shard.GetHashKeyRange().GetStartingHashKey(), range.startingHashKey) ||
+                !HashKey::FromDecimalString(shard.GetHashKeyRange().GetEndingHashKey(), range.endingHashKey))
+            {
+                AWS_LOGSTREAM_ERROR(SHARD_MAP_TAG, "Invalid hash key range for shard " << range.shardId << " of stream " << m_streamName);
+                return false;
+            }
+            shards.push_back(std::move(range));
+        }
+
+        // Later pages are requested with the token alone, ListShards rejects the stream name along with it.
+        request = Model::ListShardsRequest();
+        request.SetNextToken(outcome.GetResult().GetNextToken());
+    } while (!request.GetNextToken().empty());
+
+    std::sort(shards.begin(), shards.end(), [](const ShardRange& left, const ShardRange& right) { return left.endingHashKey < right.endingHashKey; });
+    AWS_LOGSTREAM_DEBUG(SHARD_MAP_TAG, "Loaded " << shards.size() << " open shards of stream " << m_streamName);
+
+    WriterLockGuard guard(m_shardsLock);
+    m_shards.swap(shards);
+    m_loaded = true;
+    return true;
+}
+
+bool ShardMap::PredictShard(const HashKey& hashKey, Aws::String& shardId) const
+{
+    ReaderLockGuard guard(m_shardsLock);
+    auto shard = std::lower_bound(m_shards.begin(), m_shards.end(), hashKey,
+        [](const ShardRange& range, const HashKey& key) { return range.endingHashKey < key; });
+    if (shard == m_shards.end() || hashKey < shard->startingHashKey)
+    {
+        return false;
+    }
+    shardId = shard->shardId;
+    return true;
+}
+
+bool ShardMap::IsLoaded() const
+{
+    ReaderLockGuard guard(m_shardsLock);
+    return m_loaded;
+}
+
+size_t ShardMap::GetShardCount() const
+{
+    ReaderLockGuard guard(m_shardsLock);
+    return m_shards.size();
+}
@@ -33,6 +33,8 @@ namespace Model
 
     Aws::String SerializePayload() const override;
 
+    inline Aws::Client::CompressionAlgorithm GetDefaultRequestCompressionAlgorithm() const override { return Aws::Client::CompressionAlgorithm::GZIP; }
+
   protected:
     void DumpBodyToUrl(Aws::Http::URI& uri ) const override;
 
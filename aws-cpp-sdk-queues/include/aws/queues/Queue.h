@@ -101,8 +101,11 @@ namespace Aws
         protected:
             std::atomic<bool> m_continue;
 
-        private:
-            void Main()
+            /**
+             * Body of the polling thread, override it to change how messages are received and dispatched.
+             * It must return soon after m_continue is cleared.
+             */
+            virtual void Main()
             {
                 while(m_continue)
                 {
@@ -134,6 +137,7 @@ namespace Aws
                 }
             }
 
+        private:
             unsigned m_pollingFrequencyMs;
             Aws::UniquePtr<std::thread> m_pollingThread;
 
@@ -0,0 +1,135 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#pragma once
+
+#include <aws/queues/sqs/SQSQueue.h>
+#include <aws/queues/Queues_EXPORTS.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Queues
+    {
+        namespace Sqs
+        {
+            struct AWS_QUEUES_API SQSBatchedQueueConfig
+            {
+                SQSBatchedQueueConfig() :
+                    consumerThreads(8),
+                    maxInFlightMessages(100),
+                    receiveWaitTimeSeconds(20),
+                    flushIntervalMs(100),
+                    extendVisibility(true)
+                {}
+
+                /**
+                 * Executor running the message received handler. Defaults to a PooledThreadExecutor of consumerThreads threads.
+                 */
+                std::shared_ptr<Aws::Utils::Threading::Executor> executor;
+                unsigned consumerThreads;
+                /**
+                 * Polling pauses while this many received messages are waiting for or being processed by the consumers.
+                 */
+                unsigned maxInFlightMessages;
+                /**
+                 * Long polling wait time of each ReceiveMessage call, 20 seconds at most. StopPolling may block for as long.
+                 */
+                unsigned receiveWaitTimeSeconds;
+                /**
+                 * Maximum time a delete or visibility change waits to be sent with others in the same batch.
+                 */
+                unsigned flushIntervalMs;
+                /**
+                 * Extends the visibility timeout of messages still processed by a consumer when half of it has elapsed,
+                 * so that slow consumers don't see their messages delivered again.
+                 */
+                bool extendVisibility;
+            };
+
+            /**
+             * High throughput SQSQueue: every poll receives up to 10 messages with long polling, hands them to a pool of consumers
+             * running the message received handler concurrently, and deletes or extends the visibility of messages in batches of up to 10,
+             * sent when a batch is full or flushIntervalMs after its first entry. Polling pauses while maxInFlightMessages are unprocessed.
+             *
+             * The message received handler is called from the consumer threads, it must be thread safe. Delete and ChangeVisibility can be
+             * called from any thread, their outcome is reported to the delete handlers from the flushing thread.
+             */
+            class AWS_QUEUES_API SQSBatchedQueue : public SQSQueue
+            {
+            public:
+                SQSBatchedQueue(const std::shared_ptr<SQS::SQSClient>& client, const char* queueName, unsigned visibilityTimeout,
+                                const SQSBatchedQueueConfig& config = SQSBatchedQueueConfig());
+                ~SQSBatchedQueue();
+
+                /**
+                 * Does not block. The message is deleted with the next DeleteMessageBatch call.
+                 */
+                void Delete(const Aws::SQS::Model::Message&) override;
+
+                /**
+                 * Does not block. The visibility timeout is changed with the next ChangeMessageVisibilityBatch call.
+                 */
+                void ChangeVisibility(const Aws::SQS::Model::Message&, unsigned visibilityTimeoutSeconds);
+
+                /**
+                 * Sends the pending deletes and visibility changes and blocks until they are done.
+                 */
+                void Flush();
+
+                /**
+                 * Number of received messages waiting for or being processed by the consumers.
+                 */
+                size_t GetInFlightMessagesCount() const;
+
+            protected:
+                void Main() override;
+
+            private:
+                struct PendingEntry
+                {
+                    Aws::SQS::Model::Message message;
+                    unsigned visibilityTimeout;
+                };
+
+                struct InFlightMessage
+                {
+                    std::chrono::steady_clock::time_point visibleAt;
+                    unsigned visibilityTimeout;
+                };
+
+                void ConsumeMessage(const Aws::SQS::Model::Message& message);
+                void FlushLoop();
+                bool FlushPendingEntries();
+                void QueueVisibilityExtensions(std::chrono::steady_clock::time_point now);
+                void SendDeleteBatch(const Aws::Vector<PendingEntry>& entries);
+                void SendChangeVisibilityBatch(const Aws::Vector<PendingEntry>& entries);
+
+                SQSBatchedQueueConfig m_config;
+
+                mutable std::mutex m_inFlightLock;
+                std::condition_variable m_inFlightSignal;
+                // Messages handed to the consumers by receipt handle.
+                Aws::Map<Aws::String, InFlightMessage> m_inFlightMessages;
+
+                std::mutex m_pendingLock;
+                std::condition_variable m_pendingSignal;
+                std::condition_variable m_flushedSignal;
+                Aws::Vector<PendingEntry> m_pendingDeletes;
+                Aws::Vector<PendingEntry> m_pendingVisibilityChanges;
+                std::chrono::steady_clock::time_point m_firstPendingTime;
+                size_t m_flushesRequested;
+                size_t m_flushesCompleted;
+                bool m_continueFlushing;
+                std::thread m_flushThread;
+            };
+        }
+    }
+}
@@ -104,12 +104,14 @@ namespace Aws
                 inline bool IsInitialized() const { return !m_queueUrl.empty(); }
                 inline const Aws::String& GetQueueUrl() const { return m_queueUrl; }
 
-            private:
+            protected:
                 std::shared_ptr<SQS::SQSClient> m_client;
                 Aws::String m_queueUrl;
                 Aws::String m_queueName;
                 unsigned m_visibilityTimeout;
 
+            private:
+
                 void OnMessageDeletedOutcomeReceived(const SQS::SQSClient*, const SQS::Model::DeleteMessageRequest&,
                                                      const SQS::Model::DeleteMessageOutcome& deleteMessageOutcome, const std::shared_ptr<const Client::AsyncCallerContext>&);
 
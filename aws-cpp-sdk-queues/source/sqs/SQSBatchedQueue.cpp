@@ -0,0 +1,421 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/queues/sqs/SQSBatchedQueue.h>
+#include <aws/sqs/model/ReceiveMessageRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/ChangeMessageVisibilityBatchRequest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+
+using namespace Aws::SQS;
+using namespace Aws::SQS::Model;
+using namespace Aws::Queues::Sqs;
+using namespace Aws::Utils;
+
+static const char* CLASS_TAG = "Aws::Queues::Sqs::SQSBatchedQueue";
+// Limits of ReceiveMessage, DeleteMessageBatch and ChangeMessageVisibilityBatch.
+static const size_t MAX_BATCH_SIZE = 10;
+static const unsigned MAX_RECEIVE_WAIT_TIME_SECONDS = 20;
+static const unsigned RECEIVE_ERROR_BACKOFF_MS = 1000;
+// How often a polling thread blocked by maxInFlightMessages checks for StopPolling.
+static const unsigned IN_FLIGHT_WAIT_MS = 100;
+
+SQSBatchedQueue::SQSBatchedQueue(const std::shared_ptr<SQSClient>& client, const char* queueName, unsigned visibilityTimeout,
+                                 const SQSBatchedQueueConfig& config) :
+    SQSQueue(client, queueName, visibilityTimeout, 0),
+    m_config(config),
+    m_flushesRequested(0),
+    m_flushesCompleted(0),
+    m_continueFlushing(true)
+{
+    if (!m_config.executor)
+    {
+        m_config.executor = Aws::MakeShared<Threading::PooledThreadExecutor>(CLASS_TAG, (std::max)(m_config.consumerThreads, 1u));
+    }
+    m_config.maxInFlightMessages = (std::max)(m_config.maxInFlightMessages, 1u);
+    m_config.receiveWaitTimeSeconds = (std::min)(m_config.receiveWaitTimeSeconds, MAX_RECEIVE_WAIT_TIME_SECONDS);
+
+    m_flushThread = std::thread(&SQSBatchedQueue::FlushLoop, this);
+}
+
+SQSBatchedQueue::~SQSBatchedQueue()
+{
+    // Main uses this object's members, stop it before the Queue destructor does.
+    StopPolling();
+
+    {
+        std::unique_lock<std::mutex> locker(m_inFlightLock);
+        m_inFlightSignal.wait(locker, [this] { return m_inFlightMessages.empty(); });
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_pendingLock);
+        m_continueFlushing = false;
+    }
+    m_pendingSignal.notify_one();
+    m_flushThread.join();
+}
+
+void SQSBatchedQueue::Main()
+{
+    if (!IsInitialized())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Queue is not initialized, not polling. Call EnsureQueueIsInitialized before calling StartPolling.");
+        return;
+    }
+
+    while (m_continue)
+    {
+        size_t capacity = 0;
+        {
+            std::unique_lock<std::mutex> locker(m_inFlightLock);
+            while (m_continue && m_inFlightMessages.size() >= m_config.maxInFlightMessages)
+            {
+                m_inFlightSignal.wait_for(locker, std::chrono::milliseconds(IN_FLIGHT_WAIT_MS));
+            }
+            capacity = (std::min)(MAX_BATCH_SIZE, m_config.maxInFlightMessages - m_inFlightMessages.size());
+        }
+
+        if (!m_continue)
+        {
+            break;
+        }
+
+        AWS_LOGSTREAM_TRACE(CLASS_TAG, "Polling for up to " << capacity << " messages with timeout of " << m_config.receiveWaitTimeSeconds << " seconds.");
+        ReceiveMessageRequest receiveMessageRequest;
+        receiveMessageRequest.SetMaxNumberOfMessages(static_cast<int>(capacity));
+        receiveMessageRequest.SetQueueUrl(m_queueUrl);
+        receiveMessageRequest.SetVisibilityTimeout(m_visibilityTimeout);
+        receiveMessageRequest.SetWaitTimeSeconds(m_config.receiveWaitTimeSeconds);
+
+        ReceiveMessageOutcome receiveMessageOutcome = m_client->ReceiveMessage(receiveMessageRequest);
+        if (!receiveMessageOutcome.IsSuccess())
+        {
+            AWS_LOGSTREAM_ERROR(CLASS_TAG, "Receive message failed with error: " << receiveMessageOutcome.GetError().GetExceptionName() <<
+                                           " and message: " << receiveMessageOutcome.GetError().GetMessage());
+            std::this_thread::sleep_for(std::chrono::milliseconds(RECEIVE_ERROR_BACKOFF_MS));
+            continue;
+        }
+
+        const auto& messages = receiveMessageOutcome.GetResult().GetMessages();
+        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Received " << messages.size() << " messages.");
+
+        auto visibleAt = std::chrono::steady_clock::now() + std::chrono::seconds(m_visibilityTimeout);
+        {
+            std::lock_guard<std::mutex> locker(m_inFlightLock);
+            for (const auto& message : messages)
+            {
+                InFlightMessage inFlightMessage;
+                inFlightMessage.visibleAt = visibleAt;
+                inFlightMessage.visibilityTimeout = m_visibilityTimeout;
+                m_inFlightMessages[message.GetReceiptHandle()] = inFlightMessage;
+            }
+        }
+
+        for (const auto& message : messages)
+        {
+            if (!m_config.executor->Submit(&SQSBatchedQueue::ConsumeMessage, this, message))
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Executor rejected message " << message.GetMessageId() << ", processing it on the polling thread.");
+                ConsumeMessage(message);
+            }
+        }
+    }
+}
+
+void SQSBatchedQueue::ConsumeMessage(const Message& message)
+{
+    bool deleteMessage = false;
+    auto& receivedHandler = GetMessageReceivedEventHandler();
+    if (receivedHandler)
+    {
+        receivedHandler(this, message, deleteMessage);
+    }
+
+    if (deleteMessage)
+    {
+        Delete(message);
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightLock);
+        m_inFlightMessages.erase(message.GetReceiptHandle());
+    }
+    m_inFlightSignal.notify_all();
+}
+
+void SQSBatchedQueue::Delete(const Message& message)
+{
+    if (!IsInitialized())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Queue is not initialized, not deleting. Call EnsureQueueIsInitialized before calling this method.");
+        return;
+    }
+
+    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Queueing delete of message " << message.GetReceiptHandle() << ". From queue " << m_queueUrl);
+    bool batchFull = false;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingLock);
+        if (m_pendingDeletes.empty() && m_pendingVisibilityChanges.empty())
+        {
+            m_firstPendingTime = std::chrono::steady_clock::now();
+        }
+
+        // A visibility change sent after the delete would fail, drop it.
+        const Aws::String& receiptHandle = message.GetReceiptHandle();
+        m_pendingVisibilityChanges.erase(std::remove_if(m_pendingVisibilityChanges.begin(), m_pendingVisibilityChanges.end(),
+            [&receiptHandle](const PendingEntry& entry) { return entry.message.GetReceiptHandle() == receiptHandle; }),
+            m_pendingVisibilityChanges.end());
+
+        PendingEntry entry;
+        entry.message = message;
+        entry.visibilityTimeout = 0;
+        m_pendingDeletes.push_back(entry);
+        batchFull = m_pendingDeletes.size() >= MAX_BATCH_SIZE;
+    }
+
+    if (batchFull)
+    {
+        m_pendingSignal.notify_one();
+    }
+}
+
+void SQSBatchedQueue::ChangeVisibility(const Message& message, unsigned visibilityTimeoutSeconds)
+{
+    if (!IsInitialized())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Queue is not initialized, not changing visibility. Call EnsureQueueIsInitialized before calling this method.");
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightLock);
+        auto iter = m_inFlightMessages.find(message.GetReceiptHandle());
+        if (iter != m_inFlightMessages.end())
+        {
+            iter->second.visibleAt = std::chrono::steady_clock::now() + std::chrono::seconds(visibilityTimeoutSeconds);
+            iter->second.visibilityTimeout = visibilityTimeoutSeconds;
+        }
+    }
+
+    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Queueing visibility change of message " << message.GetReceiptHandle() << " to " << visibilityTimeoutSeconds << " seconds.");
+    bool batchFull = false;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingLock);
+        if (m_pendingDeletes.empty() && m_pendingVisibilityChanges.empty())
+        {
+            m_firstPendingTime = std::chrono::steady_clock::now();
+        }
+
+        PendingEntry entry;
+        entry.message = message;
+        entry.visibilityTimeout = visibilityTimeoutSeconds;
+        m_pendingVisibilityChanges.push_back(entry);
+        batchFull = m_pendingVisibilityChanges.size() >= MAX_BATCH_SIZE;
+    }
+
+    if (batchFull)
+    {
+        m_pendingSignal.notify_one();
+    }
+}
+
+void SQSBatchedQueue::Flush()
+{
+    std::unique_lock<std::mutex> locker(m_pendingLock);
+    size_t flushRequest = ++m_flushesRequested;
+    m_pendingSignal.notify_one();
+    m_flushedSignal.wait(locker, [this, flushRequest] { return m_flushesCompleted >= flushRequest || !m_continueFlushing; });
+}
+
+size_t SQSBatchedQueue::GetInFlightMessagesCount() const
+{
+    std::lock_guard<std::mutex> locker(m_inFlightLock);
+    return m_inFlightMessages.size();
+}
+
+void SQSBatchedQueue::FlushLoop()
+{
+    std::unique_lock<std::mutex> locker(m_pendingLock);
+    for (;;)
+    {
+        bool hasPendingEntries = !m_pendingDeletes.empty() || !m_pendingVisibilityChanges.empty();
+        auto wakeUpTime = (hasPendingEntries ? m_firstPendingTime : std::chrono::steady_clock::now()) +
+                          std::chrono::milliseconds(m_config.flushIntervalMs);
+        m_pendingSignal.wait_until(locker, wakeUpTime, [this] {
+            return !m_continueFlushing || m_flushesRequested > m_flushesCompleted ||
+                   m_pendingDeletes.size() >= MAX_BATCH_SIZE || m_pendingVisibilityChanges.size() >= MAX_BATCH_SIZE;
+        });
+
+        bool stopping = !m_continueFlushing;
+        if (m_config.extendVisibility && !stopping)
+        {
+            locker.unlock();
+            QueueVisibilityExtensions(std::chrono::steady_clock::now());
+            locker.lock();
+        }
+
+        bool flushDue = stopping || m_flushesRequested > m_flushesCompleted ||
+                        m_pendingDeletes.size() >= MAX_BATCH_SIZE || m_pendingVisibilityChanges.size() >= MAX_BATCH_SIZE ||
+                        ((!m_pendingDeletes.empty() || !m_pendingVisibilityChanges.empty()) &&
+                         std::chrono::steady_clock::now() >= m_firstPendingTime + std::chrono::milliseconds(m_config.flushIntervalMs));
+        if (flushDue)
+        {
+            size_t flushRequest = m_flushesRequested;
+            locker.unlock();
+            FlushPendingEntries();
+            locker.lock();
+            m_flushesCompleted = flushRequest;
+            m_flushedSignal.notify_all();
+        }
+
+        if (stopping)
+        {
+            break;
+        }
+    }
+}
+
+bool SQSBatchedQueue::FlushPendingEntries()
+{
+    Aws::Vector<PendingEntry> deletes;
+    Aws::Vector<PendingEntry> visibilityChanges;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingLock);
+        deletes.swap(m_pendingDeletes);
+        visibilityChanges.swap(m_pendingVisibilityChanges);
+    }
+
+    if (deletes.empty() && visibilityChanges.empty())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < visibilityChanges.size(); i += MAX_BATCH_SIZE)
+    {
+        size_t end = (std::min)(i + MAX_BATCH_SIZE, visibilityChanges.size());
+        SendChangeVisibilityBatch(Aws::Vector<PendingEntry>(visibilityChanges.begin() + i, visibilityChanges.begin() + end));
+    }
+
+    for (size_t i = 0; i < deletes.size(); i += MAX_BATCH_SIZE)
+    {
+        size_t end = (std::min)(i + MAX_BATCH_SIZE, deletes.size());
+        SendDeleteBatch(Aws::Vector<PendingEntry>(deletes.begin() + i, deletes.begin() + end));
+    }
+    return true;
+}
+
+void SQSBatchedQueue::QueueVisibilityExtensions(std::chrono::steady_clock::time_point now)
+{
+    Aws::Vector<Message> expiringMessages;
+    Aws::Vector<unsigned> visibilityTimeouts;
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightLock);
+        for (auto& inFlightMessage : m_inFlightMessages)
+        {
+            unsigned visibilityTimeout = inFlightMessage.second.visibilityTimeout;
+            if (visibilityTimeout == 0 || now < inFlightMessage.second.visibleAt - std::chrono::milliseconds(visibilityTimeout * 500))
+            {
+                continue;
+            }
+
+            Message message;
+            message.SetReceiptHandle(inFlightMessage.first);
+            expiringMessages.push_back(message);
+            visibilityTimeouts.push_back(visibilityTimeout);
+        }
+    }
+
+    for (size_t i = 0; i < expiringMessages.size(); ++i)
+    {
+        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Message " << expiringMessages[i].GetReceiptHandle() << " is still being processed, extending its visibility.");
+        ChangeVisibility(expiringMessages[i], visibilityTimeouts[i]);
+    }
+}
+
+void SQSBatchedQueue::SendDeleteBatch(const Aws::Vector<PendingEntry>& entries)
+{
+    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Deleting " << entries.size() << " messages from queue " << m_queueUrl);
+    DeleteMessageBatchRequest deleteMessageBatchRequest;
+    deleteMessageBatchRequest.SetQueueUrl(m_queueUrl);
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        DeleteMessageBatchRequestEntry entry;
+        entry.SetId(StringUtils::to_string(i));
+        entry.SetReceiptHandle(entries[i].message.GetReceiptHandle());
+        deleteMessageBatchRequest.AddEntries(entry);
+    }
+
+    auto deleteMessageBatchOutcome = m_client->DeleteMessageBatch(deleteMessageBatchRequest);
+    auto& deleteFailed = GetMessageDeleteFailedEventHandler();
+    auto& deleteSuccess = GetMessageDeleteSuccessEventHandler();
+    if (!deleteMessageBatchOutcome.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Delete message batch failed with error: " << deleteMessageBatchOutcome.GetError().GetExceptionName() <<
+                                       " and message: " << deleteMessageBatchOutcome.GetError().GetMessage());
+        if (deleteFailed)
+        {
+            for (const auto& entry : entries)
+            {
+                deleteFailed(this, entry.message);
+            }
+        }
+        return;
+    }
+
+    const auto& result = deleteMessageBatchOutcome.GetResult();
+    for (const auto& failed : result.GetFailed())
+    {
+        size_t index = static_cast<size_t>(StringUtils::ConvertToInt64(failed.GetId().c_str()));
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Delete message failed with error: " << failed.GetCode() << " and message: " << failed.GetMessage());
+        if (deleteFailed && index < entries.size())
+        {
+            deleteFailed(this, entries[index].message);
+        }
+    }
+
+    AWS_LOGSTREAM_TRACE(CLASS_TAG, result.GetSuccessful().size() << " messages successfully deleted.");
+    for (const auto& successful : result.GetSuccessful())
+    {
+        size_t index = static_cast<size_t>(StringUtils::ConvertToInt64(successful.GetId().c_str()));
+        if (deleteSuccess && index < entries.size())
+        {
+            deleteSuccess(this, entries[index].message);
+        }
+    }
+}
+
+void SQSBatchedQueue::SendChangeVisibilityBatch(const Aws::Vector<PendingEntry>& entries)
+{
+    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Changing visibility of " << entries.size() << " messages in queue " << m_queueUrl);
+    ChangeMessageVisibilityBatchRequest changeVisibilityBatchRequest;
+    changeVisibilityBatchRequest.SetQueueUrl(m_queueUrl);
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        ChangeMessageVisibilityBatchRequestEntry entry;
+        entry.SetId(StringUtils::to_string(i));
+        entry.SetReceiptHandle(entries[i].message.GetReceiptHandle());
+        entry.SetVisibilityTimeout(static_cast<int>(entries[i].visibilityTimeout));
+        changeVisibilityBatchRequest.AddEntries(entry);
+    }
+
+    auto changeVisibilityBatchOutcome = m_client->ChangeMessageVisibilityBatch(changeVisibilityBatchRequest);
+    if (!changeVisibilityBatchOutcome.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Change message visibility batch failed with error: " << changeVisibilityBatchOutcome.GetError().GetExceptionName() <<
+                                       " and message: " << changeVisibilityBatchOutcome.GetError().GetMessage());
+        return;
+    }
+
+    for (const auto& failed : changeVisibilityBatchOutcome.GetResult().GetFailed())
+    {
+        AWS_LOGSTREAM_WARN(CLASS_TAG, "Change message visibility failed for entry " << failed.GetId() << " with error: " << failed.GetCode() <<
+                                      " and message: " << failed.GetMessage());
+    }
+}
@@ -0,0 +1,209 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/s3/model/CopyObjectResult.h>
+#include <aws/s3/model/GetBucketLocationResult.h>
+#include <aws/s3/model/GetObjectTaggingResult.h>
+#include <aws/s3/model/ListBucketsResult.h>
+#include <aws/s3/model/ListObjectVersionsResult.h>
+#include <aws/s3/model/ListObjectsV2Result.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Xml;
+using namespace Aws::S3::Model;
+
+namespace
+{
+    // Response bodies as S3 returns them.
+    static const char LIST_OBJECTS_V2_RESPONSE[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+        "<Name>examplebucket</Name><Prefix>photos/</Prefix><KeyCount>2</KeyCount><MaxKeys>2</MaxKeys>"
+        "<Delimiter>/</Delimiter><IsTruncated>true</IsTruncated>"
+        "<NextContinuationToken>1ueGcxLPRx1Tr/XYExHnhbYLgveDs2J/wm36Hy4vbOwM=</NextContinuationToken>"
+        "<Contents><Key>photos/2006/January/sample.jpg</Key><LastModified>2011-02-26T01:56:20.000Z</LastModified>"
+        "<ETag>&quot;bf1d737a4d46a19f3bced6905cc8b902&quot;</ETag><Size>5368709120</Size><StorageClass>STANDARD</StorageClass>"
+        "<Owner><ID>75aa57f09aa0c8caeab4f8c24e99d10f8e7faeebf76c078efc7c6caea54ba06a</ID><DisplayName>mtd</DisplayName></Owner></Contents>"
+        "<Contents><Key>photos/2006/February/sample &amp; more.jpg</Key><LastModified>2011-02-27T01:56:20.000Z</LastModified>"
+        "<ETag>&quot;5b3d1b4e3c1c4b2f1a7b6a0c9d8e7f60&quot;</ETag><Size>142863</Size><StorageClass>GLACIER</StorageClass></Contents>"
+        "<CommonPrefixes><Prefix>photos/2006/</Prefix></CommonPrefixes>"
+        "<CommonPrefixes><Prefix>photos/2007/</Prefix></CommonPrefixes>"
+        "</ListBucketResult>";
+
+    // Versions and delete markers are flattened lists interleaved in document order.
+    static const char LIST_OBJECT_VERSIONS_RESPONSE[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ListVersionsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+        "<Name>bucket</Name><Prefix>my</Prefix><KeyMarker/><VersionIdMarker/><MaxKeys>5</MaxKeys><IsTruncated>false</IsTruncated>"
+        "<Version><Key>my-image.jpg</Key><VersionId>3/L4kqtJl40Nr8X8gdRQBpUMLUo</VersionId><IsLatest>true</IsLatest>"
+        "<LastModified>2009-10-12T17:50:30.000Z</LastModified><ETag>&quot;fba9dede5f27731c9771645a39863328&quot;</ETag>"
+        "<Size>434234</Size><StorageClass>STANDARD</StorageClass></Version>"
+        "<DeleteMarker><Key>my-second-image.jpg</Key><VersionId>03jpff543dhffds434rfdsFDN943fdsFkdmqnh892</VersionId>"
+        "<IsLatest>true</IsLatest><LastModified>2009-11-12T17:50:30.000Z</LastModified>"
+        "<Owner><ID>75aa57f09aa0c8caeab4f8c24e99d10f8e7faeebf76c078efc7c6caea54ba06a</ID><DisplayName>mtd@amazon.com</DisplayName></Owner>"
+        "</DeleteMarker>"
+        "<Version><Key>my-second-image.jpg</Key><VersionId>QUpfdndhfd8438MNFDN93jdnJFkdmqnh893</VersionId><IsLatest>false</IsLatest>"
+        "<LastModified>2009-10-10T17:50:30.000Z</LastModified><ETag>&quot;9b2cf535f27731c974343645a3985328&quot;</ETag>"
+        "<Size>166434</Size><StorageClass>STANDARD</StorageClass></Version>"
+        "</ListVersionsResult>";
+
+    static const char LIST_BUCKETS_RESPONSE[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ListAllMyBucketsResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+        "<Owner><ID>bcaf1ffd86f461ca5fb16fd081034f</ID><DisplayName>webfile</DisplayName></Owner>"
+        "<Buckets><Bucket><Name>quotes</Name><CreationDate>2006-02-03T16:45:09.000Z</CreationDate></Bucket>"
+        "<Bucket><Name>samples</Name><CreationDate>2006-02-03T16:41:58.000Z</CreationDate></Bucket></Buckets>"
+        "</ListAllMyBucketsResult>";
+
+    static const char GET_BUCKET_LOCATION_RESPONSE[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<LocationConstraint xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">eu-west-1</LocationConstraint>";
+
+    static const char GET_OBJECT_TAGGING_RESPONSE[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<Tagging xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\"><TagSet>"
+        "<Tag><Key>tag1</Key><Value>val1</Value></Tag><Tag><Value>val2</Value><Key>tag2</Key></Tag>"
+        "</TagSet></Tagging>";
+
+    static const char COPY_OBJECT_RESPONSE[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<CopyObjectResult><LastModified>2009-10-28T22:32:00.000Z</LastModified>"
+        "<ETag>&quot;9b2cf535f27731c974343645a3985328&quot;</ETag></CopyObjectResult>";
+
+    template<typename RESULT>
+    RESULT ResultFromXmlDocument(const char* body, const HeaderValueCollection& headers = HeaderValueCollection())
+    {
+        return RESULT(Aws::AmazonWebServiceResult<XmlDocument>(XmlDocument::CreateFromXmlString(body), headers));
+    }
+
+    template<typename RESULT>
+    RESULT ResultFromXmlReader(const char* body, const HeaderValueCollection& headers = HeaderValueCollection())
+    {
+        return RESULT(Aws::AmazonWebServiceResult<XmlReader>(XmlReader(body, strlen(body)), headers));
+    }
+
+    TEST(ModelXmlReaderTest, TestListObjectsV2Result)
+    {
+        auto result = ResultFromXmlReader<ListObjectsV2Result>(LIST_OBJECTS_V2_RESPONSE);
+        ASSERT_EQ("examplebucket", result.GetName());
+        ASSERT_EQ("photos/", result.GetPrefix());
+        ASSERT_EQ(2, result.GetKeyCount());
+        ASSERT_EQ(2, result.GetMaxKeys());
+        ASSERT_TRUE(result.GetIsTruncated());
+        ASSERT_EQ("1ueGcxLPRx1Tr/XYExHnhbYLgveDs2J/wm36Hy4vbOwM=", result.GetNextContinuationToken());
+        const auto& contents = result.GetContents();
+        ASSERT_EQ(2u, contents.size());
+        ASSERT_EQ("photos/2006/January/sample.jpg", contents[0].GetKey());
+        ASSERT_EQ("\"bf1d737a4d46a19f3bced6905cc8b902\"", contents[0].GetETag());
+        ASSERT_EQ(5368709120LL, contents[0].GetSize());
+        ASSERT_EQ(ObjectStorageClass::STANDARD, contents[0].GetStorageClass());
+        ASSERT_EQ(DateTime("2011-02-26T01:56:20.000Z", DateFormat::ISO_8601), contents[0].GetLastModified());
+        ASSERT_EQ("mtd", contents[0].GetOwner().GetDisplayName());
+        ASSERT_EQ("photos/2006/February/sample & more.jpg", contents[1].GetKey());
+        ASSERT_EQ(ObjectStorageClass::GLACIER, contents[1].GetStorageClass());
+        ASSERT_EQ(2u, result.GetCommonPrefixes().size());
+        ASSERT_EQ("photos/2007/", result.GetCommonPrefixes()[1].GetPrefix());
+
+        // Both ways of reading the payload build the same model.
+        auto expected = ResultFromXmlDocument<ListObjectsV2Result>(LIST_OBJECTS_V2_RESPONSE);
+        ASSERT_EQ(expected.GetContents().size(), contents.size());
+        for (size_t i = 0; i < contents.size(); ++i)
+        {
+            ASSERT_EQ(expected.GetContents()[i].GetKey(), contents[i].GetKey());
+            ASSERT_EQ(expected.GetContents()[i].GetETag(), contents[i].GetETag());
+            ASSERT_EQ(expected.GetContents()[i].GetSize(), contents[i].GetSize());
+            ASSERT_EQ(expected.GetContents()[i].GetLastModified(), contents[i].GetLastModified());
+            ASSERT_EQ(expected.GetContents()[i].GetOwner().GetID(), contents[i].GetOwner().GetID());
+        }
+        ASSERT_EQ(expected.GetCommonPrefixes()[0].GetPrefix(), result.GetCommonPrefixes()[0].GetPrefix());
+    }
+
+    TEST(ModelXmlReaderTest, TestListObjectVersionsResultInterleavedLists)
+    {
+        auto result = ResultFromXmlReader<ListObjectVersionsResult>(LIST_OBJECT_VERSIONS_RESPONSE);
+        ASSERT_EQ("bucket", result.GetName());
+        ASSERT_EQ(5, result.GetMaxKeys());
+        ASSERT_FALSE(result.GetIsTruncated());
+        ASSERT_TRUE(result.GetKeyMarker().empty());
+        ASSERT_EQ(2u, result.GetVersions().size());
+        ASSERT_EQ("my-image.jpg", result.GetVersions()[0].GetKey());
+        ASSERT_TRUE(result.GetVersions()[0].GetIsLatest());
+        ASSERT_EQ("QUpfdndhfd8438MNFDN93jdnJFkdmqnh893", result.GetVersions()[1].GetVersionId());
+        ASSERT_FALSE(result.GetVersions()[1].GetIsLatest());
+        ASSERT_EQ(166434, result.GetVersions()[1].GetSize());
+        ASSERT_EQ(1u, result.GetDeleteMarkers().size());
+        ASSERT_EQ("my-second-image.jpg", result.GetDeleteMarkers()[0].GetKey());
+        ASSERT_EQ("mtd@amazon.com", result.GetDeleteMarkers()[0].GetOwner().GetDisplayName());
+
+        auto expected = ResultFromXmlDocument<ListObjectVersionsResult>(LIST_OBJECT_VERSIONS_RESPONSE);
+        ASSERT_EQ(expected.GetVersions().size(), result.GetVersions().size());
+        ASSERT_EQ(expected.GetVersions()[1].GetETag(), result.GetVersions()[1].GetETag());
+        ASSERT_EQ(expected.GetDeleteMarkers()[0].GetVersionId(), result.GetDeleteMarkers()[0].GetVersionId());
+        ASSERT_EQ(expected.GetDeleteMarkers()[0].GetLastModified(), result.GetDeleteMarkers()[0].GetLastModified());
+    }
+
+    TEST(ModelXmlReaderTest, TestListBucketsResult)
+    {
+        auto result = ResultFromXmlReader<ListBucketsResult>(LIST_BUCKETS_RESPONSE);
+        ASSERT_EQ("webfile", result.GetOwner().GetDisplayName());
+        ASSERT_EQ(2u, result.GetBuckets().size());
+        ASSERT_EQ("samples", result.GetBuckets()[1].GetName());
+        ASSERT_EQ(DateTime("2006-02-03T16:41:58.000Z", DateFormat::ISO_8601), result.GetBuckets()[1].GetCreationDate());
+
+        auto expected = ResultFromXmlDocument<ListBucketsResult>(LIST_BUCKETS_RESPONSE);
+        ASSERT_EQ(expected.GetBuckets()[0].GetName(), result.GetBuckets()[0].GetName());
+        ASSERT_EQ(expected.GetOwner().GetID(), result.GetOwner().GetID());
+    }
+
+    TEST(ModelXmlReaderTest, TestGetBucketLocationResult)
+    {
+        auto result = ResultFromXmlReader<GetBucketLocationResult>(GET_BUCKET_LOCATION_RESPONSE);
+        ASSERT_EQ(BucketLocationConstraint::eu_west_1, result.GetLocationConstraint());
+
+        auto expected = ResultFromXmlDocument<GetBucketLocationResult>(GET_BUCKET_LOCATION_RESPONSE);
+        ASSERT_EQ(expected.GetLocationConstraint(), result.GetLocationConstraint());
+    }
+
+    TEST(ModelXmlReaderTest, TestGetObjectTaggingResult)
+    {
+        HeaderValueCollection headers;
+        headers.emplace("x-amz-version-id", "ydlaNkwWm0SfKJR.T1b1fIdPRbldTYRI");
+        auto result = ResultFromXmlReader<GetObjectTaggingResult>(GET_OBJECT_TAGGING_RESPONSE, headers);
+        ASSERT_EQ("ydlaNkwWm0SfKJR.T1b1fIdPRbldTYRI", result.GetVersionId());
+        ASSERT_EQ(2u, result.GetTagSet().size());
+        ASSERT_EQ("tag1", result.GetTagSet()[0].GetKey());
+        ASSERT_EQ("val1", result.GetTagSet()[0].GetValue());
+        ASSERT_EQ("tag2", result.GetTagSet()[1].GetKey());
+        ASSERT_EQ("val2", result.GetTagSet()[1].GetValue());
+
+        auto expected = ResultFromXmlDocument<GetObjectTaggingResult>(GET_OBJECT_TAGGING_RESPONSE, headers);
+        ASSERT_EQ(expected.GetVersionId(), result.GetVersionId());
+        ASSERT_EQ(expected.GetTagSet()[1].GetKey(), result.GetTagSet()[1].GetKey());
+    }
+
+    TEST(ModelXmlReaderTest, TestCopyObjectResultPayloadMember)
+    {
+        HeaderValueCollection headers;
+        headers.emplace("x-amz-version-id", "3/L4kqtJlcpXroDTDmJ+rmSpXd3dIbrHY+MTRCxf3vjVBH40Nr8X8gdRQBpUMLUo");
+        headers.emplace("x-amz-server-side-encryption", "AES256");
+        auto result = ResultFromXmlReader<CopyObjectResult>(COPY_OBJECT_RESPONSE, headers);
+        ASSERT_EQ("\"9b2cf535f27731c974343645a3985328\"", result.GetCopyObjectResultDetails().GetETag());
+        ASSERT_EQ(DateTime("2009-10-28T22:32:00.000Z", DateFormat::ISO_8601), result.GetCopyObjectResultDetails().GetLastModified());
+        ASSERT_EQ("3/L4kqtJlcpXroDTDmJ+rmSpXd3dIbrHY+MTRCxf3vjVBH40Nr8X8gdRQBpUMLUo", result.GetVersionId());
+        ASSERT_EQ(ServerSideEncryption::AES256, result.GetServerSideEncryption());
+
+        auto expected = ResultFromXmlDocument<CopyObjectResult>(COPY_OBJECT_RESPONSE, headers);
+        ASSERT_EQ(expected.GetCopyObjectResultDetails().GetETag(), result.GetCopyObjectResultDetails().GetETag());
+        ASSERT_EQ(expected.GetVersionId(), result.GetVersionId());
+    }
+
+    TEST(ModelXmlReaderTest, TestEmptyPayload)
+    {
+        auto result = ListObjectsV2Result(Aws::AmazonWebServiceResult<XmlReader>(XmlReader(), HeaderValueCollection()));
+        ASSERT_TRUE(result.GetContents().empty());
+        ASSERT_TRUE(result.GetName().empty());
+    }
+}
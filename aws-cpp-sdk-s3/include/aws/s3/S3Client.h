@@ -13,6 +13,7 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/DNS.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/s3/model/AbortMultipartUploadResult.h>
 #include <aws/s3/model/CompleteMultipartUploadResult.h>
 #include <aws/s3/model/CopyObjectResult.h>
@@ -10896,6 +10897,20 @@ namespace Aws
         Aws::String GeneratePresignedUrlWithSSEC(const Aws::String& bucket, const Aws::String& key, Aws::Http::HttpMethod method, Http::HeaderValueCollection customizedHeaders, const Aws::String& base64EncodedAES256Key, long long expirationInSeconds = MAX_EXPIRATION_SECONDS);
 
 
+        /**
+         * Pages of ListObjectsV2, requested lazily as the range is iterated, with up to prefetchDepth pages requested on the client executor
+         * ahead of the page being processed. The range calls this client, so it must not outlive it.
+         */
+        typedef Aws::Client::Paginator<Model::ListObjectsV2Request, Model::ListObjectsV2Result, S3Error> ListObjectsV2Paginator;
+        ListObjectsV2Paginator ListObjectsV2Pages(const Model::ListObjectsV2Request& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages of ListObjectsV2 for each prefix, appended to the prefix of request, e.g. the top level "directories" of a large bucket.
+         * The prefixes are listed concurrently on the client executor, their pages are iterated prefix after prefix.
+         * The prefixes should not overlap, or the keys they share are listed more than once.
+         */
+        ListObjectsV2Paginator ListObjectsV2PagesByPrefix(const Model::ListObjectsV2Request& request, const Aws::Vector<Aws::String>& prefixes, size_t prefetchDepth = 1) const;
+
         virtual bool MultipartUploadSupported() const;
 
         void OverrideEndpoint(const Aws::String& endpoint);
@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     AbortIncompleteMultipartUpload();
     AbortIncompleteMultipartUpload(const Aws::Utils::Xml::XmlNode& xmlNode);
     AbortIncompleteMultipartUpload& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    AbortIncompleteMultipartUpload(Aws::Utils::Xml::XmlReader& reader);
+    AbortIncompleteMultipartUpload& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     AccelerateConfiguration();
     AccelerateConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     AccelerateConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    AccelerateConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    AccelerateConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
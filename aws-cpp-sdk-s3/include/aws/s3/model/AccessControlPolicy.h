@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     AccessControlPolicy();
     AccessControlPolicy(const Aws::Utils::Xml::XmlNode& xmlNode);
     AccessControlPolicy& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    AccessControlPolicy(Aws::Utils::Xml::XmlReader& reader);
+    AccessControlPolicy& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
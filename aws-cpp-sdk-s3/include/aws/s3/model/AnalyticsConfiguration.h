@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     AnalyticsConfiguration();
     AnalyticsConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     AnalyticsConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    AnalyticsConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    AnalyticsConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
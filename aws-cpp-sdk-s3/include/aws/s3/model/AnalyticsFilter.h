@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     AnalyticsFilter();
     AnalyticsFilter(const Aws::Utils::Xml::XmlNode& xmlNode);
     AnalyticsFilter& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    AnalyticsFilter(Aws::Utils::Xml::XmlReader& reader);
+    AnalyticsFilter& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     AnalyticsS3BucketDestination();
     AnalyticsS3BucketDestination(const Aws::Utils::Xml::XmlNode& xmlNode);
     AnalyticsS3BucketDestination& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    AnalyticsS3BucketDestination(Aws::Utils::Xml::XmlReader& reader);
+    AnalyticsS3BucketDestination& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
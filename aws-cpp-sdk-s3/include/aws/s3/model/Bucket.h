@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     Bucket();
     Bucket(const Aws::Utils::Xml::XmlNode& xmlNode);
     Bucket& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Bucket(Aws::Utils::Xml::XmlReader& reader);
+    Bucket& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     CORSConfiguration();
     CORSConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     CORSConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    CORSConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    CORSConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
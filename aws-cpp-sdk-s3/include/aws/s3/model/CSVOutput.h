@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     CSVOutput();
     CSVOutput(const Aws::Utils::Xml::XmlNode& xmlNode);
     CSVOutput& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    CSVOutput(Aws::Utils::Xml::XmlReader& reader);
+    CSVOutput& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     CloudFunctionConfiguration();
     CloudFunctionConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     CloudFunctionConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    CloudFunctionConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    CloudFunctionConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -21,6 +21,7 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -33,6 +34,8 @@ namespace Model
     CopyObjectResult();
     CopyObjectResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     CopyObjectResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    CopyObjectResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlReader>& result);
+    CopyObjectResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlReader>& result);
 
 
     /**
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -34,6 +35,8 @@ namespace Model
     CopyPartResult();
     CopyPartResult(const Aws::Utils::Xml::XmlNode& xmlNode);
     CopyPartResult& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    CopyPartResult(Aws::Utils::Xml::XmlReader& reader);
+    CopyPartResult& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
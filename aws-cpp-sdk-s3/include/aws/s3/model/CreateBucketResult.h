@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -30,6 +31,8 @@ namespace Model
     CreateBucketResult();
     CreateBucketResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     CreateBucketResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    CreateBucketResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlReader>& result);
+    CreateBucketResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlReader>& result);
 
 
     /**
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -34,6 +35,8 @@ namespace Model
     Delete();
     Delete(const Aws::Utils::Xml::XmlNode& xmlNode);
     Delete& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Delete(Aws::Utils::Xml::XmlReader& reader);
+    Delete& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     DeleteMarkerEntry();
     DeleteMarkerEntry(const Aws::Utils::Xml::XmlNode& xmlNode);
     DeleteMarkerEntry& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    DeleteMarkerEntry(Aws::Utils::Xml::XmlReader& reader);
+    DeleteMarkerEntry& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
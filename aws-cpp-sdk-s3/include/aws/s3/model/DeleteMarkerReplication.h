@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -48,6 +49,8 @@ namespace Model
     DeleteMarkerReplication();
     DeleteMarkerReplication(const Aws::Utils::Xml::XmlNode& xmlNode);
     DeleteMarkerReplication& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    DeleteMarkerReplication(Aws::Utils::Xml::XmlReader& reader);
+    DeleteMarkerReplication& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
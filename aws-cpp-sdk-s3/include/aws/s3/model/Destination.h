@@ -20,6 +20,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -40,6 +41,8 @@ namespace Model
     Destination();
     Destination(const Aws::Utils::Xml::XmlNode& xmlNode);
     Destination& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Destination(Aws::Utils::Xml::XmlReader& reader);
+    Destination& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     ExistingObjectReplication();
     ExistingObjectReplication(const Aws::Utils::Xml::XmlNode& xmlNode);
     ExistingObjectReplication& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ExistingObjectReplication(Aws::Utils::Xml::XmlReader& reader);
+    ExistingObjectReplication& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
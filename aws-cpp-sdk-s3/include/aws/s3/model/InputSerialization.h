@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     InputSerialization();
     InputSerialization(const Aws::Utils::Xml::XmlNode& xmlNode);
     InputSerialization& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    InputSerialization(Aws::Utils::Xml::XmlReader& reader);
+    InputSerialization& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
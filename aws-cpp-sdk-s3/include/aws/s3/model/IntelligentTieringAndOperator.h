@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     IntelligentTieringAndOperator();
     IntelligentTieringAndOperator(const Aws::Utils::Xml::XmlNode& xmlNode);
     IntelligentTieringAndOperator& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    IntelligentTieringAndOperator(Aws::Utils::Xml::XmlReader& reader);
+    IntelligentTieringAndOperator& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -19,6 +19,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -42,6 +43,8 @@ namespace Model
     IntelligentTieringConfiguration();
     IntelligentTieringConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     IntelligentTieringConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    IntelligentTieringConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    IntelligentTieringConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
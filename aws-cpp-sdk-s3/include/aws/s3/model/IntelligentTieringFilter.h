@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     IntelligentTieringFilter();
     IntelligentTieringFilter(const Aws::Utils::Xml::XmlNode& xmlNode);
     IntelligentTieringFilter& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    IntelligentTieringFilter(Aws::Utils::Xml::XmlReader& reader);
+    IntelligentTieringFilter& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -21,6 +21,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -43,6 +44,8 @@ namespace Model
     InventoryConfiguration();
     InventoryConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     InventoryConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    InventoryConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    InventoryConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     InventoryEncryption();
     InventoryEncryption(const Aws::Utils::Xml::XmlNode& xmlNode);
     InventoryEncryption& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    InventoryEncryption(Aws::Utils::Xml::XmlReader& reader);
+    InventoryEncryption& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
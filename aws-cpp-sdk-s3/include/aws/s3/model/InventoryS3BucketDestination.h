@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     InventoryS3BucketDestination();
     InventoryS3BucketDestination(const Aws::Utils::Xml::XmlNode& xmlNode);
     InventoryS3BucketDestination& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    InventoryS3BucketDestination(Aws::Utils::Xml::XmlReader& reader);
+    InventoryS3BucketDestination& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
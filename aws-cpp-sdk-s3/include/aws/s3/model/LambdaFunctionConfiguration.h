@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     LambdaFunctionConfiguration();
     LambdaFunctionConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     LambdaFunctionConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    LambdaFunctionConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    LambdaFunctionConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
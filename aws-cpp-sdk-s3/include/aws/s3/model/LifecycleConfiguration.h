@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     LifecycleConfiguration();
     LifecycleConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     LifecycleConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    LifecycleConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    LifecycleConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -23,6 +23,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -42,6 +43,8 @@ namespace Model
     LifecycleRule();
     LifecycleRule(const Aws::Utils::Xml::XmlNode& xmlNode);
     LifecycleRule& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    LifecycleRule(Aws::Utils::Xml::XmlReader& reader);
+    LifecycleRule& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
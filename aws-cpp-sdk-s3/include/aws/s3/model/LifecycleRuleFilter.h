@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     LifecycleRuleFilter();
     LifecycleRuleFilter(const Aws::Utils::Xml::XmlNode& xmlNode);
     LifecycleRuleFilter& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    LifecycleRuleFilter(Aws::Utils::Xml::XmlReader& reader);
+    LifecycleRuleFilter& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -39,6 +40,8 @@ namespace Model
     LoggingEnabled();
     LoggingEnabled(const Aws::Utils::Xml::XmlNode& xmlNode);
     LoggingEnabled& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    LoggingEnabled(Aws::Utils::Xml::XmlReader& reader);
+    LoggingEnabled& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
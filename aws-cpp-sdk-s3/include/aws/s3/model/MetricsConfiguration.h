@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -41,6 +42,8 @@ namespace Model
     MetricsConfiguration();
     MetricsConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     MetricsConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    MetricsConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    MetricsConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
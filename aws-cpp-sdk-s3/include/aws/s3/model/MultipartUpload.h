@@ -19,6 +19,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     MultipartUpload();
     MultipartUpload(const Aws::Utils::Xml::XmlNode& xmlNode);
     MultipartUpload& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    MultipartUpload(Aws::Utils::Xml::XmlReader& reader);
+    MultipartUpload& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
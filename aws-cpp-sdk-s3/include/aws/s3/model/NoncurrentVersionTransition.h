@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -41,6 +42,8 @@ namespace Model
     NoncurrentVersionTransition();
     NoncurrentVersionTransition(const Aws::Utils::Xml::XmlNode& xmlNode);
     NoncurrentVersionTransition& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    NoncurrentVersionTransition(Aws::Utils::Xml::XmlReader& reader);
+    NoncurrentVersionTransition& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
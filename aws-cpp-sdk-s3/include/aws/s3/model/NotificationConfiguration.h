@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     NotificationConfiguration();
     NotificationConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     NotificationConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    NotificationConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    NotificationConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -30,6 +31,8 @@ namespace Model
     NotificationConfigurationDeprecated();
     NotificationConfigurationDeprecated(const Aws::Utils::Xml::XmlNode& xmlNode);
     NotificationConfigurationDeprecated& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    NotificationConfigurationDeprecated(Aws::Utils::Xml::XmlReader& reader);
+    NotificationConfigurationDeprecated& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
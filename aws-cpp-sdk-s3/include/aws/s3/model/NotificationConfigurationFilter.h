@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     NotificationConfigurationFilter();
     NotificationConfigurationFilter(const Aws::Utils::Xml::XmlNode& xmlNode);
     NotificationConfigurationFilter& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    NotificationConfigurationFilter(Aws::Utils::Xml::XmlReader& reader);
+    NotificationConfigurationFilter& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
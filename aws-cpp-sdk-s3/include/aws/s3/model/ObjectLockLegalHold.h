@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -33,6 +34,8 @@ namespace Model
     ObjectLockLegalHold();
     ObjectLockLegalHold(const Aws::Utils::Xml::XmlNode& xmlNode);
     ObjectLockLegalHold& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ObjectLockLegalHold(Aws::Utils::Xml::XmlReader& reader);
+    ObjectLockLegalHold& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -31,6 +32,8 @@ namespace Model
     ParquetInput();
     ParquetInput(const Aws::Utils::Xml::XmlNode& xmlNode);
     ParquetInput& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ParquetInput(Aws::Utils::Xml::XmlReader& reader);
+    ParquetInput& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -34,6 +35,8 @@ namespace Model
     Part();
     Part(const Aws::Utils::Xml::XmlNode& xmlNode);
     Part& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Part(Aws::Utils::Xml::XmlReader& reader);
+    Part& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
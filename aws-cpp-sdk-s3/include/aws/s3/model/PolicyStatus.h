@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -31,6 +32,8 @@ namespace Model
     PolicyStatus();
     PolicyStatus(const Aws::Utils::Xml::XmlNode& xmlNode);
     PolicyStatus& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    PolicyStatus(Aws::Utils::Xml::XmlReader& reader);
+    PolicyStatus& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -32,6 +33,8 @@ namespace Model
     Progress();
     Progress(const Aws::Utils::Xml::XmlNode& xmlNode);
     Progress& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Progress(Aws::Utils::Xml::XmlReader& reader);
+    Progress& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     PublicAccessBlockConfiguration();
     PublicAccessBlockConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     PublicAccessBlockConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    PublicAccessBlockConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    PublicAccessBlockConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
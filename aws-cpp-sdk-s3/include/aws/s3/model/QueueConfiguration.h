@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     QueueConfiguration();
     QueueConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     QueueConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    QueueConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    QueueConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -39,6 +40,8 @@ namespace Model
     QueueConfigurationDeprecated();
     QueueConfigurationDeprecated(const Aws::Utils::Xml::XmlNode& xmlNode);
     QueueConfigurationDeprecated& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    QueueConfigurationDeprecated(Aws::Utils::Xml::XmlReader& reader);
+    QueueConfigurationDeprecated& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
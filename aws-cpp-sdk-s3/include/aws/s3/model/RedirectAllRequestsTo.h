@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     RedirectAllRequestsTo();
     RedirectAllRequestsTo(const Aws::Utils::Xml::XmlNode& xmlNode);
     RedirectAllRequestsTo& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    RedirectAllRequestsTo(Aws::Utils::Xml::XmlReader& reader);
+    RedirectAllRequestsTo& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
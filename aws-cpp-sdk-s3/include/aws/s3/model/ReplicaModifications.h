@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -40,6 +41,8 @@ namespace Model
     ReplicaModifications();
     ReplicaModifications(const Aws::Utils::Xml::XmlNode& xmlNode);
     ReplicaModifications& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ReplicaModifications(Aws::Utils::Xml::XmlReader& reader);
+    ReplicaModifications& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
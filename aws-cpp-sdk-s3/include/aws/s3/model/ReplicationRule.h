@@ -21,6 +21,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -40,6 +41,8 @@ namespace Model
     ReplicationRule();
     ReplicationRule(const Aws::Utils::Xml::XmlNode& xmlNode);
     ReplicationRule& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ReplicationRule(Aws::Utils::Xml::XmlReader& reader);
+    ReplicationRule& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -17,6 +17,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -41,6 +42,8 @@ namespace Model
     ReplicationRuleAndOperator();
     ReplicationRuleAndOperator(const Aws::Utils::Xml::XmlNode& xmlNode);
     ReplicationRuleAndOperator& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ReplicationRuleAndOperator(Aws::Utils::Xml::XmlReader& reader);
+    ReplicationRuleAndOperator& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -37,6 +38,8 @@ namespace Model
     ReplicationTime();
     ReplicationTime(const Aws::Utils::Xml::XmlNode& xmlNode);
     ReplicationTime& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ReplicationTime(Aws::Utils::Xml::XmlReader& reader);
+    ReplicationTime& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
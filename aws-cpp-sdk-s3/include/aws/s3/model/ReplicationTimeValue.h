@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -33,6 +34,8 @@ namespace Model
     ReplicationTimeValue();
     ReplicationTimeValue(const Aws::Utils::Xml::XmlNode& xmlNode);
     ReplicationTimeValue& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ReplicationTimeValue(Aws::Utils::Xml::XmlReader& reader);
+    ReplicationTimeValue& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
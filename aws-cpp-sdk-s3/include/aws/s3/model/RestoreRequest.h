@@ -20,6 +20,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     RestoreRequest();
     RestoreRequest(const Aws::Utils::Xml::XmlNode& xmlNode);
     RestoreRequest& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    RestoreRequest(Aws::Utils::Xml::XmlReader& reader);
+    RestoreRequest& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
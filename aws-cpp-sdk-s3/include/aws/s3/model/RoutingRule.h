@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     RoutingRule();
     RoutingRule(const Aws::Utils::Xml::XmlNode& xmlNode);
     RoutingRule& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    RoutingRule(Aws::Utils::Xml::XmlReader& reader);
+    RoutingRule& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -21,6 +21,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -45,6 +46,8 @@ namespace Model
     Rule();
     Rule(const Aws::Utils::Xml::XmlNode& xmlNode);
     Rule& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Rule(Aws::Utils::Xml::XmlReader& reader);
+    Rule& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     S3KeyFilter();
     S3KeyFilter(const Aws::Utils::Xml::XmlNode& xmlNode);
     S3KeyFilter& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    S3KeyFilter(Aws::Utils::Xml::XmlReader& reader);
+    S3KeyFilter& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
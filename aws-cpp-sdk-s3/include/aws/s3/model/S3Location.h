@@ -22,6 +22,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -41,6 +42,8 @@ namespace Model
     S3Location();
     S3Location(const Aws::Utils::Xml::XmlNode& xmlNode);
     S3Location& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    S3Location(Aws::Utils::Xml::XmlReader& reader);
+    S3Location& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
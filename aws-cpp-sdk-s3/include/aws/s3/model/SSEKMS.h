@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -34,6 +35,8 @@ namespace Model
     SSEKMS();
     SSEKMS(const Aws::Utils::Xml::XmlNode& xmlNode);
     SSEKMS& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    SSEKMS(Aws::Utils::Xml::XmlReader& reader);
+    SSEKMS& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
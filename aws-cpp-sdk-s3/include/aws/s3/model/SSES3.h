@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -32,6 +33,8 @@ namespace Model
     SSES3();
     SSES3(const Aws::Utils::Xml::XmlNode& xmlNode);
     SSES3& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    SSES3(Aws::Utils::Xml::XmlReader& reader);
+    SSES3& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     ScanRange();
     ScanRange(const Aws::Utils::Xml::XmlNode& xmlNode);
     ScanRange& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ScanRange(Aws::Utils::Xml::XmlReader& reader);
+    ScanRange& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -36,6 +37,8 @@ namespace Model
     SelectParameters();
     SelectParameters(const Aws::Utils::Xml::XmlNode& xmlNode);
     SelectParameters& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    SelectParameters(Aws::Utils::Xml::XmlReader& reader);
+    SelectParameters& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -39,6 +40,8 @@ namespace Model
     ServerSideEncryptionByDefault();
     ServerSideEncryptionByDefault(const Aws::Utils::Xml::XmlNode& xmlNode);
     ServerSideEncryptionByDefault& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ServerSideEncryptionByDefault(Aws::Utils::Xml::XmlReader& reader);
+    ServerSideEncryptionByDefault& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -39,6 +40,8 @@ namespace Model
     SourceSelectionCriteria();
     SourceSelectionCriteria(const Aws::Utils::Xml::XmlNode& xmlNode);
     SourceSelectionCriteria& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    SourceSelectionCriteria(Aws::Utils::Xml::XmlReader& reader);
+    SourceSelectionCriteria& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -13,6 +13,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -31,6 +32,8 @@ namespace Model
     Stats();
     Stats(const Aws::Utils::Xml::XmlNode& xmlNode);
     Stats& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Stats(Aws::Utils::Xml::XmlReader& reader);
+    Stats& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
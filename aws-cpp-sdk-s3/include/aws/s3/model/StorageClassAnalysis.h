@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     StorageClassAnalysis();
     StorageClassAnalysis(const Aws::Utils::Xml::XmlNode& xmlNode);
     StorageClassAnalysis& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    StorageClassAnalysis(Aws::Utils::Xml::XmlReader& reader);
+    StorageClassAnalysis& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -35,6 +36,8 @@ namespace Model
     StorageClassAnalysisDataExport();
     StorageClassAnalysisDataExport(const Aws::Utils::Xml::XmlNode& xmlNode);
     StorageClassAnalysisDataExport& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    StorageClassAnalysisDataExport(Aws::Utils::Xml::XmlReader& reader);
+    StorageClassAnalysisDataExport& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
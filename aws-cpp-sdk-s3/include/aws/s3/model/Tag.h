@@ -15,6 +15,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -33,6 +34,8 @@ namespace Model
     Tag();
     Tag(const Aws::Utils::Xml::XmlNode& xmlNode);
     Tag& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Tag(Aws::Utils::Xml::XmlReader& reader);
+    Tag& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     TopicConfiguration();
     TopicConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     TopicConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    TopicConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    TopicConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     Transition();
     Transition(const Aws::Utils::Xml::XmlNode& xmlNode);
     Transition& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Transition(Aws::Utils::Xml::XmlReader& reader);
+    Transition& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
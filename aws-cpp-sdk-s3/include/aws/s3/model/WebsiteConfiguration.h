@@ -19,6 +19,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -38,6 +39,8 @@ namespace Model
     WebsiteConfiguration();
     WebsiteConfiguration(const Aws::Utils::Xml::XmlNode& xmlNode);
     WebsiteConfiguration& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    WebsiteConfiguration(Aws::Utils::Xml::XmlReader& reader);
+    WebsiteConfiguration& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
 
@@ -12,6 +12,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -226,7 +227,7 @@ AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartU
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return AbortMultipartUploadOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return AbortMultipartUploadOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
@@ -244,7 +245,44 @@ void S3Client::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& requ
 
 void S3Client::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AbortMultipartUpload(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, AbortMultipartUpload(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("AbortMultipartUpload", "Required field: Bucket, is not set");
+    handler(this, request, AbortMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("AbortMultipartUpload", "Required field: Key, is not set");
+    handler(this, request, AbortMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  if (!request.UploadIdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("AbortMultipartUpload", "Required field: UploadId, is not set");
+    handler(this, request, AbortMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [UploadId]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, AbortMultipartUploadOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AbortMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, AbortMultipartUploadOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const
@@ -274,7 +312,7 @@ CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteM
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return CompleteMultipartUploadOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return CompleteMultipartUploadOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
@@ -292,7 +330,44 @@ void S3Client::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest
 
 void S3Client::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CompleteMultipartUpload(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CompleteMultipartUpload(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CompleteMultipartUpload", "Required field: Bucket, is not set");
+    handler(this, request, CompleteMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CompleteMultipartUpload", "Required field: Key, is not set");
+    handler(this, request, CompleteMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  if (!request.UploadIdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CompleteMultipartUpload", "Required field: UploadId, is not set");
+    handler(this, request, CompleteMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [UploadId]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, CompleteMultipartUploadOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CompleteMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, CompleteMultipartUploadOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
@@ -322,7 +397,7 @@ CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return CopyObjectOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return CopyObjectOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 CopyObjectOutcomeCallable S3Client::CopyObjectCallable(const CopyObjectRequest& request) const
@@ -340,7 +415,44 @@ void S3Client::CopyObjectAsync(const CopyObjectRequest& request, const CopyObjec
 
 void S3Client::CopyObjectAsyncHelper(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CopyObject(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CopyObject(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CopyObject", "Required field: Bucket, is not set");
+    handler(this, request, CopyObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.CopySourceHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CopyObject", "Required field: CopySource, is not set");
+    handler(this, request, CopyObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [CopySource]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CopyObject", "Required field: Key, is not set");
+    handler(this, request, CopyObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, CopyObjectOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CopyObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, CopyObjectOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) const
@@ -360,7 +472,7 @@ CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) c
   ss << "/";
   ss << request.GetBucket();
   uri.SetPath(uri.GetPath() + ss.str());
-  return CreateBucketOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return CreateBucketOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 CreateBucketOutcomeCallable S3Client::CreateBucketCallable(const CreateBucketRequest& request) const
@@ -378,7 +490,32 @@ void S3Client::CreateBucketAsync(const CreateBucketRequest& request, const Creat
 
 void S3Client::CreateBucketAsyncHelper(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateBucket(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CreateBucket(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CreateBucket", "Required field: Bucket, is not set");
+    handler(this, request, CreateBucketOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString();
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, CreateBucketOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetBucket();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, CreateBucketOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipartUploadRequest& request) const
@@ -405,7 +542,7 @@ CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipa
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?uploads");
   uri.SetQueryString(ss.str());
-  return CreateMultipartUploadOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return CreateMultipartUploadOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(const CreateMultipartUploadRequest& request) const
@@ -423,7 +560,40 @@ void S3Client::CreateMultipartUploadAsync(const CreateMultipartUploadRequest& re
 
 void S3Client::CreateMultipartUploadAsyncHelper(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateMultipartUpload(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CreateMultipartUpload(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CreateMultipartUpload", "Required field: Bucket, is not set");
+    handler(this, request, CreateMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("CreateMultipartUpload", "Required field: Key, is not set");
+    handler(this, request, CreateMultipartUploadOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, CreateMultipartUploadOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?uploads");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, CreateMultipartUploadOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) const
@@ -441,7 +611,7 @@ DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) c
   Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
   Aws::StringStream ss;
   uri.SetPath(uri.GetPath() + ss.str());
-  return DeleteBucketOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(const DeleteBucketRequest& request) const
@@ -459,7 +629,30 @@ void S3Client::DeleteBucketAsync(const DeleteBucketRequest& request, const Delet
 
 void S3Client::DeleteBucketAsyncHelper(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucket(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucket(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucket", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketAnalyticsConfigurationOutcome S3Client::DeleteBucketAnalyticsConfiguration(const DeleteBucketAnalyticsConfigurationRequest& request) const
@@ -483,7 +676,7 @@ DeleteBucketAnalyticsConfigurationOutcome S3Client::DeleteBucketAnalyticsConfigu
   Aws::StringStream ss;
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
-  return DeleteBucketAnalyticsConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketAnalyticsConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketAnalyticsConfigurationOutcomeCallable S3Client::DeleteBucketAnalyticsConfigurationCallable(const DeleteBucketAnalyticsConfigurationRequest& request) const
@@ -501,7 +694,37 @@ void S3Client::DeleteBucketAnalyticsConfigurationAsync(const DeleteBucketAnalyti
 
 void S3Client::DeleteBucketAnalyticsConfigurationAsyncHelper(const DeleteBucketAnalyticsConfigurationRequest& request, const DeleteBucketAnalyticsConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketAnalyticsConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketAnalyticsConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketAnalyticsConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketAnalyticsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketAnalyticsConfiguration", "Required field: Id, is not set");
+    handler(this, request, DeleteBucketAnalyticsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketAnalyticsConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?analytics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketAnalyticsConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketAnalyticsConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest& request) const
@@ -520,7 +743,7 @@ DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest
   Aws::StringStream ss;
   ss.str("?cors");
   uri.SetQueryString(ss.str());
-  return DeleteBucketCorsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketCorsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(const DeleteBucketCorsRequest& request) const
@@ -538,7 +761,31 @@ void S3Client::DeleteBucketCorsAsync(const DeleteBucketCorsRequest& request, con
 
 void S3Client::DeleteBucketCorsAsyncHelper(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketCors(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketCors(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketCors", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketCorsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketCorsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?cors");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketCorsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketEncryptionOutcome S3Client::DeleteBucketEncryption(const DeleteBucketEncryptionRequest& request) const
@@ -557,7 +804,7 @@ DeleteBucketEncryptionOutcome S3Client::DeleteBucketEncryption(const DeleteBucke
   Aws::StringStream ss;
   ss.str("?encryption");
   uri.SetQueryString(ss.str());
-  return DeleteBucketEncryptionOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketEncryptionOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketEncryptionOutcomeCallable S3Client::DeleteBucketEncryptionCallable(const DeleteBucketEncryptionRequest& request) const
@@ -575,7 +822,31 @@ void S3Client::DeleteBucketEncryptionAsync(const DeleteBucketEncryptionRequest&
 
 void S3Client::DeleteBucketEncryptionAsyncHelper(const DeleteBucketEncryptionRequest& request, const DeleteBucketEncryptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketEncryption(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketEncryption(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketEncryption", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketEncryptionOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketEncryptionOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?encryption");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketEncryptionRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketEncryptionOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketIntelligentTieringConfigurationOutcome S3Client::DeleteBucketIntelligentTieringConfiguration(const DeleteBucketIntelligentTieringConfigurationRequest& request) const
@@ -599,7 +870,7 @@ DeleteBucketIntelligentTieringConfigurationOutcome S3Client::DeleteBucketIntelli
   Aws::StringStream ss;
   ss.str("?intelligent-tiering");
   uri.SetQueryString(ss.str());
-  return DeleteBucketIntelligentTieringConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketIntelligentTieringConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketIntelligentTieringConfigurationOutcomeCallable S3Client::DeleteBucketIntelligentTieringConfigurationCallable(const DeleteBucketIntelligentTieringConfigurationRequest& request) const
@@ -617,7 +888,37 @@ void S3Client::DeleteBucketIntelligentTieringConfigurationAsync(const DeleteBuck
 
 void S3Client::DeleteBucketIntelligentTieringConfigurationAsyncHelper(const DeleteBucketIntelligentTieringConfigurationRequest& request, const DeleteBucketIntelligentTieringConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketIntelligentTieringConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketIntelligentTieringConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketIntelligentTieringConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketIntelligentTieringConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketIntelligentTieringConfiguration", "Required field: Id, is not set");
+    handler(this, request, DeleteBucketIntelligentTieringConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketIntelligentTieringConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?intelligent-tiering");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketIntelligentTieringConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketIntelligentTieringConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketInventoryConfigurationOutcome S3Client::DeleteBucketInventoryConfiguration(const DeleteBucketInventoryConfigurationRequest& request) const
@@ -641,7 +942,7 @@ DeleteBucketInventoryConfigurationOutcome S3Client::DeleteBucketInventoryConfigu
   Aws::StringStream ss;
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
-  return DeleteBucketInventoryConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketInventoryConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketInventoryConfigurationOutcomeCallable S3Client::DeleteBucketInventoryConfigurationCallable(const DeleteBucketInventoryConfigurationRequest& request) const
@@ -659,7 +960,37 @@ void S3Client::DeleteBucketInventoryConfigurationAsync(const DeleteBucketInvento
 
 void S3Client::DeleteBucketInventoryConfigurationAsyncHelper(const DeleteBucketInventoryConfigurationRequest& request, const DeleteBucketInventoryConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketInventoryConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketInventoryConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketInventoryConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketInventoryConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketInventoryConfiguration", "Required field: Id, is not set");
+    handler(this, request, DeleteBucketInventoryConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketInventoryConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?inventory");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketInventoryConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketInventoryConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketLifecycleRequest& request) const
@@ -678,7 +1009,7 @@ DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketL
   Aws::StringStream ss;
   ss.str("?lifecycle");
   uri.SetQueryString(ss.str());
-  return DeleteBucketLifecycleOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketLifecycleOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(const DeleteBucketLifecycleRequest& request) const
@@ -696,7 +1027,31 @@ void S3Client::DeleteBucketLifecycleAsync(const DeleteBucketLifecycleRequest& re
 
 void S3Client::DeleteBucketLifecycleAsyncHelper(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketLifecycle(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketLifecycle(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketLifecycle", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketLifecycleOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketLifecycleOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?lifecycle");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketLifecycleRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketLifecycleOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketMetricsConfigurationOutcome S3Client::DeleteBucketMetricsConfiguration(const DeleteBucketMetricsConfigurationRequest& request) const
@@ -720,7 +1075,7 @@ DeleteBucketMetricsConfigurationOutcome S3Client::DeleteBucketMetricsConfigurati
   Aws::StringStream ss;
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
-  return DeleteBucketMetricsConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketMetricsConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketMetricsConfigurationOutcomeCallable S3Client::DeleteBucketMetricsConfigurationCallable(const DeleteBucketMetricsConfigurationRequest& request) const
@@ -738,7 +1093,37 @@ void S3Client::DeleteBucketMetricsConfigurationAsync(const DeleteBucketMetricsCo
 
 void S3Client::DeleteBucketMetricsConfigurationAsyncHelper(const DeleteBucketMetricsConfigurationRequest& request, const DeleteBucketMetricsConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketMetricsConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketMetricsConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketMetricsConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketMetricsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketMetricsConfiguration", "Required field: Id, is not set");
+    handler(this, request, DeleteBucketMetricsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketMetricsConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?metrics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketMetricsConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketMetricsConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketOwnershipControlsOutcome S3Client::DeleteBucketOwnershipControls(const DeleteBucketOwnershipControlsRequest& request) const
@@ -757,7 +1142,7 @@ DeleteBucketOwnershipControlsOutcome S3Client::DeleteBucketOwnershipControls(con
   Aws::StringStream ss;
   ss.str("?ownershipControls");
   uri.SetQueryString(ss.str());
-  return DeleteBucketOwnershipControlsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketOwnershipControlsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketOwnershipControlsOutcomeCallable S3Client::DeleteBucketOwnershipControlsCallable(const DeleteBucketOwnershipControlsRequest& request) const
@@ -775,7 +1160,31 @@ void S3Client::DeleteBucketOwnershipControlsAsync(const DeleteBucketOwnershipCon
 
 void S3Client::DeleteBucketOwnershipControlsAsyncHelper(const DeleteBucketOwnershipControlsRequest& request, const DeleteBucketOwnershipControlsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketOwnershipControls(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketOwnershipControls(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketOwnershipControls", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketOwnershipControlsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketOwnershipControlsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?ownershipControls");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketOwnershipControlsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketOwnershipControlsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyRequest& request) const
@@ -794,7 +1203,7 @@ DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyR
   Aws::StringStream ss;
   ss.str("?policy");
   uri.SetQueryString(ss.str());
-  return DeleteBucketPolicyOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketPolicyOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(const DeleteBucketPolicyRequest& request) const
@@ -812,26 +1221,50 @@ void S3Client::DeleteBucketPolicyAsync(const DeleteBucketPolicyRequest& request,
 
 void S3Client::DeleteBucketPolicyAsyncHelper(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketPolicy(request), context);
-}
-
-DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBucketReplicationRequest& request) const
-{
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketPolicy(request), context);
+    return;
+  }
   if (!request.BucketHasBeenSet())
   {
-    AWS_LOGSTREAM_ERROR("DeleteBucketReplication", "Required field: Bucket, is not set");
-    return DeleteBucketReplicationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false));
+    AWS_LOGSTREAM_ERROR("DeleteBucketPolicy", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketPolicyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
   }
   ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
   if (!computeEndpointOutcome.IsSuccess())
   {
-    return DeleteBucketReplicationOutcome(computeEndpointOutcome.GetError());
+    handler(this, request, DeleteBucketPolicyOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?policy");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketPolicyOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
+}
+
+DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBucketReplicationRequest& request) const
+{
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketReplication", "Required field: Bucket, is not set");
+    return DeleteBucketReplicationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false));
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    return DeleteBucketReplicationOutcome(computeEndpointOutcome.GetError());
   }
   Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
   Aws::StringStream ss;
   ss.str("?replication");
   uri.SetQueryString(ss.str());
-  return DeleteBucketReplicationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketReplicationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable(const DeleteBucketReplicationRequest& request) const
@@ -849,7 +1282,31 @@ void S3Client::DeleteBucketReplicationAsync(const DeleteBucketReplicationRequest
 
 void S3Client::DeleteBucketReplicationAsyncHelper(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketReplication(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketReplication(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketReplication", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketReplicationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketReplicationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?replication");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketReplicationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggingRequest& request) const
@@ -868,7 +1325,7 @@ DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggi
   Aws::StringStream ss;
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
-  return DeleteBucketTaggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketTaggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(const DeleteBucketTaggingRequest& request) const
@@ -886,7 +1343,31 @@ void S3Client::DeleteBucketTaggingAsync(const DeleteBucketTaggingRequest& reques
 
 void S3Client::DeleteBucketTaggingAsyncHelper(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketTagging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketTagging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketTagging", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketTaggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?tagging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketTaggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsiteRequest& request) const
@@ -905,7 +1386,7 @@ DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsi
   Aws::StringStream ss;
   ss.str("?website");
   uri.SetQueryString(ss.str());
-  return DeleteBucketWebsiteOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteBucketWebsiteOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(const DeleteBucketWebsiteRequest& request) const
@@ -923,7 +1404,31 @@ void S3Client::DeleteBucketWebsiteAsync(const DeleteBucketWebsiteRequest& reques
 
 void S3Client::DeleteBucketWebsiteAsyncHelper(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketWebsite(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteBucketWebsite(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteBucketWebsite", "Required field: Bucket, is not set");
+    handler(this, request, DeleteBucketWebsiteOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteBucketWebsiteOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?website");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteBucketWebsiteOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) const
@@ -948,7 +1453,7 @@ DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) c
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return DeleteObjectOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteObjectOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(const DeleteObjectRequest& request) const
@@ -966,7 +1471,38 @@ void S3Client::DeleteObjectAsync(const DeleteObjectRequest& request, const Delet
 
 void S3Client::DeleteObjectAsyncHelper(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteObject(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteObject(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteObject", "Required field: Bucket, is not set");
+    handler(this, request, DeleteObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteObject", "Required field: Key, is not set");
+    handler(this, request, DeleteObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteObjectOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteObjectOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteObjectTaggingOutcome S3Client::DeleteObjectTagging(const DeleteObjectTaggingRequest& request) const
@@ -993,7 +1529,7 @@ DeleteObjectTaggingOutcome S3Client::DeleteObjectTagging(const DeleteObjectTaggi
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
-  return DeleteObjectTaggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteObjectTaggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteObjectTaggingOutcomeCallable S3Client::DeleteObjectTaggingCallable(const DeleteObjectTaggingRequest& request) const
@@ -1011,7 +1547,40 @@ void S3Client::DeleteObjectTaggingAsync(const DeleteObjectTaggingRequest& reques
 
 void S3Client::DeleteObjectTaggingAsyncHelper(const DeleteObjectTaggingRequest& request, const DeleteObjectTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteObjectTagging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteObjectTagging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteObjectTagging", "Required field: Bucket, is not set");
+    handler(this, request, DeleteObjectTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteObjectTagging", "Required field: Key, is not set");
+    handler(this, request, DeleteObjectTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteObjectTaggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?tagging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteObjectTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteObjectTaggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request) const
@@ -1030,7 +1599,7 @@ DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request
   Aws::StringStream ss;
   ss.str("?delete");
   uri.SetQueryString(ss.str());
-  return DeleteObjectsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeleteObjectsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(const DeleteObjectsRequest& request) const
@@ -1048,7 +1617,31 @@ void S3Client::DeleteObjectsAsync(const DeleteObjectsRequest& request, const Del
 
 void S3Client::DeleteObjectsAsyncHelper(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteObjects(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteObjects(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeleteObjects", "Required field: Bucket, is not set");
+    handler(this, request, DeleteObjectsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeleteObjectsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?delete");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteObjectsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteObjectsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 DeletePublicAccessBlockOutcome S3Client::DeletePublicAccessBlock(const DeletePublicAccessBlockRequest& request) const
@@ -1067,7 +1660,7 @@ DeletePublicAccessBlockOutcome S3Client::DeletePublicAccessBlock(const DeletePub
   Aws::StringStream ss;
   ss.str("?publicAccessBlock");
   uri.SetQueryString(ss.str());
-  return DeletePublicAccessBlockOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return DeletePublicAccessBlockOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 DeletePublicAccessBlockOutcomeCallable S3Client::DeletePublicAccessBlockCallable(const DeletePublicAccessBlockRequest& request) const
@@ -1085,7 +1678,31 @@ void S3Client::DeletePublicAccessBlockAsync(const DeletePublicAccessBlockRequest
 
 void S3Client::DeletePublicAccessBlockAsyncHelper(const DeletePublicAccessBlockRequest& request, const DeletePublicAccessBlockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeletePublicAccessBlock(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeletePublicAccessBlock(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("DeletePublicAccessBlock", "Required field: Bucket, is not set");
+    handler(this, request, DeletePublicAccessBlockOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, DeletePublicAccessBlockOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?publicAccessBlock");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<DeletePublicAccessBlockRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, DeletePublicAccessBlockOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketAccelerateConfigurationOutcome S3Client::GetBucketAccelerateConfiguration(const GetBucketAccelerateConfigurationRequest& request) const
@@ -1104,7 +1721,7 @@ GetBucketAccelerateConfigurationOutcome S3Client::GetBucketAccelerateConfigurati
   Aws::StringStream ss;
   ss.str("?accelerate");
   uri.SetQueryString(ss.str());
-  return GetBucketAccelerateConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketAccelerateConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketAccelerateConfigurationOutcomeCallable S3Client::GetBucketAccelerateConfigurationCallable(const GetBucketAccelerateConfigurationRequest& request) const
@@ -1122,7 +1739,31 @@ void S3Client::GetBucketAccelerateConfigurationAsync(const GetBucketAccelerateCo
 
 void S3Client::GetBucketAccelerateConfigurationAsyncHelper(const GetBucketAccelerateConfigurationRequest& request, const GetBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketAccelerateConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketAccelerateConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketAccelerateConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketAccelerateConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketAccelerateConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?accelerate");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketAccelerateConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketAccelerateConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) const
@@ -1141,7 +1782,7 @@ GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) c
   Aws::StringStream ss;
   ss.str("?acl");
   uri.SetQueryString(ss.str());
-  return GetBucketAclOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketAclOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(const GetBucketAclRequest& request) const
@@ -1159,7 +1800,31 @@ void S3Client::GetBucketAclAsync(const GetBucketAclRequest& request, const GetBu
 
 void S3Client::GetBucketAclAsyncHelper(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketAcl(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketAcl(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketAcl", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketAclOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketAclOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?acl");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketAclOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketAnalyticsConfigurationOutcome S3Client::GetBucketAnalyticsConfiguration(const GetBucketAnalyticsConfigurationRequest& request) const
@@ -1183,7 +1848,7 @@ GetBucketAnalyticsConfigurationOutcome S3Client::GetBucketAnalyticsConfiguration
   Aws::StringStream ss;
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
-  return GetBucketAnalyticsConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketAnalyticsConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketAnalyticsConfigurationOutcomeCallable S3Client::GetBucketAnalyticsConfigurationCallable(const GetBucketAnalyticsConfigurationRequest& request) const
@@ -1201,7 +1866,37 @@ void S3Client::GetBucketAnalyticsConfigurationAsync(const GetBucketAnalyticsConf
 
 void S3Client::GetBucketAnalyticsConfigurationAsyncHelper(const GetBucketAnalyticsConfigurationRequest& request, const GetBucketAnalyticsConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketAnalyticsConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketAnalyticsConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketAnalyticsConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketAnalyticsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketAnalyticsConfiguration", "Required field: Id, is not set");
+    handler(this, request, GetBucketAnalyticsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketAnalyticsConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?analytics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketAnalyticsConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketAnalyticsConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request) const
@@ -1220,7 +1915,7 @@ GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request
   Aws::StringStream ss;
   ss.str("?cors");
   uri.SetQueryString(ss.str());
-  return GetBucketCorsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketCorsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(const GetBucketCorsRequest& request) const
@@ -1238,7 +1933,31 @@ void S3Client::GetBucketCorsAsync(const GetBucketCorsRequest& request, const Get
 
 void S3Client::GetBucketCorsAsyncHelper(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketCors(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketCors(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketCors", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketCorsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketCorsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?cors");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketCorsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketEncryptionOutcome S3Client::GetBucketEncryption(const GetBucketEncryptionRequest& request) const
@@ -1257,7 +1976,7 @@ GetBucketEncryptionOutcome S3Client::GetBucketEncryption(const GetBucketEncrypti
   Aws::StringStream ss;
   ss.str("?encryption");
   uri.SetQueryString(ss.str());
-  return GetBucketEncryptionOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketEncryptionOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketEncryptionOutcomeCallable S3Client::GetBucketEncryptionCallable(const GetBucketEncryptionRequest& request) const
@@ -1275,7 +1994,31 @@ void S3Client::GetBucketEncryptionAsync(const GetBucketEncryptionRequest& reques
 
 void S3Client::GetBucketEncryptionAsyncHelper(const GetBucketEncryptionRequest& request, const GetBucketEncryptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketEncryption(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketEncryption(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketEncryption", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketEncryptionOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketEncryptionOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?encryption");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketEncryptionRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketEncryptionOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketIntelligentTieringConfigurationOutcome S3Client::GetBucketIntelligentTieringConfiguration(const GetBucketIntelligentTieringConfigurationRequest& request) const
@@ -1299,7 +2042,7 @@ GetBucketIntelligentTieringConfigurationOutcome S3Client::GetBucketIntelligentTi
   Aws::StringStream ss;
   ss.str("?intelligent-tiering");
   uri.SetQueryString(ss.str());
-  return GetBucketIntelligentTieringConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketIntelligentTieringConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketIntelligentTieringConfigurationOutcomeCallable S3Client::GetBucketIntelligentTieringConfigurationCallable(const GetBucketIntelligentTieringConfigurationRequest& request) const
@@ -1317,7 +2060,37 @@ void S3Client::GetBucketIntelligentTieringConfigurationAsync(const GetBucketInte
 
 void S3Client::GetBucketIntelligentTieringConfigurationAsyncHelper(const GetBucketIntelligentTieringConfigurationRequest& request, const GetBucketIntelligentTieringConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketIntelligentTieringConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketIntelligentTieringConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketIntelligentTieringConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketIntelligentTieringConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketIntelligentTieringConfiguration", "Required field: Id, is not set");
+    handler(this, request, GetBucketIntelligentTieringConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketIntelligentTieringConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?intelligent-tiering");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketIntelligentTieringConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketIntelligentTieringConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketInventoryConfigurationOutcome S3Client::GetBucketInventoryConfiguration(const GetBucketInventoryConfigurationRequest& request) const
@@ -1341,7 +2114,7 @@ GetBucketInventoryConfigurationOutcome S3Client::GetBucketInventoryConfiguration
   Aws::StringStream ss;
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
-  return GetBucketInventoryConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketInventoryConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketInventoryConfigurationOutcomeCallable S3Client::GetBucketInventoryConfigurationCallable(const GetBucketInventoryConfigurationRequest& request) const
@@ -1359,7 +2132,37 @@ void S3Client::GetBucketInventoryConfigurationAsync(const GetBucketInventoryConf
 
 void S3Client::GetBucketInventoryConfigurationAsyncHelper(const GetBucketInventoryConfigurationRequest& request, const GetBucketInventoryConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketInventoryConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketInventoryConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketInventoryConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketInventoryConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketInventoryConfiguration", "Required field: Id, is not set");
+    handler(this, request, GetBucketInventoryConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketInventoryConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?inventory");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketInventoryConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketInventoryConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration(const GetBucketLifecycleConfigurationRequest& request) const
@@ -1378,7 +2181,7 @@ GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration
   Aws::StringStream ss;
   ss.str("?lifecycle");
   uri.SetQueryString(ss.str());
-  return GetBucketLifecycleConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketLifecycleConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketLifecycleConfigurationOutcomeCallable S3Client::GetBucketLifecycleConfigurationCallable(const GetBucketLifecycleConfigurationRequest& request) const
@@ -1396,7 +2199,31 @@ void S3Client::GetBucketLifecycleConfigurationAsync(const GetBucketLifecycleConf
 
 void S3Client::GetBucketLifecycleConfigurationAsyncHelper(const GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketLifecycleConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketLifecycleConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketLifecycleConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketLifecycleConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketLifecycleConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?lifecycle");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketLifecycleConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketLifecycleConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequest& request) const
@@ -1415,7 +2242,7 @@ GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequ
   Aws::StringStream ss;
   ss.str("?location");
   uri.SetQueryString(ss.str());
-  return GetBucketLocationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketLocationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(const GetBucketLocationRequest& request) const
@@ -1433,11 +2260,35 @@ void S3Client::GetBucketLocationAsync(const GetBucketLocationRequest& request, c
 
 void S3Client::GetBucketLocationAsyncHelper(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketLocation(request), context);
-}
-
-GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest& request) const
-{
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketLocation(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketLocation", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketLocationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketLocationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?location");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketLocationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketLocationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
+}
+
+GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest& request) const
+{
   if (!request.BucketHasBeenSet())
   {
     AWS_LOGSTREAM_ERROR("GetBucketLogging", "Required field: Bucket, is not set");
@@ -1452,7 +2303,7 @@ GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest
   Aws::StringStream ss;
   ss.str("?logging");
   uri.SetQueryString(ss.str());
-  return GetBucketLoggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketLoggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(const GetBucketLoggingRequest& request) const
@@ -1470,7 +2321,31 @@ void S3Client::GetBucketLoggingAsync(const GetBucketLoggingRequest& request, con
 
 void S3Client::GetBucketLoggingAsyncHelper(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketLogging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketLogging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketLogging", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketLoggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketLoggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?logging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketLoggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketLoggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketMetricsConfigurationOutcome S3Client::GetBucketMetricsConfiguration(const GetBucketMetricsConfigurationRequest& request) const
@@ -1494,7 +2369,7 @@ GetBucketMetricsConfigurationOutcome S3Client::GetBucketMetricsConfiguration(con
   Aws::StringStream ss;
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
-  return GetBucketMetricsConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketMetricsConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketMetricsConfigurationOutcomeCallable S3Client::GetBucketMetricsConfigurationCallable(const GetBucketMetricsConfigurationRequest& request) const
@@ -1512,7 +2387,37 @@ void S3Client::GetBucketMetricsConfigurationAsync(const GetBucketMetricsConfigur
 
 void S3Client::GetBucketMetricsConfigurationAsyncHelper(const GetBucketMetricsConfigurationRequest& request, const GetBucketMetricsConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketMetricsConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketMetricsConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketMetricsConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketMetricsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketMetricsConfiguration", "Required field: Id, is not set");
+    handler(this, request, GetBucketMetricsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketMetricsConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?metrics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketMetricsConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketMetricsConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfiguration(const GetBucketNotificationConfigurationRequest& request) const
@@ -1531,7 +2436,7 @@ GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfigu
   Aws::StringStream ss;
   ss.str("?notification");
   uri.SetQueryString(ss.str());
-  return GetBucketNotificationConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketNotificationConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificationConfigurationCallable(const GetBucketNotificationConfigurationRequest& request) const
@@ -1549,7 +2454,31 @@ void S3Client::GetBucketNotificationConfigurationAsync(const GetBucketNotificati
 
 void S3Client::GetBucketNotificationConfigurationAsyncHelper(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketNotificationConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketNotificationConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketNotificationConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketNotificationConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketNotificationConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?notification");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketNotificationConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketOwnershipControlsOutcome S3Client::GetBucketOwnershipControls(const GetBucketOwnershipControlsRequest& request) const
@@ -1568,7 +2497,7 @@ GetBucketOwnershipControlsOutcome S3Client::GetBucketOwnershipControls(const Get
   Aws::StringStream ss;
   ss.str("?ownershipControls");
   uri.SetQueryString(ss.str());
-  return GetBucketOwnershipControlsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketOwnershipControlsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketOwnershipControlsOutcomeCallable S3Client::GetBucketOwnershipControlsCallable(const GetBucketOwnershipControlsRequest& request) const
@@ -1586,7 +2515,31 @@ void S3Client::GetBucketOwnershipControlsAsync(const GetBucketOwnershipControlsR
 
 void S3Client::GetBucketOwnershipControlsAsyncHelper(const GetBucketOwnershipControlsRequest& request, const GetBucketOwnershipControlsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketOwnershipControls(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketOwnershipControls(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketOwnershipControls", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketOwnershipControlsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketOwnershipControlsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?ownershipControls");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketOwnershipControlsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketOwnershipControlsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& request) const
@@ -1623,7 +2576,31 @@ void S3Client::GetBucketPolicyAsync(const GetBucketPolicyRequest& request, const
 
 void S3Client::GetBucketPolicyAsyncHelper(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketPolicy(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketPolicy(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketPolicy", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketPolicyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketPolicyOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?policy");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::StreamOutcome&& outcome){ handler(this, *sharedRequest, GetBucketPolicyOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketPolicyStatusOutcome S3Client::GetBucketPolicyStatus(const GetBucketPolicyStatusRequest& request) const
@@ -1642,7 +2619,7 @@ GetBucketPolicyStatusOutcome S3Client::GetBucketPolicyStatus(const GetBucketPoli
   Aws::StringStream ss;
   ss.str("?policyStatus");
   uri.SetQueryString(ss.str());
-  return GetBucketPolicyStatusOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketPolicyStatusOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketPolicyStatusOutcomeCallable S3Client::GetBucketPolicyStatusCallable(const GetBucketPolicyStatusRequest& request) const
@@ -1660,7 +2637,31 @@ void S3Client::GetBucketPolicyStatusAsync(const GetBucketPolicyStatusRequest& re
 
 void S3Client::GetBucketPolicyStatusAsyncHelper(const GetBucketPolicyStatusRequest& request, const GetBucketPolicyStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketPolicyStatus(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketPolicyStatus(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketPolicyStatus", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketPolicyStatusOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketPolicyStatusOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?policyStatus");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketPolicyStatusRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketPolicyStatusOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplicationRequest& request) const
@@ -1679,7 +2680,7 @@ GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplic
   Aws::StringStream ss;
   ss.str("?replication");
   uri.SetQueryString(ss.str());
-  return GetBucketReplicationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketReplicationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(const GetBucketReplicationRequest& request) const
@@ -1697,7 +2698,31 @@ void S3Client::GetBucketReplicationAsync(const GetBucketReplicationRequest& requ
 
 void S3Client::GetBucketReplicationAsyncHelper(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketReplication(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketReplication(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketReplication", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketReplicationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketReplicationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?replication");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketReplicationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucketRequestPaymentRequest& request) const
@@ -1716,7 +2741,7 @@ GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucket
   Aws::StringStream ss;
   ss.str("?requestPayment");
   uri.SetQueryString(ss.str());
-  return GetBucketRequestPaymentOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketRequestPaymentOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable(const GetBucketRequestPaymentRequest& request) const
@@ -1734,7 +2759,31 @@ void S3Client::GetBucketRequestPaymentAsync(const GetBucketRequestPaymentRequest
 
 void S3Client::GetBucketRequestPaymentAsyncHelper(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketRequestPayment(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketRequestPayment(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketRequestPayment", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketRequestPaymentOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketRequestPaymentOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?requestPayment");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketRequestPaymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketRequestPaymentOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest& request) const
@@ -1753,7 +2802,7 @@ GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest
   Aws::StringStream ss;
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
-  return GetBucketTaggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketTaggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(const GetBucketTaggingRequest& request) const
@@ -1771,7 +2820,31 @@ void S3Client::GetBucketTaggingAsync(const GetBucketTaggingRequest& request, con
 
 void S3Client::GetBucketTaggingAsyncHelper(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketTagging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketTagging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketTagging", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketTaggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?tagging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketTaggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioningRequest& request) const
@@ -1790,7 +2863,7 @@ GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioni
   Aws::StringStream ss;
   ss.str("?versioning");
   uri.SetQueryString(ss.str());
-  return GetBucketVersioningOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketVersioningOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(const GetBucketVersioningRequest& request) const
@@ -1808,7 +2881,31 @@ void S3Client::GetBucketVersioningAsync(const GetBucketVersioningRequest& reques
 
 void S3Client::GetBucketVersioningAsyncHelper(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketVersioning(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketVersioning(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketVersioning", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketVersioningOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketVersioningOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?versioning");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketVersioningRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketVersioningOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest& request) const
@@ -1827,7 +2924,7 @@ GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest
   Aws::StringStream ss;
   ss.str("?website");
   uri.SetQueryString(ss.str());
-  return GetBucketWebsiteOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetBucketWebsiteOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(const GetBucketWebsiteRequest& request) const
@@ -1845,7 +2942,31 @@ void S3Client::GetBucketWebsiteAsync(const GetBucketWebsiteRequest& request, con
 
 void S3Client::GetBucketWebsiteAsyncHelper(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketWebsite(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetBucketWebsite(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetBucketWebsite", "Required field: Bucket, is not set");
+    handler(this, request, GetBucketWebsiteOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetBucketWebsiteOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?website");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetBucketWebsiteOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
@@ -1888,7 +3009,38 @@ void S3Client::GetObjectAsync(const GetObjectRequest& request, const GetObjectRe
 
 void S3Client::GetObjectAsyncHelper(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObject(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetObject(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObject", "Required field: Bucket, is not set");
+    handler(this, request, GetObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObject", "Required field: Key, is not set");
+    handler(this, request, GetObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetObjectOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::StreamOutcome&& outcome){ handler(this, *sharedRequest, GetObjectOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) const
@@ -1915,7 +3067,7 @@ GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) c
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?acl");
   uri.SetQueryString(ss.str());
-  return GetObjectAclOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetObjectAclOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(const GetObjectAclRequest& request) const
@@ -1933,7 +3085,40 @@ void S3Client::GetObjectAclAsync(const GetObjectAclRequest& request, const GetOb
 
 void S3Client::GetObjectAclAsyncHelper(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectAcl(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetObjectAcl(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectAcl", "Required field: Bucket, is not set");
+    handler(this, request, GetObjectAclOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectAcl", "Required field: Key, is not set");
+    handler(this, request, GetObjectAclOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetObjectAclOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?acl");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetObjectAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetObjectAclOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetObjectLegalHoldOutcome S3Client::GetObjectLegalHold(const GetObjectLegalHoldRequest& request) const
@@ -1960,7 +3145,7 @@ GetObjectLegalHoldOutcome S3Client::GetObjectLegalHold(const GetObjectLegalHoldR
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?legal-hold");
   uri.SetQueryString(ss.str());
-  return GetObjectLegalHoldOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetObjectLegalHoldOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetObjectLegalHoldOutcomeCallable S3Client::GetObjectLegalHoldCallable(const GetObjectLegalHoldRequest& request) const
@@ -1978,7 +3163,40 @@ void S3Client::GetObjectLegalHoldAsync(const GetObjectLegalHoldRequest& request,
 
 void S3Client::GetObjectLegalHoldAsyncHelper(const GetObjectLegalHoldRequest& request, const GetObjectLegalHoldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectLegalHold(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetObjectLegalHold(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectLegalHold", "Required field: Bucket, is not set");
+    handler(this, request, GetObjectLegalHoldOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectLegalHold", "Required field: Key, is not set");
+    handler(this, request, GetObjectLegalHoldOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetObjectLegalHoldOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?legal-hold");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetObjectLegalHoldRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetObjectLegalHoldOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetObjectLockConfigurationOutcome S3Client::GetObjectLockConfiguration(const GetObjectLockConfigurationRequest& request) const
@@ -1997,7 +3215,7 @@ GetObjectLockConfigurationOutcome S3Client::GetObjectLockConfiguration(const Get
   Aws::StringStream ss;
   ss.str("?object-lock");
   uri.SetQueryString(ss.str());
-  return GetObjectLockConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetObjectLockConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetObjectLockConfigurationOutcomeCallable S3Client::GetObjectLockConfigurationCallable(const GetObjectLockConfigurationRequest& request) const
@@ -2015,7 +3233,31 @@ void S3Client::GetObjectLockConfigurationAsync(const GetObjectLockConfigurationR
 
 void S3Client::GetObjectLockConfigurationAsyncHelper(const GetObjectLockConfigurationRequest& request, const GetObjectLockConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectLockConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetObjectLockConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectLockConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, GetObjectLockConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetObjectLockConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?object-lock");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetObjectLockConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetObjectLockConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetObjectRetentionOutcome S3Client::GetObjectRetention(const GetObjectRetentionRequest& request) const
@@ -2042,7 +3284,7 @@ GetObjectRetentionOutcome S3Client::GetObjectRetention(const GetObjectRetentionR
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?retention");
   uri.SetQueryString(ss.str());
-  return GetObjectRetentionOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetObjectRetentionOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetObjectRetentionOutcomeCallable S3Client::GetObjectRetentionCallable(const GetObjectRetentionRequest& request) const
@@ -2060,12 +3302,45 @@ void S3Client::GetObjectRetentionAsync(const GetObjectRetentionRequest& request,
 
 void S3Client::GetObjectRetentionAsyncHelper(const GetObjectRetentionRequest& request, const GetObjectRetentionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectRetention(request), context);
-}
-
-GetObjectTaggingOutcome S3Client::GetObjectTagging(const GetObjectTaggingRequest& request) const
-{
-  if (!request.BucketHasBeenSet())
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetObjectRetention(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectRetention", "Required field: Bucket, is not set");
+    handler(this, request, GetObjectRetentionOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectRetention", "Required field: Key, is not set");
+    handler(this, request, GetObjectRetentionOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetObjectRetentionOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?retention");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetObjectRetentionRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetObjectRetentionOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
+}
+
+GetObjectTaggingOutcome S3Client::GetObjectTagging(const GetObjectTaggingRequest& request) const
+{
+  if (!request.BucketHasBeenSet())
   {
     AWS_LOGSTREAM_ERROR("GetObjectTagging", "Required field: Bucket, is not set");
     return GetObjectTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false));
@@ -2087,7 +3362,7 @@ GetObjectTaggingOutcome S3Client::GetObjectTagging(const GetObjectTaggingRequest
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
-  return GetObjectTaggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetObjectTaggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetObjectTaggingOutcomeCallable S3Client::GetObjectTaggingCallable(const GetObjectTaggingRequest& request) const
@@ -2105,7 +3380,40 @@ void S3Client::GetObjectTaggingAsync(const GetObjectTaggingRequest& request, con
 
 void S3Client::GetObjectTaggingAsyncHelper(const GetObjectTaggingRequest& request, const GetObjectTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectTagging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetObjectTagging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectTagging", "Required field: Bucket, is not set");
+    handler(this, request, GetObjectTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectTagging", "Required field: Key, is not set");
+    handler(this, request, GetObjectTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetObjectTaggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?tagging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetObjectTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetObjectTaggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest& request) const
@@ -2150,7 +3458,40 @@ void S3Client::GetObjectTorrentAsync(const GetObjectTorrentRequest& request, con
 
 void S3Client::GetObjectTorrentAsyncHelper(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectTorrent(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetObjectTorrent(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectTorrent", "Required field: Bucket, is not set");
+    handler(this, request, GetObjectTorrentOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetObjectTorrent", "Required field: Key, is not set");
+    handler(this, request, GetObjectTorrentOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetObjectTorrentOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?torrent");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetObjectTorrentRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::StreamOutcome&& outcome){ handler(this, *sharedRequest, GetObjectTorrentOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 GetPublicAccessBlockOutcome S3Client::GetPublicAccessBlock(const GetPublicAccessBlockRequest& request) const
@@ -2169,7 +3510,7 @@ GetPublicAccessBlockOutcome S3Client::GetPublicAccessBlock(const GetPublicAccess
   Aws::StringStream ss;
   ss.str("?publicAccessBlock");
   uri.SetQueryString(ss.str());
-  return GetPublicAccessBlockOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return GetPublicAccessBlockOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 GetPublicAccessBlockOutcomeCallable S3Client::GetPublicAccessBlockCallable(const GetPublicAccessBlockRequest& request) const
@@ -2187,7 +3528,31 @@ void S3Client::GetPublicAccessBlockAsync(const GetPublicAccessBlockRequest& requ
 
 void S3Client::GetPublicAccessBlockAsyncHelper(const GetPublicAccessBlockRequest& request, const GetPublicAccessBlockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetPublicAccessBlock(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, GetPublicAccessBlock(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("GetPublicAccessBlock", "Required field: Bucket, is not set");
+    handler(this, request, GetPublicAccessBlockOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, GetPublicAccessBlockOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?publicAccessBlock");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<GetPublicAccessBlockRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, GetPublicAccessBlockOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
@@ -2205,7 +3570,7 @@ HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
   Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
   Aws::StringStream ss;
   uri.SetPath(uri.GetPath() + ss.str());
-  return HeadBucketOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_HEAD, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return HeadBucketOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_HEAD, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 HeadBucketOutcomeCallable S3Client::HeadBucketCallable(const HeadBucketRequest& request) const
@@ -2223,7 +3588,30 @@ void S3Client::HeadBucketAsync(const HeadBucketRequest& request, const HeadBucke
 
 void S3Client::HeadBucketAsyncHelper(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, HeadBucket(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, HeadBucket(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("HeadBucket", "Required field: Bucket, is not set");
+    handler(this, request, HeadBucketOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, HeadBucketOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<HeadBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, HeadBucketOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_HEAD, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
@@ -2248,7 +3636,7 @@ HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return HeadObjectOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_HEAD, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return HeadObjectOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_HEAD, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 HeadObjectOutcomeCallable S3Client::HeadObjectCallable(const HeadObjectRequest& request) const
@@ -2266,7 +3654,38 @@ void S3Client::HeadObjectAsync(const HeadObjectRequest& request, const HeadObjec
 
 void S3Client::HeadObjectAsyncHelper(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, HeadObject(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, HeadObject(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("HeadObject", "Required field: Bucket, is not set");
+    handler(this, request, HeadObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("HeadObject", "Required field: Key, is not set");
+    handler(this, request, HeadObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, HeadObjectOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<HeadObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, HeadObjectOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_HEAD, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListBucketAnalyticsConfigurationsOutcome S3Client::ListBucketAnalyticsConfigurations(const ListBucketAnalyticsConfigurationsRequest& request) const
@@ -2285,7 +3704,7 @@ ListBucketAnalyticsConfigurationsOutcome S3Client::ListBucketAnalyticsConfigurat
   Aws::StringStream ss;
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
-  return ListBucketAnalyticsConfigurationsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListBucketAnalyticsConfigurationsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListBucketAnalyticsConfigurationsOutcomeCallable S3Client::ListBucketAnalyticsConfigurationsCallable(const ListBucketAnalyticsConfigurationsRequest& request) const
@@ -2303,7 +3722,31 @@ void S3Client::ListBucketAnalyticsConfigurationsAsync(const ListBucketAnalyticsC
 
 void S3Client::ListBucketAnalyticsConfigurationsAsyncHelper(const ListBucketAnalyticsConfigurationsRequest& request, const ListBucketAnalyticsConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListBucketAnalyticsConfigurations(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListBucketAnalyticsConfigurations(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListBucketAnalyticsConfigurations", "Required field: Bucket, is not set");
+    handler(this, request, ListBucketAnalyticsConfigurationsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListBucketAnalyticsConfigurationsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?analytics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBucketAnalyticsConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListBucketAnalyticsConfigurationsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListBucketIntelligentTieringConfigurationsOutcome S3Client::ListBucketIntelligentTieringConfigurations(const ListBucketIntelligentTieringConfigurationsRequest& request) const
@@ -2322,7 +3765,7 @@ ListBucketIntelligentTieringConfigurationsOutcome S3Client::ListBucketIntelligen
   Aws::StringStream ss;
   ss.str("?intelligent-tiering");
   uri.SetQueryString(ss.str());
-  return ListBucketIntelligentTieringConfigurationsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListBucketIntelligentTieringConfigurationsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListBucketIntelligentTieringConfigurationsOutcomeCallable S3Client::ListBucketIntelligentTieringConfigurationsCallable(const ListBucketIntelligentTieringConfigurationsRequest& request) const
@@ -2340,7 +3783,31 @@ void S3Client::ListBucketIntelligentTieringConfigurationsAsync(const ListBucketI
 
 void S3Client::ListBucketIntelligentTieringConfigurationsAsyncHelper(const ListBucketIntelligentTieringConfigurationsRequest& request, const ListBucketIntelligentTieringConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListBucketIntelligentTieringConfigurations(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListBucketIntelligentTieringConfigurations(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListBucketIntelligentTieringConfigurations", "Required field: Bucket, is not set");
+    handler(this, request, ListBucketIntelligentTieringConfigurationsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListBucketIntelligentTieringConfigurationsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?intelligent-tiering");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBucketIntelligentTieringConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListBucketIntelligentTieringConfigurationsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListBucketInventoryConfigurationsOutcome S3Client::ListBucketInventoryConfigurations(const ListBucketInventoryConfigurationsRequest& request) const
@@ -2359,7 +3826,7 @@ ListBucketInventoryConfigurationsOutcome S3Client::ListBucketInventoryConfigurat
   Aws::StringStream ss;
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
-  return ListBucketInventoryConfigurationsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListBucketInventoryConfigurationsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListBucketInventoryConfigurationsOutcomeCallable S3Client::ListBucketInventoryConfigurationsCallable(const ListBucketInventoryConfigurationsRequest& request) const
@@ -2377,7 +3844,31 @@ void S3Client::ListBucketInventoryConfigurationsAsync(const ListBucketInventoryC
 
 void S3Client::ListBucketInventoryConfigurationsAsyncHelper(const ListBucketInventoryConfigurationsRequest& request, const ListBucketInventoryConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListBucketInventoryConfigurations(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListBucketInventoryConfigurations(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListBucketInventoryConfigurations", "Required field: Bucket, is not set");
+    handler(this, request, ListBucketInventoryConfigurationsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListBucketInventoryConfigurationsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?inventory");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBucketInventoryConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListBucketInventoryConfigurationsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListBucketMetricsConfigurationsOutcome S3Client::ListBucketMetricsConfigurations(const ListBucketMetricsConfigurationsRequest& request) const
@@ -2396,7 +3887,7 @@ ListBucketMetricsConfigurationsOutcome S3Client::ListBucketMetricsConfigurations
   Aws::StringStream ss;
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
-  return ListBucketMetricsConfigurationsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListBucketMetricsConfigurationsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListBucketMetricsConfigurationsOutcomeCallable S3Client::ListBucketMetricsConfigurationsCallable(const ListBucketMetricsConfigurationsRequest& request) const
@@ -2414,7 +3905,31 @@ void S3Client::ListBucketMetricsConfigurationsAsync(const ListBucketMetricsConfi
 
 void S3Client::ListBucketMetricsConfigurationsAsyncHelper(const ListBucketMetricsConfigurationsRequest& request, const ListBucketMetricsConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListBucketMetricsConfigurations(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListBucketMetricsConfigurations(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListBucketMetricsConfigurations", "Required field: Bucket, is not set");
+    handler(this, request, ListBucketMetricsConfigurationsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListBucketMetricsConfigurationsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?metrics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBucketMetricsConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListBucketMetricsConfigurationsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListBucketsOutcome S3Client::ListBuckets() const
@@ -2426,7 +3941,7 @@ ListBucketsOutcome S3Client::ListBuckets() const
     return ListBucketsOutcome(computeEndpointOutcome.GetError());
   }
   ss << computeEndpointOutcome.GetResult().endpoint;
-  return ListBucketsOutcome(MakeRequest(ss.str(), Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, "ListBuckets", computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListBucketsOutcome(MakeRequestWithXmlReader(ss.str(), Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, "ListBuckets", computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListBucketsOutcomeCallable S3Client::ListBucketsCallable() const
@@ -2463,7 +3978,7 @@ ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUp
   Aws::StringStream ss;
   ss.str("?uploads");
   uri.SetQueryString(ss.str());
-  return ListMultipartUploadsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListMultipartUploadsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(const ListMultipartUploadsRequest& request) const
@@ -2481,7 +3996,31 @@ void S3Client::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& requ
 
 void S3Client::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListMultipartUploads(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListMultipartUploads(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListMultipartUploads", "Required field: Bucket, is not set");
+    handler(this, request, ListMultipartUploadsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListMultipartUploadsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?uploads");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<ListMultipartUploadsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListMultipartUploadsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsRequest& request) const
@@ -2500,7 +4039,7 @@ ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsR
   Aws::StringStream ss;
   ss.str("?versions");
   uri.SetQueryString(ss.str());
-  return ListObjectVersionsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListObjectVersionsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(const ListObjectVersionsRequest& request) const
@@ -2518,7 +4057,31 @@ void S3Client::ListObjectVersionsAsync(const ListObjectVersionsRequest& request,
 
 void S3Client::ListObjectVersionsAsyncHelper(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListObjectVersions(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListObjectVersions(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListObjectVersions", "Required field: Bucket, is not set");
+    handler(this, request, ListObjectVersionsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListObjectVersionsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?versions");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<ListObjectVersionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListObjectVersionsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) const
@@ -2536,7 +4099,7 @@ ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) cons
   Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
   Aws::StringStream ss;
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListObjectsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListObjectsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListObjectsOutcomeCallable S3Client::ListObjectsCallable(const ListObjectsRequest& request) const
@@ -2554,7 +4117,30 @@ void S3Client::ListObjectsAsync(const ListObjectsRequest& request, const ListObj
 
 void S3Client::ListObjectsAsyncHelper(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListObjects(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListObjects(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListObjects", "Required field: Bucket, is not set");
+    handler(this, request, ListObjectsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListObjectsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListObjectsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListObjectsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListObjectsV2Outcome S3Client::ListObjectsV2(const ListObjectsV2Request& request) const
@@ -2573,7 +4159,7 @@ ListObjectsV2Outcome S3Client::ListObjectsV2(const ListObjectsV2Request& request
   Aws::StringStream ss;
   ss.str("?list-type=2");
   uri.SetQueryString(ss.str());
-  return ListObjectsV2Outcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return ListObjectsV2Outcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 ListObjectsV2OutcomeCallable S3Client::ListObjectsV2Callable(const ListObjectsV2Request& request) const
@@ -2591,7 +4177,31 @@ void S3Client::ListObjectsV2Async(const ListObjectsV2Request& request, const Lis
 
 void S3Client::ListObjectsV2AsyncHelper(const ListObjectsV2Request& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListObjectsV2(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListObjectsV2(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListObjectsV2", "Required field: Bucket, is not set");
+    handler(this, request, ListObjectsV2Outcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, ListObjectsV2Outcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?list-type=2");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<ListObjectsV2Request>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListObjectsV2Outcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
@@ -2599,47 +4209,84 @@ ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
   if (!request.BucketHasBeenSet())
   {
     AWS_LOGSTREAM_ERROR("ListParts", "Required field: Bucket, is not set");
-    return ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false));
+    return ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false));
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListParts", "Required field: Key, is not set");
+    return ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false));
+  }
+  if (!request.UploadIdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListParts", "Required field: UploadId, is not set");
+    return ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [UploadId]", false));
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    return ListPartsOutcome(computeEndpointOutcome.GetError());
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  return ListPartsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+}
+
+ListPartsOutcomeCallable S3Client::ListPartsCallable(const ListPartsRequest& request) const
+{
+  auto task = Aws::MakeShared< std::packaged_task< ListPartsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListParts(request); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  m_executor->Submit(packagedFunction);
+  return task->get_future();
+}
+
+void S3Client::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit( [this, request, handler, context](){ this->ListPartsAsyncHelper( request, handler, context ); } );
+}
+
+void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListParts(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("ListParts", "Required field: Bucket, is not set");
+    handler(this, request, ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
   }
   if (!request.KeyHasBeenSet())
   {
     AWS_LOGSTREAM_ERROR("ListParts", "Required field: Key, is not set");
-    return ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false));
+    handler(this, request, ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
   }
   if (!request.UploadIdHasBeenSet())
   {
     AWS_LOGSTREAM_ERROR("ListParts", "Required field: UploadId, is not set");
-    return ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [UploadId]", false));
+    handler(this, request, ListPartsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [UploadId]", false)), context);
+    return;
   }
   ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
   if (!computeEndpointOutcome.IsSuccess())
   {
-    return ListPartsOutcome(computeEndpointOutcome.GetError());
+    handler(this, request, ListPartsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
   }
   Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
   Aws::StringStream ss;
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListPartsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
-}
-
-ListPartsOutcomeCallable S3Client::ListPartsCallable(const ListPartsRequest& request) const
-{
-  auto task = Aws::MakeShared< std::packaged_task< ListPartsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListParts(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
-}
-
-void S3Client::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  m_executor->Submit( [this, request, handler, context](){ this->ListPartsAsyncHelper( request, handler, context ); } );
-}
-
-void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
-{
-  handler(this, request, ListParts(request), context);
+  auto sharedRequest = Aws::MakeShared<ListPartsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, ListPartsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketAccelerateConfigurationOutcome S3Client::PutBucketAccelerateConfiguration(const PutBucketAccelerateConfigurationRequest& request) const
@@ -2658,7 +4305,7 @@ PutBucketAccelerateConfigurationOutcome S3Client::PutBucketAccelerateConfigurati
   Aws::StringStream ss;
   ss.str("?accelerate");
   uri.SetQueryString(ss.str());
-  return PutBucketAccelerateConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketAccelerateConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketAccelerateConfigurationOutcomeCallable S3Client::PutBucketAccelerateConfigurationCallable(const PutBucketAccelerateConfigurationRequest& request) const
@@ -2676,7 +4323,31 @@ void S3Client::PutBucketAccelerateConfigurationAsync(const PutBucketAccelerateCo
 
 void S3Client::PutBucketAccelerateConfigurationAsyncHelper(const PutBucketAccelerateConfigurationRequest& request, const PutBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketAccelerateConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketAccelerateConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketAccelerateConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketAccelerateConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketAccelerateConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?accelerate");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketAccelerateConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketAccelerateConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) const
@@ -2695,7 +4366,7 @@ PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) c
   Aws::StringStream ss;
   ss.str("?acl");
   uri.SetQueryString(ss.str());
-  return PutBucketAclOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketAclOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(const PutBucketAclRequest& request) const
@@ -2713,7 +4384,31 @@ void S3Client::PutBucketAclAsync(const PutBucketAclRequest& request, const PutBu
 
 void S3Client::PutBucketAclAsyncHelper(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketAcl(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketAcl(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketAcl", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketAclOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketAclOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?acl");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketAclOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketAnalyticsConfigurationOutcome S3Client::PutBucketAnalyticsConfiguration(const PutBucketAnalyticsConfigurationRequest& request) const
@@ -2737,7 +4432,7 @@ PutBucketAnalyticsConfigurationOutcome S3Client::PutBucketAnalyticsConfiguration
   Aws::StringStream ss;
   ss.str("?analytics");
   uri.SetQueryString(ss.str());
-  return PutBucketAnalyticsConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketAnalyticsConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketAnalyticsConfigurationOutcomeCallable S3Client::PutBucketAnalyticsConfigurationCallable(const PutBucketAnalyticsConfigurationRequest& request) const
@@ -2755,7 +4450,37 @@ void S3Client::PutBucketAnalyticsConfigurationAsync(const PutBucketAnalyticsConf
 
 void S3Client::PutBucketAnalyticsConfigurationAsyncHelper(const PutBucketAnalyticsConfigurationRequest& request, const PutBucketAnalyticsConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketAnalyticsConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketAnalyticsConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketAnalyticsConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketAnalyticsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketAnalyticsConfiguration", "Required field: Id, is not set");
+    handler(this, request, PutBucketAnalyticsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketAnalyticsConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?analytics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketAnalyticsConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketAnalyticsConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request) const
@@ -2774,7 +4499,7 @@ PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request
   Aws::StringStream ss;
   ss.str("?cors");
   uri.SetQueryString(ss.str());
-  return PutBucketCorsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketCorsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(const PutBucketCorsRequest& request) const
@@ -2792,7 +4517,31 @@ void S3Client::PutBucketCorsAsync(const PutBucketCorsRequest& request, const Put
 
 void S3Client::PutBucketCorsAsyncHelper(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketCors(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketCors(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketCors", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketCorsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketCorsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?cors");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketCorsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketEncryptionOutcome S3Client::PutBucketEncryption(const PutBucketEncryptionRequest& request) const
@@ -2811,7 +4560,7 @@ PutBucketEncryptionOutcome S3Client::PutBucketEncryption(const PutBucketEncrypti
   Aws::StringStream ss;
   ss.str("?encryption");
   uri.SetQueryString(ss.str());
-  return PutBucketEncryptionOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketEncryptionOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketEncryptionOutcomeCallable S3Client::PutBucketEncryptionCallable(const PutBucketEncryptionRequest& request) const
@@ -2829,7 +4578,31 @@ void S3Client::PutBucketEncryptionAsync(const PutBucketEncryptionRequest& reques
 
 void S3Client::PutBucketEncryptionAsyncHelper(const PutBucketEncryptionRequest& request, const PutBucketEncryptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketEncryption(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketEncryption(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketEncryption", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketEncryptionOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketEncryptionOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?encryption");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketEncryptionRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketEncryptionOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketIntelligentTieringConfigurationOutcome S3Client::PutBucketIntelligentTieringConfiguration(const PutBucketIntelligentTieringConfigurationRequest& request) const
@@ -2853,7 +4626,7 @@ PutBucketIntelligentTieringConfigurationOutcome S3Client::PutBucketIntelligentTi
   Aws::StringStream ss;
   ss.str("?intelligent-tiering");
   uri.SetQueryString(ss.str());
-  return PutBucketIntelligentTieringConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketIntelligentTieringConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketIntelligentTieringConfigurationOutcomeCallable S3Client::PutBucketIntelligentTieringConfigurationCallable(const PutBucketIntelligentTieringConfigurationRequest& request) const
@@ -2871,7 +4644,37 @@ void S3Client::PutBucketIntelligentTieringConfigurationAsync(const PutBucketInte
 
 void S3Client::PutBucketIntelligentTieringConfigurationAsyncHelper(const PutBucketIntelligentTieringConfigurationRequest& request, const PutBucketIntelligentTieringConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketIntelligentTieringConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketIntelligentTieringConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketIntelligentTieringConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketIntelligentTieringConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketIntelligentTieringConfiguration", "Required field: Id, is not set");
+    handler(this, request, PutBucketIntelligentTieringConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketIntelligentTieringConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?intelligent-tiering");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketIntelligentTieringConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketIntelligentTieringConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketInventoryConfigurationOutcome S3Client::PutBucketInventoryConfiguration(const PutBucketInventoryConfigurationRequest& request) const
@@ -2895,7 +4698,7 @@ PutBucketInventoryConfigurationOutcome S3Client::PutBucketInventoryConfiguration
   Aws::StringStream ss;
   ss.str("?inventory");
   uri.SetQueryString(ss.str());
-  return PutBucketInventoryConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketInventoryConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketInventoryConfigurationOutcomeCallable S3Client::PutBucketInventoryConfigurationCallable(const PutBucketInventoryConfigurationRequest& request) const
@@ -2913,7 +4716,37 @@ void S3Client::PutBucketInventoryConfigurationAsync(const PutBucketInventoryConf
 
 void S3Client::PutBucketInventoryConfigurationAsyncHelper(const PutBucketInventoryConfigurationRequest& request, const PutBucketInventoryConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketInventoryConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketInventoryConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketInventoryConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketInventoryConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketInventoryConfiguration", "Required field: Id, is not set");
+    handler(this, request, PutBucketInventoryConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketInventoryConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?inventory");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketInventoryConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketInventoryConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration(const PutBucketLifecycleConfigurationRequest& request) const
@@ -2932,7 +4765,7 @@ PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration
   Aws::StringStream ss;
   ss.str("?lifecycle");
   uri.SetQueryString(ss.str());
-  return PutBucketLifecycleConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketLifecycleConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketLifecycleConfigurationOutcomeCallable S3Client::PutBucketLifecycleConfigurationCallable(const PutBucketLifecycleConfigurationRequest& request) const
@@ -2950,7 +4783,31 @@ void S3Client::PutBucketLifecycleConfigurationAsync(const PutBucketLifecycleConf
 
 void S3Client::PutBucketLifecycleConfigurationAsyncHelper(const PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketLifecycleConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketLifecycleConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketLifecycleConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketLifecycleConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketLifecycleConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?lifecycle");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketLifecycleConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketLifecycleConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest& request) const
@@ -2969,7 +4826,7 @@ PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest
   Aws::StringStream ss;
   ss.str("?logging");
   uri.SetQueryString(ss.str());
-  return PutBucketLoggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketLoggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(const PutBucketLoggingRequest& request) const
@@ -2987,7 +4844,31 @@ void S3Client::PutBucketLoggingAsync(const PutBucketLoggingRequest& request, con
 
 void S3Client::PutBucketLoggingAsyncHelper(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketLogging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketLogging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketLogging", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketLoggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketLoggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?logging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketLoggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketLoggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketMetricsConfigurationOutcome S3Client::PutBucketMetricsConfiguration(const PutBucketMetricsConfigurationRequest& request) const
@@ -3011,7 +4892,7 @@ PutBucketMetricsConfigurationOutcome S3Client::PutBucketMetricsConfiguration(con
   Aws::StringStream ss;
   ss.str("?metrics");
   uri.SetQueryString(ss.str());
-  return PutBucketMetricsConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketMetricsConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketMetricsConfigurationOutcomeCallable S3Client::PutBucketMetricsConfigurationCallable(const PutBucketMetricsConfigurationRequest& request) const
@@ -3029,7 +4910,37 @@ void S3Client::PutBucketMetricsConfigurationAsync(const PutBucketMetricsConfigur
 
 void S3Client::PutBucketMetricsConfigurationAsyncHelper(const PutBucketMetricsConfigurationRequest& request, const PutBucketMetricsConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketMetricsConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketMetricsConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketMetricsConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketMetricsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketMetricsConfiguration", "Required field: Id, is not set");
+    handler(this, request, PutBucketMetricsConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Id]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketMetricsConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?metrics");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketMetricsConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketMetricsConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfiguration(const PutBucketNotificationConfigurationRequest& request) const
@@ -3048,7 +4959,7 @@ PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfigu
   Aws::StringStream ss;
   ss.str("?notification");
   uri.SetQueryString(ss.str());
-  return PutBucketNotificationConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketNotificationConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificationConfigurationCallable(const PutBucketNotificationConfigurationRequest& request) const
@@ -3066,7 +4977,31 @@ void S3Client::PutBucketNotificationConfigurationAsync(const PutBucketNotificati
 
 void S3Client::PutBucketNotificationConfigurationAsyncHelper(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketNotificationConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketNotificationConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketNotificationConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketNotificationConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketNotificationConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?notification");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketNotificationConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketOwnershipControlsOutcome S3Client::PutBucketOwnershipControls(const PutBucketOwnershipControlsRequest& request) const
@@ -3085,7 +5020,7 @@ PutBucketOwnershipControlsOutcome S3Client::PutBucketOwnershipControls(const Put
   Aws::StringStream ss;
   ss.str("?ownershipControls");
   uri.SetQueryString(ss.str());
-  return PutBucketOwnershipControlsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketOwnershipControlsOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketOwnershipControlsOutcomeCallable S3Client::PutBucketOwnershipControlsCallable(const PutBucketOwnershipControlsRequest& request) const
@@ -3103,7 +5038,31 @@ void S3Client::PutBucketOwnershipControlsAsync(const PutBucketOwnershipControlsR
 
 void S3Client::PutBucketOwnershipControlsAsyncHelper(const PutBucketOwnershipControlsRequest& request, const PutBucketOwnershipControlsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketOwnershipControls(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketOwnershipControls(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketOwnershipControls", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketOwnershipControlsOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketOwnershipControlsOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?ownershipControls");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketOwnershipControlsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketOwnershipControlsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& request) const
@@ -3122,7 +5081,7 @@ PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& r
   Aws::StringStream ss;
   ss.str("?policy");
   uri.SetQueryString(ss.str());
-  return PutBucketPolicyOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketPolicyOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(const PutBucketPolicyRequest& request) const
@@ -3140,7 +5099,31 @@ void S3Client::PutBucketPolicyAsync(const PutBucketPolicyRequest& request, const
 
 void S3Client::PutBucketPolicyAsyncHelper(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketPolicy(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketPolicy(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketPolicy", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketPolicyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketPolicyOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?policy");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketPolicyOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplicationRequest& request) const
@@ -3159,7 +5142,7 @@ PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplic
   Aws::StringStream ss;
   ss.str("?replication");
   uri.SetQueryString(ss.str());
-  return PutBucketReplicationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketReplicationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(const PutBucketReplicationRequest& request) const
@@ -3177,7 +5160,31 @@ void S3Client::PutBucketReplicationAsync(const PutBucketReplicationRequest& requ
 
 void S3Client::PutBucketReplicationAsyncHelper(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketReplication(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketReplication(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketReplication", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketReplicationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketReplicationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?replication");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketReplicationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucketRequestPaymentRequest& request) const
@@ -3196,7 +5203,7 @@ PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucket
   Aws::StringStream ss;
   ss.str("?requestPayment");
   uri.SetQueryString(ss.str());
-  return PutBucketRequestPaymentOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketRequestPaymentOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable(const PutBucketRequestPaymentRequest& request) const
@@ -3214,7 +5221,31 @@ void S3Client::PutBucketRequestPaymentAsync(const PutBucketRequestPaymentRequest
 
 void S3Client::PutBucketRequestPaymentAsyncHelper(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketRequestPayment(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketRequestPayment(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketRequestPayment", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketRequestPaymentOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketRequestPaymentOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?requestPayment");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketRequestPaymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketRequestPaymentOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest& request) const
@@ -3233,7 +5264,7 @@ PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest
   Aws::StringStream ss;
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
-  return PutBucketTaggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketTaggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(const PutBucketTaggingRequest& request) const
@@ -3251,7 +5282,31 @@ void S3Client::PutBucketTaggingAsync(const PutBucketTaggingRequest& request, con
 
 void S3Client::PutBucketTaggingAsyncHelper(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketTagging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketTagging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketTagging", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketTaggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?tagging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketTaggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioningRequest& request) const
@@ -3270,7 +5325,7 @@ PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioni
   Aws::StringStream ss;
   ss.str("?versioning");
   uri.SetQueryString(ss.str());
-  return PutBucketVersioningOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketVersioningOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(const PutBucketVersioningRequest& request) const
@@ -3288,7 +5343,31 @@ void S3Client::PutBucketVersioningAsync(const PutBucketVersioningRequest& reques
 
 void S3Client::PutBucketVersioningAsyncHelper(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketVersioning(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketVersioning(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketVersioning", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketVersioningOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketVersioningOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?versioning");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketVersioningRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketVersioningOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest& request) const
@@ -3307,7 +5386,7 @@ PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest
   Aws::StringStream ss;
   ss.str("?website");
   uri.SetQueryString(ss.str());
-  return PutBucketWebsiteOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutBucketWebsiteOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(const PutBucketWebsiteRequest& request) const
@@ -3325,7 +5404,31 @@ void S3Client::PutBucketWebsiteAsync(const PutBucketWebsiteRequest& request, con
 
 void S3Client::PutBucketWebsiteAsyncHelper(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketWebsite(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutBucketWebsite(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutBucketWebsite", "Required field: Bucket, is not set");
+    handler(this, request, PutBucketWebsiteOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutBucketWebsiteOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?website");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutBucketWebsiteOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
@@ -3350,7 +5453,7 @@ PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return PutObjectOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutObjectOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutObjectOutcomeCallable S3Client::PutObjectCallable(const PutObjectRequest& request) const
@@ -3368,7 +5471,38 @@ void S3Client::PutObjectAsync(const PutObjectRequest& request, const PutObjectRe
 
 void S3Client::PutObjectAsyncHelper(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObject(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutObject(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObject", "Required field: Bucket, is not set");
+    handler(this, request, PutObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObject", "Required field: Key, is not set");
+    handler(this, request, PutObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutObjectOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutObjectOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) const
@@ -3395,7 +5529,7 @@ PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) c
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?acl");
   uri.SetQueryString(ss.str());
-  return PutObjectAclOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutObjectAclOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(const PutObjectAclRequest& request) const
@@ -3413,7 +5547,40 @@ void S3Client::PutObjectAclAsync(const PutObjectAclRequest& request, const PutOb
 
 void S3Client::PutObjectAclAsyncHelper(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObjectAcl(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutObjectAcl(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectAcl", "Required field: Bucket, is not set");
+    handler(this, request, PutObjectAclOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectAcl", "Required field: Key, is not set");
+    handler(this, request, PutObjectAclOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutObjectAclOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?acl");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutObjectAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutObjectAclOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutObjectLegalHoldOutcome S3Client::PutObjectLegalHold(const PutObjectLegalHoldRequest& request) const
@@ -3440,7 +5607,7 @@ PutObjectLegalHoldOutcome S3Client::PutObjectLegalHold(const PutObjectLegalHoldR
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?legal-hold");
   uri.SetQueryString(ss.str());
-  return PutObjectLegalHoldOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutObjectLegalHoldOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutObjectLegalHoldOutcomeCallable S3Client::PutObjectLegalHoldCallable(const PutObjectLegalHoldRequest& request) const
@@ -3458,7 +5625,40 @@ void S3Client::PutObjectLegalHoldAsync(const PutObjectLegalHoldRequest& request,
 
 void S3Client::PutObjectLegalHoldAsyncHelper(const PutObjectLegalHoldRequest& request, const PutObjectLegalHoldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObjectLegalHold(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutObjectLegalHold(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectLegalHold", "Required field: Bucket, is not set");
+    handler(this, request, PutObjectLegalHoldOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectLegalHold", "Required field: Key, is not set");
+    handler(this, request, PutObjectLegalHoldOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutObjectLegalHoldOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?legal-hold");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutObjectLegalHoldRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutObjectLegalHoldOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutObjectLockConfigurationOutcome S3Client::PutObjectLockConfiguration(const PutObjectLockConfigurationRequest& request) const
@@ -3477,7 +5677,7 @@ PutObjectLockConfigurationOutcome S3Client::PutObjectLockConfiguration(const Put
   Aws::StringStream ss;
   ss.str("?object-lock");
   uri.SetQueryString(ss.str());
-  return PutObjectLockConfigurationOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutObjectLockConfigurationOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutObjectLockConfigurationOutcomeCallable S3Client::PutObjectLockConfigurationCallable(const PutObjectLockConfigurationRequest& request) const
@@ -3495,7 +5695,31 @@ void S3Client::PutObjectLockConfigurationAsync(const PutObjectLockConfigurationR
 
 void S3Client::PutObjectLockConfigurationAsyncHelper(const PutObjectLockConfigurationRequest& request, const PutObjectLockConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObjectLockConfiguration(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutObjectLockConfiguration(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectLockConfiguration", "Required field: Bucket, is not set");
+    handler(this, request, PutObjectLockConfigurationOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutObjectLockConfigurationOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?object-lock");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutObjectLockConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutObjectLockConfigurationOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutObjectRetentionOutcome S3Client::PutObjectRetention(const PutObjectRetentionRequest& request) const
@@ -3522,7 +5746,7 @@ PutObjectRetentionOutcome S3Client::PutObjectRetention(const PutObjectRetentionR
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?retention");
   uri.SetQueryString(ss.str());
-  return PutObjectRetentionOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutObjectRetentionOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutObjectRetentionOutcomeCallable S3Client::PutObjectRetentionCallable(const PutObjectRetentionRequest& request) const
@@ -3540,7 +5764,40 @@ void S3Client::PutObjectRetentionAsync(const PutObjectRetentionRequest& request,
 
 void S3Client::PutObjectRetentionAsyncHelper(const PutObjectRetentionRequest& request, const PutObjectRetentionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObjectRetention(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutObjectRetention(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectRetention", "Required field: Bucket, is not set");
+    handler(this, request, PutObjectRetentionOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectRetention", "Required field: Key, is not set");
+    handler(this, request, PutObjectRetentionOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutObjectRetentionOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?retention");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutObjectRetentionRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutObjectRetentionOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutObjectTaggingOutcome S3Client::PutObjectTagging(const PutObjectTaggingRequest& request) const
@@ -3567,7 +5824,7 @@ PutObjectTaggingOutcome S3Client::PutObjectTagging(const PutObjectTaggingRequest
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?tagging");
   uri.SetQueryString(ss.str());
-  return PutObjectTaggingOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutObjectTaggingOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutObjectTaggingOutcomeCallable S3Client::PutObjectTaggingCallable(const PutObjectTaggingRequest& request) const
@@ -3585,7 +5842,40 @@ void S3Client::PutObjectTaggingAsync(const PutObjectTaggingRequest& request, con
 
 void S3Client::PutObjectTaggingAsyncHelper(const PutObjectTaggingRequest& request, const PutObjectTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObjectTagging(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutObjectTagging(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectTagging", "Required field: Bucket, is not set");
+    handler(this, request, PutObjectTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutObjectTagging", "Required field: Key, is not set");
+    handler(this, request, PutObjectTaggingOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutObjectTaggingOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?tagging");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutObjectTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutObjectTaggingOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 PutPublicAccessBlockOutcome S3Client::PutPublicAccessBlock(const PutPublicAccessBlockRequest& request) const
@@ -3604,7 +5894,7 @@ PutPublicAccessBlockOutcome S3Client::PutPublicAccessBlock(const PutPublicAccess
   Aws::StringStream ss;
   ss.str("?publicAccessBlock");
   uri.SetQueryString(ss.str());
-  return PutPublicAccessBlockOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return PutPublicAccessBlockOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 PutPublicAccessBlockOutcomeCallable S3Client::PutPublicAccessBlockCallable(const PutPublicAccessBlockRequest& request) const
@@ -3622,7 +5912,31 @@ void S3Client::PutPublicAccessBlockAsync(const PutPublicAccessBlockRequest& requ
 
 void S3Client::PutPublicAccessBlockAsyncHelper(const PutPublicAccessBlockRequest& request, const PutPublicAccessBlockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutPublicAccessBlock(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, PutPublicAccessBlock(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("PutPublicAccessBlock", "Required field: Bucket, is not set");
+    handler(this, request, PutPublicAccessBlockOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, PutPublicAccessBlockOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss.str("?publicAccessBlock");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<PutPublicAccessBlockRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, PutPublicAccessBlockOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request) const
@@ -3649,7 +5963,7 @@ RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request
   uri.SetPath(uri.GetPath() + ss.str());
   ss.str("?restore");
   uri.SetQueryString(ss.str());
-  return RestoreObjectOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return RestoreObjectOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(const RestoreObjectRequest& request) const
@@ -3667,7 +5981,40 @@ void S3Client::RestoreObjectAsync(const RestoreObjectRequest& request, const Res
 
 void S3Client::RestoreObjectAsyncHelper(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RestoreObject(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, RestoreObject(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("RestoreObject", "Required field: Bucket, is not set");
+    handler(this, request, RestoreObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("RestoreObject", "Required field: Key, is not set");
+    handler(this, request, RestoreObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, RestoreObjectOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?restore");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, RestoreObjectOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 SelectObjectContentOutcome S3Client::SelectObjectContent(SelectObjectContentRequest& request) const
@@ -3750,7 +6097,7 @@ UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return UploadPartOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return UploadPartOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 UploadPartOutcomeCallable S3Client::UploadPartCallable(const UploadPartRequest& request) const
@@ -3768,7 +6115,50 @@ void S3Client::UploadPartAsync(const UploadPartRequest& request, const UploadPar
 
 void S3Client::UploadPartAsyncHelper(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UploadPart(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UploadPart(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPart", "Required field: Bucket, is not set");
+    handler(this, request, UploadPartOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPart", "Required field: Key, is not set");
+    handler(this, request, UploadPartOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  if (!request.PartNumberHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPart", "Required field: PartNumber, is not set");
+    handler(this, request, UploadPartOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [PartNumber]", false)), context);
+    return;
+  }
+  if (!request.UploadIdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPart", "Required field: UploadId, is not set");
+    handler(this, request, UploadPartOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [UploadId]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, UploadPartOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UploadPartRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, UploadPartOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& request) const
@@ -3808,7 +6198,7 @@ UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& requ
   ss << "/";
   ss << request.GetKey();
   uri.SetPath(uri.GetPath() + ss.str());
-  return UploadPartCopyOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
+  return UploadPartCopyOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/));
 }
 
 UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(const UploadPartCopyRequest& request) const
@@ -3826,7 +6216,56 @@ void S3Client::UploadPartCopyAsync(const UploadPartCopyRequest& request, const U
 
 void S3Client::UploadPartCopyAsyncHelper(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UploadPartCopy(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UploadPartCopy(request), context);
+    return;
+  }
+  if (!request.BucketHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPartCopy", "Required field: Bucket, is not set");
+    handler(this, request, UploadPartCopyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Bucket]", false)), context);
+    return;
+  }
+  if (!request.CopySourceHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPartCopy", "Required field: CopySource, is not set");
+    handler(this, request, UploadPartCopyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [CopySource]", false)), context);
+    return;
+  }
+  if (!request.KeyHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPartCopy", "Required field: Key, is not set");
+    handler(this, request, UploadPartCopyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [Key]", false)), context);
+    return;
+  }
+  if (!request.PartNumberHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPartCopy", "Required field: PartNumber, is not set");
+    handler(this, request, UploadPartCopyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [PartNumber]", false)), context);
+    return;
+  }
+  if (!request.UploadIdHasBeenSet())
+  {
+    AWS_LOGSTREAM_ERROR("UploadPartCopy", "Required field: UploadId, is not set");
+    handler(this, request, UploadPartCopyOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::MISSING_PARAMETER, "MISSING_PARAMETER", "Missing required field [UploadId]", false)), context);
+    return;
+  }
+  ComputeEndpointOutcome computeEndpointOutcome = ComputeEndpointString(request.GetBucket());
+  if (!computeEndpointOutcome.IsSuccess())
+  {
+    handler(this, request, UploadPartCopyOutcome(computeEndpointOutcome.GetError()), context);
+    return;
+  }
+  Aws::Http::URI uri = computeEndpointOutcome.GetResult().endpoint;
+  Aws::StringStream ss;
+  ss << "/";
+  ss << request.GetKey();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UploadPartCopyRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithXmlReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::XmlReaderOutcome&& outcome){ handler(this, *sharedRequest, UploadPartCopyOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_PUT, Aws::Auth::SIGV4_SIGNER, computeEndpointOutcome.GetResult().signerRegion.c_str() /*signerRegionOverride*/, computeEndpointOutcome.GetResult().signerServiceName.c_str() /*signerServiceNameOverride*/);
 }
 
 
@@ -4079,6 +6518,39 @@ ComputeEndpointOutcome S3Client::ComputeEndpointString() const
     return ComputeEndpointOutcome(ComputeEndpointResult(ss.str(), Aws::Region::ComputeSignerRegion(m_region), SERVICE_NAME));
 }
 
+S3Client::ListObjectsV2Paginator S3Client::ListObjectsV2Pages(const ListObjectsV2Request& request, size_t prefetchDepth) const
+{
+  return ListObjectsV2PagesByPrefix(request, Aws::Vector<Aws::String>(1, ""), prefetchDepth);
+}
+
+S3Client::ListObjectsV2Paginator S3Client::ListObjectsV2PagesByPrefix(const ListObjectsV2Request& request, const Aws::Vector<Aws::String>& prefixes, size_t prefetchDepth) const
+{
+  Aws::Vector<ListObjectsV2Request> requests;
+  requests.reserve(prefixes.size());
+  for (const auto& prefix : prefixes)
+  {
+    requests.push_back(request);
+    // An empty Prefix would still be sent, leave it unset when there is nothing to list under.
+    if (request.PrefixHasBeenSet() || !prefix.empty())
+    {
+      requests.back().SetPrefix(request.GetPrefix() + prefix);
+    }
+  }
+
+  return ListObjectsV2Paginator(requests,
+    [this](const ListObjectsV2Request& pageRequest) { return ListObjectsV2(pageRequest); },
+    [](const ListObjectsV2Result& result, ListObjectsV2Request& nextRequest)
+    {
+      if (!result.GetIsTruncated() || result.GetNextContinuationToken().empty())
+      {
+        return false;
+      }
+      nextRequest.SetContinuationToken(result.GetNextContinuationToken());
+      return true;
+    },
+    m_executor, prefetchDepth);
+}
+
 bool S3Client::MultipartUploadSupported() const
 {
     return true;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AbortIncompleteMultipartUpload.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ AbortIncompleteMultipartUpload::AbortIncompleteMultipartUpload(const XmlNode& xm
   *this = xmlNode;
 }
 
+AbortIncompleteMultipartUpload::AbortIncompleteMultipartUpload(XmlReader& reader) : 
+    m_daysAfterInitiation(0),
+    m_daysAfterInitiationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AbortIncompleteMultipartUpload& AbortIncompleteMultipartUpload::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ AbortIncompleteMultipartUpload& AbortIncompleteMultipartUpload::operator =(const
   return *this;
 }
 
+AbortIncompleteMultipartUpload& AbortIncompleteMultipartUpload::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("DaysAfterInitiation"))
+      {
+        m_daysAfterInitiation = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_daysAfterInitiationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AbortIncompleteMultipartUpload::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AccelerateConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ AccelerateConfiguration::AccelerateConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+AccelerateConfiguration::AccelerateConfiguration(XmlReader& reader) : 
+    m_status(BucketAccelerateStatus::NOT_SET),
+    m_statusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AccelerateConfiguration& AccelerateConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ AccelerateConfiguration& AccelerateConfiguration::operator =(const XmlNode& xmlN
   return *this;
 }
 
+AccelerateConfiguration& AccelerateConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = BucketAccelerateStatusMapper::GetBucketAccelerateStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AccelerateConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AccessControlPolicy.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ AccessControlPolicy::AccessControlPolicy(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+AccessControlPolicy::AccessControlPolicy(XmlReader& reader) : 
+    m_grantsHasBeenSet(false),
+    m_ownerHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AccessControlPolicy& AccessControlPolicy::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -62,6 +70,36 @@ AccessControlPolicy& AccessControlPolicy::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+AccessControlPolicy& AccessControlPolicy::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("AccessControlList"))
+      {
+        if(reader.StartElement())
+        {
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Grant"))
+            {
+              m_grants.push_back(reader);
+            }
+          }
+        }
+        m_grantsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Owner"))
+      {
+        m_owner = reader;
+        m_ownerHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AccessControlPolicy::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AccessControlTranslation.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ AccessControlTranslation::AccessControlTranslation(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+AccessControlTranslation::AccessControlTranslation(XmlReader& reader) : 
+    m_owner(OwnerOverride::NOT_SET),
+    m_ownerHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AccessControlTranslation& AccessControlTranslation::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ AccessControlTranslation& AccessControlTranslation::operator =(const XmlNode& xm
   return *this;
 }
 
+AccessControlTranslation& AccessControlTranslation::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Owner"))
+      {
+        m_owner = OwnerOverrideMapper::GetOwnerOverrideForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_ownerHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AccessControlTranslation::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AnalyticsAndOperator.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ AnalyticsAndOperator::AnalyticsAndOperator(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+AnalyticsAndOperator::AnalyticsAndOperator(XmlReader& reader) : 
+    m_prefixHasBeenSet(false),
+    m_tagsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AnalyticsAndOperator& AnalyticsAndOperator::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -62,6 +70,27 @@ AnalyticsAndOperator& AnalyticsAndOperator::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+AnalyticsAndOperator& AnalyticsAndOperator::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tag"))
+      {
+        m_tags.push_back(reader);
+        m_tagsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AnalyticsAndOperator::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AnalyticsConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ AnalyticsConfiguration::AnalyticsConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+AnalyticsConfiguration::AnalyticsConfiguration(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_filterHasBeenSet(false),
+    m_storageClassAnalysisHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AnalyticsConfiguration& AnalyticsConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -64,6 +73,32 @@ AnalyticsConfiguration& AnalyticsConfiguration::operator =(const XmlNode& xmlNod
   return *this;
 }
 
+AnalyticsConfiguration& AnalyticsConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StorageClassAnalysis"))
+      {
+        m_storageClassAnalysis = reader;
+        m_storageClassAnalysisHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AnalyticsConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AnalyticsExportDestination.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ AnalyticsExportDestination::AnalyticsExportDestination(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+AnalyticsExportDestination::AnalyticsExportDestination(XmlReader& reader) : 
+    m_s3BucketDestinationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AnalyticsExportDestination& AnalyticsExportDestination::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ AnalyticsExportDestination& AnalyticsExportDestination::operator =(const XmlNode
   return *this;
 }
 
+AnalyticsExportDestination& AnalyticsExportDestination::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("S3BucketDestination"))
+      {
+        m_s3BucketDestination = reader;
+        m_s3BucketDestinationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AnalyticsExportDestination::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
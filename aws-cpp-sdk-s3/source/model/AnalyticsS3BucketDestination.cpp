@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/AnalyticsS3BucketDestination.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -39,6 +40,16 @@ AnalyticsS3BucketDestination::AnalyticsS3BucketDestination(const XmlNode& xmlNod
   *this = xmlNode;
 }
 
+AnalyticsS3BucketDestination::AnalyticsS3BucketDestination(XmlReader& reader) : 
+    m_format(AnalyticsS3ExportFileFormat::NOT_SET),
+    m_formatHasBeenSet(false),
+    m_bucketAccountIdHasBeenSet(false),
+    m_bucketHasBeenSet(false),
+    m_prefixHasBeenSet(false)
+{
+  *this = reader;
+}
+
 AnalyticsS3BucketDestination& AnalyticsS3BucketDestination::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -74,6 +85,37 @@ AnalyticsS3BucketDestination& AnalyticsS3BucketDestination::operator =(const Xml
   return *this;
 }
 
+AnalyticsS3BucketDestination& AnalyticsS3BucketDestination::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Format"))
+      {
+        m_format = AnalyticsS3ExportFileFormatMapper::GetAnalyticsS3ExportFileFormatForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_formatHasBeenSet = true;
+      }
+      else if(reader.NameEquals("BucketAccountId"))
+      {
+        m_bucketAccountId = reader.ReadText();
+        m_bucketAccountIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Bucket"))
+      {
+        m_bucket = reader.ReadText();
+        m_bucketHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void AnalyticsS3BucketDestination::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Bucket.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ Bucket::Bucket(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Bucket::Bucket(XmlReader& reader) : 
+    m_nameHasBeenSet(false),
+    m_creationDateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Bucket& Bucket::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ Bucket& Bucket::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Bucket& Bucket::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Name"))
+      {
+        m_name = reader.ReadText();
+        m_nameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("CreationDate"))
+      {
+        m_creationDate = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_creationDateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Bucket::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/BucketLifecycleConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ BucketLifecycleConfiguration::BucketLifecycleConfiguration(const XmlNode& xmlNod
   *this = xmlNode;
 }
 
+BucketLifecycleConfiguration::BucketLifecycleConfiguration(XmlReader& reader) : 
+    m_rulesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BucketLifecycleConfiguration& BucketLifecycleConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -54,6 +61,22 @@ BucketLifecycleConfiguration& BucketLifecycleConfiguration::operator =(const Xml
   return *this;
 }
 
+BucketLifecycleConfiguration& BucketLifecycleConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Rule"))
+      {
+        m_rules.push_back(reader);
+        m_rulesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void BucketLifecycleConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
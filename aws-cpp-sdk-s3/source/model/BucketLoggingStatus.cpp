@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/BucketLoggingStatus.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ BucketLoggingStatus::BucketLoggingStatus(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+BucketLoggingStatus::BucketLoggingStatus(XmlReader& reader) : 
+    m_loggingEnabledHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BucketLoggingStatus& BucketLoggingStatus::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ BucketLoggingStatus& BucketLoggingStatus::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+BucketLoggingStatus& BucketLoggingStatus::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("LoggingEnabled"))
+      {
+        m_loggingEnabled = reader;
+        m_loggingEnabledHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void BucketLoggingStatus::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
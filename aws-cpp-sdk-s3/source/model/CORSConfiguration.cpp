@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CORSConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ CORSConfiguration::CORSConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CORSConfiguration::CORSConfiguration(XmlReader& reader) : 
+    m_cORSRulesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CORSConfiguration& CORSConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -54,6 +61,22 @@ CORSConfiguration& CORSConfiguration::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CORSConfiguration& CORSConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("CORSRule"))
+      {
+        m_cORSRules.push_back(reader);
+        m_cORSRulesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CORSConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
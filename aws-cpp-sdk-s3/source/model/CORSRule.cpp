@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CORSRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ CORSRule::CORSRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CORSRule::CORSRule(XmlReader& reader) : 
+    m_allowedHeadersHasBeenSet(false),
+    m_allowedMethodsHasBeenSet(false),
+    m_allowedOriginsHasBeenSet(false),
+    m_exposeHeadersHasBeenSet(false),
+    m_maxAgeSeconds(0),
+    m_maxAgeSecondsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CORSRule& CORSRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -106,6 +118,42 @@ CORSRule& CORSRule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CORSRule& CORSRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("AllowedHeader"))
+      {
+        m_allowedHeaders.push_back(reader.ReadText());
+        m_allowedHeadersHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AllowedMethod"))
+      {
+        m_allowedMethods.push_back(reader.ReadText());
+        m_allowedMethodsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AllowedOrigin"))
+      {
+        m_allowedOrigins.push_back(reader.ReadText());
+        m_allowedOriginsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ExposeHeader"))
+      {
+        m_exposeHeaders.push_back(reader.ReadText());
+        m_exposeHeadersHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MaxAgeSeconds"))
+      {
+        m_maxAgeSeconds = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_maxAgeSecondsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CORSRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CSVInput.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -47,6 +48,20 @@ CSVInput::CSVInput(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CSVInput::CSVInput(XmlReader& reader) : 
+    m_fileHeaderInfo(FileHeaderInfo::NOT_SET),
+    m_fileHeaderInfoHasBeenSet(false),
+    m_commentsHasBeenSet(false),
+    m_quoteEscapeCharacterHasBeenSet(false),
+    m_recordDelimiterHasBeenSet(false),
+    m_fieldDelimiterHasBeenSet(false),
+    m_quoteCharacterHasBeenSet(false),
+    m_allowQuotedRecordDelimiter(false),
+    m_allowQuotedRecordDelimiterHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CSVInput& CSVInput::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -100,6 +115,52 @@ CSVInput& CSVInput::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CSVInput& CSVInput::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("FileHeaderInfo"))
+      {
+        m_fileHeaderInfo = FileHeaderInfoMapper::GetFileHeaderInfoForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_fileHeaderInfoHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Comments"))
+      {
+        m_comments = reader.ReadText();
+        m_commentsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("QuoteEscapeCharacter"))
+      {
+        m_quoteEscapeCharacter = reader.ReadText();
+        m_quoteEscapeCharacterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("RecordDelimiter"))
+      {
+        m_recordDelimiter = reader.ReadText();
+        m_recordDelimiterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("FieldDelimiter"))
+      {
+        m_fieldDelimiter = reader.ReadText();
+        m_fieldDelimiterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("QuoteCharacter"))
+      {
+        m_quoteCharacter = reader.ReadText();
+        m_quoteCharacterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AllowQuotedRecordDelimiter"))
+      {
+        m_allowQuotedRecordDelimiter = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_allowQuotedRecordDelimiterHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CSVInput::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
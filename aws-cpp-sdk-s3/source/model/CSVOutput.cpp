@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CSVOutput.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ CSVOutput::CSVOutput(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CSVOutput::CSVOutput(XmlReader& reader) : 
+    m_quoteFields(QuoteFields::NOT_SET),
+    m_quoteFieldsHasBeenSet(false),
+    m_quoteEscapeCharacterHasBeenSet(false),
+    m_recordDelimiterHasBeenSet(false),
+    m_fieldDelimiterHasBeenSet(false),
+    m_quoteCharacterHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CSVOutput& CSVOutput::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -82,6 +94,42 @@ CSVOutput& CSVOutput::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CSVOutput& CSVOutput::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("QuoteFields"))
+      {
+        m_quoteFields = QuoteFieldsMapper::GetQuoteFieldsForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_quoteFieldsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("QuoteEscapeCharacter"))
+      {
+        m_quoteEscapeCharacter = reader.ReadText();
+        m_quoteEscapeCharacterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("RecordDelimiter"))
+      {
+        m_recordDelimiter = reader.ReadText();
+        m_recordDelimiterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("FieldDelimiter"))
+      {
+        m_fieldDelimiter = reader.ReadText();
+        m_fieldDelimiterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("QuoteCharacter"))
+      {
+        m_quoteCharacter = reader.ReadText();
+        m_quoteCharacterHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CSVOutput::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
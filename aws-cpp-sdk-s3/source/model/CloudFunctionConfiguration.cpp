@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CloudFunctionConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ CloudFunctionConfiguration::CloudFunctionConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CloudFunctionConfiguration::CloudFunctionConfiguration(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_eventsHasBeenSet(false),
+    m_cloudFunctionHasBeenSet(false),
+    m_invocationRoleHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CloudFunctionConfiguration& CloudFunctionConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -78,6 +88,37 @@ CloudFunctionConfiguration& CloudFunctionConfiguration::operator =(const XmlNode
   return *this;
 }
 
+CloudFunctionConfiguration& CloudFunctionConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Event"))
+      {
+        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(reader.ReadText().c_str())));
+        m_eventsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("CloudFunction"))
+      {
+        m_cloudFunction = reader.ReadText();
+        m_cloudFunctionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("InvocationRole"))
+      {
+        m_invocationRole = reader.ReadText();
+        m_invocationRoleHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CloudFunctionConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
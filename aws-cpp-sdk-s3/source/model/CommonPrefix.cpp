@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CommonPrefix.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ CommonPrefix::CommonPrefix(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CommonPrefix::CommonPrefix(XmlReader& reader) : 
+    m_prefixHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CommonPrefix& CommonPrefix::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ CommonPrefix& CommonPrefix::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CommonPrefix& CommonPrefix::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CommonPrefix::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CompleteMultipartUploadResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -99,3 +100,80 @@ CompleteMultipartUploadResult& CompleteMultipartUploadResult::operator =(const A
 
   return *this;
 }
+
+CompleteMultipartUploadResult::CompleteMultipartUploadResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_serverSideEncryption(ServerSideEncryption::NOT_SET),
+    m_bucketKeyEnabled(false),
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+CompleteMultipartUploadResult& CompleteMultipartUploadResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Location"))
+        {
+          m_location = reader.ReadText();
+        }
+        else if(reader.NameEquals("Bucket"))
+        {
+          m_bucket = reader.ReadText();
+        }
+        else if(reader.NameEquals("Key"))
+        {
+          m_key = reader.ReadText();
+        }
+        else if(reader.NameEquals("ETag"))
+        {
+          m_eTag = reader.ReadText();
+        }
+      }
+    }
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& expirationIter = headers.find("x-amz-expiration");
+  if(expirationIter != headers.end())
+  {
+    m_expiration = expirationIter->second;
+  }
+
+  const auto& serverSideEncryptionIter = headers.find("x-amz-server-side-encryption");
+  if(serverSideEncryptionIter != headers.end())
+  {
+    m_serverSideEncryption = ServerSideEncryptionMapper::GetServerSideEncryptionForName(serverSideEncryptionIter->second);
+  }
+
+  const auto& versionIdIter = headers.find("x-amz-version-id");
+  if(versionIdIter != headers.end())
+  {
+    m_versionId = versionIdIter->second;
+  }
+
+  const auto& sSEKMSKeyIdIter = headers.find("x-amz-server-side-encryption-aws-kms-key-id");
+  if(sSEKMSKeyIdIter != headers.end())
+  {
+    m_sSEKMSKeyId = sSEKMSKeyIdIter->second;
+  }
+
+  const auto& bucketKeyEnabledIter = headers.find("x-amz-server-side-encryption-bucket-key-enabled");
+  if(bucketKeyEnabledIter != headers.end())
+  {
+     m_bucketKeyEnabled = StringUtils::ConvertToBool(bucketKeyEnabledIter->second.c_str());
+  }
+
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
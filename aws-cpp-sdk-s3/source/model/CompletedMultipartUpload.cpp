@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CompletedMultipartUpload.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ CompletedMultipartUpload::CompletedMultipartUpload(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CompletedMultipartUpload::CompletedMultipartUpload(XmlReader& reader) : 
+    m_partsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CompletedMultipartUpload& CompletedMultipartUpload::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -54,6 +61,22 @@ CompletedMultipartUpload& CompletedMultipartUpload::operator =(const XmlNode& xm
   return *this;
 }
 
+CompletedMultipartUpload& CompletedMultipartUpload::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Part"))
+      {
+        m_parts.push_back(reader);
+        m_partsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CompletedMultipartUpload::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CompletedPart.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ CompletedPart::CompletedPart(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CompletedPart::CompletedPart(XmlReader& reader) : 
+    m_eTagHasBeenSet(false),
+    m_partNumber(0),
+    m_partNumberHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CompletedPart& CompletedPart::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ CompletedPart& CompletedPart::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CompletedPart& CompletedPart::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ETag"))
+      {
+        m_eTag = reader.ReadText();
+        m_eTagHasBeenSet = true;
+      }
+      else if(reader.NameEquals("PartNumber"))
+      {
+        m_partNumber = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_partNumberHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CompletedPart::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
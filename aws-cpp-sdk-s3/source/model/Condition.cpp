@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Condition.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ Condition::Condition(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Condition::Condition(XmlReader& reader) : 
+    m_httpErrorCodeReturnedEqualsHasBeenSet(false),
+    m_keyPrefixEqualsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Condition& Condition::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ Condition& Condition::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Condition& Condition::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("HttpErrorCodeReturnedEquals"))
+      {
+        m_httpErrorCodeReturnedEquals = reader.ReadText();
+        m_httpErrorCodeReturnedEqualsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("KeyPrefixEquals"))
+      {
+        m_keyPrefixEquals = reader.ReadText();
+        m_keyPrefixEqualsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Condition::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CopyObjectResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -104,3 +105,83 @@ CopyObjectResult& CopyObjectResult::operator =(const Aws::AmazonWebServiceResult
 
   return *this;
 }
+
+CopyObjectResult::CopyObjectResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_serverSideEncryption(ServerSideEncryption::NOT_SET),
+    m_bucketKeyEnabled(false),
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+CopyObjectResult& CopyObjectResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_copyObjectResultDetails = reader;
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& expirationIter = headers.find("x-amz-expiration");
+  if(expirationIter != headers.end())
+  {
+    m_expiration = expirationIter->second;
+  }
+
+  const auto& copySourceVersionIdIter = headers.find("x-amz-copy-source-version-id");
+  if(copySourceVersionIdIter != headers.end())
+  {
+    m_copySourceVersionId = copySourceVersionIdIter->second;
+  }
+
+  const auto& versionIdIter = headers.find("x-amz-version-id");
+  if(versionIdIter != headers.end())
+  {
+    m_versionId = versionIdIter->second;
+  }
+
+  const auto& serverSideEncryptionIter = headers.find("x-amz-server-side-encryption");
+  if(serverSideEncryptionIter != headers.end())
+  {
+    m_serverSideEncryption = ServerSideEncryptionMapper::GetServerSideEncryptionForName(serverSideEncryptionIter->second);
+  }
+
+  const auto& sSECustomerAlgorithmIter = headers.find("x-amz-server-side-encryption-customer-algorithm");
+  if(sSECustomerAlgorithmIter != headers.end())
+  {
+    m_sSECustomerAlgorithm = sSECustomerAlgorithmIter->second;
+  }
+
+  const auto& sSECustomerKeyMD5Iter = headers.find("x-amz-server-side-encryption-customer-key-md5");
+  if(sSECustomerKeyMD5Iter != headers.end())
+  {
+    m_sSECustomerKeyMD5 = sSECustomerKeyMD5Iter->second;
+  }
+
+  const auto& sSEKMSKeyIdIter = headers.find("x-amz-server-side-encryption-aws-kms-key-id");
+  if(sSEKMSKeyIdIter != headers.end())
+  {
+    m_sSEKMSKeyId = sSEKMSKeyIdIter->second;
+  }
+
+  const auto& sSEKMSEncryptionContextIter = headers.find("x-amz-server-side-encryption-context");
+  if(sSEKMSEncryptionContextIter != headers.end())
+  {
+    m_sSEKMSEncryptionContext = sSEKMSEncryptionContextIter->second;
+  }
+
+  const auto& bucketKeyEnabledIter = headers.find("x-amz-server-side-encryption-bucket-key-enabled");
+  if(bucketKeyEnabledIter != headers.end())
+  {
+     m_bucketKeyEnabled = StringUtils::ConvertToBool(bucketKeyEnabledIter->second.c_str());
+  }
+
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CopyObjectResultDetails.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ CopyObjectResultDetails::CopyObjectResultDetails(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CopyObjectResultDetails::CopyObjectResultDetails(XmlReader& reader) : 
+    m_eTagHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CopyObjectResultDetails& CopyObjectResultDetails::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ CopyObjectResultDetails& CopyObjectResultDetails::operator =(const XmlNode& xmlN
   return *this;
 }
 
+CopyObjectResultDetails& CopyObjectResultDetails::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ETag"))
+      {
+        m_eTag = reader.ReadText();
+        m_eTagHasBeenSet = true;
+      }
+      else if(reader.NameEquals("LastModified"))
+      {
+        m_lastModified = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_lastModifiedHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CopyObjectResultDetails::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CopyPartResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ CopyPartResult::CopyPartResult(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CopyPartResult::CopyPartResult(XmlReader& reader) : 
+    m_eTagHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CopyPartResult& CopyPartResult::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ CopyPartResult& CopyPartResult::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CopyPartResult& CopyPartResult::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ETag"))
+      {
+        m_eTag = reader.ReadText();
+        m_eTagHasBeenSet = true;
+      }
+      else if(reader.NameEquals("LastModified"))
+      {
+        m_lastModified = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_lastModifiedHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CopyPartResult::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
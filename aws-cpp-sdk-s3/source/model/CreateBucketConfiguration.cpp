@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CreateBucketConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ CreateBucketConfiguration::CreateBucketConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+CreateBucketConfiguration::CreateBucketConfiguration(XmlReader& reader) : 
+    m_locationConstraint(BucketLocationConstraint::NOT_SET),
+    m_locationConstraintHasBeenSet(false)
+{
+  *this = reader;
+}
+
 CreateBucketConfiguration& CreateBucketConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ CreateBucketConfiguration& CreateBucketConfiguration::operator =(const XmlNode&
   return *this;
 }
 
+CreateBucketConfiguration& CreateBucketConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("LocationConstraint"))
+      {
+        m_locationConstraint = BucketLocationConstraintMapper::GetBucketLocationConstraintForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_locationConstraintHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void CreateBucketConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CreateBucketResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -43,3 +44,25 @@ CreateBucketResult& CreateBucketResult::operator =(const Aws::AmazonWebServiceRe
 
   return *this;
 }
+
+CreateBucketResult::CreateBucketResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+CreateBucketResult& CreateBucketResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& locationIter = headers.find("location");
+  if(locationIter != headers.end())
+  {
+    m_location = locationIter->second;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/CreateMultipartUploadResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -112,3 +113,94 @@ CreateMultipartUploadResult& CreateMultipartUploadResult::operator =(const Aws::
 
   return *this;
 }
+
+CreateMultipartUploadResult::CreateMultipartUploadResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_serverSideEncryption(ServerSideEncryption::NOT_SET),
+    m_bucketKeyEnabled(false),
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+CreateMultipartUploadResult& CreateMultipartUploadResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Bucket"))
+        {
+          m_bucket = reader.ReadText();
+        }
+        else if(reader.NameEquals("Key"))
+        {
+          m_key = reader.ReadText();
+        }
+        else if(reader.NameEquals("UploadId"))
+        {
+          m_uploadId = reader.ReadText();
+        }
+      }
+    }
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& abortDateIter = headers.find("x-amz-abort-date");
+  if(abortDateIter != headers.end())
+  {
+    m_abortDate = DateTime(abortDateIter->second, DateFormat::RFC822);
+  }
+
+  const auto& abortRuleIdIter = headers.find("x-amz-abort-rule-id");
+  if(abortRuleIdIter != headers.end())
+  {
+    m_abortRuleId = abortRuleIdIter->second;
+  }
+
+  const auto& serverSideEncryptionIter = headers.find("x-amz-server-side-encryption");
+  if(serverSideEncryptionIter != headers.end())
+  {
+    m_serverSideEncryption = ServerSideEncryptionMapper::GetServerSideEncryptionForName(serverSideEncryptionIter->second);
+  }
+
+  const auto& sSECustomerAlgorithmIter = headers.find("x-amz-server-side-encryption-customer-algorithm");
+  if(sSECustomerAlgorithmIter != headers.end())
+  {
+    m_sSECustomerAlgorithm = sSECustomerAlgorithmIter->second;
+  }
+
+  const auto& sSECustomerKeyMD5Iter = headers.find("x-amz-server-side-encryption-customer-key-md5");
+  if(sSECustomerKeyMD5Iter != headers.end())
+  {
+    m_sSECustomerKeyMD5 = sSECustomerKeyMD5Iter->second;
+  }
+
+  const auto& sSEKMSKeyIdIter = headers.find("x-amz-server-side-encryption-aws-kms-key-id");
+  if(sSEKMSKeyIdIter != headers.end())
+  {
+    m_sSEKMSKeyId = sSEKMSKeyIdIter->second;
+  }
+
+  const auto& sSEKMSEncryptionContextIter = headers.find("x-amz-server-side-encryption-context");
+  if(sSEKMSEncryptionContextIter != headers.end())
+  {
+    m_sSEKMSEncryptionContext = sSEKMSEncryptionContextIter->second;
+  }
+
+  const auto& bucketKeyEnabledIter = headers.find("x-amz-server-side-encryption-bucket-key-enabled");
+  if(bucketKeyEnabledIter != headers.end())
+  {
+     m_bucketKeyEnabled = StringUtils::ConvertToBool(bucketKeyEnabledIter->second.c_str());
+  }
+
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
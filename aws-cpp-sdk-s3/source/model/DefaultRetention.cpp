@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/DefaultRetention.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ DefaultRetention::DefaultRetention(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+DefaultRetention::DefaultRetention(XmlReader& reader) : 
+    m_mode(ObjectLockRetentionMode::NOT_SET),
+    m_modeHasBeenSet(false),
+    m_days(0),
+    m_daysHasBeenSet(false),
+    m_years(0),
+    m_yearsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DefaultRetention& DefaultRetention::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -70,6 +82,32 @@ DefaultRetention& DefaultRetention::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+DefaultRetention& DefaultRetention::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Mode"))
+      {
+        m_mode = ObjectLockRetentionModeMapper::GetObjectLockRetentionModeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_modeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Days"))
+      {
+        m_days = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_daysHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Years"))
+      {
+        m_years = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_yearsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void DefaultRetention::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Delete.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ Delete::Delete(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Delete::Delete(XmlReader& reader) : 
+    m_objectsHasBeenSet(false),
+    m_quiet(false),
+    m_quietHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Delete& Delete::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -64,6 +73,27 @@ Delete& Delete::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Delete& Delete::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Object"))
+      {
+        m_objects.push_back(reader);
+        m_objectsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Quiet"))
+      {
+        m_quiet = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_quietHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Delete::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
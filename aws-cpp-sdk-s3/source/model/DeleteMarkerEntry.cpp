@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/DeleteMarkerEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ DeleteMarkerEntry::DeleteMarkerEntry(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+DeleteMarkerEntry::DeleteMarkerEntry(XmlReader& reader) : 
+    m_ownerHasBeenSet(false),
+    m_keyHasBeenSet(false),
+    m_versionIdHasBeenSet(false),
+    m_isLatest(false),
+    m_isLatestHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteMarkerEntry& DeleteMarkerEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -82,6 +94,42 @@ DeleteMarkerEntry& DeleteMarkerEntry::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+DeleteMarkerEntry& DeleteMarkerEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Owner"))
+      {
+        m_owner = reader;
+        m_ownerHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("VersionId"))
+      {
+        m_versionId = reader.ReadText();
+        m_versionIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("IsLatest"))
+      {
+        m_isLatest = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_isLatestHasBeenSet = true;
+      }
+      else if(reader.NameEquals("LastModified"))
+      {
+        m_lastModified = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_lastModifiedHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void DeleteMarkerEntry::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/DeleteMarkerReplication.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ DeleteMarkerReplication::DeleteMarkerReplication(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+DeleteMarkerReplication::DeleteMarkerReplication(XmlReader& reader) : 
+    m_status(DeleteMarkerReplicationStatus::NOT_SET),
+    m_statusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteMarkerReplication& DeleteMarkerReplication::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ DeleteMarkerReplication& DeleteMarkerReplication::operator =(const XmlNode& xmlN
   return *this;
 }
 
+DeleteMarkerReplication& DeleteMarkerReplication::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = DeleteMarkerReplicationStatusMapper::GetDeleteMarkerReplicationStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void DeleteMarkerReplication::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
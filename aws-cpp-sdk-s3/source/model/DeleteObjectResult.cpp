@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/DeleteObjectResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -59,3 +60,39 @@ DeleteObjectResult& DeleteObjectResult::operator =(const Aws::AmazonWebServiceRe
 
   return *this;
 }
+
+DeleteObjectResult::DeleteObjectResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_deleteMarker(false),
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+DeleteObjectResult& DeleteObjectResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& deleteMarkerIter = headers.find("x-amz-delete-marker");
+  if(deleteMarkerIter != headers.end())
+  {
+     m_deleteMarker = StringUtils::ConvertToBool(deleteMarkerIter->second.c_str());
+  }
+
+  const auto& versionIdIter = headers.find("x-amz-version-id");
+  if(versionIdIter != headers.end())
+  {
+    m_versionId = versionIdIter->second;
+  }
+
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/DeleteObjectTaggingResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -43,3 +44,25 @@ DeleteObjectTaggingResult& DeleteObjectTaggingResult::operator =(const Aws::Amaz
 
   return *this;
 }
+
+DeleteObjectTaggingResult::DeleteObjectTaggingResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+DeleteObjectTaggingResult& DeleteObjectTaggingResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& versionIdIter = headers.find("x-amz-version-id");
+  if(versionIdIter != headers.end())
+  {
+    m_versionId = versionIdIter->second;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/DeleteObjectsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -67,3 +68,40 @@ DeleteObjectsResult& DeleteObjectsResult::operator =(const Aws::AmazonWebService
 
   return *this;
 }
+
+DeleteObjectsResult::DeleteObjectsResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+DeleteObjectsResult& DeleteObjectsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Deleted"))
+        {
+          m_deleted.push_back(reader);
+        }
+        else if(reader.NameEquals("Error"))
+        {
+          m_errors.push_back(reader);
+        }
+      }
+    }
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
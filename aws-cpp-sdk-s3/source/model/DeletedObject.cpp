@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/DeletedObject.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -39,6 +40,16 @@ DeletedObject::DeletedObject(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+DeletedObject::DeletedObject(XmlReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_versionIdHasBeenSet(false),
+    m_deleteMarker(false),
+    m_deleteMarkerHasBeenSet(false),
+    m_deleteMarkerVersionIdHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeletedObject& DeletedObject::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -74,6 +85,37 @@ DeletedObject& DeletedObject::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+DeletedObject& DeletedObject::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("VersionId"))
+      {
+        m_versionId = reader.ReadText();
+        m_versionIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("DeleteMarker"))
+      {
+        m_deleteMarker = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_deleteMarkerHasBeenSet = true;
+      }
+      else if(reader.NameEquals("DeleteMarkerVersionId"))
+      {
+        m_deleteMarkerVersionId = reader.ReadText();
+        m_deleteMarkerVersionIdHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void DeletedObject::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Destination.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -45,6 +46,19 @@ Destination::Destination(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Destination::Destination(XmlReader& reader) : 
+    m_bucketHasBeenSet(false),
+    m_accountHasBeenSet(false),
+    m_storageClass(StorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false),
+    m_accessControlTranslationHasBeenSet(false),
+    m_encryptionConfigurationHasBeenSet(false),
+    m_replicationTimeHasBeenSet(false),
+    m_metricsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Destination& Destination::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -98,6 +112,52 @@ Destination& Destination::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Destination& Destination::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Bucket"))
+      {
+        m_bucket = reader.ReadText();
+        m_bucketHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Account"))
+      {
+        m_account = reader.ReadText();
+        m_accountHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StorageClass"))
+      {
+        m_storageClass = StorageClassMapper::GetStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_storageClassHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AccessControlTranslation"))
+      {
+        m_accessControlTranslation = reader;
+        m_accessControlTranslationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("EncryptionConfiguration"))
+      {
+        m_encryptionConfiguration = reader;
+        m_encryptionConfigurationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ReplicationTime"))
+      {
+        m_replicationTime = reader;
+        m_replicationTimeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Metrics"))
+      {
+        m_metrics = reader;
+        m_metricsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Destination::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Encryption.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ Encryption::Encryption(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Encryption::Encryption(XmlReader& reader) : 
+    m_encryptionType(ServerSideEncryption::NOT_SET),
+    m_encryptionTypeHasBeenSet(false),
+    m_kMSKeyIdHasBeenSet(false),
+    m_kMSContextHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Encryption& Encryption::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -66,6 +76,32 @@ Encryption& Encryption::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Encryption& Encryption::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("EncryptionType"))
+      {
+        m_encryptionType = ServerSideEncryptionMapper::GetServerSideEncryptionForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_encryptionTypeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("KMSKeyId"))
+      {
+        m_kMSKeyId = reader.ReadText();
+        m_kMSKeyIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("KMSContext"))
+      {
+        m_kMSContext = reader.ReadText();
+        m_kMSContextHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Encryption::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/EncryptionConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ EncryptionConfiguration::EncryptionConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+EncryptionConfiguration::EncryptionConfiguration(XmlReader& reader) : 
+    m_replicaKmsKeyIDHasBeenSet(false)
+{
+  *this = reader;
+}
+
 EncryptionConfiguration& EncryptionConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ EncryptionConfiguration& EncryptionConfiguration::operator =(const XmlNode& xmlN
   return *this;
 }
 
+EncryptionConfiguration& EncryptionConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ReplicaKmsKeyID"))
+      {
+        m_replicaKmsKeyID = reader.ReadText();
+        m_replicaKmsKeyIDHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void EncryptionConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Error.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ Error::Error(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Error::Error(XmlReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_versionIdHasBeenSet(false),
+    m_codeHasBeenSet(false),
+    m_messageHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Error& Error::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -72,6 +82,37 @@ Error& Error::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Error& Error::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("VersionId"))
+      {
+        m_versionId = reader.ReadText();
+        m_versionIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Code"))
+      {
+        m_code = reader.ReadText();
+        m_codeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Message"))
+      {
+        m_message = reader.ReadText();
+        m_messageHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Error::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
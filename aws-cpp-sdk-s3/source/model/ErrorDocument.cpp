@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ErrorDocument.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ ErrorDocument::ErrorDocument(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ErrorDocument::ErrorDocument(XmlReader& reader) : 
+    m_keyHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ErrorDocument& ErrorDocument::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ ErrorDocument& ErrorDocument::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ErrorDocument& ErrorDocument::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ErrorDocument::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
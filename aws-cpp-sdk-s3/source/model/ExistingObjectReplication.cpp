@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ExistingObjectReplication.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ ExistingObjectReplication::ExistingObjectReplication(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ExistingObjectReplication::ExistingObjectReplication(XmlReader& reader) : 
+    m_status(ExistingObjectReplicationStatus::NOT_SET),
+    m_statusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ExistingObjectReplication& ExistingObjectReplication::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ ExistingObjectReplication& ExistingObjectReplication::operator =(const XmlNode&
   return *this;
 }
 
+ExistingObjectReplication& ExistingObjectReplication::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = ExistingObjectReplicationStatusMapper::GetExistingObjectReplicationStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ExistingObjectReplication::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
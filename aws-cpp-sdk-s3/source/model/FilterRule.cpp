@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/FilterRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ FilterRule::FilterRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+FilterRule::FilterRule(XmlReader& reader) : 
+    m_name(FilterRuleName::NOT_SET),
+    m_nameHasBeenSet(false),
+    m_valueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 FilterRule& FilterRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ FilterRule& FilterRule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+FilterRule& FilterRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Name"))
+      {
+        m_name = FilterRuleNameMapper::GetFilterRuleNameForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_nameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Value"))
+      {
+        m_value = reader.ReadText();
+        m_valueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void FilterRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketAccelerateConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -42,3 +43,29 @@ GetBucketAccelerateConfigurationResult& GetBucketAccelerateConfigurationResult::
 
   return *this;
 }
+
+GetBucketAccelerateConfigurationResult::GetBucketAccelerateConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_status(BucketAccelerateStatus::NOT_SET)
+{
+  *this = result;
+}
+
+GetBucketAccelerateConfigurationResult& GetBucketAccelerateConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Status"))
+        {
+          m_status = BucketAccelerateStatusMapper::GetBucketAccelerateStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketAclResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -51,3 +52,41 @@ GetBucketAclResult& GetBucketAclResult::operator =(const Aws::AmazonWebServiceRe
 
   return *this;
 }
+
+GetBucketAclResult::GetBucketAclResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketAclResult& GetBucketAclResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Owner"))
+        {
+          m_owner = reader;
+        }
+        else if(reader.NameEquals("AccessControlList"))
+        {
+          if(reader.StartElement())
+          {
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("Grant"))
+              {
+                m_grants.push_back(reader);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketAnalyticsConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetBucketAnalyticsConfigurationResult& GetBucketAnalyticsConfigurationResult::op
 
   return *this;
 }
+
+GetBucketAnalyticsConfigurationResult::GetBucketAnalyticsConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketAnalyticsConfigurationResult& GetBucketAnalyticsConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_analyticsConfiguration = reader;
+  }
+
+  return *this;
+}
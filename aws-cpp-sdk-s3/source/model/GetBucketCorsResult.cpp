@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketCorsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -46,3 +47,28 @@ GetBucketCorsResult& GetBucketCorsResult::operator =(const Aws::AmazonWebService
 
   return *this;
 }
+
+GetBucketCorsResult::GetBucketCorsResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketCorsResult& GetBucketCorsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("CORSRule"))
+        {
+          m_cORSRules.push_back(reader);
+        }
+      }
+    }
+  }
+
+  return *this;
+}
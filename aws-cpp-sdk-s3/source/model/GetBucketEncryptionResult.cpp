@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketEncryptionResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetBucketEncryptionResult& GetBucketEncryptionResult::operator =(const Aws::Amaz
 
   return *this;
 }
+
+GetBucketEncryptionResult::GetBucketEncryptionResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketEncryptionResult& GetBucketEncryptionResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_serverSideEncryptionConfiguration = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketIntelligentTieringConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetBucketIntelligentTieringConfigurationResult& GetBucketIntelligentTieringConfi
 
   return *this;
 }
+
+GetBucketIntelligentTieringConfigurationResult::GetBucketIntelligentTieringConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketIntelligentTieringConfigurationResult& GetBucketIntelligentTieringConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_intelligentTieringConfiguration = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketInventoryConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetBucketInventoryConfigurationResult& GetBucketInventoryConfigurationResult::op
 
   return *this;
 }
+
+GetBucketInventoryConfigurationResult::GetBucketInventoryConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketInventoryConfigurationResult& GetBucketInventoryConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_inventoryConfiguration = reader;
+  }
+
+  return *this;
+}
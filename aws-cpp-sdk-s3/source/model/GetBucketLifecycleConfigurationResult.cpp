@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketLifecycleConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -46,3 +47,28 @@ GetBucketLifecycleConfigurationResult& GetBucketLifecycleConfigurationResult::op
 
   return *this;
 }
+
+GetBucketLifecycleConfigurationResult::GetBucketLifecycleConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketLifecycleConfigurationResult& GetBucketLifecycleConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Rule"))
+        {
+          m_rules.push_back(reader);
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketLocationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -39,3 +40,19 @@ GetBucketLocationResult& GetBucketLocationResult::operator =(const AmazonWebServ
     return *this; 
 }
 
+GetBucketLocationResult::GetBucketLocationResult(const AmazonWebServiceResult<XmlReader>& result):
+    m_locationConstraint(BucketLocationConstraint::NOT_SET)
+{
+    *this = result;
+}
+
+GetBucketLocationResult& GetBucketLocationResult::operator =(const AmazonWebServiceResult<XmlReader>& result)
+{
+    XmlReader reader(result.GetPayload());
+    if(reader.NextChild())
+    {
+        m_locationConstraint = BucketLocationConstraintMapper::GetBucketLocationConstraintForName(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+    }
+
+    return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketLoggingResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -40,3 +41,28 @@ GetBucketLoggingResult& GetBucketLoggingResult::operator =(const Aws::AmazonWebS
 
   return *this;
 }
+
+GetBucketLoggingResult::GetBucketLoggingResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketLoggingResult& GetBucketLoggingResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("LoggingEnabled"))
+        {
+          m_loggingEnabled = reader;
+        }
+      }
+    }
+  }
+
+  return *this;
+}
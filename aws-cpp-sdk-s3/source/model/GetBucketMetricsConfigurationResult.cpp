@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketMetricsConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetBucketMetricsConfigurationResult& GetBucketMetricsConfigurationResult::operat
 
   return *this;
 }
+
+GetBucketMetricsConfigurationResult::GetBucketMetricsConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketMetricsConfigurationResult& GetBucketMetricsConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_metricsConfiguration = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketNotificationConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -68,3 +69,36 @@ GetBucketNotificationConfigurationResult& GetBucketNotificationConfigurationResu
 
   return *this;
 }
+
+GetBucketNotificationConfigurationResult::GetBucketNotificationConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketNotificationConfigurationResult& GetBucketNotificationConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("TopicConfiguration"))
+        {
+          m_topicConfigurations.push_back(reader);
+        }
+        else if(reader.NameEquals("QueueConfiguration"))
+        {
+          m_queueConfigurations.push_back(reader);
+        }
+        else if(reader.NameEquals("CloudFunctionConfiguration"))
+        {
+          m_lambdaFunctionConfigurations.push_back(reader);
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketOwnershipControlsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetBucketOwnershipControlsResult& GetBucketOwnershipControlsResult::operator =(c
 
   return *this;
 }
+
+GetBucketOwnershipControlsResult::GetBucketOwnershipControlsResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketOwnershipControlsResult& GetBucketOwnershipControlsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_ownershipControls = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketPolicyStatusResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetBucketPolicyStatusResult& GetBucketPolicyStatusResult::operator =(const Aws::
 
   return *this;
 }
+
+GetBucketPolicyStatusResult::GetBucketPolicyStatusResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketPolicyStatusResult& GetBucketPolicyStatusResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_policyStatus = reader;
+  }
+
+  return *this;
+}
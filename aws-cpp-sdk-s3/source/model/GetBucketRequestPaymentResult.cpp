@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketRequestPaymentResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -42,3 +43,29 @@ GetBucketRequestPaymentResult& GetBucketRequestPaymentResult::operator =(const A
 
   return *this;
 }
+
+GetBucketRequestPaymentResult::GetBucketRequestPaymentResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_payer(Payer::NOT_SET)
+{
+  *this = result;
+}
+
+GetBucketRequestPaymentResult& GetBucketRequestPaymentResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Payer"))
+        {
+          m_payer = PayerMapper::GetPayerForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+      }
+    }
+  }
+
+  return *this;
+}
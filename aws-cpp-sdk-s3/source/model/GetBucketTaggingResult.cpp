@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketTaggingResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -46,3 +47,37 @@ GetBucketTaggingResult& GetBucketTaggingResult::operator =(const Aws::AmazonWebS
 
   return *this;
 }
+
+GetBucketTaggingResult::GetBucketTaggingResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketTaggingResult& GetBucketTaggingResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("TagSet"))
+        {
+          if(reader.StartElement())
+          {
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("Tag"))
+              {
+                m_tagSet.push_back(reader);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketVersioningResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -49,3 +50,34 @@ GetBucketVersioningResult& GetBucketVersioningResult::operator =(const Aws::Amaz
 
   return *this;
 }
+
+GetBucketVersioningResult::GetBucketVersioningResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_status(BucketVersioningStatus::NOT_SET),
+    m_mFADelete(MFADeleteStatus::NOT_SET)
+{
+  *this = result;
+}
+
+GetBucketVersioningResult& GetBucketVersioningResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Status"))
+        {
+          m_status = BucketVersioningStatusMapper::GetBucketVersioningStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+        else if(reader.NameEquals("MfaDelete"))
+        {
+          m_mFADelete = MFADeleteStatusMapper::GetMFADeleteStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetBucketWebsiteResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -61,3 +62,49 @@ GetBucketWebsiteResult& GetBucketWebsiteResult::operator =(const Aws::AmazonWebS
 
   return *this;
 }
+
+GetBucketWebsiteResult::GetBucketWebsiteResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetBucketWebsiteResult& GetBucketWebsiteResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("RedirectAllRequestsTo"))
+        {
+          m_redirectAllRequestsTo = reader;
+        }
+        else if(reader.NameEquals("IndexDocument"))
+        {
+          m_indexDocument = reader;
+        }
+        else if(reader.NameEquals("ErrorDocument"))
+        {
+          m_errorDocument = reader;
+        }
+        else if(reader.NameEquals("RoutingRules"))
+        {
+          if(reader.StartElement())
+          {
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("RoutingRule"))
+              {
+                m_routingRules.push_back(reader);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetObjectAclResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -61,3 +62,49 @@ GetObjectAclResult& GetObjectAclResult::operator =(const Aws::AmazonWebServiceRe
 
   return *this;
 }
+
+GetObjectAclResult::GetObjectAclResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+GetObjectAclResult& GetObjectAclResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Owner"))
+        {
+          m_owner = reader;
+        }
+        else if(reader.NameEquals("AccessControlList"))
+        {
+          if(reader.StartElement())
+          {
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("Grant"))
+              {
+                m_grants.push_back(reader);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
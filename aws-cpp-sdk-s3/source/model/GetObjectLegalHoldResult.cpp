@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetObjectLegalHoldResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetObjectLegalHoldResult& GetObjectLegalHoldResult::operator =(const Aws::Amazon
 
   return *this;
 }
+
+GetObjectLegalHoldResult::GetObjectLegalHoldResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetObjectLegalHoldResult& GetObjectLegalHoldResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_legalHold = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetObjectLockConfigurationResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetObjectLockConfigurationResult& GetObjectLockConfigurationResult::operator =(c
 
   return *this;
 }
+
+GetObjectLockConfigurationResult::GetObjectLockConfigurationResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetObjectLockConfigurationResult& GetObjectLockConfigurationResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_objectLockConfiguration = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetObjectRetentionResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetObjectRetentionResult& GetObjectRetentionResult::operator =(const Aws::Amazon
 
   return *this;
 }
+
+GetObjectRetentionResult::GetObjectRetentionResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetObjectRetentionResult& GetObjectRetentionResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_retention = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetObjectTaggingResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -54,3 +55,44 @@ GetObjectTaggingResult& GetObjectTaggingResult::operator =(const Aws::AmazonWebS
 
   return *this;
 }
+
+GetObjectTaggingResult::GetObjectTaggingResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetObjectTaggingResult& GetObjectTaggingResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("TagSet"))
+        {
+          if(reader.StartElement())
+          {
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("Tag"))
+              {
+                m_tagSet.push_back(reader);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& versionIdIter = headers.find("x-amz-version-id");
+  if(versionIdIter != headers.end())
+  {
+    m_versionId = versionIdIter->second;
+  }
+
+  return *this;
+}
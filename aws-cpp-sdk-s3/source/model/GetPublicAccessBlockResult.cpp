@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GetPublicAccessBlockResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -36,3 +37,19 @@ GetPublicAccessBlockResult& GetPublicAccessBlockResult::operator =(const Aws::Am
 
   return *this;
 }
+
+GetPublicAccessBlockResult::GetPublicAccessBlockResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetPublicAccessBlockResult& GetPublicAccessBlockResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    m_publicAccessBlockConfiguration = reader;
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/GlacierJobParameters.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ GlacierJobParameters::GlacierJobParameters(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+GlacierJobParameters::GlacierJobParameters(XmlReader& reader) : 
+    m_tier(Tier::NOT_SET),
+    m_tierHasBeenSet(false)
+{
+  *this = reader;
+}
+
 GlacierJobParameters& GlacierJobParameters::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ GlacierJobParameters& GlacierJobParameters::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+GlacierJobParameters& GlacierJobParameters::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Tier"))
+      {
+        m_tier = TierMapper::GetTierForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_tierHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void GlacierJobParameters::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
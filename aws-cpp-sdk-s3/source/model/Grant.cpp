@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Grant.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ Grant::Grant(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Grant::Grant(XmlReader& reader) : 
+    m_granteeHasBeenSet(false),
+    m_permission(Permission::NOT_SET),
+    m_permissionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Grant& Grant::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ Grant& Grant::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Grant& Grant::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Grantee"))
+      {
+        m_grantee = reader;
+        m_granteeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Permission"))
+      {
+        m_permission = PermissionMapper::GetPermissionForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_permissionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Grant::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
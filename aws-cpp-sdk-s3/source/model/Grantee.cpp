@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Grantee.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ Grantee::Grantee(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Grantee::Grantee(XmlReader& reader) : 
+    m_displayNameHasBeenSet(false),
+    m_emailAddressHasBeenSet(false),
+    m_iDHasBeenSet(false),
+    m_type(Type::NOT_SET),
+    m_typeHasBeenSet(false),
+    m_uRIHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Grantee& Grantee::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -82,6 +94,43 @@ Grantee& Grantee::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Grantee& Grantee::operator =(XmlReader& reader)
+{
+  Aws::String type = reader.GetAttribute("xsi:type");
+  if(!type.empty())
+  {
+    m_type = TypeMapper::GetTypeForName(StringUtils::Trim(type.c_str()));
+    m_typeHasBeenSet = true;
+  }
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("DisplayName"))
+      {
+        m_displayName = reader.ReadText();
+        m_displayNameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("EmailAddress"))
+      {
+        m_emailAddress = reader.ReadText();
+        m_emailAddressHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ID"))
+      {
+        m_iD = reader.ReadText();
+        m_iDHasBeenSet = true;
+      }
+      else if(reader.NameEquals("URI"))
+      {
+        m_uRI = reader.ReadText();
+        m_uRIHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Grantee::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
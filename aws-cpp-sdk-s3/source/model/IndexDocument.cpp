@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/IndexDocument.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ IndexDocument::IndexDocument(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+IndexDocument::IndexDocument(XmlReader& reader) : 
+    m_suffixHasBeenSet(false)
+{
+  *this = reader;
+}
+
 IndexDocument& IndexDocument::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ IndexDocument& IndexDocument::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+IndexDocument& IndexDocument::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Suffix"))
+      {
+        m_suffix = reader.ReadText();
+        m_suffixHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void IndexDocument::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Initiator.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ Initiator::Initiator(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Initiator::Initiator(XmlReader& reader) : 
+    m_iDHasBeenSet(false),
+    m_displayNameHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Initiator& Initiator::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ Initiator& Initiator::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Initiator& Initiator::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ID"))
+      {
+        m_iD = reader.ReadText();
+        m_iDHasBeenSet = true;
+      }
+      else if(reader.NameEquals("DisplayName"))
+      {
+        m_displayName = reader.ReadText();
+        m_displayNameHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Initiator::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
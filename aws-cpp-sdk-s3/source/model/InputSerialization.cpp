@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/InputSerialization.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -39,6 +40,16 @@ InputSerialization::InputSerialization(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+InputSerialization::InputSerialization(XmlReader& reader) : 
+    m_cSVHasBeenSet(false),
+    m_compressionType(CompressionType::NOT_SET),
+    m_compressionTypeHasBeenSet(false),
+    m_jSONHasBeenSet(false),
+    m_parquetHasBeenSet(false)
+{
+  *this = reader;
+}
+
 InputSerialization& InputSerialization::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -74,6 +85,37 @@ InputSerialization& InputSerialization::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+InputSerialization& InputSerialization::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("CSV"))
+      {
+        m_cSV = reader;
+        m_cSVHasBeenSet = true;
+      }
+      else if(reader.NameEquals("CompressionType"))
+      {
+        m_compressionType = CompressionTypeMapper::GetCompressionTypeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_compressionTypeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("JSON"))
+      {
+        m_jSON = reader;
+        m_jSONHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Parquet"))
+      {
+        m_parquet = reader;
+        m_parquetHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void InputSerialization::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
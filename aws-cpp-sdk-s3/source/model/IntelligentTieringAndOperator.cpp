@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/IntelligentTieringAndOperator.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ IntelligentTieringAndOperator::IntelligentTieringAndOperator(const XmlNode& xmlN
   *this = xmlNode;
 }
 
+IntelligentTieringAndOperator::IntelligentTieringAndOperator(XmlReader& reader) : 
+    m_prefixHasBeenSet(false),
+    m_tagsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 IntelligentTieringAndOperator& IntelligentTieringAndOperator::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -62,6 +70,27 @@ IntelligentTieringAndOperator& IntelligentTieringAndOperator::operator =(const X
   return *this;
 }
 
+IntelligentTieringAndOperator& IntelligentTieringAndOperator::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tag"))
+      {
+        m_tags.push_back(reader);
+        m_tagsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void IntelligentTieringAndOperator::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/IntelligentTieringConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -39,6 +40,16 @@ IntelligentTieringConfiguration::IntelligentTieringConfiguration(const XmlNode&
   *this = xmlNode;
 }
 
+IntelligentTieringConfiguration::IntelligentTieringConfiguration(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_filterHasBeenSet(false),
+    m_status(IntelligentTieringStatus::NOT_SET),
+    m_statusHasBeenSet(false),
+    m_tieringsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 IntelligentTieringConfiguration& IntelligentTieringConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -80,6 +91,37 @@ IntelligentTieringConfiguration& IntelligentTieringConfiguration::operator =(con
   return *this;
 }
 
+IntelligentTieringConfiguration& IntelligentTieringConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Status"))
+      {
+        m_status = IntelligentTieringStatusMapper::GetIntelligentTieringStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tiering"))
+      {
+        m_tierings.push_back(reader);
+        m_tieringsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void IntelligentTieringConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
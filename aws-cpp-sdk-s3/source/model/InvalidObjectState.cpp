@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/InvalidObjectState.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ InvalidObjectState::InvalidObjectState(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+InvalidObjectState::InvalidObjectState(XmlReader& reader) : 
+    m_storageClass(StorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false),
+    m_accessTier(IntelligentTieringAccessTier::NOT_SET),
+    m_accessTierHasBeenSet(false)
+{
+  *this = reader;
+}
+
 InvalidObjectState& InvalidObjectState::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -60,6 +70,27 @@ InvalidObjectState& InvalidObjectState::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+InvalidObjectState& InvalidObjectState::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("StorageClass"))
+      {
+        m_storageClass = StorageClassMapper::GetStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_storageClassHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AccessTier"))
+      {
+        m_accessTier = IntelligentTieringAccessTierMapper::GetIntelligentTieringAccessTierForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_accessTierHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void InvalidObjectState::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/InventoryConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -47,6 +48,20 @@ InventoryConfiguration::InventoryConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+InventoryConfiguration::InventoryConfiguration(XmlReader& reader) : 
+    m_destinationHasBeenSet(false),
+    m_isEnabled(false),
+    m_isEnabledHasBeenSet(false),
+    m_filterHasBeenSet(false),
+    m_idHasBeenSet(false),
+    m_includedObjectVersions(InventoryIncludedObjectVersions::NOT_SET),
+    m_includedObjectVersionsHasBeenSet(false),
+    m_optionalFieldsHasBeenSet(false),
+    m_scheduleHasBeenSet(false)
+{
+  *this = reader;
+}
+
 InventoryConfiguration& InventoryConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -106,6 +121,61 @@ InventoryConfiguration& InventoryConfiguration::operator =(const XmlNode& xmlNod
   return *this;
 }
 
+InventoryConfiguration& InventoryConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Destination"))
+      {
+        m_destination = reader;
+        m_destinationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("IsEnabled"))
+      {
+        m_isEnabled = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_isEnabledHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("IncludedObjectVersions"))
+      {
+        m_includedObjectVersions = InventoryIncludedObjectVersionsMapper::GetInventoryIncludedObjectVersionsForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_includedObjectVersionsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("OptionalFields"))
+      {
+        if(reader.StartElement())
+        {
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Field"))
+            {
+              m_optionalFields.push_back(InventoryOptionalFieldMapper::GetInventoryOptionalFieldForName(StringUtils::Trim(reader.ReadText().c_str())));
+            }
+          }
+        }
+        m_optionalFieldsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Schedule"))
+      {
+        m_schedule = reader;
+        m_scheduleHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void InventoryConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/InventoryDestination.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ InventoryDestination::InventoryDestination(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+InventoryDestination::InventoryDestination(XmlReader& reader) : 
+    m_s3BucketDestinationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 InventoryDestination& InventoryDestination::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ InventoryDestination& InventoryDestination::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+InventoryDestination& InventoryDestination::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("S3BucketDestination"))
+      {
+        m_s3BucketDestination = reader;
+        m_s3BucketDestinationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void InventoryDestination::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
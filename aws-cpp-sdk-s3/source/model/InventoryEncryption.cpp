@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/InventoryEncryption.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ InventoryEncryption::InventoryEncryption(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+InventoryEncryption::InventoryEncryption(XmlReader& reader) : 
+    m_sSES3HasBeenSet(false),
+    m_sSEKMSHasBeenSet(false)
+{
+  *this = reader;
+}
+
 InventoryEncryption& InventoryEncryption::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ InventoryEncryption& InventoryEncryption::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+InventoryEncryption& InventoryEncryption::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("SSE-S3"))
+      {
+        m_sSES3 = reader;
+        m_sSES3HasBeenSet = true;
+      }
+      else if(reader.NameEquals("SSE-KMS"))
+      {
+        m_sSEKMS = reader;
+        m_sSEKMSHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void InventoryEncryption::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/InventoryS3BucketDestination.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ InventoryS3BucketDestination::InventoryS3BucketDestination(const XmlNode& xmlNod
   *this = xmlNode;
 }
 
+InventoryS3BucketDestination::InventoryS3BucketDestination(XmlReader& reader) : 
+    m_accountIdHasBeenSet(false),
+    m_bucketHasBeenSet(false),
+    m_format(InventoryFormat::NOT_SET),
+    m_formatHasBeenSet(false),
+    m_prefixHasBeenSet(false),
+    m_encryptionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 InventoryS3BucketDestination& InventoryS3BucketDestination::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -82,6 +94,42 @@ InventoryS3BucketDestination& InventoryS3BucketDestination::operator =(const Xml
   return *this;
 }
 
+InventoryS3BucketDestination& InventoryS3BucketDestination::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("AccountId"))
+      {
+        m_accountId = reader.ReadText();
+        m_accountIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Bucket"))
+      {
+        m_bucket = reader.ReadText();
+        m_bucketHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Format"))
+      {
+        m_format = InventoryFormatMapper::GetInventoryFormatForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_formatHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Encryption"))
+      {
+        m_encryption = reader;
+        m_encryptionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void InventoryS3BucketDestination::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
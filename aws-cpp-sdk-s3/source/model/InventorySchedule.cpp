@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/InventorySchedule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ InventorySchedule::InventorySchedule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+InventorySchedule::InventorySchedule(XmlReader& reader) : 
+    m_frequency(InventoryFrequency::NOT_SET),
+    m_frequencyHasBeenSet(false)
+{
+  *this = reader;
+}
+
 InventorySchedule& InventorySchedule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ InventorySchedule& InventorySchedule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+InventorySchedule& InventorySchedule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Frequency"))
+      {
+        m_frequency = InventoryFrequencyMapper::GetInventoryFrequencyForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_frequencyHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void InventorySchedule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/JSONInput.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ JSONInput::JSONInput(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+JSONInput::JSONInput(XmlReader& reader) : 
+    m_type(JSONType::NOT_SET),
+    m_typeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 JSONInput& JSONInput::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ JSONInput& JSONInput::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+JSONInput& JSONInput::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Type"))
+      {
+        m_type = JSONTypeMapper::GetJSONTypeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_typeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void JSONInput::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
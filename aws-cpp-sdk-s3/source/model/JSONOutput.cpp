@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/JSONOutput.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ JSONOutput::JSONOutput(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+JSONOutput::JSONOutput(XmlReader& reader) : 
+    m_recordDelimiterHasBeenSet(false)
+{
+  *this = reader;
+}
+
 JSONOutput& JSONOutput::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ JSONOutput& JSONOutput::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+JSONOutput& JSONOutput::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("RecordDelimiter"))
+      {
+        m_recordDelimiter = reader.ReadText();
+        m_recordDelimiterHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void JSONOutput::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/LambdaFunctionConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ LambdaFunctionConfiguration::LambdaFunctionConfiguration(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+LambdaFunctionConfiguration::LambdaFunctionConfiguration(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_lambdaFunctionArnHasBeenSet(false),
+    m_eventsHasBeenSet(false),
+    m_filterHasBeenSet(false)
+{
+  *this = reader;
+}
+
 LambdaFunctionConfiguration& LambdaFunctionConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -78,6 +88,37 @@ LambdaFunctionConfiguration& LambdaFunctionConfiguration::operator =(const XmlNo
   return *this;
 }
 
+LambdaFunctionConfiguration& LambdaFunctionConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("CloudFunction"))
+      {
+        m_lambdaFunctionArn = reader.ReadText();
+        m_lambdaFunctionArnHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Event"))
+      {
+        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(reader.ReadText().c_str())));
+        m_eventsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void LambdaFunctionConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
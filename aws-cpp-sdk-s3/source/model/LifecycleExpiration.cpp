@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/LifecycleExpiration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -39,6 +40,16 @@ LifecycleExpiration::LifecycleExpiration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+LifecycleExpiration::LifecycleExpiration(XmlReader& reader) : 
+    m_dateHasBeenSet(false),
+    m_days(0),
+    m_daysHasBeenSet(false),
+    m_expiredObjectDeleteMarker(false),
+    m_expiredObjectDeleteMarkerHasBeenSet(false)
+{
+  *this = reader;
+}
+
 LifecycleExpiration& LifecycleExpiration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -68,6 +79,32 @@ LifecycleExpiration& LifecycleExpiration::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+LifecycleExpiration& LifecycleExpiration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Date"))
+      {
+        m_date = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_dateHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Days"))
+      {
+        m_days = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_daysHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ExpiredObjectDeleteMarker"))
+      {
+        m_expiredObjectDeleteMarker = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_expiredObjectDeleteMarkerHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void LifecycleExpiration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/LifecycleRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -47,6 +48,20 @@ LifecycleRule::LifecycleRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+LifecycleRule::LifecycleRule(XmlReader& reader) : 
+    m_expirationHasBeenSet(false),
+    m_iDHasBeenSet(false),
+    m_filterHasBeenSet(false),
+    m_status(ExpirationStatus::NOT_SET),
+    m_statusHasBeenSet(false),
+    m_transitionsHasBeenSet(false),
+    m_noncurrentVersionTransitionsHasBeenSet(false),
+    m_noncurrentVersionExpirationHasBeenSet(false),
+    m_abortIncompleteMultipartUploadHasBeenSet(false)
+{
+  *this = reader;
+}
+
 LifecycleRule& LifecycleRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -118,6 +133,57 @@ LifecycleRule& LifecycleRule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+LifecycleRule& LifecycleRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Expiration"))
+      {
+        m_expiration = reader;
+        m_expirationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ID"))
+      {
+        m_iD = reader.ReadText();
+        m_iDHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Status"))
+      {
+        m_status = ExpirationStatusMapper::GetExpirationStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Transition"))
+      {
+        m_transitions.push_back(reader);
+        m_transitionsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("NoncurrentVersionTransition"))
+      {
+        m_noncurrentVersionTransitions.push_back(reader);
+        m_noncurrentVersionTransitionsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("NoncurrentVersionExpiration"))
+      {
+        m_noncurrentVersionExpiration = reader;
+        m_noncurrentVersionExpirationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AbortIncompleteMultipartUpload"))
+      {
+        m_abortIncompleteMultipartUpload = reader;
+        m_abortIncompleteMultipartUploadHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void LifecycleRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ListBucketIntelligentTieringConfigurationsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -63,3 +64,41 @@ ListBucketIntelligentTieringConfigurationsResult& ListBucketIntelligentTieringCo
 
   return *this;
 }
+
+ListBucketIntelligentTieringConfigurationsResult::ListBucketIntelligentTieringConfigurationsResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_isTruncated(false)
+{
+  *this = result;
+}
+
+ListBucketIntelligentTieringConfigurationsResult& ListBucketIntelligentTieringConfigurationsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("IsTruncated"))
+        {
+          m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("ContinuationToken"))
+        {
+          m_continuationToken = reader.ReadText();
+        }
+        else if(reader.NameEquals("NextContinuationToken"))
+        {
+          m_nextContinuationToken = reader.ReadText();
+        }
+        else if(reader.NameEquals("IntelligentTieringConfiguration"))
+        {
+          m_intelligentTieringConfigurationList.push_back(reader);
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ListBucketsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -51,3 +52,41 @@ ListBucketsResult& ListBucketsResult::operator =(const Aws::AmazonWebServiceResu
 
   return *this;
 }
+
+ListBucketsResult::ListBucketsResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+ListBucketsResult& ListBucketsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Buckets"))
+        {
+          if(reader.StartElement())
+          {
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("Bucket"))
+              {
+                m_buckets.push_back(reader);
+              }
+            }
+          }
+        }
+        else if(reader.NameEquals("Owner"))
+        {
+          m_owner = reader;
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ListMultipartUploadsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -113,3 +114,75 @@ ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(const Aws::Am
 
   return *this;
 }
+
+ListMultipartUploadsResult::ListMultipartUploadsResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_maxUploads(0),
+    m_isTruncated(false),
+    m_encodingType(EncodingType::NOT_SET)
+{
+  *this = result;
+}
+
+ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Bucket"))
+        {
+          m_bucket = reader.ReadText();
+        }
+        else if(reader.NameEquals("KeyMarker"))
+        {
+          m_keyMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("UploadIdMarker"))
+        {
+          m_uploadIdMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("NextKeyMarker"))
+        {
+          m_nextKeyMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("Prefix"))
+        {
+          m_prefix = reader.ReadText();
+        }
+        else if(reader.NameEquals("Delimiter"))
+        {
+          m_delimiter = reader.ReadText();
+        }
+        else if(reader.NameEquals("NextUploadIdMarker"))
+        {
+          m_nextUploadIdMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("MaxUploads"))
+        {
+          m_maxUploads = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("IsTruncated"))
+        {
+          m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("Upload"))
+        {
+          m_uploads.push_back(reader);
+        }
+        else if(reader.NameEquals("CommonPrefixes"))
+        {
+          m_commonPrefixes.push_back(reader);
+        }
+        else if(reader.NameEquals("EncodingType"))
+        {
+          m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+      }
+    }
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ListObjectVersionsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -124,3 +125,79 @@ ListObjectVersionsResult& ListObjectVersionsResult::operator =(const Aws::Amazon
 
   return *this;
 }
+
+ListObjectVersionsResult::ListObjectVersionsResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_isTruncated(false),
+    m_maxKeys(0),
+    m_encodingType(EncodingType::NOT_SET)
+{
+  *this = result;
+}
+
+ListObjectVersionsResult& ListObjectVersionsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("IsTruncated"))
+        {
+          m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("KeyMarker"))
+        {
+          m_keyMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("VersionIdMarker"))
+        {
+          m_versionIdMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("NextKeyMarker"))
+        {
+          m_nextKeyMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("NextVersionIdMarker"))
+        {
+          m_nextVersionIdMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("Version"))
+        {
+          m_versions.push_back(reader);
+        }
+        else if(reader.NameEquals("DeleteMarker"))
+        {
+          m_deleteMarkers.push_back(reader);
+        }
+        else if(reader.NameEquals("Name"))
+        {
+          m_name = reader.ReadText();
+        }
+        else if(reader.NameEquals("Prefix"))
+        {
+          m_prefix = reader.ReadText();
+        }
+        else if(reader.NameEquals("Delimiter"))
+        {
+          m_delimiter = reader.ReadText();
+        }
+        else if(reader.NameEquals("MaxKeys"))
+        {
+          m_maxKeys = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("CommonPrefixes"))
+        {
+          m_commonPrefixes.push_back(reader);
+        }
+        else if(reader.NameEquals("EncodingType"))
+        {
+          m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+      }
+    }
+  }
+
+  return *this;
+}
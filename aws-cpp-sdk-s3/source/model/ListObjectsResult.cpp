@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ListObjectsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 
@@ -103,3 +104,67 @@ ListObjectsResult& ListObjectsResult::operator =(const Aws::AmazonWebServiceResu
 
   return *this;
 }
+
+ListObjectsResult::ListObjectsResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_isTruncated(false),
+    m_maxKeys(0),
+    m_encodingType(EncodingType::NOT_SET)
+{
+  *this = result;
+}
+
+ListObjectsResult& ListObjectsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("IsTruncated"))
+        {
+          m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("Marker"))
+        {
+          m_marker = reader.ReadText();
+        }
+        else if(reader.NameEquals("NextMarker"))
+        {
+          m_nextMarker = reader.ReadText();
+        }
+        else if(reader.NameEquals("Contents"))
+        {
+          m_contents.push_back(reader);
+        }
+        else if(reader.NameEquals("Name"))
+        {
+          m_name = reader.ReadText();
+        }
+        else if(reader.NameEquals("Prefix"))
+        {
+          m_prefix = reader.ReadText();
+        }
+        else if(reader.NameEquals("Delimiter"))
+        {
+          m_delimiter = reader.ReadText();
+        }
+        else if(reader.NameEquals("MaxKeys"))
+        {
+          m_maxKeys = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("CommonPrefixes"))
+        {
+          m_commonPrefixes.push_back(reader);
+        }
+        else if(reader.NameEquals("EncodingType"))
+        {
+          m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+      }
+    }
+  }
+
+  return *this;
+}
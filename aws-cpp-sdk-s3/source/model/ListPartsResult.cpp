@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ListPartsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -128,3 +129,93 @@ ListPartsResult& ListPartsResult::operator =(const Aws::AmazonWebServiceResult<X
 
   return *this;
 }
+
+ListPartsResult::ListPartsResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_partNumberMarker(0),
+    m_nextPartNumberMarker(0),
+    m_maxParts(0),
+    m_isTruncated(false),
+    m_storageClass(StorageClass::NOT_SET),
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+ListPartsResult& ListPartsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    if(reader.StartElement())
+    {
+      while(reader.NextChild())
+      {
+        if(reader.NameEquals("Bucket"))
+        {
+          m_bucket = reader.ReadText();
+        }
+        else if(reader.NameEquals("Key"))
+        {
+          m_key = reader.ReadText();
+        }
+        else if(reader.NameEquals("UploadId"))
+        {
+          m_uploadId = reader.ReadText();
+        }
+        else if(reader.NameEquals("PartNumberMarker"))
+        {
+          m_partNumberMarker = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("NextPartNumberMarker"))
+        {
+          m_nextPartNumberMarker = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("MaxParts"))
+        {
+          m_maxParts = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("IsTruncated"))
+        {
+          m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        }
+        else if(reader.NameEquals("Part"))
+        {
+          m_parts.push_back(reader);
+        }
+        else if(reader.NameEquals("Initiator"))
+        {
+          m_initiator = reader;
+        }
+        else if(reader.NameEquals("Owner"))
+        {
+          m_owner = reader;
+        }
+        else if(reader.NameEquals("StorageClass"))
+        {
+          m_storageClass = StorageClassMapper::GetStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        }
+      }
+    }
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& abortDateIter = headers.find("x-amz-abort-date");
+  if(abortDateIter != headers.end())
+  {
+    m_abortDate = DateTime(abortDateIter->second, DateFormat::RFC822);
+  }
+
+  const auto& abortRuleIdIter = headers.find("x-amz-abort-rule-id");
+  if(abortRuleIdIter != headers.end())
+  {
+    m_abortRuleId = abortRuleIdIter->second;
+  }
+
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/LoggingEnabled.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ LoggingEnabled::LoggingEnabled(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+LoggingEnabled::LoggingEnabled(XmlReader& reader) : 
+    m_targetBucketHasBeenSet(false),
+    m_targetGrantsHasBeenSet(false),
+    m_targetPrefixHasBeenSet(false)
+{
+  *this = reader;
+}
+
 LoggingEnabled& LoggingEnabled::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -70,6 +79,41 @@ LoggingEnabled& LoggingEnabled::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+LoggingEnabled& LoggingEnabled::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("TargetBucket"))
+      {
+        m_targetBucket = reader.ReadText();
+        m_targetBucketHasBeenSet = true;
+      }
+      else if(reader.NameEquals("TargetGrants"))
+      {
+        if(reader.StartElement())
+        {
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Grant"))
+            {
+              m_targetGrants.push_back(reader);
+            }
+          }
+        }
+        m_targetGrantsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("TargetPrefix"))
+      {
+        m_targetPrefix = reader.ReadText();
+        m_targetPrefixHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void LoggingEnabled::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/MetadataEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ MetadataEntry::MetadataEntry(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+MetadataEntry::MetadataEntry(XmlReader& reader) : 
+    m_nameHasBeenSet(false),
+    m_valueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 MetadataEntry& MetadataEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ MetadataEntry& MetadataEntry::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+MetadataEntry& MetadataEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Name"))
+      {
+        m_name = reader.ReadText();
+        m_nameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Value"))
+      {
+        m_value = reader.ReadText();
+        m_valueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void MetadataEntry::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
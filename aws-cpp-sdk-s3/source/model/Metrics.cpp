@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Metrics.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ Metrics::Metrics(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Metrics::Metrics(XmlReader& reader) : 
+    m_status(MetricsStatus::NOT_SET),
+    m_statusHasBeenSet(false),
+    m_eventThresholdHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Metrics& Metrics::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ Metrics& Metrics::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Metrics& Metrics::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = MetricsStatusMapper::GetMetricsStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+      else if(reader.NameEquals("EventThreshold"))
+      {
+        m_eventThreshold = reader;
+        m_eventThresholdHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Metrics::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
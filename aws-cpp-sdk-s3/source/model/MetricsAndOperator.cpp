@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/MetricsAndOperator.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ MetricsAndOperator::MetricsAndOperator(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+MetricsAndOperator::MetricsAndOperator(XmlReader& reader) : 
+    m_prefixHasBeenSet(false),
+    m_tagsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 MetricsAndOperator& MetricsAndOperator::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -62,6 +70,27 @@ MetricsAndOperator& MetricsAndOperator::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+MetricsAndOperator& MetricsAndOperator::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tag"))
+      {
+        m_tags.push_back(reader);
+        m_tagsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void MetricsAndOperator::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
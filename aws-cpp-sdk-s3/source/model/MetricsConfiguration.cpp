@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/MetricsConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ MetricsConfiguration::MetricsConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+MetricsConfiguration::MetricsConfiguration(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_filterHasBeenSet(false)
+{
+  *this = reader;
+}
+
 MetricsConfiguration& MetricsConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ MetricsConfiguration& MetricsConfiguration::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+MetricsConfiguration& MetricsConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void MetricsConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
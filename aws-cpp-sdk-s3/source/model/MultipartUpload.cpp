@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/MultipartUpload.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -43,6 +44,18 @@ MultipartUpload::MultipartUpload(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+MultipartUpload::MultipartUpload(XmlReader& reader) : 
+    m_uploadIdHasBeenSet(false),
+    m_keyHasBeenSet(false),
+    m_initiatedHasBeenSet(false),
+    m_storageClass(StorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false),
+    m_ownerHasBeenSet(false),
+    m_initiatorHasBeenSet(false)
+{
+  *this = reader;
+}
+
 MultipartUpload& MultipartUpload::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -90,6 +103,47 @@ MultipartUpload& MultipartUpload::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+MultipartUpload& MultipartUpload::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("UploadId"))
+      {
+        m_uploadId = reader.ReadText();
+        m_uploadIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Initiated"))
+      {
+        m_initiated = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_initiatedHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StorageClass"))
+      {
+        m_storageClass = StorageClassMapper::GetStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_storageClassHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Owner"))
+      {
+        m_owner = reader;
+        m_ownerHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Initiator"))
+      {
+        m_initiator = reader;
+        m_initiatorHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void MultipartUpload::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/NoncurrentVersionExpiration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ NoncurrentVersionExpiration::NoncurrentVersionExpiration(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+NoncurrentVersionExpiration::NoncurrentVersionExpiration(XmlReader& reader) : 
+    m_noncurrentDays(0),
+    m_noncurrentDaysHasBeenSet(false)
+{
+  *this = reader;
+}
+
 NoncurrentVersionExpiration& NoncurrentVersionExpiration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ NoncurrentVersionExpiration& NoncurrentVersionExpiration::operator =(const XmlNo
   return *this;
 }
 
+NoncurrentVersionExpiration& NoncurrentVersionExpiration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("NoncurrentDays"))
+      {
+        m_noncurrentDays = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_noncurrentDaysHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void NoncurrentVersionExpiration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
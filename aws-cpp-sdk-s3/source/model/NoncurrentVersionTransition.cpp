@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/NoncurrentVersionTransition.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ NoncurrentVersionTransition::NoncurrentVersionTransition(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+NoncurrentVersionTransition::NoncurrentVersionTransition(XmlReader& reader) : 
+    m_noncurrentDays(0),
+    m_noncurrentDaysHasBeenSet(false),
+    m_storageClass(TransitionStorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false)
+{
+  *this = reader;
+}
+
 NoncurrentVersionTransition& NoncurrentVersionTransition::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -60,6 +70,27 @@ NoncurrentVersionTransition& NoncurrentVersionTransition::operator =(const XmlNo
   return *this;
 }
 
+NoncurrentVersionTransition& NoncurrentVersionTransition::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("NoncurrentDays"))
+      {
+        m_noncurrentDays = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_noncurrentDaysHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StorageClass"))
+      {
+        m_storageClass = TransitionStorageClassMapper::GetTransitionStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_storageClassHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void NoncurrentVersionTransition::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/NotificationConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ NotificationConfiguration::NotificationConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+NotificationConfiguration::NotificationConfiguration(XmlReader& reader) : 
+    m_topicConfigurationsHasBeenSet(false),
+    m_queueConfigurationsHasBeenSet(false),
+    m_lambdaFunctionConfigurationsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 NotificationConfiguration& NotificationConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -82,6 +91,32 @@ NotificationConfiguration& NotificationConfiguration::operator =(const XmlNode&
   return *this;
 }
 
+NotificationConfiguration& NotificationConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("TopicConfiguration"))
+      {
+        m_topicConfigurations.push_back(reader);
+        m_topicConfigurationsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("QueueConfiguration"))
+      {
+        m_queueConfigurations.push_back(reader);
+        m_queueConfigurationsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("CloudFunctionConfiguration"))
+      {
+        m_lambdaFunctionConfigurations.push_back(reader);
+        m_lambdaFunctionConfigurationsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void NotificationConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
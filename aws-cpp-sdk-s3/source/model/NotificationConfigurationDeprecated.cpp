@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/NotificationConfigurationDeprecated.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ NotificationConfigurationDeprecated::NotificationConfigurationDeprecated(const X
   *this = xmlNode;
 }
 
+NotificationConfigurationDeprecated::NotificationConfigurationDeprecated(XmlReader& reader) : 
+    m_topicConfigurationHasBeenSet(false),
+    m_queueConfigurationHasBeenSet(false),
+    m_cloudFunctionConfigurationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 NotificationConfigurationDeprecated& NotificationConfigurationDeprecated::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -64,6 +73,32 @@ NotificationConfigurationDeprecated& NotificationConfigurationDeprecated::operat
   return *this;
 }
 
+NotificationConfigurationDeprecated& NotificationConfigurationDeprecated::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("TopicConfiguration"))
+      {
+        m_topicConfiguration = reader;
+        m_topicConfigurationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("QueueConfiguration"))
+      {
+        m_queueConfiguration = reader;
+        m_queueConfigurationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("CloudFunctionConfiguration"))
+      {
+        m_cloudFunctionConfiguration = reader;
+        m_cloudFunctionConfigurationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void NotificationConfigurationDeprecated::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/NotificationConfigurationFilter.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ NotificationConfigurationFilter::NotificationConfigurationFilter(const XmlNode&
   *this = xmlNode;
 }
 
+NotificationConfigurationFilter::NotificationConfigurationFilter(XmlReader& reader) : 
+    m_keyHasBeenSet(false)
+{
+  *this = reader;
+}
+
 NotificationConfigurationFilter& NotificationConfigurationFilter::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ NotificationConfigurationFilter& NotificationConfigurationFilter::operator =(con
   return *this;
 }
 
+NotificationConfigurationFilter& NotificationConfigurationFilter::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("S3Key"))
+      {
+        m_key = reader;
+        m_keyHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void NotificationConfigurationFilter::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Object.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -45,6 +46,19 @@ Object::Object(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Object::Object(XmlReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false),
+    m_eTagHasBeenSet(false),
+    m_size(0),
+    m_sizeHasBeenSet(false),
+    m_storageClass(ObjectStorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false),
+    m_ownerHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Object& Object::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -92,6 +106,47 @@ Object& Object::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Object& Object::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("LastModified"))
+      {
+        m_lastModified = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_lastModifiedHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ETag"))
+      {
+        m_eTag = reader.ReadText();
+        m_eTagHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Size"))
+      {
+        m_size = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_sizeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StorageClass"))
+      {
+        m_storageClass = ObjectStorageClassMapper::GetObjectStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_storageClassHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Owner"))
+      {
+        m_owner = reader;
+        m_ownerHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Object::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
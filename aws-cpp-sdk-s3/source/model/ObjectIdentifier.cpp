@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ObjectIdentifier.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ ObjectIdentifier::ObjectIdentifier(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ObjectIdentifier::ObjectIdentifier(XmlReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_versionIdHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ObjectIdentifier& ObjectIdentifier::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ ObjectIdentifier& ObjectIdentifier::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ObjectIdentifier& ObjectIdentifier::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("VersionId"))
+      {
+        m_versionId = reader.ReadText();
+        m_versionIdHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ObjectIdentifier::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ObjectLockConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ ObjectLockConfiguration::ObjectLockConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ObjectLockConfiguration::ObjectLockConfiguration(XmlReader& reader) : 
+    m_objectLockEnabled(ObjectLockEnabled::NOT_SET),
+    m_objectLockEnabledHasBeenSet(false),
+    m_ruleHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ObjectLockConfiguration& ObjectLockConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ ObjectLockConfiguration& ObjectLockConfiguration::operator =(const XmlNode& xmlN
   return *this;
 }
 
+ObjectLockConfiguration& ObjectLockConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ObjectLockEnabled"))
+      {
+        m_objectLockEnabled = ObjectLockEnabledMapper::GetObjectLockEnabledForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_objectLockEnabledHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Rule"))
+      {
+        m_rule = reader;
+        m_ruleHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ObjectLockConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ObjectLockLegalHold.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ ObjectLockLegalHold::ObjectLockLegalHold(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ObjectLockLegalHold::ObjectLockLegalHold(XmlReader& reader) : 
+    m_status(ObjectLockLegalHoldStatus::NOT_SET),
+    m_statusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ObjectLockLegalHold& ObjectLockLegalHold::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ ObjectLockLegalHold& ObjectLockLegalHold::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ObjectLockLegalHold& ObjectLockLegalHold::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = ObjectLockLegalHoldStatusMapper::GetObjectLockLegalHoldStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ObjectLockLegalHold::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
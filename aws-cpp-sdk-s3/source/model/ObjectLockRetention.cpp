@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ObjectLockRetention.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ ObjectLockRetention::ObjectLockRetention(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ObjectLockRetention::ObjectLockRetention(XmlReader& reader) : 
+    m_mode(ObjectLockRetentionMode::NOT_SET),
+    m_modeHasBeenSet(false),
+    m_retainUntilDateHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ObjectLockRetention& ObjectLockRetention::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ ObjectLockRetention& ObjectLockRetention::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ObjectLockRetention& ObjectLockRetention::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Mode"))
+      {
+        m_mode = ObjectLockRetentionModeMapper::GetObjectLockRetentionModeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_modeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("RetainUntilDate"))
+      {
+        m_retainUntilDate = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_retainUntilDateHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ObjectLockRetention::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
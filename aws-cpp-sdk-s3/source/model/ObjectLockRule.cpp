@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ObjectLockRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ ObjectLockRule::ObjectLockRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ObjectLockRule::ObjectLockRule(XmlReader& reader) : 
+    m_defaultRetentionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ObjectLockRule& ObjectLockRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ ObjectLockRule& ObjectLockRule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ObjectLockRule& ObjectLockRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("DefaultRetention"))
+      {
+        m_defaultRetention = reader;
+        m_defaultRetentionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ObjectLockRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
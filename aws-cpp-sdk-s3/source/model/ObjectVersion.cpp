@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ObjectVersion.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -51,6 +52,22 @@ ObjectVersion::ObjectVersion(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ObjectVersion::ObjectVersion(XmlReader& reader) : 
+    m_eTagHasBeenSet(false),
+    m_size(0),
+    m_sizeHasBeenSet(false),
+    m_storageClass(ObjectVersionStorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false),
+    m_keyHasBeenSet(false),
+    m_versionIdHasBeenSet(false),
+    m_isLatest(false),
+    m_isLatestHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false),
+    m_ownerHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ObjectVersion& ObjectVersion::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -110,6 +127,57 @@ ObjectVersion& ObjectVersion::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ObjectVersion& ObjectVersion::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ETag"))
+      {
+        m_eTag = reader.ReadText();
+        m_eTagHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Size"))
+      {
+        m_size = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_sizeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StorageClass"))
+      {
+        m_storageClass = ObjectVersionStorageClassMapper::GetObjectVersionStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_storageClassHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("VersionId"))
+      {
+        m_versionId = reader.ReadText();
+        m_versionIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("IsLatest"))
+      {
+        m_isLatest = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_isLatestHasBeenSet = true;
+      }
+      else if(reader.NameEquals("LastModified"))
+      {
+        m_lastModified = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_lastModifiedHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Owner"))
+      {
+        m_owner = reader;
+        m_ownerHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ObjectVersion::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/OutputLocation.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ OutputLocation::OutputLocation(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+OutputLocation::OutputLocation(XmlReader& reader) : 
+    m_s3HasBeenSet(false)
+{
+  *this = reader;
+}
+
 OutputLocation& OutputLocation::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ OutputLocation& OutputLocation::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+OutputLocation& OutputLocation::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("S3"))
+      {
+        m_s3 = reader;
+        m_s3HasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void OutputLocation::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
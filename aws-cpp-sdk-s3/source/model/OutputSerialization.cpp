@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/OutputSerialization.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ OutputSerialization::OutputSerialization(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+OutputSerialization::OutputSerialization(XmlReader& reader) : 
+    m_cSVHasBeenSet(false),
+    m_jSONHasBeenSet(false)
+{
+  *this = reader;
+}
+
 OutputSerialization& OutputSerialization::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ OutputSerialization& OutputSerialization::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+OutputSerialization& OutputSerialization::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("CSV"))
+      {
+        m_cSV = reader;
+        m_cSVHasBeenSet = true;
+      }
+      else if(reader.NameEquals("JSON"))
+      {
+        m_jSON = reader;
+        m_jSONHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void OutputSerialization::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Owner.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ Owner::Owner(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Owner::Owner(XmlReader& reader) : 
+    m_displayNameHasBeenSet(false),
+    m_iDHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Owner& Owner::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ Owner& Owner::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Owner& Owner::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("DisplayName"))
+      {
+        m_displayName = reader.ReadText();
+        m_displayNameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ID"))
+      {
+        m_iD = reader.ReadText();
+        m_iDHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Owner::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/OwnershipControls.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ OwnershipControls::OwnershipControls(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+OwnershipControls::OwnershipControls(XmlReader& reader) : 
+    m_rulesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 OwnershipControls& OwnershipControls::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -54,6 +61,22 @@ OwnershipControls& OwnershipControls::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+OwnershipControls& OwnershipControls::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Rule"))
+      {
+        m_rules.push_back(reader);
+        m_rulesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void OwnershipControls::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/OwnershipControlsRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ OwnershipControlsRule::OwnershipControlsRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+OwnershipControlsRule::OwnershipControlsRule(XmlReader& reader) : 
+    m_objectOwnership(ObjectOwnership::NOT_SET),
+    m_objectOwnershipHasBeenSet(false)
+{
+  *this = reader;
+}
+
 OwnershipControlsRule& OwnershipControlsRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ OwnershipControlsRule& OwnershipControlsRule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+OwnershipControlsRule& OwnershipControlsRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ObjectOwnership"))
+      {
+        m_objectOwnership = ObjectOwnershipMapper::GetObjectOwnershipForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_objectOwnershipHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void OwnershipControlsRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ParquetInput.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -29,6 +30,11 @@ ParquetInput::ParquetInput(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+ParquetInput::ParquetInput(XmlReader& reader)
+{
+  *this = reader;
+}
+
 ParquetInput& ParquetInput::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -40,6 +46,12 @@ ParquetInput& ParquetInput::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ParquetInput& ParquetInput::operator =(XmlReader& reader)
+{
+  AWS_UNREFERENCED_PARAM(reader);
+  return *this;
+}
+
 void ParquetInput::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Part.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ Part::Part(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Part::Part(XmlReader& reader) : 
+    m_partNumber(0),
+    m_partNumberHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false),
+    m_eTagHasBeenSet(false),
+    m_size(0),
+    m_sizeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Part& Part::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -76,6 +88,37 @@ Part& Part::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Part& Part::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("PartNumber"))
+      {
+        m_partNumber = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_partNumberHasBeenSet = true;
+      }
+      else if(reader.NameEquals("LastModified"))
+      {
+        m_lastModified = DateTime(StringUtils::Trim(reader.ReadText().c_str()).c_str(), DateFormat::ISO_8601);
+        m_lastModifiedHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ETag"))
+      {
+        m_eTag = reader.ReadText();
+        m_eTagHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Size"))
+      {
+        m_size = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_sizeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Part::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
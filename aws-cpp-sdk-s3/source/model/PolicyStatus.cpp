@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/PolicyStatus.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ PolicyStatus::PolicyStatus(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+PolicyStatus::PolicyStatus(XmlReader& reader) : 
+    m_isPublic(false),
+    m_isPublicHasBeenSet(false)
+{
+  *this = reader;
+}
+
 PolicyStatus& PolicyStatus::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ PolicyStatus& PolicyStatus::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+PolicyStatus& PolicyStatus::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("IsPublic"))
+      {
+        m_isPublic = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_isPublicHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void PolicyStatus::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ProgressEvent.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ ProgressEvent::ProgressEvent(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ProgressEvent::ProgressEvent(XmlReader& reader) : 
+    m_detailsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ProgressEvent& ProgressEvent::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,12 @@ ProgressEvent& ProgressEvent::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ProgressEvent& ProgressEvent::operator =(XmlReader& reader)
+{
+  m_details = reader;
+  return *this;
+}
+
 void ProgressEvent::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
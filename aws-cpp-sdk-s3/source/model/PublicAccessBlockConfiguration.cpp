@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/PublicAccessBlockConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -45,6 +46,19 @@ PublicAccessBlockConfiguration::PublicAccessBlockConfiguration(const XmlNode& xm
   *this = xmlNode;
 }
 
+PublicAccessBlockConfiguration::PublicAccessBlockConfiguration(XmlReader& reader) : 
+    m_blockPublicAcls(false),
+    m_blockPublicAclsHasBeenSet(false),
+    m_ignorePublicAcls(false),
+    m_ignorePublicAclsHasBeenSet(false),
+    m_blockPublicPolicy(false),
+    m_blockPublicPolicyHasBeenSet(false),
+    m_restrictPublicBuckets(false),
+    m_restrictPublicBucketsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 PublicAccessBlockConfiguration& PublicAccessBlockConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -80,6 +94,37 @@ PublicAccessBlockConfiguration& PublicAccessBlockConfiguration::operator =(const
   return *this;
 }
 
+PublicAccessBlockConfiguration& PublicAccessBlockConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("BlockPublicAcls"))
+      {
+        m_blockPublicAcls = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_blockPublicAclsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("IgnorePublicAcls"))
+      {
+        m_ignorePublicAcls = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_ignorePublicAclsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("BlockPublicPolicy"))
+      {
+        m_blockPublicPolicy = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_blockPublicPolicyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("RestrictPublicBuckets"))
+      {
+        m_restrictPublicBuckets = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_restrictPublicBucketsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void PublicAccessBlockConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/PutObjectAclResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -45,3 +46,26 @@ PutObjectAclResult& PutObjectAclResult::operator =(const Aws::AmazonWebServiceRe
 
   return *this;
 }
+
+PutObjectAclResult::PutObjectAclResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+PutObjectAclResult& PutObjectAclResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  return *this;
+}
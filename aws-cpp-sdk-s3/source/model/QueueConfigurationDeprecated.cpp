@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/QueueConfigurationDeprecated.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ QueueConfigurationDeprecated::QueueConfigurationDeprecated(const XmlNode& xmlNod
   *this = xmlNode;
 }
 
+QueueConfigurationDeprecated::QueueConfigurationDeprecated(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_eventsHasBeenSet(false),
+    m_queueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 QueueConfigurationDeprecated& QueueConfigurationDeprecated::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -70,6 +79,32 @@ QueueConfigurationDeprecated& QueueConfigurationDeprecated::operator =(const Xml
   return *this;
 }
 
+QueueConfigurationDeprecated& QueueConfigurationDeprecated::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Event"))
+      {
+        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(reader.ReadText().c_str())));
+        m_eventsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Queue"))
+      {
+        m_queue = reader.ReadText();
+        m_queueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void QueueConfigurationDeprecated::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Redirect.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ Redirect::Redirect(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Redirect::Redirect(XmlReader& reader) : 
+    m_hostNameHasBeenSet(false),
+    m_httpRedirectCodeHasBeenSet(false),
+    m_protocol(Protocol::NOT_SET),
+    m_protocolHasBeenSet(false),
+    m_replaceKeyPrefixWithHasBeenSet(false),
+    m_replaceKeyWithHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Redirect& Redirect::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -82,6 +94,42 @@ Redirect& Redirect::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Redirect& Redirect::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("HostName"))
+      {
+        m_hostName = reader.ReadText();
+        m_hostNameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("HttpRedirectCode"))
+      {
+        m_httpRedirectCode = reader.ReadText();
+        m_httpRedirectCodeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Protocol"))
+      {
+        m_protocol = ProtocolMapper::GetProtocolForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_protocolHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ReplaceKeyPrefixWith"))
+      {
+        m_replaceKeyPrefixWith = reader.ReadText();
+        m_replaceKeyPrefixWithHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ReplaceKeyWith"))
+      {
+        m_replaceKeyWith = reader.ReadText();
+        m_replaceKeyWithHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Redirect::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/RedirectAllRequestsTo.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ RedirectAllRequestsTo::RedirectAllRequestsTo(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+RedirectAllRequestsTo::RedirectAllRequestsTo(XmlReader& reader) : 
+    m_hostNameHasBeenSet(false),
+    m_protocol(Protocol::NOT_SET),
+    m_protocolHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RedirectAllRequestsTo& RedirectAllRequestsTo::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ RedirectAllRequestsTo& RedirectAllRequestsTo::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+RedirectAllRequestsTo& RedirectAllRequestsTo::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("HostName"))
+      {
+        m_hostName = reader.ReadText();
+        m_hostNameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Protocol"))
+      {
+        m_protocol = ProtocolMapper::GetProtocolForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_protocolHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void RedirectAllRequestsTo::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
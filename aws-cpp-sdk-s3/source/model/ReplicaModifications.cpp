@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ReplicaModifications.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ ReplicaModifications::ReplicaModifications(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ReplicaModifications::ReplicaModifications(XmlReader& reader) : 
+    m_status(ReplicaModificationsStatus::NOT_SET),
+    m_statusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicaModifications& ReplicaModifications::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ ReplicaModifications& ReplicaModifications::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ReplicaModifications& ReplicaModifications::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = ReplicaModificationsStatusMapper::GetReplicaModificationsStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ReplicaModifications::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ReplicationConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ ReplicationConfiguration::ReplicationConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ReplicationConfiguration::ReplicationConfiguration(XmlReader& reader) : 
+    m_roleHasBeenSet(false),
+    m_rulesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicationConfiguration& ReplicationConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -62,6 +70,27 @@ ReplicationConfiguration& ReplicationConfiguration::operator =(const XmlNode& xm
   return *this;
 }
 
+ReplicationConfiguration& ReplicationConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Role"))
+      {
+        m_role = reader.ReadText();
+        m_roleHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Rule"))
+      {
+        m_rules.push_back(reader);
+        m_rulesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ReplicationConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ReplicationRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -49,6 +50,21 @@ ReplicationRule::ReplicationRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ReplicationRule::ReplicationRule(XmlReader& reader) : 
+    m_iDHasBeenSet(false),
+    m_priority(0),
+    m_priorityHasBeenSet(false),
+    m_filterHasBeenSet(false),
+    m_status(ReplicationRuleStatus::NOT_SET),
+    m_statusHasBeenSet(false),
+    m_sourceSelectionCriteriaHasBeenSet(false),
+    m_existingObjectReplicationHasBeenSet(false),
+    m_destinationHasBeenSet(false),
+    m_deleteMarkerReplicationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicationRule& ReplicationRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -108,6 +124,57 @@ ReplicationRule& ReplicationRule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ReplicationRule& ReplicationRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ID"))
+      {
+        m_iD = reader.ReadText();
+        m_iDHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Priority"))
+      {
+        m_priority = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_priorityHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Status"))
+      {
+        m_status = ReplicationRuleStatusMapper::GetReplicationRuleStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+      else if(reader.NameEquals("SourceSelectionCriteria"))
+      {
+        m_sourceSelectionCriteria = reader;
+        m_sourceSelectionCriteriaHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ExistingObjectReplication"))
+      {
+        m_existingObjectReplication = reader;
+        m_existingObjectReplicationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Destination"))
+      {
+        m_destination = reader;
+        m_destinationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("DeleteMarkerReplication"))
+      {
+        m_deleteMarkerReplication = reader;
+        m_deleteMarkerReplicationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ReplicationRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ReplicationRuleAndOperator.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ ReplicationRuleAndOperator::ReplicationRuleAndOperator(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ReplicationRuleAndOperator::ReplicationRuleAndOperator(XmlReader& reader) : 
+    m_prefixHasBeenSet(false),
+    m_tagsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicationRuleAndOperator& ReplicationRuleAndOperator::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -62,6 +70,27 @@ ReplicationRuleAndOperator& ReplicationRuleAndOperator::operator =(const XmlNode
   return *this;
 }
 
+ReplicationRuleAndOperator& ReplicationRuleAndOperator::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tag"))
+      {
+        m_tags.push_back(reader);
+        m_tagsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ReplicationRuleAndOperator::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ReplicationRuleFilter.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ ReplicationRuleFilter::ReplicationRuleFilter(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ReplicationRuleFilter::ReplicationRuleFilter(XmlReader& reader) : 
+    m_prefixHasBeenSet(false),
+    m_tagHasBeenSet(false),
+    m_andHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicationRuleFilter& ReplicationRuleFilter::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -64,6 +73,32 @@ ReplicationRuleFilter& ReplicationRuleFilter::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ReplicationRuleFilter& ReplicationRuleFilter::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tag"))
+      {
+        m_tag = reader;
+        m_tagHasBeenSet = true;
+      }
+      else if(reader.NameEquals("And"))
+      {
+        m_and = reader;
+        m_andHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ReplicationRuleFilter::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
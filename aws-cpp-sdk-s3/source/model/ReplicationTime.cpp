@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ReplicationTime.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ ReplicationTime::ReplicationTime(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ReplicationTime::ReplicationTime(XmlReader& reader) : 
+    m_status(ReplicationTimeStatus::NOT_SET),
+    m_statusHasBeenSet(false),
+    m_timeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicationTime& ReplicationTime::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ ReplicationTime& ReplicationTime::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ReplicationTime& ReplicationTime::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = ReplicationTimeStatusMapper::GetReplicationTimeStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Time"))
+      {
+        m_time = reader;
+        m_timeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ReplicationTime::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ReplicationTimeValue.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ ReplicationTimeValue::ReplicationTimeValue(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ReplicationTimeValue::ReplicationTimeValue(XmlReader& reader) : 
+    m_minutes(0),
+    m_minutesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ReplicationTimeValue& ReplicationTimeValue::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ ReplicationTimeValue& ReplicationTimeValue::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ReplicationTimeValue& ReplicationTimeValue::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Minutes"))
+      {
+        m_minutes = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_minutesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ReplicationTimeValue::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/RequestPaymentConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ RequestPaymentConfiguration::RequestPaymentConfiguration(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+RequestPaymentConfiguration::RequestPaymentConfiguration(XmlReader& reader) : 
+    m_payer(Payer::NOT_SET),
+    m_payerHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RequestPaymentConfiguration& RequestPaymentConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ RequestPaymentConfiguration& RequestPaymentConfiguration::operator =(const XmlNo
   return *this;
 }
 
+RequestPaymentConfiguration& RequestPaymentConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Payer"))
+      {
+        m_payer = PayerMapper::GetPayerForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_payerHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void RequestPaymentConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/RequestProgress.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ RequestProgress::RequestProgress(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+RequestProgress::RequestProgress(XmlReader& reader) : 
+    m_enabled(false),
+    m_enabledHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RequestProgress& RequestProgress::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ RequestProgress& RequestProgress::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+RequestProgress& RequestProgress::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Enabled"))
+      {
+        m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_enabledHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void RequestProgress::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
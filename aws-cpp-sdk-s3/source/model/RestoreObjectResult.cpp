@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/RestoreObjectResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
@@ -51,3 +52,32 @@ RestoreObjectResult& RestoreObjectResult::operator =(const Aws::AmazonWebService
 
   return *this;
 }
+
+RestoreObjectResult::RestoreObjectResult(const Aws::AmazonWebServiceResult<XmlReader>& result) : 
+    m_requestCharged(RequestCharged::NOT_SET)
+{
+  *this = result;
+}
+
+RestoreObjectResult& RestoreObjectResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestChargedIter = headers.find("x-amz-request-charged");
+  if(requestChargedIter != headers.end())
+  {
+    m_requestCharged = RequestChargedMapper::GetRequestChargedForName(requestChargedIter->second);
+  }
+
+  const auto& restoreOutputPathIter = headers.find("x-amz-restore-output-path");
+  if(restoreOutputPathIter != headers.end())
+  {
+    m_restoreOutputPath = restoreOutputPathIter->second;
+  }
+
+  return *this;
+}
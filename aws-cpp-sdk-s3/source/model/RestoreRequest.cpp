@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/RestoreRequest.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -49,6 +50,21 @@ RestoreRequest::RestoreRequest(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+RestoreRequest::RestoreRequest(XmlReader& reader) : 
+    m_days(0),
+    m_daysHasBeenSet(false),
+    m_glacierJobParametersHasBeenSet(false),
+    m_type(RestoreRequestType::NOT_SET),
+    m_typeHasBeenSet(false),
+    m_tier(Tier::NOT_SET),
+    m_tierHasBeenSet(false),
+    m_descriptionHasBeenSet(false),
+    m_selectParametersHasBeenSet(false),
+    m_outputLocationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RestoreRequest& RestoreRequest::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -102,6 +118,52 @@ RestoreRequest& RestoreRequest::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+RestoreRequest& RestoreRequest::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Days"))
+      {
+        m_days = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_daysHasBeenSet = true;
+      }
+      else if(reader.NameEquals("GlacierJobParameters"))
+      {
+        m_glacierJobParameters = reader;
+        m_glacierJobParametersHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Type"))
+      {
+        m_type = RestoreRequestTypeMapper::GetRestoreRequestTypeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_typeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tier"))
+      {
+        m_tier = TierMapper::GetTierForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_tierHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Description"))
+      {
+        m_description = reader.ReadText();
+        m_descriptionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("SelectParameters"))
+      {
+        m_selectParameters = reader;
+        m_selectParametersHasBeenSet = true;
+      }
+      else if(reader.NameEquals("OutputLocation"))
+      {
+        m_outputLocation = reader;
+        m_outputLocationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void RestoreRequest::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/RoutingRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ RoutingRule::RoutingRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+RoutingRule::RoutingRule(XmlReader& reader) : 
+    m_conditionHasBeenSet(false),
+    m_redirectHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RoutingRule& RoutingRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ RoutingRule& RoutingRule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+RoutingRule& RoutingRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Condition"))
+      {
+        m_condition = reader;
+        m_conditionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Redirect"))
+      {
+        m_redirect = reader;
+        m_redirectHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void RoutingRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
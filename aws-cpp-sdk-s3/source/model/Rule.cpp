@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Rule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -47,6 +48,20 @@ Rule::Rule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Rule::Rule(XmlReader& reader) : 
+    m_expirationHasBeenSet(false),
+    m_iDHasBeenSet(false),
+    m_prefixHasBeenSet(false),
+    m_status(ExpirationStatus::NOT_SET),
+    m_statusHasBeenSet(false),
+    m_transitionHasBeenSet(false),
+    m_noncurrentVersionTransitionHasBeenSet(false),
+    m_noncurrentVersionExpirationHasBeenSet(false),
+    m_abortIncompleteMultipartUploadHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Rule& Rule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -106,6 +121,57 @@ Rule& Rule::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Rule& Rule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Expiration"))
+      {
+        m_expiration = reader;
+        m_expirationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ID"))
+      {
+        m_iD = reader.ReadText();
+        m_iDHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Status"))
+      {
+        m_status = ExpirationStatusMapper::GetExpirationStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Transition"))
+      {
+        m_transition = reader;
+        m_transitionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("NoncurrentVersionTransition"))
+      {
+        m_noncurrentVersionTransition = reader;
+        m_noncurrentVersionTransitionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("NoncurrentVersionExpiration"))
+      {
+        m_noncurrentVersionExpiration = reader;
+        m_noncurrentVersionExpirationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AbortIncompleteMultipartUpload"))
+      {
+        m_abortIncompleteMultipartUpload = reader;
+        m_abortIncompleteMultipartUploadHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Rule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
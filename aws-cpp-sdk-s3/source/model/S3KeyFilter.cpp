@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/S3KeyFilter.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ S3KeyFilter::S3KeyFilter(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+S3KeyFilter::S3KeyFilter(XmlReader& reader) : 
+    m_filterRulesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 S3KeyFilter& S3KeyFilter::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -54,6 +61,22 @@ S3KeyFilter& S3KeyFilter::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+S3KeyFilter& S3KeyFilter::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("FilterRule"))
+      {
+        m_filterRules.push_back(reader);
+        m_filterRulesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void S3KeyFilter::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
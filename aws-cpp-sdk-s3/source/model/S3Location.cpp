@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/S3Location.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -49,6 +50,21 @@ S3Location::S3Location(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+S3Location::S3Location(XmlReader& reader) : 
+    m_bucketNameHasBeenSet(false),
+    m_prefixHasBeenSet(false),
+    m_encryptionHasBeenSet(false),
+    m_cannedACL(ObjectCannedACL::NOT_SET),
+    m_cannedACLHasBeenSet(false),
+    m_accessControlListHasBeenSet(false),
+    m_taggingHasBeenSet(false),
+    m_userMetadataHasBeenSet(false),
+    m_storageClass(StorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false)
+{
+  *this = reader;
+}
+
 S3Location& S3Location::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -120,6 +136,75 @@ S3Location& S3Location::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+S3Location& S3Location::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("BucketName"))
+      {
+        m_bucketName = reader.ReadText();
+        m_bucketNameHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Prefix"))
+      {
+        m_prefix = reader.ReadText();
+        m_prefixHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Encryption"))
+      {
+        m_encryption = reader;
+        m_encryptionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("CannedACL"))
+      {
+        m_cannedACL = ObjectCannedACLMapper::GetObjectCannedACLForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_cannedACLHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AccessControlList"))
+      {
+        if(reader.StartElement())
+        {
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Grant"))
+            {
+              m_accessControlList.push_back(reader);
+            }
+          }
+        }
+        m_accessControlListHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Tagging"))
+      {
+        m_tagging = reader;
+        m_taggingHasBeenSet = true;
+      }
+      else if(reader.NameEquals("UserMetadata"))
+      {
+        if(reader.StartElement())
+        {
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("MetadataEntry"))
+            {
+              m_userMetadata.push_back(reader);
+            }
+          }
+        }
+        m_userMetadataHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StorageClass"))
+      {
+        m_storageClass = StorageClassMapper::GetStorageClassForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_storageClassHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void S3Location::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/SSEKMS.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ SSEKMS::SSEKMS(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+SSEKMS::SSEKMS(XmlReader& reader) : 
+    m_keyIdHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SSEKMS& SSEKMS::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ SSEKMS& SSEKMS::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+SSEKMS& SSEKMS::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("KeyId"))
+      {
+        m_keyId = reader.ReadText();
+        m_keyIdHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void SSEKMS::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/SSES3.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -29,6 +30,11 @@ SSES3::SSES3(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+SSES3::SSES3(XmlReader& reader)
+{
+  *this = reader;
+}
+
 SSES3& SSES3::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -40,6 +46,12 @@ SSES3& SSES3::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+SSES3& SSES3::operator =(XmlReader& reader)
+{
+  AWS_UNREFERENCED_PARAM(reader);
+  return *this;
+}
+
 void SSES3::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ScanRange.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ ScanRange::ScanRange(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ScanRange::ScanRange(XmlReader& reader) : 
+    m_start(0),
+    m_startHasBeenSet(false),
+    m_end(0),
+    m_endHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ScanRange& ScanRange::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -60,6 +70,27 @@ ScanRange& ScanRange::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ScanRange& ScanRange::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Start"))
+      {
+        m_start = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_startHasBeenSet = true;
+      }
+      else if(reader.NameEquals("End"))
+      {
+        m_end = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_endHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ScanRange::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
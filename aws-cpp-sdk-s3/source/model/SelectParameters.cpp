@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/SelectParameters.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -39,6 +40,16 @@ SelectParameters::SelectParameters(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+SelectParameters::SelectParameters(XmlReader& reader) : 
+    m_inputSerializationHasBeenSet(false),
+    m_expressionType(ExpressionType::NOT_SET),
+    m_expressionTypeHasBeenSet(false),
+    m_expressionHasBeenSet(false),
+    m_outputSerializationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SelectParameters& SelectParameters::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -74,6 +85,37 @@ SelectParameters& SelectParameters::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+SelectParameters& SelectParameters::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("InputSerialization"))
+      {
+        m_inputSerialization = reader;
+        m_inputSerializationHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ExpressionType"))
+      {
+        m_expressionType = ExpressionTypeMapper::GetExpressionTypeForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_expressionTypeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Expression"))
+      {
+        m_expression = reader.ReadText();
+        m_expressionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("OutputSerialization"))
+      {
+        m_outputSerialization = reader;
+        m_outputSerializationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void SelectParameters::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
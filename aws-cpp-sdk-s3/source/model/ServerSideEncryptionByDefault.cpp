@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ServerSideEncryptionByDefault.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ ServerSideEncryptionByDefault::ServerSideEncryptionByDefault(const XmlNode& xmlN
   *this = xmlNode;
 }
 
+ServerSideEncryptionByDefault::ServerSideEncryptionByDefault(XmlReader& reader) : 
+    m_sSEAlgorithm(ServerSideEncryption::NOT_SET),
+    m_sSEAlgorithmHasBeenSet(false),
+    m_kMSMasterKeyIDHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ServerSideEncryptionByDefault& ServerSideEncryptionByDefault::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ ServerSideEncryptionByDefault& ServerSideEncryptionByDefault::operator =(const X
   return *this;
 }
 
+ServerSideEncryptionByDefault& ServerSideEncryptionByDefault::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("SSEAlgorithm"))
+      {
+        m_sSEAlgorithm = ServerSideEncryptionMapper::GetServerSideEncryptionForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_sSEAlgorithmHasBeenSet = true;
+      }
+      else if(reader.NameEquals("KMSMasterKeyID"))
+      {
+        m_kMSMasterKeyID = reader.ReadText();
+        m_kMSMasterKeyIDHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ServerSideEncryptionByDefault::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ServerSideEncryptionConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ ServerSideEncryptionConfiguration::ServerSideEncryptionConfiguration(const XmlNo
   *this = xmlNode;
 }
 
+ServerSideEncryptionConfiguration::ServerSideEncryptionConfiguration(XmlReader& reader) : 
+    m_rulesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ServerSideEncryptionConfiguration& ServerSideEncryptionConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -54,6 +61,22 @@ ServerSideEncryptionConfiguration& ServerSideEncryptionConfiguration::operator =
   return *this;
 }
 
+ServerSideEncryptionConfiguration& ServerSideEncryptionConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Rule"))
+      {
+        m_rules.push_back(reader);
+        m_rulesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ServerSideEncryptionConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
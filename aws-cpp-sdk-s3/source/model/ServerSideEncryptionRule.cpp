@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/ServerSideEncryptionRule.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ ServerSideEncryptionRule::ServerSideEncryptionRule(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ServerSideEncryptionRule::ServerSideEncryptionRule(XmlReader& reader) : 
+    m_applyServerSideEncryptionByDefaultHasBeenSet(false),
+    m_bucketKeyEnabled(false),
+    m_bucketKeyEnabledHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ServerSideEncryptionRule& ServerSideEncryptionRule::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ ServerSideEncryptionRule& ServerSideEncryptionRule::operator =(const XmlNode& xm
   return *this;
 }
 
+ServerSideEncryptionRule& ServerSideEncryptionRule::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ApplyServerSideEncryptionByDefault"))
+      {
+        m_applyServerSideEncryptionByDefault = reader;
+        m_applyServerSideEncryptionByDefaultHasBeenSet = true;
+      }
+      else if(reader.NameEquals("BucketKeyEnabled"))
+      {
+        m_bucketKeyEnabled = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_bucketKeyEnabledHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ServerSideEncryptionRule::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/SourceSelectionCriteria.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ SourceSelectionCriteria::SourceSelectionCriteria(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+SourceSelectionCriteria::SourceSelectionCriteria(XmlReader& reader) : 
+    m_sseKmsEncryptedObjectsHasBeenSet(false),
+    m_replicaModificationsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SourceSelectionCriteria& SourceSelectionCriteria::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ SourceSelectionCriteria& SourceSelectionCriteria::operator =(const XmlNode& xmlN
   return *this;
 }
 
+SourceSelectionCriteria& SourceSelectionCriteria::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("SseKmsEncryptedObjects"))
+      {
+        m_sseKmsEncryptedObjects = reader;
+        m_sseKmsEncryptedObjectsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ReplicaModifications"))
+      {
+        m_replicaModifications = reader;
+        m_replicaModificationsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void SourceSelectionCriteria::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/SseKmsEncryptedObjects.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ SseKmsEncryptedObjects::SseKmsEncryptedObjects(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+SseKmsEncryptedObjects::SseKmsEncryptedObjects(XmlReader& reader) : 
+    m_status(SseKmsEncryptedObjectsStatus::NOT_SET),
+    m_statusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SseKmsEncryptedObjects& SseKmsEncryptedObjects::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -50,6 +58,22 @@ SseKmsEncryptedObjects& SseKmsEncryptedObjects::operator =(const XmlNode& xmlNod
   return *this;
 }
 
+SseKmsEncryptedObjects& SseKmsEncryptedObjects::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Status"))
+      {
+        m_status = SseKmsEncryptedObjectsStatusMapper::GetSseKmsEncryptedObjectsStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void SseKmsEncryptedObjects::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Stats.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ Stats::Stats(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Stats::Stats(XmlReader& reader) : 
+    m_bytesScanned(0),
+    m_bytesScannedHasBeenSet(false),
+    m_bytesProcessed(0),
+    m_bytesProcessedHasBeenSet(false),
+    m_bytesReturned(0),
+    m_bytesReturnedHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Stats& Stats::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -70,6 +82,32 @@ Stats& Stats::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Stats& Stats::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("BytesScanned"))
+      {
+        m_bytesScanned = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_bytesScannedHasBeenSet = true;
+      }
+      else if(reader.NameEquals("BytesProcessed"))
+      {
+        m_bytesProcessed = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_bytesProcessedHasBeenSet = true;
+      }
+      else if(reader.NameEquals("BytesReturned"))
+      {
+        m_bytesReturned = StringUtils::ConvertToInt64(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_bytesReturnedHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Stats::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/StatsEvent.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ StatsEvent::StatsEvent(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+StatsEvent::StatsEvent(XmlReader& reader) : 
+    m_detailsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 StatsEvent& StatsEvent::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,12 @@ StatsEvent& StatsEvent::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+StatsEvent& StatsEvent::operator =(XmlReader& reader)
+{
+  m_details = reader;
+  return *this;
+}
+
 void StatsEvent::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/StorageClassAnalysis.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ StorageClassAnalysis::StorageClassAnalysis(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+StorageClassAnalysis::StorageClassAnalysis(XmlReader& reader) : 
+    m_dataExportHasBeenSet(false)
+{
+  *this = reader;
+}
+
 StorageClassAnalysis& StorageClassAnalysis::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ StorageClassAnalysis& StorageClassAnalysis::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+StorageClassAnalysis& StorageClassAnalysis::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("DataExport"))
+      {
+        m_dataExport = reader;
+        m_dataExportHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void StorageClassAnalysis::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
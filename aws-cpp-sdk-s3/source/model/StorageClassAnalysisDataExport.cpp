@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/StorageClassAnalysisDataExport.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ StorageClassAnalysisDataExport::StorageClassAnalysisDataExport(const XmlNode& xm
   *this = xmlNode;
 }
 
+StorageClassAnalysisDataExport::StorageClassAnalysisDataExport(XmlReader& reader) : 
+    m_outputSchemaVersion(StorageClassAnalysisSchemaVersion::NOT_SET),
+    m_outputSchemaVersionHasBeenSet(false),
+    m_destinationHasBeenSet(false)
+{
+  *this = reader;
+}
+
 StorageClassAnalysisDataExport& StorageClassAnalysisDataExport::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ StorageClassAnalysisDataExport& StorageClassAnalysisDataExport::operator =(const
   return *this;
 }
 
+StorageClassAnalysisDataExport& StorageClassAnalysisDataExport::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("OutputSchemaVersion"))
+      {
+        m_outputSchemaVersion = StorageClassAnalysisSchemaVersionMapper::GetStorageClassAnalysisSchemaVersionForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_outputSchemaVersionHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Destination"))
+      {
+        m_destination = reader;
+        m_destinationHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void StorageClassAnalysisDataExport::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Tag.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ Tag::Tag(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Tag::Tag(XmlReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_valueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Tag& Tag::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ Tag& Tag::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Tag& Tag::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Key"))
+      {
+        m_key = reader.ReadText();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Value"))
+      {
+        m_value = reader.ReadText();
+        m_valueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Tag::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Tagging.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ Tagging::Tagging(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Tagging::Tagging(XmlReader& reader) : 
+    m_tagSetHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Tagging& Tagging::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -54,6 +61,31 @@ Tagging& Tagging::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Tagging& Tagging::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("TagSet"))
+      {
+        if(reader.StartElement())
+        {
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Tag"))
+            {
+              m_tagSet.push_back(reader);
+            }
+          }
+        }
+        m_tagSetHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Tagging::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/TargetGrant.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ TargetGrant::TargetGrant(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+TargetGrant::TargetGrant(XmlReader& reader) : 
+    m_granteeHasBeenSet(false),
+    m_permission(BucketLogsPermission::NOT_SET),
+    m_permissionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TargetGrant& TargetGrant::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -58,6 +67,27 @@ TargetGrant& TargetGrant::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+TargetGrant& TargetGrant::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Grantee"))
+      {
+        m_grantee = reader;
+        m_granteeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Permission"))
+      {
+        m_permission = BucketLogsPermissionMapper::GetBucketLogsPermissionForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_permissionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void TargetGrant::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
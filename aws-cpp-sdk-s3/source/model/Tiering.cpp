@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/Tiering.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ Tiering::Tiering(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Tiering::Tiering(XmlReader& reader) : 
+    m_days(0),
+    m_daysHasBeenSet(false),
+    m_accessTier(IntelligentTieringAccessTier::NOT_SET),
+    m_accessTierHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Tiering& Tiering::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -60,6 +70,27 @@ Tiering& Tiering::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Tiering& Tiering::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Days"))
+      {
+        m_days = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_daysHasBeenSet = true;
+      }
+      else if(reader.NameEquals("AccessTier"))
+      {
+        m_accessTier = IntelligentTieringAccessTierMapper::GetIntelligentTieringAccessTierForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_accessTierHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Tiering::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/TopicConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ TopicConfiguration::TopicConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+TopicConfiguration::TopicConfiguration(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_topicArnHasBeenSet(false),
+    m_eventsHasBeenSet(false),
+    m_filterHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TopicConfiguration& TopicConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -78,6 +88,37 @@ TopicConfiguration& TopicConfiguration::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+TopicConfiguration& TopicConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Topic"))
+      {
+        m_topicArn = reader.ReadText();
+        m_topicArnHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Event"))
+      {
+        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(reader.ReadText().c_str())));
+        m_eventsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Filter"))
+      {
+        m_filter = reader;
+        m_filterHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void TopicConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/TopicConfigurationDeprecated.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -35,6 +36,14 @@ TopicConfigurationDeprecated::TopicConfigurationDeprecated(const XmlNode& xmlNod
   *this = xmlNode;
 }
 
+TopicConfigurationDeprecated::TopicConfigurationDeprecated(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_eventsHasBeenSet(false),
+    m_topicHasBeenSet(false)
+{
+  *this = reader;
+}
+
 TopicConfigurationDeprecated& TopicConfigurationDeprecated::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -70,6 +79,32 @@ TopicConfigurationDeprecated& TopicConfigurationDeprecated::operator =(const Xml
   return *this;
 }
 
+TopicConfigurationDeprecated& TopicConfigurationDeprecated::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Event"))
+      {
+        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(reader.ReadText().c_str())));
+        m_eventsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Topic"))
+      {
+        m_topic = reader.ReadText();
+        m_topicHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void TopicConfigurationDeprecated::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/VersioningConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ VersioningConfiguration::VersioningConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+VersioningConfiguration::VersioningConfiguration(XmlReader& reader) : 
+    m_mFADelete(MFADelete::NOT_SET),
+    m_mFADeleteHasBeenSet(false),
+    m_status(BucketVersioningStatus::NOT_SET),
+    m_statusHasBeenSet(false)
+{
+  *this = reader;
+}
+
 VersioningConfiguration& VersioningConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -60,6 +70,27 @@ VersioningConfiguration& VersioningConfiguration::operator =(const XmlNode& xmlN
   return *this;
 }
 
+VersioningConfiguration& VersioningConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("MfaDelete"))
+      {
+        m_mFADelete = MFADeleteMapper::GetMFADeleteForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_mFADeleteHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Status"))
+      {
+        m_status = BucketVersioningStatusMapper::GetBucketVersioningStatusForName(StringUtils::Trim(reader.ReadText().c_str()));
+        m_statusHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void VersioningConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
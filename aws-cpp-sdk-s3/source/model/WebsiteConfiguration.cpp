@@ -5,6 +5,7 @@
 
 #include <aws/s3/model/WebsiteConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ WebsiteConfiguration::WebsiteConfiguration(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+WebsiteConfiguration::WebsiteConfiguration(XmlReader& reader) : 
+    m_errorDocumentHasBeenSet(false),
+    m_indexDocumentHasBeenSet(false),
+    m_redirectAllRequestsToHasBeenSet(false),
+    m_routingRulesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 WebsiteConfiguration& WebsiteConfiguration::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -78,6 +88,46 @@ WebsiteConfiguration& WebsiteConfiguration::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+WebsiteConfiguration& WebsiteConfiguration::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("ErrorDocument"))
+      {
+        m_errorDocument = reader;
+        m_errorDocumentHasBeenSet = true;
+      }
+      else if(reader.NameEquals("IndexDocument"))
+      {
+        m_indexDocument = reader;
+        m_indexDocumentHasBeenSet = true;
+      }
+      else if(reader.NameEquals("RedirectAllRequestsTo"))
+      {
+        m_redirectAllRequestsTo = reader;
+        m_redirectAllRequestsToHasBeenSet = true;
+      }
+      else if(reader.NameEquals("RoutingRules"))
+      {
+        if(reader.StartElement())
+        {
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("RoutingRule"))
+            {
+              m_routingRules.push_back(reader);
+            }
+          }
+        }
+        m_routingRulesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void WebsiteConfiguration::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -0,0 +1,168 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/sqs/model/GetQueueAttributesResult.h>
+#include <aws/sqs/model/ListQueuesResult.h>
+#include <aws/sqs/model/ReceiveMessageResult.h>
+#include <aws/sqs/model/SendMessageBatchResult.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Xml;
+using namespace Aws::SQS::Model;
+
+namespace
+{
+    // Response bodies as SQS returns them.
+    static const char RECEIVE_MESSAGE_RESPONSE[] = "<?xml version=\"1.0\"?>"
+        "<ReceiveMessageResponse xmlns=\"http://queue.amazonaws.com/doc/2012-11-05/\"><ReceiveMessageResult>"
+        "<Message><MessageId>5fea7756-0ea4-451a-a703-a558b933e274</MessageId>"
+        "<ReceiptHandle>MbZj6wDWli+JvwwJaBV+3dcjk2YW2vA3+STFFljTM8tJJg6HRG6PYSasuWXPJB+Cw</ReceiptHandle>"
+        "<MD5OfBody>fafb00f5732ab283681e124bf8747ed1</MD5OfBody><Body>This is a &lt;test&gt; message</Body>"
+        "<Attribute><Name>SenderId</Name><Value>195004372649</Value></Attribute>"
+        "<Attribute><Name>ApproximateReceiveCount</Name><Value>5</Value></Attribute>"
+        "<MD5OfMessageAttributes>07c2e6c1a4d6f1a1e8b1c0d1e2f3a4b5</MD5OfMessageAttributes>"
+        "<MessageAttribute><Name>Color</Name><Value><StringValue>red</StringValue><DataType>String</DataType></Value></MessageAttribute>"
+        "<MessageAttribute><Name>Thumbnail</Name><Value><BinaryValue>AAEC</BinaryValue><DataType>Binary</DataType></Value></MessageAttribute>"
+        "</Message>"
+        "<Message><MessageId>8bd0f0b4-2a49-4d43-a3a7-1f0c1e5d7f8a</MessageId><ReceiptHandle>AQEBzbVv</ReceiptHandle>"
+        "<MD5OfBody>d41d8cd98f00b204e9800998ecf8427e</MD5OfBody><Body>Fish &amp; chips &#x1F41F;</Body></Message>"
+        "</ReceiveMessageResult>"
+        "<ResponseMetadata><RequestId>b6633655-283d-45b4-aee4-4e84e0ae6afa</RequestId></ResponseMetadata>"
+        "</ReceiveMessageResponse>";
+
+    static const char GET_QUEUE_ATTRIBUTES_RESPONSE[] = "<GetQueueAttributesResponse><GetQueueAttributesResult>"
+        "<Attribute><Name>VisibilityTimeout</Name><Value>30</Value></Attribute>"
+        "<Attribute><Name>DelaySeconds</Name><Value>0</Value></Attribute>"
+        "<Attribute><Name>ReceiveMessageWaitTimeSeconds</Name><Value>2</Value></Attribute>"
+        "</GetQueueAttributesResult>"
+        "<ResponseMetadata><RequestId>1ea71be5-b5a2-4f9d-b85a-945d8d08cd0b</RequestId></ResponseMetadata>"
+        "</GetQueueAttributesResponse>";
+
+    static const char SEND_MESSAGE_BATCH_RESPONSE[] = "<SendMessageBatchResponse><SendMessageBatchResult>"
+        "<SendMessageBatchResultEntry><Id>test_msg_001</Id><MessageId>0a5231c7-8bff-4955-be2e-8dc7c50a25fa</MessageId>"
+        "<MD5OfMessageBody>0e024d309850c78cba5eabbeff7cae71</MD5OfMessageBody></SendMessageBatchResultEntry>"
+        "<SendMessageBatchResultEntry><Id>test_msg_002</Id><MessageId>15ee1ed3-87e7-40c1-bdaa-2e49968ea7e9</MessageId>"
+        "<MD5OfMessageBody>7fb8146a82f95e0af155278f406862c2</MD5OfMessageBody></SendMessageBatchResultEntry>"
+        "<BatchResultErrorEntry><Id>test_msg_003</Id><SenderFault>true</SenderFault><Code>InvalidParameterValue</Code>"
+        "<Message>Message too long</Message></BatchResultErrorEntry>"
+        "</SendMessageBatchResult>"
+        "<ResponseMetadata><RequestId>ca1ad5d0-8271-408b-8d0f-1351bf547e74</RequestId></ResponseMetadata>"
+        "</SendMessageBatchResponse>";
+
+    static const char LIST_QUEUES_RESPONSE[] = "<ListQueuesResponse><ListQueuesResult>"
+        "<QueueUrl>https://sqs.us-east-2.amazonaws.com/123456789012/MyQueue</QueueUrl>"
+        "<UnknownMember><QueueUrl>ignored</QueueUrl></UnknownMember>"
+        "<QueueUrl>https://sqs.us-east-2.amazonaws.com/123456789012/MyOtherQueue</QueueUrl>"
+        "</ListQueuesResult>"
+        "<ResponseMetadata><RequestId>725275ae-0b9b-4762-b238-436d7c65a1ac</RequestId></ResponseMetadata>"
+        "</ListQueuesResponse>";
+
+    template<typename RESULT>
+    RESULT ResultFromXmlDocument(const char* body)
+    {
+        return RESULT(Aws::AmazonWebServiceResult<XmlDocument>(XmlDocument::CreateFromXmlString(body), HeaderValueCollection()));
+    }
+
+    template<typename RESULT>
+    RESULT ResultFromXmlReader(const char* body)
+    {
+        return RESULT(Aws::AmazonWebServiceResult<XmlReader>(XmlReader(body, strlen(body)), HeaderValueCollection()));
+    }
+
+    TEST(ModelXmlReaderTest, TestReceiveMessageResult)
+    {
+        auto result = ResultFromXmlReader<ReceiveMessageResult>(RECEIVE_MESSAGE_RESPONSE);
+        ASSERT_EQ("b6633655-283d-45b4-aee4-4e84e0ae6afa", result.GetResponseMetadata().GetRequestId());
+        const auto& messages = result.GetMessages();
+        ASSERT_EQ(2u, messages.size());
+        ASSERT_EQ("5fea7756-0ea4-451a-a703-a558b933e274", messages[0].GetMessageId());
+        ASSERT_EQ("fafb00f5732ab283681e124bf8747ed1", messages[0].GetMD5OfBody());
+        ASSERT_EQ("This is a <test> message", messages[0].GetBody());
+        ASSERT_EQ(2u, messages[0].GetAttributes().size());
+        ASSERT_EQ("195004372649", messages[0].GetAttributes().at(MessageSystemAttributeName::SenderId));
+        ASSERT_EQ("5", messages[0].GetAttributes().at(MessageSystemAttributeName::ApproximateReceiveCount));
+        const auto& messageAttributes = messages[0].GetMessageAttributes();
+        ASSERT_EQ(2u, messageAttributes.size());
+        ASSERT_EQ("red", messageAttributes.at("Color").GetStringValue());
+        ASSERT_EQ("String", messageAttributes.at("Color").GetDataType());
+        ASSERT_EQ(HashingUtils::Base64Decode("AAEC"), messageAttributes.at("Thumbnail").GetBinaryValue());
+        ASSERT_EQ("Fish & chips \xF0\x9F\x90\x9F", messages[1].GetBody());
+        ASSERT_TRUE(messages[1].GetAttributes().empty());
+
+        // Both ways of reading the payload build the same model.
+        auto expected = ResultFromXmlDocument<ReceiveMessageResult>(RECEIVE_MESSAGE_RESPONSE);
+        ASSERT_EQ(expected.GetResponseMetadata().GetRequestId(), result.GetResponseMetadata().GetRequestId());
+        ASSERT_EQ(expected.GetMessages().size(), messages.size());
+        for (size_t i = 0; i < messages.size(); ++i)
+        {
+            ASSERT_EQ(expected.GetMessages()[i].GetMessageId(), messages[i].GetMessageId());
+            ASSERT_EQ(expected.GetMessages()[i].GetReceiptHandle(), messages[i].GetReceiptHandle());
+            ASSERT_EQ(expected.GetMessages()[i].GetMD5OfMessageAttributes(), messages[i].GetMD5OfMessageAttributes());
+            ASSERT_EQ(expected.GetMessages()[i].GetBody(), messages[i].GetBody());
+            ASSERT_EQ(expected.GetMessages()[i].GetAttributes(), messages[i].GetAttributes());
+            ASSERT_EQ(expected.GetMessages()[i].GetMessageAttributes().size(), messages[i].GetMessageAttributes().size());
+        }
+    }
+
+    TEST(ModelXmlReaderTest, TestGetQueueAttributesResult)
+    {
+        auto result = ResultFromXmlReader<GetQueueAttributesResult>(GET_QUEUE_ATTRIBUTES_RESPONSE);
+        const auto& attributes = result.GetAttributes();
+        ASSERT_EQ(3u, attributes.size());
+        ASSERT_EQ("30", attributes.at(QueueAttributeName::VisibilityTimeout));
+        ASSERT_EQ("0", attributes.at(QueueAttributeName::DelaySeconds));
+        ASSERT_EQ("2", attributes.at(QueueAttributeName::ReceiveMessageWaitTimeSeconds));
+        ASSERT_EQ("1ea71be5-b5a2-4f9d-b85a-945d8d08cd0b", result.GetResponseMetadata().GetRequestId());
+
+        auto expected = ResultFromXmlDocument<GetQueueAttributesResult>(GET_QUEUE_ATTRIBUTES_RESPONSE);
+        ASSERT_EQ(expected.GetAttributes(), attributes);
+    }
+
+    TEST(ModelXmlReaderTest, TestSendMessageBatchResult)
+    {
+        auto result = ResultFromXmlReader<SendMessageBatchResult>(SEND_MESSAGE_BATCH_RESPONSE);
+        ASSERT_EQ(2u, result.GetSuccessful().size());
+        ASSERT_EQ("test_msg_002", result.GetSuccessful()[1].GetId());
+        ASSERT_EQ("15ee1ed3-87e7-40c1-bdaa-2e49968ea7e9", result.GetSuccessful()[1].GetMessageId());
+        ASSERT_EQ("7fb8146a82f95e0af155278f406862c2", result.GetSuccessful()[1].GetMD5OfMessageBody());
+        ASSERT_EQ(1u, result.GetFailed().size());
+        ASSERT_EQ("test_msg_003", result.GetFailed()[0].GetId());
+        ASSERT_TRUE(result.GetFailed()[0].GetSenderFault());
+        ASSERT_EQ("InvalidParameterValue", result.GetFailed()[0].GetCode());
+        ASSERT_EQ("Message too long", result.GetFailed()[0].GetMessage());
+        ASSERT_EQ("ca1ad5d0-8271-408b-8d0f-1351bf547e74", result.GetResponseMetadata().GetRequestId());
+
+        auto expected = ResultFromXmlDocument<SendMessageBatchResult>(SEND_MESSAGE_BATCH_RESPONSE);
+        ASSERT_EQ(expected.GetSuccessful().size(), result.GetSuccessful().size());
+        ASSERT_EQ(expected.GetSuccessful()[0].GetMessageId(), result.GetSuccessful()[0].GetMessageId());
+        ASSERT_EQ(expected.GetFailed()[0].GetMessage(), result.GetFailed()[0].GetMessage());
+    }
+
+    TEST(ModelXmlReaderTest, TestListQueuesResultSkipsUnknownMembers)
+    {
+        auto result = ResultFromXmlReader<ListQueuesResult>(LIST_QUEUES_RESPONSE);
+        ASSERT_EQ(Aws::Vector<Aws::String>({"https://sqs.us-east-2.amazonaws.com/123456789012/MyQueue",
+            "https://sqs.us-east-2.amazonaws.com/123456789012/MyOtherQueue"}), result.GetQueueUrls());
+        ASSERT_EQ("725275ae-0b9b-4762-b238-436d7c65a1ac", result.GetResponseMetadata().GetRequestId());
+
+        auto expected = ResultFromXmlDocument<ListQueuesResult>(LIST_QUEUES_RESPONSE);
+        ASSERT_EQ(expected.GetQueueUrls(), result.GetQueueUrls());
+    }
+
+    TEST(ModelXmlReaderTest, TestEmptyPayload)
+    {
+        auto result = ReceiveMessageResult(Aws::AmazonWebServiceResult<XmlReader>(XmlReader(), HeaderValueCollection()));
+        ASSERT_TRUE(result.GetMessages().empty());
+        ASSERT_TRUE(result.GetResponseMetadata().GetRequestId().empty());
+    }
+}
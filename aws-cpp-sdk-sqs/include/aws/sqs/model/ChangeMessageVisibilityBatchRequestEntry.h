@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -45,6 +46,8 @@ namespace Model
     ChangeMessageVisibilityBatchRequestEntry();
     ChangeMessageVisibilityBatchRequestEntry(const Aws::Utils::Xml::XmlNode& xmlNode);
     ChangeMessageVisibilityBatchRequestEntry& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ChangeMessageVisibilityBatchRequestEntry(Aws::Utils::Xml::XmlReader& reader);
+    ChangeMessageVisibilityBatchRequestEntry& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -35,6 +36,8 @@ namespace Model
     DeleteMessageBatchRequestEntry();
     DeleteMessageBatchRequestEntry(const Aws::Utils::Xml::XmlNode& xmlNode);
     DeleteMessageBatchRequestEntry& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    DeleteMessageBatchRequestEntry(Aws::Utils::Xml::XmlReader& reader);
+    DeleteMessageBatchRequestEntry& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
@@ -19,6 +19,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -37,6 +38,8 @@ namespace Model
     Message();
     Message(const Aws::Utils::Xml::XmlNode& xmlNode);
     Message& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    Message(Aws::Utils::Xml::XmlReader& reader);
+    Message& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
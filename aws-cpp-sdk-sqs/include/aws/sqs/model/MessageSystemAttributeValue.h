@@ -18,6 +18,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -40,6 +41,8 @@ namespace Model
     MessageSystemAttributeValue();
     MessageSystemAttributeValue(const Aws::Utils::Xml::XmlNode& xmlNode);
     MessageSystemAttributeValue& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    MessageSystemAttributeValue(Aws::Utils::Xml::XmlReader& reader);
+    MessageSystemAttributeValue& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -29,6 +30,8 @@ namespace Model
     ResponseMetadata();
     ResponseMetadata(const Aws::Utils::Xml::XmlNode& xmlNode);
     ResponseMetadata& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    ResponseMetadata(Aws::Utils::Xml::XmlReader& reader);
+    ResponseMetadata& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
@@ -20,6 +20,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace SQS
@@ -39,6 +40,8 @@ namespace Model
     SendMessageBatchRequestEntry();
     SendMessageBatchRequestEntry(const Aws::Utils::Xml::XmlNode& xmlNode);
     SendMessageBatchRequestEntry& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    SendMessageBatchRequestEntry(Aws::Utils::Xml::XmlReader& reader);
+    SendMessageBatchRequestEntry& operator=(Aws::Utils::Xml::XmlReader& reader);
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
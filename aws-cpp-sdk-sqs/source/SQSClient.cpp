@@ -12,6 +12,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -117,7 +118,7 @@ void SQSClient::OverrideEndpoint(const Aws::String& endpoint)
 
 AddPermissionOutcome SQSClient::AddPermission(const AddPermissionRequest& request) const
 {
-  return AddPermissionOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return AddPermissionOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 AddPermissionOutcomeCallable SQSClient::AddPermissionCallable(const AddPermissionRequest& request) const
@@ -140,7 +141,7 @@ void SQSClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, co
 
 ChangeMessageVisibilityOutcome SQSClient::ChangeMessageVisibility(const ChangeMessageVisibilityRequest& request) const
 {
-  return ChangeMessageVisibilityOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return ChangeMessageVisibilityOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 ChangeMessageVisibilityOutcomeCallable SQSClient::ChangeMessageVisibilityCallable(const ChangeMessageVisibilityRequest& request) const
@@ -163,7 +164,7 @@ void SQSClient::ChangeMessageVisibilityAsyncHelper(const ChangeMessageVisibility
 
 ChangeMessageVisibilityBatchOutcome SQSClient::ChangeMessageVisibilityBatch(const ChangeMessageVisibilityBatchRequest& request) const
 {
-  return ChangeMessageVisibilityBatchOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return ChangeMessageVisibilityBatchOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 ChangeMessageVisibilityBatchOutcomeCallable SQSClient::ChangeMessageVisibilityBatchCallable(const ChangeMessageVisibilityBatchRequest& request) const
@@ -190,7 +191,7 @@ CreateQueueOutcome SQSClient::CreateQueue(const CreateQueueRequest& request) con
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return CreateQueueOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST));
+  return CreateQueueOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 CreateQueueOutcomeCallable SQSClient::CreateQueueCallable(const CreateQueueRequest& request) const
@@ -213,7 +214,7 @@ void SQSClient::CreateQueueAsyncHelper(const CreateQueueRequest& request, const
 
 DeleteMessageOutcome SQSClient::DeleteMessage(const DeleteMessageRequest& request) const
 {
-  return DeleteMessageOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return DeleteMessageOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 DeleteMessageOutcomeCallable SQSClient::DeleteMessageCallable(const DeleteMessageRequest& request) const
@@ -236,7 +237,7 @@ void SQSClient::DeleteMessageAsyncHelper(const DeleteMessageRequest& request, co
 
 DeleteMessageBatchOutcome SQSClient::DeleteMessageBatch(const DeleteMessageBatchRequest& request) const
 {
-  return DeleteMessageBatchOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return DeleteMessageBatchOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 DeleteMessageBatchOutcomeCallable SQSClient::DeleteMessageBatchCallable(const DeleteMessageBatchRequest& request) const
@@ -259,7 +260,7 @@ void SQSClient::DeleteMessageBatchAsyncHelper(const DeleteMessageBatchRequest& r
 
 DeleteQueueOutcome SQSClient::DeleteQueue(const DeleteQueueRequest& request) const
 {
-  return DeleteQueueOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return DeleteQueueOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 DeleteQueueOutcomeCallable SQSClient::DeleteQueueCallable(const DeleteQueueRequest& request) const
@@ -282,7 +283,7 @@ void SQSClient::DeleteQueueAsyncHelper(const DeleteQueueRequest& request, const
 
 GetQueueAttributesOutcome SQSClient::GetQueueAttributes(const GetQueueAttributesRequest& request) const
 {
-  return GetQueueAttributesOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return GetQueueAttributesOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 GetQueueAttributesOutcomeCallable SQSClient::GetQueueAttributesCallable(const GetQueueAttributesRequest& request) const
@@ -309,7 +310,7 @@ GetQueueUrlOutcome SQSClient::GetQueueUrl(const GetQueueUrlRequest& request) con
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return GetQueueUrlOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST));
+  return GetQueueUrlOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 GetQueueUrlOutcomeCallable SQSClient::GetQueueUrlCallable(const GetQueueUrlRequest& request) const
@@ -332,7 +333,7 @@ void SQSClient::GetQueueUrlAsyncHelper(const GetQueueUrlRequest& request, const
 
 ListDeadLetterSourceQueuesOutcome SQSClient::ListDeadLetterSourceQueues(const ListDeadLetterSourceQueuesRequest& request) const
 {
-  return ListDeadLetterSourceQueuesOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return ListDeadLetterSourceQueuesOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 ListDeadLetterSourceQueuesOutcomeCallable SQSClient::ListDeadLetterSourceQueuesCallable(const ListDeadLetterSourceQueuesRequest& request) const
@@ -355,7 +356,7 @@ void SQSClient::ListDeadLetterSourceQueuesAsyncHelper(const ListDeadLetterSource
 
 ListQueueTagsOutcome SQSClient::ListQueueTags(const ListQueueTagsRequest& request) const
 {
-  return ListQueueTagsOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return ListQueueTagsOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 ListQueueTagsOutcomeCallable SQSClient::ListQueueTagsCallable(const ListQueueTagsRequest& request) const
@@ -382,7 +383,7 @@ ListQueuesOutcome SQSClient::ListQueues(const ListQueuesRequest& request) const
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListQueuesOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST));
+  return ListQueuesOutcome(MakeRequestWithXmlReader(uri, request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 ListQueuesOutcomeCallable SQSClient::ListQueuesCallable(const ListQueuesRequest& request) const
@@ -405,7 +406,7 @@ void SQSClient::ListQueuesAsyncHelper(const ListQueuesRequest& request, const Li
 
 PurgeQueueOutcome SQSClient::PurgeQueue(const PurgeQueueRequest& request) const
 {
-  return PurgeQueueOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return PurgeQueueOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 PurgeQueueOutcomeCallable SQSClient::PurgeQueueCallable(const PurgeQueueRequest& request) const
@@ -428,7 +429,7 @@ void SQSClient::PurgeQueueAsyncHelper(const PurgeQueueRequest& request, const Pu
 
 ReceiveMessageOutcome SQSClient::ReceiveMessage(const ReceiveMessageRequest& request) const
 {
-  return ReceiveMessageOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return ReceiveMessageOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 ReceiveMessageOutcomeCallable SQSClient::ReceiveMessageCallable(const ReceiveMessageRequest& request) const
@@ -451,7 +452,7 @@ void SQSClient::ReceiveMessageAsyncHelper(const ReceiveMessageRequest& request,
 
 RemovePermissionOutcome SQSClient::RemovePermission(const RemovePermissionRequest& request) const
 {
-  return RemovePermissionOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return RemovePermissionOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 RemovePermissionOutcomeCallable SQSClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
@@ -474,7 +475,7 @@ void SQSClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& reque
 
 SendMessageOutcome SQSClient::SendMessage(const SendMessageRequest& request) const
 {
-  return SendMessageOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return SendMessageOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 SendMessageOutcomeCallable SQSClient::SendMessageCallable(const SendMessageRequest& request) const
@@ -497,7 +498,7 @@ void SQSClient::SendMessageAsyncHelper(const SendMessageRequest& request, const
 
 SendMessageBatchOutcome SQSClient::SendMessageBatch(const SendMessageBatchRequest& request) const
 {
-  return SendMessageBatchOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return SendMessageBatchOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 SendMessageBatchOutcomeCallable SQSClient::SendMessageBatchCallable(const SendMessageBatchRequest& request) const
@@ -520,7 +521,7 @@ void SQSClient::SendMessageBatchAsyncHelper(const SendMessageBatchRequest& reque
 
 SetQueueAttributesOutcome SQSClient::SetQueueAttributes(const SetQueueAttributesRequest& request) const
 {
-  return SetQueueAttributesOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return SetQueueAttributesOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 SetQueueAttributesOutcomeCallable SQSClient::SetQueueAttributesCallable(const SetQueueAttributesRequest& request) const
@@ -543,7 +544,7 @@ void SQSClient::SetQueueAttributesAsyncHelper(const SetQueueAttributesRequest& r
 
 TagQueueOutcome SQSClient::TagQueue(const TagQueueRequest& request) const
 {
-  return TagQueueOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return TagQueueOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 TagQueueOutcomeCallable SQSClient::TagQueueCallable(const TagQueueRequest& request) const
@@ -566,7 +567,7 @@ void SQSClient::TagQueueAsyncHelper(const TagQueueRequest& request, const TagQue
 
 UntagQueueOutcome SQSClient::UntagQueue(const UntagQueueRequest& request) const
 {
-  return UntagQueueOutcome(MakeRequest(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
+  return UntagQueueOutcome(MakeRequestWithXmlReader(request.GetQueueUrl(), request, Aws::Http::HttpMethod::HTTP_POST));
 }
 
 UntagQueueOutcomeCallable SQSClient::UntagQueueCallable(const UntagQueueRequest& request) const
@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/BatchResultErrorEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -39,6 +40,16 @@ BatchResultErrorEntry::BatchResultErrorEntry(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+BatchResultErrorEntry::BatchResultErrorEntry(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_senderFault(false),
+    m_senderFaultHasBeenSet(false),
+    m_codeHasBeenSet(false),
+    m_messageHasBeenSet(false)
+{
+  *this = reader;
+}
+
 BatchResultErrorEntry& BatchResultErrorEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -74,6 +85,37 @@ BatchResultErrorEntry& BatchResultErrorEntry::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+BatchResultErrorEntry& BatchResultErrorEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("SenderFault"))
+      {
+        m_senderFault = StringUtils::ConvertToBool(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_senderFaultHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Code"))
+      {
+        m_code = reader.ReadText();
+        m_codeHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Message"))
+      {
+        m_message = reader.ReadText();
+        m_messageHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void BatchResultErrorEntry::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_idHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/ChangeMessageVisibilityBatchRequestEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -37,6 +38,15 @@ ChangeMessageVisibilityBatchRequestEntry::ChangeMessageVisibilityBatchRequestEnt
   *this = xmlNode;
 }
 
+ChangeMessageVisibilityBatchRequestEntry::ChangeMessageVisibilityBatchRequestEntry(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_receiptHandleHasBeenSet(false),
+    m_visibilityTimeout(0),
+    m_visibilityTimeoutHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ChangeMessageVisibilityBatchRequestEntry& ChangeMessageVisibilityBatchRequestEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -66,6 +76,32 @@ ChangeMessageVisibilityBatchRequestEntry& ChangeMessageVisibilityBatchRequestEnt
   return *this;
 }
 
+ChangeMessageVisibilityBatchRequestEntry& ChangeMessageVisibilityBatchRequestEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ReceiptHandle"))
+      {
+        m_receiptHandle = reader.ReadText();
+        m_receiptHandleHasBeenSet = true;
+      }
+      else if(reader.NameEquals("VisibilityTimeout"))
+      {
+        m_visibilityTimeout = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_visibilityTimeoutHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ChangeMessageVisibilityBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_idHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/ChangeMessageVisibilityBatchResultEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ ChangeMessageVisibilityBatchResultEntry::ChangeMessageVisibilityBatchResultEntry
   *this = xmlNode;
 }
 
+ChangeMessageVisibilityBatchResultEntry::ChangeMessageVisibilityBatchResultEntry(XmlReader& reader) : 
+    m_idHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ChangeMessageVisibilityBatchResultEntry& ChangeMessageVisibilityBatchResultEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ ChangeMessageVisibilityBatchResultEntry& ChangeMessageVisibilityBatchResultEntry
   return *this;
 }
 
+ChangeMessageVisibilityBatchResultEntry& ChangeMessageVisibilityBatchResultEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ChangeMessageVisibilityBatchResultEntry::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_idHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/CreateQueueResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
@@ -52,3 +53,51 @@ CreateQueueResult& CreateQueueResult::operator =(const Aws::AmazonWebServiceResu
   }
   return *this;
 }
+
+CreateQueueResult::CreateQueueResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+CreateQueueResult& CreateQueueResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    // Members are children of the root element if it is named after the result, or else of its child named after the result.
+    // The response metadata is a child of the root element.
+    const bool rootIsResultNode = reader.NameEquals("CreateQueueResult");
+    bool inResultNode = rootIsResultNode;
+    reader.StartElement();
+    for(;;)
+    {
+      if(!reader.NextChild())
+      {
+        if(inResultNode && !rootIsResultNode)
+        {
+          inResultNode = false;
+          continue;
+        }
+        break;
+      }
+
+      if(reader.NameEquals("ResponseMetadata"))
+      {
+        m_responseMetadata = reader;
+      }
+      else if(!inResultNode && reader.NameEquals("CreateQueueResult"))
+      {
+        inResultNode = reader.StartElement();
+      }
+      else if(inResultNode)
+      {
+        if(reader.NameEquals("QueueUrl"))
+        {
+          m_queueUrl = reader.ReadText();
+        }
+      }
+    }
+    AWS_LOGSTREAM_DEBUG("Aws::SQS::Model::CreateQueueResult", "x-amzn-request-id: " << m_responseMetadata.GetRequestId() );
+  }
+  return *this;
+}
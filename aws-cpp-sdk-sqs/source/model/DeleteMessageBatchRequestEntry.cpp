@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/DeleteMessageBatchRequestEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -33,6 +34,13 @@ DeleteMessageBatchRequestEntry::DeleteMessageBatchRequestEntry(const XmlNode& xm
   *this = xmlNode;
 }
 
+DeleteMessageBatchRequestEntry::DeleteMessageBatchRequestEntry(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_receiptHandleHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteMessageBatchRequestEntry& DeleteMessageBatchRequestEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -56,6 +64,27 @@ DeleteMessageBatchRequestEntry& DeleteMessageBatchRequestEntry::operator =(const
   return *this;
 }
 
+DeleteMessageBatchRequestEntry& DeleteMessageBatchRequestEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ReceiptHandle"))
+      {
+        m_receiptHandle = reader.ReadText();
+        m_receiptHandleHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void DeleteMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_idHasBeenSet)
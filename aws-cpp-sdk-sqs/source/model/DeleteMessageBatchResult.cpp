@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/DeleteMessageBatchResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
@@ -69,3 +70,55 @@ DeleteMessageBatchResult& DeleteMessageBatchResult::operator =(const Aws::Amazon
   }
   return *this;
 }
+
+DeleteMessageBatchResult::DeleteMessageBatchResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+DeleteMessageBatchResult& DeleteMessageBatchResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    // Members are children of the root element if it is named after the result, or else of its child named after the result.
+    // The response metadata is a child of the root element.
+    const bool rootIsResultNode = reader.NameEquals("DeleteMessageBatchResult");
+    bool inResultNode = rootIsResultNode;
+    reader.StartElement();
+    for(;;)
+    {
+      if(!reader.NextChild())
+      {
+        if(inResultNode && !rootIsResultNode)
+        {
+          inResultNode = false;
+          continue;
+        }
+        break;
+      }
+
+      if(reader.NameEquals("ResponseMetadata"))
+      {
+        m_responseMetadata = reader;
+      }
+      else if(!inResultNode && reader.NameEquals("DeleteMessageBatchResult"))
+      {
+        inResultNode = reader.StartElement();
+      }
+      else if(inResultNode)
+      {
+        if(reader.NameEquals("DeleteMessageBatchResultEntry"))
+        {
+          m_successful.push_back(reader);
+        }
+        else if(reader.NameEquals("BatchResultErrorEntry"))
+        {
+          m_failed.push_back(reader);
+        }
+      }
+    }
+    AWS_LOGSTREAM_DEBUG("Aws::SQS::Model::DeleteMessageBatchResult", "x-amzn-request-id: " << m_responseMetadata.GetRequestId() );
+  }
+  return *this;
+}
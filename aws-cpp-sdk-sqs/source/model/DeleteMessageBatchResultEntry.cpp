@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/DeleteMessageBatchResultEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ DeleteMessageBatchResultEntry::DeleteMessageBatchResultEntry(const XmlNode& xmlN
   *this = xmlNode;
 }
 
+DeleteMessageBatchResultEntry::DeleteMessageBatchResultEntry(XmlReader& reader) : 
+    m_idHasBeenSet(false)
+{
+  *this = reader;
+}
+
 DeleteMessageBatchResultEntry& DeleteMessageBatchResultEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ DeleteMessageBatchResultEntry& DeleteMessageBatchResultEntry::operator =(const X
   return *this;
 }
 
+DeleteMessageBatchResultEntry& DeleteMessageBatchResultEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void DeleteMessageBatchResultEntry::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_idHasBeenSet)
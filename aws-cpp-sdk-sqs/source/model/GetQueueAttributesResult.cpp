@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/GetQueueAttributesResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
@@ -61,3 +62,67 @@ GetQueueAttributesResult& GetQueueAttributesResult::operator =(const Aws::Amazon
   }
   return *this;
 }
+
+GetQueueAttributesResult::GetQueueAttributesResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+GetQueueAttributesResult& GetQueueAttributesResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    // Members are children of the root element if it is named after the result, or else of its child named after the result.
+    // The response metadata is a child of the root element.
+    const bool rootIsResultNode = reader.NameEquals("GetQueueAttributesResult");
+    bool inResultNode = rootIsResultNode;
+    reader.StartElement();
+    for(;;)
+    {
+      if(!reader.NextChild())
+      {
+        if(inResultNode && !rootIsResultNode)
+        {
+          inResultNode = false;
+          continue;
+        }
+        break;
+      }
+
+      if(reader.NameEquals("ResponseMetadata"))
+      {
+        m_responseMetadata = reader;
+      }
+      else if(!inResultNode && reader.NameEquals("GetQueueAttributesResult"))
+      {
+        inResultNode = reader.StartElement();
+      }
+      else if(inResultNode)
+      {
+        if(reader.NameEquals("Attribute"))
+        {
+          if(reader.StartElement())
+          {
+            Aws::String attributesKey;
+            Aws::String attributesValue{};
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("Name"))
+              {
+                attributesKey = reader.ReadText();
+              }
+              else if(reader.NameEquals("Value"))
+              {
+                attributesValue = reader.ReadText();
+              }
+            }
+            m_attributes[QueueAttributeNameMapper::GetQueueAttributeNameForName(StringUtils::Trim(attributesKey.c_str()))] = std::move(attributesValue);
+          }
+        }
+      }
+    }
+    AWS_LOGSTREAM_DEBUG("Aws::SQS::Model::GetQueueAttributesResult", "x-amzn-request-id: " << m_responseMetadata.GetRequestId() );
+  }
+  return *this;
+}
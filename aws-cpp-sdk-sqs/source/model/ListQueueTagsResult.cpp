@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/ListQueueTagsResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
@@ -61,3 +62,67 @@ ListQueueTagsResult& ListQueueTagsResult::operator =(const Aws::AmazonWebService
   }
   return *this;
 }
+
+ListQueueTagsResult::ListQueueTagsResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+ListQueueTagsResult& ListQueueTagsResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    // Members are children of the root element if it is named after the result, or else of its child named after the result.
+    // The response metadata is a child of the root element.
+    const bool rootIsResultNode = reader.NameEquals("ListQueueTagsResult");
+    bool inResultNode = rootIsResultNode;
+    reader.StartElement();
+    for(;;)
+    {
+      if(!reader.NextChild())
+      {
+        if(inResultNode && !rootIsResultNode)
+        {
+          inResultNode = false;
+          continue;
+        }
+        break;
+      }
+
+      if(reader.NameEquals("ResponseMetadata"))
+      {
+        m_responseMetadata = reader;
+      }
+      else if(!inResultNode && reader.NameEquals("ListQueueTagsResult"))
+      {
+        inResultNode = reader.StartElement();
+      }
+      else if(inResultNode)
+      {
+        if(reader.NameEquals("Tag"))
+        {
+          if(reader.StartElement())
+          {
+            Aws::String tagsKey;
+            Aws::String tagsValue{};
+            while(reader.NextChild())
+            {
+              if(reader.NameEquals("Key"))
+              {
+                tagsKey = reader.ReadText();
+              }
+              else if(reader.NameEquals("Value"))
+              {
+                tagsValue = reader.ReadText();
+              }
+            }
+            m_tags[tagsKey] = std::move(tagsValue);
+          }
+        }
+      }
+    }
+    AWS_LOGSTREAM_DEBUG("Aws::SQS::Model::ListQueueTagsResult", "x-amzn-request-id: " << m_responseMetadata.GetRequestId() );
+  }
+  return *this;
+}
@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/Message.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -43,6 +44,18 @@ Message::Message(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+Message::Message(XmlReader& reader) : 
+    m_messageIdHasBeenSet(false),
+    m_receiptHandleHasBeenSet(false),
+    m_mD5OfBodyHasBeenSet(false),
+    m_bodyHasBeenSet(false),
+    m_attributesHasBeenSet(false),
+    m_mD5OfMessageAttributesHasBeenSet(false),
+    m_messageAttributesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Message& Message::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -114,6 +127,84 @@ Message& Message::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Message& Message::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("MessageId"))
+      {
+        m_messageId = reader.ReadText();
+        m_messageIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("ReceiptHandle"))
+      {
+        m_receiptHandle = reader.ReadText();
+        m_receiptHandleHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MD5OfBody"))
+      {
+        m_mD5OfBody = reader.ReadText();
+        m_mD5OfBodyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Body"))
+      {
+        m_body = reader.ReadText();
+        m_bodyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("Attribute"))
+      {
+        if(reader.StartElement())
+        {
+          Aws::String attributesKey;
+          Aws::String attributesValue{};
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Name"))
+            {
+              attributesKey = reader.ReadText();
+            }
+            else if(reader.NameEquals("Value"))
+            {
+              attributesValue = reader.ReadText();
+            }
+          }
+          m_attributes[MessageSystemAttributeNameMapper::GetMessageSystemAttributeNameForName(StringUtils::Trim(attributesKey.c_str()))] = std::move(attributesValue);
+        }
+        m_attributesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MD5OfMessageAttributes"))
+      {
+        m_mD5OfMessageAttributes = reader.ReadText();
+        m_mD5OfMessageAttributesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MessageAttribute"))
+      {
+        if(reader.StartElement())
+        {
+          Aws::String messageAttributesKey;
+          MessageAttributeValue messageAttributesValue{};
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Name"))
+            {
+              messageAttributesKey = reader.ReadText();
+            }
+            else if(reader.NameEquals("Value"))
+            {
+              messageAttributesValue = reader;
+            }
+          }
+          m_messageAttributes[messageAttributesKey] = std::move(messageAttributesValue);
+        }
+        m_messageAttributesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void Message::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_messageIdHasBeenSet)
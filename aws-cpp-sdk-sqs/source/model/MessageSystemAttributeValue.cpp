@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/MessageSystemAttributeValue.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/HashingUtils.h>
@@ -40,6 +41,16 @@ MessageSystemAttributeValue::MessageSystemAttributeValue(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+MessageSystemAttributeValue::MessageSystemAttributeValue(XmlReader& reader) : 
+    m_stringValueHasBeenSet(false),
+    m_binaryValueHasBeenSet(false),
+    m_stringListValuesHasBeenSet(false),
+    m_binaryListValuesHasBeenSet(false),
+    m_dataTypeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 MessageSystemAttributeValue& MessageSystemAttributeValue::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -92,6 +103,42 @@ MessageSystemAttributeValue& MessageSystemAttributeValue::operator =(const XmlNo
   return *this;
 }
 
+MessageSystemAttributeValue& MessageSystemAttributeValue::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("StringValue"))
+      {
+        m_stringValue = reader.ReadText();
+        m_stringValueHasBeenSet = true;
+      }
+      else if(reader.NameEquals("BinaryValue"))
+      {
+        m_binaryValue = HashingUtils::Base64Decode(reader.ReadText());
+        m_binaryValueHasBeenSet = true;
+      }
+      else if(reader.NameEquals("StringListValue"))
+      {
+        m_stringListValues.push_back(reader.ReadText());
+        m_stringListValuesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("BinaryListValue"))
+      {
+        m_binaryListValues.push_back(HashingUtils::Base64Decode(reader.ReadText()));
+        m_binaryListValuesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("DataType"))
+      {
+        m_dataType = reader.ReadText();
+        m_dataTypeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void MessageSystemAttributeValue::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_stringValueHasBeenSet)
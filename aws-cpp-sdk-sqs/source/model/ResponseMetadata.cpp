@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/ResponseMetadata.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -31,6 +32,12 @@ ResponseMetadata::ResponseMetadata(const XmlNode& xmlNode) :
   *this = xmlNode;
 }
 
+ResponseMetadata::ResponseMetadata(XmlReader& reader) : 
+    m_requestIdHasBeenSet(false)
+{
+  *this = reader;
+}
+
 ResponseMetadata& ResponseMetadata::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -48,6 +55,22 @@ ResponseMetadata& ResponseMetadata::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+ResponseMetadata& ResponseMetadata::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("RequestId"))
+      {
+        m_requestId = reader.ReadText();
+        m_requestIdHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void ResponseMetadata::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_requestIdHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/SendMessageBatchRequestEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -45,6 +46,19 @@ SendMessageBatchRequestEntry::SendMessageBatchRequestEntry(const XmlNode& xmlNod
   *this = xmlNode;
 }
 
+SendMessageBatchRequestEntry::SendMessageBatchRequestEntry(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_messageBodyHasBeenSet(false),
+    m_delaySeconds(0),
+    m_delaySecondsHasBeenSet(false),
+    m_messageAttributesHasBeenSet(false),
+    m_messageSystemAttributesHasBeenSet(false),
+    m_messageDeduplicationIdHasBeenSet(false),
+    m_messageGroupIdHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SendMessageBatchRequestEntry& SendMessageBatchRequestEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -116,6 +130,84 @@ SendMessageBatchRequestEntry& SendMessageBatchRequestEntry::operator =(const Xml
   return *this;
 }
 
+SendMessageBatchRequestEntry& SendMessageBatchRequestEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MessageBody"))
+      {
+        m_messageBody = reader.ReadText();
+        m_messageBodyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("DelaySeconds"))
+      {
+        m_delaySeconds = StringUtils::ConvertToInt32(StringUtils::Trim(reader.ReadText().c_str()).c_str());
+        m_delaySecondsHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MessageAttribute"))
+      {
+        if(reader.StartElement())
+        {
+          Aws::String messageAttributesKey;
+          MessageAttributeValue messageAttributesValue{};
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Name"))
+            {
+              messageAttributesKey = reader.ReadText();
+            }
+            else if(reader.NameEquals("Value"))
+            {
+              messageAttributesValue = reader;
+            }
+          }
+          m_messageAttributes[messageAttributesKey] = std::move(messageAttributesValue);
+        }
+        m_messageAttributesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MessageSystemAttribute"))
+      {
+        if(reader.StartElement())
+        {
+          Aws::String messageSystemAttributesKey;
+          MessageSystemAttributeValue messageSystemAttributesValue{};
+          while(reader.NextChild())
+          {
+            if(reader.NameEquals("Name"))
+            {
+              messageSystemAttributesKey = reader.ReadText();
+            }
+            else if(reader.NameEquals("Value"))
+            {
+              messageSystemAttributesValue = reader;
+            }
+          }
+          m_messageSystemAttributes[MessageSystemAttributeNameForSendsMapper::GetMessageSystemAttributeNameForSendsForName(StringUtils::Trim(messageSystemAttributesKey.c_str()))] = std::move(messageSystemAttributesValue);
+        }
+        m_messageSystemAttributesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MessageDeduplicationId"))
+      {
+        m_messageDeduplicationId = reader.ReadText();
+        m_messageDeduplicationIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MessageGroupId"))
+      {
+        m_messageGroupId = reader.ReadText();
+        m_messageGroupIdHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void SendMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_idHasBeenSet)
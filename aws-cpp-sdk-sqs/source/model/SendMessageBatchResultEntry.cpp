@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/SendMessageBatchResultEntry.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -41,6 +42,17 @@ SendMessageBatchResultEntry::SendMessageBatchResultEntry(const XmlNode& xmlNode)
   *this = xmlNode;
 }
 
+SendMessageBatchResultEntry::SendMessageBatchResultEntry(XmlReader& reader) : 
+    m_idHasBeenSet(false),
+    m_messageIdHasBeenSet(false),
+    m_mD5OfMessageBodyHasBeenSet(false),
+    m_mD5OfMessageAttributesHasBeenSet(false),
+    m_mD5OfMessageSystemAttributesHasBeenSet(false),
+    m_sequenceNumberHasBeenSet(false)
+{
+  *this = reader;
+}
+
 SendMessageBatchResultEntry& SendMessageBatchResultEntry::operator =(const XmlNode& xmlNode)
 {
   XmlNode resultNode = xmlNode;
@@ -88,6 +100,47 @@ SendMessageBatchResultEntry& SendMessageBatchResultEntry::operator =(const XmlNo
   return *this;
 }
 
+SendMessageBatchResultEntry& SendMessageBatchResultEntry::operator =(XmlReader& reader)
+{
+  if(reader.StartElement())
+  {
+    while(reader.NextChild())
+    {
+      if(reader.NameEquals("Id"))
+      {
+        m_id = reader.ReadText();
+        m_idHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MessageId"))
+      {
+        m_messageId = reader.ReadText();
+        m_messageIdHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MD5OfMessageBody"))
+      {
+        m_mD5OfMessageBody = reader.ReadText();
+        m_mD5OfMessageBodyHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MD5OfMessageAttributes"))
+      {
+        m_mD5OfMessageAttributes = reader.ReadText();
+        m_mD5OfMessageAttributesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("MD5OfMessageSystemAttributes"))
+      {
+        m_mD5OfMessageSystemAttributes = reader.ReadText();
+        m_mD5OfMessageSystemAttributesHasBeenSet = true;
+      }
+      else if(reader.NameEquals("SequenceNumber"))
+      {
+        m_sequenceNumber = reader.ReadText();
+        m_sequenceNumberHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 void SendMessageBatchResultEntry::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_idHasBeenSet)
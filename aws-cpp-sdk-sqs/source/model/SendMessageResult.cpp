@@ -5,6 +5,7 @@
 
 #include <aws/sqs/model/SendMessageResult.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
@@ -72,3 +73,67 @@ SendMessageResult& SendMessageResult::operator =(const Aws::AmazonWebServiceResu
   }
   return *this;
 }
+
+SendMessageResult::SendMessageResult(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  *this = result;
+}
+
+SendMessageResult& SendMessageResult::operator =(const Aws::AmazonWebServiceResult<XmlReader>& result)
+{
+  XmlReader reader(result.GetPayload());
+  if(reader.NextChild())
+  {
+    // Members are children of the root element if it is named after the result, or else of its child named after the result.
+    // The response metadata is a child of the root element.
+    const bool rootIsResultNode = reader.NameEquals("SendMessageResult");
+    bool inResultNode = rootIsResultNode;
+    reader.StartElement();
+    for(;;)
+    {
+      if(!reader.NextChild())
+      {
+        if(inResultNode && !rootIsResultNode)
+        {
+          inResultNode = false;
+          continue;
+        }
+        break;
+      }
+
+      if(reader.NameEquals("ResponseMetadata"))
+      {
+        m_responseMetadata = reader;
+      }
+      else if(!inResultNode && reader.NameEquals("SendMessageResult"))
+      {
+        inResultNode = reader.StartElement();
+      }
+      else if(inResultNode)
+      {
+        if(reader.NameEquals("MD5OfMessageBody"))
+        {
+          m_mD5OfMessageBody = reader.ReadText();
+        }
+        else if(reader.NameEquals("MD5OfMessageAttributes"))
+        {
+          m_mD5OfMessageAttributes = reader.ReadText();
+        }
+        else if(reader.NameEquals("MD5OfMessageSystemAttributes"))
+        {
+          m_mD5OfMessageSystemAttributes = reader.ReadText();
+        }
+        else if(reader.NameEquals("MessageId"))
+        {
+          m_messageId = reader.ReadText();
+        }
+        else if(reader.NameEquals("SequenceNumber"))
+        {
+          m_sequenceNumber = reader.ReadText();
+        }
+      }
+    }
+    AWS_LOGSTREAM_DEBUG("Aws::SQS::Model::SendMessageResult", "x-amzn-request-id: " << m_responseMetadata.GetRequestId() );
+  }
+  return *this;
+}
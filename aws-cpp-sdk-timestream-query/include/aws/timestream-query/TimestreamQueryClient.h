@@ -16,7 +16,7 @@
 #include <aws/timestream-query/model/QueryResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
-#include <aws/core/utils/ConcurrentCache.h>
+#include <aws/core/client/EndpointDiscoveryCache.h>
 #include <future>
 #include <functional>
 
@@ -241,10 +241,11 @@ namespace Model
         void QueryAsyncHelper(const Model::QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
 
       Aws::String m_uri;
-      mutable Aws::Utils::ConcurrentCache<Aws::String, Aws::String> m_endpointsCache;
       bool m_enableEndpointDiscovery;
       Aws::String m_configScheme;
       std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+      // Declared last, so background refreshes calling back into the client finish before other members are destroyed.
+      mutable Aws::Client::EndpointDiscoveryCache m_endpointsCache;
   };
 
 } // namespace TimestreamQuery
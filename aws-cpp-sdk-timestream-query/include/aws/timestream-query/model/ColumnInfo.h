@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamQuery
@@ -37,6 +38,8 @@ namespace Model
     ColumnInfo();
     ColumnInfo(Aws::Utils::Json::JsonView jsonValue);
     ColumnInfo& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ColumnInfo(Aws::Utils::Json::JsonReader& reader);
+    ColumnInfo& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -20,6 +20,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamQuery
@@ -40,6 +41,8 @@ namespace Model
     Datum();
     Datum(Aws::Utils::Json::JsonView jsonValue);
     Datum& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Datum(Aws::Utils::Json::JsonReader& reader);
+    Datum& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -22,6 +22,7 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamQuery
@@ -34,6 +35,8 @@ namespace Model
     QueryResult();
     QueryResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     QueryResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    QueryResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonReader>& result);
+    QueryResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonReader>& result);
 
 
     /**
@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamQuery
@@ -33,6 +34,8 @@ namespace Model
     QueryStatus();
     QueryStatus(Aws::Utils::Json::JsonView jsonValue);
     QueryStatus& operator=(Aws::Utils::Json::JsonView jsonValue);
+    QueryStatus(Aws::Utils::Json::JsonReader& reader);
+    QueryStatus& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
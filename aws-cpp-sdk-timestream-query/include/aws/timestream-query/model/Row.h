@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamQuery
@@ -35,6 +36,8 @@ namespace Model
     Row();
     Row(Aws::Utils::Json::JsonView jsonValue);
     Row& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Row(Aws::Utils::Json::JsonReader& reader);
+    Row& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
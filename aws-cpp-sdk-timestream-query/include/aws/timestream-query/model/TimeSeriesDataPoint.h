@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamQuery
@@ -40,6 +41,8 @@ namespace Model
     TimeSeriesDataPoint();
     TimeSeriesDataPoint(Aws::Utils::Json::JsonView jsonValue);
     TimeSeriesDataPoint& operator=(Aws::Utils::Json::JsonView jsonValue);
+    TimeSeriesDataPoint(Aws::Utils::Json::JsonReader& reader);
+    TimeSeriesDataPoint& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamQuery
@@ -41,6 +42,8 @@ namespace Model
     Type();
     Type(Aws::Utils::Json::JsonView jsonValue);
     Type& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Type(Aws::Utils::Json::JsonReader& reader);
+    Type& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -12,6 +12,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -90,6 +91,7 @@ void TimestreamQueryClient::init(const ClientConfiguration& config)
   else
   {
     m_enableEndpointDiscovery = config.enableEndpointDiscovery;
+    m_endpointsCache.SetExecutor(m_executor);
   }
 }
 
@@ -112,35 +114,36 @@ CancelQueryOutcome TimestreamQueryClient::CancelQuery(const CancelQueryRequest&
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("CancelQuery", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("CancelQuery", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CancelQuery", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CancelQuery", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("CancelQuery", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return CancelQueryOutcome(Aws::Client::AWSError<TimestreamQueryErrors>(TimestreamQueryErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CancelQuery", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CancelQuery", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return CancelQueryOutcome(Aws::Client::AWSError<TimestreamQueryErrors>(TimestreamQueryErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return CancelQueryOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return CancelQueryOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 CancelQueryOutcomeCallable TimestreamQueryClient::CancelQueryCallable(const CancelQueryRequest& request) const
@@ -158,7 +161,49 @@ void TimestreamQueryClient::CancelQueryAsync(const CancelQueryRequest& request,
 
 void TimestreamQueryClient::CancelQueryAsyncHelper(const CancelQueryRequest& request, const CancelQueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CancelQuery(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CancelQuery(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CancelQuery", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("CancelQuery", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CancelQuery", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CancelQuery", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, CancelQueryOutcome(Aws::Client::AWSError<TimestreamQueryErrors>(TimestreamQueryErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CancelQueryRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, CancelQueryOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeEndpointsOutcome TimestreamQueryClient::DescribeEndpoints(const DescribeEndpointsRequest& request) const
@@ -167,7 +212,7 @@ DescribeEndpointsOutcome TimestreamQueryClient::DescribeEndpoints(const Describe
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeEndpointsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeEndpointsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeEndpointsOutcomeCallable TimestreamQueryClient::DescribeEndpointsCallable(const DescribeEndpointsRequest& request) const
@@ -185,7 +230,19 @@ void TimestreamQueryClient::DescribeEndpointsAsync(const DescribeEndpointsReques
 
 void TimestreamQueryClient::DescribeEndpointsAsyncHelper(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeEndpoints(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeEndpoints(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeEndpointsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeEndpointsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 QueryOutcome TimestreamQueryClient::Query(const QueryRequest& request) const
@@ -194,35 +251,36 @@ QueryOutcome TimestreamQueryClient::Query(const QueryRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("Query", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("Query", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("Query", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("Query", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("Query", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return QueryOutcome(Aws::Client::AWSError<TimestreamQueryErrors>(TimestreamQueryErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("Query", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("Query", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return QueryOutcome(Aws::Client::AWSError<TimestreamQueryErrors>(TimestreamQueryErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return QueryOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return QueryOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 QueryOutcomeCallable TimestreamQueryClient::QueryCallable(const QueryRequest& request) const
@@ -240,6 +298,48 @@ void TimestreamQueryClient::QueryAsync(const QueryRequest& request, const QueryR
 
 void TimestreamQueryClient::QueryAsyncHelper(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, Query(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, Query(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("Query", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("Query", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("Query", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("Query", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, QueryOutcome(Aws::Client::AWSError<TimestreamQueryErrors>(TimestreamQueryErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<QueryRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, QueryOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/CancelQueryResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ CancelQueryResult& CancelQueryResult::operator =(const Aws::AmazonWebServiceResu
 
 
 
+  return *this;
+}
+
+CancelQueryResult::CancelQueryResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+CancelQueryResult& CancelQueryResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("CancellationMessage"))
+      {
+        m_cancellationMessage = reader.ReadString();
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/ColumnInfo.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/timestream-query/model/Type.h>
 
 #include <utility>
@@ -32,6 +33,13 @@ ColumnInfo::ColumnInfo(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+ColumnInfo::ColumnInfo(JsonReader& reader) : 
+    m_nameHasBeenSet(false),
+    m_typeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 const Type& ColumnInfo::GetType() const{ return *m_type; }
 bool ColumnInfo::TypeHasBeenSet() const { return m_typeHasBeenSet; }
 void ColumnInfo::SetType(const Type& value) { m_typeHasBeenSet = true; m_type = Aws::MakeShared<Type>("ColumnInfo", value); }
@@ -58,6 +66,27 @@ ColumnInfo& ColumnInfo::operator =(JsonView jsonValue)
   return *this;
 }
 
+ColumnInfo& ColumnInfo::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Name"))
+      {
+        m_name = reader.ReadString();
+        m_nameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Type"))
+      {
+        m_type = Aws::MakeShared<Type>("ColumnInfo", reader);
+        m_typeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue ColumnInfo::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/Datum.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/timestream-query/model/Row.h>
 
 #include <utility>
@@ -40,6 +41,17 @@ Datum::Datum(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Datum::Datum(JsonReader& reader) : 
+    m_scalarValueHasBeenSet(false),
+    m_timeSeriesValueHasBeenSet(false),
+    m_arrayValueHasBeenSet(false),
+    m_rowValueHasBeenSet(false),
+    m_nullValue(false),
+    m_nullValueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 const Row& Datum::GetRowValue() const{ return *m_rowValue; }
 bool Datum::RowValueHasBeenSet() const { return m_rowValueHasBeenSet; }
 void Datum::SetRowValue(const Row& value) { m_rowValueHasBeenSet = true; m_rowValue = Aws::MakeShared<Row>("Datum", value); }
@@ -93,6 +105,54 @@ Datum& Datum::operator =(JsonView jsonValue)
   return *this;
 }
 
+Datum& Datum::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ScalarValue"))
+      {
+        m_scalarValue = reader.ReadString();
+        m_scalarValueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TimeSeriesValue"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_timeSeriesValue.push_back(reader);
+          }
+        }
+        m_timeSeriesValueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ArrayValue"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_arrayValue.push_back(reader);
+          }
+        }
+        m_arrayValueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("RowValue"))
+      {
+        m_rowValue = Aws::MakeShared<Row>("Datum", reader);
+        m_rowValueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("NullValue"))
+      {
+        m_nullValue = reader.ReadBool();
+        m_nullValueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Datum::Jsonize() const
 {
   JsonValue payload;
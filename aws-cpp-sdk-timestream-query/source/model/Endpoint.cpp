@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/Endpoint.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -33,6 +34,14 @@ Endpoint::Endpoint(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Endpoint::Endpoint(JsonReader& reader) : 
+    m_addressHasBeenSet(false),
+    m_cachePeriodInMinutes(0),
+    m_cachePeriodInMinutesHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Endpoint& Endpoint::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Address"))
@@ -52,6 +61,27 @@ Endpoint& Endpoint::operator =(JsonView jsonValue)
   return *this;
 }
 
+Endpoint& Endpoint::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Address"))
+      {
+        m_address = reader.ReadString();
+        m_addressHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CachePeriodInMinutes"))
+      {
+        m_cachePeriodInMinutes = reader.ReadInt64();
+        m_cachePeriodInMinutesHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Endpoint::Jsonize() const
 {
   JsonValue payload;
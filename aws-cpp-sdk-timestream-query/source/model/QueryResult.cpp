@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/QueryResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -66,5 +67,56 @@ QueryResult& QueryResult::operator =(const Aws::AmazonWebServiceResult<JsonValue
 
 
 
+  return *this;
+}
+
+QueryResult::QueryResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+QueryResult& QueryResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("QueryId"))
+      {
+        m_queryId = reader.ReadString();
+      }
+      else if(reader.KeyEquals("NextToken"))
+      {
+        m_nextToken = reader.ReadString();
+      }
+      else if(reader.KeyEquals("Rows"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_rows.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("ColumnInfo"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_columnInfo.push_back(reader);
+          }
+        }
+      }
+      else if(reader.KeyEquals("QueryStatus"))
+      {
+        m_queryStatus = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/QueryStatus.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -39,6 +40,17 @@ QueryStatus::QueryStatus(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+QueryStatus::QueryStatus(JsonReader& reader) : 
+    m_progressPercentage(0.0),
+    m_progressPercentageHasBeenSet(false),
+    m_cumulativeBytesScanned(0),
+    m_cumulativeBytesScannedHasBeenSet(false),
+    m_cumulativeBytesMetered(0),
+    m_cumulativeBytesMeteredHasBeenSet(false)
+{
+  *this = reader;
+}
+
 QueryStatus& QueryStatus::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("ProgressPercentage"))
@@ -65,6 +77,32 @@ QueryStatus& QueryStatus::operator =(JsonView jsonValue)
   return *this;
 }
 
+QueryStatus& QueryStatus::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ProgressPercentage"))
+      {
+        m_progressPercentage = reader.ReadDouble();
+        m_progressPercentageHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CumulativeBytesScanned"))
+      {
+        m_cumulativeBytesScanned = reader.ReadInt64();
+        m_cumulativeBytesScannedHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CumulativeBytesMetered"))
+      {
+        m_cumulativeBytesMetered = reader.ReadInt64();
+        m_cumulativeBytesMeteredHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue QueryStatus::Jsonize() const
 {
   JsonValue payload;
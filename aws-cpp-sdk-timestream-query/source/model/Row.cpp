@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/Row.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -29,6 +30,12 @@ Row::Row(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Row::Row(JsonReader& reader) : 
+    m_dataHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Row& Row::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Data"))
@@ -44,6 +51,28 @@ Row& Row::operator =(JsonView jsonValue)
   return *this;
 }
 
+Row& Row::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Data"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_data.push_back(reader);
+          }
+        }
+        m_dataHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Row::Jsonize() const
 {
   JsonValue payload;
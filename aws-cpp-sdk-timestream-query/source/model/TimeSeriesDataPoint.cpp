@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/TimeSeriesDataPoint.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/timestream-query/model/Datum.h>
 
 #include <utility>
@@ -32,6 +33,13 @@ TimeSeriesDataPoint::TimeSeriesDataPoint(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+TimeSeriesDataPoint::TimeSeriesDataPoint(JsonReader& reader) : 
+    m_timeHasBeenSet(false),
+    m_valueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 const Datum& TimeSeriesDataPoint::GetValue() const{ return *m_value; }
 bool TimeSeriesDataPoint::ValueHasBeenSet() const { return m_valueHasBeenSet; }
 void TimeSeriesDataPoint::SetValue(const Datum& value) { m_valueHasBeenSet = true; m_value = Aws::MakeShared<Datum>("TimeSeriesDataPoint", value); }
@@ -58,6 +66,27 @@ TimeSeriesDataPoint& TimeSeriesDataPoint::operator =(JsonView jsonValue)
   return *this;
 }
 
+TimeSeriesDataPoint& TimeSeriesDataPoint::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Time"))
+      {
+        m_time = reader.ReadString();
+        m_timeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Value"))
+      {
+        m_value = Aws::MakeShared<Datum>("TimeSeriesDataPoint", reader);
+        m_valueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue TimeSeriesDataPoint::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-query/model/Type.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/timestream-query/model/ColumnInfo.h>
 
 #include <utility>
@@ -38,6 +39,16 @@ Type::Type(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Type::Type(JsonReader& reader) : 
+    m_scalarType(ScalarType::NOT_SET),
+    m_scalarTypeHasBeenSet(false),
+    m_arrayColumnInfoHasBeenSet(false),
+    m_timeSeriesMeasureValueColumnInfoHasBeenSet(false),
+    m_rowColumnInfoHasBeenSet(false)
+{
+  *this = reader;
+}
+
 const ColumnInfo& Type::GetArrayColumnInfo() const{ return *m_arrayColumnInfo; }
 bool Type::ArrayColumnInfoHasBeenSet() const { return m_arrayColumnInfoHasBeenSet; }
 void Type::SetArrayColumnInfo(const ColumnInfo& value) { m_arrayColumnInfoHasBeenSet = true; m_arrayColumnInfo = Aws::MakeShared<ColumnInfo>("Type", value); }
@@ -88,6 +99,43 @@ Type& Type::operator =(JsonView jsonValue)
   return *this;
 }
 
+Type& Type::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("ScalarType"))
+      {
+        m_scalarType = ScalarTypeMapper::GetScalarTypeForName(reader.ReadString());
+        m_scalarTypeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ArrayColumnInfo"))
+      {
+        m_arrayColumnInfo = Aws::MakeShared<ColumnInfo>("Type", reader);
+        m_arrayColumnInfoHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TimeSeriesMeasureValueColumnInfo"))
+      {
+        m_timeSeriesMeasureValueColumnInfo = Aws::MakeShared<ColumnInfo>("Type", reader);
+        m_timeSeriesMeasureValueColumnInfoHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("RowColumnInfo"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_rowColumnInfo.push_back(reader);
+          }
+        }
+        m_rowColumnInfoHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Type::Jsonize() const
 {
   JsonValue payload;
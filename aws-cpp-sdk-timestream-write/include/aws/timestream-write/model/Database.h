@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamWrite
@@ -37,6 +38,8 @@ namespace Model
     Database();
     Database(Aws::Utils::Json::JsonView jsonValue);
     Database& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Database(Aws::Utils::Json::JsonReader& reader);
+    Database& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamWrite
@@ -37,6 +38,8 @@ namespace Model
     Dimension();
     Dimension(Aws::Utils::Json::JsonView jsonValue);
     Dimension& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Dimension(Aws::Utils::Json::JsonReader& reader);
+    Dimension& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
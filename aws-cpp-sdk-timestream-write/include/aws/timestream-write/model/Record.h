@@ -20,6 +20,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamWrite
@@ -46,6 +47,8 @@ namespace Model
     Record();
     Record(Aws::Utils::Json::JsonView jsonValue);
     Record& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Record(Aws::Utils::Json::JsonReader& reader);
+    Record& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
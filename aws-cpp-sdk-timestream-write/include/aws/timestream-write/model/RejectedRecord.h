@@ -16,6 +16,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamWrite
@@ -36,6 +37,8 @@ namespace Model
     RejectedRecord();
     RejectedRecord(Aws::Utils::Json::JsonView jsonValue);
     RejectedRecord& operator=(Aws::Utils::Json::JsonView jsonValue);
+    RejectedRecord(Aws::Utils::Json::JsonReader& reader);
+    RejectedRecord& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamWrite
@@ -44,6 +45,8 @@ namespace Model
     RejectedRecordsException();
     RejectedRecordsException(Aws::Utils::Json::JsonView jsonValue);
     RejectedRecordsException& operator=(Aws::Utils::Json::JsonView jsonValue);
+    RejectedRecordsException(Aws::Utils::Json::JsonReader& reader);
+    RejectedRecordsException& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamWrite
@@ -34,6 +35,8 @@ namespace Model
     RetentionProperties();
     RetentionProperties(Aws::Utils::Json::JsonView jsonValue);
     RetentionProperties& operator=(Aws::Utils::Json::JsonView jsonValue);
+    RetentionProperties(Aws::Utils::Json::JsonReader& reader);
+    RetentionProperties& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -19,6 +19,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace TimestreamWrite
@@ -39,6 +40,8 @@ namespace Model
     Table();
     Table(Aws::Utils::Json::JsonView jsonValue);
     Table& operator=(Aws::Utils::Json::JsonView jsonValue);
+    Table(Aws::Utils::Json::JsonReader& reader);
+    Table& operator=(Aws::Utils::Json::JsonReader& reader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
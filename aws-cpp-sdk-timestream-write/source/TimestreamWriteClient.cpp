@@ -12,6 +12,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/DNS.h>
@@ -102,6 +103,7 @@ void TimestreamWriteClient::init(const ClientConfiguration& config)
   else
   {
     m_enableEndpointDiscovery = config.enableEndpointDiscovery;
+    m_endpointsCache.SetExecutor(m_executor);
   }
 }
 
@@ -124,35 +126,36 @@ CreateDatabaseOutcome TimestreamWriteClient::CreateDatabase(const CreateDatabase
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("CreateDatabase", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("CreateDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("CreateDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return CreateDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return CreateDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return CreateDatabaseOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return CreateDatabaseOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 CreateDatabaseOutcomeCallable TimestreamWriteClient::CreateDatabaseCallable(const CreateDatabaseRequest& request) const
@@ -170,7 +173,49 @@ void TimestreamWriteClient::CreateDatabaseAsync(const CreateDatabaseRequest& req
 
 void TimestreamWriteClient::CreateDatabaseAsyncHelper(const CreateDatabaseRequest& request, const CreateDatabaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateDatabase(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CreateDatabase(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("CreateDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, CreateDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateDatabaseRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, CreateDatabaseOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 CreateTableOutcome TimestreamWriteClient::CreateTable(const CreateTableRequest& request) const
@@ -179,35 +224,36 @@ CreateTableOutcome TimestreamWriteClient::CreateTable(const CreateTableRequest&
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("CreateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return CreateTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return CreateTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return CreateTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return CreateTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 CreateTableOutcomeCallable TimestreamWriteClient::CreateTableCallable(const CreateTableRequest& request) const
@@ -225,7 +271,49 @@ void TimestreamWriteClient::CreateTableAsync(const CreateTableRequest& request,
 
 void TimestreamWriteClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, CreateTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("CreateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, CreateTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, CreateTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DeleteDatabaseOutcome TimestreamWriteClient::DeleteDatabase(const DeleteDatabaseRequest& request) const
@@ -234,35 +322,36 @@ DeleteDatabaseOutcome TimestreamWriteClient::DeleteDatabase(const DeleteDatabase
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("DeleteDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return DeleteDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return DeleteDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DeleteDatabaseOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DeleteDatabaseOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DeleteDatabaseOutcomeCallable TimestreamWriteClient::DeleteDatabaseCallable(const DeleteDatabaseRequest& request) const
@@ -280,7 +369,49 @@ void TimestreamWriteClient::DeleteDatabaseAsync(const DeleteDatabaseRequest& req
 
 void TimestreamWriteClient::DeleteDatabaseAsyncHelper(const DeleteDatabaseRequest& request, const DeleteDatabaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteDatabase(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteDatabase(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DeleteDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, DeleteDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteDatabaseRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteDatabaseOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DeleteTableOutcome TimestreamWriteClient::DeleteTable(const DeleteTableRequest& request) const
@@ -289,35 +420,36 @@ DeleteTableOutcome TimestreamWriteClient::DeleteTable(const DeleteTableRequest&
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("DeleteTable", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return DeleteTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return DeleteTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DeleteTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DeleteTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DeleteTableOutcomeCallable TimestreamWriteClient::DeleteTableCallable(const DeleteTableRequest& request) const
@@ -335,7 +467,49 @@ void TimestreamWriteClient::DeleteTableAsync(const DeleteTableRequest& request,
 
 void TimestreamWriteClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DeleteTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DeleteTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, DeleteTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DeleteTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeDatabaseOutcome TimestreamWriteClient::DescribeDatabase(const DescribeDatabaseRequest& request) const
@@ -344,35 +518,36 @@ DescribeDatabaseOutcome TimestreamWriteClient::DescribeDatabase(const DescribeDa
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("DescribeDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return DescribeDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return DescribeDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeDatabaseOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeDatabaseOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeDatabaseOutcomeCallable TimestreamWriteClient::DescribeDatabaseCallable(const DescribeDatabaseRequest& request) const
@@ -390,7 +565,49 @@ void TimestreamWriteClient::DescribeDatabaseAsync(const DescribeDatabaseRequest&
 
 void TimestreamWriteClient::DescribeDatabaseAsyncHelper(const DescribeDatabaseRequest& request, const DescribeDatabaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeDatabase(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeDatabase(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, DescribeDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeDatabaseRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeDatabaseOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeEndpointsOutcome TimestreamWriteClient::DescribeEndpoints(const DescribeEndpointsRequest& request) const
@@ -399,7 +616,7 @@ DescribeEndpointsOutcome TimestreamWriteClient::DescribeEndpoints(const Describe
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeEndpointsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeEndpointsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeEndpointsOutcomeCallable TimestreamWriteClient::DescribeEndpointsCallable(const DescribeEndpointsRequest& request) const
@@ -417,7 +634,19 @@ void TimestreamWriteClient::DescribeEndpointsAsync(const DescribeEndpointsReques
 
 void TimestreamWriteClient::DescribeEndpointsAsyncHelper(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeEndpoints(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeEndpoints(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeEndpointsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeEndpointsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 DescribeTableOutcome TimestreamWriteClient::DescribeTable(const DescribeTableRequest& request) const
@@ -426,35 +655,36 @@ DescribeTableOutcome TimestreamWriteClient::DescribeTable(const DescribeTableReq
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("DescribeTable", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return DescribeTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return DescribeTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return DescribeTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return DescribeTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 DescribeTableOutcomeCallable TimestreamWriteClient::DescribeTableCallable(const DescribeTableRequest& request) const
@@ -472,7 +702,49 @@ void TimestreamWriteClient::DescribeTableAsync(const DescribeTableRequest& reque
 
 void TimestreamWriteClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, DescribeTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("DescribeTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, DescribeTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, DescribeTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListDatabasesOutcome TimestreamWriteClient::ListDatabases(const ListDatabasesRequest& request) const
@@ -481,35 +753,36 @@ ListDatabasesOutcome TimestreamWriteClient::ListDatabases(const ListDatabasesReq
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("ListDatabases", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("ListDatabases", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListDatabases", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListDatabases", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("ListDatabases", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return ListDatabasesOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListDatabases", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListDatabases", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return ListDatabasesOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListDatabasesOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListDatabasesOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListDatabasesOutcomeCallable TimestreamWriteClient::ListDatabasesCallable(const ListDatabasesRequest& request) const
@@ -527,7 +800,49 @@ void TimestreamWriteClient::ListDatabasesAsync(const ListDatabasesRequest& reque
 
 void TimestreamWriteClient::ListDatabasesAsyncHelper(const ListDatabasesRequest& request, const ListDatabasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListDatabases(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListDatabases(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListDatabases", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("ListDatabases", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListDatabases", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListDatabases", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, ListDatabasesOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListDatabasesRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListDatabasesOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListTablesOutcome TimestreamWriteClient::ListTables(const ListTablesRequest& request) const
@@ -536,35 +851,36 @@ ListTablesOutcome TimestreamWriteClient::ListTables(const ListTablesRequest& req
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("ListTables", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("ListTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("ListTables", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return ListTablesOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTables", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return ListTablesOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListTablesOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListTablesOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListTablesOutcomeCallable TimestreamWriteClient::ListTablesCallable(const ListTablesRequest& request) const
@@ -582,7 +898,49 @@ void TimestreamWriteClient::ListTablesAsync(const ListTablesRequest& request, co
 
 void TimestreamWriteClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTables(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListTables(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("ListTables", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTables", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, ListTablesOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTablesRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListTablesOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 ListTagsForResourceOutcome TimestreamWriteClient::ListTagsForResource(const ListTagsForResourceRequest& request) const
@@ -591,35 +949,36 @@ ListTagsForResourceOutcome TimestreamWriteClient::ListTagsForResource(const List
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListTagsForResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("ListTagsForResource", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return ListTagsForResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return ListTagsForResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return ListTagsForResourceOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return ListTagsForResourceOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 ListTagsForResourceOutcomeCallable TimestreamWriteClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
@@ -637,7 +996,49 @@ void TimestreamWriteClient::ListTagsForResourceAsync(const ListTagsForResourceRe
 
 void TimestreamWriteClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTagsForResource(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, ListTagsForResource(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("ListTagsForResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("ListTagsForResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, ListTagsForResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsForResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, ListTagsForResourceOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 TagResourceOutcome TimestreamWriteClient::TagResource(const TagResourceRequest& request) const
@@ -646,35 +1047,36 @@ TagResourceOutcome TimestreamWriteClient::TagResource(const TagResourceRequest&
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("TagResource", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("TagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("TagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("TagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return TagResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return TagResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return TagResourceOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return TagResourceOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 TagResourceOutcomeCallable TimestreamWriteClient::TagResourceCallable(const TagResourceRequest& request) const
@@ -692,7 +1094,49 @@ void TimestreamWriteClient::TagResourceAsync(const TagResourceRequest& request,
 
 void TimestreamWriteClient::TagResourceAsyncHelper(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, TagResource(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, TagResource(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("TagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("TagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("TagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, TagResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, TagResourceOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UntagResourceOutcome TimestreamWriteClient::UntagResource(const UntagResourceRequest& request) const
@@ -701,35 +1145,36 @@ UntagResourceOutcome TimestreamWriteClient::UntagResource(const UntagResourceReq
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UntagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("UntagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return UntagResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return UntagResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UntagResourceOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UntagResourceOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UntagResourceOutcomeCallable TimestreamWriteClient::UntagResourceCallable(const UntagResourceRequest& request) const
@@ -747,7 +1192,49 @@ void TimestreamWriteClient::UntagResourceAsync(const UntagResourceRequest& reque
 
 void TimestreamWriteClient::UntagResourceAsyncHelper(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UntagResource(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UntagResource(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UntagResource", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, UntagResourceOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UntagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UntagResourceOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateDatabaseOutcome TimestreamWriteClient::UpdateDatabase(const UpdateDatabaseRequest& request) const
@@ -756,35 +1243,36 @@ UpdateDatabaseOutcome TimestreamWriteClient::UpdateDatabase(const UpdateDatabase
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("UpdateDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return UpdateDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return UpdateDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateDatabaseOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateDatabaseOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateDatabaseOutcomeCallable TimestreamWriteClient::UpdateDatabaseCallable(const UpdateDatabaseRequest& request) const
@@ -802,7 +1290,49 @@ void TimestreamWriteClient::UpdateDatabaseAsync(const UpdateDatabaseRequest& req
 
 void TimestreamWriteClient::UpdateDatabaseAsyncHelper(const UpdateDatabaseRequest& request, const UpdateDatabaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateDatabase(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateDatabase(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateDatabase", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateDatabase", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, UpdateDatabaseOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateDatabaseRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateDatabaseOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 UpdateTableOutcome TimestreamWriteClient::UpdateTable(const UpdateTableRequest& request) const
@@ -811,35 +1341,36 @@ UpdateTableOutcome TimestreamWriteClient::UpdateTable(const UpdateTableRequest&
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
-    {
-      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("UpdateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return UpdateTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return UpdateTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return UpdateTableOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return UpdateTableOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 UpdateTableOutcomeCallable TimestreamWriteClient::UpdateTableCallable(const UpdateTableRequest& request) const
@@ -857,7 +1388,49 @@ void TimestreamWriteClient::UpdateTableAsync(const UpdateTableRequest& request,
 
 void TimestreamWriteClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateTable(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, UpdateTable(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("UpdateTable", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, UpdateTableOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, UpdateTableOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 WriteRecordsOutcome TimestreamWriteClient::WriteRecords(const WriteRecordsRequest& request) const
@@ -866,35 +1439,36 @@ WriteRecordsOutcome TimestreamWriteClient::WriteRecords(const WriteRecordsReques
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
-    Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
     {
-      AWS_LOGSTREAM_TRACE("WriteRecords", "Making request to cached endpoint: " << endpoint);
-      uri = m_configScheme + "://" + endpoint;
-    }
-    else
-    {
-      AWS_LOGSTREAM_TRACE("WriteRecords", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("WriteRecords", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
       auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = m_configScheme + "://" + item.GetAddress();
-        AWS_LOGSTREAM_TRACE("WriteRecords", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
       {
         AWS_LOGSTREAM_ERROR("WriteRecords", "Failed to discover endpoints " << endpointOutcome.GetError());
-        return WriteRecordsOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
+        return false;
       }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("WriteRecords", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("WriteRecords", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      return WriteRecordsOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false));
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  return WriteRecordsOutcome(MakeRequest(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
+  return WriteRecordsOutcome(MakeRequestWithJsonReader(uri, request, Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
 }
 
 WriteRecordsOutcomeCallable TimestreamWriteClient::WriteRecordsCallable(const WriteRecordsRequest& request) const
@@ -912,6 +1486,48 @@ void TimestreamWriteClient::WriteRecordsAsync(const WriteRecordsRequest& request
 
 void TimestreamWriteClient::WriteRecordsAsyncHelper(const WriteRecordsRequest& request, const WriteRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, WriteRecords(request), context);
+  if (!SupportsAsyncRequests())
+  {
+    handler(this, request, WriteRecords(request), context);
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    Aws::String endpointKey = "Shared";
+    auto endpoint = m_endpointsCache.GetEndpoint(endpointKey, [this](Aws::String& discoveredEndpoint, std::chrono::milliseconds& cachePeriod)
+    {
+      DescribeEndpointsRequest endpointRequest;
+      AWS_LOGSTREAM_TRACE("WriteRecords", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
+      auto endpointOutcome = DescribeEndpoints(endpointRequest);
+      if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+      {
+        AWS_LOGSTREAM_ERROR("WriteRecords", "Failed to discover endpoints " << endpointOutcome.GetError());
+        return false;
+      }
+      const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+      discoveredEndpoint = m_configScheme + "://" + item.GetAddress();
+      cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+      AWS_LOGSTREAM_TRACE("WriteRecords", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+      return true;
+    });
+    if (endpoint)
+    {
+      AWS_LOGSTREAM_TRACE("WriteRecords", "Making request to cached endpoint: " << endpoint->GetAuthority());
+      uri = *endpoint;
+    }
+    else
+    {
+      handler(this, request, WriteRecordsOutcome(Aws::Client::AWSError<TimestreamWriteErrors>(TimestreamWriteErrors::RESOURCE_NOT_FOUND, "INVALID_ENDPOINT", "Failed to discover endpoint", false)), context);
+      return;
+    }
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<WriteRecordsRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithJsonReaderAsync(uri, sharedRequest, m_executor,
+      [this, sharedRequest, handler, context](Aws::Client::JsonReaderOutcome&& outcome){ handler(this, *sharedRequest, WriteRecordsOutcome(std::move(outcome)), context); },
+      Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
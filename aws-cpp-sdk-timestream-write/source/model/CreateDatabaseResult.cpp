@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/CreateDatabaseResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ CreateDatabaseResult& CreateDatabaseResult::operator =(const Aws::AmazonWebServi
 
 
 
+  return *this;
+}
+
+CreateDatabaseResult::CreateDatabaseResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+CreateDatabaseResult& CreateDatabaseResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Database"))
+      {
+        m_database = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/Database.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -41,6 +42,18 @@ Database::Database(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Database::Database(JsonReader& reader) : 
+    m_arnHasBeenSet(false),
+    m_databaseNameHasBeenSet(false),
+    m_tableCount(0),
+    m_tableCountHasBeenSet(false),
+    m_kmsKeyIdHasBeenSet(false),
+    m_creationTimeHasBeenSet(false),
+    m_lastUpdatedTimeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Database& Database::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Arn"))
@@ -88,6 +101,47 @@ Database& Database::operator =(JsonView jsonValue)
   return *this;
 }
 
+Database& Database::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Arn"))
+      {
+        m_arn = reader.ReadString();
+        m_arnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("DatabaseName"))
+      {
+        m_databaseName = reader.ReadString();
+        m_databaseNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableCount"))
+      {
+        m_tableCount = reader.ReadInt64();
+        m_tableCountHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("KmsKeyId"))
+      {
+        m_kmsKeyId = reader.ReadString();
+        m_kmsKeyIdHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CreationTime"))
+      {
+        m_creationTime = reader.ReadDouble();
+        m_creationTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LastUpdatedTime"))
+      {
+        m_lastUpdatedTime = reader.ReadDouble();
+        m_lastUpdatedTimeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Database::Jsonize() const
 {
   JsonValue payload;
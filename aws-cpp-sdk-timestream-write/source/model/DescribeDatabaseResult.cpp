@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/DescribeDatabaseResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ DescribeDatabaseResult& DescribeDatabaseResult::operator =(const Aws::AmazonWebS
 
 
 
+  return *this;
+}
+
+DescribeDatabaseResult::DescribeDatabaseResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+DescribeDatabaseResult& DescribeDatabaseResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Database"))
+      {
+        m_database = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/Dimension.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ Dimension::Dimension(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Dimension::Dimension(JsonReader& reader) : 
+    m_nameHasBeenSet(false),
+    m_valueHasBeenSet(false),
+    m_dimensionValueType(DimensionValueType::NOT_SET),
+    m_dimensionValueTypeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Dimension& Dimension::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Name"))
@@ -61,6 +71,32 @@ Dimension& Dimension::operator =(JsonView jsonValue)
   return *this;
 }
 
+Dimension& Dimension::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Name"))
+      {
+        m_name = reader.ReadString();
+        m_nameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Value"))
+      {
+        m_value = reader.ReadString();
+        m_valueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("DimensionValueType"))
+      {
+        m_dimensionValueType = DimensionValueTypeMapper::GetDimensionValueTypeForName(reader.ReadString());
+        m_dimensionValueTypeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Dimension::Jsonize() const
 {
   JsonValue payload;
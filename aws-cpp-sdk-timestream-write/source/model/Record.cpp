@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/Record.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -47,6 +48,21 @@ Record::Record(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Record::Record(JsonReader& reader) : 
+    m_dimensionsHasBeenSet(false),
+    m_measureNameHasBeenSet(false),
+    m_measureValueHasBeenSet(false),
+    m_measureValueType(MeasureValueType::NOT_SET),
+    m_measureValueTypeHasBeenSet(false),
+    m_timeHasBeenSet(false),
+    m_timeUnit(TimeUnit::NOT_SET),
+    m_timeUnitHasBeenSet(false),
+    m_version(0),
+    m_versionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Record& Record::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Dimensions"))
@@ -104,6 +120,58 @@ Record& Record::operator =(JsonView jsonValue)
   return *this;
 }
 
+Record& Record::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Dimensions"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_dimensions.push_back(reader);
+          }
+        }
+        m_dimensionsHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("MeasureName"))
+      {
+        m_measureName = reader.ReadString();
+        m_measureNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("MeasureValue"))
+      {
+        m_measureValue = reader.ReadString();
+        m_measureValueHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("MeasureValueType"))
+      {
+        m_measureValueType = MeasureValueTypeMapper::GetMeasureValueTypeForName(reader.ReadString());
+        m_measureValueTypeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Time"))
+      {
+        m_time = reader.ReadString();
+        m_timeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TimeUnit"))
+      {
+        m_timeUnit = TimeUnitMapper::GetTimeUnitForName(reader.ReadString());
+        m_timeUnitHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Version"))
+      {
+        m_version = reader.ReadInt64();
+        m_versionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Record::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/RejectedRecord.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -37,6 +38,16 @@ RejectedRecord::RejectedRecord(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+RejectedRecord::RejectedRecord(JsonReader& reader) : 
+    m_recordIndex(0),
+    m_recordIndexHasBeenSet(false),
+    m_reasonHasBeenSet(false),
+    m_existingVersion(0),
+    m_existingVersionHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RejectedRecord& RejectedRecord::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("RecordIndex"))
@@ -63,6 +74,32 @@ RejectedRecord& RejectedRecord::operator =(JsonView jsonValue)
   return *this;
 }
 
+RejectedRecord& RejectedRecord::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("RecordIndex"))
+      {
+        m_recordIndex = reader.ReadInteger();
+        m_recordIndexHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Reason"))
+      {
+        m_reason = reader.ReadString();
+        m_reasonHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("ExistingVersion"))
+      {
+        m_existingVersion = reader.ReadInt64();
+        m_existingVersionHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue RejectedRecord::Jsonize() const
 {
   JsonValue payload;
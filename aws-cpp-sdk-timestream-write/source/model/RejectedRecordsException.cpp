@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/RejectedRecordsException.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ RejectedRecordsException::RejectedRecordsException(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+RejectedRecordsException::RejectedRecordsException(JsonReader& reader) : 
+    m_messageHasBeenSet(false),
+    m_rejectedRecordsHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RejectedRecordsException& RejectedRecordsException::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Message"))
@@ -53,6 +61,33 @@ RejectedRecordsException& RejectedRecordsException::operator =(JsonView jsonValu
   return *this;
 }
 
+RejectedRecordsException& RejectedRecordsException::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Message"))
+      {
+        m_message = reader.ReadString();
+        m_messageHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("RejectedRecords"))
+      {
+        if(reader.StartArray())
+        {
+          while(reader.NextElement())
+          {
+            m_rejectedRecords.push_back(reader);
+          }
+        }
+        m_rejectedRecordsHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue RejectedRecordsException::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/RetentionProperties.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -35,6 +36,15 @@ RetentionProperties::RetentionProperties(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+RetentionProperties::RetentionProperties(JsonReader& reader) : 
+    m_memoryStoreRetentionPeriodInHours(0),
+    m_memoryStoreRetentionPeriodInHoursHasBeenSet(false),
+    m_magneticStoreRetentionPeriodInDays(0),
+    m_magneticStoreRetentionPeriodInDaysHasBeenSet(false)
+{
+  *this = reader;
+}
+
 RetentionProperties& RetentionProperties::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("MemoryStoreRetentionPeriodInHours"))
@@ -54,6 +64,27 @@ RetentionProperties& RetentionProperties::operator =(JsonView jsonValue)
   return *this;
 }
 
+RetentionProperties& RetentionProperties::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("MemoryStoreRetentionPeriodInHours"))
+      {
+        m_memoryStoreRetentionPeriodInHours = reader.ReadInt64();
+        m_memoryStoreRetentionPeriodInHoursHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("MagneticStoreRetentionPeriodInDays"))
+      {
+        m_magneticStoreRetentionPeriodInDays = reader.ReadInt64();
+        m_magneticStoreRetentionPeriodInDaysHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue RetentionProperties::Jsonize() const
 {
   JsonValue payload;
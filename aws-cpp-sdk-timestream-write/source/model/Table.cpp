@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/Table.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -43,6 +44,19 @@ Table::Table(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Table::Table(JsonReader& reader) : 
+    m_arnHasBeenSet(false),
+    m_tableNameHasBeenSet(false),
+    m_databaseNameHasBeenSet(false),
+    m_tableStatus(TableStatus::NOT_SET),
+    m_tableStatusHasBeenSet(false),
+    m_retentionPropertiesHasBeenSet(false),
+    m_creationTimeHasBeenSet(false),
+    m_lastUpdatedTimeHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Table& Table::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Arn"))
@@ -97,6 +111,52 @@ Table& Table::operator =(JsonView jsonValue)
   return *this;
 }
 
+Table& Table::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Arn"))
+      {
+        m_arn = reader.ReadString();
+        m_arnHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableName"))
+      {
+        m_tableName = reader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("DatabaseName"))
+      {
+        m_databaseName = reader.ReadString();
+        m_databaseNameHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("TableStatus"))
+      {
+        m_tableStatus = TableStatusMapper::GetTableStatusForName(reader.ReadString());
+        m_tableStatusHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("RetentionProperties"))
+      {
+        m_retentionProperties = reader;
+        m_retentionPropertiesHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("CreationTime"))
+      {
+        m_creationTime = reader.ReadDouble();
+        m_creationTimeHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("LastUpdatedTime"))
+      {
+        m_lastUpdatedTime = reader.ReadDouble();
+        m_lastUpdatedTimeHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Table::Jsonize() const
 {
   JsonValue payload;
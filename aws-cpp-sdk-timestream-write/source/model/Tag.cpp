@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/Tag.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -31,6 +32,13 @@ Tag::Tag(JsonView jsonValue) :
   *this = jsonValue;
 }
 
+Tag::Tag(JsonReader& reader) : 
+    m_keyHasBeenSet(false),
+    m_valueHasBeenSet(false)
+{
+  *this = reader;
+}
+
 Tag& Tag::operator =(JsonView jsonValue)
 {
   if(jsonValue.ValueExists("Key"))
@@ -50,6 +58,27 @@ Tag& Tag::operator =(JsonView jsonValue)
   return *this;
 }
 
+Tag& Tag::operator =(JsonReader& reader)
+{
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Key"))
+      {
+        m_key = reader.ReadString();
+        m_keyHasBeenSet = true;
+      }
+      else if(reader.KeyEquals("Value"))
+      {
+        m_value = reader.ReadString();
+        m_valueHasBeenSet = true;
+      }
+    }
+  }
+  return *this;
+}
+
 JsonValue Tag::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/TagResourceResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -30,5 +31,18 @@ TagResourceResult& TagResourceResult::operator =(const Aws::AmazonWebServiceResu
   AWS_UNREFERENCED_PARAM(result);
 
 
+  return *this;
+}
+
+TagResourceResult::TagResourceResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+TagResourceResult& TagResourceResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  AWS_UNREFERENCED_PARAM(result);
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/UntagResourceResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -30,5 +31,18 @@ UntagResourceResult& UntagResourceResult::operator =(const Aws::AmazonWebService
   AWS_UNREFERENCED_PARAM(result);
 
 
+  return *this;
+}
+
+UntagResourceResult::UntagResourceResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UntagResourceResult& UntagResourceResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  AWS_UNREFERENCED_PARAM(result);
+
+
   return *this;
 }
@@ -5,6 +5,7 @@
 
 #include <aws/timestream-write/model/UpdateDatabaseResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -36,5 +37,28 @@ UpdateDatabaseResult& UpdateDatabaseResult::operator =(const Aws::AmazonWebServi
 
 
 
+  return *this;
+}
+
+UpdateDatabaseResult::UpdateDatabaseResult(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  *this = result;
+}
+
+UpdateDatabaseResult& UpdateDatabaseResult::operator =(const Aws::AmazonWebServiceResult<JsonReader>& result)
+{
+  JsonReader reader(result.GetPayload());
+  if(reader.StartObject())
+  {
+    while(reader.NextMember())
+    {
+      if(reader.KeyEquals("Database"))
+      {
+        m_database = reader;
+      }
+    }
+  }
+
+
   return *this;
 }
@@ -44,6 +44,7 @@ using namespace Aws::Utils;
 
 static const char* MULTI_PART_CONTENT_KEY = "MultiContentKey";
 static const char* MULTI_PART_CONTENT_TEXT = "This is a test..##";
+static const char* MEMORY_MAPPED_CONTENT_KEY = "MemoryMappedContentKey";
 
 static const char* CONTENT_TEST_FILE_TEXT = "This is a test..";
 static const char* CONTENT_TEST_FILE_NAME = "ContentTransferTestFile.txt";
@@ -949,7 +950,7 @@ TEST_F(TransferTests, TransferManager_DirectoryUploadAndDownloadTest)
     transferManagerConfig.transferInitiatedCallback = transferInitCallback;
     auto transferManager = TransferManager::Create(transferManagerConfig);
 
-    transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "nestedTest", Aws::Map<Aws::String, Aws::String>());
+    auto directoryUpload = transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "nestedTest", Aws::Map<Aws::String, Aws::String>());
 
     {
         std::unique_lock<std::mutex> locker(semaphoreLock);
@@ -981,8 +982,15 @@ TEST_F(TransferTests, TransferManager_DirectoryUploadAndDownloadTest)
             Aws::Map<Aws::String, Aws::String>());
     }
 
+    directoryUpload->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, directoryUpload->GetStatus());
+    ASSERT_EQ(4u, directoryUpload->GetFilesInitiated());
+    ASSERT_EQ(4u, directoryUpload->GetFilesCompleted());
+    ASSERT_EQ(0u, directoryUpload->GetFilesInProgress());
+    ASSERT_EQ(directoryUpload->GetBytesTotalSize(), directoryUpload->GetBytesTransferred());
+
     auto downloadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), "dirDownload");
-    transferManager->DownloadToDirectory(downloadDir, GetTestBucketName(), "nestedTest");
+    auto directoryDownload = transferManager->DownloadToDirectory(downloadDir, GetTestBucketName(), "nestedTest");
 
     {
         std::unique_lock<std::mutex> locker(semaphoreLock);
@@ -1002,6 +1010,12 @@ TEST_F(TransferTests, TransferManager_DirectoryUploadAndDownloadTest)
         EXPECT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
     }
 
+    directoryDownload->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, directoryDownload->GetStatus());
+    ASSERT_EQ(4u, directoryDownload->GetFilesCompleted());
+    ASSERT_EQ(directoryUpload->GetBytesTotalSize(), directoryDownload->GetBytesTotalSize());
+    ASSERT_EQ(directoryDownload->GetBytesTotalSize(), directoryDownload->GetBytesTransferred());
+
     Aws::FileSystem::DirectoryTree uploadTree(uploadDir);
     Aws::FileSystem::DirectoryTree downloadTree(downloadDir);
     ASSERT_EQ(uploadTree, downloadTree);
@@ -1060,6 +1074,94 @@ TEST_F(TransferTests, TransferManager_MediumTest)
                        Aws::Map<Aws::String, Aws::String>());
 }
 
+TEST_F(TransferTests, TransferManager_DownloadPartsToFileTest)
+{
+    const Aws::String RandomFileName = Aws::Utils::UUID::RandomUUID();
+    Aws::String mediumTestFilePath = MakeFilePath(RandomFileName.c_str());
+    ScopedTestFile testFile(mediumTestFilePath, MEDIUM_TEST_SIZE, testString);
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    std::shared_ptr<TransferHandle> uploadPtr = transferManager->UploadFile(mediumTestFilePath, GetTestBucketName(), RandomFileName, "text/plain", Aws::Map<Aws::String, Aws::String>());
+    uploadPtr->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, uploadPtr->GetStatus());
+    ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), RandomFileName.c_str()));
+
+    for (bool useDirectIO : {false, true})
+    {
+        Aws::String downloadFileName = MakeDownloadFileName(mediumTestFilePath);
+        DownloadConfiguration downloadConfig;
+        downloadConfig.writePartsToFile = true;
+        downloadConfig.useDirectIO = useDirectIO;
+
+        std::shared_ptr<TransferHandle> downloadPtr = transferManager->DownloadFile(GetTestBucketName(), RandomFileName, downloadFileName, downloadConfig);
+        downloadPtr->WaitUntilFinished();
+
+        size_t retries = 0;
+        //just make sure we don't fail because a part failed to download. (e.g. network problems or interuptions)
+        while (downloadPtr->GetStatus() == TransferStatus::FAILED && retries++ < 5)
+        {
+            transferManager->RetryDownload(downloadPtr);
+            downloadPtr->WaitUntilFinished();
+        }
+
+        ASSERT_TRUE(downloadPtr->IsMultipart());
+        ASSERT_EQ(TransferStatus::COMPLETED, downloadPtr->GetStatus());
+        ASSERT_EQ(PARTS_IN_MEDIUM_TEST, downloadPtr->GetCompletedParts().size());
+        ASSERT_EQ(downloadPtr->GetBytesTotalSize(), downloadPtr->GetBytesTransferred());
+        ASSERT_TRUE(AreFilesSame(downloadFileName, mediumTestFilePath));
+
+        Aws::FileSystem::RemoveFileIfExists(downloadFileName.c_str());
+    }
+}
+
+TEST_F(TransferTests, TransferManager_DownloadPartsToFileErrorTest)
+{
+    const Aws::String RandomFileName = Aws::Utils::UUID::RandomUUID();
+    Aws::String mediumTestFilePath = MakeFilePath(RandomFileName.c_str());
+    ScopedTestFile testFile(mediumTestFilePath, MEDIUM_TEST_SIZE, testString);
+
+    TransferManagerConfiguration uploadManagerConfig(m_executor.get());
+    uploadManagerConfig.s3Client = m_s3Client;
+    auto uploadManager = TransferManager::Create(uploadManagerConfig);
+
+    std::shared_ptr<TransferHandle> uploadPtr = uploadManager->UploadFile(mediumTestFilePath, GetTestBucketName(), RandomFileName, "text/plain", Aws::Map<Aws::String, Aws::String>());
+    uploadPtr->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, uploadPtr->GetStatus());
+    ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), RandomFileName.c_str()));
+
+    // The ranged GETs fail with 412, their error bodies must be parsed rather than written into the file.
+    GetObjectRequest getObjReqTemplate;
+    getObjReqTemplate.SetIfMatch("\"00000000000000000000000000000000\"");
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    transferManagerConfig.getObjectTemplate = getObjReqTemplate;
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    for (bool useDirectIO : {false, true})
+    {
+        Aws::String downloadFileName = MakeDownloadFileName(mediumTestFilePath);
+        DownloadConfiguration downloadConfig;
+        downloadConfig.writePartsToFile = true;
+        downloadConfig.useDirectIO = useDirectIO;
+
+        std::shared_ptr<TransferHandle> downloadPtr = transferManager->DownloadFile(GetTestBucketName(), RandomFileName, downloadFileName, downloadConfig);
+        downloadPtr->WaitUntilFinished();
+
+        ASSERT_TRUE(downloadPtr->IsMultipart());
+        ASSERT_EQ(TransferStatus::FAILED, downloadPtr->GetStatus());
+        ASSERT_EQ(0u, downloadPtr->GetCompletedParts().size());
+        ASSERT_EQ(Aws::Http::HttpResponseCode::PRECONDITION_FAILED, downloadPtr->GetLastError().GetResponseCode());
+        ASSERT_STREQ("PreconditionFailed", downloadPtr->GetLastError().GetExceptionName().c_str());
+        ASSERT_FALSE(downloadPtr->GetLastError().GetMessage().empty());
+
+        Aws::FileSystem::RemoveFileIfExists(downloadFileName.c_str());
+    }
+}
+
 TEST_F(TransferTests, TransferManager_BigTest)
 {
     const Aws::String RandomFileName = Aws::Utils::UUID::RandomUUID();
@@ -1473,6 +1575,45 @@ TEST_F(TransferTests, TransferManager_MultiPartContentTest)
                                       Aws::Map<Aws::String, Aws::String>());
 }
 
+TEST_F(TransferTests, TransferManager_MemoryMappedMultiPartContentTest)
+{
+    const Aws::String RandomFileName = Aws::Utils::UUID::RandomUUID();
+    Aws::String memoryMappedFileName = MakeFilePath(RandomFileName.c_str());
+    ScopedTestFile testFile(memoryMappedFileName, BIG_TEST_SIZE, MULTI_PART_CONTENT_TEXT);
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    transferManagerConfig.computeContentMD5 = true;
+    transferManagerConfig.useMemoryMappedFiles = true;
+    transferManagerConfig.maxConcurrentMappedParts = 4;
+    // Parts read from the mapped file don't take transfer buffers, a single one must not hold the upload back.
+    transferManagerConfig.transferBufferMaxHeapSize = transferManagerConfig.bufferSize;
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    std::shared_ptr<TransferHandle> requestPtr = transferManager->UploadFile(memoryMappedFileName, GetTestBucketName(), MEMORY_MAPPED_CONTENT_KEY, "text/plain", Aws::Map<Aws::String, Aws::String>());
+
+    requestPtr->WaitUntilFinished();
+
+    size_t retries = 0;
+    //just make sure we don't fail because an upload part failed. (e.g. network problems or interuptions)
+    while (requestPtr->GetStatus() == TransferStatus::FAILED && retries++ < 5)
+    {
+        transferManager->RetryUpload(memoryMappedFileName, requestPtr);
+        requestPtr->WaitUntilFinished();
+    }
+
+    ASSERT_EQ(TransferStatus::COMPLETED, requestPtr->GetStatus());
+    ASSERT_EQ(PARTS_IN_BIG_TEST, requestPtr->GetCompletedParts().size());
+    ASSERT_EQ(requestPtr->GetBytesTotalSize(), requestPtr->GetBytesTransferred());
+
+    VerifyUploadedFile(*transferManager,
+                       memoryMappedFileName,
+                       GetTestBucketName(),
+                       MEMORY_MAPPED_CONTENT_KEY,
+                       "text/plain",
+                       Aws::Map<Aws::String, Aws::String>());
+}
+
 // Single part upload with metadata specified
 TEST_F(TransferTests, TransferManager_SinglePartUploadWithMetadataTest)
 {
@@ -15,6 +15,9 @@
 #include <aws/s3/S3Errors.h>
 #include <iostream>
 #include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 
@@ -28,6 +31,7 @@ namespace Aws
     namespace Transfer
     {
         class TransferHandle;
+        class DirectoryTransferHandle;
 
         typedef std::function<Aws::IOStream*(void)> CreateDownloadStreamCallback;
 
@@ -36,11 +40,26 @@ namespace Aws
         struct DownloadConfiguration
         {
             DownloadConfiguration() :
-                versionId("")
+                versionId(""),
+                writePartsToFile(false),
+                useDirectIO(false)
             {}
 
             Aws::String versionId;
 
+            /**
+             * Only used when downloading to a file name, on POSIX platforms. Multi-part downloads then write the response body of each part
+             * straight into the file at the part's offset with pwrite, instead of buffering the part in a transfer buffer and copying it
+             * into the shared download stream. The file is preallocated to the size of the object.
+             */
+            bool writePartsToFile;
+
+            /**
+             * Used with writePartsToFile on Linux, opens the file with O_DIRECT to bypass the page cache.
+             * Ignored unless the buffer size of the TransferManager is a multiple of 4096 bytes.
+             */
+            bool useDirectIO;
+
             // TBI: controls for in-memory parts vs. resumable file-based parts with state serialization to/from file
         };
 
@@ -353,6 +372,9 @@ namespace Aws
 
             void ApplyDownloadConfiguration(const DownloadConfiguration& downloadConfig);
 
+            bool ShouldWritePartsToFile() const { return m_writePartsToFile; }
+            bool ShouldUseDirectIO() const { return m_useDirectIO; }
+
             bool LockForCompletion()
             {
                 bool expected = false;
@@ -364,6 +386,12 @@ namespace Aws
              */
             Aws::String GetId() const;
 
+            /**
+             * The directory transfer this file transfer is part of, if it was started by UploadDirectory or DownloadToDirectory.
+             */
+            std::shared_ptr<DirectoryTransferHandle> GetDirectoryTransfer() const { std::lock_guard<std::mutex> locker(m_getterSetterLock); return m_directoryTransfer.lock(); }
+            void SetDirectoryTransfer(const std::shared_ptr<DirectoryTransferHandle>& value) { std::lock_guard<std::mutex> locker(m_getterSetterLock); m_directoryTransfer = value; }
+
         private:
 
             void CleanupDownloadStream();
@@ -389,12 +417,15 @@ namespace Aws
             Aws::Client::AWSError<Aws::S3::S3Errors> m_lastError;
             std::atomic<bool> m_cancel;
             std::shared_ptr<const Aws::Client::AsyncCallerContext> m_context;
+            std::weak_ptr<DirectoryTransferHandle> m_directoryTransfer;
             const Utils::UUID m_handleId;
 
             CreateDownloadStreamCallback m_createDownloadStreamFn;
             Aws::IOStream* m_downloadStream;
             /* in case cutomer stream is not based off 0 */
             uint64_t m_downloadStreamBaseOffset;
+            bool m_writePartsToFile;
+            bool m_useDirectIO;
 
             mutable std::mutex m_downloadStreamLock;
             mutable std::mutex m_partsLock;
@@ -403,6 +434,124 @@ namespace Aws
             mutable std::mutex m_getterSetterLock;
         };
 
+        /**
+         * Aggregate state of an UploadDirectory or DownloadToDirectory operation, returned by TransferManager.
+         * Each file is transferred with its own TransferHandle, passed to the transferInitiatedCallback when the file is started. At most
+         * maxConcurrentDirectoryFiles files are in progress at a time, the directory walk or the bucket listing waits for a transfer to finish
+         * before starting more, so a directory of millions of files never has more than that many handles and requests queued.
+         *
+         * The sizes and the progress cover the files initiated so far, so the total grows as the directory or the bucket is walked.
+         * A file retried after it failed is not counted again.
+         */
+        class AWS_TRANSFER_API DirectoryTransferHandle : public std::enable_shared_from_this<DirectoryTransferHandle>
+        {
+        public:
+            DirectoryTransferHandle(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix,
+                size_t maxConcurrentFiles);
+
+            inline TransferDirection GetTransferDirection() const { return m_direction; }
+            inline const Aws::String& GetDirectory() const { return m_directory; }
+            inline const Aws::String& GetBucketName() const { return m_bucket; }
+            inline const Aws::String& GetPrefix() const { return m_prefix; }
+
+            /**
+             * IN_PROGRESS until every file has been initiated and has finished. Then COMPLETED if all of them completed, CANCELED if Cancel was called,
+             * FAILED otherwise, e.g. if a file failed or listing the bucket did.
+             */
+            TransferStatus GetStatus() const;
+
+            size_t GetFilesInitiated() const;
+            size_t GetFilesCompleted() const;
+            size_t GetFilesFailed() const;
+            size_t GetFilesInProgress() const;
+
+            /**
+             * Total size of the files initiated so far.
+             */
+            uint64_t GetBytesTotalSize() const;
+            /**
+             * Bytes transferred by the files initiated so far, the files in progress included.
+             */
+            uint64_t GetBytesTransferred() const;
+            /**
+             * Average throughput since the directory transfer started, or over its whole duration once it has finished.
+             */
+            double GetBytesPerSecond() const;
+
+            /**
+             * Error that stopped the directory transfer early, e.g. a failed bucket listing. The errors of the files are on their own handles.
+             */
+            const Aws::Client::AWSError<Aws::S3::S3Errors> GetLastError() const;
+            void SetError(const Aws::Client::AWSError<Aws::S3::S3Errors>& error);
+
+            /**
+             * Stops initiating files and cancels the file transfers in progress. This happens asynchronously, call WaitUntilFinished to wait for it.
+             */
+            void Cancel();
+            inline bool ShouldContinue() const { return !m_cancel.load(); }
+
+            /**
+             * Blocks the calling thread until every file has been initiated and has finished.
+             */
+            void WaitUntilFinished() const;
+
+            /**
+             * Blocks until fewer than the maximum number of files are in progress and returns true, or returns false once canceled. Used by TransferManager.
+             */
+            bool WaitForFileSlot();
+            /**
+             * Returns true if fewer than the maximum number of files are in progress. Used by TransferManager.
+             */
+            bool HasFileSlot() const;
+            /**
+             * Counts a file transfer as initiated and in progress, until its handle reaches a finished status. Used by TransferManager.
+             */
+            void AddFile(const std::shared_ptr<TransferHandle>& handle, uint64_t sizeInBytes);
+            /**
+             * Called by the handle of a file when it reaches a finished status.
+             */
+            void OnFileFinished(const TransferHandle& handle);
+            /**
+             * No more files will be added, the directory transfer finishes with the last file in progress. Used by TransferManager.
+             */
+            void SetAllFilesInitiated();
+            /**
+             * Called each time a file finishes, without any lock held. TransferManager uses it to start the next listed files of a download.
+             * It is released once the directory transfer has finished.
+             */
+            void SetFileFinishedCallback(const std::function<void()>& callback);
+
+        private:
+            /**
+             * Sets the final status once every file has been initiated and has finished. Returns the file finished callback then,
+             * it usually holds on to this handle and is released by the caller outside of the lock.
+             */
+            std::function<void()> FinishIfDone();
+
+            TransferDirection m_direction;
+            Aws::String m_directory;
+            Aws::String m_bucket;
+            Aws::String m_prefix;
+            size_t m_maxConcurrentFiles;
+            std::atomic<bool> m_cancel;
+            std::chrono::steady_clock::time_point m_startTime;
+
+            mutable std::mutex m_lock;
+            mutable std::condition_variable m_changedSignal;
+            Aws::UnorderedMap<const TransferHandle*, std::shared_ptr<TransferHandle>> m_filesInProgress;
+            size_t m_filesInitiated;
+            size_t m_filesCompleted;
+            size_t m_filesFailed;
+            uint64_t m_bytesTotalSize;
+            uint64_t m_bytesTransferredByFinishedFiles;
+            bool m_allFilesInitiated;
+            TransferStatus m_status;
+            std::chrono::steady_clock::time_point m_finishTime;
+            Aws::Client::AWSError<Aws::S3::S3Errors> m_lastError;
+            bool m_hasError;
+            std::function<void()> m_fileFinishedCallback;
+        };
+
         AWS_TRANSFER_API Aws::OStream& operator << (Aws::OStream& s, TransferStatus status);
     }
 }
@@ -14,6 +14,7 @@
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/ResourceManager.h>
+#include <aws/core/utils/threading/Semaphore.h>
 #include <aws/core/client/AsyncCallerContext.h>
 
 #include <memory>
@@ -23,6 +24,7 @@ namespace Aws
     namespace Transfer
     {
         class TransferManager;
+        struct DownloadDirectoryContext;
 
         typedef std::function<void(const TransferManager*, const std::shared_ptr<const TransferHandle>&)> UploadProgressCallback;
         typedef std::function<void(const TransferManager*, const std::shared_ptr<const TransferHandle>&)> DownloadProgressCallback;
@@ -37,7 +39,8 @@ namespace Aws
          */
         struct TransferManagerConfiguration
         {
-            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), computeContentMD5(false), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5)
+            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), computeContentMD5(false), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5),
+                maxConcurrentDirectoryFiles(64), useMemoryMappedFiles(false), maxConcurrentMappedParts(32)
             {
             }
 
@@ -80,6 +83,7 @@ namespace Aws
             /**
              * Maximum size of the working buffers to use. This is not the same thing as max heap size for your process. This is the maximum amount of memory we will
              * allocate for all transfer buffers. default is 50MB.
+             * Each part in flight holds a buffer, so transferBufferMaxHeapSize / bufferSize is also the maximum number of parts transferred concurrently.
              * If you are using Aws::Utils::Threading::PooledThreadExecutor for transferExecutor, this size should be greater than bufferSize * poolSize.
              */
             uint64_t transferBufferMaxHeapSize;
@@ -88,6 +92,24 @@ namespace Aws
              * to increase your max heap size if this is something you plan on increasing.
              */
             uint64_t bufferSize;
+            /**
+             * Maximum number of files UploadDirectory and DownloadToDirectory transfer concurrently, defaults to 64. The directory walk or the bucket listing
+             * only moves on once a file finishes, which bounds the handles, open files and queued requests of a large directory.
+             * Files no larger than bufferSize are uploaded straight from the file and downloaded without a HeadObject request, they don't hold a transfer buffer,
+             * so small files are not limited by the number of buffers, only by this setting.
+             */
+            size_t maxConcurrentDirectoryFiles;
+            /**
+             * When true, the parts of multi-part uploads of files are sent straight from a read-only memory mapping of the file, they are not copied into
+             * transfer buffers and don't count against transferBufferMaxHeapSize. Uploads fall back to transfer buffers when the file can't be mapped,
+             * e.g. files larger than the address space of a 32 bit process. The file must not be truncated while it is uploaded.
+             * This option is disabled by default.
+             */
+            bool useMemoryMappedFiles;
+            /**
+             * Maximum number of parts read from memory mapped files transferred concurrently, defaults to 32. Only used with useMemoryMappedFiles.
+             */
+            size_t maxConcurrentMappedParts;
 
             /**
              * Callback to receive progress updates for uploads.
@@ -209,25 +231,26 @@ namespace Aws
 
             /**
              * Uploads entire contents of directory to Amazon S3 bucket and stores them in a directory starting at prefix. This is an asynchronous method. You will receive notifications
-             * that an upload has started via the transferInitiatedCallback callback function in your configuration. If you do not set this callback, then you will not be able to handle
-             * the file transfers.
+             * that an upload has started via the transferInitiatedCallback callback function in your configuration. The returned handle tracks the progress of the whole directory,
+             * at most maxConcurrentDirectoryFiles files are uploaded at a time.
+             * The directory is walked on the transferExecutor, which starts the uploads itself so that they never wait on another executor thread.
              *
              * directory: the absolute directory on disk to upload
              * bucketName: the name of the S3 bucket to upload to
              * prefix: the prefix to put on all objects uploaded (e.g. put them in x directory in the bucket).
              */
-            void UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata);
+            std::shared_ptr<DirectoryTransferHandle> UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata);
 
             /**
             * Downloads entire contents of an Amazon S3 bucket starting at prefix stores them in a directory (not including the prefix). This is an asynchronous method. You will receive notifications
-            * that a download has started via the transferInitiatedCallback callback function in your configuration. If you do not set this callback, then you will not be able to handle
-            * the file transfers. If an error occurs prior to the transfer being initiated (e.g. list objects fails, then an error will be passed through the errorCallback).
+            * that a download has started via the transferInitiatedCallback callback function in your configuration. The returned handle tracks the progress of the whole directory,
+            * at most maxConcurrentDirectoryFiles files are downloaded at a time. If an error occurs prior to the transfer being initiated (e.g. list objects fails, then an error will be passed through the errorCallback).
             *
             * directory: the absolute directory on disk to download to
             * bucketName: the name of the S3 bucket to upload to
             * prefix: the prefix in the bucket to use as the root directory (e.g. download all objects at x prefix in S3 and then store them starting in directory with the prefix stripped out).
             */
-            void DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String());
+            std::shared_ptr<DirectoryTransferHandle> DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String());
 
         private:
             /**
@@ -280,13 +303,30 @@ namespace Aws
             bool InitializePartsForDownload(const std::shared_ptr<TransferHandle>& handle);
 
             void DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
-            void DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
+            /**
+             * Without useTransferBuffer, streamToPut is sent as the body rather than copied into a transfer buffer, and must not be shared with another upload.
+             */
+            void DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle, bool useTransferBuffer = true);
 
             void DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle);
             void DoSinglePartUpload(const std::shared_ptr<TransferHandle>& handle);
 
             void DoDownload(const std::shared_ptr<TransferHandle>& handle);
             void DoSinglePartDownload(const std::shared_ptr<TransferHandle>& handle);
+            /**
+             * Downloads an object of a known size, no larger than bufferSize, in a single GetObject without the HeadObject request of DoDownload.
+             */
+            void DoSmallObjectDownload(const std::shared_ptr<TransferHandle>& handle, uint64_t objectSize);
+
+            /**
+             * Starts the upload of a file found by the walk of UploadDirectory, on the walking thread.
+             */
+            void UploadDirectoryFile(const Aws::String& fileName, const Aws::String& keyName, const Aws::Map<Aws::String, Aws::String>& metadata,
+                                     const std::shared_ptr<DirectoryTransferHandle>& directoryHandle);
+            /**
+             * Starts downloading listed objects while fewer than maxConcurrentDirectoryFiles files are in progress, and lists the next page when few objects are left.
+             */
+            void DispatchDirectoryDownloads(const std::shared_ptr<DownloadDirectoryContext>& context);
 
             void HandleGetObjectResponse(const Aws::S3::S3Client* client, 
                                          const Aws::S3::Model::GetObjectRequest& request,
@@ -309,6 +349,8 @@ namespace Aws
 
             Aws::Utils::ExclusiveOwnershipResourceManager<unsigned char*> m_bufferManager;
             TransferManagerConfiguration m_transferConfig;
+            // Held by each part read from a memory mapped file while it is in flight, in place of a transfer buffer.
+            Aws::Utils::Threading::Semaphore m_mappedPartSlots;
         };
 
         
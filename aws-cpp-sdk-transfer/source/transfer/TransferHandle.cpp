@@ -5,7 +5,9 @@
 
 #include <aws/transfer/TransferHandle.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace Aws
@@ -76,7 +78,9 @@ namespace Aws
             m_cancel(false),
             m_handleId(Utils::UUID::RandomUUID()),
             m_createDownloadStreamFn(),
-            m_downloadStream(nullptr)
+            m_downloadStream(nullptr),
+            m_writePartsToFile(false),
+            m_useDirectIO(false)
         {}
 
         TransferHandle::TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, const Aws::String& targetFilePath) :
@@ -94,7 +98,9 @@ namespace Aws
             m_cancel(false),
             m_handleId(Utils::UUID::RandomUUID()),
             m_createDownloadStreamFn(),
-            m_downloadStream(nullptr)
+            m_downloadStream(nullptr),
+            m_writePartsToFile(false),
+            m_useDirectIO(false)
         {}
 
         TransferHandle::TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, CreateDownloadStreamCallback createDownloadStreamFn, const Aws::String& targetFilePath) :
@@ -112,7 +118,9 @@ namespace Aws
             m_cancel(false),
             m_handleId(Utils::UUID::RandomUUID()),
             m_createDownloadStreamFn(createDownloadStreamFn),
-            m_downloadStream(nullptr)
+            m_downloadStream(nullptr),
+            m_writePartsToFile(false),
+            m_useDirectIO(false)
         {}
 
 
@@ -133,7 +141,9 @@ namespace Aws
             m_cancel(false),
             m_handleId(Utils::UUID::RandomUUID()),
             m_createDownloadStreamFn(createDownloadStreamFn),
-            m_downloadStream(nullptr)
+            m_downloadStream(nullptr),
+            m_writePartsToFile(false),
+            m_useDirectIO(false)
         {}
 
         TransferHandle::~TransferHandle()
@@ -311,6 +321,7 @@ namespace Aws
                 AWS_LOGSTREAM_INFO(CLASS_TAG, "Transfer handle ID [" << GetId() << "] Updated handle status from ["
                     << m_status << "] to [" << value << "].");
 
+                bool finishing = !IsFinishedStatus(m_status);
                 m_status = value;
 
                 if (IsFinishedStatus(value))
@@ -322,6 +333,12 @@ namespace Aws
 
                     semaphoreLock.unlock();
                     m_waitUntilFinishedSignal.notify_all();
+
+                    auto directoryTransfer = finishing ? GetDirectoryTransfer() : nullptr;
+                    if (directoryTransfer)
+                    {
+                        directoryTransfer->OnFileFinished(*this);
+                    }
                 }
             }
             else
@@ -379,6 +396,8 @@ namespace Aws
         void TransferHandle::ApplyDownloadConfiguration(const DownloadConfiguration& downloadConfig)
         {
             SetVersionId(downloadConfig.versionId);
+            m_writePartsToFile = downloadConfig.writePartsToFile;
+            m_useDirectIO = downloadConfig.useDirectIO;
         }
 
         void TransferHandle::CleanupDownloadStream()
@@ -402,5 +421,230 @@ namespace Aws
         {
             return m_handleId;
         }
+
+        DirectoryTransferHandle::DirectoryTransferHandle(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName,
+            const Aws::String& prefix, size_t maxConcurrentFiles) :
+            m_direction(direction),
+            m_directory(directory),
+            m_bucket(bucketName),
+            m_prefix(prefix),
+            m_maxConcurrentFiles((std::max)(maxConcurrentFiles, static_cast<size_t>(1))),
+            m_cancel(false),
+            m_startTime(std::chrono::steady_clock::now()),
+            m_filesInitiated(0),
+            m_filesCompleted(0),
+            m_filesFailed(0),
+            m_bytesTotalSize(0),
+            m_bytesTransferredByFinishedFiles(0),
+            m_allFilesInitiated(false),
+            m_status(TransferStatus::IN_PROGRESS),
+            m_hasError(false)
+        {}
+
+        TransferStatus DirectoryTransferHandle::GetStatus() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_status;
+        }
+
+        size_t DirectoryTransferHandle::GetFilesInitiated() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_filesInitiated;
+        }
+
+        size_t DirectoryTransferHandle::GetFilesCompleted() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_filesCompleted;
+        }
+
+        size_t DirectoryTransferHandle::GetFilesFailed() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_filesFailed;
+        }
+
+        size_t DirectoryTransferHandle::GetFilesInProgress() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_filesInProgress.size();
+        }
+
+        uint64_t DirectoryTransferHandle::GetBytesTotalSize() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_bytesTotalSize;
+        }
+
+        uint64_t DirectoryTransferHandle::GetBytesTransferred() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            uint64_t bytesTransferred = m_bytesTransferredByFinishedFiles;
+            for (const auto& file : m_filesInProgress)
+            {
+                bytesTransferred += file.second->GetBytesTransferred();
+            }
+            return bytesTransferred;
+        }
+
+        double DirectoryTransferHandle::GetBytesPerSecond() const
+        {
+            auto end = std::chrono::steady_clock::now();
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (m_status != TransferStatus::IN_PROGRESS)
+                {
+                    end = m_finishTime;
+                }
+            }
+
+            auto seconds = std::chrono::duration<double>(end - m_startTime).count();
+            return seconds > 0 ? static_cast<double>(GetBytesTransferred()) / seconds : 0;
+        }
+
+        const Aws::Client::AWSError<Aws::S3::S3Errors> DirectoryTransferHandle::GetLastError() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_lastError;
+        }
+
+        void DirectoryTransferHandle::SetError(const Aws::Client::AWSError<Aws::S3::S3Errors>& error)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_lastError = error;
+            m_hasError = true;
+        }
+
+        void DirectoryTransferHandle::Cancel()
+        {
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Directory transfer of [" << m_directory << "] Cancelling transfer.");
+            m_cancel.store(true);
+
+            Aws::Vector<std::shared_ptr<TransferHandle>> filesInProgress;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                for (const auto& file : m_filesInProgress)
+                {
+                    filesInProgress.push_back(file.second);
+                }
+            }
+            m_changedSignal.notify_all();
+
+            for (const auto& file : filesInProgress)
+            {
+                file->Cancel();
+            }
+        }
+
+        void DirectoryTransferHandle::WaitUntilFinished() const
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_changedSignal.wait(locker, [this] { return m_status != TransferStatus::IN_PROGRESS; });
+        }
+
+        bool DirectoryTransferHandle::WaitForFileSlot()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_changedSignal.wait(locker, [this] { return !ShouldContinue() || m_filesInProgress.size() < m_maxConcurrentFiles; });
+            return ShouldContinue();
+        }
+
+        bool DirectoryTransferHandle::HasFileSlot() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_filesInProgress.size() < m_maxConcurrentFiles;
+        }
+
+        void DirectoryTransferHandle::AddFile(const std::shared_ptr<TransferHandle>& handle, uint64_t sizeInBytes)
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                m_filesInProgress[handle.get()] = handle;
+                m_filesInitiated++;
+                m_bytesTotalSize += sizeInBytes;
+            }
+
+            // The handle may have failed already, e.g. if the file could not be opened. OnFileFinished ignores the handles it already counted.
+            handle->SetDirectoryTransfer(shared_from_this());
+            if (IsFinishedStatus(handle->GetStatus()))
+            {
+                OnFileFinished(*handle);
+            }
+        }
+
+        void DirectoryTransferHandle::OnFileFinished(const TransferHandle& handle)
+        {
+            std::function<void()> fileFinishedCallback;
+            std::function<void()> releasedCallback;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                auto file = m_filesInProgress.find(&handle);
+                if (file == m_filesInProgress.end())
+                {
+                    return;
+                }
+
+                m_filesInProgress.erase(file);
+                m_bytesTransferredByFinishedFiles += handle.GetBytesTransferred();
+                if (handle.GetStatus() == TransferStatus::COMPLETED || handle.GetStatus() == TransferStatus::EXACT_OBJECT_ALREADY_EXISTS)
+                {
+                    m_filesCompleted++;
+                }
+                else
+                {
+                    m_filesFailed++;
+                }
+                fileFinishedCallback = m_fileFinishedCallback;
+                releasedCallback = FinishIfDone();
+            }
+            m_changedSignal.notify_all();
+
+            if (fileFinishedCallback)
+            {
+                fileFinishedCallback();
+            }
+        }
+
+        void DirectoryTransferHandle::SetAllFilesInitiated()
+        {
+            std::function<void()> releasedCallback;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                m_allFilesInitiated = true;
+                releasedCallback = FinishIfDone();
+            }
+            m_changedSignal.notify_all();
+        }
+
+        void DirectoryTransferHandle::SetFileFinishedCallback(const std::function<void()>& callback)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_fileFinishedCallback = callback;
+        }
+
+        std::function<void()> DirectoryTransferHandle::FinishIfDone()
+        {
+            if (m_status != TransferStatus::IN_PROGRESS || !m_allFilesInitiated || !m_filesInProgress.empty())
+            {
+                return nullptr;
+            }
+
+            if (!ShouldContinue())
+            {
+                m_status = TransferStatus::CANCELED;
+            }
+            else
+            {
+                m_status = (m_filesFailed == 0 && !m_hasError) ? TransferStatus::COMPLETED : TransferStatus::FAILED;
+            }
+            m_finishTime = std::chrono::steady_clock::now();
+            AWS_LOGSTREAM_INFO(CLASS_TAG, "Directory transfer of [" << m_directory << "] finished with status [" << m_status << "]. "
+                    << m_filesCompleted << " file(s) completed, " << m_filesFailed << " failed.");
+
+            std::function<void()> fileFinishedCallback;
+            fileFinishedCallback.swap(m_fileFinishedCallback);
+            return fileFinishedCallback;
+        }
     }
 }
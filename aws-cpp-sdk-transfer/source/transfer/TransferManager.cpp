@@ -8,6 +8,8 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/http/HttpResponse.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/FileSystemUtils.h>
 #include <aws/core/platform/FileSystem.h>
@@ -19,9 +21,18 @@
 #include <aws/s3/model/AbortMultipartUploadRequest.h>
 #include <fstream>
 #include <algorithm>
+#include <streambuf>
+#include <cstring>
 
 #include <aws/core/utils/logging/LogMacros.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cerrno>
+#endif
+
 namespace Aws
 {
     namespace Transfer
@@ -31,18 +42,382 @@ namespace Aws
             return (path.find_last_of('/') == path.size() - 1 || path.find_last_of('\\') == path.size() - 1);
         }
 
+        // O_DIRECT requires the offset, length and memory address of each write to be aligned to the logical block size.
+        static const size_t DIRECT_IO_ALIGNMENT = 4096;
+        static const size_t DIRECT_IO_STAGING_SIZE = 64 * DIRECT_IO_ALIGNMENT;
+
+        /**
+         * Download target for DownloadConfiguration::writePartsToFile. Parts are written with positional writes, so they do not share a file position
+         * and can be written concurrently without a lock.
+         */
+        class PartFile
+        {
+        public:
+            PartFile() : m_fd(-1), m_directIO(false) {}
+
+            ~PartFile()
+            {
+#ifndef _WIN32
+                if (m_fd >= 0)
+                {
+                    close(m_fd);
+                }
+#endif
+            }
+
+            /**
+             * Opens the file and preallocates size bytes. Returns false if positional writes are not supported on this platform or the file can't be opened.
+             */
+            bool Open(const Aws::String& fileName, uint64_t size, bool truncate, bool directIO)
+            {
+#ifdef _WIN32
+                AWS_UNREFERENCED_PARAM(fileName);
+                AWS_UNREFERENCED_PARAM(size);
+                AWS_UNREFERENCED_PARAM(truncate);
+                AWS_UNREFERENCED_PARAM(directIO);
+                return false;
+#else
+                int flags = O_WRONLY | O_CREAT | (truncate ? O_TRUNC : 0);
+#ifdef O_DIRECT
+                if (directIO)
+                {
+                    m_fd = open(fileName.c_str(), flags | O_DIRECT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+                    m_directIO = m_fd >= 0;
+                }
+#else
+                AWS_UNREFERENCED_PARAM(directIO);
+#endif
+                if (m_fd < 0)
+                {
+                    m_fd = open(fileName.c_str(), flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+                }
+                if (m_fd < 0)
+                {
+                    return false;
+                }
+#ifdef __linux__
+                // Reserving the blocks up front keeps concurrent parts from fragmenting the file, not every file system supports it.
+                if (size > 0 && posix_fallocate(m_fd, 0, static_cast<off_t>(size)) == 0)
+                {
+                    return true;
+                }
+#endif
+                return ftruncate(m_fd, static_cast<off_t>(size)) == 0;
+#endif
+            }
+
+            bool IsDirectIO() const { return m_directIO; }
+
+            bool Write(const char* data, size_t length, uint64_t offset)
+            {
+#ifdef _WIN32
+                AWS_UNREFERENCED_PARAM(data);
+                AWS_UNREFERENCED_PARAM(length);
+                AWS_UNREFERENCED_PARAM(offset);
+                return false;
+#else
+                while (length > 0)
+                {
+                    ssize_t written = pwrite(m_fd, data, length, static_cast<off_t>(offset));
+                    if (written < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        return false;
+                    }
+                    data += written;
+                    length -= static_cast<size_t>(written);
+                    offset += static_cast<uint64_t>(written);
+                }
+                return true;
+#endif
+            }
+
+            /**
+             * Drops the padding written past the end of the object by direct IO.
+             */
+            bool Truncate(uint64_t size)
+            {
+#ifdef _WIN32
+                AWS_UNREFERENCED_PARAM(size);
+                return false;
+#else
+                return ftruncate(m_fd, static_cast<off_t>(size)) == 0;
+#endif
+            }
+
+        private:
+            int m_fd;
+            bool m_directIO;
+        };
+
+        /**
+         * Response stream of a part downloaded with DownloadConfiguration::writePartsToFile, writes the body into the file at the part's offset as it arrives.
+         * Until the status of the response is known, the body is kept in memory. On success, it is then written into the file, otherwise it stays
+         * in memory for the error to be read back from it.
+         * Without direct IO, nothing is buffered once writing into the file. With direct IO, the body is staged in an aligned buffer and written in
+         * whole blocks, the last block of the object is padded with zeros and truncated once all parts are written.
+         */
+        class PartFileStreamBuf : public std::streambuf
+        {
+        public:
+            PartFileStreamBuf(const std::shared_ptr<PartFile>& partFile, uint64_t offset, uint64_t length) :
+                m_partFile(partFile),
+                m_offset(offset),
+                m_end(offset + length),
+                m_stagingAllocation(nullptr),
+                m_staging(nullptr),
+                m_target(BodyTarget::PENDING)
+            {
+            }
+
+            ~PartFileStreamBuf()
+            {
+                if (m_stagingAllocation)
+                {
+                    Aws::DeleteArray(m_stagingAllocation);
+                }
+            }
+
+            /**
+             * Called with the status of the response once it is known, writes the body received so far into the file if it is a success.
+             * Returns false if the file can't be written.
+             */
+            bool OnResponseCode(Aws::Http::HttpResponseCode responseCode)
+            {
+                if (m_target != BodyTarget::PENDING || responseCode == Aws::Http::HttpResponseCode::REQUEST_NOT_MADE)
+                {
+                    return true;
+                }
+
+                int code = static_cast<int>(responseCode);
+                if (code < 200 || code > 299)
+                {
+                    m_target = BodyTarget::MEMORY;
+                    return true;
+                }
+
+                m_target = BodyTarget::PART_FILE;
+                setg(nullptr, nullptr, nullptr);
+                if (m_partFile->IsDirectIO())
+                {
+                    m_stagingAllocation = Aws::NewArray<char>(DIRECT_IO_STAGING_SIZE + DIRECT_IO_ALIGNMENT, CLASS_TAG);
+                    auto address = reinterpret_cast<uintptr_t>(m_stagingAllocation);
+                    m_staging = m_stagingAllocation + (DIRECT_IO_ALIGNMENT - address % DIRECT_IO_ALIGNMENT) % DIRECT_IO_ALIGNMENT;
+                    setp(m_staging, m_staging + DIRECT_IO_STAGING_SIZE);
+                }
+
+                Aws::String received;
+                received.swap(m_body);
+                auto length = static_cast<std::streamsize>(received.size());
+                return length == 0 || xsputn(received.c_str(), length) == length;
+            }
+
+        protected:
+            std::streamsize xsputn(const char* s, std::streamsize n) override
+            {
+                if (m_target != BodyTarget::PART_FILE)
+                {
+                    AppendToBody(s, static_cast<size_t>(n));
+                    return n;
+                }
+
+                if (m_staging)
+                {
+                    return std::streambuf::xsputn(s, n);
+                }
+
+                if (!m_partFile->Write(s, static_cast<size_t>(n), m_offset))
+                {
+                    return 0;
+                }
+                m_offset += static_cast<uint64_t>(n);
+                return n;
+            }
+
+            int_type overflow(int_type c) override
+            {
+                if (traits_type::eq_int_type(c, traits_type::eof()))
+                {
+                    return traits_type::not_eof(c);
+                }
+
+                if (m_staging)
+                {
+                    if (!WriteStagedBlocks())
+                    {
+                        return traits_type::eof();
+                    }
+                    *pptr() = traits_type::to_char_type(c);
+                    pbump(1);
+                    return c;
+                }
+
+                char value = traits_type::to_char_type(c);
+                return xsputn(&value, 1) == 1 ? c : traits_type::eof();
+            }
+
+            int sync() override
+            {
+                if (!m_staging || pptr() == pbase())
+                {
+                    return 0;
+                }
+
+                size_t staged = static_cast<size_t>(pptr() - pbase());
+                if (m_offset + staged >= m_end && staged % DIRECT_IO_ALIGNMENT != 0)
+                {
+                    // Only the last part of an object ends off a block boundary, the padding is truncated when the download completes.
+                    size_t padding = DIRECT_IO_ALIGNMENT - staged % DIRECT_IO_ALIGNMENT;
+                    memset(pptr(), 0, padding);
+                    pbump(static_cast<int>(padding));
+                }
+                return WriteStagedBlocks() ? 0 : -1;
+            }
+
+            int_type underflow() override
+            {
+                if (m_target == BodyTarget::PART_FILE || GetReadPosition() >= m_body.size())
+                {
+                    return traits_type::eof();
+                }
+                SetReadPosition(GetReadPosition());
+                return traits_type::to_int_type(*gptr());
+            }
+
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+            {
+                // Only the body kept in memory can be read back, the error marshallers rewind it and measure it with tellp.
+                if (m_target == BodyTarget::PART_FILE)
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                off_type length = static_cast<off_type>(m_body.size());
+                if ((which & std::ios_base::in) == 0)
+                {
+                    return off == 0 && dir != std::ios_base::beg ? pos_type(length) : pos_type(off_type(-1));
+                }
+
+                off_type base = dir == std::ios_base::beg ? 0 : dir == std::ios_base::cur ? static_cast<off_type>(GetReadPosition()) : length;
+                if (base + off < 0 || base + off > length)
+                {
+                    return pos_type(off_type(-1));
+                }
+                SetReadPosition(static_cast<size_t>(base + off));
+                return pos_type(base + off);
+            }
+
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+            {
+                return seekoff(off_type(pos), std::ios_base::beg, which);
+            }
+
+        private:
+            /**
+             * Writes the whole blocks of the staging buffer and moves the remainder to its start.
+             */
+            bool WriteStagedBlocks()
+            {
+                size_t staged = static_cast<size_t>(pptr() - pbase());
+                size_t blocks = staged - staged % DIRECT_IO_ALIGNMENT;
+                if (blocks > 0)
+                {
+                    if (!m_partFile->Write(m_staging, blocks, m_offset))
+                    {
+                        return false;
+                    }
+                    m_offset += blocks;
+                    memmove(m_staging, m_staging + blocks, staged - blocks);
+                }
+                setp(m_staging, m_staging + DIRECT_IO_STAGING_SIZE);
+                pbump(static_cast<int>(staged - blocks));
+                return true;
+            }
+
+            size_t GetReadPosition() const
+            {
+                return eback() ? static_cast<size_t>(gptr() - eback()) : 0;
+            }
+
+            void SetReadPosition(size_t position)
+            {
+                if (m_body.empty())
+                {
+                    setg(nullptr, nullptr, nullptr);
+                    return;
+                }
+                char* data = &m_body[0];
+                setg(data, data + position, data + m_body.size());
+            }
+
+            void AppendToBody(const char* s, size_t n)
+            {
+                // Appending may move the body, the read position is carried over.
+                size_t readPosition = GetReadPosition();
+                m_body.append(s, n);
+                SetReadPosition(readPosition);
+            }
+
+            enum class BodyTarget
+            {
+                PENDING,
+                PART_FILE,
+                MEMORY
+            };
+
+            std::shared_ptr<PartFile> m_partFile;
+            uint64_t m_offset;
+            uint64_t m_end;
+            char* m_stagingAllocation;
+            char* m_staging;
+            BodyTarget m_target;
+            // Body received while the status is unknown, or the error body.
+            Aws::String m_body;
+        };
+
         struct TransferHandleAsyncContext : public Aws::Client::AsyncCallerContext
         {
+            TransferHandleAsyncContext() : usesTransferBuffer(true) {}
+
             std::shared_ptr<TransferHandle> handle;
             PartPointer partState;
+            std::shared_ptr<PartFile> partFile;
+            // Kept mapped until the parts reading from it are finished.
+            std::shared_ptr<Aws::FileSystem::MappedFile> mappedFile;
+            // False when the body is the file stream itself or a slice of mappedFile, there is no transfer buffer to release then.
+            bool usesTransferBuffer;
         };
 
         struct DownloadDirectoryContext : public Aws::Client::AsyncCallerContext
         {
+            DownloadDirectoryContext() : hasMorePages(true), listing(true) {}
+
             Aws::String rootDirectory;
             Aws::String prefix;
+            std::shared_ptr<DirectoryTransferHandle> directoryHandle;
+
+            std::mutex lock;
+            // Listed objects waiting for a file slot, the next page is only listed once fewer than maxConcurrentDirectoryFiles are left.
+            Aws::Deque<Aws::S3::Model::Object> pendingObjects;
+            Aws::S3::Model::ListObjectsV2Request nextListRequest;
+            bool hasMorePages;
+            bool listing;
         };
 
+        static CreateDownloadStreamCallback CreateDownloadFileFunction(const Aws::String& writeToFile)
+        {
+#ifdef _MSC_VER
+            return [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, Aws::Utils::StringUtils::ToWString(writeToFile.c_str()).c_str(),
+                                                         std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
+#else
+            return [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, writeToFile.c_str(),
+                                                         std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
+#endif
+        }
+
         std::shared_ptr<TransferManager> TransferManager::Create(const TransferManagerConfiguration& config)
         {
             // Because TransferManager's ctor is private (to ensure it's always constructed as a shared_ptr)
@@ -55,7 +430,8 @@ namespace Aws
             return Aws::MakeShared<MakeSharedEnabler>(CLASS_TAG, config);
         }
 
-        TransferManager::TransferManager(const TransferManagerConfiguration& configuration) : m_transferConfig(configuration)
+        TransferManager::TransferManager(const TransferManagerConfiguration& configuration) : m_transferConfig(configuration),
+            m_mappedPartSlots((std::max)(configuration.maxConcurrentMappedParts, static_cast<size_t>(1)), (std::max)(configuration.maxConcurrentMappedParts, static_cast<size_t>(1)))
         {
             assert(m_transferConfig.s3Client);
             assert(m_transferConfig.transferExecutor);
@@ -132,15 +508,7 @@ namespace Aws
                                                                       const DownloadConfiguration& downloadConfig,
                                                                       const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
-#ifdef _MSC_VER
-            auto createFileFn = [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, Aws::Utils::StringUtils::ToWString(writeToFile.c_str()).c_str(),
-                                                                     std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
-#else
-            auto createFileFn = [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, writeToFile.c_str(),
-                                                                     std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
-#endif
-
-            return DownloadFile(bucketName, keyName, createFileFn, downloadConfig, writeToFile, context);
+            return DownloadFile(bucketName, keyName, CreateDownloadFileFunction(writeToFile), downloadConfig, writeToFile, context);
         }
 
         std::shared_ptr<TransferHandle> TransferManager::RetryUpload(const Aws::String& fileName, const std::shared_ptr<TransferHandle>& retryHandle)
@@ -208,15 +576,22 @@ namespace Aws
             m_transferConfig.transferExecutor->Submit([self, inProgressHandle] { self->WaitForCancellationAndAbortUpload(inProgressHandle); });
         }
 
-        void TransferManager::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata)
+        std::shared_ptr<DirectoryTransferHandle> TransferManager::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata)
         {
-            assert(m_transferConfig.transferInitiatedCallback);
+            auto directoryHandle = Aws::MakeShared<DirectoryTransferHandle>(CLASS_TAG, TransferDirection::UPLOAD, directory, bucketName, prefix,
+                    m_transferConfig.maxConcurrentDirectoryFiles);
 
             auto self = shared_from_this();
-            auto visitor = [self, bucketName, prefix, metadata](const Aws::FileSystem::DirectoryTree*, const Aws::FileSystem::DirectoryEntry& entry)
+            auto visitor = [self, prefix, metadata, directoryHandle](const Aws::FileSystem::DirectoryTree*, const Aws::FileSystem::DirectoryEntry& entry)
             {
                 if (entry && entry.fileType == Aws::FileSystem::FileType::File)
                 {
+                    // The walk pauses while the maximum number of files are in progress, and stops once the directory transfer is canceled.
+                    if (!directoryHandle->WaitForFileSlot())
+                    {
+                        return false;
+                    }
+
                     Aws::StringStream ssKey;
                     Aws::String relativePath = entry.relativePath;
                     char delimiter[] = { Aws::FileSystem::PATH_DELIM, 0 };
@@ -225,22 +600,62 @@ namespace Aws
                     ssKey << prefix << "/" << relativePath;
                     Aws::String keyName = ssKey.str();
                     AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Uploading file: " << entry.path
-                            << " as part of directory upload to S3 Bucket: [" << bucketName << "] and Key: ["
+                            << " as part of directory upload to S3 Bucket: [" << directoryHandle->GetBucketName() << "] and Key: ["
                             << keyName << "].");
-                    self->m_transferConfig.transferInitiatedCallback(self.get(), self->UploadFile(entry.path, bucketName, keyName, DEFAULT_CONTENT_TYPE, metadata));
+                    self->UploadDirectoryFile(entry.path, keyName, metadata, directoryHandle);
                 }
 
                 return true;
             };
 
-            m_transferConfig.transferExecutor->Submit([directory, visitor]() { Aws::FileSystem::DirectoryTree dir(directory); dir.TraverseDepthFirst(visitor); });
+            m_transferConfig.transferExecutor->Submit([directory, visitor, directoryHandle]()
+                {
+                    Aws::FileSystem::DirectoryTree dir(directory);
+                    dir.TraverseDepthFirst(visitor);
+                    directoryHandle->SetAllFilesInitiated();
+                });
+            return directoryHandle;
         }
 
-        void TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
+        void TransferManager::UploadDirectoryFile(const Aws::String& fileName, const Aws::String& keyName, const Aws::Map<Aws::String, Aws::String>& metadata,
+                                                  const std::shared_ptr<DirectoryTransferHandle>& directoryHandle)
+        {
+#ifdef _MSC_VER
+            auto wide = Aws::Utils::StringUtils::ToWString(fileName.c_str());
+            auto fileStream = Aws::MakeShared<Aws::FStream>(CLASS_TAG, wide.c_str(), std::ios_base::in | std::ios_base::binary);
+#else
+            auto fileStream = Aws::MakeShared<Aws::FStream>(CLASS_TAG, fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+#endif
+            auto handle = CreateUploadFileHandle(fileStream.get(), directoryHandle->GetBucketName(), keyName, DEFAULT_CONTENT_TYPE, metadata, nullptr, fileName);
+            directoryHandle->AddFile(handle, handle->GetBytesTotalSize());
+            if (m_transferConfig.transferInitiatedCallback)
+            {
+                m_transferConfig.transferInitiatedCallback(this, handle);
+            }
+
+            if (handle->GetStatus() != TransferStatus::NOT_STARTED)
+            {
+                return;
+            }
+
+            // Started on the walking thread rather than submitted to the transferExecutor: the walk may be the one task keeping a pooled executor busy while it waits.
+            if (MultipartUploadSupported(handle->GetBytesTotalSize()))
+            {
+                DoMultiPartUpload(fileStream, handle);
+            }
+            else
+            {
+                DoSinglePartUpload(fileStream, handle, false /*useTransferBuffer*/);
+            }
+        }
+
+        std::shared_ptr<DirectoryTransferHandle> TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
         {
-            assert(m_transferConfig.transferInitiatedCallback);
             Aws::FileSystem::CreateDirectoryIfNotExists(directory.c_str());
 
+            auto directoryHandle = Aws::MakeShared<DirectoryTransferHandle>(CLASS_TAG, TransferDirection::DOWNLOAD, directory, bucketName, prefix,
+                    m_transferConfig.maxConcurrentDirectoryFiles);
+
             auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
             auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request,
                 const Aws::S3::Model::ListObjectsV2Outcome& outcome,
@@ -254,8 +669,12 @@ namespace Aws
             auto context = Aws::MakeShared<DownloadDirectoryContext>(CLASS_TAG);
             context->rootDirectory = directory;
             context->prefix = prefix;
+            context->directoryHandle = directoryHandle;
+            // Released by the directory handle once it has finished.
+            directoryHandle->SetFileFinishedCallback([self, context]() { self->DispatchDirectoryDownloads(context); });
 
             m_transferConfig.s3Client->ListObjectsV2Async(request, handler, context);
+            return directoryHandle;
         }
 
         void TransferManager::DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle)
@@ -344,16 +763,47 @@ namespace Aws
             TriggerTransferStatusUpdatedCallback(handle);
 
 
+            std::shared_ptr<Aws::FileSystem::MappedFile> mappedFile;
+            if (m_transferConfig.useMemoryMappedFiles && !handle->GetTargetFilePath().empty())
+            {
+                mappedFile = Aws::MakeShared<Aws::FileSystem::MappedFile>(CLASS_TAG, handle->GetTargetFilePath());
+                if (!mappedFile->IsMapped() || mappedFile->GetSize() != handle->GetBytesTotalSize())
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not map file: ["
+                            << handle->GetTargetFilePath() << "], uploading it through transfer buffers.");
+                    mappedFile = nullptr;
+                }
+            }
+
             while (sentBytes < handle->GetBytesTotalSize() && handle->ShouldContinue() && partsIter != queuedParts.end())
             {
-                auto buffer = m_bufferManager.Acquire();
+                unsigned char* buffer = nullptr;
+                if (mappedFile)
+                {
+                    m_mappedPartSlots.WaitOne();
+                }
+                else
+                {
+                    buffer = m_bufferManager.Acquire();
+                }
+
                 if(handle->ShouldContinue())
                 {
                     auto lengthToWrite = partsIter->second->GetSizeInBytes();
-                    streamToPut->seekg((partsIter->first - 1) * m_transferConfig.bufferSize);
-                    streamToPut->read(reinterpret_cast<char*>(buffer), lengthToWrite);
-
-                    auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
+                    auto partOffset = (partsIter->first - 1) * m_transferConfig.bufferSize;
+                    Aws::Utils::Stream::PreallocatedStreamBuf* streamBuf = nullptr;
+                    if (mappedFile)
+                    {
+                        // The body reads its slice of the mapping in place and is never written to. Retries and the MD5 digest just read it again.
+                        auto slice = const_cast<unsigned char*>(mappedFile->GetData()) + partOffset;
+                        streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, slice, static_cast<size_t>(lengthToWrite));
+                    }
+                    else
+                    {
+                        streamToPut->seekg(partOffset);
+                        streamToPut->read(reinterpret_cast<char*>(buffer), lengthToWrite);
+                        streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
+                    }
                     auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
 
                     auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
@@ -379,6 +829,8 @@ namespace Aws
                     auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
                     asyncContext->handle = handle;
                     asyncContext->partState = partsIter->second;
+                    asyncContext->mappedFile = mappedFile;
+                    asyncContext->usesTransferBuffer = mappedFile == nullptr;
 
                     auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::UploadPartRequest& request,
                         const Aws::S3::Model::UploadPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
@@ -391,6 +843,10 @@ namespace Aws
 
                     ++partsIter;
                 }
+                else if (mappedFile)
+                {
+                    m_mappedPartSlots.Release();
+                }
                 else
                 {
                     m_bufferManager.Release(buffer);
@@ -422,7 +878,7 @@ namespace Aws
 #endif
         }
 
-        void TransferManager::DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle)
+        void TransferManager::DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle, bool useTransferBuffer)
         {
             auto partState = Aws::MakeShared<PartState>(CLASS_TAG, 1, 0, handle->GetBytesTotalSize(), true);
 
@@ -441,16 +897,20 @@ namespace Aws
 
             putObjectRequest.SetContentType(handle->GetContentType());
 
-            auto buffer = m_bufferManager.Acquire();
+            std::shared_ptr<Aws::IOStream> body = streamToPut;
+            if (useTransferBuffer)
+            {
+                auto buffer = m_bufferManager.Acquire();
 
-            auto lengthToWrite = (std::min)(m_transferConfig.bufferSize, handle->GetBytesTotalSize());
-            streamToPut->read((char*)buffer, lengthToWrite);
-            auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
-            auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
+                auto lengthToWrite = (std::min)(m_transferConfig.bufferSize, handle->GetBytesTotalSize());
+                streamToPut->read((char*)buffer, lengthToWrite);
+                auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
+                body = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
+            }
 
-            putObjectRequest.SetBody(preallocatedStreamReader);
+            putObjectRequest.SetBody(body);
             if (m_transferConfig.computeContentMD5) {
-                putObjectRequest.SetContentMD5(Aws::Utils::HashingUtils::Base64Encode(Aws::Utils::HashingUtils::CalculateMD5(*preallocatedStreamReader)));
+                putObjectRequest.SetContentMD5(Aws::Utils::HashingUtils::Base64Encode(Aws::Utils::HashingUtils::CalculateMD5(*body)));
             }
 
             auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
@@ -472,6 +932,7 @@ namespace Aws
             auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
             asyncContext->handle = handle;
             asyncContext->partState = partState;
+            asyncContext->usesTransferBuffer = useTransferBuffer;
 
             auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::PutObjectRequest& request,
                 const Aws::S3::Model::PutObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
@@ -490,7 +951,14 @@ namespace Aws
 
             auto originalStreamBuffer = (Aws::Utils::Stream::PreallocatedStreamBuf*)request.GetBody()->rdbuf();
 
-            m_bufferManager.Release(originalStreamBuffer->GetBuffer());
+            if (transferContext->usesTransferBuffer)
+            {
+                m_bufferManager.Release(originalStreamBuffer->GetBuffer());
+            }
+            else
+            {
+                m_mappedPartSlots.Release();
+            }
             Aws::Delete(originalStreamBuffer);
             const auto& handle = transferContext->handle;
             const auto& partState = transferContext->partState;
@@ -595,10 +1063,13 @@ namespace Aws
             std::shared_ptr<TransferHandleAsyncContext> transferContext =
                 std::const_pointer_cast<TransferHandleAsyncContext>(std::static_pointer_cast<const TransferHandleAsyncContext>(context));
 
-            auto originalStreamBuffer = static_cast<Aws::Utils::Stream::PreallocatedStreamBuf*>(request.GetBody()->rdbuf());
+            if (transferContext->usesTransferBuffer)
+            {
+                auto originalStreamBuffer = static_cast<Aws::Utils::Stream::PreallocatedStreamBuf*>(request.GetBody()->rdbuf());
 
-            m_bufferManager.Release(originalStreamBuffer->GetBuffer());
-            Aws::Delete(originalStreamBuffer);
+                m_bufferManager.Release(originalStreamBuffer->GetBuffer());
+                Aws::Delete(originalStreamBuffer);
+            }
 
             const auto& handle = transferContext->handle;
             const auto& partState = transferContext->partState;
@@ -636,6 +1107,8 @@ namespace Aws
             {
                 DownloadConfiguration retryDownloadConfig;
                 retryDownloadConfig.versionId = retryHandle->GetVersionId();
+                retryDownloadConfig.writePartsToFile = retryHandle->ShouldWritePartsToFile();
+                retryDownloadConfig.useDirectIO = retryHandle->ShouldUseDirectIO();
                 return DownloadFile(retryHandle->GetBucketName(), retryHandle->GetKey(), retryHandle->GetCreateDownloadStreamFunction(), retryDownloadConfig, retryHandle->GetTargetFilePath());
             }
 
@@ -715,6 +1188,22 @@ namespace Aws
             TriggerTransferStatusUpdatedCallback(handle);
         }
 
+        void TransferManager::DoSmallObjectDownload(const std::shared_ptr<TransferHandle>& handle, uint64_t objectSize)
+        {
+            if (!handle->HasParts())
+            {
+                auto partState = Aws::MakeShared<PartState>(CLASS_TAG, 1, 0, objectSize, true);
+                partState->SetRangeBegin(0);
+                handle->SetBytesTotalSize(objectSize);
+                handle->SetIsMultipart(false);
+                handle->AddQueuedPart(partState);
+            }
+
+            handle->UpdateStatus(TransferStatus::IN_PROGRESS);
+            TriggerTransferStatusUpdatedCallback(handle);
+            DoSinglePartDownload(handle);
+        }
+
         bool TransferManager::InitializePartsForDownload(const std::shared_ptr<TransferHandle>& handle)
         {
             bool isRetry = handle->HasParts();
@@ -794,6 +1283,7 @@ namespace Aws
 
         void TransferManager::DoDownload(const std::shared_ptr<TransferHandle>& handle)
         {
+            bool isRetry = handle->HasParts();
             if (!InitializePartsForDownload(handle))
             {
                 return;
@@ -811,6 +1301,19 @@ namespace Aws
                 return;
             }
 
+            std::shared_ptr<PartFile> partFile;
+            if (handle->ShouldWritePartsToFile() && !handle->GetTargetFilePath().empty())
+            {
+                partFile = Aws::MakeShared<PartFile>(CLASS_TAG);
+                bool directIO = handle->ShouldUseDirectIO() && bufferSize % DIRECT_IO_ALIGNMENT == 0;
+                if (!partFile->Open(handle->GetTargetFilePath(), handle->GetBytesTotalSize(), !isRetry, directIO))
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Unable to write parts directly to file ["
+                            << handle->GetTargetFilePath() << "], falling back to the download stream.");
+                    partFile = nullptr;
+                }
+            }
+
             auto queuedParts = handle->GetQueuedParts();
             auto queuedPartIter = queuedParts.begin();
             while(queuedPartIter != queuedParts.end() && handle->ShouldContinue())
@@ -818,20 +1321,37 @@ namespace Aws
                 const auto& partState = queuedPartIter->second;
                 uint64_t rangeStart = handle->GetBytesOffset() + ( partState->GetPartId() - 1 ) * bufferSize;
                 uint64_t rangeEnd = rangeStart + partState->GetSizeInBytes() - 1;
-                auto buffer = m_bufferManager.Acquire();
-                partState->SetDownloadBuffer(buffer);
-
-                CreateDownloadStreamCallback responseStreamFunction = [partState, buffer, rangeEnd, rangeStart]()
+                unsigned char* buffer = nullptr;
+                CreateDownloadStreamCallback responseStreamFunction;
+                if (partFile)
+                {
+                    // The body is written into the file as it arrives, so no transfer buffer is needed.
+                    uint64_t fileOffset = partState->GetRangeBegin();
+                    uint64_t partSize = partState->GetSizeInBytes();
+                    responseStreamFunction = [partState, partFile, fileOffset, partSize]()
+                    {
+                        auto fileStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG,
+                                Aws::MakeUnique<PartFileStreamBuf>(CLASS_TAG, partFile, fileOffset, partSize));
+                        partState->SetDownloadPartStream(fileStream);
+                        return fileStream;
+                    };
+                }
+                else
                 {
-                    auto bufferStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG,
-                            Aws::MakeUnique<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, rangeEnd - rangeStart + 1));
-                    partState->SetDownloadPartStream(bufferStream);
-                    return bufferStream;
-                };
+                    buffer = m_bufferManager.Acquire();
+                    partState->SetDownloadBuffer(buffer);
+
+                    responseStreamFunction = [partState, buffer, rangeEnd, rangeStart]()
+                    {
+                        auto bufferStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG,
+                                Aws::MakeUnique<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, rangeEnd - rangeStart + 1));
+                        partState->SetDownloadPartStream(bufferStream);
+                        return bufferStream;
+                    };
+                }
 
                 if(handle->ShouldContinue())
                 {
-                    partState->SetDownloadBuffer(buffer);
 
                     auto getObjectRangeRequest = m_transferConfig.getObjectTemplate;
                     getObjectRangeRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
@@ -847,8 +1367,18 @@ namespace Aws
 
                     auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
 
-                    getObjectRangeRequest.SetDataReceivedEventHandler([self, partState, handle](const Aws::Http::HttpRequest*, Aws::Http::HttpResponse*, long long progress)
+                    bool writesToFile = static_cast<bool>(partFile);
+                    getObjectRangeRequest.SetDataReceivedEventHandler([self, partState, handle, writesToFile](const Aws::Http::HttpRequest*, Aws::Http::HttpResponse* response, long long progress)
                     {
+                        if (writesToFile)
+                        {
+                            // The body is only written into the file once the response is known to be a success, an error body is read by the client.
+                            Aws::IOStream* partStream = partState->GetDownloadPartStream();
+                            if (!static_cast<PartFileStreamBuf*>(partStream->rdbuf())->OnResponseCode(response->GetResponseCode()))
+                            {
+                                partStream->setstate(std::ios_base::badbit);
+                            }
+                        }
                         partState->OnDataTransferred(progress, handle);
                         self->TriggerDownloadProgressCallback(handle);
                     });
@@ -862,6 +1392,7 @@ namespace Aws
                     auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
                     asyncContext->handle = handle;
                     asyncContext->partState = partState;
+                    asyncContext->partFile = partFile;
 
                     auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::GetObjectRequest& request,
                         const Aws::S3::Model::GetObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
@@ -924,8 +1455,35 @@ namespace Aws
                 {
                     Aws::IOStream* bufferStream = partState->GetDownloadPartStream();
                     assert(bufferStream);
-                    handle->WritePartToDownloadStream(bufferStream, partState->GetRangeBegin());
-                    handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    if (transferContext->partFile)
+                    {
+                        // Http clients reporting the status only once the response is complete leave the body in memory until now.
+                        auto partBuffer = static_cast<PartFileStreamBuf*>(bufferStream->rdbuf());
+                        if (!partBuffer->OnResponseCode(Aws::Http::HttpResponseCode::OK) || partBuffer->pubsync() != 0)
+                        {
+                            bufferStream->setstate(std::ios_base::badbit);
+                        }
+
+                        // The http client flushed the body into the file already, a failed write leaves the stream bad.
+                        if (bufferStream->good())
+                        {
+                            handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                        }
+                        else
+                        {
+                            Aws::Client::AWSError<Aws::S3::S3Errors> writeError(Aws::S3::S3Errors::INTERNAL_FAILURE, "WriteError",
+                                    "Failed to write part " + Aws::Utils::StringUtils::to_string(partState->GetPartId()) + " to file " + handle->GetTargetFilePath(), false);
+                            AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] " << writeError);
+                            handle->ChangePartToFailed(partState);
+                            handle->SetError(writeError);
+                            TriggerErrorCallback(handle, writeError);
+                        }
+                    }
+                    else
+                    {
+                        handle->WritePartToDownloadStream(bufferStream, partState->GetRangeBegin());
+                        handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    }
                 }
                 else
                 {
@@ -947,6 +1505,11 @@ namespace Aws
 
             if (pendingParts.size() == 0 && queuedParts.size() == 0)
             {
+                if (transferContext->partFile && transferContext->partFile->IsDirectIO())
+                {
+                    transferContext->partFile->Truncate(handle->GetBytesTotalSize());
+                }
+
                 if (failedParts.size() == 0 && handle->GetBytesTransferred() == handle->GetBytesTotalSize())
                 {
                     handle->UpdateStatus(TransferStatus::COMPLETED);
@@ -1015,60 +1578,132 @@ namespace Aws
         void TransferManager::HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
             const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
-            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
-            auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
-                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) { self->HandleListObjectsResponse(client, request, outcome, context); };
-
-            auto downloadContext = std::static_pointer_cast<const DownloadDirectoryContext>(context);
+            auto downloadContext = std::const_pointer_cast<DownloadDirectoryContext>(std::static_pointer_cast<const DownloadDirectoryContext>(context));
             const auto& directory = downloadContext->rootDirectory;
             const auto& prefix = downloadContext->prefix;
 
             if (outcome.IsSuccess())
             {
-                Aws::S3::Model::ListObjectsV2Request requestCpy = request;
-
                 auto& result = outcome.GetResult();
 
                 AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects succeeded for bucket: " << directory <<
                         " with prefix: " << prefix << ". Number of keys received: " << result.GetContents().size());
 
-                //if it was truncated, we don't care on this pass anyways. Just go ahead and kick off another list objects and will handle it when it finishes.
-                if (result.GetIsTruncated())
-                {
-                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects response has a continuation token for bucket: "
-                            << directory << " with prefix: " << prefix << ". Getting the next set of results.");
-                    requestCpy.SetContinuationToken(result.GetNextContinuationToken());
-                    m_transferConfig.s3Client->ListObjectsV2Async(requestCpy, handler, context);
-                }
-
-                //this can contain matching directories or actual objects to download. If it's a directory, go ahead and create a local directory then
-                // take the new prefix and call list again. if it's an object key, go ahead and initiate download.
+                std::lock_guard<std::mutex> locker(downloadContext->lock);
+                //this can contain matching directories or actual objects to download. Directories are created along with the files they contain.
                 for (auto& content : result.GetContents())
                 {
                     if (!IsS3KeyPrefix(content.GetKey()))
                     {
-                        Aws::String fileName = DetermineFilePath(downloadContext->rootDirectory, downloadContext->prefix, content.GetKey());
-                        auto lastDelimter = fileName.find_last_of(Aws::FileSystem::PATH_DELIM);
-                        if (lastDelimter != std::string::npos)
-                        {
-                            Aws::FileSystem::CreateDirectoryIfNotExists(fileName.substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
-                        }
-                        AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << content.GetKey() <<
-                                "] in bucket: [" << directory << "] to destination file: [" << fileName << "]");
-                        m_transferConfig.transferInitiatedCallback(this, DownloadFile(request.GetBucket(), content.GetKey(), fileName));
+                        downloadContext->pendingObjects.push_back(content);
                     }
                 }
+
+                //if it was truncated, the next page is listed once the downloads have caught up with this one.
+                downloadContext->hasMorePages = result.GetIsTruncated();
+                if (result.GetIsTruncated())
+                {
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects response has a continuation token for bucket: "
+                            << directory << " with prefix: " << prefix << ".");
+                    downloadContext->nextListRequest = request;
+                    downloadContext->nextListRequest.SetContinuationToken(result.GetNextContinuationToken());
+                }
+                downloadContext->listing = false;
             }
             else
             {
                 AWS_LOGSTREAM_ERROR(CLASS_TAG, "Listing objects failed for bucket: " << directory << " with prefix: "
                         << prefix << ". Error message: " << outcome.GetError());
+                downloadContext->directoryHandle->SetError(outcome.GetError());
                 //notify user if list objects failed.
                 if (m_transferConfig.errorCallback)
                 {
                     auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, request.GetBucket(), "");
                     m_transferConfig.errorCallback(this, handle, outcome.GetError());
                 }
+
+                std::lock_guard<std::mutex> locker(downloadContext->lock);
+                downloadContext->hasMorePages = false;
+                downloadContext->listing = false;
+            }
+
+            DispatchDirectoryDownloads(downloadContext);
+        }
+
+        void TransferManager::DispatchDirectoryDownloads(const std::shared_ptr<DownloadDirectoryContext>& context)
+        {
+            const auto& directoryHandle = context->directoryHandle;
+            Aws::Vector<std::pair<Aws::S3::Model::Object, std::shared_ptr<TransferHandle>>> downloads;
+            bool listNextPage = false;
+            bool allFilesInitiated = false;
+            {
+                std::lock_guard<std::mutex> locker(context->lock);
+                if (!directoryHandle->ShouldContinue())
+                {
+                    context->pendingObjects.clear();
+                    context->hasMorePages = false;
+                }
+
+                while (!context->pendingObjects.empty() && directoryHandle->HasFileSlot())
+                {
+                    const auto& object = context->pendingObjects.front();
+                    Aws::String fileName = DetermineFilePath(context->rootDirectory, context->prefix, object.GetKey());
+                    auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, directoryHandle->GetBucketName(), object.GetKey(), CreateDownloadFileFunction(fileName), fileName);
+                    directoryHandle->AddFile(handle, static_cast<uint64_t>(object.GetSize()));
+                    downloads.emplace_back(object, handle);
+                    context->pendingObjects.pop_front();
+                }
+
+                if (context->hasMorePages && !context->listing && context->pendingObjects.size() < m_transferConfig.maxConcurrentDirectoryFiles)
+                {
+                    context->listing = true;
+                    listNextPage = true;
+                }
+                allFilesInitiated = !context->hasMorePages && !context->listing && context->pendingObjects.empty();
+            }
+
+            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
+            uint64_t smallObjectSize = m_transferConfig.bufferSize;
+            for (const auto& download : downloads)
+            {
+                const auto& handle = download.second;
+                auto objectSize = static_cast<uint64_t>(download.first.GetSize());
+                auto lastDelimter = handle->GetTargetFilePath().find_last_of(Aws::FileSystem::PATH_DELIM);
+                if (lastDelimter != std::string::npos)
+                {
+                    Aws::FileSystem::CreateDirectoryIfNotExists(handle->GetTargetFilePath().substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
+                }
+                AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << handle->GetKey() <<
+                        "] in bucket: [" << handle->GetBucketName() << "] to destination file: [" << handle->GetTargetFilePath() << "]");
+
+                m_transferConfig.transferExecutor->Submit([self, handle, objectSize, smallObjectSize]
+                    {
+                        if (objectSize <= smallObjectSize)
+                        {
+                            self->DoSmallObjectDownload(handle, objectSize);
+                        }
+                        else
+                        {
+                            self->DoDownload(handle);
+                        }
+                    });
+                if (m_transferConfig.transferInitiatedCallback)
+                {
+                    m_transferConfig.transferInitiatedCallback(this, handle);
+                }
+            }
+
+            if (listNextPage)
+            {
+                auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
+                    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) { self->HandleListObjectsResponse(client, request, outcome, context); };
+                // Nothing else touches the request while a page is being listed.
+                m_transferConfig.s3Client->ListObjectsV2Async(context->nextListRequest, handler, context);
+            }
+
+            if (allFilesInitiated)
+            {
+                directoryHandle->SetAllFilesInitiated();
             }
         }
 
@@ -116,13 +116,16 @@ endfunction()
 
 set(HIGH_LEVEL_SDK_LIST "")
 list(APPEND HIGH_LEVEL_SDK_LIST "access-management")
+list(APPEND HIGH_LEVEL_SDK_LIST "cloudwatch-logging")
 list(APPEND HIGH_LEVEL_SDK_LIST "identity-management")
+list(APPEND HIGH_LEVEL_SDK_LIST "kinesis-producer")
 list(APPEND HIGH_LEVEL_SDK_LIST "queues")
 list(APPEND HIGH_LEVEL_SDK_LIST "transfer")
 list(APPEND HIGH_LEVEL_SDK_LIST "s3-encryption")
 list(APPEND HIGH_LEVEL_SDK_LIST "text-to-speech")
 
 set(SDK_TEST_PROJECT_LIST "")
+list(APPEND SDK_TEST_PROJECT_LIST "cloudwatch-logging:aws-cpp-sdk-cloudwatch-logging-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "cognito-identity:aws-cpp-sdk-cognitoidentity-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "core:aws-cpp-sdk-core-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "dynamodb:aws-cpp-sdk-dynamodb-integration-tests")
@@ -130,6 +133,7 @@ list(APPEND SDK_TEST_PROJECT_LIST "ec2:aws-cpp-sdk-ec2-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "elasticfilesystem:aws-cpp-sdk-elasticfilesystem-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "identity-management:aws-cpp-sdk-identity-management-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "kinesis:aws-cpp-sdk-kinesis-integration-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "kinesis-producer:aws-cpp-sdk-kinesis-producer-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "lambda:aws-cpp-sdk-lambda-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "logs:aws-cpp-sdk-logs-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "mediastore-data:aws-cpp-sdk-mediastore-data-integration-tests")
@@ -145,15 +149,19 @@ list(APPEND SDK_TEST_PROJECT_LIST "transcribestreaming:aws-cpp-sdk-transcribestr
 
 set(SDK_DEPENDENCY_LIST "")
 list(APPEND SDK_DEPENDENCY_LIST "access-management:iam,cognito-identity,core")
+list(APPEND SDK_DEPENDENCY_LIST "cloudwatch-logging:logs,core")
 list(APPEND SDK_DEPENDENCY_LIST "identity-management:cognito-identity,sts,core")
+list(APPEND SDK_DEPENDENCY_LIST "kinesis-producer:kinesis,core")
 list(APPEND SDK_DEPENDENCY_LIST "queues:sqs,core")
 list(APPEND SDK_DEPENDENCY_LIST "s3-encryption:s3,kms,core")
 list(APPEND SDK_DEPENDENCY_LIST "text-to-speech:polly,core")
 list(APPEND SDK_DEPENDENCY_LIST "transfer:s3,core")
 
 set(TEST_DEPENDENCY_LIST "")
+list(APPEND TEST_DEPENDENCY_LIST "cloudwatch-logging:logs,core")
 list(APPEND TEST_DEPENDENCY_LIST "cognito-identity:access-management,iam,core")
 list(APPEND TEST_DEPENDENCY_LIST "identity-management:cognito-identity,sts,core")
+list(APPEND TEST_DEPENDENCY_LIST "kinesis-producer:kinesis,core")
 list(APPEND TEST_DEPENDENCY_LIST "lambda:access-management,cognito-identity,iam,kinesis,core")
 list(APPEND TEST_DEPENDENCY_LIST "s3-encryption:s3,kms,core")
 list(APPEND TEST_DEPENDENCY_LIST "s3control:s3,access-management,cognito-identity,iam,core")
@@ -35,6 +35,7 @@ public class Shape {
     private boolean isReferenced;
     private boolean flattened;
     private boolean computeContentMd5;
+    private String requestCompressionAlgorithm;
     private boolean supportsPresigning;
     private boolean signBody;
     private String signerName;
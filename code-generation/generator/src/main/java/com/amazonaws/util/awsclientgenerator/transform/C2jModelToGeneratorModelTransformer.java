@@ -453,6 +453,11 @@ public class C2jModelToGeneratorModelTransformer {
                 requestShape.setComputeContentMd5(true);
             }
 
+            if(c2jOperation.getRequestcompression() != null && c2jOperation.getRequestcompression().getEncodings() != null
+                    && c2jOperation.getRequestcompression().getEncodings().contains("gzip")) {
+                requestShape.setRequestCompressionAlgorithm("GZIP");
+            }
+
             requestShape.getMembers().values().stream().filter(member -> member.getShape().isEventStream()).forEach(member -> member.getShape().setOutgoingEventStream(true));
 
             ShapeMember requestMember = new ShapeMember();
@@ -545,6 +550,7 @@ public class C2jModelToGeneratorModelTransformer {
         cloned.setFlattened(shape.isFlattened());
         cloned.setTimestampFormat(shape.getTimestampFormat());
         cloned.setComputeContentMd5(shape.isComputeContentMd5());
+        cloned.setRequestCompressionAlgorithm(shape.getRequestCompressionAlgorithm());
         cloned.setSupportsPresigning(shape.isSupportsPresigning());
         cloned.setSignBody(shape.isSignBody());
         cloned.setSignerName(shape.getSignerName());
@@ -0,0 +1,151 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0.
+#
+# Turns a log written by Aws::Utils::Logging::BinaryLogSystem into the text lines DefaultLogSystem would have written.
+# The layout of the log is described in aws-cpp-sdk-core/source/utils/logging/BinaryLogSystem.cpp.
+
+import argparse
+import datetime
+import re
+import struct
+import sys
+
+LOG_MAGIC = b"AWSBLOG1"
+LOG_LEVEL_NAMES = { 1 : "FATAL", 2 : "ERROR", 3 : "WARN", 4 : "INFO", 5 : "DEBUG", 6 : "TRACE" }
+CONVERSION_SPEC = re.compile(r"%(?P<flags>[-+ #0']*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d*))?"
+                             r"(?P<length>hh|h|ll|l|q|j|z|t|L|I64|I32|I)?(?P<conversion>.?)", re.DOTALL)
+
+class BinaryLogReader:
+    def __init__(self, data):
+        self.data = data
+        self.position = 0
+        if data[:len(LOG_MAGIC)] != LOG_MAGIC:
+            raise ValueError("Not a binary log")
+        self.position = len(LOG_MAGIC)
+        # The byte order mark is written as 0x01020304 in the byte order of the host that wrote the log.
+        self.byteOrder = "<" if data[self.position:self.position + 4] == b"\x04\x03\x02\x01" else ">"
+        self.position += 4
+
+    def AtEnd(self):
+        return self.position >= len(self.data)
+
+    def Read(self, format):
+        format = self.byteOrder + format
+        size = struct.calcsize(format)
+        if self.position + size > len(self.data):
+            raise EOFError("Truncated record")
+        values = struct.unpack_from(format, self.data, self.position)
+        self.position += size
+        return values[0] if len(values) == 1 else values
+
+    def ReadBytes(self):
+        length = self.Read("I")
+        if self.position + length > len(self.data):
+            raise EOFError("Truncated record")
+        value = self.data[self.position:self.position + length]
+        self.position += length
+        return value.decode("utf-8", "replace")
+
+    def ReadArgument(self):
+        kind = self.Read("c")
+        if kind == b"i":
+            return self.Read("q")
+        if kind in (b"u", b"p"):
+            return self.Read("Q")
+        if kind == b"f":
+            return self.Read("d")
+        if kind == b"s":
+            return self.ReadBytes()
+        raise ValueError("Unknown argument kind " + repr(kind))
+
+def FormatConversion(match, arguments):
+    flags = match.group("flags").replace("'", "")
+    conversion = match.group("conversion")
+    width = match.group("width") or ""
+    if width == "*":
+        width = str(arguments.pop(0))
+    precision = match.group("precision")
+    if precision == "*":
+        precision = str(arguments.pop(0))
+    precision = "" if precision is None else "." + precision
+
+    if conversion == "%":
+        return "%"
+    if conversion == "n":
+        return ""
+    value = arguments.pop(0)
+    if conversion in "diu":
+        return ("%" + flags + width + precision + "d") % value
+    if conversion == "o":
+        # Python writes the alternate form of octal as 0o10 rather than 010.
+        return (("%" + flags + width + precision + conversion) % value).replace("0o", "0")
+    if conversion in "xXeEfFgGs":
+        return ("%" + flags + width + precision + conversion) % value
+    if conversion == "c":
+        return ("%" + flags + width + "c") % chr(value)
+    if conversion == "p":
+        return ("%" + flags + width + "s") % hex(value)
+    if conversion in "aA":
+        text = float.hex(value)
+        return ("%" + flags + width + "s") % (text.upper() if conversion == "A" else text)
+    raise ValueError("Unknown conversion " + conversion)
+
+def FormatMessage(format, arguments):
+    # The log system stops recording arguments at a conversion it doesn't know, the rest of the format is then written as is.
+    arguments = list(arguments)
+    message = []
+    position = 0
+    for match in CONVERSION_SPEC.finditer(format):
+        message.append(format[position:match.start()])
+        position = match.start()
+        try:
+            message.append(FormatConversion(match, arguments))
+        except (IndexError, ValueError, TypeError):
+            break
+        position = match.end()
+    message.append(format[position:])
+    return "".join(message)
+
+def DecodeLog(data, output):
+    reader = BinaryLogReader(data)
+    strings = {}
+    while not reader.AtEnd():
+        recordType = reader.Read("c")
+        if recordType == b"S":
+            stringId = reader.Read("I")
+            strings[stringId] = reader.ReadBytes()
+        elif recordType == b"L":
+            logLevel, timestampMillis, threadId, tagId, formatId, argumentCount = reader.Read("BqQIIH")
+            arguments = [reader.ReadArgument() for i in range(argumentCount)]
+            timestamp = datetime.datetime.fromtimestamp(timestampMillis // 1000, datetime.timezone.utc).strftime("%Y-%m-%d %H:%M:%S")
+            output.write("[%s] %s.%03d %s [%d] %s\n" % (LOG_LEVEL_NAMES.get(logLevel, "UNKOWN"), timestamp, timestampMillis % 1000,
+                                                       strings.get(tagId, "?"), threadId, FormatMessage(strings.get(formatId, ""), arguments)))
+        else:
+            raise ValueError("Unknown record type " + repr(recordType) + " at offset " + str(reader.position - 1))
+
+def DecodeLogFile(data, output):
+    try:
+        DecodeLog(data, output)
+    except EOFError:
+        # The process was most likely stopped while the last batch was being written.
+        sys.stderr.write("The log ends with a truncated record, skipped it\n")
+
+def ParseArguments():
+    parser = argparse.ArgumentParser(description="Decodes a log written by the AWS SDK for C++ BinaryLogSystem into text.")
+    parser.add_argument("logFile", help="Binary log to decode")
+    parser.add_argument("--output", help="File to write the text log to, the standard output by default")
+    return parser.parse_args()
+
+def Main():
+    arguments = ParseArguments()
+    with open(arguments.logFile, "rb") as logFile:
+        data = logFile.read()
+
+    if arguments.output:
+        with open(arguments.output, "w") as output:
+            DecodeLogFile(data, output)
+    else:
+        DecodeLogFile(data, sys.stdout)
+
+if __name__ == "__main__":
+    Main()
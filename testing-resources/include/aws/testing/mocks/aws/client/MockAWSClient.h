@@ -105,6 +105,15 @@ public:
         return httpOutcome;
     }
 
+    void MakeRequestAsync(const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+        const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+        const std::function<void(Aws::Client::HttpResponseOutcome&&)>& handler)
+    {
+        m_countedRetryStrategy->ResetAttemptedRetriesCount();
+        Aws::Client::AWSClient::AttemptExhaustivelyAsync("domain.com/something", request, executor, handler,
+            Aws::Http::HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
+    }
+
     inline static const char* GetMockAccessKey() { return "AKIDEXAMPLE"; }
     inline static const char* GetMockSecretAccessKey() { return "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"; }
 